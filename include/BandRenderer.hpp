@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "DisplayList.hpp"
+
+namespace Display {
+
+// Renders frames in bands of a few rows so a panel can be driven without a frame buffer. The frame is drawn once per
+// band with drawing clipped to the band, then the band is queued to the panel and the next one is drawn into a second
+// band buffer while it is sent. A 128x128 panel rendered in bands of 16 rows needs 2 KB for both band buffers instead
+// of the 8 KB of its frame buffer.
+//
+//   Driver::SSD1327_128X128_SPI_DRIVER panel(pins, Driver::Memory::NONE);
+//   Display display(&panel);
+//   display.setup();
+//
+//   BandRenderer bands(&panel, 16);
+//   bands.render(drawMenu, &menu);
+//
+// Everything that is drawn is rasterized once for each band it overlaps and rejected by the clip for the others, so a
+// frame that doesn't change between bands is best recorded into a DisplayList and rendered from that, which skips the
+// commands outside of each band.
+class BandRenderer : public Driver::Driver {
+public:
+  // draws the frame, called once per band and has to draw the same frame every time
+  typedef void (*DrawCallback)(Display &display, void *arg);
+
+  // Renders to `panel` in bands of `rows` rows, the last band of a frame is shorter if they don't divide its height.
+  // Both band buffers are allocated in `memory`, which has to be DMA capable for SPI panels.
+  BandRenderer(::Display::Driver::Driver *panel, uint16_t rows,
+               ::Display::Driver::Memory memory = ::Display::Driver::Memory::DMA);
+  ~BandRenderer();
+
+  // the band buffers belong to a single renderer
+  BandRenderer(const BandRenderer &) = delete;
+  BandRenderer &operator=(const BandRenderer &) = delete;
+
+  uint16_t getWidth() { return panel->getWidth(); };
+  uint16_t getHeight() { return panel->getHeight(); };
+
+  // bytes of a single band buffer
+  size_t getBufferSize() { return (size_t)rows * bytesPerRow; };
+
+  // Renders a frame and returns once its last band is queued, Display::waitForUpdate on the panel waits for it to be
+  // sent. Returns ESP_ERR_NO_MEM if the band buffers couldn't be allocated and ESP_ERR_NOT_SUPPORTED if the panel can't
+  // be sent rows, e.g. while it is quarter turned.
+  esp_err_t render(DrawCallback draw, void *arg = nullptr);
+
+  // renders the commands of `list`, returns ESP_ERR_NO_MEM if it overflowed while recording
+  esp_err_t render(DisplayList &list);
+
+  // bands are sent to the panel by render
+  esp_err_t sendCommands(uint8_t *commands, uint8_t bytes) { return ESP_ERR_NOT_SUPPORTED; };
+  esp_err_t initializeDisplay() { return bands == nullptr ? ESP_ERR_NO_MEM : ESP_OK; };
+  esp_err_t sendBufferToDisplay() { return ESP_OK; };
+
+  // the panel is turned with Display::setRotation
+  esp_err_t setRotation(Rotation rotation) { return rotation == Rotation::DEFAULT ? ESP_OK : ESP_ERR_NOT_SUPPORTED; };
+
+  // clears the band that is drawn
+  esp_err_t clearBuffer();
+
+  // prints the band that is drawn
+  void printBuffer();
+
+  void setBufferPixel(int16_t x, int16_t y, uint16_t color);
+  void setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color);
+
+  void setBufferPixels(const Point *points, size_t count, uint16_t color);
+  void setBufferPixels(const ColoredPoint *points, size_t count);
+  void setBufferSpans(const Span *spans, size_t count, uint16_t color);
+
+  void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, const void *bitmap,
+                           Bitmap::BitmapFormat format, uint16_t color, Flags flags = Flags());
+  void writeSpriteToBuffer(int16_t x, int16_t y, const Sprite &sprite, Flags flags = Flags());
+
+protected:
+  // the rows of the band that is drawn
+  Rect getSurface() { return {0, top, getWidth(), height}; };
+
+private:
+  ::Display::Driver::Driver *panel;
+  uint16_t rows;
+  uint16_t bytesPerRow;
+
+  // both band buffers, one after the other
+  uint8_t *bands;
+
+  // first row and number of rows of the band that is drawn
+  int16_t top = 0;
+  uint16_t height = 0;
+
+  // Where the frame would start if the band was part of it. The kernels address the band through this with screen
+  // coordinates, which is safe since drawing is limited to the rows of the band.
+  uint8_t *frame();
+};
+
+} // namespace Display
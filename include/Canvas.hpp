@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "Display.hpp"
+
+namespace Display {
+
+// An off-screen surface that is drawn to through a Display like any screen and blitted to a screen or another canvas
+// like a bitmap. Its pixels are packed the way bitmaps of its format are, so blitting reads the buffer as it is, except
+// that rows of 4 bit canvases of an odd width are padded to whole bytes.
+// Widgets that rarely change, e.g. a dial face, are drawn once and then only blitted every frame.
+//
+//   Canvas dial(48, 48, Bitmap::GRAYSCALE_4_BIT);
+//   Display dialDisplay(&dial);
+//   dialDisplay.drawCircle(Origin::Object2D::CENTER, 24, 24, 46, 0xf);
+//
+//   dial.drawTo(display, Origin::Object2D::CENTER, 64, 64);
+//
+// Colors are pixel values of the canvas format, e.g. 0xffff is white in every format. Monochrome canvases set a pixel
+// for every color whose low 4 bits aren't 0. Bitmaps of other formats are converted, see Bitmap::convertColor.
+//
+// Canvases of the formats a panel takes are its frame buffer in that format, e.g. a driver for an RGB565 panel draws
+// into an RGB565 canvas and sends its buffer as it is. Monochrome and 4 bit canvases have kernels that write many
+// pixels at once, the other formats are drawn pixel by pixel.
+class Canvas : public Driver::Driver {
+public:
+  // bytes of the buffer of a canvas, rows of 4 bit canvases are padded to whole bytes, see getBufferStride
+  static constexpr size_t bufferSize(uint16_t width, uint16_t height, Bitmap::BitmapFormat format) {
+    if (format == Bitmap::GRAYSCALE_4_BIT)
+      return ((size_t)(width + (width % 2)) * height) / 2;
+
+    return (((size_t)width * height * Bitmap::bitsPerPixel(format)) + 7) / 8;
+  };
+
+  // allocates the buffer in `memory`, getBuffer() returns nullptr if there isn't enough
+  Canvas(uint16_t width, uint16_t height, Bitmap::BitmapFormat format,
+         ::Display::Driver::Memory memory = ::Display::Driver::Memory::DEFAULT);
+
+  // draws into `buffer`, which has to hold bufferSize(width, height, format) bytes and stays owned by the caller
+  Canvas(uint16_t width, uint16_t height, Bitmap::BitmapFormat format, uint8_t *buffer);
+
+  ~Canvas();
+
+  // the buffer belongs to a single canvas
+  Canvas(const Canvas &) = delete;
+  Canvas &operator=(const Canvas &) = delete;
+
+  uint16_t getWidth() { return width; };
+  uint16_t getHeight() { return height; };
+  size_t getBufferSize() { return bufferSize(width, height, format); };
+  Bitmap::BitmapFormat getBufferFormat() { return format; };
+  Bitmap::BitmapFormat getFormat() { return format; };
+
+  // Blits the canvas to `display` with Display::drawBitmap, the color and flags are used the same way. Monochrome
+  // canvases are drawn in `color`, transparent flags leave the pixels that are 0 in the canvas untouched.
+  void drawTo(Display &display, Origin::Object2D origin, int16_t x, int16_t y, uint16_t color = 0xf,
+              Flags flags = Flags());
+
+  // a canvas isn't connected to a panel
+  esp_err_t sendCommands(uint8_t *commands, uint8_t bytes) { return ESP_ERR_NOT_SUPPORTED; };
+
+  esp_err_t initializeDisplay();
+  esp_err_t clearBuffer();
+
+  // there's nothing to send, this only starts tracking damage anew and keeps a second buffer up to date
+  esp_err_t sendBufferToDisplay() {
+    if (backBuffer != nullptr)
+      copyDamage(buffer, backBuffer, damage);
+    damage.clear();
+    return ESP_OK;
+  };
+
+  // canvases are turned by the screen they are blitted to
+  esp_err_t setRotation(Rotation rotation) { return rotation == Rotation::DEFAULT ? ESP_OK : ESP_ERR_NOT_SUPPORTED; };
+
+  void printBuffer();
+
+  void setBufferPixel(int16_t x, int16_t y, uint16_t color);
+  void setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color);
+
+  void setBufferPixels(const Point *points, size_t count, uint16_t color);
+  void setBufferPixels(const ColoredPoint *points, size_t count);
+  void setBufferSpans(const Span *spans, size_t count, uint16_t color);
+
+  void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, const void *bitmap,
+                           Bitmap::BitmapFormat format, uint16_t color, Flags flags = Flags());
+
+  void writeSpriteToBuffer(int16_t x, int16_t y, const Sprite &sprite, Flags flags = Flags());
+
+private:
+  uint16_t width;
+  uint16_t height;
+  Bitmap::BitmapFormat format;
+
+  // kept apart from `buffer`, which isn't freed if the caller supplied it
+  uint8_t *ownedBuffer = nullptr;
+
+  // writes a block of color to a monochrome buffer
+  void write1BitColorTo1BitBuffer(uint16_t color, int16_t x, int16_t y, uint16_t width, uint16_t height);
+
+  // writes a bitmap to a monochrome buffer, bitmaps of either format set the pixels that aren't 0
+  void writeBitmapTo1BitBuffer(const uint8_t *bitmap, Bitmap::BitmapFormat format, uint16_t color, int16_t x, int16_t y,
+                               uint16_t width, uint16_t height, Flags flags);
+};
+
+} // namespace Display
@@ -6,8 +6,12 @@
 
 #include "esp_types.h"
 
+#include "Dither.hpp"
 #include "Driver.hpp"
 #include "Font.hpp"
+#include "GlyphCache.hpp"
+#include "Sprite.hpp"
+#include "TextRun.hpp"
 
 namespace Display {
 
@@ -49,12 +53,36 @@ public:
   esp_err_t clear();
   esp_err_t update();
 
+  // Sends the frame without waiting for the transfer to finish. With a double buffered driver drawing the next frame
+  // overlaps the transfer of this one, see Driver::sendBufferToDisplayAsync.
+  esp_err_t updateAsync();
+  esp_err_t waitForUpdate(TickType_t timeout = portMAX_DELAY);
+
   esp_err_t setRotation(Rotation rotation);
 
+  // maximum number of clip rectangles that can be pushed at once
+  static constexpr uint8_t MAX_CLIP_DEPTH = 8;
+
+  // Limits drawing to the part of `rect` that is inside of the current clip rectangle until the matching popClip,
+  // e.g. to the visible part of a scrolling list. Primitives outside of it are rejected before they are rasterized.
+  // Returns ESP_ERR_NO_MEM if MAX_CLIP_DEPTH rectangles are pushed already. Clearing the display ignores the clip.
+  esp_err_t pushClip(Rect rect);
+
+  // restores the clip rectangle from before the last pushClip, returns ESP_ERR_INVALID_STATE if there is none
+  esp_err_t popClip();
+
+  // the rectangle drawing is currently limited to, the whole screen unless a clip rectangle is pushed
+  Rect getClip() { return driver->getClip(); };
+
   void printBuffer() { driver->printBuffer(); };
 
   void drawPixel(int16_t x, int16_t y, uint16_t color);
 
+  // draw many pixels or horizontal spans at once, e.g. particles, which is far cheaper than a drawPixel call for each
+  void drawPixels(const Point *points, size_t count, uint16_t color);
+  void drawPixels(const ColoredPoint *points, size_t count);
+  void drawSpans(const Span *spans, size_t count, uint16_t color);
+
   void drawLine(int16_t xStart, int16_t yStart, int16_t xEnd, int16_t yEnd, uint16_t color);
   void drawLine(Origin::Object1D origin, int16_t x, int16_t y, double length, double angle, uint16_t color);
 
@@ -64,30 +92,76 @@ public:
   void fillRectangle(Origin::Object2D origin, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color);
 
   void drawBitmap(Origin::Object2D origin, int16_t x, int16_t y, uint16_t width, uint16_t height,
-                  Bitmap::BitmapFormat format, void *bitmap, Flags flags = Flags());
+                  Bitmap::BitmapFormat format, const void *bitmap, Flags flags = Flags());
   void drawBitmap(Origin::Object2D origin, int16_t x, int16_t y, uint16_t width, uint16_t height,
-                  Bitmap::BitmapFormat format, void *bitmap, uint16_t color, Flags flags = Flags());
+                  Bitmap::BitmapFormat format, const void *bitmap, uint16_t color, Flags flags = Flags());
+
+  // draws a 4 bit sprite, which is faster than drawing its bitmap at every other x
+  void drawSprite(Origin::Object2D origin, int16_t x, int16_t y, const Sprite &sprite, Flags flags = Flags());
+
+  // returns row `row` of an image of 8 bit grays, valid until the next call
+  typedef const uint8_t *(*GrayRowCallback)(uint16_t row, void *arg);
 
-  void drawText(Origin::Text origin, int16_t x, int16_t y, uint8_t *font, char *text, uint16_t color,
+  // Draws an image of 8 bit grays dithered to the format of `ditherer`, a row at a time. The image comes from `grays`,
+  // a row after the other, or from `rows`, which is only asked for the rows inside of the clip, so e.g. a camera frame
+  // can be converted as it is drawn. Returns ESP_ERR_NO_MEM if the buffers of `ditherer` couldn't be allocated and
+  // ESP_ERR_INVALID_SIZE if the image is wider than they are.
+  esp_err_t drawDithered(Origin::Object2D origin, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                         const uint8_t *grays, Ditherer &ditherer, Flags flags = Flags());
+  esp_err_t drawDithered(Origin::Object2D origin, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                         GrayRowCallback rows, void *arg, Ditherer &ditherer, Flags flags = Flags());
+
+  void drawText(Origin::Text origin, int16_t x, int16_t y, const Font::Font &font, char *text, uint16_t color,
                 Flags flags = Flags());
-  void getTextSize(uint8_t *fontData, char *text, uint16_t &width, uint16_t &height);
+  void getTextSize(const Font::Font &font, char *text, uint16_t &width, uint16_t &height);
+
+  // Lays `text` out into `run`, replacing what it held, so it can be drawn again without decoding the text. Returns
+  // ESP_ERR_NO_MEM if the glyphs of `run` couldn't be allocated and ESP_ERR_INVALID_SIZE if `text` has more characters
+  // than they hold, either way `run` is left empty.
+  esp_err_t layoutText(const Font::Font &font, char *text, TextRun &run);
+
+  // draws text laid out with layoutText, the same as drawText draws it
+  void drawTextRun(Origin::Text origin, int16_t x, int16_t y, const TextRun &run, uint16_t color,
+                   Flags flags = Flags());
+
+  // draws text through `cache` from now on, nullptr draws every glyph from its bitmap again
+  void setGlyphCache(GlyphCache *cache) { glyphCache = cache; };
+
+  // moves `x` and `y` from `origin` of a width x height object to its top left corner
+  static void shiftOrigin2DToTopLeft(Origin::Object2D origin, int16_t &x, int16_t &y, uint16_t width,
+                                     uint16_t height);
 
   Driver::Driver *driver;
 
+protected:
+
+  static void getLineEndpoints(Origin::Object1D origin, int16_t x, int16_t y, double length, double angle,
+                               int16_t &xStart, int16_t &yStart, int16_t &xEnd, int16_t &yEnd);
+
 private:
-  void drawCircleWithEvenDiameterFromTopLeftCorner(int16_t x, int16_t y, uint16_t diameter, uint16_t color);
-  void drawCircleWithOddDiameterFromCenter(int16_t x, int16_t y, uint16_t diameter, uint16_t color);
+  // clip rectangles pushed so far, each one already intersected with the ones below it
+  Rect clipStack[MAX_CLIP_DEPTH];
+  uint8_t clipDepth = 0;
 
-  void shiftOrigin2DToTopLeft(Origin::Object2D origin, int16_t &x, int16_t &y, uint16_t width, uint16_t height);
+  GlyphCache *glyphCache = nullptr;
 
   // read the first UTF-8 character from a string and advance the string pointer
   // however many bytes the character spans
   uint16_t readUTF8Char(char *&string);
 
   // also sets the font origin X and Y offset from the top left corner of the
-  // string bounding box
-  void getTextSize(uint8_t *fontData, char *text, uint16_t &width, uint16_t &height, int16_t &originXOffset,
-                   int16_t &originYOffset, uint16_t &baselineLength);
+  // string bounding box, and adds each glyph to `run` if there is one
+  void getTextSize(const Font::Font &font, char *text, uint16_t &width, uint16_t &height, int16_t &originXOffset,
+                   int16_t &originYOffset, uint16_t &baselineLength, TextRun *run = nullptr);
+
+  // Moves `x` and `y` from `origin` to the start of the baseline of text of the given size and clears the area behind
+  // it unless the text is transparent. Returns false if the text is clipped entirely.
+  bool placeText(Origin::Text origin, int16_t &x, int16_t &y, uint16_t width, uint16_t height, int16_t originXOffset,
+                 int16_t originYOffset, uint16_t baselineLength, Flags flags);
+
+  // draws a glyph with its pen position at `x` on baseline `y`, from `glyphCache` if `cached`
+  void drawGlyph(const Font::Font &font, const Font::Character &character, int16_t x, int16_t y, uint16_t color,
+                 bool cached);
 };
 
 } // namespace Display
@@ -0,0 +1,116 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "Display.hpp"
+
+namespace Display {
+
+// Records what is drawn through a Display into a command buffer instead of a frame buffer, so it can be optimized once
+// and replayed to a screen as often as needed.
+//
+//   DisplayList menu(128, 128, 4096);
+//   Display recorder(&menu);
+//   recorder.clear();
+//   recorder.drawText(Origin::Text::CENTER, 64, 20, Font::bailleul_8_pt, (char *)"Menu", 0xf);
+//   menu.optimize();
+//
+//   menu.replay(display);
+//
+// Commands are recorded the way they reach the driver, e.g. circles as points, rectangles as blocks and text as glyph
+// bitmaps at their final positions, so replaying doesn't rasterize or lay out text again. Everything is clipped while
+// it's recorded and replayed inside of the clip of the screen. Bitmaps and sprites are recorded by pointer and have to
+// outlive the recording.
+class DisplayList : public Driver::Driver {
+public:
+  // `capacity` is the size of the command buffer in bytes, allocated in `memory`
+  DisplayList(uint16_t width, uint16_t height, size_t capacity,
+              ::Display::Driver::Memory memory = ::Display::Driver::Memory::DEFAULT);
+  ~DisplayList();
+
+  // the command buffer belongs to a single list
+  DisplayList(const DisplayList &) = delete;
+  DisplayList &operator=(const DisplayList &) = delete;
+
+  uint16_t getWidth() { return width; };
+  uint16_t getHeight() { return height; };
+
+  // drops everything that was recorded
+  void reset();
+
+  // true if a command didn't fit into the command buffer, nothing is recorded after that until the list is reset
+  bool hasOverflowed() { return overflowed; };
+
+  // bytes of the command buffer in use
+  size_t getSize() { return used; };
+  uint16_t getCommandCount();
+
+  // Optimizes the recorded commands. Blocks of the same color that continue the block before them are merged into it,
+  // then commands that a later clear, block or opaque bitmap paints over entirely are dropped.
+  void optimize();
+
+  // draws the commands to the driver of `display`, returns ESP_ERR_NO_MEM if the list overflowed while recording
+  esp_err_t replay(Display &display);
+
+  // a display list isn't connected to a panel
+  esp_err_t sendCommands(uint8_t *commands, uint8_t bytes) { return ESP_ERR_NOT_SUPPORTED; };
+
+  // starts a new recording, returns ESP_ERR_NO_MEM if the command buffer couldn't be allocated
+  esp_err_t initializeDisplay();
+
+  // records a clear, which also makes optimize() drop everything recorded before it
+  esp_err_t clearBuffer();
+
+  esp_err_t sendBufferToDisplay() { return ESP_OK; };
+  esp_err_t setRotation(Rotation rotation) { return rotation == Rotation::DEFAULT ? ESP_OK : ESP_ERR_NOT_SUPPORTED; };
+
+  // prints the recorded commands
+  void printBuffer();
+
+  void setBufferPixel(int16_t x, int16_t y, uint16_t color);
+  void setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color);
+
+  void setBufferPixels(const Point *points, size_t count, uint16_t color);
+  void setBufferPixels(const ColoredPoint *points, size_t count);
+  void setBufferSpans(const Span *spans, size_t count, uint16_t color);
+
+  void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, const void *bitmap,
+                           Bitmap::BitmapFormat format, uint16_t color, Flags flags = Flags());
+  void writeSpriteToBuffer(int16_t x, int16_t y, const Sprite &sprite, Flags flags = Flags());
+
+private:
+  enum class CommandType : uint8_t;
+  struct Command;
+  struct BitmapCommand;
+
+  // offset of the points or spans of a command
+  static const size_t ELEMENTS_OFFSET;
+
+  uint16_t width;
+  uint16_t height;
+
+  uint8_t *commands;
+  size_t capacity;
+  size_t used = 0;
+  bool overflowed = false;
+
+  // offset of the last command, points and spans of the same color are appended to it
+  size_t last = SIZE_MAX;
+
+  Command *next(Command *command);
+
+  // reserves a command of `size` bytes at the end of the buffer, returns nullptr if it doesn't fit
+  Command *append(CommandType type, size_t size, Rect bounds);
+
+  // appends a point or span to the last command if it has the same type and color, or starts a new command
+  void appendElement(CommandType type, uint16_t color, const void *element, size_t elementSize, Rect bounds);
+
+  // true if `command` writes every pixel of its bounds, no matter what it draws over
+  static bool isOpaque(Command *command);
+
+  void drawBitmapCommand(::Display::Driver::Driver *driver, BitmapCommand *command, Rect clip);
+};
+
+} // namespace Display
@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "Driver.hpp"
+
+namespace Display {
+
+// Dithers rows of 8 bit grays, e.g. of a camera thumbnail or a heat map, down to a gray format of up to 4 bits. Rows
+// are dithered one at a time into a row buffer allocated once, so neither the image nor a dithered copy of it has to
+// be held in memory, see Display::drawDithered.
+//
+//   Ditherer ditherer(Ditherer::Method::ERROR_DIFFUSION, Bitmap::GRAYSCALE_4_BIT, 96);
+//   display.drawDithered(Origin::Object2D::CENTER, 64, 64, 96, 72, thumbnail, ditherer);
+class Ditherer {
+public:
+  enum class Method {
+    // Compares every pixel against an 8x8 Bayer matrix. Fast and stable between frames, which suits moving images.
+    ORDERED,
+
+    // Floyd-Steinberg, spreads the error of every pixel to its neighbors to the right and below. Finer detail, but
+    // the pattern shifts when the image changes.
+    ERROR_DIFFUSION,
+  };
+
+  // Dithers rows of up to `maxWidth` pixels to `format`, which is MONOCHROME, GRAYSCALE_2_BIT or GRAYSCALE_4_BIT. The
+  // error and row buffers are allocated in `memory`, getRow() returns nullptr if there isn't enough.
+  Ditherer(Method method, Bitmap::BitmapFormat format, uint16_t maxWidth,
+           Driver::Memory memory = Driver::Memory::DEFAULT);
+  ~Ditherer();
+
+  // the buffers belong to a single ditherer
+  Ditherer(const Ditherer &) = delete;
+  Ditherer &operator=(const Ditherer &) = delete;
+
+  Bitmap::BitmapFormat getFormat() const { return format; };
+  uint16_t getMaxWidth() const { return maxWidth; };
+
+  // the last dithered row, packed like a bitmap of the format
+  const uint8_t *getRow() const { return row; };
+
+  // starts spreading errors anew, called before the first row of every image
+  void reset();
+
+  // dithers the `width` grays of row `y` of an image into getRow(), rows have to come in order for error diffusion
+  void ditherRow(const uint8_t *grays, uint16_t width, uint16_t y);
+
+private:
+  Method method;
+  Bitmap::BitmapFormat format;
+  uint16_t maxWidth;
+
+  // Errors of error diffusion, one per pixel plus one on each side so the pixels at the edges don't need a check.
+  // While a row is dithered they are the errors for it up to the current pixel and the ones for the next row after.
+  int16_t *errors = nullptr;
+  uint8_t *row = nullptr;
+};
+
+} // namespace Display
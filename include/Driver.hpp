@@ -4,18 +4,27 @@
 
 #pragma once
 
+#include <cstring>
+
 #include "sdkconfig.h"
 
 #include "esp_err.h"
 #include "esp_types.h"
+#include "freertos/FreeRTOS.h"
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include "driver/spi_master.h"
+#endif
 
 namespace Display {
 
+class Sprite;
+
 enum class Rotation {
   DEFAULT,
-  // CLOCKWISE_90,
+  CLOCKWISE_90,
   CLOCKWISE_180,
-  // CLOCKWISE_270,
+  CLOCKWISE_270,
 };
 
 struct Flags {
@@ -23,6 +32,45 @@ struct Flags {
   bool erase = false;
 };
 
+struct Rect {
+  int16_t x = 0;
+  int16_t y = 0;
+  uint16_t width = 0;
+  uint16_t height = 0;
+
+  bool isEmpty() const { return width == 0 || height == 0; };
+
+  // the part of this rectangle that is also inside of `other`, empty if they don't overlap
+  Rect intersect(const Rect &other) const {
+    int32_t left = x > other.x ? x : other.x;
+    int32_t top = y > other.y ? y : other.y;
+    int32_t right = x + width < other.x + other.width ? x + width : other.x + other.width;
+    int32_t bottom = y + height < other.y + other.height ? y + height : other.y + other.height;
+    if (left >= right || top >= bottom)
+      return {};
+
+    return {(int16_t)left, (int16_t)top, (uint16_t)(right - left), (uint16_t)(bottom - top)};
+  };
+};
+
+struct Point {
+  int16_t x = 0;
+  int16_t y = 0;
+};
+
+struct ColoredPoint {
+  int16_t x = 0;
+  int16_t y = 0;
+  uint16_t color = 0;
+};
+
+// horizontal run of `width` pixels starting at x, y
+struct Span {
+  int16_t x = 0;
+  int16_t y = 0;
+  uint16_t width = 0;
+};
+
 namespace Bitmap {
 
 typedef enum : uint8_t {
@@ -31,10 +79,72 @@ typedef enum : uint8_t {
 
   // 4 bits per pixel, 2 pixels per uint8_t
   GRAYSCALE_4_BIT,
+
+  // 2 bits per pixel, 4 pixels per uint8_t
+  GRAYSCALE_2_BIT,
+
+  // 8 bits per pixel
+  GRAYSCALE_8_BIT,
+
+  // 16 bits per pixel, 5 bits of red, 6 of green and 5 of blue, with the high byte first the way panels are sent them
+  RGB565,
 } BitmapFormat;
 
+// Pixels of every format are packed from the most significant bit of a byte on and rows aren't padded, so pixel `i`
+// of a bitmap is y * width + x.
+constexpr uint8_t bitsPerPixel(BitmapFormat format) {
+  switch (format) {
+  case MONOCHROME:
+    return 1;
+  case GRAYSCALE_2_BIT:
+    return 2;
+  case GRAYSCALE_4_BIT:
+    return 4;
+  case GRAYSCALE_8_BIT:
+    return 8;
+  case RGB565:
+    return 16;
+  }
+  return 0;
+}
+
+// the value of pixel `index` of `pixels`
+inline uint16_t getPixel(const uint8_t *pixels, BitmapFormat format, uint32_t index) {
+  uint8_t bits = bitsPerPixel(format);
+  if (bits == 16)
+    return (pixels[2 * index] << 8) | pixels[(2 * index) + 1];
+
+  uint32_t bit = index * bits;
+  return (pixels[bit / 8] >> (8 - bits - (bit % 8))) & ((1 << bits) - 1);
+}
+
+// sets pixel `index` of `pixels` to `value`, which has to fit the format
+inline void setPixel(uint8_t *pixels, BitmapFormat format, uint32_t index, uint16_t value) {
+  uint8_t bits = bitsPerPixel(format);
+  if (bits == 16) {
+    pixels[2 * index] = value >> 8;
+    pixels[(2 * index) + 1] = value;
+    return;
+  }
+
+  uint32_t bit = index * bits;
+  uint8_t shift = 8 - bits - (bit % 8);
+  uint8_t mask = ((1 << bits) - 1) << shift;
+  pixels[bit / 8] = (pixels[bit / 8] & ~mask) | ((value << shift) & mask);
 }
 
+// Converts a pixel value of `from` to the closest one of `to`. Grays are scaled to the depth of `to`, grays become
+// RGB565 colors with equal channels and RGB565 colors become grays of their luma. Monochrome pixels are 0 or the
+// brightest value of `to`, and monochrome results set every value but 0.
+uint16_t convertColor(uint16_t color, BitmapFormat from, BitmapFormat to);
+
+// Converts `width` x `height` pixels of `source` packed in `sourceFormat` to `destinationFormat`, e.g. to send a
+// canvas to a panel of another format. `destination` has to hold the packed pixels of the new format.
+void convert(const uint8_t *source, BitmapFormat sourceFormat, uint8_t *destination, BitmapFormat destinationFormat,
+             uint16_t width, uint16_t height);
+
+} // namespace Bitmap
+
 namespace Driver {
 
 struct PinMapSPI {
@@ -49,10 +159,51 @@ struct PinMap {
   PinMapSPI spi;
 };
 
+// where drivers allocate the memory they own, see allocateMemory
+enum class Memory : uint8_t {
+  DEFAULT,  // any byte addressable memory
+  INTERNAL, // internal RAM
+  DMA,      // DMA capable internal RAM, needed for buffers sent by SPI drivers
+  SPIRAM,   // external PSRAM, for large buffers that aren't sent by DMA
+  NONE,     // nothing is allocated, e.g. for panels that are only sent bands, see BandRenderer
+};
+
+// allocates zeroed memory in the requested placement, returns nullptr if there isn't enough
+uint8_t *allocateMemory(size_t bytes, Memory memory);
+void freeMemory(void *memory);
+
+// Tracks the regions of a buffer that changed since they were last sent to the display. Rectangles are merged whenever
+// sending their union costs less than sending them separately, so drivers can transfer just the damaged windows.
+class DamageMap {
+public:
+  // maximum number of separately tracked rectangles, beyond this the cheapest merge is forced
+  static constexpr uint8_t MAX_RECTS = 8;
+
+  // approximate cost of starting a transfer (setting the window, toggling D/C and the transaction setup) in pixels
+  static constexpr uint32_t TRANSFER_OVERHEAD = 64;
+
+  void add(Rect rect);
+  void clear() { count = 0; };
+
+  bool isEmpty() const { return count == 0; };
+  uint8_t size() const { return count; };
+  const Rect &operator[](uint8_t index) const { return rects[index]; };
+
+private:
+  Rect rects[MAX_RECTS];
+  uint8_t count = 0;
+};
+
+// Called once an asynchronous transfer of a frame has finished. Drivers may call this from an interrupt that runs while
+// the flash cache is disabled, so the callback has to be IRAM_ATTR and may only use FromISR APIs, e.g.
+// xSemaphoreGiveFromISR.
+typedef void (*TransferCallback)(void *arg);
+
 class Driver {
 public:
   Driver(){};
   Driver(PinMap pins) : pins(pins){};
+  virtual ~Driver(){};
 
   PinMap pins;
   virtual uint16_t getWidth() = 0;
@@ -74,13 +225,117 @@ public:
   // set a rectangle to a single color
   virtual void setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) = 0;
 
+  // Set many pixels or spans in one call, points and spans outside of the clip rectangle are skipped. The defaults go
+  // through setBufferPixel and setBufferBlock, buffered drivers override them to clip and write the whole batch in one
+  // loop.
+  virtual void setBufferPixels(const Point *points, size_t count, uint16_t color);
+  virtual void setBufferPixels(const ColoredPoint *points, size_t count);
+  virtual void setBufferSpans(const Span *spans, size_t count, uint16_t color);
+
   // writes a bitmap to the buffer
-  virtual void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, void *bitmap,
+  virtual void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, const void *bitmap,
                                    Bitmap::BitmapFormat format, uint16_t color, Flags flags = Flags()) = 0;
 
+  // Writes a sprite to the buffer, see Sprite. The default blits its rows as 4 bit bitmaps, drivers with a 4 bit
+  // buffer override it with a kernel that never shifts pixels.
+  virtual void writeSpriteToBuffer(int16_t x, int16_t y, const Sprite &sprite, Flags flags = Flags());
+
+  // Drawing outside of the clip rectangle is discarded, it covers the whole screen unless it was narrowed with setClip.
+  // Display keeps a stack of clip rectangles on top of this, see Display::pushClip.
+  void setClip(Rect rect) {
+    clip = rect.intersect(getSurface());
+    clipped = true;
+  };
+  void resetClip() { clipped = false; };
+  Rect getClip() { return clipped ? clip : getSurface(); };
+
+  // regions of the buffer that changed since the last call to sendBufferToDisplay
+  const DamageMap &getDamage() { return damage; };
+
+  // the buffer that is currently drawn to, with double buffering this changes on every asynchronous send
+  uint8_t *getBuffer() { return buffer; };
+  virtual size_t getBufferSize() { return ((size_t)getWidth() * getHeight() * 4) / 8; };
+  virtual Bitmap::BitmapFormat getBufferFormat() { return Bitmap::GRAYSCALE_4_BIT; };
+
+  // pixels from the start of one row of the buffer to the next, rows of 4 bit buffers are padded to whole bytes
+  uint16_t getBufferStride() {
+    return getBufferFormat() == Bitmap::GRAYSCALE_4_BIT ? getWidth() + (getWidth() % 2) : getWidth();
+  };
+
+  // Adds a second buffer of getBufferSize() bytes so frames can be sent asynchronously while the next one is drawn.
+  // For SPI drivers the buffer has to be DMA capable.
+  esp_err_t enableDoubleBuffering(uint8_t *secondBuffer);
+
+  // Sends the damaged regions of the buffer without waiting for the transfer. With double buffering the buffers are
+  // swapped so drawing continues in the other buffer, which is first brought up to date with the frame being sent.
+  // Without double buffering this is the same as sendBufferToDisplay.
+  esp_err_t sendBufferToDisplayAsync();
+
+  // waits for the last asynchronous transfer to finish, returns ESP_ERR_TIMEOUT if it is still in flight
+  esp_err_t waitForTransfer(TickType_t timeout = portMAX_DELAY);
+
+  // Queues `height` rows of the frame starting at row `y` for transfer without waiting, see BandRenderer. `rows` holds
+  // just those rows packed like the buffer and stays untouched until waitForTransfer has returned ESP_OK, the previous
+  // transfer is waited for first. Returns ESP_ERR_NOT_SUPPORTED while the frame is quarter turned, since the rows of
+  // the screen are columns of the panel then.
+  esp_err_t sendRowsToDisplayAsync(uint8_t *rows, int16_t y, uint16_t height);
+
+  void onTransferComplete(TransferCallback callback, void *arg) {
+    transferCallback = callback;
+    transferCallbackArg = arg;
+  };
+
 protected:
-  // crops a block within the screen bounds, returns false if the block doesn't
-  // overlap with the screen
+  DamageMap damage;
+
+  // buffer that is drawn to, drivers supporting double buffering point this at their frame buffer
+  uint8_t *buffer = nullptr;
+
+  // buffer owned by the transfer in flight (or the one last sent), nullptr without double buffering
+  uint8_t *backBuffer = nullptr;
+
+  // queues the damaged regions of `frame` for transfer without waiting, `frame` stays untouched until
+  // waitForBufferTransfer has returned ESP_OK
+  virtual esp_err_t queueBufferTransfer(uint8_t *frame, const DamageMap &frameDamage) { return ESP_ERR_NOT_SUPPORTED; };
+
+  // waits for the transfer queued by queueBufferTransfer or queueRowsTransfer to finish
+  virtual esp_err_t waitForBufferTransfer(TickType_t timeout) { return ESP_OK; };
+
+  // Queues the rows of sendRowsToDisplayAsync for transfer. The default passes them to queueBufferTransfer as the only
+  // damaged rows of a frame, which works for drivers that read nothing of the frame outside of its damage.
+  virtual esp_err_t queueRowsTransfer(uint8_t *rows, int16_t y, uint16_t height);
+
+  // the part of the screen the buffer holds, drawing outside of it is discarded like outside of the clip rectangle
+  virtual Rect getSurface() { return {0, 0, getWidth(), getHeight()}; };
+
+  // copies the damaged regions between the two buffers, drivers call this with (buffer, backBuffer) when sending the
+  // drawing buffer synchronously so the back buffer doesn't miss those changes
+  void copyDamage(uint8_t *from, uint8_t *to, const DamageMap &regions);
+
+  // Runs the completion callback, called by drivers once the last part of a frame was sent. It is always inlined since
+  // drivers call it from transfer interrupts in IRAM, which can't call into flash.
+  __attribute__((always_inline)) void notifyTransferComplete() {
+    if (transferCallback != nullptr)
+      transferCallback(transferCallbackArg);
+  };
+
+  // record that a region of the buffer changed, expects a block that is already cropped to the screen
+  void markDamaged(int16_t x, int16_t y, uint16_t width, uint16_t height) { damage.add({x, y, width, height}); };
+  void markAllDamaged();
+
+  // Set while the frame is turned a quarter clockwise in the buffer. Drawing then writes the pixel at x, y to
+  // width - 1 - y, x of the buffer, and drivers add their own half turn on top of it for 270 degrees.
+  bool quarterTurn = false;
+
+  // Switches quarter turns on or off and turns what is already in the buffer along with them, returns
+  // ESP_ERR_NOT_SUPPORTED for screens that aren't square.
+  esp_err_t setQuarterTurn(bool enabled);
+
+  // moves a block that is already cropped from screen coordinates to where it is in a quarter turned buffer
+  void turnBlock(int16_t &x, int16_t &y, uint16_t &width, uint16_t &height);
+
+  // crops a block to the clip rectangle, returns false if the block doesn't
+  // overlap with it
   bool cropBlock(int16_t &x, int16_t &y, uint16_t &width, uint16_t &height);
 
   // writes a block of color to a buffer assuming 4 bit pixels in the
@@ -90,96 +345,360 @@ protected:
 
   // writes a bitmap to a buffer assuming 1 bit pixels in the source and 4 bit
   // pixels destination using the specified color
-  void write1BitBitmapTo4BitBuffer(uint8_t *bitmap, uint16_t color, uint8_t *buffer, int16_t x, int16_t y,
+  void write1BitBitmapTo4BitBuffer(const uint8_t *bitmap, uint16_t color, uint8_t *buffer, int16_t x, int16_t y,
                                    uint16_t width, uint16_t height, Flags flags = Flags());
 
   // writes a bitmap to a buffer assuming 4 bit pixels in both the source and
   // destination
-  void write4BitBitmapTo4BitBuffer(uint8_t *bitmap, uint8_t *buffer, int16_t x, int16_t y, uint16_t width,
+  void write4BitBitmapTo4BitBuffer(const uint8_t *bitmap, uint8_t *buffer, int16_t x, int16_t y, uint16_t width,
                                    uint16_t height, Flags flags = Flags());
+
+  // writes a sprite to a buffer assuming 4 bit pixels, blitting whichever copy lines up with the buffer
+  void write4BitSpriteTo4BitBuffer(const Sprite &sprite, uint8_t *buffer, int16_t x, int16_t y, Flags flags = Flags());
+
+  // Write a block of color or a bitmap to a buffer of any format, packed like a bitmap of that format with rows of
+  // getWidth() pixels. Colors are pixel values of the buffer format, see Bitmap::convertColor for how the pixels of
+  // bitmaps of other formats are converted. They back up the kernels for specific formats and go pixel by pixel.
+  void writeColorToBuffer(uint16_t color, uint8_t *buffer, Bitmap::BitmapFormat bufferFormat, int16_t x, int16_t y,
+                          uint16_t width, uint16_t height);
+  void convertBitmapToBuffer(const uint8_t *bitmap, Bitmap::BitmapFormat format, uint16_t color, uint8_t *buffer,
+                             Bitmap::BitmapFormat bufferFormat, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                             Flags flags = Flags());
+
+  // `color` as a pixel value of `bufferFormat`, cut to its bits
+  static uint16_t toBufferColor(uint16_t color, Bitmap::BitmapFormat bufferFormat);
+
+  // write batches of points or spans to a buffer assuming 4 bit pixels, the damage of a batch is marked once
+  void write4BitPointsTo4BitBuffer(const Point *points, size_t count, uint16_t color, uint8_t *buffer);
+  void write4BitPointsTo4BitBuffer(const ColoredPoint *points, size_t count, uint8_t *buffer);
+  void write4BitSpansTo4BitBuffer(const Span *spans, size_t count, uint16_t color, uint8_t *buffer);
+
+private:
+  Rect clip;
+  bool clipped = false;
+
+  bool transferPending = false;
+  DamageMap transferDamage;
+
+  TransferCallback transferCallback = nullptr;
+  void *transferCallbackArg = nullptr;
 };
 
-class SERIAL_64X64_DRIVER : public Driver {
+// Driver core for panels backed by a WIDTH x HEIGHT frame buffer in memory. The geometry is known at compile time and
+// the drawing methods are final and defined here, so calling them through the concrete driver type (see StaticDisplay)
+// inlines them. Drivers only add initializing their display and sending the buffer to it.
+template <uint16_t WIDTH, uint16_t HEIGHT, Bitmap::BitmapFormat FORMAT = Bitmap::GRAYSCALE_4_BIT>
+class FrameBufferDriver : public Driver {
+  static_assert(FORMAT == Bitmap::GRAYSCALE_4_BIT, "only 4 bit frame buffers are supported");
+
 public:
-  uint16_t getWidth() { return 64; };
-  uint16_t getHeight() { return 64; };
+  static constexpr uint16_t BYTES_PER_ROW = (WIDTH * 4) / 8;
+  static constexpr size_t BUFFER_SIZE = (size_t)BYTES_PER_ROW * HEIGHT;
+
+  // Draws into `frameBuffer`, which has to hold BUFFER_SIZE bytes and stays owned by the caller. This leaves placing it
+  // to the caller, e.g. in DMA capable memory for SPI panels or in PSRAM for rendering off-screen.
+  FrameBufferDriver(PinMap pins, uint8_t *frameBuffer) : Driver{pins} { buffer = frameBuffer; };
+
+  // draws into a buffer owned by the driver, getBuffer() returns nullptr if it couldn't be allocated
+  FrameBufferDriver(PinMap pins, Memory memory) : Driver{pins} {
+    ownedBuffer = allocateMemory(BUFFER_SIZE, memory);
+    buffer = ownedBuffer;
+  };
+
+  ~FrameBufferDriver() { freeMemory(ownedBuffer); };
+
+  // the buffer belongs to a single driver
+  FrameBufferDriver(const FrameBufferDriver &) = delete;
+  FrameBufferDriver &operator=(const FrameBufferDriver &) = delete;
+
+  uint16_t getWidth() final { return WIDTH; };
+  uint16_t getHeight() final { return HEIGHT; };
+  Bitmap::BitmapFormat getBufferFormat() final { return FORMAT; };
+
+  esp_err_t clearBuffer() final {
+    memset(buffer, 0, BUFFER_SIZE);
+    markAllDamaged();
+    return ESP_OK;
+  };
+
+  void setBufferPixel(int16_t x, int16_t y, uint16_t color) final {
+    Rect bounds = getClip();
+    if (x < bounds.x || x >= bounds.x + bounds.width || y < bounds.y || y >= bounds.y + bounds.height)
+      return;
+
+    if (quarterTurn) {
+      int16_t column = WIDTH - 1 - y;
+      y = x;
+      x = column;
+    }
+
+    markDamaged(x, y, 1, 1);
+
+    uint8_t &pixels = buffer[(BYTES_PER_ROW * y) + (x / 2)];
+    if (x % 2 == 0) {
+      pixels = (color << 4) | (pixels & 0x0f);
+    } else {
+      pixels = (color & 0x0f) | (pixels & 0xf0);
+    }
+  };
+
+  void setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) final {
+    write4BitColorTo4BitBuffer(color, buffer, x, y, width, height);
+  };
+
+  void setBufferPixels(const Point *points, size_t count, uint16_t color) final {
+    write4BitPointsTo4BitBuffer(points, count, color, buffer);
+  };
+
+  void setBufferPixels(const ColoredPoint *points, size_t count) final {
+    write4BitPointsTo4BitBuffer(points, count, buffer);
+  };
+
+  void setBufferSpans(const Span *spans, size_t count, uint16_t color) final {
+    write4BitSpansTo4BitBuffer(spans, count, color, buffer);
+  };
+
+  void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, const void *bitmap,
+                           Bitmap::BitmapFormat format, uint16_t color, Flags flags = Flags()) final {
+    switch (format) {
+    case Bitmap::MONOCHROME:
+      write1BitBitmapTo4BitBuffer((const uint8_t *)bitmap, color, buffer, x, y, width, height, flags);
+      break;
+    case Bitmap::GRAYSCALE_4_BIT:
+      write4BitBitmapTo4BitBuffer((const uint8_t *)bitmap, buffer, x, y, width, height, flags);
+      break;
+    default:
+      convertBitmapToBuffer((const uint8_t *)bitmap, format, color, buffer, FORMAT, x, y, width, height, flags);
+      break;
+    }
+  };
+
+  void writeSpriteToBuffer(int16_t x, int16_t y, const Sprite &sprite, Flags flags = Flags()) final {
+    write4BitSpriteTo4BitBuffer(sprite, buffer, x, y, flags);
+  };
 
-  SERIAL_64X64_DRIVER() : Driver{PinMap()} {};
-  SERIAL_64X64_DRIVER(PinMap pins) : Driver{pins} {};
+protected:
+  Rect getSurface() final { return {0, 0, WIDTH, HEIGHT}; };
 
-  esp_err_t sendCommands(uint8_t *commands, uint8_t bytes);
+private:
+  // kept apart from `buffer` since double buffering swaps that
+  uint8_t *ownedBuffer = nullptr;
+};
 
-  esp_err_t initializeDisplay();
-  esp_err_t clearBuffer();
-  esp_err_t sendBufferToDisplay();
+// Draws 4 bit buffers on a terminal with shaded block characters inside of a border. It remembers the last frame it
+// drew so that following frames only rewrite the cells that changed. Every frame is assembled in a preallocated output
+// buffer and written with a single call.
+class SerialTerminal {
+public:
+  // bytes needed for the output buffer, enough for clearing the screen and printing a whole frame
+  static constexpr size_t outputSize(uint16_t width, uint16_t height) {
+    return 8 + ((height + 2) * (((width + 2) * 3) + 1)) + 2; // +2 since glyphs are always copied as 3 bytes
+  };
+
+  // allocates a copy of the last drawn frame and the output buffer, drawing returns ESP_ERR_NO_MEM if that failed
+  SerialTerminal(uint16_t width, uint16_t height);
+  ~SerialTerminal();
+
+  SerialTerminal(const SerialTerminal &) = delete;
+  SerialTerminal &operator=(const SerialTerminal &) = delete;
+
+  // prints the whole frame at the cursor
+  esp_err_t printFrame(uint8_t *buffer, Rotation rotation);
+
+  // Brings the terminal up to date with the buffer. The first frame after construction or invalidate() clears the
+  // screen and prints everything, later frames move the cursor to each run of changed cells and rewrite just those.
+  esp_err_t drawFrame(uint8_t *buffer, Rotation rotation);
+
+  // makes the next drawFrame a full redraw, e.g. after the rotation changed
+  void invalidate() { valid = false; };
+
+  // Whether drawFrame rewrites only the changed cells or every frame in full, CONFIG_DISPLAY_SERIAL_DELTA_UPDATES sets
+  // the default.
+  void setDeltaUpdates(bool enabled) {
+    if (enabled != deltaUpdates)
+      invalidate();
+    deltaUpdates = enabled;
+  };
+
+  // Packs two buffer rows into every terminal row with half block characters, which halves the height and size of
+  // the output. The shade of each cell is picked from both of its pixels.
+  void setHalfBlocks(bool enabled) {
+    if (enabled != halfBlocks)
+      invalidate();
+    halfBlocks = enabled;
+  };
 
-  esp_err_t setRotation(Rotation rotation);
+private:
+  uint16_t width;
+  uint16_t height;
+  uint8_t *lastFrame;
+  char *output;
+  bool valid = false;
+  bool halfBlocks = false;
+#ifdef CONFIG_DISPLAY_SERIAL_DELTA_UPDATES
+  bool deltaUpdates = true;
+#else
+  bool deltaUpdates = false;
+#endif
 
-  void printBuffer();
+  uint16_t cellRows() { return halfBlocks ? (height + 1) / 2 : height; };
 
-  void setBufferPixel(int16_t x, int16_t y, uint16_t color);
-  void setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color);
+  // buffer row shown at a row of the screen, nullptr past the last row
+  uint8_t *bufferRow(uint8_t *buffer, uint16_t row, Rotation rotation);
 
-  void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, void *bitmap,
-                           Bitmap::BitmapFormat format, uint16_t color, Flags flags = Flags());
+  // index of the glyph shown in a cell, `lowerRow` is only used with half blocks
+  uint8_t cellGlyph(uint8_t *upperRow, uint8_t *lowerRow, uint16_t column, Rotation rotation);
 
-private:
-  Rotation rotation = Rotation::DEFAULT;
+  void writeBorder(char *&cursor, bool top);
+  void writeFrame(char *&cursor, uint8_t *buffer, Rotation rotation);
+
+  // writes the runs of cells that changed since the last frame, returns false if they don't fit in the output buffer
+  bool writeChanges(char *&cursor, uint8_t *buffer, Rotation rotation);
+
+  // writes the output buffer up to `end` to stdout
+  void flush(char *end);
 };
 
-class SERIAL_128X128_DRIVER : public Driver {
+// Draws a WIDTH x HEIGHT frame buffer on the terminal, see SerialTerminal. Used to simulate displays, e.g. on the linux
+// target.
+template <uint16_t WIDTH, uint16_t HEIGHT> class SerialDriver : public FrameBufferDriver<WIDTH, HEIGHT> {
 public:
-  uint16_t getWidth() { return 128; };
-  uint16_t getHeight() { return 128; };
+  SerialDriver(PinMap pins = PinMap(), Memory memory = Memory::DEFAULT)
+      : FrameBufferDriver<WIDTH, HEIGHT>{pins, memory}, terminal{WIDTH, HEIGHT} {};
 
-  SERIAL_128X128_DRIVER() : Driver{PinMap()} {};
-  SERIAL_128X128_DRIVER(PinMap pins) : Driver{pins} {};
+  SerialDriver(PinMap pins, uint8_t *frameBuffer)
+      : FrameBufferDriver<WIDTH, HEIGHT>{pins, frameBuffer}, terminal{WIDTH, HEIGHT} {};
 
-  esp_err_t sendCommands(uint8_t *commands, uint8_t bytes);
+  esp_err_t sendCommands(uint8_t *commands, uint8_t bytes) { return ESP_OK; };
 
-  esp_err_t initializeDisplay();
-  esp_err_t clearBuffer();
-  esp_err_t sendBufferToDisplay();
+  esp_err_t initializeDisplay() {
+    if (this->buffer == nullptr)
+      return ESP_ERR_NO_MEM;
 
-  esp_err_t setRotation(Rotation rotation);
+    return this->clearBuffer();
+  };
 
-  void printBuffer();
+  esp_err_t sendBufferToDisplay() {
+    esp_err_t err = terminal.drawFrame(this->buffer, rotation);
+    if (err != ESP_OK)
+      return err;
+
+    if (this->backBuffer != nullptr)
+      this->copyDamage(this->buffer, this->backBuffer, this->damage);
+
+    this->damage.clear();
+    return ESP_OK;
+  };
+
+  // quarter turns are drawn into the buffer, the terminal only mirrors it for the half turn
+  esp_err_t setRotation(Rotation rotation) {
+    esp_err_t err = this->setQuarterTurn(rotation == Rotation::CLOCKWISE_90 || rotation == Rotation::CLOCKWISE_270);
+    if (err != ESP_OK)
+      return err;
+
+    if (rotation != this->rotation)
+      terminal.invalidate(); // cells move around so the delta to the last frame is meaningless
 
-  void setBufferPixel(int16_t x, int16_t y, uint16_t color);
-  void setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color);
+    this->rotation = rotation;
+    return ESP_OK;
+  };
 
-  void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, void *bitmap,
-                           Bitmap::BitmapFormat format, uint16_t color, Flags flags = Flags());
+  void printBuffer() { terminal.printFrame(this->buffer, rotation); };
+
+  // see SerialTerminal::setHalfBlocks
+  void setHalfBlockOutput(bool enabled) { terminal.setHalfBlocks(enabled); };
+
+  // see SerialTerminal::setDeltaUpdates
+  void setDeltaOutput(bool enabled) { terminal.setDeltaUpdates(enabled); };
+
+protected:
+  // the terminal is written synchronously so the frame has been sent once this returns
+  esp_err_t queueBufferTransfer(uint8_t *frame, const DamageMap &frameDamage) {
+    esp_err_t err = terminal.drawFrame(frame, rotation);
+    if (err != ESP_OK)
+      return err;
+
+    this->notifyTransferComplete();
+    return ESP_OK;
+  };
+
+  // the terminal draws whole frames, so rows are collected in the buffer and drawn once the last one arrived
+  esp_err_t queueRowsTransfer(uint8_t *rows, int16_t y, uint16_t height) {
+    if (this->buffer == nullptr)
+      return ESP_ERR_NOT_SUPPORTED;
+
+    memcpy(this->buffer + (y * this->BYTES_PER_ROW), rows, height * this->BYTES_PER_ROW);
+    if (y + height < HEIGHT)
+      return ESP_OK;
+
+    return queueBufferTransfer(this->buffer, this->damage);
+  };
 
 private:
   Rotation rotation = Rotation::DEFAULT;
+  SerialTerminal terminal;
 };
 
+using SERIAL_64X64_DRIVER = SerialDriver<64, 64>;
+using SERIAL_128X128_DRIVER = SerialDriver<128, 128>;
+
 #ifndef CONFIG_IDF_TARGET_LINUX
 
-class SSD1327_128X128_SPI_DRIVER : public Driver {
+class SSD1327_128X128_SPI_DRIVER : public FrameBufferDriver<128, 128> {
 public:
-  uint16_t getWidth() { return 128; };
-  uint16_t getHeight() { return 128; };
-
-  SSD1327_128X128_SPI_DRIVER(){};
-  SSD1327_128X128_SPI_DRIVER(PinMap pins) : Driver{pins} {};
+  // The buffer is sent by DMA, a caller supplied `frameBuffer` has to be DMA capable as well. With Memory::NONE the
+  // driver has no buffer to draw to and frames are sent in bands, see BandRenderer.
+  SSD1327_128X128_SPI_DRIVER(PinMap pins = PinMap(), Memory memory = Memory::DMA);
+  SSD1327_128X128_SPI_DRIVER(PinMap pins, uint8_t *frameBuffer);
+  ~SSD1327_128X128_SPI_DRIVER();
 
   esp_err_t sendCommands(uint8_t *commands, uint8_t bytes);
 
   esp_err_t initializeDisplay();
-  esp_err_t clearBuffer();
   esp_err_t sendBufferToDisplay();
 
   esp_err_t setRotation(Rotation rotation);
 
   void printBuffer();
 
-  void setBufferPixel(int16_t x, int16_t y, uint16_t color);
-  void setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color);
+protected:
+  esp_err_t queueBufferTransfer(uint8_t *frame, const DamageMap &frameDamage);
+  esp_err_t waitForBufferTransfer(TickType_t timeout);
 
-  void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, void *bitmap,
-                           Bitmap::BitmapFormat format, uint16_t color, Flags flags = Flags());
+private:
+  spi_device_handle_t device = nullptr;
+  spi_transaction_t transaction;
+
+  // set without a frame buffer, when frames are only sent in bands
+  bool bandsOnly;
+
+  // sets the panel's address window to the damaged rectangle and sends just the bytes of `frame` inside of it
+  esp_err_t sendBufferWindow(uint8_t *frame, Rect window);
+
+  // D/C level and completion handling for queued transactions, referenced through spi_transaction_t::user
+  struct TransferPhase {
+    SSD1327_128X128_SPI_DRIVER *driver;
+    uint8_t dc;
+    bool lastOfFrame;
+  };
+
+  TransferPhase commandPhase = {this, 0, false};
+  TransferPhase dataPhase = {this, 1, false};
+  TransferPhase lastDataPhase = {this, 1, true};
+
+  // transactions and window commands for a queued frame, one set per buffer so the structs of a frame in flight are
+  // never reused for the next one
+  struct FrameTransfer {
+    spi_transaction_t transactions[2 * DamageMap::MAX_RECTS];
+    uint8_t windowCommands[DamageMap::MAX_RECTS][6];
+  };
+
+  FrameTransfer frameTransfers[2];
+  uint8_t nextFrameTransfer = 0;
+  uint8_t queuedTransactions = 0;
+
+  static void preTransfer(spi_transaction_t *transaction);
+  static void postTransfer(spi_transaction_t *transaction);
 };
 
 #endif
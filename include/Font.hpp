@@ -4,43 +4,54 @@
 
 #pragma once
 
+#include "esp_types.h"
+
 #include "Fonts.hpp"
 
 namespace Display::Font {
 
-class Character {
-public:
-  CHARACTER_CODE_TYPE code = 0;
-  CHARACTER_BYTES_TYPE bytes = 0;
-  CHARACTER_DEVICE_WIDTH_X_TYPE deviceWidthX = 0;
-  CHARACTER_DEVICE_WIDTH_Y_TYPE deviceWidthY = 0;
-  CHARACTER_BBX_WIDTH_TYPE bbxWidth = 0;
-  CHARACTER_BBX_HEIGHT_TYPE bbxHeight = 0;
-  CHARACTER_BBX_X_OFFSET_TYPE bbxXOffset = 0;
-  CHARACTER_BBX_Y_OFFSET_TYPE bbxYOffset = 0;
-
-  uint8_t *bitmap = nullptr;
-
-  Character(uint8_t *character);
-  Character(){};
+// Metrics of a character. They are kept apart from the bitmaps so measuring text only reads these few bytes per
+// character.
+struct Character {
+  uint16_t code;
+  uint16_t bitmap; // where the bitmap of the character starts in the bitmaps of its font
+  uint8_t deviceWidthX;
+  uint8_t deviceWidthY;
+  uint8_t bbxWidth;
+  uint8_t bbxHeight;
+  int8_t bbxXOffset;
+  int8_t bbxYOffset;
 };
 
-class Font {
-public:
-  FONT_SIZE_TYPE size;
-  FONT_CHARACTERS_TYPE numCharacters;
-  FONT_BOUNDING_BOX_WIDTH_TYPE boundingBoxWidth;
-  FONT_BOUNDING_BOX_HEIGHT_TYPE boundingBoxHeight;
-  FONT_BOUNDING_BOX_X_OFFSET_TYPE boundingBoxXOffset;
-  FONT_BOUNDING_BOX_Y_OFFSET_TYPE boundingBoxYOffset;
-  FONT_ASCENT_TYPE ascent;
-  FONT_DESCENT_TYPE descent;
+// A font generated by tools/generate_fonts.py. The generated fonts are constexpr tables, so they stay in flash.
+struct Font {
+  // printable ASCII characters, which are looked up without a search
+  static constexpr uint16_t ASCII_FIRST_CODE = 0x20;
+  static constexpr uint16_t ASCII_LAST_CODE = 0x7E;
+
+  uint8_t size;
+  uint16_t numCharacters; // not counting the missing character replacement
+  uint8_t boundingBoxWidth;
+  uint8_t boundingBoxHeight;
+  int8_t boundingBoxXOffset;
+  int8_t boundingBoxYOffset;
+  uint8_t ascent;
+  uint8_t descent;
+
+  // index of each printable ASCII character in `characters`, 0 for the ones the font doesn't have
+  uint16_t asciiIndex[ASCII_LAST_CODE - ASCII_FIRST_CODE + 1];
+
+  // the missing character replacement glyph, then every character sorted by code
+  const Character *characters;
 
-  uint8_t *firstCharacter;
+  // bitmaps of all characters, 1 bit per pixel packed like a MONOCHROME bitmap
+  const uint8_t *bitmaps;
 
-  Font(uint8_t *font);
+  // Looks a character up, directly for printable ASCII and with a binary search for everything else. Returns the
+  // missing character replacement if the font doesn't have it.
+  const Character &getCharacter(uint16_t code) const;
 
-  Character getCharacter(uint16_t character);
+  const uint8_t *getBitmap(const Character &character) const { return bitmaps + character.bitmap; };
 };
 
 } // namespace Display::Font
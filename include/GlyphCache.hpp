@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "Font.hpp"
+#include "Sprite.hpp"
+
+namespace Display {
+
+// Keeps glyphs expanded to 4 bit sprites in a color, so text that is drawn again, e.g. a score or a menu redrawn every
+// frame, is blitted a byte at a time instead of expanding every glyph from its 1 bit bitmap. Glyphs that weren't used
+// for the longest are dropped once the budget is used up.
+//
+//   GlyphCache glyphs(4096);
+//   display.setGlyphCache(&glyphs);
+//
+// The sprites are 4 bit grays, so the cache is meant for displays of 4 bit drivers. It must not be set while drawing
+// into a DisplayList, which would keep pointers to glyphs the cache may drop.
+class GlyphCache {
+public:
+  // Holds up to `maxGlyphs` glyphs whose sprites take up to `budget` bytes, see Sprite::getSize. The bookkeeping is
+  // allocated in `memory` right away and the sprites as glyphs are added.
+  GlyphCache(size_t budget, uint16_t maxGlyphs = 64, Driver::Memory memory = Driver::Memory::DEFAULT);
+  ~GlyphCache();
+
+  // the sprites belong to a single cache
+  GlyphCache(const GlyphCache &) = delete;
+  GlyphCache &operator=(const GlyphCache &) = delete;
+
+  // The sprite of `character` of `font` in `color`, which is expanded and added if it isn't cached yet. Returns nullptr
+  // if it can't be cached, i.e. it is larger than the budget or there isn't enough memory.
+  const Sprite *get(const Font::Font &font, const Font::Character &character, uint16_t color);
+
+  // drops every glyph
+  void clear();
+
+  size_t getBudget() const { return budget; };
+  size_t getUsedBytes() const { return usedBytes; };
+  uint16_t getGlyphCount() const { return glyphCount; };
+
+  // lookups that found their glyph and ones that didn't since the cache was created or the counters were reset
+  uint32_t getHits() const { return hits; };
+  uint32_t getMisses() const { return misses; };
+  void resetCounters() {
+    hits = 0;
+    misses = 0;
+  };
+
+private:
+  static constexpr uint16_t NONE = 0xffff;
+
+  // a cached glyph, the character identifies the font and code since each font has its own characters
+  struct Entry {
+    const Font::Character *character;
+    Sprite *sprite; // nullptr while the entry is free
+    uint32_t lastUse;
+    uint16_t next; // next entry in the same bucket
+    uint8_t color;
+  };
+
+  size_t budget;
+  size_t usedBytes = 0;
+  uint16_t maxGlyphs;
+  uint16_t glyphCount = 0;
+  Driver::Memory memory;
+
+  // first entry of each bucket, a power of two of them
+  uint16_t *buckets = nullptr;
+  uint16_t bucketMask = 0;
+  Entry *entries = nullptr;
+
+  uint32_t clock = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+
+  uint16_t &bucket(const Font::Character *character, uint8_t color);
+
+  // drops the glyph that wasn't used for the longest, returning its entry
+  uint16_t evict();
+};
+
+} // namespace Display
@@ -0,0 +1,351 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstdlib>
+#include <utility>
+
+#include "esp_types.h"
+
+#include "Display.hpp"
+
+// Rasterizers shared by Display and StaticDisplay. They are templated on the driver they draw to so that with a
+// concrete driver type the per pixel writes inline into the buffer instead of going through the virtual Driver
+// interface, `Target` only has to provide getClip, setBufferPixels and setBufferBlock. Primitives entirely outside of
+// the clip rectangle are rejected before they are rasterized.
+namespace Display::Raster {
+
+// Collects the points of a primitive and hands them to the target in batches, so the clipping, call and damage
+// tracking overhead is paid once per batch instead of once per pixel.
+template <typename Target> class PointBatch {
+public:
+  PointBatch(Target &target, uint16_t color) : target(target), color(color){};
+  ~PointBatch() { flush(); };
+
+  void add(int16_t x, int16_t y) {
+    if (count == SIZE)
+      flush();
+
+    points[count++] = {x, y};
+  };
+
+  void flush() {
+    if (count > 0)
+      target.setBufferPixels(points, count, color);
+
+    count = 0;
+  };
+
+private:
+  static constexpr size_t SIZE = 64;
+
+  Target &target;
+  uint16_t color;
+  Point points[SIZE];
+  size_t count = 0;
+};
+
+// Steps the Bresenham loop in drawLine has taken along the minor axis after `k` steps along the major axis, which
+// lets a clipped line start part way along without walking there. `major` and `minor` are the absolute deltas of the
+// line along each axis.
+inline int32_t minorSteps(int32_t major, int32_t minor, bool xMajor, int32_t k) {
+  // the loop checks for an x step before a y step, which puts lines along x one step ahead
+  int64_t numerator = (2 * (int64_t)minor * (k + (xMajor ? 1 : 0))) - major;
+  if (numerator < 0)
+    return 0;
+
+  int64_t steps = (numerator / (2 * (int64_t)major)) + 1;
+  return steps < k ? steps : k;
+}
+
+// First and last step along the major axis for which `minorSteps` stays within [minStep, maxStep], `last` is smaller
+// than `first` if there are none. Only steps in [first, last] are considered.
+inline void clipMinorSteps(int32_t major, int32_t minor, bool xMajor, int32_t minStep, int32_t maxStep, int32_t &first,
+                           int32_t &last) {
+  // minorSteps never decreases along the line so both ends can be found with a binary search
+  int32_t low = first, high = last + 1;
+  while (low < high) {
+    int32_t middle = low + ((high - low) / 2);
+    if (minorSteps(major, minor, xMajor, middle) >= minStep) {
+      high = middle;
+    } else {
+      low = middle + 1;
+    }
+  }
+  int32_t firstInside = low;
+
+  low = firstInside, high = last + 1;
+  while (low < high) {
+    int32_t middle = low + ((high - low) / 2);
+    if (minorSteps(major, minor, xMajor, middle) > maxStep) {
+      high = middle;
+    } else {
+      low = middle + 1;
+    }
+  }
+
+  first = firstInside;
+  last = low - 1;
+}
+
+// range of steps from `start` in direction `step` that land within [low, high]
+inline void clipSteps(int32_t start, int32_t step, int32_t low, int32_t high, int32_t &first, int32_t &last) {
+  first = step > 0 ? low - start : start - high;
+  last = step > 0 ? high - start : start - low;
+}
+
+template <typename Target>
+void drawLine(Target &target, int16_t xStart, int16_t yStart, int16_t xEnd, int16_t yEnd, uint16_t color) {
+  if (yStart == yEnd) {  // horizontal line
+    if (xEnd < xStart) { // setBufferBlock draws left-to-right so make sure xEnd
+                         // is >= xStart
+      std::swap(xEnd, xStart);
+      std::swap(yEnd, yStart);
+    }
+    target.setBufferBlock(xStart, yStart, xEnd - xStart + 1, 1, color);
+    return;
+  }
+
+  if (xStart == xEnd) {  // vertical line
+    if (yEnd < yStart) { // setBufferBlock draws top-to-bottom so make sure yEnd
+                         // is >= yStart
+      std::swap(xEnd, xStart);
+      std::swap(yEnd, yStart);
+    }
+    target.setBufferBlock(xStart, yStart, 1, yEnd - yStart + 1, color);
+    return;
+  }
+
+  // for sloped lines use Bresenham's Algorithm with integer arithmetic
+  // <https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm>
+  int32_t dX = abs(xEnd - xStart), xStep = xStart < xEnd ? 1 : -1;
+  int32_t dY = -1 * abs(yEnd - yStart), yStep = yStart < yEnd ? 1 : -1;
+
+  // The loop steps along the major axis for every pixel and along the minor axis for some. Clip the line by finding
+  // the range of major steps whose pixels are inside the clip rectangle on both axes, then start the loop at the first
+  // of them.
+  Rect clip = target.getClip();
+  if (clip.isEmpty())
+    return;
+
+  bool xMajor = dX >= -dY;
+  int32_t major = xMajor ? dX : -dY, minor = xMajor ? -dY : dX;
+  int32_t left = clip.x, right = clip.x + clip.width - 1, top = clip.y, bottom = clip.y + clip.height - 1;
+
+  int32_t first, last, minStep, maxStep;
+  if (xMajor) {
+    clipSteps(xStart, xStep, left, right, first, last);
+    clipSteps(yStart, yStep, top, bottom, minStep, maxStep);
+  } else {
+    clipSteps(yStart, yStep, top, bottom, first, last);
+    clipSteps(xStart, xStep, left, right, minStep, maxStep);
+  }
+
+  first = first > 0 ? first : 0;
+  last = last < major ? last : major;
+  if (first > last)
+    return; // the line misses the clip rectangle
+
+  // the line ends early if a step along the minor axis would take it past the end
+  maxStep = maxStep < minor ? maxStep : minor;
+
+  clipMinorSteps(major, minor, xMajor, minStep, maxStep, first, last);
+  if (first > last)
+    return;
+
+  int32_t xSteps = xMajor ? first : minorSteps(major, minor, xMajor, first);
+  int32_t ySteps = xMajor ? minorSteps(major, minor, xMajor, first) : first;
+
+  int16_t xHead = xStart + (xStep * xSteps), yHead = yStart + (yStep * ySteps);
+  int32_t error = (dX * (1 + ySteps)) + (dY * (1 + xSteps));
+
+  PointBatch<Target> batch(target, color);
+  for (int32_t step = first; step <= last; step++) {
+    batch.add(xHead, yHead);
+
+    if (2 * error >= dY) {
+      error += dY;
+      xHead += xStep;
+    }
+
+    if (2 * error <= dX) {
+      error += dX;
+      yHead += yStep;
+    }
+  }
+}
+
+template <typename Target>
+void drawCircleWithEvenDiameterFromTopLeftCorner(Target &target, int16_t x, int16_t y, uint16_t diameter,
+                                                 uint16_t color) {
+  if (Rect{x, y, diameter, diameter}.intersect(target.getClip()).isEmpty())
+    return; // the whole circle is clipped
+
+  int16_t radius = diameter / 2;
+  int16_t xOffset = 0, yOffset = -radius + 1;
+
+  int16_t xTopLeftCenter = x + radius - 1, yTopLeftCenter = y + radius - 1;
+  int16_t xTopRightCenter = x + radius - 0, yTopRightCenter = y + radius - 1;
+  int16_t xBottomLeftCenter = x + radius - 1, yBottomLeftCenter = y + radius - 0;
+  int16_t xBottomRightCenter = x + radius - 0, yBottomRightCenter = y + radius - 0;
+
+  int16_t discriminatorThreshold;
+  if (radius <= 3) {
+    discriminatorThreshold = 0;
+  } else if (radius <= 6) {
+    discriminatorThreshold = 3;
+  } else {
+    discriminatorThreshold = 5;
+  }
+
+  PointBatch<Target> batch(target, color);
+  while (xOffset <= (-1 * yOffset)) {
+    // leverage 8-way symmetry
+
+    // top left quadrant
+    batch.add(xTopLeftCenter - xOffset, yTopLeftCenter + yOffset);
+    batch.add(xTopLeftCenter + yOffset, yTopLeftCenter - xOffset);
+
+    // top right quadrant
+    batch.add(xTopRightCenter + xOffset, yTopRightCenter + yOffset);
+    batch.add(xTopRightCenter - yOffset, yTopRightCenter - xOffset);
+
+    // bottom left quadrant
+    batch.add(xBottomLeftCenter - xOffset, yBottomLeftCenter - yOffset);
+    batch.add(xBottomLeftCenter + yOffset, yBottomLeftCenter + xOffset);
+
+    // bottom right quadrant
+    batch.add(xBottomRightCenter + xOffset, yBottomRightCenter - yOffset);
+    batch.add(xBottomRightCenter - yOffset, yBottomRightCenter + xOffset);
+
+    xOffset++;
+
+    int16_t discriminator = (xOffset * xOffset) + (yOffset * yOffset) - ((radius - 1) * (radius - 1));
+    if (discriminator > discriminatorThreshold) {
+      yOffset++;
+    }
+  }
+}
+
+template <typename Target>
+void drawCircleWithOddDiameterFromCenter(Target &target, int16_t x, int16_t y, uint16_t diameter, uint16_t color) {
+  int16_t radius = diameter / 2;
+  if (Rect{(int16_t)(x - radius), (int16_t)(y - radius), diameter, diameter}.intersect(target.getClip()).isEmpty())
+    return; // the whole circle is clipped
+
+  int16_t xOffset = 0, yOffset = -radius;
+
+  int16_t discriminatorThreshold;
+  switch (radius) {
+  case 1:
+    discriminatorThreshold = 0;
+    break;
+  case 2:
+    discriminatorThreshold = 1;
+    break;
+  case 3:
+    discriminatorThreshold = 3;
+    break;
+  default:
+    discriminatorThreshold = 5;
+  }
+
+  PointBatch<Target> batch(target, color);
+  while (xOffset <= (-1 * yOffset)) {
+
+    // leverage 8-way symmetry
+    batch.add(x + xOffset, y + yOffset);
+    batch.add(x + xOffset, y - yOffset);
+    batch.add(x - xOffset, y + yOffset);
+    batch.add(x - xOffset, y - yOffset);
+    batch.add(x + yOffset, y + xOffset);
+    batch.add(x + yOffset, y - xOffset);
+    batch.add(x - yOffset, y + xOffset);
+    batch.add(x - yOffset, y - xOffset);
+
+    xOffset++;
+
+    int16_t discriminator = (xOffset * xOffset) + (yOffset * yOffset) - (radius * radius);
+    if (discriminator > discriminatorThreshold) {
+      yOffset++;
+    }
+  }
+}
+
+template <typename Target>
+void drawCircle(Target &target, Origin::Object2D origin, int16_t x, int16_t y, uint16_t diameter, uint16_t color) {
+  if (diameter % 2 == 0) { // even diameter
+    switch (origin) {
+    case Origin::Object2D::TOP_LEFT:
+      drawCircleWithEvenDiameterFromTopLeftCorner(target, x, y, diameter, color);
+      break;
+    case Origin::Object2D::TOP_RIGHT:
+      drawCircleWithEvenDiameterFromTopLeftCorner(target, x - diameter, y, diameter, color);
+      break;
+    case Origin::Object2D::BOTTOM_LEFT:
+      drawCircleWithEvenDiameterFromTopLeftCorner(target, x, y - diameter, diameter, color);
+      break;
+    case Origin::Object2D::BOTTOM_RIGHT:
+      drawCircleWithEvenDiameterFromTopLeftCorner(target, x - diameter, y - diameter, diameter, color);
+      break;
+    case Origin::Object2D::CENTER:
+      // Since there is no pixel center of an even diameter circle we bias to
+      // the bottom right. E.g. below there are 4 possible "center" pixels for
+      // the `diameter = 8` circle represented by the "X" and 3 "O"'s. Since the
+      // origin of the screen is the top left corner we choose the pixel who's
+      // top left corner is the center of the circle: the "X". This means that
+      // the left bound of the circle will be `x - (diameter / 2)` and the upper
+      // bound of the circle will be `y - (diameter / 2)`. However, because the
+      // center is biased to the bottom right the right bound will be `x +
+      // (diameter / 2) - 1` and the bottom bound will be `y + (diameter / 2) -
+      // 1`.
+      //
+      // ############
+      // ####    ####
+      // ### #### ###
+      // ## ###### ##
+      // ## ##OO## ##
+      // ## ##OX## ##
+      // ## ###### ##
+      // ### #### ###
+      // ####    ####
+      // ############
+      drawCircleWithEvenDiameterFromTopLeftCorner(target, x - (diameter / 2), y - (diameter / 2), diameter, color);
+      break;
+    }
+  } else { // odd diameter
+    switch (origin) {
+    case Origin::Object2D::TOP_LEFT:
+      drawCircleWithOddDiameterFromCenter(target, x + (diameter / 2), y + (diameter / 2), diameter, color);
+      break;
+    case Origin::Object2D::TOP_RIGHT:
+      drawCircleWithOddDiameterFromCenter(target, x - (diameter / 2), y + (diameter / 2), diameter, color);
+      break;
+    case Origin::Object2D::BOTTOM_LEFT:
+      drawCircleWithOddDiameterFromCenter(target, x + (diameter / 2), y - (diameter / 2), diameter, color);
+      break;
+    case Origin::Object2D::BOTTOM_RIGHT:
+      drawCircleWithOddDiameterFromCenter(target, x - (diameter / 2), y - (diameter / 2), diameter, color);
+      break;
+    case Origin::Object2D::CENTER:
+      drawCircleWithOddDiameterFromCenter(target, x, y, diameter, color);
+      break;
+    }
+  }
+}
+
+// expects the top left corner of the rectangle
+template <typename Target>
+void drawRectangle(Target &target, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) {
+  if (Rect{x, y, width, height}.intersect(target.getClip()).isEmpty())
+    return; // the whole rectangle is clipped
+
+  target.setBufferBlock(x, y, width, 1, color);              // top line
+  target.setBufferBlock(x, y + height - 1, width, 1, color); // bottom line
+  target.setBufferBlock(x, y, 1, height, color);             // left line
+  target.setBufferBlock(x + width - 1, y, 1, height, color); // right line
+}
+
+} // namespace Display::Raster
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "Driver.hpp"
+
+namespace Display {
+
+// A 4 bit bitmap prepared for drawing at any x. It is stored twice with every row padded to whole bytes, once starting
+// on the high and once on the low nibble of the first byte. Drawing picks the copy that lines up with the buffer, so
+// rows are blitted a byte or more at a time wherever the sprite is, where a bitmap at every other x has to shift each
+// of its bytes into place. The copies take a little over twice the memory of the bitmap.
+class Sprite {
+public:
+  // copies `bitmap`, packed like a GRAYSCALE_4_BIT bitmap, getRows() returns nullptr if there isn't enough memory
+  Sprite(const uint8_t *bitmap, uint16_t width, uint16_t height, Driver::Memory memory = Driver::Memory::DEFAULT);
+
+  // Copies a bitmap of `format`, which is GRAYSCALE_4_BIT or MONOCHROME. Set pixels of a MONOCHROME bitmap become
+  // `color` and the others 0, so e.g. a glyph drawn transparent looks like the bitmap drawn in `color`.
+  Sprite(const uint8_t *bitmap, Bitmap::BitmapFormat format, uint16_t color, uint16_t width, uint16_t height,
+         Driver::Memory memory = Driver::Memory::DEFAULT);
+  ~Sprite();
+
+  // the copies belong to a single sprite
+  Sprite(const Sprite &) = delete;
+  Sprite &operator=(const Sprite &) = delete;
+
+  uint16_t getWidth() const { return width; };
+  uint16_t getHeight() const { return height; };
+
+  // bytes of each row of both copies, including the padding
+  uint16_t getBytesPerRow() const { return (width / 2) + 1; };
+
+  // bytes of both copies
+  size_t getSize() const { return 2 * (size_t)getBytesPerRow() * height; };
+
+  // first row of the copy whose first pixel is the low nibble of its first byte if `shifted`, the high one otherwise
+  const uint8_t *getRows(bool shifted) const {
+    return copies == nullptr ? nullptr : copies + (shifted ? (size_t)getBytesPerRow() * height : 0);
+  };
+
+private:
+  uint16_t width;
+  uint16_t height;
+  uint8_t *copies = nullptr;
+};
+
+} // namespace Display
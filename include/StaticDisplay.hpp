@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "Display.hpp"
+#include "Raster.hpp"
+
+namespace Display {
+
+// A Display bound to a concrete driver type. Pixel heavy primitives call the driver through its own type, so with a
+// FrameBufferDriver the pixel writes inline into the rasterizers instead of costing a virtual call per pixel. Anything
+// else, e.g. text, is drawn through the virtual Driver interface like with Display.
+//
+//   Driver::SERIAL_64X64_DRIVER driver;
+//   StaticDisplay<Driver::SERIAL_64X64_DRIVER> display(&driver);
+template <typename DriverType> class StaticDisplay : public Display {
+public:
+  StaticDisplay(){};
+  StaticDisplay(DriverType *driver) : Display(driver){};
+
+  DriverType *getDriver() { return static_cast<DriverType *>(driver); };
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) { getDriver()->setBufferPixel(x, y, color); };
+
+  void drawPixels(const Point *points, size_t count, uint16_t color) {
+    getDriver()->setBufferPixels(points, count, color);
+  };
+
+  void drawPixels(const ColoredPoint *points, size_t count) { getDriver()->setBufferPixels(points, count); };
+
+  void drawSpans(const Span *spans, size_t count, uint16_t color) { getDriver()->setBufferSpans(spans, count, color); };
+
+  void drawLine(int16_t xStart, int16_t yStart, int16_t xEnd, int16_t yEnd, uint16_t color) {
+    Raster::drawLine(*getDriver(), xStart, yStart, xEnd, yEnd, color);
+  };
+
+  void drawLine(Origin::Object1D origin, int16_t x, int16_t y, double length, double angle, uint16_t color) {
+    int16_t xStart = 0, yStart = 0, xEnd = 0, yEnd = 0;
+    getLineEndpoints(origin, x, y, length, angle, xStart, yStart, xEnd, yEnd);
+    drawLine(xStart, yStart, xEnd, yEnd, color);
+  };
+
+  void drawCircle(Origin::Object2D origin, int16_t x, int16_t y, uint16_t diameter, uint16_t color) {
+    Raster::drawCircle(*getDriver(), origin, x, y, diameter, color);
+  };
+
+  void drawRectangle(Origin::Object2D origin, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) {
+    shiftOrigin2DToTopLeft(origin, x, y, width, height);
+    Raster::drawRectangle(*getDriver(), x, y, width, height, color);
+  };
+
+  void fillRectangle(Origin::Object2D origin, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) {
+    shiftOrigin2DToTopLeft(origin, x, y, width, height);
+    getDriver()->setBufferBlock(x, y, width, height, color);
+  };
+};
+
+} // namespace Display
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "esp_types.h"
+
+#include "Driver.hpp"
+#include "Font.hpp"
+
+namespace Display {
+
+class Display;
+
+// Text laid out once, i.e. decoded and looked up in its font, so it can be measured and drawn at any origin on every
+// frame without decoding it again. Meant for labels that don't change, drawText lays its text out on every call.
+//
+//   TextRun label(16);
+//   display.layoutText(Font::bailleul_8_pt, (char *)"Score", label);
+//   display.drawTextRun(Origin::Text::TOP_LEFT, 2, 2, label, 0xf);
+class TextRun {
+public:
+  // a glyph and where its pen position is, relative to the start of the baseline
+  struct Glyph {
+    const Font::Character *character;
+    uint16_t x;
+  };
+
+  // Holds up to `maxGlyphs` characters, allocated in `memory` right away. The run is empty until text is laid out into
+  // it with Display::layoutText.
+  TextRun(uint16_t maxGlyphs, Driver::Memory memory = Driver::Memory::DEFAULT);
+  ~TextRun();
+
+  // the glyphs point into the font, copies would only duplicate the buffer
+  TextRun(const TextRun &) = delete;
+  TextRun &operator=(const TextRun &) = delete;
+
+  // nullptr while nothing is laid out
+  const Font::Font *getFont() const { return font; };
+
+  uint16_t getMaxGlyphs() const { return glyphs != nullptr ? maxGlyphs : 0; };
+  uint16_t getLength() const { return length; };
+  const Glyph &operator[](uint16_t index) const { return glyphs[index]; };
+
+  // the same size getTextSize measures for the text
+  uint16_t getWidth() const { return width; };
+  uint16_t getHeight() const { return height; };
+
+  // how far the pen moves along the baseline
+  uint16_t getBaselineLength() const { return baselineLength; };
+
+  // drops the text laid out
+  void clear();
+
+private:
+  friend class Display;
+
+  uint16_t maxGlyphs;
+  Glyph *glyphs = nullptr;
+
+  const Font::Font *font = nullptr;
+  uint16_t length = 0;
+
+  uint16_t width = 0;
+  uint16_t height = 0;
+  uint16_t baselineLength = 0;
+  int16_t originXOffset = 0;
+  int16_t originYOffset = 0;
+};
+
+} // namespace Display
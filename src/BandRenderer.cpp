@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstdio>
+#include <cstring>
+
+#include "BandRenderer.hpp"
+
+namespace Display {
+
+BandRenderer::BandRenderer(::Display::Driver::Driver *panel, uint16_t rows, ::Display::Driver::Memory memory)
+    : panel(panel), rows(rows > 0 ? rows : 1), bytesPerRow(panel->getWidth() / 2) {
+  bands = ::Display::Driver::allocateMemory(2 * getBufferSize(), memory);
+  buffer = bands;
+}
+
+BandRenderer::~BandRenderer() {
+  // a band in flight still reads from the buffers that are about to be freed
+  panel->waitForTransfer();
+  ::Display::Driver::freeMemory(bands);
+}
+
+uint8_t *BandRenderer::frame() { return buffer - ((size_t)top * bytesPerRow); }
+
+esp_err_t BandRenderer::render(DrawCallback draw, void *arg) {
+  if (bands == nullptr)
+    return ESP_ERR_NO_MEM;
+
+  // the last band of the previous frame may still be sent from either buffer
+  esp_err_t err = panel->waitForTransfer();
+  if (err != ESP_OK)
+    return err;
+
+  uint16_t screenHeight = getHeight();
+  uint8_t band = 0;
+
+  for (top = 0; top < screenHeight; top += rows) {
+    height = screenHeight - top < rows ? screenHeight - top : rows;
+
+    // Sending a band waits for the one before it, so once band N is queued band N - 1 is sent and its buffer is free
+    // for band N + 1.
+    buffer = bands + (band * getBufferSize());
+    band ^= 1;
+
+    resetClip();
+    damage.clear();
+
+    Display display(this);
+    draw(display, arg);
+
+    err = panel->sendRowsToDisplayAsync(buffer, top, height);
+    if (err != ESP_OK)
+      break;
+  }
+
+  top = 0;
+  height = 0;
+  return err;
+}
+
+static void replayList(Display &display, void *list) { ((DisplayList *)list)->replay(display); }
+
+esp_err_t BandRenderer::render(DisplayList &list) {
+  if (list.hasOverflowed())
+    return ESP_ERR_NO_MEM;
+
+  return render(replayList, &list);
+}
+
+esp_err_t BandRenderer::clearBuffer() {
+  memset(buffer, 0, (size_t)height * bytesPerRow);
+  markDamaged(0, top, getWidth(), height);
+  return ESP_OK;
+}
+
+void BandRenderer::printBuffer() {
+  for (uint16_t y = 0; y < height; y++) {
+    for (uint16_t x = 0; x < bytesPerRow; x++)
+      printf("%02x", buffer[(y * bytesPerRow) + x]);
+    printf("\n");
+  }
+}
+
+void BandRenderer::setBufferPixel(int16_t x, int16_t y, uint16_t color) {
+  Point point = {x, y};
+  write4BitPointsTo4BitBuffer(&point, 1, color, frame());
+}
+
+void BandRenderer::setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) {
+  write4BitColorTo4BitBuffer(color, frame(), x, y, width, height);
+}
+
+void BandRenderer::setBufferPixels(const Point *points, size_t count, uint16_t color) {
+  write4BitPointsTo4BitBuffer(points, count, color, frame());
+}
+
+void BandRenderer::setBufferPixels(const ColoredPoint *points, size_t count) {
+  write4BitPointsTo4BitBuffer(points, count, frame());
+}
+
+void BandRenderer::setBufferSpans(const Span *spans, size_t count, uint16_t color) {
+  write4BitSpansTo4BitBuffer(spans, count, color, frame());
+}
+
+void BandRenderer::writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, const void *bitmap,
+                                       Bitmap::BitmapFormat format, uint16_t color, Flags flags) {
+  switch (format) {
+  case Bitmap::MONOCHROME:
+    write1BitBitmapTo4BitBuffer((const uint8_t *)bitmap, color, frame(), x, y, width, height, flags);
+    break;
+  case Bitmap::GRAYSCALE_4_BIT:
+    write4BitBitmapTo4BitBuffer((const uint8_t *)bitmap, frame(), x, y, width, height, flags);
+    break;
+  default:
+    convertBitmapToBuffer((const uint8_t *)bitmap, format, color, frame(), Bitmap::GRAYSCALE_4_BIT, x, y, width, height,
+                          flags);
+    break;
+  }
+}
+
+void BandRenderer::writeSpriteToBuffer(int16_t x, int16_t y, const Sprite &sprite, Flags flags) {
+  write4BitSpriteTo4BitBuffer(sprite, frame(), x, y, flags);
+}
+
+} // namespace Display
@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "Driver.hpp"
+
+namespace Display::Driver {
+
+// bounding box of the pixels written by a batch, so the damage is marked once instead of per pixel
+class BatchBounds {
+public:
+  void add(int16_t x, int16_t y, uint16_t width, uint16_t height = 1) {
+    left = x < left ? x : left;
+    right = x + width - 1 > right ? x + width - 1 : right;
+    top = y < top ? y : top;
+    bottom = y + height - 1 > bottom ? y + height - 1 : bottom;
+  };
+
+  bool isEmpty() { return left > right; };
+  Rect getRect() { return {left, top, (uint16_t)(right - left + 1), (uint16_t)(bottom - top + 1)}; };
+
+private:
+  int16_t left = INT16_MAX;
+  int16_t top = INT16_MAX;
+  int16_t right = INT16_MIN;
+  int16_t bottom = INT16_MIN;
+};
+
+void Driver::setBufferPixels(const Point *points, size_t count, uint16_t color) {
+  for (size_t i = 0; i < count; i++)
+    setBufferPixel(points[i].x, points[i].y, color);
+}
+
+void Driver::setBufferPixels(const ColoredPoint *points, size_t count) {
+  for (size_t i = 0; i < count; i++)
+    setBufferPixel(points[i].x, points[i].y, points[i].color);
+}
+
+void Driver::setBufferSpans(const Span *spans, size_t count, uint16_t color) {
+  for (size_t i = 0; i < count; i++)
+    setBufferBlock(spans[i].x, spans[i].y, spans[i].width, 1, color);
+}
+
+void Driver::write4BitPointsTo4BitBuffer(const Point *points, size_t count, uint16_t color, uint8_t *buffer) {
+  uint16_t bytesPerRow = getBufferStride() / 2;
+  int16_t lastColumn = getWidth() - 1;
+  Rect clip = getClip();
+
+  // precompute colors
+  uint8_t lowNibbleColor = 0x0f & color;
+  uint8_t highNibbleColor = 0xf0 & (color << 4);
+
+  BatchBounds bounds;
+  for (size_t i = 0; i < count; i++) {
+    int16_t x = points[i].x, y = points[i].y;
+
+    // coordinates before the clip wrap around to large unsigned values so one comparison per axis clips both sides
+    if ((uint32_t)(x - clip.x) >= clip.width || (uint32_t)(y - clip.y) >= clip.height)
+      continue;
+
+    if (quarterTurn) {
+      int16_t column = lastColumn - y;
+      y = x;
+      x = column;
+    }
+
+    uint8_t &pixels = buffer[(y * bytesPerRow) + (x / 2)];
+    if (x % 2 == 0) {
+      pixels = (pixels & 0x0f) | highNibbleColor;
+    } else {
+      pixels = (pixels & 0xf0) | lowNibbleColor;
+    }
+
+    bounds.add(x, y, 1);
+  }
+
+  if (!bounds.isEmpty())
+    damage.add(bounds.getRect());
+}
+
+void Driver::write4BitPointsTo4BitBuffer(const ColoredPoint *points, size_t count, uint8_t *buffer) {
+  uint16_t bytesPerRow = getBufferStride() / 2;
+  int16_t lastColumn = getWidth() - 1;
+  Rect clip = getClip();
+
+  BatchBounds bounds;
+  for (size_t i = 0; i < count; i++) {
+    int16_t x = points[i].x, y = points[i].y;
+
+    // coordinates before the clip wrap around to large unsigned values so one comparison per axis clips both sides
+    if ((uint32_t)(x - clip.x) >= clip.width || (uint32_t)(y - clip.y) >= clip.height)
+      continue;
+
+    if (quarterTurn) {
+      int16_t column = lastColumn - y;
+      y = x;
+      x = column;
+    }
+
+    uint8_t &pixels = buffer[(y * bytesPerRow) + (x / 2)];
+    if (x % 2 == 0) {
+      pixels = (pixels & 0x0f) | (0xf0 & (points[i].color << 4));
+    } else {
+      pixels = (pixels & 0xf0) | (0x0f & points[i].color);
+    }
+
+    bounds.add(x, y, 1);
+  }
+
+  if (!bounds.isEmpty())
+    damage.add(bounds.getRect());
+}
+
+void Driver::write4BitSpansTo4BitBuffer(const Span *spans, size_t count, uint16_t color, uint8_t *buffer) {
+  uint16_t bytesPerRow = getBufferStride() / 2;
+  int16_t lastColumn = getWidth() - 1;
+  Rect clip = getClip();
+
+  // precompute colors
+  uint8_t lowNibbleColor = 0x0f & color;
+  uint8_t highNibbleColor = 0xf0 & (color << 4);
+  uint8_t innerColor = lowNibbleColor | highNibbleColor;
+
+  BatchBounds bounds;
+  for (size_t i = 0; i < count; i++) {
+    if ((uint32_t)(spans[i].y - clip.y) >= clip.height)
+      continue;
+
+    // crop to the clip rectangle, the end is exclusive
+    int32_t start = spans[i].x < clip.x ? clip.x : spans[i].x;
+    int32_t end = (int32_t)spans[i].x + spans[i].width;
+    end = end > clip.x + clip.width ? clip.x + clip.width : end;
+    if (start >= end)
+      continue;
+
+    if (quarterTurn) { // the span runs down a column of the buffer
+      int16_t column = lastColumn - spans[i].y;
+      uint8_t keep = column % 2 == 0 ? 0x0f : 0xf0;
+      uint8_t *pixels = buffer + (start * bytesPerRow) + (column / 2);
+      for (int32_t row = start; row < end; row++, pixels += bytesPerRow)
+        *pixels = (*pixels & keep) | (innerColor & ~keep);
+
+      bounds.add(column, start, 1, end - start);
+      continue;
+    }
+
+    bounds.add(start, spans[i].y, end - start);
+
+    uint8_t *row = buffer + (spans[i].y * bytesPerRow);
+
+    if (start % 2 != 0) { // left edge is the low nibble of a uint8_t buffer entry
+      row[start / 2] = (row[start / 2] & 0xf0) | lowNibbleColor;
+      start++;
+    }
+
+    memset(row + (start / 2), innerColor, (end - start) / 2);
+
+    if ((end - start) % 2 != 0) { // right edge is the high nibble of a uint8_t buffer entry
+      row[(end - 1) / 2] = (row[(end - 1) / 2] & 0x0f) | highNibbleColor;
+    }
+  }
+
+  if (!bounds.isEmpty())
+    damage.add(bounds.getRect());
+}
+
+} // namespace Display::Driver
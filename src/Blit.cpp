@@ -0,0 +1,590 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "Driver.hpp"
+#include "Sprite.hpp"
+
+// Bitmap blits. Every kernel is a template specialized on the flags and on how the bitmap lines up with the buffer, a
+// blit picks its specialization once and its inner loops don't test either of them.
+namespace Display::Driver {
+
+// Bytes of 4 bit pixels handled at once by the blit kernels. GCC lowers the vector operations to SSE2, or AVX2 when
+// it's enabled, on x86 hosts, to NEON on ARM hosts and to one 32 bit operation per lane on the ESP32s.
+#ifdef __AVX2__
+typedef uint32_t BlitVector __attribute__((vector_size(32)));
+#else
+typedef uint32_t BlitVector __attribute__((vector_size(16)));
+#endif
+
+// buffer bytes for every byte of a 1 bit bitmap, each set bit becomes a 0xf nibble in the same position
+struct ExpandedBits {
+  uint8_t bytes[256][4];
+};
+
+static constexpr ExpandedBits expandBits() {
+  ExpandedBits table = {};
+  for (uint16_t bits = 0; bits < 256; bits++) {
+    for (uint8_t i = 0; i < 4; i++) {
+      uint8_t high = (bits >> (7 - (2 * i))) & 0b1 ? 0xf0 : 0x00;
+      uint8_t low = (bits >> (6 - (2 * i))) & 0b1 ? 0x0f : 0x00;
+      table.bytes[bits][i] = high | low;
+    }
+  }
+  return table;
+}
+
+static constexpr ExpandedBits EXPANDED_BITS = expandBits();
+
+static inline uint32_t expandBitsToNibbles(uint8_t bits) {
+  uint32_t nibbles;
+  memcpy(&nibbles, EXPANDED_BITS.bytes[bits], sizeof(nibbles));
+  return nibbles;
+}
+
+// Reads the 8 bits starting at `bit`, all of them have to be part of the bitmap. With `BYTE_ALIGNED` they have to
+// start on a byte, otherwise they must not.
+template <bool BYTE_ALIGNED> static inline uint8_t readBits(const uint8_t *bitmap, uint32_t bit) {
+  if (BYTE_ALIGNED)
+    return bitmap[bit / 8];
+
+  uint8_t shift = bit % 8;
+  return (bitmap[bit / 8] << shift) | (bitmap[(bit / 8) + 1] >> (8 - shift));
+}
+
+// reads the last `count` bits of a row into the top of a byte, without reading past the bitmap
+static inline uint8_t readLastBits(const uint8_t *bitmap, uint32_t bit, uint8_t count) {
+  uint8_t shift = bit % 8;
+  uint8_t bits = bitmap[bit / 8] << shift;
+  if (shift + count > 8)
+    bits |= bitmap[(bit / 8) + 1] >> (8 - shift);
+
+  return bits & (0xff00 >> count);
+}
+
+// 0xf in every nibble of `pixels` that isn't 0, the per pixel compare that transparent blits select with
+template <typename T> static inline T opaqueNibbles(T pixels) {
+  T bits = pixels | (pixels >> 2);
+  bits = (bits | (bits >> 1)) & 0x11111111U; // lowest bit of every nibble is set if any of its bits is
+  return (bits << 4) - bits;
+}
+
+// Combines destination pixels with 4 bit source pixels the way the flags ask for, the source pixels are already
+// shifted to line up with the destination.
+template <bool TRANSPARENT, bool ERASE, typename T> static inline T blendPixels(T destination, T source) {
+  if (ERASE)
+    return TRANSPARENT ? destination & ~opaqueNibbles(source) : destination & 0;
+
+  return TRANSPARENT ? (destination & ~opaqueNibbles(source)) | source : source;
+}
+
+// Colors the nibbles of `mask` and, unless the blit is transparent, clears the rest of the nibbles in `limit`.
+// Nibbles outside of `limit` are kept either way.
+template <bool TRANSPARENT, typename T> static inline T blendColor(T destination, T mask, T limit, T color) {
+  T keep = TRANSPARENT ? ~mask : ~limit;
+  return (destination & keep) | (color & mask);
+}
+
+template <bool TRANSPARENT, bool BYTE_ALIGNED>
+static void write1BitRow(uint8_t *destination, const uint8_t *bitmap, uint32_t bit, uint16_t width, bool splitLeft,
+                         uint32_t color) {
+  if (splitLeft) { // fill left edge so the rest of the row starts on a high nibble
+    uint8_t mask = 0x0f * ((bitmap[bit / 8] >> (7 - (bit % 8))) & 0b1);
+    *destination = blendColor<TRANSPARENT, uint8_t>(*destination, mask, 0x0f, color);
+
+    destination++;
+    bit++;
+    width--;
+  }
+
+  // expand 8 pixels into 4 buffer bytes at a time
+  for (; width >= 8; width -= 8) {
+    uint32_t pixels;
+    memcpy(&pixels, destination, sizeof(pixels));
+    pixels = blendColor<TRANSPARENT, uint32_t>(pixels, expandBitsToNibbles(readBits<BYTE_ALIGNED>(bitmap, bit)),
+                                               UINT32_MAX, color);
+    memcpy(destination, &pixels, sizeof(pixels));
+
+    destination += 4;
+    bit += 8;
+  }
+
+  if (width == 0)
+    return;
+
+  // the last few pixels only write the bytes they cover
+  uint8_t bytes = (width + 1) / 2;
+  uint32_t pixels = 0;
+  memcpy(&pixels, destination, bytes);
+  pixels = blendColor<TRANSPARENT, uint32_t>(pixels, expandBitsToNibbles(readLastBits(bitmap, bit, width)),
+                                             expandBitsToNibbles(0xff00 >> width), color);
+  memcpy(destination, &pixels, bytes);
+}
+
+template <bool TRANSPARENT>
+static void write1BitRows(const uint8_t *bitmap, uint32_t rowBit, uint16_t bitmapWidth, uint8_t *buffer,
+                          uint16_t bytesPerRow, uint16_t width, uint16_t height, bool splitLeft, uint8_t color) {
+  uint32_t colorWord = 0x11111111U * color; // color in all 8 nibbles
+
+  for (int16_t j = 0; j < height; j++) {
+    // rows of a bitmap whose width isn't a multiple of 8 start at a different bit every time
+    if ((rowBit + (splitLeft ? 1 : 0)) % 8 == 0) {
+      write1BitRow<TRANSPARENT, true>(buffer, bitmap, rowBit, width, splitLeft, colorWord);
+    } else {
+      write1BitRow<TRANSPARENT, false>(buffer, bitmap, rowBit, width, splitLeft, colorWord);
+    }
+
+    buffer += bytesPerRow;
+    rowBit += bitmapWidth;
+  }
+}
+
+// Buffer bytes for a byte of a 1 bit bitmap blitted down a buffer column, in a quarter turned buffer. Bit 7 - i sets
+// the low nibble of byte i of the word, where the pixel of the bitmap row on the right of the column goes.
+struct SpreadBits {
+  uint64_t columns[256];
+};
+
+static constexpr SpreadBits spreadBits() {
+  SpreadBits table = {};
+  for (uint16_t bits = 0; bits < 256; bits++) {
+    for (uint8_t i = 0; i < 8; i++)
+      table.columns[bits] |= (uint64_t)((bits >> (7 - i)) & 0b1 ? 0x0f : 0x00) << (8 * i);
+  }
+  return table;
+}
+
+static constexpr SpreadBits SPREAD_BITS = spreadBits();
+
+// Walks the rows of a bitmap blitted into a quarter turned buffer. Row j of the bitmap becomes the buffer column
+// `right - j` and its pixels run down the column, so every buffer byte takes a pixel from two neighbouring rows. They
+// are handed to `column` two at a time with the row going to the high nibble first. A row without a neighbour on
+// either edge of the bitmap is passed for both nibbles and `limit` only keeps its own.
+template <typename Column>
+static inline void forEachColumnPair(uint8_t *buffer, int16_t right, uint16_t height, Column column) {
+  uint8_t *destination = buffer + (right / 2);
+  uint16_t j = 0;
+
+  if (right % 2 == 0) { // the first row is the high nibble of the rightmost byte column
+    column(destination, 0, 0, 0xf0);
+    destination--;
+    j++;
+  }
+
+  for (; j + 1 < height; j += 2) {
+    column(destination, j + 1, j, 0xff);
+    destination--;
+  }
+
+  if (j < height) // the last row is the low nibble of the leftmost byte column
+    column(destination, j, j, 0x0f);
+}
+
+// Blits one byte column of a quarter turned buffer from a pair of 1 bit bitmap rows, eight pixels of both rows at a
+// time. `highBit` and `lowBit` are the first pixels of the rows going to the high and low nibbles.
+template <bool TRANSPARENT>
+static void write1BitColumn(uint8_t *destination, uint16_t bytesPerRow, const uint8_t *bitmap, uint32_t highBit,
+                            uint32_t lowBit, uint16_t length, uint8_t limit, uint8_t color) {
+  for (uint16_t i = 0; i < length; i += 8) {
+    uint8_t count = length - i < 8 ? length - i : 8;
+    uint64_t masks = (SPREAD_BITS.columns[readLastBits(bitmap, highBit + i, count)] << 4) |
+                     SPREAD_BITS.columns[readLastBits(bitmap, lowBit + i, count)];
+
+    for (uint8_t k = 0; k < count; k++) {
+      uint8_t mask = (masks >> (8 * k)) & limit;
+      *destination = blendColor<TRANSPARENT, uint8_t>(*destination, mask, limit, color);
+      destination += bytesPerRow;
+    }
+  }
+}
+
+template <bool TRANSPARENT>
+static void write1BitColumns(const uint8_t *bitmap, uint32_t rowBit, uint16_t bitmapWidth, uint8_t *buffer,
+                             uint16_t bytesPerRow, int16_t right, uint16_t width, uint16_t height, uint8_t color) {
+  uint8_t colorByte = 0x11 * color; // color in both nibbles
+
+  forEachColumnPair(buffer, right, height, [&](uint8_t *destination, uint16_t high, uint16_t low, uint8_t limit) {
+    write1BitColumn<TRANSPARENT>(destination, bytesPerRow, bitmap, rowBit + ((uint32_t)high * bitmapWidth),
+                                 rowBit + ((uint32_t)low * bitmapWidth), width, limit, colorByte);
+  });
+}
+
+void Driver::write1BitBitmapTo4BitBuffer(const uint8_t *bitmap, uint16_t color, uint8_t *buffer, int16_t x, int16_t y,
+                                         uint16_t width, uint16_t height, Flags flags) {
+  int16_t bitmapLeft = x, bitmapTop = y;
+  uint16_t bitmapWidth = width;
+
+  if (flags.erase) {
+    color = 0x0;
+  }
+
+  if (!cropBlock(x, y, width, height))
+    return; // no overlap between bitmap and the clip rectangle
+
+  // part of the bitmap left of or above the clip rectangle that is skipped
+  uint16_t bitmapX = x - bitmapLeft, bitmapY = y - bitmapTop;
+
+  uint16_t bytesPerRow = getBufferStride() / 2;
+
+  // Bitmap rows aren't padded to whole bytes, so the bitmap is addressed by bit. This is the bit of the first visible
+  // pixel.
+  uint32_t rowBit = ((uint32_t)bitmapY * bitmapWidth) + bitmapX;
+
+  if (quarterTurn) {
+    int16_t right = getWidth() - 1 - y; // buffer column of the first visible row
+    turnBlock(x, y, width, height);
+    markDamaged(x, y, width, height);
+
+    // the block is turned as well, its height is the width of the visible part of the bitmap
+    buffer += y * bytesPerRow;
+    if (flags.transparent) {
+      write1BitColumns<true>(bitmap, rowBit, bitmapWidth, buffer, bytesPerRow, right, height, width, color & 0x0f);
+    } else {
+      write1BitColumns<false>(bitmap, rowBit, bitmapWidth, buffer, bytesPerRow, right, height, width, color & 0x0f);
+    }
+    return;
+  }
+
+  markDamaged(x, y, width, height);
+
+  // set screen cursor to the position where the bitmap will be written
+  buffer += (y * bytesPerRow) + (x / 2);
+
+  // left edge is the low nibble of a uint8_t buffer entry
+  bool splitLeft = x % 2 != 0;
+
+  if (flags.transparent) {
+    write1BitRows<true>(bitmap, rowBit, bitmapWidth, buffer, bytesPerRow, width, height, splitLeft, color & 0x0f);
+  } else {
+    write1BitRows<false>(bitmap, rowBit, bitmapWidth, buffer, bytesPerRow, width, height, splitLeft, color & 0x0f);
+  }
+};
+
+// Source byte `i` of a row. When the row starts on the low nibble of `source` the pixels are moved up a nibble so they
+// line up with the destination, which then also reads the byte after the last one.
+template <bool SHIFTED, typename T> static inline T loadSource(const uint8_t *source, size_t i) {
+  T pixels;
+  memcpy(&pixels, source + i, sizeof(pixels));
+  if (!SHIFTED)
+    return pixels;
+
+  T next;
+  memcpy(&next, source + i + 1, sizeof(next));
+
+  return ((pixels << 4) & 0xf0f0f0f0U) | ((next >> 4) & 0x0f0f0f0fU);
+}
+
+// blits as many `T` sized chunks of a row as fit, starting at byte `i`, and returns the first byte that's left
+template <bool TRANSPARENT, bool ERASE, bool SHIFTED, typename T>
+static inline size_t blitChunks(uint8_t *destination, const uint8_t *source, size_t i, size_t bytes) {
+  for (; i + sizeof(T) <= bytes; i += sizeof(T)) {
+    T pixels;
+    memcpy(&pixels, destination + i, sizeof(pixels));
+    pixels = blendPixels<TRANSPARENT, ERASE>(pixels, loadSource<SHIFTED, T>(source, i));
+    memcpy(destination + i, &pixels, sizeof(pixels));
+  }
+
+  return i;
+}
+
+// blits `bytes` whole bytes of 4 bit pixels to a destination row
+template <bool TRANSPARENT, bool ERASE, bool SHIFTED>
+static void write4BitRow(uint8_t *destination, const uint8_t *source, size_t bytes) {
+  size_t i = 0;
+
+#ifndef CONFIG_DISPLAY_SCALAR_BLIT
+  i = blitChunks<TRANSPARENT, ERASE, SHIFTED, BlitVector>(destination, source, i, bytes);
+  i = blitChunks<TRANSPARENT, ERASE, SHIFTED, uint32_t>(destination, source, i, bytes); // most of what's left
+#endif
+
+  // scalar reference, also handles the last few bytes
+  for (; i < bytes; i++)
+    destination[i] = blendPixels<TRANSPARENT, ERASE, uint8_t>(destination[i], loadSource<SHIFTED, uint8_t>(source, i));
+}
+
+// blits a single pixel, `highNibble` selects the pixel of the destination byte
+template <bool TRANSPARENT, bool ERASE>
+static inline void write4BitPixel(uint8_t *destination, bool highNibble, uint8_t pixel) {
+  uint8_t source = highNibble ? pixel << 4 : pixel;
+  uint8_t keep = highNibble ? 0x0f : 0xf0;
+
+  *destination = (*destination & keep) | (blendPixels<TRANSPARENT, ERASE, uint8_t>(*destination, source) & ~keep);
+}
+
+static inline uint8_t read4BitPixel(const uint8_t *bitmap, uint32_t pixel) {
+  return pixel % 2 == 0 ? bitmap[pixel / 2] >> 4 : bitmap[pixel / 2] & 0x0f;
+}
+
+template <bool TRANSPARENT, bool ERASE>
+static void write4BitRows(const uint8_t *bitmap, uint32_t rowPixel, uint16_t bitmapWidth, uint8_t *buffer,
+                          uint16_t bytesPerRow, uint16_t width, uint16_t height, bool splitLeft) {
+  //                                   bitmap width
+  //                   |-------------------------------------------|
+  //    buffer ->  ________ ________ ________ ________ ________ ________
+  //
+  //                   |--| |---------------------------------| |--|
+  //                    ^                                         ^
+  //  splitLeft = true _|             innerBytes = 4              |_ splitRight = true
+  //
+  // Inner bytes of the buffer start on a high nibble. When the first inner pixel of the bitmap is the low nibble of a
+  // bitmap byte they are unaligned and every source byte is put together from two bitmap bytes.
+  uint16_t innerBytes = (width - (splitLeft ? 1 : 0)) / 2;
+  bool splitRight = (width - (splitLeft ? 1 : 0)) % 2 != 0;
+
+  for (int16_t j = 0; j < height; j++) {
+    uint8_t *destination = buffer;
+    uint32_t pixel = rowPixel;
+
+    if (splitLeft) { // fill left edge
+      write4BitPixel<TRANSPARENT, ERASE>(destination, false, read4BitPixel(bitmap, pixel));
+      destination++;
+      pixel++;
+    }
+
+    // fill inner span, rows of a bitmap with an odd width alternate between lining up with the buffer or not
+    if (pixel % 2 == 0) {
+      write4BitRow<TRANSPARENT, ERASE, false>(destination, bitmap + (pixel / 2), innerBytes);
+    } else {
+      write4BitRow<TRANSPARENT, ERASE, true>(destination, bitmap + (pixel / 2), innerBytes);
+    }
+
+    destination += innerBytes;
+    pixel += 2 * innerBytes;
+
+    if (splitRight) // fill right edge
+      write4BitPixel<TRANSPARENT, ERASE>(destination, true, read4BitPixel(bitmap, pixel));
+
+    buffer += bytesPerRow;
+    rowPixel += bitmapWidth;
+  }
+}
+
+// two pixels starting at any pixel of the bitmap, the first one in the high nibble
+static inline uint8_t read4BitPixels(const uint8_t *bitmap, uint32_t pixel) {
+  if (pixel % 2 == 0)
+    return bitmap[pixel / 2];
+
+  return (bitmap[pixel / 2] << 4) | (bitmap[(pixel / 2) + 1] >> 4);
+}
+
+// blits a byte of pixels, nibbles outside of `limit` are kept
+template <bool TRANSPARENT, bool ERASE>
+static inline void write4BitPixels(uint8_t *destination, uint8_t pixels, uint8_t limit) {
+  *destination = (*destination & ~limit) | (blendPixels<TRANSPARENT, ERASE, uint8_t>(*destination, pixels) & limit);
+}
+
+// Blits one byte column of a quarter turned buffer from a pair of 4 bit bitmap rows, reading a byte of both rows at a
+// time. `highPixel` and `lowPixel` are the first pixels of the rows going to the high and low nibbles.
+template <bool TRANSPARENT, bool ERASE>
+static void write4BitColumn(uint8_t *destination, uint16_t bytesPerRow, const uint8_t *bitmap, uint32_t highPixel,
+                            uint32_t lowPixel, uint16_t length, uint8_t limit) {
+  uint16_t i = 0;
+  for (; i + 2 <= length; i += 2) {
+    uint8_t high = read4BitPixels(bitmap, highPixel + i), low = read4BitPixels(bitmap, lowPixel + i);
+    write4BitPixels<TRANSPARENT, ERASE>(destination, (high & 0xf0) | (low >> 4), limit);
+    write4BitPixels<TRANSPARENT, ERASE>(destination + bytesPerRow, (high << 4) | (low & 0x0f), limit);
+    destination += 2 * bytesPerRow;
+  }
+
+  if (i < length) {
+    uint8_t pixels = (read4BitPixel(bitmap, highPixel + i) << 4) | read4BitPixel(bitmap, lowPixel + i);
+    write4BitPixels<TRANSPARENT, ERASE>(destination, pixels, limit);
+  }
+}
+
+template <bool TRANSPARENT, bool ERASE>
+static void write4BitColumns(const uint8_t *bitmap, uint32_t rowPixel, uint16_t bitmapWidth, uint8_t *buffer,
+                             uint16_t bytesPerRow, int16_t right, uint16_t width, uint16_t height) {
+  forEachColumnPair(buffer, right, height, [&](uint8_t *destination, uint16_t high, uint16_t low, uint8_t limit) {
+    write4BitColumn<TRANSPARENT, ERASE>(destination, bytesPerRow, bitmap, rowPixel + ((uint32_t)high * bitmapWidth),
+                                        rowPixel + ((uint32_t)low * bitmapWidth), width, limit);
+  });
+}
+
+typedef void (*Write4BitColumns)(const uint8_t *bitmap, uint32_t rowPixel, uint16_t bitmapWidth, uint8_t *buffer,
+                                 uint16_t bytesPerRow, int16_t right, uint16_t width, uint16_t height);
+
+// indexed by the transparent and then the erase flag
+static constexpr Write4BitColumns WRITE_4_BIT_COLUMNS[2][2] = {
+    {write4BitColumns<false, false>, write4BitColumns<false, true>},
+    {write4BitColumns<true, false>, write4BitColumns<true, true>},
+};
+
+typedef void (*Write4BitRows)(const uint8_t *bitmap, uint32_t rowPixel, uint16_t bitmapWidth, uint8_t *buffer,
+                              uint16_t bytesPerRow, uint16_t width, uint16_t height, bool splitLeft);
+
+// indexed by the transparent and then the erase flag
+static constexpr Write4BitRows WRITE_4_BIT_ROWS[2][2] = {
+    {write4BitRows<false, false>, write4BitRows<false, true>},
+    {write4BitRows<true, false>, write4BitRows<true, true>},
+};
+
+void Driver::write4BitBitmapTo4BitBuffer(const uint8_t *bitmap, uint8_t *buffer, int16_t x, int16_t y, uint16_t width,
+                                         uint16_t height, Flags flags) {
+  int16_t bitmapLeft = x, bitmapTop = y;
+  uint16_t bitmapWidth = width;
+
+  if (!cropBlock(x, y, width, height))
+    return; // no overlap between bitmap and the clip rectangle
+
+  // part of the bitmap left of or above the clip rectangle that is skipped
+  uint16_t bitmapX = x - bitmapLeft, bitmapY = y - bitmapTop;
+
+  uint16_t bytesPerRow = getBufferStride() / 2;
+
+  // pixels of the bitmap are packed without padding rows to whole bytes, so it's addressed by pixel, this is the first
+  // visible pixel
+  uint32_t rowPixel = ((uint32_t)bitmapY * bitmapWidth) + bitmapX;
+
+  if (quarterTurn) {
+    int16_t right = getWidth() - 1 - y; // buffer column of the first visible row
+    turnBlock(x, y, width, height);
+    markDamaged(x, y, width, height);
+
+    // the block is turned as well, its height is the width of the visible part of the bitmap
+    WRITE_4_BIT_COLUMNS[flags.transparent][flags.erase](bitmap, rowPixel, bitmapWidth, buffer + (y * bytesPerRow),
+                                                        bytesPerRow, right, height, width);
+    return;
+  }
+
+  markDamaged(x, y, width, height);
+
+  // set screen cursor to the position where the bitmap will be written
+  buffer += (y * bytesPerRow) + (x / 2);
+
+  // left edge is the low nibble of a uint8_t buffer entry
+  bool splitLeft = x % 2 != 0;
+
+  WRITE_4_BIT_ROWS[flags.transparent][flags.erase](bitmap, rowPixel, bitmapWidth, buffer, bytesPerRow, width, height,
+                                                   splitLeft);
+};
+
+void Driver::convertBitmapToBuffer(const uint8_t *bitmap, Bitmap::BitmapFormat format, uint16_t color, uint8_t *buffer,
+                                   Bitmap::BitmapFormat bufferFormat, int16_t x, int16_t y, uint16_t width,
+                                   uint16_t height, Flags flags) {
+  int16_t bitmapLeft = x, bitmapTop = y;
+  uint16_t bitmapWidth = width;
+
+  if (!cropBlock(x, y, width, height))
+    return; // no overlap between bitmap and the clip rectangle
+
+  // first visible pixel of the bitmap
+  uint32_t rowPixel = ((uint32_t)(y - bitmapTop) * bitmapWidth) + (x - bitmapLeft);
+
+  // buffer values of every pixel value of bitmaps up to 8 bits, monochrome bitmaps are drawn in `color`
+  uint16_t colors[256];
+  bool lookup = format != Bitmap::RGB565;
+  if (lookup) {
+    for (uint16_t value = 0; value < (1 << Bitmap::bitsPerPixel(format)); value++) {
+      colors[value] = format == Bitmap::MONOCHROME ? value * toBufferColor(color, bufferFormat)
+                                                   : Bitmap::convertColor(value, format, bufferFormat);
+    }
+  }
+
+  int16_t damageX = x, damageY = y;
+  uint16_t damageWidth = width, damageHeight = height;
+  if (quarterTurn)
+    turnBlock(damageX, damageY, damageWidth, damageHeight);
+  markDamaged(damageX, damageY, damageWidth, damageHeight);
+
+  uint16_t bufferWidth = getBufferStride();
+
+  for (uint16_t j = 0; j < height; j++) {
+    for (uint16_t i = 0; i < width; i++) {
+      uint16_t pixel = Bitmap::getPixel(bitmap, format, rowPixel + i);
+      if (flags.transparent && pixel == 0)
+        continue;
+
+      uint16_t value = 0;
+      if (!flags.erase)
+        value = lookup ? colors[pixel] : Bitmap::convertColor(pixel, format, bufferFormat);
+
+      int16_t column = x + i, row = y + j;
+      if (quarterTurn) {
+        int16_t turnedColumn = bufferWidth - 1 - row;
+        row = column;
+        column = turnedColumn;
+      }
+
+      Bitmap::setPixel(buffer, bufferFormat, ((uint32_t)row * bufferWidth) + column, value);
+    }
+
+    rowPixel += bitmapWidth;
+  }
+}
+
+// Blits rows that line up with the buffer as whole bytes. `keepLeft` and `keepRight` are the nibbles of the first and
+// last byte outside of the sprite, they are put back after the row is written.
+template <bool TRANSPARENT, bool ERASE>
+static void writeSpriteRows(const uint8_t *rows, uint16_t spriteBytesPerRow, uint8_t *buffer, uint16_t bytesPerRow,
+                            uint16_t bytes, uint16_t height, uint8_t keepLeft, uint8_t keepRight) {
+  for (int16_t j = 0; j < height; j++) {
+    uint8_t left = buffer[0] & keepLeft, right = buffer[bytes - 1] & keepRight;
+
+    write4BitRow<TRANSPARENT, ERASE, false>(buffer, rows, bytes);
+
+    buffer[0] = (buffer[0] & ~keepLeft) | left;
+    buffer[bytes - 1] = (buffer[bytes - 1] & ~keepRight) | right;
+
+    buffer += bytesPerRow;
+    rows += spriteBytesPerRow;
+  }
+}
+
+typedef void (*WriteSpriteRows)(const uint8_t *rows, uint16_t spriteBytesPerRow, uint8_t *buffer,
+                                uint16_t bytesPerRow, uint16_t bytes, uint16_t height, uint8_t keepLeft,
+                                uint8_t keepRight);
+
+// indexed by the transparent and then the erase flag
+static constexpr WriteSpriteRows WRITE_SPRITE_ROWS[2][2] = {
+    {writeSpriteRows<false, false>, writeSpriteRows<false, true>},
+    {writeSpriteRows<true, false>, writeSpriteRows<true, true>},
+};
+
+void Driver::writeSpriteToBuffer(int16_t x, int16_t y, const Sprite &sprite, Flags flags) {
+  const uint8_t *rows = sprite.getRows(false);
+  if (rows == nullptr)
+    return; // the sprite couldn't allocate its copies
+
+  // a single row of the unshifted copy is packed like a bitmap
+  for (uint16_t j = 0; j < sprite.getHeight(); j++, rows += sprite.getBytesPerRow())
+    writeBitmapToBuffer(x, y + j, sprite.getWidth(), 1, rows, Bitmap::GRAYSCALE_4_BIT, 0, flags);
+}
+
+void Driver::write4BitSpriteTo4BitBuffer(const Sprite &sprite, uint8_t *buffer, int16_t x, int16_t y, Flags flags) {
+  if (quarterTurn || sprite.getRows(false) == nullptr) {
+    Driver::writeSpriteToBuffer(x, y, sprite, flags); // rows turned into columns go through the bitmap kernels
+    return;
+  }
+
+  int16_t spriteLeft = x, spriteTop = y;
+  uint16_t width = sprite.getWidth(), height = sprite.getHeight();
+
+  if (!cropBlock(x, y, width, height))
+    return; // no overlap between sprite and the clip rectangle
+
+  // part of the sprite left of or above the clip rectangle that is skipped
+  uint16_t spriteX = x - spriteLeft, spriteY = y - spriteTop;
+
+  markDamaged(x, y, width, height);
+
+  uint16_t bytesPerRow = getBufferStride() / 2;
+
+  // Pixel i of the shifted copy is nibble i + 1 of its row. The copy that puts the first visible pixel on the same
+  // nibble as x is shifted when the sprite starts on an odd x.
+  bool shifted = spriteLeft % 2 != 0;
+  uint16_t spriteBytesPerRow = sprite.getBytesPerRow();
+  const uint8_t *rows = sprite.getRows(shifted) + ((size_t)spriteY * spriteBytesPerRow) + ((spriteX + shifted) / 2);
+
+  // bytes of the buffer covered by each row, whatever is in the other nibble of the edges is kept
+  uint16_t bytes = ((x + width - 1) / 2) - (x / 2) + 1;
+  uint8_t keepLeft = x % 2 != 0 ? 0xf0 : 0x00;
+  uint8_t keepRight = (x + width - 1) % 2 == 0 ? 0x0f : 0x00;
+
+  WRITE_SPRITE_ROWS[flags.transparent][flags.erase](rows, spriteBytesPerRow, buffer + (y * bytesPerRow) + (x / 2),
+                                                    bytesPerRow, bytes, height, keepLeft, keepRight);
+}
+
+} // namespace Display::Driver
@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstdio>
+#include <cstring>
+
+#include "Canvas.hpp"
+
+namespace Display {
+
+// Monochrome canvases are packed like monochrome bitmaps, rows aren't padded to whole bytes and pixels are addressed by
+// bit. Their kernels move up to 8 bits at a time, held in the top of a byte.
+
+// reads `count` bits starting at `bit` into the top of a byte, without reading past the last one
+static inline uint8_t readBits(const uint8_t *bitmap, uint32_t bit, uint8_t count) {
+  uint8_t shift = bit % 8;
+  uint8_t bits = bitmap[bit / 8] << shift;
+  if (shift + count > 8)
+    bits |= bitmap[(bit / 8) + 1] >> (8 - shift);
+
+  return bits & (0xff00 >> count);
+}
+
+// replaces the bits of `mask` starting at `bit` with those of `bits`, the second byte is only touched if the mask
+// reaches into it
+static inline void writeBits(uint8_t *buffer, uint32_t bit, uint8_t bits, uint8_t mask) {
+  uint8_t shift = bit % 8;
+  uint8_t *bytes = buffer + (bit / 8);
+  bytes[0] = (bytes[0] & ~(mask >> shift)) | ((bits & mask) >> shift);
+
+  uint8_t spill = mask << (8 - shift);
+  if (shift != 0 && spill != 0)
+    bytes[1] = (bytes[1] & ~spill) | ((bits << (8 - shift)) & spill);
+}
+
+// the opaque pixels of up to 8 pixels of a 4 bit bitmap as bits in the top of a byte
+static inline uint8_t readOpaquePixels(const uint8_t *bitmap, uint32_t pixel, uint8_t count) {
+  uint8_t bits = 0;
+  for (uint8_t i = 0; i < count; i++, pixel++) {
+    uint8_t color = pixel % 2 == 0 ? bitmap[pixel / 2] >> 4 : bitmap[pixel / 2] & 0x0f;
+    bits |= (color != 0 ? 0x80 : 0x00) >> i;
+  }
+  return bits;
+}
+
+Canvas::Canvas(uint16_t width, uint16_t height, Bitmap::BitmapFormat format, ::Display::Driver::Memory memory)
+    : width(width), height(height), format(format) {
+  ownedBuffer = ::Display::Driver::allocateMemory(bufferSize(width, height, format), memory);
+  buffer = ownedBuffer;
+}
+
+Canvas::Canvas(uint16_t width, uint16_t height, Bitmap::BitmapFormat format, uint8_t *buffer)
+    : width(width), height(height), format(format) {
+  this->buffer = buffer;
+}
+
+Canvas::~Canvas() { ::Display::Driver::freeMemory(ownedBuffer); }
+
+void Canvas::drawTo(Display &display, Origin::Object2D origin, int16_t x, int16_t y, uint16_t color, Flags flags) {
+  if (format != Bitmap::GRAYSCALE_4_BIT || width % 2 == 0) {
+    display.drawBitmap(origin, x, y, width, height, format, buffer, color, flags);
+    return;
+  }
+
+  // bitmap rows aren't padded, so the padded rows are blitted one at a time without the padding
+  Display::shiftOrigin2DToTopLeft(origin, x, y, width, height);
+
+  uint16_t bytesPerRow = getBufferStride() / 2;
+  for (uint16_t row = 0; row < height; row++)
+    display.drawBitmap(Origin::Object2D::TOP_LEFT, x, y + row, width, 1, format, buffer + (row * bytesPerRow), color,
+                       flags);
+}
+
+esp_err_t Canvas::initializeDisplay() {
+  if (buffer == nullptr)
+    return ESP_ERR_NO_MEM;
+
+  return clearBuffer();
+}
+
+esp_err_t Canvas::clearBuffer() {
+  memset(buffer, 0, getBufferSize());
+  markAllDamaged();
+  return ESP_OK;
+}
+
+void Canvas::printBuffer() {
+  for (uint16_t y = 0; y < height; y++) {
+    for (uint16_t x = 0; x < width; x++) {
+      uint32_t pixel = ((uint32_t)y * getBufferStride()) + x;
+      if (format == Bitmap::MONOCHROME) {
+        printf("%c", (buffer[pixel / 8] >> (7 - (pixel % 8))) & 0b1 ? '1' : '0');
+      } else {
+        // a digit per pixel for grays up to 4 bits, others are separated
+        uint8_t bits = Bitmap::bitsPerPixel(format);
+        printf(bits <= 4 ? "%x" : "%0*x ", bits / 4, Bitmap::getPixel(buffer, format, pixel));
+      }
+    }
+    printf("\n");
+  }
+}
+
+void Canvas::setBufferPixel(int16_t x, int16_t y, uint16_t color) {
+  if (format == Bitmap::MONOCHROME) {
+    write1BitColorTo1BitBuffer(color, x, y, 1, 1);
+  } else if (format == Bitmap::GRAYSCALE_4_BIT) {
+    Point point = {x, y};
+    write4BitPointsTo4BitBuffer(&point, 1, color, buffer);
+  } else {
+    writeColorToBuffer(color, buffer, format, x, y, 1, 1);
+  }
+}
+
+void Canvas::setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) {
+  if (format == Bitmap::MONOCHROME) {
+    write1BitColorTo1BitBuffer(color, x, y, width, height);
+  } else if (format == Bitmap::GRAYSCALE_4_BIT) {
+    write4BitColorTo4BitBuffer(color, buffer, x, y, width, height);
+  } else {
+    writeColorToBuffer(color, buffer, format, x, y, width, height);
+  }
+}
+
+// canvases that aren't 4 bit go through setBufferPixel and setBufferBlock
+void Canvas::setBufferPixels(const Point *points, size_t count, uint16_t color) {
+  if (format != Bitmap::GRAYSCALE_4_BIT) {
+    Driver::setBufferPixels(points, count, color);
+  } else {
+    write4BitPointsTo4BitBuffer(points, count, color, buffer);
+  }
+}
+
+void Canvas::setBufferPixels(const ColoredPoint *points, size_t count) {
+  if (format != Bitmap::GRAYSCALE_4_BIT) {
+    Driver::setBufferPixels(points, count);
+  } else {
+    write4BitPointsTo4BitBuffer(points, count, buffer);
+  }
+}
+
+void Canvas::setBufferSpans(const Span *spans, size_t count, uint16_t color) {
+  if (format != Bitmap::GRAYSCALE_4_BIT) {
+    Driver::setBufferSpans(spans, count, color);
+  } else {
+    write4BitSpansTo4BitBuffer(spans, count, color, buffer);
+  }
+}
+
+void Canvas::writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, const void *bitmap,
+                                 Bitmap::BitmapFormat format, uint16_t color, Flags flags) {
+  bool fastFormat = format == Bitmap::MONOCHROME || format == Bitmap::GRAYSCALE_4_BIT;
+  if (this->format == Bitmap::MONOCHROME && fastFormat) {
+    writeBitmapTo1BitBuffer((const uint8_t *)bitmap, format, color, x, y, width, height, flags);
+  } else if (this->format == Bitmap::GRAYSCALE_4_BIT && format == Bitmap::MONOCHROME) {
+    write1BitBitmapTo4BitBuffer((const uint8_t *)bitmap, color, buffer, x, y, width, height, flags);
+  } else if (this->format == Bitmap::GRAYSCALE_4_BIT && format == Bitmap::GRAYSCALE_4_BIT) {
+    write4BitBitmapTo4BitBuffer((const uint8_t *)bitmap, buffer, x, y, width, height, flags);
+  } else {
+    convertBitmapToBuffer((const uint8_t *)bitmap, format, color, buffer, this->format, x, y, width, height, flags);
+  }
+}
+
+void Canvas::writeSpriteToBuffer(int16_t x, int16_t y, const Sprite &sprite, Flags flags) {
+  if (format != Bitmap::GRAYSCALE_4_BIT) {
+    Driver::writeSpriteToBuffer(x, y, sprite, flags);
+  } else {
+    write4BitSpriteTo4BitBuffer(sprite, buffer, x, y, flags);
+  }
+}
+
+void Canvas::write1BitColorTo1BitBuffer(uint16_t color, int16_t x, int16_t y, uint16_t width, uint16_t height) {
+  if (!cropBlock(x, y, width, height))
+    return; // no overlap between block and the clip rectangle
+
+  markDamaged(x, y, width, height);
+
+  uint8_t bits = (color & 0x0f) != 0 ? 0xff : 0x00;
+  uint32_t rowBit = ((uint32_t)y * this->width) + x;
+
+  for (uint16_t j = 0; j < height; j++) {
+    for (uint16_t i = 0; i < width; i += 8) {
+      uint8_t count = width - i < 8 ? width - i : 8;
+      writeBits(buffer, rowBit + i, bits, 0xff00 >> count);
+    }
+
+    rowBit += this->width;
+  }
+}
+
+void Canvas::writeBitmapTo1BitBuffer(const uint8_t *bitmap, Bitmap::BitmapFormat format, uint16_t color, int16_t x,
+                                     int16_t y, uint16_t width, uint16_t height, Flags flags) {
+  int16_t bitmapLeft = x, bitmapTop = y;
+  uint16_t bitmapWidth = width;
+
+  if (!cropBlock(x, y, width, height))
+    return; // no overlap between bitmap and the clip rectangle
+
+  markDamaged(x, y, width, height);
+
+  // part of the bitmap left of or above the clip rectangle that is skipped
+  uint16_t bitmapX = x - bitmapLeft, bitmapY = y - bitmapTop;
+
+  // pixels of the source are set in the canvas unless they are drawn in 0, 4 bit bitmaps are drawn in their own colors
+  bool set = !flags.erase && (format == Bitmap::GRAYSCALE_4_BIT || (color & 0x0f) != 0);
+
+  uint32_t rowPixel = ((uint32_t)bitmapY * bitmapWidth) + bitmapX;
+  uint32_t rowBit = ((uint32_t)y * this->width) + x;
+
+  for (uint16_t j = 0; j < height; j++) {
+    for (uint16_t i = 0; i < width; i += 8) {
+      uint8_t count = width - i < 8 ? width - i : 8;
+      uint8_t opaque = format == Bitmap::MONOCHROME ? readBits(bitmap, rowPixel + i, count)
+                                                    : readOpaquePixels(bitmap, rowPixel + i, count);
+
+      // transparent blits only write the opaque pixels, the others clear the rest
+      uint8_t mask = flags.transparent ? opaque : 0xff00 >> count;
+      writeBits(buffer, rowBit + i, set ? opaque : 0x00, mask);
+    }
+
+    rowPixel += bitmapWidth;
+    rowBit += this->width;
+  }
+}
+
+} // namespace Display
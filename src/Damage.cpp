@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Driver.hpp"
+
+namespace Display::Driver {
+
+static bool contains(const Rect &outer, const Rect &inner) {
+  return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width &&
+         inner.y + inner.height <= outer.y + outer.height;
+}
+
+static Rect unite(const Rect &a, const Rect &b) {
+  int16_t left = a.x < b.x ? a.x : b.x;
+  int16_t top = a.y < b.y ? a.y : b.y;
+  int16_t right = a.x + a.width > b.x + b.width ? a.x + a.width : b.x + b.width;
+  int16_t bottom = a.y + a.height > b.y + b.height ? a.y + a.height : b.y + b.height;
+  return {left, top, (uint16_t)(right - left), (uint16_t)(bottom - top)};
+}
+
+static uint32_t cost(const Rect &rect) { return (uint32_t)rect.width * rect.height + DamageMap::TRANSFER_OVERHEAD; }
+
+void DamageMap::add(Rect rect) {
+  if (rect.width == 0 || rect.height == 0)
+    return;
+
+  // most writes land next to or inside the previous ones, so check for cheap containment first
+  for (uint8_t i = 0; i < count; i++) {
+    if (contains(rects[i], rect))
+      return;
+  }
+
+  while (count > 0) {
+    // find the tracked rectangle that is cheapest to merge with
+    uint8_t best = 0;
+    int32_t bestDelta = INT32_MAX;
+    for (uint8_t i = 0; i < count; i++) {
+      int32_t delta = (int32_t)cost(unite(rects[i], rect)) - (int32_t)cost(rects[i]) - (int32_t)cost(rect);
+      if (delta < bestDelta) {
+        bestDelta = delta;
+        best = i;
+      }
+    }
+
+    // keep the rectangle separate if one more transfer is cheaper, unless we are out of slots
+    if (bestDelta > 0 && count < MAX_RECTS)
+      break;
+
+    // merge and retry since the grown rectangle may now be worth merging with another one
+    rect = unite(rects[best], rect);
+    rects[best] = rects[--count];
+  }
+
+  rects[count++] = rect;
+}
+
+void Driver::markAllDamaged() {
+  damage.clear();
+  damage.add({0, 0, getWidth(), getHeight()});
+}
+
+} // namespace Display::Driver
@@ -12,10 +12,47 @@ esp_err_t Display::clear() { return driver->clearBuffer(); }
 
 esp_err_t Display::update() { return driver->sendBufferToDisplay(); }
 
+esp_err_t Display::updateAsync() { return driver->sendBufferToDisplayAsync(); }
+
+esp_err_t Display::waitForUpdate(TickType_t timeout) { return driver->waitForTransfer(timeout); }
+
 esp_err_t Display::setRotation(Rotation rotation) { return driver->setRotation(rotation); }
 
+esp_err_t Display::pushClip(Rect rect) {
+  if (clipDepth == MAX_CLIP_DEPTH)
+    return ESP_ERR_NO_MEM;
+
+  clipStack[clipDepth] = rect.intersect(driver->getClip());
+  driver->setClip(clipStack[clipDepth]);
+  clipDepth++;
+  return ESP_OK;
+}
+
+esp_err_t Display::popClip() {
+  if (clipDepth == 0)
+    return ESP_ERR_INVALID_STATE;
+
+  clipDepth--;
+  if (clipDepth == 0) {
+    driver->resetClip();
+  } else {
+    driver->setClip(clipStack[clipDepth - 1]);
+  }
+  return ESP_OK;
+}
+
 void Display::drawPixel(int16_t x, int16_t y, uint16_t color) { driver->setBufferPixel(x, y, color); }
 
+void Display::drawPixels(const Point *points, size_t count, uint16_t color) {
+  driver->setBufferPixels(points, count, color);
+}
+
+void Display::drawPixels(const ColoredPoint *points, size_t count) { driver->setBufferPixels(points, count); }
+
+void Display::drawSpans(const Span *spans, size_t count, uint16_t color) {
+  driver->setBufferSpans(spans, count, color);
+}
+
 void Display::shiftOrigin2DToTopLeft(Origin::Object2D origin, int16_t &x, int16_t &y, uint16_t width, uint16_t height) {
   switch (origin) {
   case Origin::Object2D::TOP_LEFT:
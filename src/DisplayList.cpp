@@ -0,0 +1,362 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstdio>
+#include <cstring>
+
+#include "DisplayList.hpp"
+
+namespace Display {
+
+enum class DisplayList::CommandType : uint8_t {
+  CLEAR,
+  BLOCK,
+  POINTS,         // followed by `count` Points
+  COLORED_POINTS, // followed by `count` ColoredPoints
+  SPANS,          // followed by `count` Spans
+  BITMAP,
+  SPRITE,
+};
+
+struct DisplayList::Command {
+  CommandType type;
+  bool removed;   // dropped by optimize, skipped until the buffer is compacted
+  uint16_t count; // elements following the command
+  uint16_t color;
+  uint32_t size; // bytes of the command including its elements
+  Rect bounds;   // every pixel the command writes is inside of this, already clipped
+};
+
+struct DisplayList::BitmapCommand : Command {
+  Rect area;        // where the whole bitmap or sprite is drawn
+  Rect clip;        // clip rectangle while it was recorded
+  const void *data; // the bitmap or sprite
+  Bitmap::BitmapFormat format;
+  Flags flags;
+};
+
+// commands start on multiples of this so they can be accessed in place
+static constexpr size_t ALIGNMENT = alignof(void *) > alignof(uint32_t) ? alignof(void *) : alignof(uint32_t);
+
+static constexpr size_t align(size_t bytes) { return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+// elements of points and spans commands are packed right after the command
+const size_t DisplayList::ELEMENTS_OFFSET = align(sizeof(Command));
+
+static bool contains(Rect outer, Rect inner) {
+  return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width &&
+         inner.y + inner.height <= outer.y + outer.height;
+}
+
+static Rect unite(Rect a, Rect b) {
+  int32_t left = a.x < b.x ? a.x : b.x;
+  int32_t top = a.y < b.y ? a.y : b.y;
+  int32_t right = a.x + a.width > b.x + b.width ? a.x + a.width : b.x + b.width;
+  int32_t bottom = a.y + a.height > b.y + b.height ? a.y + a.height : b.y + b.height;
+  return {(int16_t)left, (int16_t)top, (uint16_t)(right - left), (uint16_t)(bottom - top)};
+}
+
+DisplayList::DisplayList(uint16_t width, uint16_t height, size_t capacity, ::Display::Driver::Memory memory)
+    : width(width), height(height), capacity(capacity) {
+  commands = ::Display::Driver::allocateMemory(capacity, memory);
+}
+
+DisplayList::~DisplayList() { ::Display::Driver::freeMemory(commands); }
+
+void DisplayList::reset() {
+  used = 0;
+  last = SIZE_MAX;
+  overflowed = false;
+}
+
+uint16_t DisplayList::getCommandCount() {
+  uint16_t count = 0;
+  for (Command *command = next(nullptr); command != nullptr; command = next(command))
+    count += command->removed ? 0 : 1;
+  return count;
+}
+
+DisplayList::Command *DisplayList::next(Command *command) {
+  size_t offset = command == nullptr ? 0 : ((uint8_t *)command - commands) + command->size;
+  return offset < used ? (Command *)(commands + offset) : nullptr;
+}
+
+DisplayList::Command *DisplayList::append(CommandType type, size_t size, Rect bounds) {
+  if (overflowed || commands == nullptr || used + align(size) > capacity) {
+    overflowed = true; // later commands would be drawn without the ones before them
+    return nullptr;
+  }
+
+  memset(commands + used, 0, size);
+  Command *command = (Command *)(commands + used);
+  command->type = type;
+  command->size = align(size);
+  command->bounds = bounds;
+
+  last = used;
+  used += command->size;
+  return command;
+}
+
+void DisplayList::appendElement(CommandType type, uint16_t color, const void *element, size_t elementSize,
+                                Rect bounds) {
+  Command *command = last != SIZE_MAX ? (Command *)(commands + last) : nullptr;
+
+  if (command != nullptr && command->type == type && command->color == color && !command->removed &&
+      command->count < UINT16_MAX) {
+    size_t size = align(ELEMENTS_OFFSET + ((command->count + 1) * elementSize));
+    if (!overflowed && last + size <= capacity) {
+      memcpy((uint8_t *)command + ELEMENTS_OFFSET + (command->count * elementSize), element, elementSize);
+      command->count++;
+      command->size = size;
+      command->bounds = unite(command->bounds, bounds);
+      used = last + size;
+      return;
+    }
+  }
+
+  command = append(type, ELEMENTS_OFFSET + elementSize, bounds);
+  if (command == nullptr)
+    return;
+
+  command->color = color;
+  command->count = 1;
+  memcpy((uint8_t *)command + ELEMENTS_OFFSET, element, elementSize);
+}
+
+esp_err_t DisplayList::initializeDisplay() {
+  if (commands == nullptr)
+    return ESP_ERR_NO_MEM;
+
+  reset();
+  return ESP_OK;
+}
+
+esp_err_t DisplayList::clearBuffer() {
+  append(CommandType::CLEAR, sizeof(Command), {0, 0, width, height});
+  return overflowed ? ESP_ERR_NO_MEM : ESP_OK;
+}
+
+void DisplayList::setBufferPixel(int16_t x, int16_t y, uint16_t color) {
+  ColoredPoint point = {x, y, color};
+  setBufferPixels(&point, 1);
+}
+
+void DisplayList::setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) {
+  if (!cropBlock(x, y, width, height))
+    return; // no overlap between block and the clip rectangle
+
+  Command *command = append(CommandType::BLOCK, sizeof(Command), {x, y, width, height});
+  if (command != nullptr)
+    command->color = color;
+}
+
+void DisplayList::setBufferPixels(const Point *points, size_t count, uint16_t color) {
+  Rect clip = getClip();
+  for (size_t i = 0; i < count; i++) {
+    if ((uint32_t)(points[i].x - clip.x) < clip.width && (uint32_t)(points[i].y - clip.y) < clip.height)
+      appendElement(CommandType::POINTS, color, &points[i], sizeof(Point), {points[i].x, points[i].y, 1, 1});
+  }
+}
+
+void DisplayList::setBufferPixels(const ColoredPoint *points, size_t count) {
+  Rect clip = getClip();
+  for (size_t i = 0; i < count; i++) {
+    if ((uint32_t)(points[i].x - clip.x) < clip.width && (uint32_t)(points[i].y - clip.y) < clip.height)
+      appendElement(CommandType::COLORED_POINTS, 0, &points[i], sizeof(ColoredPoint),
+                    {points[i].x, points[i].y, 1, 1});
+  }
+}
+
+void DisplayList::setBufferSpans(const Span *spans, size_t count, uint16_t color) {
+  Rect clip = getClip();
+  for (size_t i = 0; i < count; i++) {
+    Rect span = Rect{spans[i].x, spans[i].y, spans[i].width, 1}.intersect(clip);
+    if (span.isEmpty())
+      continue;
+
+    Span cropped = {span.x, span.y, span.width};
+    appendElement(CommandType::SPANS, color, &cropped, sizeof(Span), span);
+  }
+}
+
+void DisplayList::writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, const void *bitmap,
+                                      Bitmap::BitmapFormat format, uint16_t color, Flags flags) {
+  Rect area = {x, y, width, height};
+  Rect bounds = area.intersect(getClip());
+  if (bounds.isEmpty())
+    return;
+
+  BitmapCommand *command = (BitmapCommand *)append(CommandType::BITMAP, sizeof(BitmapCommand), bounds);
+  if (command == nullptr)
+    return;
+
+  command->color = color;
+  command->area = area;
+  command->clip = getClip();
+  command->data = bitmap;
+  command->format = format;
+  command->flags = flags;
+}
+
+void DisplayList::writeSpriteToBuffer(int16_t x, int16_t y, const Sprite &sprite, Flags flags) {
+  Rect area = {x, y, sprite.getWidth(), sprite.getHeight()};
+  Rect bounds = area.intersect(getClip());
+  if (bounds.isEmpty())
+    return;
+
+  BitmapCommand *command = (BitmapCommand *)append(CommandType::SPRITE, sizeof(BitmapCommand), bounds);
+  if (command == nullptr)
+    return;
+
+  command->area = area;
+  command->clip = getClip();
+  command->data = &sprite;
+  command->flags = flags;
+}
+
+bool DisplayList::isOpaque(Command *command) {
+  switch (command->type) {
+  case CommandType::CLEAR:
+  case CommandType::BLOCK:
+    return true;
+  case CommandType::BITMAP:
+  case CommandType::SPRITE:
+    return !((BitmapCommand *)command)->flags.transparent;
+  default:
+    return false;
+  }
+}
+
+void DisplayList::optimize() {
+  if (overflowed)
+    return;
+
+  // merge blocks into the block right before them when together they are still a block of one color, e.g. the rows of
+  // a menu
+  Command *previous = nullptr;
+  for (Command *command = next(nullptr); command != nullptr; command = next(command)) {
+    if (command->removed)
+      continue;
+
+    if (previous != nullptr && previous->type == CommandType::BLOCK && command->type == CommandType::BLOCK &&
+        previous->color == command->color) {
+      Rect a = previous->bounds, b = command->bounds;
+      bool stacked = a.x == b.x && a.width == b.width && (a.y + a.height == b.y || b.y + b.height == a.y);
+      bool sideBySide = a.y == b.y && a.height == b.height && (a.x + a.width == b.x || b.x + b.width == a.x);
+      if (stacked || sideBySide) {
+        previous->bounds = unite(a, b);
+        command->removed = true;
+        continue;
+      }
+    }
+
+    previous = command;
+  }
+
+  // Drop every command that a later opaque command paints over entirely. Whatever is drawn in between can't show
+  // through it either, so the pixels of the frame stay the same.
+  for (Command *command = next(nullptr); command != nullptr; command = next(command)) {
+    for (Command *later = next(command); later != nullptr && !command->removed; later = next(later)) {
+      if (!later->removed && isOpaque(later) &&
+          (later->type == CommandType::CLEAR || contains(later->bounds, command->bounds)))
+        command->removed = true;
+    }
+  }
+
+  // compact the buffer, moving the remaining commands over the dropped ones
+  size_t offset = 0, kept = 0;
+  last = SIZE_MAX;
+  while (offset < used) {
+    Command *command = (Command *)(commands + offset);
+    size_t size = command->size;
+
+    if (!command->removed) {
+      if (kept != offset)
+        memmove(commands + kept, command, size);
+
+      last = kept;
+      kept += size;
+    }
+
+    offset += size;
+  }
+  used = kept;
+}
+
+void DisplayList::drawBitmapCommand(::Display::Driver::Driver *driver, BitmapCommand *command, Rect clip) {
+  Rect commandClip = command->clip.intersect(clip);
+  if (commandClip.isEmpty())
+    return;
+
+  // bitmaps are cropped while they are drawn, so the clip they were recorded with is restored for them
+  driver->setClip(commandClip);
+
+  Rect area = command->area;
+  if (command->type == CommandType::SPRITE) {
+    driver->writeSpriteToBuffer(area.x, area.y, *(const Sprite *)command->data, command->flags);
+  } else {
+    driver->writeBitmapToBuffer(area.x, area.y, area.width, area.height, command->data, command->format,
+                                command->color, command->flags);
+  }
+
+  driver->setClip(clip);
+}
+
+esp_err_t DisplayList::replay(Display &display) {
+  if (overflowed)
+    return ESP_ERR_NO_MEM;
+
+  ::Display::Driver::Driver *driver = display.driver;
+  Rect clip = driver->getClip();
+
+  for (Command *command = next(nullptr); command != nullptr; command = next(command)) {
+    if (command->removed)
+      continue;
+
+    // skip commands outside of the clip, e.g. of the band that is rendered, but clears ignore it
+    Rect bounds = command->bounds;
+    if (command->type != CommandType::CLEAR && bounds.intersect(clip).isEmpty())
+      continue;
+
+    const void *elements = (uint8_t *)command + ELEMENTS_OFFSET;
+
+    switch (command->type) {
+    case CommandType::CLEAR:
+      driver->clearBuffer();
+      break;
+    case CommandType::BLOCK:
+      driver->setBufferBlock(bounds.x, bounds.y, bounds.width, bounds.height, command->color);
+      break;
+    case CommandType::POINTS:
+      driver->setBufferPixels((const Point *)elements, command->count, command->color);
+      break;
+    case CommandType::COLORED_POINTS:
+      driver->setBufferPixels((const ColoredPoint *)elements, command->count);
+      break;
+    case CommandType::SPANS:
+      driver->setBufferSpans((const Span *)elements, command->count, command->color);
+      break;
+    case CommandType::BITMAP:
+    case CommandType::SPRITE:
+      drawBitmapCommand(driver, (BitmapCommand *)command, clip);
+      break;
+    }
+  }
+
+  return ESP_OK;
+}
+
+void DisplayList::printBuffer() {
+  static const char *NAMES[] = {"clear", "block", "points", "colored points", "spans", "bitmap", "sprite"};
+
+  for (Command *command = next(nullptr); command != nullptr; command = next(command)) {
+    Rect bounds = command->bounds;
+    printf("%s%s (%d, %d, %u, %u) count %u color %x\n", command->removed ? "removed " : "",
+           NAMES[(uint8_t)command->type], bounds.x, bounds.y, bounds.width, bounds.height, command->count,
+           command->color);
+  }
+}
+
+} // namespace Display
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "Display.hpp"
+
+namespace Display {
+
+// 8x8 Bayer matrix, every value from 0 to 63 once so neighboring thresholds are as far apart as possible
+static const uint8_t BAYER[8][8] = {
+    {0, 32, 8, 40, 2, 34, 10, 42},  {48, 16, 56, 24, 50, 18, 58, 26}, {12, 44, 4, 36, 14, 46, 6, 38},
+    {60, 28, 52, 20, 62, 30, 54, 22}, {3, 35, 11, 43, 1, 33, 9, 41},  {51, 19, 59, 27, 49, 17, 57, 25},
+    {15, 47, 7, 39, 13, 45, 5, 37},  {63, 31, 55, 23, 61, 29, 53, 21},
+};
+
+Ditherer::Ditherer(Method method, Bitmap::BitmapFormat format, uint16_t maxWidth, Driver::Memory memory)
+    : method(method), format(format), maxWidth(maxWidth) {
+  size_t errorBytes = ((size_t)maxWidth + 2) * sizeof(int16_t);
+  size_t rowBytes = (((size_t)maxWidth * Bitmap::bitsPerPixel(format)) + 7) / 8;
+
+  // a single allocation for both, the errors first to keep them aligned
+  uint8_t *memoryBlock = Driver::allocateMemory(errorBytes + rowBytes, memory);
+  if (memoryBlock == nullptr)
+    return;
+
+  errors = (int16_t *)memoryBlock;
+  row = memoryBlock + errorBytes;
+}
+
+Ditherer::~Ditherer() { Driver::freeMemory(errors); }
+
+void Ditherer::reset() {
+  if (errors != nullptr)
+    memset(errors, 0, ((size_t)maxWidth + 2) * sizeof(int16_t));
+}
+
+void Ditherer::ditherRow(const uint8_t *grays, uint16_t width, uint16_t y) {
+  uint8_t bits = Bitmap::bitsPerPixel(format);
+  int16_t brightest = (1 << bits) - 1;
+
+  uint8_t byte = 0;
+  uint8_t shift = 8;
+  uint8_t *out = row;
+
+  if (method == Method::ORDERED) {
+    const uint8_t *thresholds = BAYER[y % 8];
+
+    for (uint16_t x = 0; x < width; x++) {
+      // rounds down to a level and up to the next one where the remainder is above the threshold of the pixel
+      uint16_t scaled = grays[x] * brightest;
+      uint8_t level = scaled / 255;
+      if (scaled % 255 > ((thresholds[x % 8] * 255) + 127) / 64)
+        level++;
+
+      shift -= bits;
+      byte |= level << shift;
+      if (shift == 0) {
+        *out++ = byte;
+        byte = 0;
+        shift = 8;
+      }
+    }
+  } else {
+    // errors[x + 1] belongs to pixel x, the errors for the row below are written behind the current pixel
+    int16_t carry = 0, pending = 0;
+
+    for (uint16_t x = 0; x < width; x++) {
+      int16_t value = grays[x] + errors[x + 1] + carry;
+
+      int16_t level = ((value * brightest) + 127) / 255;
+      if (level < 0)
+        level = 0;
+      else if (level > brightest)
+        level = brightest;
+
+      int16_t error = value - ((level * 255) / brightest);
+      carry = (error * 7) / 16;
+      errors[x] += (error * 3) / 16;
+      errors[x + 1] = ((error * 5) / 16) + pending;
+      pending = error / 16;
+
+      shift -= bits;
+      byte |= level << shift;
+      if (shift == 0) {
+        *out++ = byte;
+        byte = 0;
+        shift = 8;
+      }
+    }
+
+    errors[width + 1] = pending;
+  }
+
+  if (shift != 8)
+    *out = byte;
+}
+
+// rows of a gray buffer for the callback of drawDithered
+struct GrayBuffer {
+  const uint8_t *grays;
+  uint16_t width;
+};
+
+static const uint8_t *grayBufferRow(uint16_t row, void *arg) {
+  GrayBuffer *buffer = (GrayBuffer *)arg;
+  return buffer->grays + ((size_t)row * buffer->width);
+}
+
+esp_err_t Display::drawDithered(Origin::Object2D origin, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                                const uint8_t *grays, Ditherer &ditherer, Flags flags) {
+  GrayBuffer buffer = {grays, width};
+  return drawDithered(origin, x, y, width, height, grayBufferRow, &buffer, ditherer, flags);
+}
+
+esp_err_t Display::drawDithered(Origin::Object2D origin, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                                GrayRowCallback rows, void *arg, Ditherer &ditherer, Flags flags) {
+  if (ditherer.getRow() == nullptr)
+    return ESP_ERR_NO_MEM;
+  if (width > ditherer.getMaxWidth())
+    return ESP_ERR_INVALID_SIZE;
+
+  shiftOrigin2DToTopLeft(origin, x, y, width, height);
+
+  // rows outside of the clip are neither requested nor dithered, errors spread from the first visible row on
+  Rect visible = Rect{x, y, width, height}.intersect(getClip());
+  if (visible.isEmpty())
+    return ESP_OK;
+
+  ditherer.reset();
+  for (int16_t row = visible.y; row < visible.y + visible.height; row++) {
+    ditherer.ditherRow(rows(row - y, arg), width, row - y);
+    driver->writeBitmapToBuffer(x, row, width, 1, ditherer.getRow(), ditherer.getFormat(), 0xffff, flags);
+  }
+
+  return ESP_OK;
+}
+
+} // namespace Display
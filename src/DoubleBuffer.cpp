@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "Driver.hpp"
+
+namespace Display::Driver {
+
+esp_err_t Driver::enableDoubleBuffering(uint8_t *secondBuffer) {
+  if (secondBuffer == nullptr)
+    return ESP_ERR_INVALID_ARG;
+
+  if (buffer == nullptr)
+    return ESP_ERR_NOT_SUPPORTED; // driver doesn't draw through a swappable buffer
+
+  esp_err_t err = waitForTransfer();
+  if (err != ESP_OK)
+    return err;
+
+  // both buffers have to start out identical, after that only damaged regions are copied on each swap
+  memcpy(secondBuffer, buffer, getBufferSize());
+  backBuffer = secondBuffer;
+
+  return ESP_OK;
+}
+
+void Driver::copyDamage(uint8_t *from, uint8_t *to, const DamageMap &regions) {
+  uint8_t bits = Bitmap::bitsPerPixel(getBufferFormat());
+  uint32_t rowPixels = getBufferStride();
+
+  // copying whole bytes is fine since both buffers agree outside of the damaged regions, rows of formats below 8 bits
+  // needn't start on a byte
+  for (uint8_t i = 0; i < regions.size(); i++) {
+    const Rect &rect = regions[i];
+    size_t firstBit = (((size_t)rect.y * rowPixels) + rect.x) * bits;
+
+    for (uint16_t row = 0; row < rect.height; row++) {
+      size_t offset = firstBit / 8;
+      size_t bytes = ((firstBit + ((size_t)rect.width * bits) - 1) / 8) - offset + 1;
+      memcpy(to + offset, from + offset, bytes);
+      firstBit += rowPixels * bits;
+    }
+  }
+}
+
+esp_err_t Driver::sendBufferToDisplayAsync() {
+  esp_err_t err;
+
+  if (backBuffer == nullptr) { // single buffered, nothing to overlap the transfer with
+    err = sendBufferToDisplay();
+    if (err != ESP_OK)
+      return err;
+
+    notifyTransferComplete();
+    return ESP_OK;
+  }
+
+  // the back buffer belongs to the previous transfer until it has finished
+  err = waitForTransfer();
+  if (err != ESP_OK)
+    return err;
+
+  // nothing to send, but the frame still counts as sent like in the single buffered case
+  if (damage.isEmpty()) {
+    notifyTransferComplete();
+    return ESP_OK;
+  }
+
+  uint8_t *frame = buffer;
+  buffer = backBuffer;
+  backBuffer = frame;
+
+  // the new drawing buffer is one frame behind, the regions damaged in this frame are the only ones that differ
+  copyDamage(frame, buffer, damage);
+
+  transferDamage = damage;
+  damage.clear();
+
+  err = queueBufferTransfer(frame, transferDamage);
+  if (err != ESP_OK) {
+    // keep the frame's regions damaged so the next send retries them
+    for (uint8_t i = 0; i < transferDamage.size(); i++)
+      damage.add(transferDamage[i]);
+    return err;
+  }
+
+  transferPending = true;
+  return ESP_OK;
+}
+
+esp_err_t Driver::sendRowsToDisplayAsync(uint8_t *rows, int16_t y, uint16_t height) {
+  if (rows == nullptr || y < 0 || height == 0 || y + height > getHeight())
+    return ESP_ERR_INVALID_ARG;
+
+  if (quarterTurn)
+    return ESP_ERR_NOT_SUPPORTED;
+
+  // one transfer at a time, once it's done the rows sent before these can be drawn to again
+  esp_err_t err = waitForTransfer();
+  if (err != ESP_OK)
+    return err;
+
+  err = queueRowsTransfer(rows, y, height);
+  if (err != ESP_OK)
+    return err;
+
+  transferPending = true;
+  return ESP_OK;
+}
+
+esp_err_t Driver::queueRowsTransfer(uint8_t *rows, int16_t y, uint16_t height) {
+  transferDamage.clear();
+  transferDamage.add({0, y, getWidth(), height});
+
+  // where the frame would start if the rows were part of it, only the damaged rows are read through it
+  uint8_t *frame = rows - (((size_t)y * getBufferStride() * Bitmap::bitsPerPixel(getBufferFormat())) / 8);
+  return queueBufferTransfer(frame, transferDamage);
+}
+
+esp_err_t Driver::waitForTransfer(TickType_t timeout) {
+  if (!transferPending)
+    return ESP_OK;
+
+  esp_err_t err = waitForBufferTransfer(timeout);
+  if (err != ESP_OK)
+    return err;
+
+  transferPending = false;
+  return ESP_OK;
+}
+
+} // namespace Display::Driver
@@ -2,188 +2,117 @@
 //
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include <cstring>
+
 #include "Driver.hpp"
 #include "Display.hpp"
 
 namespace Display::Driver {
 
-bool Driver::cropBlock(int16_t &x, int16_t &y, uint16_t &width, uint16_t &height) {
-  if (x > (getWidth() - 1) || y > (getHeight() - 1) || x + width - 1 < 0 || y + height - 1 < 0)
-    return false;
+// word for filling spans, 32 bits on the ESP32s and 64 bits on most hosts, may alias the byte buffers it is stored to
+typedef uintptr_t __attribute__((__may_alias__)) FillWord;
 
-  if (x < 0) {
-    width += x;
-    x = 0;
+// Fills `bytes` bytes with `value`. Bytes are only stored one at a time up to the first word boundary and after the
+// last one, everything in between is stored a whole word at a time.
+static inline void fillBytes(uint8_t *destination, uint8_t value, size_t bytes) {
+  while (bytes > 0 && (uintptr_t)destination % sizeof(FillWord) != 0) {
+    *destination++ = value;
+    bytes--;
   }
 
-  if ((x + width - 1) > (getWidth() - 1)) {
-    width = getWidth() - x;
-  }
+  FillWord pattern = ((FillWord)~(FillWord)0 / 0xff) * value; // value repeated in every byte of the word
+  FillWord *words = (FillWord *)destination;
+  for (size_t i = 0; i < bytes / sizeof(FillWord); i++)
+    words[i] = pattern;
 
-  if (y < 0) {
-    height += y;
-    y = 0;
-  }
+  destination += bytes - (bytes % sizeof(FillWord));
+  for (size_t i = 0; i < bytes % sizeof(FillWord); i++)
+    destination[i] = value;
+}
 
-  if ((y + height - 1) > (getWidth() - 1)) {
-    height = getWidth() - y;
-  }
+bool Driver::cropBlock(int16_t &x, int16_t &y, uint16_t &width, uint16_t &height) {
+  Rect block = Rect{x, y, width, height}.intersect(getClip());
+  if (block.isEmpty())
+    return false;
 
+  x = block.x;
+  y = block.y;
+  width = block.width;
+  height = block.height;
   return true;
 }
 
-void Driver::write1BitBitmapTo4BitBuffer(uint8_t *bitmap, uint16_t color, uint8_t *buffer, int16_t x, int16_t y,
-                                         uint16_t width, uint16_t height, Flags flags) {
-  uint16_t bitmapX = 0, bitmapY = 0, bitmapWidth = width;
-
-  if (flags.erase) {
-    color = 0x0;
-  }
-
-  if (x < 0)
-    bitmapX -= x; // left edge of bitmap is off screen
-
-  if (y < 0)
-    bitmapY -= y; // top edge of bitmap is off screen
-
-  if (!cropBlock(x, y, width, height))
-    return; // no overlap between bitmap and screen
-
-  // set screen cursor to the position where the bitmap will be written
-  buffer += (y * getWidth() + x) / 2;
-
-  // precompute colors
-  uint8_t lowNibbleColor = 0x0f & color;
-  uint8_t highNibbleColor = 0xf0 & (color << 4);
-
-  // set bitmap cursor to the beginning of the part of the bitmap we want to
-  // write
-  bitmap += (bitmapY * bitmapWidth + bitmapX) / 8;
-
-  // left edge is the low nibble of a uint8_t buffer entry
-  bool splitLeft = x % 2 != 0;
-
-  // right edge is the high nibble of a uint8_t buffer entry
-  bool splitRight = (x + width - 1) % 2 == 0;
-
-  // number of unsplit bytes in each row to write
-  uint16_t innerBytes = (width - (splitLeft ? 1 : 0) - (splitRight ? 1 : 0)) / 2;
-
-  //                                   bitmap width
-  //                   |-------------------------------------------|
-  //    buffer ->  ________ ________ ________ ________ ________ ________
-  //
-  //                   |--| |---------------------------------| |--|
-  //                    ^                                         ^
-  //  splitLeft = true _|             innerBytes = 4              |_ splitRight
-  //  = true
-
-  uint16_t bufferWrapDistance = (getWidth() / 2) - innerBytes - (splitLeft ? 1 : 0) - (splitRight ? 1 : 0);
-  uint16_t bitmapWrapDistance = ((bitmapWidth - width) / 8);
-  uint16_t bitmapWrapRemainder = ((bitmapWidth - width) % 8);
-
-  uint8_t bit = 7 - (bitmapY * bitmapWidth + bitmapX) % 8; // zero indexed
-  for (int16_t j = 0; j < height; j++) {
-
-    if (splitLeft) { // fill left edge
-
-      if (((*bitmap >> bit) & 0b1) != 0) {
-        *buffer = (*buffer & 0xf0) | lowNibbleColor;
-      } else {
-        if (!flags.transparent) {
-          *buffer &= 0xf0;
-        }
-      }
-
-      buffer++;
-
-      if (bit == 0) {
-        bitmap++;
-        bit = 7;
-      } else {
-        bit--;
-      }
-    }
-
-    for (int16_t i = 0; i < innerBytes; i++) { // fill inner span
+void Driver::turnBlock(int16_t &x, int16_t &y, uint16_t &width, uint16_t &height) {
+  int16_t column = getWidth() - y - height; // the bottom row of the block becomes its left column
+  y = x;
+  x = column;
 
-      // high nibble
-      if (((*bitmap >> bit) & 0b1) != 0) {
-        *buffer = (*buffer & 0x0f) | highNibbleColor;
-      } else {
-        if (!flags.transparent) {
-          *buffer &= 0x0f;
-        }
-      }
-
-      if (bit == 0) {
-        bitmap++;
-        bit = 7;
-      } else {
-        bit--;
-      }
-
-      // low nibble
-      if (((*bitmap >> bit) & 0b1) != 0) {
-        *buffer = (*buffer & 0xf0) | lowNibbleColor;
-      } else {
-        if (!flags.transparent) {
-          *buffer &= 0xf0;
-        }
-      }
-
-      if (bit == 0) {
-        bitmap++;
-        bit = 7;
-      } else {
-        bit--;
-      }
+  uint16_t rows = width;
+  width = height;
+  height = rows;
+}
 
-      buffer++;
-    }
+static inline uint8_t getNibble(const uint8_t *buffer, uint16_t bytesPerRow, uint16_t x, uint16_t y) {
+  uint8_t pixels = buffer[(y * bytesPerRow) + (x / 2)];
+  return x % 2 == 0 ? pixels >> 4 : pixels & 0x0f;
+}
 
-    if (splitRight) { // fill right edge
+static inline void setNibble(uint8_t *buffer, uint16_t bytesPerRow, uint16_t x, uint16_t y, uint8_t color) {
+  uint8_t &pixels = buffer[(y * bytesPerRow) + (x / 2)];
+  pixels = x % 2 == 0 ? (pixels & 0x0f) | (color << 4) : (pixels & 0xf0) | color;
+}
 
-      if (((*bitmap >> bit) & 0b1) != 0) {
-        *buffer = (*buffer & 0x0f) | highNibbleColor;
-      } else {
-        if (!flags.transparent) {
-          *buffer &= 0x0f;
-        }
-      }
+esp_err_t Driver::setQuarterTurn(bool enabled) {
+  if (enabled == quarterTurn)
+    return ESP_OK;
 
-      buffer++;
+  uint16_t size = getWidth();
+  if (size != getHeight())
+    return ESP_ERR_NOT_SUPPORTED; // the turned frame wouldn't fit the buffer
 
-      if (bit == 0) {
-        bitmap++;
-        bit = 7;
-      } else {
-        bit--;
-      }
-    }
+  if (buffer == nullptr) { // drivers without a frame buffer only keep track of the turn
+    quarterTurn = enabled;
+    return ESP_OK;
+  }
 
-    buffer += bufferWrapDistance;
-    bitmap += bitmapWrapDistance;
-    if (bitmapWrapRemainder > bit) {
-      bitmap++;
-      bit += 8 - bitmapWrapRemainder;
-    } else {
-      bit -= bitmapWrapRemainder;
+  // Turn the buffer in place, clockwise when quarter turns are switched on and back otherwise. Every pixel of the top
+  // left quarter starts a cycle of four pixels that trade places.
+  uint16_t bytesPerRow = size / 2, last = size - 1;
+  for (uint16_t y = 0; y < size / 2; y++) {
+    for (uint16_t x = y; x < last - y; x++) {
+      uint16_t cycle[4][2] = {{x, y}, {(uint16_t)(last - y), x}, {(uint16_t)(last - x), (uint16_t)(last - y)},
+                              {y, (uint16_t)(last - x)}};
+      uint8_t colors[4];
+      for (uint8_t i = 0; i < 4; i++)
+        colors[i] = getNibble(buffer, bytesPerRow, cycle[i][0], cycle[i][1]);
+
+      // clockwise every pixel moves on to the next one of the cycle
+      for (uint8_t i = 0; i < 4; i++)
+        setNibble(buffer, bytesPerRow, cycle[i][0], cycle[i][1], colors[(i + (enabled ? 3 : 1)) % 4]);
     }
   }
-};
+
+  quarterTurn = enabled;
+  markAllDamaged();
+  return ESP_OK;
+}
 
 void Driver::write4BitColorTo4BitBuffer(uint16_t color, uint8_t *buffer, int16_t x, int16_t y, uint16_t width,
                                         uint16_t height, Flags flags) {
   if (!cropBlock(x, y, width, height))
     return; // no overlap between block and screen
 
+  if (quarterTurn)
+    turnBlock(x, y, width, height); // a turned block is still a block
+
+  markDamaged(x, y, width, height);
+
   if (flags.erase) {
     color = 0x0;
   }
 
   // increment to top left corner of the cropped block
-  buffer += (y * getWidth() + x) / 2;
+  buffer += (y * getBufferStride() + x) / 2;
 
   // precompute colors
   uint8_t lowNibbleColor = 0x0f & color;
@@ -200,7 +129,12 @@ void Driver::write4BitColorTo4BitBuffer(uint16_t color, uint8_t *buffer, int16_t
 
   // distance to increment buffer to wrap from end of block to beginning of
   // block on next line
-  uint16_t wrapDistance = (getWidth() / 2) - innerBytes - (splitLeft ? 1 : 0) - (splitRight ? 1 : 0);
+  uint16_t wrapDistance = (getBufferStride() / 2) - innerBytes - (splitLeft ? 1 : 0) - (splitRight ? 1 : 0);
+
+  if (wrapDistance == 0 && !splitLeft && !splitRight) { // full rows are contiguous, e.g. a full screen fill
+    fillBytes(buffer, innerColor, (size_t)innerBytes * height);
+    return;
+  }
 
   for (int16_t j = 0; j < height; j++) {
 
@@ -209,10 +143,8 @@ void Driver::write4BitColorTo4BitBuffer(uint16_t color, uint8_t *buffer, int16_t
       buffer++;
     }
 
-    for (int16_t i = 0; i < innerBytes; i++) { // fill inner span
-      *buffer = innerColor;
-      buffer++;
-    }
+    fillBytes(buffer, innerColor, innerBytes); // fill inner span
+    buffer += innerBytes;
 
     if (splitRight) { // fill right edge
       *buffer = (*buffer & 0x0f) | highNibbleColor;
@@ -223,254 +155,51 @@ void Driver::write4BitColorTo4BitBuffer(uint16_t color, uint8_t *buffer, int16_t
   }
 };
 
-void Driver::write4BitBitmapTo4BitBuffer(uint8_t *bitmap, uint8_t *buffer, int16_t x, int16_t y, uint16_t width,
-                                         uint16_t height, Flags flags) {
-  uint16_t bitmapX = 0, bitmapY = 0, bitmapWidth = width;
-
-  if (x < 0)
-    bitmapX -= x; // left edge of bitmap is off screen
+uint16_t Driver::toBufferColor(uint16_t color, Bitmap::BitmapFormat bufferFormat) {
+  uint8_t bits = Bitmap::bitsPerPixel(bufferFormat);
+  if (bufferFormat == Bitmap::MONOCHROME)
+    return (color & 0x0f) != 0 ? 1 : 0; // like 4 bit colors on the monochrome canvases
 
-  if (y < 0)
-    bitmapY -= y; // top edge of bitmap is off screen
+  return bits == 16 ? color : color & ((1 << bits) - 1);
+}
 
+void Driver::writeColorToBuffer(uint16_t color, uint8_t *buffer, Bitmap::BitmapFormat bufferFormat, int16_t x,
+                                int16_t y, uint16_t width, uint16_t height) {
   if (!cropBlock(x, y, width, height))
-    return; // no overlap between bitmap and screen
+    return; // no overlap between block and the clip rectangle
 
-  // set screen cursor to the position where the bitmap will be written
-  buffer += (y * getWidth() + x) / 2;
+  if (quarterTurn)
+    turnBlock(x, y, width, height); // a turned block is still a block
 
-  // set bitmap cursor to the beginning of the part of the bitmap we want to
-  // write
-  bitmap += (bitmapY * bitmapWidth + bitmapX) / 2;
+  markDamaged(x, y, width, height);
 
-  // left edge is the low nibble of a uint8_t buffer entry
-  bool splitLeft = x % 2 != 0;
+  color = toBufferColor(color, bufferFormat);
+  uint8_t bits = Bitmap::bitsPerPixel(bufferFormat);
+  uint32_t rowPixel = ((uint32_t)y * getBufferStride()) + x;
 
-  // right edge is the high nibble of a uint8_t buffer entry
-  bool splitRight = (x + width - 1) % 2 == 0;
+  for (uint16_t j = 0; j < height; j++) {
+    if (bits == 16) {
+      uint8_t *pixels = buffer + (2 * rowPixel);
+      for (uint16_t i = 0; i < width; i++) {
+        pixels[2 * i] = color >> 8;
+        pixels[(2 * i) + 1] = color;
+      }
+    } else {
+      // pixels up to the first whole byte and after the last one are set one at a time
+      uint8_t pixelsPerByte = 8 / bits;
+      uint32_t pixel = rowPixel, end = rowPixel + width;
+      for (; pixel < end && pixel % pixelsPerByte != 0; pixel++)
+        Bitmap::setPixel(buffer, bufferFormat, pixel, color);
 
-  // number of unsplit bytes in each row to write
-  uint16_t innerBytes = (width - (splitLeft ? 1 : 0) - (splitRight ? 1 : 0)) / 2;
+      uint32_t bytes = (end - pixel) / pixelsPerByte;
+      fillBytes(buffer + (pixel / pixelsPerByte), color * (0xff / ((1 << bits) - 1)), bytes);
 
-  //                                   bitmap width
-  //                   |-------------------------------------------|
-  //    buffer ->  ________ ________ ________ ________ ________ ________
-  //
-  //                   |--| |---------------------------------| |--|
-  //                    ^                                         ^
-  //  splitLeft = true _|             innerBytes = 4              |_ splitRight
-  //  = true
-
-  // compute same flags for bitmap range
-  bool bitmapSplitLeft = bitmapX % 2 != 0;
-  bool bitmapSplitRight = (bitmapX + width - 1) % 2 == 0;
-
-  // do inner bytes of bitmap and buffer align
-  bool unaligned = splitLeft != bitmapSplitLeft;
-
-  // unaligned = true: inner bytes of buffer and bitmap don't line up, even if
-  // one or both ends do
-  //   bitmap ->  -------- -------- -------- -------- -------- --------
-  //   buffer ->  ---- -------- -------- -------- -------- -------- --------
-  //
-  // unaligned = false: inner bytes of buffer and bitmap do line up, even if one
-  // or both ends don't
-  //   bitmap ->  -------- -------- -------- -------- -------- --------
-  //   buffer ->      ---- -------- -------- -------- -------- ----
-  //
-  // distance to increment buffer/bitmap to wrap from end of block to beginning
-  // of block on next line
-
-  uint16_t bufferWrapDistance = (getWidth() / 2) - innerBytes - (splitLeft ? 1 : 0) - (splitRight ? 1 : 0);
-  uint16_t bitmapWrapDistance = (bitmapWidth / 2) - innerBytes - (bitmapSplitLeft ? 1 : 0) - (bitmapSplitRight ? 1 : 0);
-
-  if (!flags.erase) {
-    if (unaligned) { // we have to bitshift all copies
-      for (int16_t j = 0; j < height; j++) {
-
-        if (splitLeft) { // fill left edge, we can assume the bitmapSplitLeft ==
-                         // false
-          if (*bitmap >> 4 != 0) {
-            *buffer = (*buffer & 0xf0) | (*bitmap >> 4);
-          } else {
-            if (!flags.transparent) {
-              *buffer &= 0xf0;
-            }
-          }
-          buffer++;
-        }
-
-        for (int16_t i = 0; i < innerBytes; i++) { // fill inner span
-          // high nibble
-          if (*bitmap << 4 != 0) {
-            *buffer = (*bitmap & 0x0f) | (*bitmap << 4);
-          } else {
-            if (!flags.transparent) {
-              *buffer &= 0x0f;
-            }
-          }
-          bitmap++;
-
-          // low nibble
-          if (*bitmap >> 4 != 0) {
-            *buffer = (*bitmap & 0xf0) | (*bitmap >> 4);
-          } else {
-            if (!flags.transparent) {
-              *buffer &= 0xf0;
-            }
-          }
-          buffer++;
-        }
-
-        if (splitRight) { // fill right edge, we can assume the bitmapSplitRight
-                          // == false
-          if (*bitmap << 4 != 0) {
-            *buffer = (*buffer & 0x0f) | (*bitmap << 4);
-          } else {
-            if (!flags.transparent) {
-              *buffer &= 0x0f;
-            }
-          }
-          buffer++;
-        }
-
-        bitmap++;
-
-        buffer += bufferWrapDistance;
-        bitmap += bitmapWrapDistance;
-      }
-    } else { // we can directly copy the inner bytes
-      for (int16_t j = 0; j < height; j++) {
-
-        if (splitLeft) { // fill left edge, we can assume the bitmapSplitLeft ==
-                         // true
-          if ((*bitmap & 0x0f) != 0) {
-            *buffer = (*buffer & 0xf0) | (*bitmap & 0x0f);
-          } else {
-            if (!flags.transparent) {
-              *buffer &= 0xf0;
-            }
-          }
-
-          buffer++;
-          bitmap++;
-        }
-
-        for (int16_t i = 0; i < innerBytes; i++) { // fill inner span
-          if (flags.transparent) {
-            // high nibble
-            if ((*bitmap & 0xf0) != 0)
-              *buffer = (*buffer & 0x0f) | (*bitmap & 0xf0);
-
-            // low nibble
-            if ((*bitmap & 0x0f) != 0)
-              *buffer = (*buffer & 0xf0) | (*bitmap & 0x0f);
-          } else {
-            *buffer = *bitmap;
-          }
-
-          buffer++;
-          bitmap++;
-        }
-
-        if (splitRight) { // fill right edge, we can assume the bitmapSplitRight
-                          // == true
-          if ((*bitmap & 0xf0) != 0) {
-            *buffer = (*buffer & 0x0f) | (*bitmap & 0xf0);
-          } else {
-            if (!flags.transparent) {
-              *buffer &= 0xf;
-            }
-          }
-
-          buffer++;
-          bitmap++;
-        }
-
-        buffer += bufferWrapDistance;
-        bitmap += bitmapWrapDistance;
-      }
-    }
-  } else {
-    if (unaligned) { // we have to bitshift all copies
-      for (int16_t j = 0; j < height; j++) {
-
-        if (splitLeft) { // fill left edge, we can assume the bitmapSplitLeft ==
-                         // false
-          if (*bitmap >> 4 != 0 || !flags.transparent) {
-            *buffer &= 0xf0;
-          }
-          buffer++;
-        }
-
-        for (int16_t i = 0; i < innerBytes; i++) { // fill inner span
-          // high nibble
-          if (*bitmap << 4 != 0 || !flags.transparent) {
-            *buffer &= 0x0f;
-          }
-          bitmap++;
-
-          // low nibble
-          if (*bitmap >> 4 != 0 || !flags.transparent) {
-            *buffer &= 0xf0;
-          }
-          buffer++;
-        }
-
-        if (splitRight) { // fill right edge, we can assume the bitmapSplitRight
-                          // == false
-          if (*bitmap << 4 != 0 || !flags.transparent) {
-            *buffer &= 0x0f;
-          }
-          buffer++;
-        }
-
-        bitmap++;
-
-        buffer += bufferWrapDistance;
-        bitmap += bitmapWrapDistance;
-      }
-    } else { // we can directly copy the inner bytes
-      for (int16_t j = 0; j < height; j++) {
-
-        if (splitLeft) { // fill left edge, we can assume the bitmapSplitLeft ==
-                         // true
-          if ((*bitmap & 0x0f) != 0 || !flags.transparent) {
-            *buffer &= 0xf0;
-          }
-
-          buffer++;
-          bitmap++;
-        }
-
-        for (int16_t i = 0; i < innerBytes; i++) { // fill inner span
-          // high nibble
-          if ((*bitmap & 0xf0) != 0 || !flags.transparent)
-            *buffer = (*buffer & 0x0f);
-
-          // low nibble
-          if ((*bitmap & 0x0f) != 0 || !flags.transparent)
-            *buffer = (*buffer & 0xf0);
-
-          buffer++;
-          bitmap++;
-        }
-
-        if (splitRight) { // fill right edge, we can assume the bitmapSplitRight
-                          // == true
-          if ((*bitmap & 0xf0) != 0 || !flags.transparent) {
-            *buffer &= 0xf;
-          }
-
-          buffer++;
-          bitmap++;
-        }
-
-        buffer += bufferWrapDistance;
-        bitmap += bitmapWrapDistance;
-      }
+      for (pixel += bytes * pixelsPerByte; pixel < end; pixel++)
+        Bitmap::setPixel(buffer, bufferFormat, pixel, color);
     }
+
+    rowPixel += getBufferStride();
   }
-};
+}
 
 } // namespace Display::Driver
@@ -4,58 +4,33 @@
 
 #include "Font.hpp"
 #include "Display.hpp"
-#include "Fonts.hpp"
 
 namespace Display {
 
 namespace Font {
 
-Character::Character(uint8_t *character) {
-  code = ((uint16_t)character[CHARACTER_CODE] * 256U) + character[CHARACTER_CODE + 1];
-  bytes = ((uint16_t)character[CHARACTER_BYTES] * 256U) + character[CHARACTER_BYTES + 1];
-  deviceWidthX = character[CHARACTER_DEVICE_WIDTH_X];
-  deviceWidthY = character[CHARACTER_DEVICE_WIDTH_Y];
-  bbxWidth = character[CHARACTER_BBX_WIDTH];
-  bbxHeight = character[CHARACTER_BBX_HEIGHT];
-  bbxXOffset = character[CHARACTER_BBX_X_OFFSET];
-  bbxYOffset = character[CHARACTER_BBX_Y_OFFSET];
-
-  bitmap = character + CHARACTER_BITMAP;
-};
-
-Font::Font(uint8_t *font) {
-  size = font[FONT_SIZE];
-  numCharacters = ((uint16_t)font[FONT_CHARACTERS] * 256U) + font[FONT_CHARACTERS + 1];
-  boundingBoxWidth = font[FONT_BOUNDING_BOX_WIDTH];
-  boundingBoxHeight = font[FONT_BOUNDING_BOX_HEIGHT];
-  boundingBoxXOffset = font[FONT_BOUNDING_BOX_X_OFFSET];
-  boundingBoxYOffset = font[FONT_BOUNDING_BOX_Y_OFFSET];
-  ascent = font[FONT_ASCENT];
-  descent = font[FONT_DESCENT];
-  firstCharacter = font + FONT_FIRST_CHARACTER;
-};
-
-Character Font::getCharacter(uint16_t character) {
-  uint8_t *currentCharacter = firstCharacter;
-
-  // first character is always the missing character replacement glyph so skip
-  // it
-  currentCharacter += 256U * *(currentCharacter + CHARACTER_BYTES) + *(currentCharacter + CHARACTER_BYTES + 1);
-
-  uint16_t charactersLeft = numCharacters;
-
-  while (256U * *(currentCharacter) + *(currentCharacter + 1) != character) {
-    charactersLeft--;
-    currentCharacter += 256U * *(currentCharacter + CHARACTER_BYTES) + *(currentCharacter + CHARACTER_BYTES + 1);
-
-    if (charactersLeft <= 0) { // if we didn't find the character use the
-                               // missing character replacement glyph
-      printf("Char not found! '%#x'\n", character);
-      return Character(firstCharacter);
+const Character &Font::getCharacter(uint16_t code) const {
+  // the first character is the missing character replacement glyph, so no other character is at index 0
+  if (code >= ASCII_FIRST_CODE && code <= ASCII_LAST_CODE) {
+    uint16_t index = asciiIndex[code - ASCII_FIRST_CODE];
+    if (index != 0)
+      return characters[index];
+  } else {
+    uint16_t low = 1, high = numCharacters + 1;
+    while (low < high) {
+      uint16_t middle = low + ((high - low) / 2);
+      if (characters[middle].code == code)
+        return characters[middle];
+
+      if (characters[middle].code < code)
+        low = middle + 1;
+      else
+        high = middle;
     }
   }
 
-  return Character(currentCharacter);
+  printf("Char not found! '%#x'\n", code);
+  return characters[0];
 };
 
 } // namespace Font
@@ -92,42 +67,47 @@ uint16_t Display::readUTF8Char(char *&string) {
   return firstByte;
 };
 
-void Display::getTextSize(uint8_t *fontData, char *text, uint16_t &width, uint16_t &height, int16_t &originXOffset,
-                          int16_t &originYOffset, uint16_t &baselineLength) {
+void Display::getTextSize(const Font::Font &font, char *text, uint16_t &width, uint16_t &height, int16_t &originXOffset,
+                          int16_t &originYOffset, uint16_t &baselineLength, TextRun *run) {
   width = 0;
   height = 0;
   baselineLength = 0;
 
   uint16_t maxAscent = 0, maxDescent = 0;
 
-  Font::Font font = Font::Font(fontData);
-
   // if the first character has a negative BBX X Offset we need to add it to the
   // width
   bool firstCharacter = true;
 
   uint16_t currentCharCode;
-  Font::Character currentChar = Font::Character();
+  const Font::Character *currentChar = nullptr;
 
   while ((currentCharCode = readUTF8Char(text))) {
-    currentChar = font.getCharacter(currentCharCode);
+    currentChar = &font.getCharacter(currentCharCode);
 
-    width += currentChar.deviceWidthX;
-    baselineLength += currentChar.deviceWidthX;
+    // the pen position is where the baseline has gotten to so far, a length past the glyphs marks text that doesn't fit
+    if (run != nullptr && run->length <= run->maxGlyphs) {
+      if (run->length < run->maxGlyphs)
+        run->glyphs[run->length] = {currentChar, baselineLength};
+      run->length++;
+    }
+
+    width += currentChar->deviceWidthX;
+    baselineLength += currentChar->deviceWidthX;
 
     // Starting to the left or right of the origin needs to be factored in for
     // first character. Middle characters are just measured by the device width.
     if (firstCharacter) {
       firstCharacter = false;
 
-      width -= currentChar.bbxXOffset;
-      originXOffset = -1 * currentChar.bbxXOffset;
+      width -= currentChar->bbxXOffset;
+      originXOffset = -1 * currentChar->bbxXOffset;
     }
 
-    uint16_t ascent = currentChar.bbxHeight + currentChar.bbxYOffset;
+    uint16_t ascent = currentChar->bbxHeight + currentChar->bbxYOffset;
     maxAscent = ascent > maxAscent ? ascent : maxAscent;
 
-    uint16_t descent = currentChar.bbxYOffset < 0 ? -1 * currentChar.bbxYOffset : 0;
+    uint16_t descent = currentChar->bbxYOffset < 0 ? -1 * currentChar->bbxYOffset : 0;
     maxDescent = descent > maxDescent ? descent : maxDescent;
 
     height = maxAscent + maxDescent;
@@ -135,82 +115,130 @@ void Display::getTextSize(uint8_t *fontData, char *text, uint16_t &width, uint16
 
   // the device width often extends beyond the BBX, so for the last char we need
   // to calculate the added width based on the BBX instead
-  width -= currentChar.deviceWidthX;                      // undo the last operation
-  width += currentChar.bbxWidth + currentChar.bbxXOffset; // add width and account for offset
+  if (currentChar != nullptr) {
+    width -= currentChar->deviceWidthX;                       // undo the last operation
+    width += currentChar->bbxWidth + currentChar->bbxXOffset; // add width and account for offset
+  }
 
   originYOffset = maxAscent - 1;
 };
 
-void Display::getTextSize(uint8_t *fontData, char *text, uint16_t &width, uint16_t &height) {
+void Display::getTextSize(const Font::Font &font, char *text, uint16_t &width, uint16_t &height) {
   int16_t originXOffset, originYOffset;
   uint16_t baselineLength;
-  getTextSize(fontData, text, width, height, originXOffset, originYOffset, baselineLength);
+  getTextSize(font, text, width, height, originXOffset, originYOffset, baselineLength);
 };
 
-void Display::drawText(Origin::Text origin, int16_t x, int16_t y, uint8_t *fontData, char *text, uint16_t color,
-                       Flags flags) {
-  Font::Font font(fontData);
-
-  uint16_t width = 0, height = 0, baselineLength = 0;
-  int16_t originXOffset = 0, originYOffset = 0;
-  getTextSize(fontData, text, width, height, originXOffset, originYOffset, baselineLength);
-
-  int16_t originX = x, originY = y;
-
+bool Display::placeText(Origin::Text origin, int16_t &x, int16_t &y, uint16_t width, uint16_t height,
+                        int16_t originXOffset, int16_t originYOffset, uint16_t baselineLength, Flags flags) {
   switch (origin) {
   case Origin::Text::TOP_LEFT:
-    originX = x + originXOffset;
-    originY = y + originYOffset;
+    x = x + originXOffset;
+    y = y + originYOffset;
     break;
   case Origin::Text::TOP_RIGHT:
-    originX = x - (height - 1) + originXOffset;
-    originY = y + originYOffset;
+    x = x - (height - 1) + originXOffset;
+    y = y + originYOffset;
     break;
   case Origin::Text::BOTTOM_LEFT:
-    originX = x + originXOffset;
-    originY = y - (height - 1) + originYOffset;
+    x = x + originXOffset;
+    y = y - (height - 1) + originYOffset;
     break;
   case Origin::Text::BOTTOM_RIGHT:
-    originX = x - (height - 1) + originXOffset;
-    originY = y - (height - 1) + originYOffset;
+    x = x - (height - 1) + originXOffset;
+    y = y - (height - 1) + originYOffset;
     break;
   case Origin::Text::CENTER:
-    originX = x - (width / 2) + originXOffset;
-    originY = y - (height / 2) + originYOffset;
+    x = x - (width / 2) + originXOffset;
+    y = y - (height / 2) + originYOffset;
     break;
   case Origin::Text::BASELINE_LEFT:
-    originX = x;
-    originY = y;
     break;
   case Origin::Text::BASELINE_CENTER:
-    originX = x - (baselineLength / 2);
-    originY = y;
+    x = x - (baselineLength / 2);
     break;
   case Origin::Text::BASELINE_RIGHT:
-    originX = x - baselineLength;
-    originY = y;
+    x = x - baselineLength;
     break;
   }
 
+  Rect textBox = {(int16_t)(x - originXOffset), (int16_t)(y - originYOffset), width, height};
+  if (textBox.intersect(driver->getClip()).isEmpty())
+    return false; // the whole text is clipped
+
   // we need to draw text in transparent mode so that diacritical marks aren't
   // overridden, to simulate non-transparent text we instead draw a black
   // rectangle over the area the text covers
   if (!flags.transparent) {
-    fillRectangle(Origin::Object2D::TOP_LEFT, originX - originXOffset, originY - originYOffset, width, height, 0x0);
+    fillRectangle(Origin::Object2D::TOP_LEFT, x - originXOffset, y - originYOffset, width, height, 0x0);
   }
 
+  return true;
+}
+
+void Display::drawGlyph(const Font::Font &font, const Font::Character &character, int16_t x, int16_t y, uint16_t color,
+                        bool cached) {
+  int16_t charX = x + character.bbxXOffset, charY = y - character.bbxYOffset;
+  bool empty = character.bbxWidth == 0 || character.bbxHeight == 0; // e.g. a space
+  const Sprite *glyph = cached && !empty ? glyphCache->get(font, character, color) : nullptr;
+
+  if (glyph != nullptr) {
+    drawSprite(Origin::Object2D::BOTTOM_LEFT, charX, charY, *glyph, {.transparent = true});
+  } else {
+    drawBitmap(Origin::Object2D::BOTTOM_LEFT, charX, charY, character.bbxWidth, character.bbxHeight,
+               Bitmap::MONOCHROME, font.getBitmap(character), color, {.transparent = true});
+  }
+}
+
+void Display::drawText(Origin::Text origin, int16_t x, int16_t y, const Font::Font &font, char *text, uint16_t color,
+                       Flags flags) {
+  uint16_t width = 0, height = 0, baselineLength = 0;
+  int16_t originXOffset = 0, originYOffset = 0;
+  getTextSize(font, text, width, height, originXOffset, originYOffset, baselineLength);
+
+  if (!placeText(origin, x, y, width, height, originXOffset, originYOffset, baselineLength, flags))
+    return;
+
+  // cached sprites are drawn transparent, which can't draw black
+  bool cached = glyphCache != nullptr && (color & 0x0f) != 0;
+
   uint16_t currentCharCode;
-  Font::Character currentChar = Font::Character();
 
   while ((currentCharCode = readUTF8Char(text))) {
-    currentChar = font.getCharacter(currentCharCode);
+    const Font::Character &currentChar = font.getCharacter(currentCharCode);
+    drawGlyph(font, currentChar, x, y, color, cached);
+    x += currentChar.deviceWidthX;
+  }
+};
+
+esp_err_t Display::layoutText(const Font::Font &font, char *text, TextRun &run) {
+  run.clear();
+  if (run.glyphs == nullptr)
+    return ESP_ERR_NO_MEM;
 
-    drawBitmap(Origin::Object2D::BOTTOM_LEFT, originX + currentChar.bbxXOffset, originY - currentChar.bbxYOffset,
-               currentChar.bbxWidth, currentChar.bbxHeight, Bitmap::MONOCHROME, currentChar.bitmap, color,
-               {.transparent = true});
+  getTextSize(font, text, run.width, run.height, run.originXOffset, run.originYOffset, run.baselineLength, &run);
 
-    originX += currentChar.deviceWidthX;
+  // the text was measured to the end, but not all of its glyphs fit
+  if (run.length > run.maxGlyphs) {
+    run.clear();
+    return ESP_ERR_INVALID_SIZE;
   }
-};
+
+  run.font = &font;
+  return ESP_OK;
+}
+
+void Display::drawTextRun(Origin::Text origin, int16_t x, int16_t y, const TextRun &run, uint16_t color, Flags flags) {
+  if (run.font == nullptr)
+    return;
+
+  if (!placeText(origin, x, y, run.width, run.height, run.originXOffset, run.originYOffset, run.baselineLength, flags))
+    return;
+
+  bool cached = glyphCache != nullptr && (color & 0x0f) != 0;
+
+  for (uint16_t i = 0; i < run.length; i++)
+    drawGlyph(*run.font, *run.glyphs[i].character, x + run.glyphs[i].x, y, color, cached);
+}
 
 } // namespace Display
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "Driver.hpp"
+
+namespace Display::Bitmap {
+
+// widens 5 and 6 bit channels to 8 bits, repeating their top bits so the brightest value stays the brightest
+static inline uint8_t expand5(uint8_t channel) { return (channel << 3) | (channel >> 2); }
+static inline uint8_t expand6(uint8_t channel) { return (channel << 2) | (channel >> 4); }
+
+uint16_t convertColor(uint16_t color, BitmapFormat from, BitmapFormat to) {
+  if (from == to)
+    return color;
+
+  if (to == MONOCHROME)
+    return color != 0 ? 1 : 0;
+
+  uint8_t gray;
+  if (from == RGB565) {
+    uint8_t red = expand5(color >> 11), green = expand6((color >> 5) & 0x3f), blue = expand5(color & 0x1f);
+    gray = ((red * 77) + (green * 150) + (blue * 29)) >> 8; // weights of the luma, out of 256
+  } else {
+    uint16_t brightest = (1 << bitsPerPixel(from)) - 1;
+    gray = ((color & brightest) * 255) / brightest;
+  }
+
+  if (to == RGB565)
+    return ((gray >> 3) << 11) | ((gray >> 2) << 5) | (gray >> 3);
+
+  return gray >> (8 - bitsPerPixel(to));
+}
+
+// converts pixels to a destination format of `BITS` bits per pixel, looking up the value of every source pixel
+template <uint8_t BITS>
+static void convertPixels(const uint8_t *source, BitmapFormat sourceFormat, uint8_t *destination,
+                          BitmapFormat destinationFormat, uint32_t pixels) {
+  // converted values of every pixel value of sources up to 8 bits
+  uint16_t colors[256];
+  bool lookup = sourceFormat != RGB565;
+  if (lookup) {
+    for (uint16_t value = 0; value < (1 << bitsPerPixel(sourceFormat)); value++)
+      colors[value] = convertColor(value, sourceFormat, destinationFormat);
+  }
+
+  auto converted = [&](uint32_t i) {
+    uint16_t pixel = getPixel(source, sourceFormat, i);
+    return lookup ? colors[pixel] : convertColor(pixel, sourceFormat, destinationFormat);
+  };
+
+  if (BITS == 16) {
+    for (uint32_t i = 0; i < pixels; i++) {
+      uint16_t value = converted(i);
+      destination[2 * i] = value >> 8;
+      destination[(2 * i) + 1] = value;
+    }
+  } else if (BITS == 8) {
+    for (uint32_t i = 0; i < pixels; i++)
+      destination[i] = converted(i);
+  } else {
+    // packs a whole destination byte at a time, the pixels after the last one are 0
+    constexpr uint8_t PIXELS_PER_BYTE = 8 / BITS;
+    for (uint32_t i = 0; i < pixels; i += PIXELS_PER_BYTE) {
+      uint8_t byte = 0;
+      for (uint8_t k = 0; k < PIXELS_PER_BYTE && i + k < pixels; k++)
+        byte |= converted(i + k) << (8 - (BITS * (k + 1)));
+
+      destination[i / PIXELS_PER_BYTE] = byte;
+    }
+  }
+}
+
+void convert(const uint8_t *source, BitmapFormat sourceFormat, uint8_t *destination, BitmapFormat destinationFormat,
+             uint16_t width, uint16_t height) {
+  uint32_t pixels = (uint32_t)width * height;
+
+  if (sourceFormat == destinationFormat) {
+    memcpy(destination, source, (((size_t)pixels * bitsPerPixel(sourceFormat)) + 7) / 8);
+    return;
+  }
+
+  switch (bitsPerPixel(destinationFormat)) {
+  case 1:
+    convertPixels<1>(source, sourceFormat, destination, destinationFormat, pixels);
+    break;
+  case 2:
+    convertPixels<2>(source, sourceFormat, destination, destinationFormat, pixels);
+    break;
+  case 4:
+    convertPixels<4>(source, sourceFormat, destination, destinationFormat, pixels);
+    break;
+  case 8:
+    convertPixels<8>(source, sourceFormat, destination, destinationFormat, pixels);
+    break;
+  case 16:
+    convertPixels<16>(source, sourceFormat, destination, destinationFormat, pixels);
+    break;
+  }
+}
+
+} // namespace Display::Bitmap
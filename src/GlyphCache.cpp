@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <new>
+
+#include "Display.hpp"
+#include "GlyphCache.hpp"
+
+namespace Display {
+
+GlyphCache::GlyphCache(size_t budget, uint16_t maxGlyphs, Driver::Memory memory)
+    : budget(budget), maxGlyphs(maxGlyphs > 0 && maxGlyphs < NONE ? maxGlyphs : 64), memory(memory) {
+  // at least one bucket per glyph keeps the chains short
+  uint32_t bucketCount = 1;
+  while (bucketCount < this->maxGlyphs)
+    bucketCount *= 2;
+  bucketMask = bucketCount - 1;
+
+  size_t bucketBytes = bucketCount * sizeof(uint16_t);
+  bucketBytes += (alignof(Entry) - (bucketBytes % alignof(Entry))) % alignof(Entry);
+
+  // a single allocation for both, the entries start zeroed and so free
+  uint8_t *memoryBlock = Driver::allocateMemory(bucketBytes + (this->maxGlyphs * sizeof(Entry)), memory);
+  if (memoryBlock == nullptr)
+    return;
+
+  buckets = (uint16_t *)memoryBlock;
+  entries = (Entry *)(memoryBlock + bucketBytes);
+
+  for (uint32_t i = 0; i < bucketCount; i++)
+    buckets[i] = NONE;
+}
+
+GlyphCache::~GlyphCache() {
+  clear();
+  Driver::freeMemory(buckets);
+}
+
+void GlyphCache::clear() {
+  if (entries == nullptr)
+    return;
+
+  for (uint16_t i = 0; i < maxGlyphs; i++) {
+    delete entries[i].sprite;
+    entries[i].sprite = nullptr;
+  }
+
+  for (uint32_t i = 0; i <= bucketMask; i++)
+    buckets[i] = NONE;
+
+  usedBytes = 0;
+  glyphCount = 0;
+}
+
+uint16_t &GlyphCache::bucket(const Font::Character *character, uint8_t color) {
+  // characters are 10 bytes apart, multiplying by a large odd constant spreads neighboring ones over the buckets
+  uint32_t key = (uint32_t)(uintptr_t)character ^ ((uint32_t)color << 28);
+  return buckets[((key * 2654435761U) >> 16) & bucketMask];
+}
+
+uint16_t GlyphCache::evict() {
+  uint16_t oldest = NONE;
+  for (uint16_t i = 0; i < maxGlyphs; i++) {
+    if (entries[i].sprite != nullptr && (oldest == NONE || entries[i].lastUse < entries[oldest].lastUse))
+      oldest = i;
+  }
+
+  Entry &entry = entries[oldest];
+
+  uint16_t *link = &bucket(entry.character, entry.color);
+  while (*link != oldest)
+    link = &entries[*link].next;
+  *link = entry.next;
+
+  usedBytes -= entry.sprite->getSize();
+  glyphCount--;
+
+  delete entry.sprite;
+  entry.sprite = nullptr;
+  return oldest;
+}
+
+const Sprite *GlyphCache::get(const Font::Font &font, const Font::Character &character, uint16_t color) {
+  if (entries == nullptr)
+    return nullptr;
+
+  uint8_t nibble = color & 0x0f;
+  uint16_t &head = bucket(&character, nibble);
+
+  for (uint16_t i = head; i != NONE; i = entries[i].next) {
+    Entry &entry = entries[i];
+    if (entry.character == &character && entry.color == nibble) {
+      entry.lastUse = ++clock;
+      hits++;
+      return entry.sprite;
+    }
+  }
+
+  misses++;
+
+  // same size as the copies of the sprite, see Sprite::getSize
+  size_t bytes = 2 * (size_t)((character.bbxWidth / 2) + 1) * character.bbxHeight;
+  if (bytes > budget)
+    return nullptr;
+
+  uint16_t free = NONE;
+  while (usedBytes + bytes > budget)
+    free = evict();
+
+  if (glyphCount == maxGlyphs)
+    free = evict();
+
+  if (free == NONE) {
+    for (free = 0; entries[free].sprite != nullptr; free++)
+      ;
+  }
+
+  Sprite *sprite = new (std::nothrow) Sprite(font.getBitmap(character), Bitmap::MONOCHROME, nibble, character.bbxWidth,
+                                             character.bbxHeight, memory);
+  if (sprite == nullptr || sprite->getRows(false) == nullptr) {
+    delete sprite;
+    return nullptr;
+  }
+
+  entries[free] = {&character, sprite, ++clock, head, nibble};
+  head = free;
+
+  usedBytes += bytes;
+  glyphCount++;
+  return sprite;
+}
+
+} // namespace Display
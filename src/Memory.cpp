@@ -0,0 +1,53 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sdkconfig.h"
+
+#include <cstdlib>
+
+#ifndef CONFIG_IDF_TARGET_LINUX
+#include "esp_heap_caps.h"
+#endif
+
+#include "Driver.hpp"
+
+namespace Display::Driver {
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+
+// the linux target has a single heap so the placement doesn't matter
+uint8_t *allocateMemory(size_t bytes, Memory memory) {
+  return memory == Memory::NONE ? nullptr : (uint8_t *)calloc(1, bytes);
+}
+
+void freeMemory(void *memory) { free(memory); }
+
+#else
+
+uint8_t *allocateMemory(size_t bytes, Memory memory) {
+  uint32_t capabilities = MALLOC_CAP_8BIT;
+  switch (memory) {
+  case Memory::DEFAULT:
+    break;
+  case Memory::INTERNAL:
+    capabilities |= MALLOC_CAP_INTERNAL;
+    break;
+  case Memory::DMA:
+    capabilities |= MALLOC_CAP_DMA;
+    break;
+  case Memory::SPIRAM:
+    capabilities |= MALLOC_CAP_SPIRAM;
+    break;
+  case Memory::NONE:
+    return nullptr;
+  }
+
+  return (uint8_t *)heap_caps_calloc(1, bytes, capabilities);
+}
+
+void freeMemory(void *memory) { heap_caps_free(memory); }
+
+#endif
+
+} // namespace Display::Driver
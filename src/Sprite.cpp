@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Display.hpp"
+#include "Sprite.hpp"
+
+namespace Display {
+
+Sprite::Sprite(const uint8_t *bitmap, uint16_t width, uint16_t height, Driver::Memory memory)
+    : Sprite(bitmap, Bitmap::GRAYSCALE_4_BIT, 0, width, height, memory) {}
+
+Sprite::Sprite(const uint8_t *bitmap, Bitmap::BitmapFormat format, uint16_t color, uint16_t width, uint16_t height,
+               Driver::Memory memory)
+    : width(width), height(height) {
+  uint16_t bytesPerRow = getBytesPerRow();
+  copies = Driver::allocateMemory(getSize(), memory);
+  if (copies == nullptr)
+    return;
+
+  // padding nibbles stay 0 from the allocation
+  for (uint8_t shift = 0; shift < 2; shift++) {
+    uint8_t *rows = copies + (shift * (size_t)bytesPerRow * height);
+
+    for (uint16_t j = 0; j < height; j++) {
+      for (uint16_t i = 0; i < width; i++) {
+        uint32_t pixel = ((uint32_t)j * width) + i;
+        uint8_t value = Bitmap::getPixel(bitmap, format, pixel);
+        if (format == Bitmap::MONOCHROME)
+          value = value != 0 ? color & 0x0f : 0;
+
+        uint16_t nibble = i + shift;
+        rows[nibble / 2] |= nibble % 2 == 0 ? value << 4 : value;
+      }
+
+      rows += bytesPerRow;
+    }
+  }
+}
+
+Sprite::~Sprite() { Driver::freeMemory(copies); }
+
+void Display::drawSprite(Origin::Object2D origin, int16_t x, int16_t y, const Sprite &sprite, Flags flags) {
+  shiftOrigin2DToTopLeft(origin, x, y, sprite.getWidth(), sprite.getHeight());
+  driver->writeSpriteToBuffer(x, y, sprite, flags);
+}
+
+} // namespace Display
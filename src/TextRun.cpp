@@ -0,0 +1,26 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "TextRun.hpp"
+
+namespace Display {
+
+TextRun::TextRun(uint16_t maxGlyphs, Driver::Memory memory) : maxGlyphs(maxGlyphs < 0xffff ? maxGlyphs : 0xfffe) {
+  glyphs = (Glyph *)Driver::allocateMemory(this->maxGlyphs * sizeof(Glyph), memory);
+}
+
+TextRun::~TextRun() { Driver::freeMemory(glyphs); }
+
+void TextRun::clear() {
+  font = nullptr;
+  length = 0;
+
+  width = 0;
+  height = 0;
+  baselineLength = 0;
+  originXOffset = 0;
+  originYOffset = 0;
+}
+
+} // namespace Display
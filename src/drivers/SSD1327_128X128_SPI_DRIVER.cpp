@@ -11,38 +11,77 @@
 #include "driver/gpio.h"
 #include "driver/spi_common.h"
 #include "driver/spi_master.h"
+#include "esp_attr.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "hal/gpio_ll.h"
 
 #include "Driver.hpp"
 #include "soc/soc_caps.h"
 
 namespace Display::Driver {
 
-spi_transaction_t SSD1327_128X128_DRIVER_TRANSACTION;
+// approximate cost of an extra SPI transaction in bytes of bus time, used to decide between sending a window row by
+// row or widening it to full rows
+static constexpr uint16_t SSD1327_128X128_DRIVER_ROW_TRANSFER_OVERHEAD = 16;
 
-static spi_device_handle_t SSD1327_128X128_DRIVER_SPI_HANDLE;
-spi_transaction_t SSD1327_128X128_DRIVER_SPI_TRANSACTION;
+SSD1327_128X128_SPI_DRIVER::SSD1327_128X128_SPI_DRIVER(PinMap pins, Memory memory)
+    : FrameBufferDriver{pins, memory}, bandsOnly(memory == Memory::NONE) {}
 
-uint8_t SSD1327_128X128_DRIVER_SPI_BUFFER[(128 * 128 * 4) / 8] = {0};
+SSD1327_128X128_SPI_DRIVER::SSD1327_128X128_SPI_DRIVER(PinMap pins, uint8_t *frameBuffer)
+    : FrameBufferDriver{pins, frameBuffer}, bandsOnly(false) {}
+
+SSD1327_128X128_SPI_DRIVER::~SSD1327_128X128_SPI_DRIVER() {
+  if (device == nullptr)
+    return;
+
+  // a frame in flight still reads from the buffer that is about to be freed
+  waitForTransfer();
+  spi_bus_remove_device(device);
+}
+
+// The transfer callbacks run in the SPI interrupt, which stays in IRAM so it can fire while the flash cache is
+// disabled, e.g. during NVS or OTA writes. Everything they call has to be in IRAM as well.
+IRAM_ATTR void SSD1327_128X128_SPI_DRIVER::preTransfer(spi_transaction_t *transaction) {
+  TransferPhase *phase = (TransferPhase *)transaction->user;
+  if (phase == NULL) // synchronous transfers set D/C themselves
+    return;
+
+  // gpio_set_level is in flash unless CONFIG_GPIO_CTRL_FUNC_IN_IRAM is set, the low level call is always inlined
+  gpio_ll_set_level(&GPIO, phase->driver->pins.spi.dc, phase->dc);
+}
+
+IRAM_ATTR void SSD1327_128X128_SPI_DRIVER::postTransfer(spi_transaction_t *transaction) {
+  TransferPhase *phase = (TransferPhase *)transaction->user;
+  if (phase != NULL && phase->lastOfFrame)
+    phase->driver->notifyTransferComplete();
+}
 
 esp_err_t SSD1327_128X128_SPI_DRIVER::sendCommands(uint8_t *commands, uint8_t bytes) {
   esp_err_t err;
 
+  // polling and queued transactions can't be mixed, let a queued frame finish first
+  err = waitForTransfer();
+  if (err != ESP_OK)
+    return err;
+
   err = gpio_set_level((gpio_num_t)pins.spi.dc, 0); // set command mode
   if (err != ESP_OK)
     return err;
 
-  memset(&SSD1327_128X128_DRIVER_SPI_TRANSACTION, 0, sizeof(SSD1327_128X128_DRIVER_SPI_TRANSACTION));
-  SSD1327_128X128_DRIVER_SPI_TRANSACTION.length = 8 * bytes;
-  SSD1327_128X128_DRIVER_SPI_TRANSACTION.tx_buffer = commands;
-  SSD1327_128X128_DRIVER_SPI_TRANSACTION.rx_buffer = NULL;
-  return spi_device_transmit(SSD1327_128X128_DRIVER_SPI_HANDLE, &SSD1327_128X128_DRIVER_SPI_TRANSACTION);
+  memset(&transaction, 0, sizeof(transaction));
+  transaction.length = 8 * bytes;
+  transaction.tx_buffer = commands;
+  transaction.rx_buffer = NULL;
+  return spi_device_transmit(device, &transaction);
 }
 
 esp_err_t SSD1327_128X128_SPI_DRIVER::initializeDisplay() {
   esp_err_t err;
 
+  if (buffer == nullptr && !bandsOnly)
+    return ESP_ERR_NO_MEM;
+
   // Initialize SPI
   spi_bus_config_t busConfig;
   memset(&busConfig, GPIO_NUM_NC, sizeof(spi_bus_config_t));
@@ -52,7 +91,7 @@ esp_err_t SSD1327_128X128_SPI_DRIVER::initializeDisplay() {
   busConfig.flags = 0;
   busConfig.intr_flags = 0;
   err = spi_bus_initialize(SPI2_HOST, &busConfig, SPI_DMA_CH_AUTO);
-  if (err != ESP_OK)
+  if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) // the bus is already set up when it is shared with another panel
     return err;
 
   spi_device_interface_config_t deviceConfig;
@@ -60,9 +99,9 @@ esp_err_t SSD1327_128X128_SPI_DRIVER::initializeDisplay() {
   deviceConfig.clock_speed_hz = 24000000;
   deviceConfig.spics_io_num = pins.spi.cs;
   deviceConfig.queue_size = 200;
-  deviceConfig.pre_cb = NULL;
-  deviceConfig.post_cb = NULL;
-  err = spi_bus_add_device(SPI2_HOST, &deviceConfig, &SSD1327_128X128_DRIVER_SPI_HANDLE);
+  deviceConfig.pre_cb = preTransfer;
+  deviceConfig.post_cb = postTransfer;
+  err = spi_bus_add_device(SPI2_HOST, &deviceConfig, &device);
   if (err != ESP_OK)
     return err;
 
@@ -172,6 +211,9 @@ esp_err_t SSD1327_128X128_SPI_DRIVER::initializeDisplay() {
   if (err != ESP_OK)
     return err;
 
+  if (bandsOnly)
+    return ESP_OK; // the first frame that is rendered covers the whole screen
+
   // clear screen
   err = clearBuffer();
   if (err != ESP_OK)
@@ -184,78 +226,197 @@ esp_err_t SSD1327_128X128_SPI_DRIVER::initializeDisplay() {
   return ESP_OK;
 }
 
-esp_err_t SSD1327_128X128_SPI_DRIVER::clearBuffer() {
-  memset(SSD1327_128X128_DRIVER_SPI_BUFFER, 0, sizeof(SSD1327_128X128_DRIVER_SPI_BUFFER));
+esp_err_t SSD1327_128X128_SPI_DRIVER::sendBufferToDisplay() {
+  esp_err_t err;
+
+  err = waitForTransfer();
+  if (err != ESP_OK)
+    return err;
+
+  // only the regions that changed since the last update are sent, an unchanged frame sends nothing
+  for (uint8_t i = 0; i < damage.size(); i++) {
+    err = sendBufferWindow(buffer, damage[i]);
+    if (err != ESP_OK)
+      return err;
+  }
+
+  if (backBuffer != nullptr)
+    copyDamage(buffer, backBuffer, damage);
+
+  damage.clear();
   return ESP_OK;
 }
 
-esp_err_t SSD1327_128X128_SPI_DRIVER::sendBufferToDisplay() {
+esp_err_t SSD1327_128X128_SPI_DRIVER::sendBufferWindow(uint8_t *frame, Rect window) {
   esp_err_t err;
 
+  // GDDRAM columns hold two pixels each so the window is widened to whole bytes
+  uint8_t startColumn = window.x / 2;
+  uint8_t endColumn = (window.x + window.width - 1) / 2;
+  uint8_t startRow = window.y;
+  uint8_t endRow = window.y + window.height - 1;
+
+  uint16_t rowBytes = endColumn - startColumn + 1;
+  uint16_t rows = endRow - startRow + 1;
+
+  // The window has to be streamed as contiguous bytes, which the buffer only provides for full rows. Narrow windows
+  // are sent one row at a time, wide ones are widened to full rows when the extra bytes cost less than the per row
+  // transactions.
+  if ((rowBytes + SSD1327_128X128_DRIVER_ROW_TRANSFER_OVERHEAD) * rows >=
+      BYTES_PER_ROW * rows + SSD1327_128X128_DRIVER_ROW_TRANSFER_OVERHEAD) {
+    startColumn = 0;
+    endColumn = BYTES_PER_ROW - 1;
+    rowBytes = BYTES_PER_ROW;
+  }
+
+  uint8_t setWindow[] = {
+      0x15, // set column start end address, in units of two pixels
+      startColumn,
+      endColumn,
+
+      0x75, // set row start end address
+      startRow,
+      endRow,
+  };
+
+  err = sendCommands(setWindow, sizeof(setWindow));
+  if (err != ESP_OK)
+    return err;
+
   err = gpio_set_level((gpio_num_t)pins.spi.dc, 1); // set data mode
   if (err != ESP_OK)
     return err;
 
-  memset(&SSD1327_128X128_DRIVER_SPI_TRANSACTION, 0, sizeof(SSD1327_128X128_DRIVER_SPI_TRANSACTION));
-  SSD1327_128X128_DRIVER_SPI_TRANSACTION.length = 8 * sizeof(SSD1327_128X128_DRIVER_SPI_BUFFER);
-  SSD1327_128X128_DRIVER_SPI_TRANSACTION.tx_buffer = SSD1327_128X128_DRIVER_SPI_BUFFER;
-  SSD1327_128X128_DRIVER_SPI_TRANSACTION.rx_buffer = NULL;
-  spi_device_transmit(SSD1327_128X128_DRIVER_SPI_HANDLE, &SSD1327_128X128_DRIVER_SPI_TRANSACTION);
+  uint8_t *data = frame + (startRow * BYTES_PER_ROW) + startColumn;
+
+  if (rowBytes == BYTES_PER_ROW) { // full rows are contiguous so send them all at once
+    memset(&transaction, 0, sizeof(transaction));
+    transaction.length = 8 * rowBytes * rows;
+    transaction.tx_buffer = data;
+    transaction.rx_buffer = NULL;
+    return spi_device_transmit(device, &transaction);
+  }
+
+  for (uint16_t row = 0; row < rows; row++) {
+    // short transfers are dominated by setup so poll instead of waiting on the transaction interrupt
+    memset(&transaction, 0, sizeof(transaction));
+    transaction.length = 8 * rowBytes;
+    transaction.tx_buffer = data;
+    transaction.rx_buffer = NULL;
+    err = spi_device_polling_transmit(device, &transaction);
+    if (err != ESP_OK)
+      return err;
+
+    data += BYTES_PER_ROW;
+  }
 
   return ESP_OK;
 }
 
-esp_err_t SSD1327_128X128_SPI_DRIVER::setRotation(Display::Rotation rotation) {
-  switch (rotation) {
-  case Rotation::DEFAULT: {
-    uint8_t rotateDisplay[] = {0xa0, 0b01000010};
-    return sendCommands(rotateDisplay, sizeof(rotateDisplay));
-    break;
+esp_err_t SSD1327_128X128_SPI_DRIVER::queueBufferTransfer(uint8_t *frame, const DamageMap &frameDamage) {
+  esp_err_t err;
+
+  FrameTransfer &transfer = frameTransfers[nextFrameTransfer];
+  nextFrameTransfer = (nextFrameTransfer + 1) % 2;
+
+  // Queued windows are always sent as full rows so each one needs just a window command and a single DMA transfer.
+  // Collect the row bands of all damaged rectangles and join the ones that overlap or touch.
+  uint8_t startRows[DamageMap::MAX_RECTS], endRows[DamageMap::MAX_RECTS];
+  uint8_t bands = 0;
+
+  for (uint8_t i = 0; i < frameDamage.size(); i++) {
+    uint8_t startRow = frameDamage[i].y;
+    uint8_t endRow = frameDamage[i].y + frameDamage[i].height - 1;
+
+    // insertion sort by start row
+    uint8_t j = bands++;
+    for (; j > 0 && startRows[j - 1] > startRow; j--) {
+      startRows[j] = startRows[j - 1];
+      endRows[j] = endRows[j - 1];
+    }
+    startRows[j] = startRow;
+    endRows[j] = endRow;
+  }
+
+  uint8_t joined = 0;
+  for (uint8_t i = 1; i < bands; i++) {
+    if (startRows[i] <= endRows[joined] + 1) {
+      endRows[joined] = endRows[i] > endRows[joined] ? endRows[i] : endRows[joined];
+    } else {
+      joined++;
+      startRows[joined] = startRows[i];
+      endRows[joined] = endRows[i];
+    }
   }
-  case Rotation::CLOCKWISE_180: {
-    uint8_t rotateDisplay[] = {0xa0, 0b01010001};
-    return sendCommands(rotateDisplay, sizeof(rotateDisplay));
-    break;
+  bands = bands > 0 ? joined + 1 : 0;
+
+  queuedTransactions = 0;
+  for (uint8_t i = 0; i < bands; i++) {
+    uint8_t *commands = transfer.windowCommands[i];
+    commands[0] = 0x15; // set column start end address, in units of two pixels
+    commands[1] = 0;
+    commands[2] = BYTES_PER_ROW - 1;
+    commands[3] = 0x75; // set row start end address
+    commands[4] = startRows[i];
+    commands[5] = endRows[i];
+
+    spi_transaction_t *command = &transfer.transactions[2 * i];
+    memset(command, 0, sizeof(spi_transaction_t));
+    command->length = 8 * sizeof(transfer.windowCommands[i]);
+    command->tx_buffer = commands;
+    command->user = &commandPhase;
+
+    spi_transaction_t *data = &transfer.transactions[(2 * i) + 1];
+    memset(data, 0, sizeof(spi_transaction_t));
+    data->length = 8 * BYTES_PER_ROW * (endRows[i] - startRows[i] + 1);
+    data->tx_buffer = frame + (startRows[i] * BYTES_PER_ROW);
+    data->user = i == bands - 1 ? &lastDataPhase : &dataPhase;
   }
+
+  for (uint8_t i = 0; i < 2 * bands; i++) {
+    err = spi_device_queue_trans(device, &transfer.transactions[i], portMAX_DELAY);
+    if (err != ESP_OK)
+      return err;
+
+    queuedTransactions++;
   }
+
   return ESP_OK;
 }
 
-void SSD1327_128X128_SPI_DRIVER::setBufferPixel(int16_t x, int16_t y, uint16_t color) {
-  if (x < 0 || x >= 128 || y < 0 || y >= 128) {
-    return;
-  }
+esp_err_t SSD1327_128X128_SPI_DRIVER::waitForBufferTransfer(TickType_t timeout) {
+  esp_err_t err;
 
-  int index = (64 * y) + (x / 2);
-  if (x % 2 == 0) {
-    SSD1327_128X128_DRIVER_SPI_BUFFER[index] = color << 4 | (SSD1327_128X128_DRIVER_SPI_BUFFER[index] & 0xf);
-  } else {
-    SSD1327_128X128_DRIVER_SPI_BUFFER[index] = (color & 0xf) | (SSD1327_128X128_DRIVER_SPI_BUFFER[index] & 0xf0);
+  spi_transaction_t *finished;
+  while (queuedTransactions > 0) {
+    err = spi_device_get_trans_result(device, &finished, timeout);
+    if (err != ESP_OK)
+      return err;
+
+    queuedTransactions--;
   }
+
+  return ESP_OK;
 }
 
-void SSD1327_128X128_SPI_DRIVER::setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) {
-  write4BitColorTo4BitBuffer(color, SSD1327_128X128_DRIVER_SPI_BUFFER, x, y, width, height);
-};
+// The remap only mirrors the panel, which covers the half turn. A quarter turn would need the vertical address
+// increment, but each GDDRAM byte holds two pixels of a row and it can't swap them into a column. Quarter turns are
+// drawn into the buffer instead, so sending a turned frame costs the same as any other, and 270 degrees adds the half
+// turn of the remap to them.
+esp_err_t SSD1327_128X128_SPI_DRIVER::setRotation(Display::Rotation rotation) {
+  bool halfTurn = rotation == Rotation::CLOCKWISE_180 || rotation == Rotation::CLOCKWISE_270;
+  uint8_t rotateDisplay[] = {0xa0, (uint8_t)(halfTurn ? 0b01010001 : 0b01000010)};
+  esp_err_t err = sendCommands(rotateDisplay, sizeof(rotateDisplay));
+  if (err != ESP_OK)
+    return err;
 
-void SSD1327_128X128_SPI_DRIVER::writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height,
-                                                     void *bitmap, Bitmap::BitmapFormat format, uint16_t color,
-                                                     Flags flags) {
-  switch (format) {
-  case Bitmap::MONOCHROME:
-    write1BitBitmapTo4BitBuffer((uint8_t *)bitmap, color, SSD1327_128X128_DRIVER_SPI_BUFFER, x, y, width, height,
-                                flags);
-    break;
-  case Bitmap::GRAYSCALE_4_BIT:
-    write4BitBitmapTo4BitBuffer((uint8_t *)bitmap, SSD1327_128X128_DRIVER_SPI_BUFFER, x, y, width, height, flags);
-    break;
-  }
-};
+  return setQuarterTurn(rotation == Rotation::CLOCKWISE_90 || rotation == Rotation::CLOCKWISE_270);
+}
 
 void SSD1327_128X128_SPI_DRIVER::printBuffer() {
   for (int y = 0; y < 128; y++) {
-    for (int x = 0; x < 64; x++) {
-      printf("%02x", SSD1327_128X128_DRIVER_SPI_BUFFER[(y * 64) + x]);
+    for (int x = 0; x < BYTES_PER_ROW; x++) {
+      printf("%02x", buffer[(y * BYTES_PER_ROW) + x]);
     }
     printf("\n");
   }
@@ -0,0 +1,245 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstdio>
+#include <cstring>
+
+#include "Driver.hpp"
+
+namespace Display::Driver {
+
+// a cursor move costs about as much as rewriting this many cells, so shorter gaps between changed runs are rewritten
+// instead of jumping over them
+static constexpr uint16_t MAX_RUN_GAP = 2;
+
+// longest cursor move, "\033[RRR;CCCH"
+static constexpr size_t MAX_CURSOR_MOVE_BYTES = 10;
+
+struct Glyph {
+  char bytes[3];
+  uint8_t length;
+};
+
+// UTF-8 glyphs used for cells, glyphs are always copied as 3 bytes and then the cursor is advanced by their actual
+// length
+static constexpr Glyph GLYPHS[] = {
+    {{' '}, 1},                    // 0 unlit
+    {{'\xe2', '\x96', '\x91'}, 3}, // 1 ░
+    {{'\xe2', '\x96', '\x92'}, 3}, // 2 ▒
+    {{'\xe2', '\x96', '\x93'}, 3}, // 3 ▓
+    {{'\xe2', '\x96', '\x88'}, 3}, // 4 █
+    {{'\xe2', '\x96', '\x80'}, 3}, // 5 ▀ upper half block
+    {{'\xe2', '\x96', '\x84'}, 3}, // 6 ▄ lower half block
+};
+
+// shade of every 4 bit pixel value as an index into GLYPHS
+static constexpr uint8_t SHADES[16] = {0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4};
+
+// Glyph for a cell covering two pixels, indexed by the shade of the upper and then the lower pixel. Equal shades keep
+// their block, a dark or full pixel next to an unlit one becomes a half block and anything else is drawn with the
+// rounded average shade.
+static constexpr uint8_t HALF_BLOCKS[5][5] = {
+    {0, 1, 1, 6, 6},
+    {1, 1, 2, 2, 3},
+    {1, 2, 2, 3, 3},
+    {5, 2, 3, 3, 4},
+    {5, 3, 3, 4, 4},
+};
+
+static const char BORDER_TOP_LEFT[] = "┏";
+static const char BORDER_TOP_RIGHT[] = "┓\n";
+static const char BORDER_BOTTOM_LEFT[] = "┗";
+static const char BORDER_BOTTOM_RIGHT[] = "┛\n";
+static const char BORDER_HORIZONTAL[] = "━";
+static const char BORDER_LEFT[] = "┃";
+static const char BORDER_RIGHT[] = "┃\n";
+
+static void writeString(char *&output, const char *string, size_t length) {
+  memcpy(output, string, length);
+  output += length;
+}
+
+static void writeNumber(char *&output, uint16_t number) {
+  char digits[5];
+  uint8_t count = 0;
+  do {
+    digits[count++] = '0' + (number % 10);
+    number /= 10;
+  } while (number > 0);
+
+  while (count > 0)
+    *output++ = digits[--count];
+}
+
+// terminal rows and columns are 1 indexed
+static void writeCursorMove(char *&output, uint16_t row, uint16_t column) {
+  *output++ = '\033';
+  *output++ = '[';
+  writeNumber(output, row);
+  *output++ = ';';
+  writeNumber(output, column);
+  *output++ = 'H';
+}
+
+// Quarter turns are already drawn into the buffer, the terminal only adds the half turn of 180 and 270 degrees by
+// printing it mirrored both ways.
+static bool isHalfTurned(Rotation rotation) {
+  return rotation == Rotation::CLOCKWISE_180 || rotation == Rotation::CLOCKWISE_270;
+}
+
+// pixel value at a column of a buffer row, mirrored for the rotation
+static uint8_t pixel(uint8_t *row, uint16_t column, uint16_t width, Rotation rotation) {
+  uint16_t x = isHalfTurned(rotation) ? width - 1 - column : column;
+  return x % 2 == 0 ? row[x / 2] >> 4 : row[x / 2] & 0x0f;
+}
+
+static void writeCell(char *&output, uint8_t glyph) {
+  memcpy(output, GLYPHS[glyph].bytes, 3);
+  output += GLYPHS[glyph].length;
+}
+
+SerialTerminal::SerialTerminal(uint16_t width, uint16_t height) : width(width), height(height) {
+  lastFrame = allocateMemory((width / 2) * height, Memory::DEFAULT);
+  output = (char *)allocateMemory(outputSize(width, height), Memory::DEFAULT);
+}
+
+SerialTerminal::~SerialTerminal() {
+  freeMemory(lastFrame);
+  freeMemory(output);
+}
+
+uint8_t *SerialTerminal::bufferRow(uint8_t *buffer, uint16_t row, Rotation rotation) {
+  if (row >= height) // the lower half of the last cell row when the height is odd
+    return nullptr;
+
+  return buffer + ((width / 2) * (isHalfTurned(rotation) ? height - 1 - row : row));
+}
+
+uint8_t SerialTerminal::cellGlyph(uint8_t *upperRow, uint8_t *lowerRow, uint16_t column, Rotation rotation) {
+  uint8_t upper = SHADES[pixel(upperRow, column, width, rotation)];
+  if (!halfBlocks)
+    return upper;
+
+  uint8_t lower = lowerRow != nullptr ? SHADES[pixel(lowerRow, column, width, rotation)] : 0;
+  return HALF_BLOCKS[upper][lower];
+}
+
+void SerialTerminal::writeBorder(char *&cursor, bool top) {
+  if (top) {
+    writeString(cursor, BORDER_TOP_LEFT, sizeof(BORDER_TOP_LEFT) - 1);
+  } else {
+    writeString(cursor, BORDER_BOTTOM_LEFT, sizeof(BORDER_BOTTOM_LEFT) - 1);
+  }
+
+  for (uint16_t i = 0; i < width; i++)
+    writeString(cursor, BORDER_HORIZONTAL, sizeof(BORDER_HORIZONTAL) - 1);
+
+  if (top) {
+    writeString(cursor, BORDER_TOP_RIGHT, sizeof(BORDER_TOP_RIGHT) - 1);
+  } else {
+    writeString(cursor, BORDER_BOTTOM_RIGHT, sizeof(BORDER_BOTTOM_RIGHT) - 1);
+  }
+}
+
+void SerialTerminal::writeFrame(char *&cursor, uint8_t *buffer, Rotation rotation) {
+  uint8_t rowsPerCell = halfBlocks ? 2 : 1;
+
+  writeBorder(cursor, true);
+  for (uint16_t y = 0; y < cellRows(); y++) {
+    uint8_t *upperRow = bufferRow(buffer, y * rowsPerCell, rotation);
+    uint8_t *lowerRow = halfBlocks ? bufferRow(buffer, (y * rowsPerCell) + 1, rotation) : nullptr;
+
+    writeString(cursor, BORDER_LEFT, sizeof(BORDER_LEFT) - 1);
+    for (uint16_t x = 0; x < width; x++)
+      writeCell(cursor, cellGlyph(upperRow, lowerRow, x, rotation));
+    writeString(cursor, BORDER_RIGHT, sizeof(BORDER_RIGHT) - 1);
+  }
+  writeBorder(cursor, false);
+}
+
+bool SerialTerminal::writeChanges(char *&cursor, uint8_t *buffer, Rotation rotation) {
+  uint16_t bytesPerRow = width / 2;
+  uint8_t rowsPerCell = halfBlocks ? 2 : 1;
+
+  // leave room for the final cursor move below the frame
+  char *end = output + outputSize(width, height) - MAX_CURSOR_MOVE_BYTES;
+
+  for (uint16_t y = 0; y < cellRows(); y++) {
+    uint8_t *upperRow = bufferRow(buffer, y * rowsPerCell, rotation);
+    uint8_t *lowerRow = halfBlocks ? bufferRow(buffer, (y * rowsPerCell) + 1, rotation) : nullptr;
+    uint8_t *lastUpperRow = bufferRow(lastFrame, y * rowsPerCell, rotation);
+    uint8_t *lastLowerRow = halfBlocks ? bufferRow(lastFrame, (y * rowsPerCell) + 1, rotation) : nullptr;
+
+    if (memcmp(upperRow, lastUpperRow, bytesPerRow) == 0 &&
+        (lowerRow == nullptr || memcmp(lowerRow, lastLowerRow, bytesPerRow) == 0))
+      continue;
+
+    uint16_t x = 0;
+    while (x < width) {
+      if (cellGlyph(upperRow, lowerRow, x, rotation) == cellGlyph(lastUpperRow, lastLowerRow, x, rotation)) {
+        x++;
+        continue;
+      }
+
+      // extend the run over every changed cell, bridging short gaps of unchanged ones
+      uint16_t runStart = x, runEnd = x;
+      for (uint16_t next = x + 1; next < width && next <= runEnd + MAX_RUN_GAP + 1; next++) {
+        if (cellGlyph(upperRow, lowerRow, next, rotation) != cellGlyph(lastUpperRow, lastLowerRow, next, rotation))
+          runEnd = next;
+      }
+
+      // a delta larger than a whole frame isn't worth it
+      if (cursor + MAX_CURSOR_MOVE_BYTES + (3 * (runEnd - runStart + 1)) > end)
+        return false;
+
+      // the border takes up the first row and column
+      writeCursorMove(cursor, y + 2, runStart + 2);
+      for (uint16_t i = runStart; i <= runEnd; i++)
+        writeCell(cursor, cellGlyph(upperRow, lowerRow, i, rotation));
+
+      x = runEnd + 1;
+    }
+  }
+
+  writeCursorMove(cursor, cellRows() + 3, 1); // leave the cursor below the frame like a full redraw does
+  return true;
+}
+
+void SerialTerminal::flush(char *end) {
+  fwrite(output, 1, end - output, stdout);
+  fflush(stdout);
+}
+
+esp_err_t SerialTerminal::printFrame(uint8_t *buffer, Rotation rotation) {
+  if (output == nullptr)
+    return ESP_ERR_NO_MEM;
+
+  char *cursor = output;
+  writeFrame(cursor, buffer, rotation);
+  flush(cursor);
+  return ESP_OK;
+}
+
+esp_err_t SerialTerminal::drawFrame(uint8_t *buffer, Rotation rotation) {
+  if (output == nullptr || lastFrame == nullptr)
+    return ESP_ERR_NO_MEM;
+
+  char *cursor = output;
+
+  if (!deltaUpdates || !valid || !writeChanges(cursor, buffer, rotation)) {
+    cursor = output;
+    writeString(cursor, "\033[2J", 4); // clear screen
+    writeString(cursor, "\033[H", 3);  // move cursor to home
+    writeString(cursor, "\r", 1);      // ensure we're starting at column 0
+    writeFrame(cursor, buffer, rotation);
+  }
+
+  flush(cursor);
+
+  memcpy(lastFrame, buffer, (width / 2) * height);
+  valid = true;
+  return ESP_OK;
+}
+
+} // namespace Display::Driver
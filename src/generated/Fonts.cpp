@@ -2,7 +2,7 @@
 //
 // SPDX-License-Identifier: GPL-3.0-or-later
 
-#include "Fonts.hpp"
+#include "Font.hpp"
 
 namespace Display::Font {
 
@@ -10,3821 +10,7053 @@ namespace Display::Font {
 //   - Copyright (c) 2019 Yomli  Copyright (c) 1850 Bailleul et Cie  Copyright (c) 1800 Justus Erich Walbaum"
 //   - Size: 8
 //   - Characters: 232
-uint8_t bailleul_8_pt[3698] = "\x08\x00\xe8\x0e\x0f\xfe\xfd\x0a\x02\x00\x00\x00\x0e\x05\x08\x04\x08\x00\x00\xf9"
-                              "\x99\x99\x9f\x00\x20\x00\x0a\x03\x00\x00\x00\x00\x00\x00\x21\x00\x0c\x03\x00\x01"
-                              "\x09\x01\x00\xff\x80\x00\x22\x00\x0c\x05\x00\x03\x04\x01\x05\xb6\xd0\x00\x23\x00"
-                              "\x10\x06\x00\x06\x08\x00\x00\x28\xa7\xca\x4b\xe5\x14\x00\x24\x00\x11\x06\x00\x05"
-                              "\x0b\x01\xff\x21\x3d\x6a\x70\xc5\xaf\x88\x00\x25\x00\x15\x0b\x00\x09\x09\x01\x00"
-                              "\x02\x31\x25\x12\x86\x80\x98\x52\x49\x23\x00\x00\x26\x00\x13\x08\x00\x08\x09\x00"
-                              "\x00\x38\x28\x30\x2f\x54\x55\xcd\x4d\x7e\x00\x27\x00\x0b\x03\x00\x01\x04\x01\x05"
-                              "\xf0\x00\x28\x00\x0f\x04\x00\x03\x0b\x01\xfd\x29\x49\x24\x48\x80\x00\x29\x00\x10"
-                              "\x04\x00\x04\x0b\x00\xfd\x84\x22\x23\x22\x24\x80\x00\x2A\x00\x0c\x04\x00\x04\x04"
-                              "\x00\x05\x2d\x26\x00\x2B\x00\x0e\x07\x00\x05\x06\x01\x00\x21\x09\xf2\x10\x00\x2C"
-                              "\x00\x0b\x03\x00\x02\x04\x01\xfe\xa6\x00\x2D\x00\x0b\x04\x00\x03\x01\x01\x02\xe0"
-                              "\x00\x2E\x00\x0b\x03\x00\x01\x02\x01\x00\xc0\x00\x2F\x00\x10\x05\x00\x05\x09\x00"
-                              "\x00\x08\x84\x42\x21\x10\x80\x00\x30\x00\x10\x06\x00\x06\x08\x00\x00\x39\x24\xf3"
-                              "\xcd\x34\x8e\x00\x31\x00\x0f\x06\x00\x04\x09\x01\x00\x26\xa2\x22\x22\xf0\x00\x32"
-                              "\x00\x10\x06\x00\x06\x08\x00\x00\x79\x20\x82\x10\x84\x7e\x00\x33\x00\x0f\x06\x00"
-                              "\x05\x08\x00\x00\x72\x46\xe0\x87\x2e\x00\x34\x00\x11\x06\x00\x06\x09\x00\x00\x10"
-                              "\x43\x0c\x52\x5f\xc5\x10\x00\x35\x00\x10\x06\x00\x05\x09\x00\x00\x09\xd0\xf4\x84"
-                              "\x31\x70\x00\x36\x00\x0f\x06\x00\x05\x08\x01\x00\x74\xbd\x29\xce\x4e\x00\x37\x00"
-                              "\x0f\x06\x00\x05\x08\x01\x00\xfc\xa4\x42\x11\x08\x00\x38\x00\x10\x06\x00\x06\x08"
-                              "\x00\x00\x39\x24\x9c\x5a\x18\x5e\x00\x39\x00\x0f\x06\x00\x05\x08\x01\x00\xf4\xa5"
-                              "\x39\xba\x5c\x00\x3A\x00\x0b\x03\x00\x01\x06\x01\x00\xcc\x00\x3B\x00\x0c\x03\x00"
-                              "\x02\x08\x01\xfe\xa0\xa6\x00\x3C\x00\x0e\x07\x00\x05\x06\x01\x00\x09\xb1\x06\x0c"
-                              "\x00\x3D\x00\x0c\x07\x00\x05\x03\x01\x01\xf8\x3e\x00\x3E\x00\x0e\x07\x00\x05\x06"
-                              "\x01\x00\x83\x04\x36\x40\x00\x3F\x00\x0f\x05\x00\x04\x09\x01\x00\xea\x32\x24\x44"
-                              "\xc0\x00\x40\x00\x13\x09\x00\x08\x09\x00\x00\x3e\x41\x4f\x93\x95\x95\x5a\x40\x3e"
-                              "\x00\x41\x00\x12\x07\x00\x07\x09\x00\x00\x10\x20\x61\x42\x87\x13\x22\xee\x00\x42"
-                              "\x00\x12\x07\x00\x07\x09\x00\x00\xfc\xc9\x93\x27\x8c\x99\xb3\xfc\x00\x43\x00\x11"
-                              "\x08\x00\x06\x09\x01\x00\x3d\x18\x60\x82\x08\x71\x78\x00\x44\x00\x13\x09\x00\x08"
-                              "\x09\x00\x00\xfe\x62\x61\x61\x61\x61\x63\x62\xfe\x00\x45\x00\x12\x08\x00\x07\x09"
-                              "\x00\x00\xfe\xc5\xab\x47\x8d\x1a\xb1\xfe\x00\x46\x00\x12\x07\x00\x07\x09\x00\x00"
-                              "\xfe\xc5\xab\x47\x8d\x1a\x30\xf0\x00\x47\x00\x12\x09\x00\x07\x09\x01\x00\x3c\x8a"
-                              "\x14\x08\xf0\xa1\x62\x7c\x00\x48\x00\x13\x09\x00\x08\x09\x00\x00\xf7\x62\x62\x62"
-                              "\x7e\x62\x62\x62\xf7\x00\x49\x00\x0f\x04\x00\x04\x09\x00\x00\xf6\x66\x66\x66\xf0"
-                              "\x00\x4A\x00\x10\x05\x00\x05\x09\x00\x00\x38\x84\x21\x08\x5a\xe0\x00\x4B\x00\x13"
-                              "\x08\x00\x08\x09\x00\x00\xfe\x68\x68\x68\x78\x68\x6c\x64\xf7\x00\x4C\x00\x12\x07"
-                              "\x00\x07\x09\x00\x00\xf0\xc1\x83\x06\x0c\x18\xb1\xfe\x00\x4D\x00\x16\x0a\x00\x0a"
-                              "\x09\x00\x00\xe1\xd8\x67\x29\x4a\x52\x97\x24\xc9\x22\xe9\xc0\x00\x4E\x00\x13\x08"
-                              "\x00\x08\x09\x00\x00\xe3\x72\x52\x5a\x4e\x46\x46\x42\xe2\x00\x4F\x00\x12\x09\x00"
-                              "\x07\x09\x01\x00\x79\x8a\x1c\x38\x70\xe1\xe2\x78\x00\x50\x00\x11\x07\x00\x06\x09"
-                              "\x00\x00\xfd\x96\x59\x65\xe6\x18\xf0\x00\x51\x00\x14\x09\x00\x07\x0b\x01\xfe\x79"
-                              "\x8a\x1c\x38\x70\xe1\x22\x38\x94\x18\x00\x52\x00\x12\x07\x00\x07\x09\x00\x00\xf8"
-                              "\xc9\x93\x27\x8c\x99\x32\xf6\x00\x53\x00\x10\x06\x00\x05\x09\x01\x00\xf4\xa1\x87"
-                              "\x0e\x31\xf0\x00\x54\x00\x12\x08\x00\x07\x09\x00\x00\xff\x36\x68\xc1\x83\x06\x0c"
-                              "\x3c\x00\x55\x00\x13\x09\x00\x08\x09\x00\x00\xf3\x61\x61\x61\x61\x61\x61\x62\x3e"
-                              "\x00\x56\x00\x12\x07\x00\x07\x09\x00\x00\xe6\xc8\x91\x22\x87\x04\x08\x10\x00\x57"
-                              "\x00\x17\x0b\x00\x0b\x09\x00\x00\xef\x68\xc9\xa9\x15\x22\xb8\x53\x0c\x40\x88\x11"
-                              "\x00\x00\x58\x00\x13\x08\x00\x08\x09\x00\x00\xf6\x24\x38\x10\x18\x18\x2c\x24\xef"
-                              "\x00\x59\x00\x12\x07\x00\x07\x09\x00\x00\xee\xc8\xa1\x81\x02\x04\x08\x38\x00\x5A"
-                              "\x00\x12\x08\x00\x07\x09\x00\x00\x7e\x89\x20\xc1\x06\x08\xb1\xfe\x00\x5B\x00\x0f"
-                              "\x04\x00\x03\x0c\x01\xfd\xf2\x49\x24\x92\x70\x00\x5C\x00\x10\x05\x00\x05\x09\x00"
-                              "\x00\x84\x10\x82\x10\x42\x08\x00\x5D\x00\x0d\x04\x00\x02\x0c\x00\xfd\xd5\x55\x57"
-                              "\x00\x5E\x00\x0e\x07\x00\x05\x05\x01\x04\x23\x15\x28\x80\x00\x5F\x00\x0b\x06\x00"
-                              "\x06\x01\x00\xfe\xfc\x00\x60\x00\x0b\x03\x00\x02\x02\x00\x07\x90\x00\x61\x00\x0e"
-                              "\x06\x00\x05\x06\x01\x00\xf4\x9d\x29\x7c\x00\x62\x00\x11\x07\x00\x06\x09\x00\x00"
-                              "\xc1\x04\x1e\x45\x14\x51\x78\x00\x63\x00\x0e\x06\x00\x05\x06\x01\x00\x74\xa1\x08"
-                              "\xb8\x00\x64\x00\x10\x07\x00\x05\x09\x01\x00\x30\x85\xe9\x4a\x52\xf8\x00\x65\x00"
-                              "\x0e\x06\x00\x05\x06\x01\x00\x74\xbf\x08\xb8\x00\x66\x00\x10\x04\x00\x05\x09\x00"
-                              "\x00\x32\x51\xc4\x21\x08\xe0\x00\x67\x00\x10\x06\x00\x05\x09\x01\xfd\x7c\xa5\xc8"
-                              "\x7e\x31\xf0\x00\x68\x00\x12\x07\x00\x07\x09\x00\x00\xc0\x81\x02\xc6\x48\x91\x22"
-                              "\xee\x00\x69\x00\x0d\x03\x00\x03\x08\x00\x00\x43\x24\x97\x00\x6A\x00\x0d\x03\x00"
-                              "\x02\x0a\x00\xfe\x4d\x55\x70\x00\x6B\x00\x11\x07\x00\x06\x09\x00\x00\xc1\x04\x16"
-                              "\x51\xc5\x92\xec\x00\x6C\x00\x0e\x03\x00\x03\x09\x00\x00\xc9\x24\x92\xe0\x00\x6D"
-                              "\x00\x12\x0a\x00\x0a\x06\x00\x00\xdb\x99\x24\x49\x12\x44\xbb\xf0\x00\x6E\x00\x10"
-                              "\x07\x00\x07\x06\x00\x00\xd8\xc9\x12\x24\x5d\xc0\x00\x6F\x00\x0e\x06\x00\x05\x06"
-                              "\x01\x00\x74\xa7\x39\x38\x00\x70\x00\x11\x07\x00\x06\x09\x00\xfd\xf9\x14\x51\x45"
-                              "\xe4\x10\xe0\x00\x71\x00\x10\x07\x00\x05\x09\x01\xfd\xf4\xa5\x29\x78\x42\x38\x00"
-                              "\x72\x00\x0e\x05\x00\x05\x06\x00\x00\xdb\x50\x84\x70\x00\x73\x00\x0d\x05\x00\x04"
-                              "\x06\x01\x00\xea\xc6\x9e\x00\x74\x00\x0e\x04\x00\x04\x08\x00\x00\x44\xe4\x44\x47"
-                              "\x00\x75\x00\x10\x07\x00\x07\x06\x00\x00\xcc\x89\x12\x24\x4f\xc0\x00\x76\x00\x0f"
-                              "\x06\x00\x06\x06\x00\x00\xed\x22\x8c\x30\x80\x00\x77\x00\x11\x09\x00\x09\x06\x00"
-                              "\x00\xff\xa6\x8d\x46\xc2\x21\x10\x00\x78\x00\x0f\x06\x00\x06\x06\x00\x00\xec\xa3"
-                              "\x04\x3b\xf0\x00\x79\x00\x11\x06\x00\x06\x09\x00\xfd\xed\x22\x8c\x30\x41\x28\x40"
-                              "\x00\x7A\x00\x0e\x06\x00\x05\x06\x00\x00\x7c\x8c\x44\xfc\x00\x7B\x00\x10\x04\x00"
-                              "\x04\x0b\x00\xfe\x34\x44\x4c\x44\x44\x70\x00\x7C\x00\x0c\x02\x00\x01\x0c\x01\xfd"
-                              "\xff\xf0\x00\x7D\x00\x10\x04\x00\x04\x0b\x00\xfe\xc4\x44\x43\x24\x44\xc0\x00\x7E"
-                              "\x00\x0c\x07\x00\x05\x02\x01\x02\xcd\x80\x00\xA1\x00\x0c\x03\x00\x01\x09\x01\xfd"
-                              "\xff\x80\x00\xA2\x00\x10\x06\x00\x05\x09\x01\xff\x21\x1d\x7a\x52\xae\x20\x00\xA3"
-                              "\x00\x10\x06\x00\x06\x08\x00\x00\x3c\x82\x3e\x20\x92\x7e\x00\xA4\x00\x0f\x06\x00"
-                              "\x06\x06\x00\x01\xb5\x28\x61\x4a\xd0\x00\xA5\x00\x10\x06\x00\x06\x08\x00\x00\xed"
-                              "\xa2\x9e\x11\xe1\x1e\x00\xA6\x00\x0c\x02\x00\x01\x09\x01\xff\xe3\x80\x00\xA7\x00"
-                              "\x12\x06\x00\x05\x0c\x01\xfd\x74\xa1\x8e\x49\x45\x1c\xa5\xc0\x00\xA8\x00\x0b\x03"
-                              "\x00\x03\x01\x00\x07\xa0\x00\xA9\x00\x13\x09\x00\x08\x09\x00\x00\x1c\x62\x5d\xa3"
-                              "\xa1\xa3\x5d\x62\x1c\x00\xAA\x00\x0c\x04\x00\x04\x04\x00\x04\x66\xa5\x00\xAB\x00"
-                              "\x0c\x05\x00\x04\x03\x00\x01\x5a\x70\x00\xAC\x00\x0c\x07\x00\x05\x03\x01\x02\xf8"
-                              "\x42\x00\xAD\x00\x0b\x04\x00\x02\x01\x01\x02\xc0\x00\xAE\x00\x0d\x05\x00\x04\x05"
-                              "\x01\x04\x6d\xde\x40\x00\xAF\x00\x0b\x03\x00\x03\x01\x00\x07\xe0\x00\xB0\x00\x0c"
-                              "\x04\x00\x03\x04\x01\x05\xd6\xe0\x00\xB1\x00\x0e\x07\x00\x05\x06\x01\x00\x21\x3e"
-                              "\x42\x7c\x00\xB2\x00\x0d\x04\x00\x04\x05\x00\x04\xf5\x24\xf0\x00\xB3\x00\x0d\x04"
-                              "\x00\x04\x05\x00\x04\xe1\x61\xf0\x00\xB4\x00\x0b\x03\x00\x02\x02\x01\x07\x60\x00"
-                              "\xB5\x00\x12\x07\x00\x07\x09\x00\xfd\xcc\x89\x12\x24\x4f\xd0\x20\x40\x00\xB6\x00"
-                              "\x13\x07\x00\x06\x0b\x00\xfe\x7f\xae\xba\x68\x61\x86\x19\x62\x00\x00\xB7\x00\x0b"
-                              "\x03\x00\x01\x01\x01\x03\x80\x00\xB8\x00\x0b\x03\x00\x03\x02\x00\xfd\x78\x00\xB9"
-                              "\x00\x0c\x04\x00\x02\x05\x01\x04\x75\xc0\x00\xBA\x00\x0c\x04\x00\x04\x04\x00\x04"
-                              "\x69\x96\x00\xBB\x00\x0c\x05\x00\x04\x03\x00\x01\xf7\xe0\x00\xBC\x00\x12\x09\x00"
-                              "\x07\x09\x01\x00\x45\x0a\x24\x49\x3c\xca\xa7\x42\x00\xBD\x00\x13\x09\x00\x08\x09"
-                              "\x01\x00\x44\x84\x88\x88\x96\xe5\x22\x45\x4e\x00\xBE\x00\x15\x09\x00\x09\x09\x00"
-                              "\x00\x61\x29\x19\x02\x89\x93\x58\x4e\x2f\x21\x00\x00\xBF\x00\x0f\x05\x00\x04\x09"
-                              "\x00\xfd\x32\x22\x4c\x89\x70\x00\xC0\x00\x14\x07\x00\x07\x0b\x00\x00\x20\x30\x40"
-                              "\x81\x85\x0a\x1c\x4c\x8b\xb8\x00\xC1\x00\x14\x07\x00\x07\x0b\x00\x00\x08\x20\x40"
-                              "\x81\x85\x0a\x1c\x4c\x8b\xb8\x00\xC2\x00\x14\x07\x00\x07\x0b\x00\x00\x10\x50\x40"
-                              "\x81\x85\x0a\x1c\x4c\x8b\xb8\x00\xC3\x00\x14\x07\x00\x07\x0b\x00\x00\x34\x50\x40"
-                              "\x81\x85\x0a\x1c\x4c\x8b\xb8\x00\xC4\x00\x13\x07\x00\x07\x0a\x00\x00\x28\x20\x40"
-                              "\xc2\x85\x0e\x26\x45\xdc\x00\xC5\x00\x15\x07\x00\x07\x0c\x00\x00\x10\x50\x40\x81"
-                              "\x03\x0a\x14\x38\x99\x17\x70\x00\xC6\x00\x16\x0b\x00\x0a\x09\x00\x00\x1f\xc5\x11"
-                              "\x4c\x54\x27\x0f\x24\x45\x11\xcf\xc0\x00\xC7\x00\x13\x08\x00\x06\x0c\x01\xfd\x3d"
-                              "\x18\x60\x82\x08\x71\x78\x83\x0c\x00\xC8\x00\x14\x08\x00\x07\x0b\x00\x00\x20\x23"
-                              "\xbb\x16\xad\x1e\x34\x6a\xc7\xf8\x00\xC9\x00\x14\x08\x00\x07\x0b\x00\x00\x0c\x23"
-                              "\xbb\x16\xad\x1e\x34\x6a\xc7\xf8\x00\xCA\x00\x14\x08\x00\x07\x0b\x00\x00\x18\x53"
-                              "\xdb\x16\xad\x1e\x34\x6a\xc7\xf8\x00\xCB\x00\x14\x08\x00\x07\x0b\x00\x00\x2c\x03"
-                              "\xfb\x16\xad\x1e\x34\x6a\xc7\xf8\x00\xCC\x00\x10\x04\x00\x04\x0b\x00\x00\xc2\xf6"
-                              "\x66\x66\x66\xf0\x00\xCD\x00\x10\x04\x00\x04\x0b\x00\x00\x12\xf6\x66\x66\x66\xf0"
-                              "\x00\xCE\x00\x10\x04\x00\x04\x0b\x00\x00\x69\x66\x66\x66\x66\xf0\x00\xCF\x00\x10"
-                              "\x04\x00\x04\x0b\x00\x00\xd0\xf6\x66\x66\x66\xf0\x00\xD0\x00\x13\x09\x00\x08\x09"
-                              "\x00\x00\xfe\x62\x61\x61\xf1\x61\x63\x62\xfe\x00\xD1\x00\x15\x08\x00\x08\x0b\x00"
-                              "\x00\x14\x2c\xe3\x72\x52\x5a\x4e\x46\x46\x42\xe2\x00\xD2\x00\x14\x09\x00\x07\x0b"
-                              "\x01\x00\x20\x21\xa6\x28\x70\xe1\xc3\x87\x89\xe0\x00\xD3\x00\x14\x09\x00\x07\x0b"
-                              "\x01\x00\x08\x21\xa6\x28\x70\xe1\xc3\x87\x89\xe0\x00\xD4\x00\x14\x09\x00\x07\x0b"
-                              "\x01\x00\x10\x51\x66\x28\x70\xe1\xc3\x87\x89\xe0\x00\xD5\x00\x14\x09\x00\x07\x0b"
-                              "\x01\x00\x28\xb1\xa6\x28\x70\xe1\xc3\x87\x89\xe0\x00\xD6\x00\x14\x09\x00\x07\x0b"
-                              "\x01\x00\x28\x01\xe6\x28\x70\xe1\xc3\x87\x89\xe0\x00\xD7\x00\x0e\x07\x00\x05\x05"
-                              "\x01\x00\x8a\x88\xa8\x80\x00\xD8\x00\x12\x09\x00\x07\x09\x01\x00\x7b\x8a\x1c\x79"
-                              "\x74\xf1\xe2\xf8\x00\xD9\x00\x15\x09\x00\x08\x0b\x00\x00\x10\x08\xf3\x61\x61\x61"
-                              "\x61\x61\x61\x62\x3e\x00\xDA\x00\x15\x09\x00\x08\x0b\x00\x00\x04\x08\xf3\x61\x61"
-                              "\x61\x61\x61\x61\x62\x3e\x00\xDB\x00\x15\x09\x00\x08\x0b\x00\x00\x08\x14\xe3\x61"
-                              "\x61\x61\x61\x61\x61\x62\x3e\x00\xDC\x00\x15\x09\x00\x08\x0b\x00\x00\x14\x00\xf3"
-                              "\x61\x61\x61\x61\x61\x61\x62\x3e\x00\xDD\x00\x14\x07\x00\x07\x0b\x00\x00\x08\x23"
-                              "\xbb\x22\x86\x04\x08\x10\x20\xe0\x00\xDE\x00\x11\x07\x00\x06\x09\x00\x00\xf1\x87"
-                              "\x99\x65\x97\x98\xf0\x00\xDF\x00\x11\x07\x00\x06\x09\x00\x00\x39\x14\xd6\x45\x14"
-                              "\x55\xf8\x00\xE0\x00\x10\x06\x00\x05\x09\x01\x00\x83\x01\xe9\x3a\x52\xf8\x00\xE1"
-                              "\x00\x10\x06\x00\x05\x09\x01\x00\x11\x11\xe9\x3a\x52\xf8\x00\xE2\x00\x10\x06\x00"
-                              "\x05\x09\x01\x00\x62\xa1\xe9\x3a\x52\xf8\x00\xE3\x00\x0f\x06\x00\x05\x08\x01\x00"
-                              "\xf0\x3d\x27\x4a\x5f\x00\xE4\x00\x0f\x06\x00\x05\x08\x01\x00\xd0\x3d\x27\x4a\x5f"
-                              "\x00\xE5\x00\x10\x06\x00\x05\x09\x01\x00\x63\x19\x29\x3a\x52\xf8\x00\xE6\x00\x11"
-                              "\x09\x00\x09\x06\x00\x00\x77\x24\x8f\xe9\x0c\x8b\xf8\x00\xE7\x00\x10\x06\x00\x05"
-                              "\x09\x01\xfd\x74\xa1\x08\xb9\x0c\x60\x00\xE8\x00\x10\x06\x00\x05\x09\x01\x00\x83"
-                              "\x00\xe9\x7e\x11\x70\x00\xE9\x00\x10\x06\x00\x05\x09\x01\x00\x11\x10\xe9\x7e\x11"
-                              "\x70\x00\xEA\x00\x10\x06\x00\x05\x09\x01\x00\x62\xa0\xe9\x7e\x11\x70\x00\xEB\x00"
-                              "\x0f\x06\x00\x05\x08\x01\x00\xd0\x1d\x2f\xc2\x2e\x00\xEC\x00\x0e\x03\x00\x03\x09"
-                              "\x00\x00\x88\xe4\x92\xe0\x00\xED\x00\x0e\x03\x00\x03\x09\x00\x00\x28\x64\x92\xe0"
-                              "\x00\xEE\x00\x0e\x03\x00\x03\x09\x00\x00\x54\x64\x92\xe0\x00\xEF\x00\x0d\x03\x00"
-                              "\x03\x08\x00\x00\xa3\x24\x97\x00\xF0\x00\x10\x06\x00\x05\x09\x01\x00\xf5\x04\xe9"
-                              "\xce\x72\x70\x00\xF1\x00\x11\x07\x00\x07\x08\x00\x00\x38\x03\x63\x24\x48\x91\x77"
-                              "\x00\xF2\x00\x10\x06\x00\x05\x09\x01\x00\xc3\x00\xe9\x4e\x72\x70\x00\xF3\x00\x10"
-                              "\x06\x00\x05\x09\x01\x00\x11\x10\xe9\x4e\x72\x70\x00\xF4\x00\x10\x06\x00\x05\x09"
-                              "\x01\x00\x62\xa0\xe9\x4e\x72\x70\x00\xF5\x00\x0f\x06\x00\x05\x08\x01\x00\xf0\x1d"
-                              "\x29\xce\x4e\x00\xF6\x00\x0f\x06\x00\x05\x08\x01\x00\xd0\x1d\x29\xce\x4e\x00\xF7"
-                              "\x00\x0e\x07\x00\x05\x06\x01\x00\x21\x3e\x02\x10\x00\xF8\x00\x0e\x06\x00\x05\x06"
-                              "\x01\x00\x7c\xaf\xb9\x78\x00\xF9\x00\x12\x07\x00\x07\x09\x00\x00\x20\x20\x06\x64"
-                              "\x48\x91\x22\x7e\x00\xFA\x00\x12\x07\x00\x07\x09\x00\x00\x08\x20\x06\x64\x48\x91"
-                              "\x22\x7e\x00\xFB\x00\x12\x07\x00\x07\x09\x00\x00\x10\x50\x06\x64\x48\x91\x22\x7e"
-                              "\x00\xFC\x00\x11\x07\x00\x07\x08\x00\x00\x28\x03\x32\x24\x48\x91\x3f\x00\xFD\x00"
-                              "\x13\x06\x00\x06\x0c\x00\xfd\x18\xc0\x3b\x48\xa3\x0c\x10\x4a\x10\x00\xFE\x00\x13"
-                              "\x07\x00\x06\x0c\x00\xfd\xc1\x04\x1e\x45\x14\x51\x79\x04\x38\x00\xFF\x00\x13\x06"
-                              "\x00\x06\x0b\x00\xfd\x58\x0e\xd2\x28\xc3\x04\x12\x84\x00\x01\x31\x00\x0d\x03\x00"
-                              "\x03\x06\x00\x00\xc9\x25\xc0\x01\x41\x00\x12\x07\x00\x07\x09\x00\x00\xf0\xc1\xa3"
-                              "\x86\x1c\x18\xb1\xfe\x01\x42\x00\x0e\x03\x00\x03\x09\x00\x00\xc9\xb5\x92\xe0\x01"
-                              "\x52\x00\x17\x0c\x00\x0b\x09\x01\x00\x7f\xd8\x8a\x12\xc2\x48\x71\x09\x21\x2e\x21"
-                              "\x7f\xc0\x01\x53\x00\x10\x0a\x00\x08\x06\x01\x00\x7e\x99\x9f\x98\x99\xff\x01\x60"
-                              "\x00\x11\x06\x00\x05\x0b\x01\x00\x93\x25\x28\x61\xc3\x8c\x7c\x01\x61\x00\x0f\x05"
-                              "\x00\x04\x09\x01\x00\xa4\x0e\xac\x69\xe0\x01\x78\x00\x13\x07\x00\x07\x0a\x00\x00"
-                              "\x29\x8d\x91\x43\x02\x04\x08\x10\x70\x01\x7D\x00\x14\x08\x00\x07\x0b\x00\x00\x2c"
-                              "\x31\x9a\x24\x83\x04\x18\x22\xc7\xf8\x01\x7E\x00\x10\x06\x00\x05\x09\x00\x00\x51"
-                              "\x80\xf9\x18\x89\xf8\x01\x92\x00\x13\x06\x00\x06\x0b\x00\xfd\x0c\x51\x04\x78\xc2"
-                              "\x08\x22\x8c\x00\x02\xC6\x00\x0b\x03\x00\x03\x02\x00\x07\x54\x02\xC7\x00\x0b\x03"
-                              "\x00\x03\x02\x00\x07\xa8\x02\xD8\x00\x0b\x03\x00\x03\x02\x00\x07\xbc\x02\xD9\x00"
-                              "\x0b\x03\x00\x01\x01\x01\x07\x80\x02\xDA\x00\x0c\x03\x00\x03\x03\x00\x06\x55\x00"
-                              "\x02\xDB\x00\x0c\x03\x00\x03\x03\x00\xfd\x51\x80\x02\xDC\x00\x0b\x03\x00\x03\x01"
-                              "\x00\x07\xe0\x02\xDD\x00\x0b\x03\x00\x04\x02\x00\x07\x5a\x20\x13\x00\x0b\x06\x00"
-                              "\x06\x01\x00\x02\xfc\x20\x14\x00\x0c\x0b\x00\x09\x01\x01\x02\xff\x80\x20\x18\x00"
-                              "\x0b\x03\x00\x01\x04\x01\x05\xf0\x20\x19\x00\x0b\x03\x00\x01\x04\x01\x05\xf0\x20"
-                              "\x1A\x00\x0b\x03\x00\x01\x04\x01\xfe\xf0\x20\x1C\x00\x0c\x05\x00\x04\x04\x01\x05"
-                              "\x9a\xab\x20\x1D\x00\x0c\x05\x00\x04\x04\x01\x05\xab\x9a\x20\x1E\x00\x0c\x05\x00"
-                              "\x04\x04\x01\xfe\xab\x9a\x20\x20\x00\x11\x05\x00\x05\x0b\x00\xfe\x21\x09\xf2\x10"
-                              "\x84\x21\x08\x20\x21\x00\x11\x05\x00\x05\x0b\x00\xfe\x21\x09\xf2\x13\xe4\x21\x08"
-                              "\x20\x22\x00\x0d\x06\x00\x04\x05\x01\x02\x4e\xff\x60\x20\x26\x00\x0d\x0b\x00\x09"
-                              "\x02\x01\x00\x88\xe4\xc0\x20\x30\x00\x17\x0b\x00\x0b\x09\x00\x00\x04\x0c\x82\x60"
-                              "\x48\x07\x00\x29\x8a\xca\x59\x4e\xc0\x20\x39\x00\x0c\x03\x00\x03\x03\x00\x01\x79"
-                              "\x80\x20\x3A\x00\x0c\x03\x00\x03\x03\x00\x01\xcd\x00\x20\x44\x00\x11\x02\x00\x06"
-                              "\x09\xfe\x00\x04\x20\x84\x20\x84\x10\x80\x21\x22\x00\x11\x0b\x00\x0b\x05\x00\x03"
-                              "\xf4\x76\xc8\x9b\x13\x66\x56\x22\x12\x00\x0b\x07\x00\x05\x01\x01\x02\xf8\xFB\x00"
-                              "\x00\x13\x07\x00\x08\x09\x00\x00\x07\x7d\x44\xee\x44\x44\x44\x44\xee\xFB\x01\x00"
-                              "\x12\x07\x00\x07\x09\x00\x00\x38\x91\x07\x64\x48\x91\x22\xee\xFB\x02\x00\x12\x07"
-                              "\x00\x07\x09\x00\x00\x3c\x89\x17\x24\x48\x91\x22\xee\xFB\x03\x00\x16\x0b\x00\x0a"
-                              "\x09\x00\x00\x03\x9f\x24\x43\xbe\x44\x91\x24\x49\x12\xef\xc0\xFB\x04\x00\x16\x0b"
-                              "\x00\x0a\x09\x00\x00\x03\x9f\x24\x4b\xba\x44\x91\x24\x49\x12\xef\xc0";
+static constexpr Character bailleul_8_pt_characters[233] = {
+    {0x0000, 0, 5, 8, 4, 8, 0, 0},
+    {0x0020, 4, 3, 0, 0, 0, 0, 0},
+    {0x0021, 4, 3, 0, 1, 9, 1, 0},
+    {0x0022, 6, 5, 0, 3, 4, 1, 5},
+    {0x0023, 8, 6, 0, 6, 8, 0, 0},
+    {0x0024, 14, 6, 0, 5, 11, 1, -1},
+    {0x0025, 21, 11, 0, 9, 9, 1, 0},
+    {0x0026, 32, 8, 0, 8, 9, 0, 0},
+    {0x0027, 41, 3, 0, 1, 4, 1, 5},
+    {0x0028, 42, 4, 0, 3, 11, 1, -3},
+    {0x0029, 47, 4, 0, 4, 11, 0, -3},
+    {0x002A, 53, 4, 0, 4, 4, 0, 5},
+    {0x002B, 55, 7, 0, 5, 6, 1, 0},
+    {0x002C, 59, 3, 0, 2, 4, 1, -2},
+    {0x002D, 60, 4, 0, 3, 1, 1, 2},
+    {0x002E, 61, 3, 0, 1, 2, 1, 0},
+    {0x002F, 62, 5, 0, 5, 9, 0, 0},
+    {0x0030, 68, 6, 0, 6, 8, 0, 0},
+    {0x0031, 74, 6, 0, 4, 9, 1, 0},
+    {0x0032, 79, 6, 0, 6, 8, 0, 0},
+    {0x0033, 85, 6, 0, 5, 8, 0, 0},
+    {0x0034, 90, 6, 0, 6, 9, 0, 0},
+    {0x0035, 97, 6, 0, 5, 9, 0, 0},
+    {0x0036, 103, 6, 0, 5, 8, 1, 0},
+    {0x0037, 108, 6, 0, 5, 8, 1, 0},
+    {0x0038, 113, 6, 0, 6, 8, 0, 0},
+    {0x0039, 119, 6, 0, 5, 8, 1, 0},
+    {0x003A, 124, 3, 0, 1, 6, 1, 0},
+    {0x003B, 125, 3, 0, 2, 8, 1, -2},
+    {0x003C, 127, 7, 0, 5, 6, 1, 0},
+    {0x003D, 131, 7, 0, 5, 3, 1, 1},
+    {0x003E, 133, 7, 0, 5, 6, 1, 0},
+    {0x003F, 137, 5, 0, 4, 9, 1, 0},
+    {0x0040, 142, 9, 0, 8, 9, 0, 0},
+    {0x0041, 151, 7, 0, 7, 9, 0, 0},
+    {0x0042, 159, 7, 0, 7, 9, 0, 0},
+    {0x0043, 167, 8, 0, 6, 9, 1, 0},
+    {0x0044, 174, 9, 0, 8, 9, 0, 0},
+    {0x0045, 183, 8, 0, 7, 9, 0, 0},
+    {0x0046, 191, 7, 0, 7, 9, 0, 0},
+    {0x0047, 199, 9, 0, 7, 9, 1, 0},
+    {0x0048, 207, 9, 0, 8, 9, 0, 0},
+    {0x0049, 216, 4, 0, 4, 9, 0, 0},
+    {0x004A, 221, 5, 0, 5, 9, 0, 0},
+    {0x004B, 227, 8, 0, 8, 9, 0, 0},
+    {0x004C, 236, 7, 0, 7, 9, 0, 0},
+    {0x004D, 244, 10, 0, 10, 9, 0, 0},
+    {0x004E, 256, 8, 0, 8, 9, 0, 0},
+    {0x004F, 265, 9, 0, 7, 9, 1, 0},
+    {0x0050, 273, 7, 0, 6, 9, 0, 0},
+    {0x0051, 280, 9, 0, 7, 11, 1, -2},
+    {0x0052, 290, 7, 0, 7, 9, 0, 0},
+    {0x0053, 298, 6, 0, 5, 9, 1, 0},
+    {0x0054, 304, 8, 0, 7, 9, 0, 0},
+    {0x0055, 312, 9, 0, 8, 9, 0, 0},
+    {0x0056, 321, 7, 0, 7, 9, 0, 0},
+    {0x0057, 329, 11, 0, 11, 9, 0, 0},
+    {0x0058, 342, 8, 0, 8, 9, 0, 0},
+    {0x0059, 351, 7, 0, 7, 9, 0, 0},
+    {0x005A, 359, 8, 0, 7, 9, 0, 0},
+    {0x005B, 367, 4, 0, 3, 12, 1, -3},
+    {0x005C, 372, 5, 0, 5, 9, 0, 0},
+    {0x005D, 378, 4, 0, 2, 12, 0, -3},
+    {0x005E, 381, 7, 0, 5, 5, 1, 4},
+    {0x005F, 385, 6, 0, 6, 1, 0, -2},
+    {0x0060, 386, 3, 0, 2, 2, 0, 7},
+    {0x0061, 387, 6, 0, 5, 6, 1, 0},
+    {0x0062, 391, 7, 0, 6, 9, 0, 0},
+    {0x0063, 398, 6, 0, 5, 6, 1, 0},
+    {0x0064, 402, 7, 0, 5, 9, 1, 0},
+    {0x0065, 408, 6, 0, 5, 6, 1, 0},
+    {0x0066, 412, 4, 0, 5, 9, 0, 0},
+    {0x0067, 418, 6, 0, 5, 9, 1, -3},
+    {0x0068, 424, 7, 0, 7, 9, 0, 0},
+    {0x0069, 432, 3, 0, 3, 8, 0, 0},
+    {0x006A, 435, 3, 0, 2, 10, 0, -2},
+    {0x006B, 438, 7, 0, 6, 9, 0, 0},
+    {0x006C, 445, 3, 0, 3, 9, 0, 0},
+    {0x006D, 449, 10, 0, 10, 6, 0, 0},
+    {0x006E, 457, 7, 0, 7, 6, 0, 0},
+    {0x006F, 463, 6, 0, 5, 6, 1, 0},
+    {0x0070, 467, 7, 0, 6, 9, 0, -3},
+    {0x0071, 474, 7, 0, 5, 9, 1, -3},
+    {0x0072, 480, 5, 0, 5, 6, 0, 0},
+    {0x0073, 484, 5, 0, 4, 6, 1, 0},
+    {0x0074, 487, 4, 0, 4, 8, 0, 0},
+    {0x0075, 491, 7, 0, 7, 6, 0, 0},
+    {0x0076, 497, 6, 0, 6, 6, 0, 0},
+    {0x0077, 502, 9, 0, 9, 6, 0, 0},
+    {0x0078, 509, 6, 0, 6, 6, 0, 0},
+    {0x0079, 514, 6, 0, 6, 9, 0, -3},
+    {0x007A, 521, 6, 0, 5, 6, 0, 0},
+    {0x007B, 525, 4, 0, 4, 11, 0, -2},
+    {0x007C, 531, 2, 0, 1, 12, 1, -3},
+    {0x007D, 533, 4, 0, 4, 11, 0, -2},
+    {0x007E, 539, 7, 0, 5, 2, 1, 2},
+    {0x00A1, 541, 3, 0, 1, 9, 1, -3},
+    {0x00A2, 543, 6, 0, 5, 9, 1, -1},
+    {0x00A3, 549, 6, 0, 6, 8, 0, 0},
+    {0x00A4, 555, 6, 0, 6, 6, 0, 1},
+    {0x00A5, 560, 6, 0, 6, 8, 0, 0},
+    {0x00A6, 566, 2, 0, 1, 9, 1, -1},
+    {0x00A7, 568, 6, 0, 5, 12, 1, -3},
+    {0x00A8, 576, 3, 0, 3, 1, 0, 7},
+    {0x00A9, 577, 9, 0, 8, 9, 0, 0},
+    {0x00AA, 586, 4, 0, 4, 4, 0, 4},
+    {0x00AB, 588, 5, 0, 4, 3, 0, 1},
+    {0x00AC, 590, 7, 0, 5, 3, 1, 2},
+    {0x00AD, 592, 4, 0, 2, 1, 1, 2},
+    {0x00AE, 593, 5, 0, 4, 5, 1, 4},
+    {0x00AF, 596, 3, 0, 3, 1, 0, 7},
+    {0x00B0, 597, 4, 0, 3, 4, 1, 5},
+    {0x00B1, 599, 7, 0, 5, 6, 1, 0},
+    {0x00B2, 603, 4, 0, 4, 5, 0, 4},
+    {0x00B3, 606, 4, 0, 4, 5, 0, 4},
+    {0x00B4, 609, 3, 0, 2, 2, 1, 7},
+    {0x00B5, 610, 7, 0, 7, 9, 0, -3},
+    {0x00B6, 618, 7, 0, 6, 11, 0, -2},
+    {0x00B7, 627, 3, 0, 1, 1, 1, 3},
+    {0x00B8, 628, 3, 0, 3, 2, 0, -3},
+    {0x00B9, 629, 4, 0, 2, 5, 1, 4},
+    {0x00BA, 631, 4, 0, 4, 4, 0, 4},
+    {0x00BB, 633, 5, 0, 4, 3, 0, 1},
+    {0x00BC, 635, 9, 0, 7, 9, 1, 0},
+    {0x00BD, 643, 9, 0, 8, 9, 1, 0},
+    {0x00BE, 652, 9, 0, 9, 9, 0, 0},
+    {0x00BF, 663, 5, 0, 4, 9, 0, -3},
+    {0x00C0, 668, 7, 0, 7, 11, 0, 0},
+    {0x00C1, 678, 7, 0, 7, 11, 0, 0},
+    {0x00C2, 688, 7, 0, 7, 11, 0, 0},
+    {0x00C3, 698, 7, 0, 7, 11, 0, 0},
+    {0x00C4, 708, 7, 0, 7, 10, 0, 0},
+    {0x00C5, 717, 7, 0, 7, 12, 0, 0},
+    {0x00C6, 728, 11, 0, 10, 9, 0, 0},
+    {0x00C7, 740, 8, 0, 6, 12, 1, -3},
+    {0x00C8, 749, 8, 0, 7, 11, 0, 0},
+    {0x00C9, 759, 8, 0, 7, 11, 0, 0},
+    {0x00CA, 769, 8, 0, 7, 11, 0, 0},
+    {0x00CB, 779, 8, 0, 7, 11, 0, 0},
+    {0x00CC, 789, 4, 0, 4, 11, 0, 0},
+    {0x00CD, 795, 4, 0, 4, 11, 0, 0},
+    {0x00CE, 801, 4, 0, 4, 11, 0, 0},
+    {0x00CF, 807, 4, 0, 4, 11, 0, 0},
+    {0x00D0, 813, 9, 0, 8, 9, 0, 0},
+    {0x00D1, 822, 8, 0, 8, 11, 0, 0},
+    {0x00D2, 833, 9, 0, 7, 11, 1, 0},
+    {0x00D3, 843, 9, 0, 7, 11, 1, 0},
+    {0x00D4, 853, 9, 0, 7, 11, 1, 0},
+    {0x00D5, 863, 9, 0, 7, 11, 1, 0},
+    {0x00D6, 873, 9, 0, 7, 11, 1, 0},
+    {0x00D7, 883, 7, 0, 5, 5, 1, 0},
+    {0x00D8, 887, 9, 0, 7, 9, 1, 0},
+    {0x00D9, 895, 9, 0, 8, 11, 0, 0},
+    {0x00DA, 906, 9, 0, 8, 11, 0, 0},
+    {0x00DB, 917, 9, 0, 8, 11, 0, 0},
+    {0x00DC, 928, 9, 0, 8, 11, 0, 0},
+    {0x00DD, 939, 7, 0, 7, 11, 0, 0},
+    {0x00DE, 949, 7, 0, 6, 9, 0, 0},
+    {0x00DF, 956, 7, 0, 6, 9, 0, 0},
+    {0x00E0, 963, 6, 0, 5, 9, 1, 0},
+    {0x00E1, 969, 6, 0, 5, 9, 1, 0},
+    {0x00E2, 975, 6, 0, 5, 9, 1, 0},
+    {0x00E3, 981, 6, 0, 5, 8, 1, 0},
+    {0x00E4, 986, 6, 0, 5, 8, 1, 0},
+    {0x00E5, 991, 6, 0, 5, 9, 1, 0},
+    {0x00E6, 997, 9, 0, 9, 6, 0, 0},
+    {0x00E7, 1004, 6, 0, 5, 9, 1, -3},
+    {0x00E8, 1010, 6, 0, 5, 9, 1, 0},
+    {0x00E9, 1016, 6, 0, 5, 9, 1, 0},
+    {0x00EA, 1022, 6, 0, 5, 9, 1, 0},
+    {0x00EB, 1028, 6, 0, 5, 8, 1, 0},
+    {0x00EC, 1033, 3, 0, 3, 9, 0, 0},
+    {0x00ED, 1037, 3, 0, 3, 9, 0, 0},
+    {0x00EE, 1041, 3, 0, 3, 9, 0, 0},
+    {0x00EF, 1045, 3, 0, 3, 8, 0, 0},
+    {0x00F0, 1048, 6, 0, 5, 9, 1, 0},
+    {0x00F1, 1054, 7, 0, 7, 8, 0, 0},
+    {0x00F2, 1061, 6, 0, 5, 9, 1, 0},
+    {0x00F3, 1067, 6, 0, 5, 9, 1, 0},
+    {0x00F4, 1073, 6, 0, 5, 9, 1, 0},
+    {0x00F5, 1079, 6, 0, 5, 8, 1, 0},
+    {0x00F6, 1084, 6, 0, 5, 8, 1, 0},
+    {0x00F7, 1089, 7, 0, 5, 6, 1, 0},
+    {0x00F8, 1093, 6, 0, 5, 6, 1, 0},
+    {0x00F9, 1097, 7, 0, 7, 9, 0, 0},
+    {0x00FA, 1105, 7, 0, 7, 9, 0, 0},
+    {0x00FB, 1113, 7, 0, 7, 9, 0, 0},
+    {0x00FC, 1121, 7, 0, 7, 8, 0, 0},
+    {0x00FD, 1128, 6, 0, 6, 12, 0, -3},
+    {0x00FE, 1137, 7, 0, 6, 12, 0, -3},
+    {0x00FF, 1146, 6, 0, 6, 11, 0, -3},
+    {0x0131, 1155, 3, 0, 3, 6, 0, 0},
+    {0x0141, 1158, 7, 0, 7, 9, 0, 0},
+    {0x0142, 1166, 3, 0, 3, 9, 0, 0},
+    {0x0152, 1170, 12, 0, 11, 9, 1, 0},
+    {0x0153, 1183, 10, 0, 8, 6, 1, 0},
+    {0x0160, 1189, 6, 0, 5, 11, 1, 0},
+    {0x0161, 1196, 5, 0, 4, 9, 1, 0},
+    {0x0178, 1201, 7, 0, 7, 10, 0, 0},
+    {0x017D, 1210, 8, 0, 7, 11, 0, 0},
+    {0x017E, 1220, 6, 0, 5, 9, 0, 0},
+    {0x0192, 1226, 6, 0, 6, 11, 0, -3},
+    {0x02C6, 1235, 3, 0, 3, 2, 0, 7},
+    {0x02C7, 1236, 3, 0, 3, 2, 0, 7},
+    {0x02D8, 1237, 3, 0, 3, 2, 0, 7},
+    {0x02D9, 1238, 3, 0, 1, 1, 1, 7},
+    {0x02DA, 1239, 3, 0, 3, 3, 0, 6},
+    {0x02DB, 1241, 3, 0, 3, 3, 0, -3},
+    {0x02DC, 1243, 3, 0, 3, 1, 0, 7},
+    {0x02DD, 1244, 3, 0, 4, 2, 0, 7},
+    {0x2013, 1245, 6, 0, 6, 1, 0, 2},
+    {0x2014, 1246, 11, 0, 9, 1, 1, 2},
+    {0x2018, 1248, 3, 0, 1, 4, 1, 5},
+    {0x2019, 1249, 3, 0, 1, 4, 1, 5},
+    {0x201A, 1250, 3, 0, 1, 4, 1, -2},
+    {0x201C, 1251, 5, 0, 4, 4, 1, 5},
+    {0x201D, 1253, 5, 0, 4, 4, 1, 5},
+    {0x201E, 1255, 5, 0, 4, 4, 1, -2},
+    {0x2020, 1257, 5, 0, 5, 11, 0, -2},
+    {0x2021, 1264, 5, 0, 5, 11, 0, -2},
+    {0x2022, 1271, 6, 0, 4, 5, 1, 2},
+    {0x2026, 1274, 11, 0, 9, 2, 1, 0},
+    {0x2030, 1277, 11, 0, 11, 9, 0, 0},
+    {0x2039, 1290, 3, 0, 3, 3, 0, 1},
+    {0x203A, 1292, 3, 0, 3, 3, 0, 1},
+    {0x2044, 1294, 2, 0, 6, 9, -2, 0},
+    {0x2122, 1301, 11, 0, 11, 5, 0, 3},
+    {0x2212, 1308, 7, 0, 5, 1, 1, 2},
+    {0xFB00, 1309, 7, 0, 8, 9, 0, 0},
+    {0xFB01, 1318, 7, 0, 7, 9, 0, 0},
+    {0xFB02, 1326, 7, 0, 7, 9, 0, 0},
+    {0xFB03, 1334, 11, 0, 10, 9, 0, 0},
+    {0xFB04, 1346, 11, 0, 10, 9, 0, 0},
+};
+
+static constexpr uint8_t bailleul_8_pt_bitmaps[1359] = "\xf9\x99\x99\x9f\xff\x80\xb6\xd0\x28\xa7\xca\x4b"
+                                                       "\xe5\x14\x21\x3d\x6a\x70\xc5\xaf\x88\x02\x31\x25"
+                                                       "\x12\x86\x80\x98\x52\x49\x23\x00\x38\x28\x30\x2f"
+                                                       "\x54\x55\xcd\x4d\x7e\xf0\x29\x49\x24\x48\x80\x84"
+                                                       "\x22\x23\x22\x24\x80\x2d\x26\x21\x09\xf2\x10\xa6"
+                                                       "\xe0\xc0\x08\x84\x42\x21\x10\x80\x39\x24\xf3\xcd"
+                                                       "\x34\x8e\x26\xa2\x22\x22\xf0\x79\x20\x82\x10\x84"
+                                                       "\x7e\x72\x46\xe0\x87\x2e\x10\x43\x0c\x52\x5f\xc5"
+                                                       "\x10\x09\xd0\xf4\x84\x31\x70\x74\xbd\x29\xce\x4e"
+                                                       "\xfc\xa4\x42\x11\x08\x39\x24\x9c\x5a\x18\x5e\xf4"
+                                                       "\xa5\x39\xba\x5c\xcc\xa0\xa6\x09\xb1\x06\x0c\xf8"
+                                                       "\x3e\x83\x04\x36\x40\xea\x32\x24\x44\xc0\x3e\x41"
+                                                       "\x4f\x93\x95\x95\x5a\x40\x3e\x10\x20\x61\x42\x87"
+                                                       "\x13\x22\xee\xfc\xc9\x93\x27\x8c\x99\xb3\xfc\x3d"
+                                                       "\x18\x60\x82\x08\x71\x78\xfe\x62\x61\x61\x61\x61"
+                                                       "\x63\x62\xfe\xfe\xc5\xab\x47\x8d\x1a\xb1\xfe\xfe"
+                                                       "\xc5\xab\x47\x8d\x1a\x30\xf0\x3c\x8a\x14\x08\xf0"
+                                                       "\xa1\x62\x7c\xf7\x62\x62\x62\x7e\x62\x62\x62\xf7"
+                                                       "\xf6\x66\x66\x66\xf0\x38\x84\x21\x08\x5a\xe0\xfe"
+                                                       "\x68\x68\x68\x78\x68\x6c\x64\xf7\xf0\xc1\x83\x06"
+                                                       "\x0c\x18\xb1\xfe\xe1\xd8\x67\x29\x4a\x52\x97\x24"
+                                                       "\xc9\x22\xe9\xc0\xe3\x72\x52\x5a\x4e\x46\x46\x42"
+                                                       "\xe2\x79\x8a\x1c\x38\x70\xe1\xe2\x78\xfd\x96\x59"
+                                                       "\x65\xe6\x18\xf0\x79\x8a\x1c\x38\x70\xe1\x22\x38"
+                                                       "\x94\x18\xf8\xc9\x93\x27\x8c\x99\x32\xf6\xf4\xa1"
+                                                       "\x87\x0e\x31\xf0\xff\x36\x68\xc1\x83\x06\x0c\x3c"
+                                                       "\xf3\x61\x61\x61\x61\x61\x61\x62\x3e\xe6\xc8\x91"
+                                                       "\x22\x87\x04\x08\x10\xef\x68\xc9\xa9\x15\x22\xb8"
+                                                       "\x53\x0c\x40\x88\x11\x00\xf6\x24\x38\x10\x18\x18"
+                                                       "\x2c\x24\xef\xee\xc8\xa1\x81\x02\x04\x08\x38\x7e"
+                                                       "\x89\x20\xc1\x06\x08\xb1\xfe\xf2\x49\x24\x92\x70"
+                                                       "\x84\x10\x82\x10\x42\x08\xd5\x55\x57\x23\x15\x28"
+                                                       "\x80\xfc\x90\xf4\x9d\x29\x7c\xc1\x04\x1e\x45\x14"
+                                                       "\x51\x78\x74\xa1\x08\xb8\x30\x85\xe9\x4a\x52\xf8"
+                                                       "\x74\xbf\x08\xb8\x32\x51\xc4\x21\x08\xe0\x7c\xa5"
+                                                       "\xc8\x7e\x31\xf0\xc0\x81\x02\xc6\x48\x91\x22\xee"
+                                                       "\x43\x24\x97\x4d\x55\x70\xc1\x04\x16\x51\xc5\x92"
+                                                       "\xec\xc9\x24\x92\xe0\xdb\x99\x24\x49\x12\x44\xbb"
+                                                       "\xf0\xd8\xc9\x12\x24\x5d\xc0\x74\xa7\x39\x38\xf9"
+                                                       "\x14\x51\x45\xe4\x10\xe0\xf4\xa5\x29\x78\x42\x38"
+                                                       "\xdb\x50\x84\x70\xea\xc6\x9e\x44\xe4\x44\x47\xcc"
+                                                       "\x89\x12\x24\x4f\xc0\xed\x22\x8c\x30\x80\xff\xa6"
+                                                       "\x8d\x46\xc2\x21\x10\xec\xa3\x04\x3b\xf0\xed\x22"
+                                                       "\x8c\x30\x41\x28\x40\x7c\x8c\x44\xfc\x34\x44\x4c"
+                                                       "\x44\x44\x70\xff\xf0\xc4\x44\x43\x24\x44\xc0\xcd"
+                                                       "\x80\xff\x80\x21\x1d\x7a\x52\xae\x20\x3c\x82\x3e"
+                                                       "\x20\x92\x7e\xb5\x28\x61\x4a\xd0\xed\xa2\x9e\x11"
+                                                       "\xe1\x1e\xe3\x80\x74\xa1\x8e\x49\x45\x1c\xa5\xc0"
+                                                       "\xa0\x1c\x62\x5d\xa3\xa1\xa3\x5d\x62\x1c\x66\xa5"
+                                                       "\x5a\x70\xf8\x42\xc0\x6d\xde\x40\xe0\xd6\xe0\x21"
+                                                       "\x3e\x42\x7c\xf5\x24\xf0\xe1\x61\xf0\x60\xcc\x89"
+                                                       "\x12\x24\x4f\xd0\x20\x40\x7f\xae\xba\x68\x61\x86"
+                                                       "\x19\x62\x00\x80\x78\x75\xc0\x69\x96\xf7\xe0\x45"
+                                                       "\x0a\x24\x49\x3c\xca\xa7\x42\x44\x84\x88\x88\x96"
+                                                       "\xe5\x22\x45\x4e\x61\x29\x19\x02\x89\x93\x58\x4e"
+                                                       "\x2f\x21\x00\x32\x22\x4c\x89\x70\x20\x30\x40\x81"
+                                                       "\x85\x0a\x1c\x4c\x8b\xb8\x08\x20\x40\x81\x85\x0a"
+                                                       "\x1c\x4c\x8b\xb8\x10\x50\x40\x81\x85\x0a\x1c\x4c"
+                                                       "\x8b\xb8\x34\x50\x40\x81\x85\x0a\x1c\x4c\x8b\xb8"
+                                                       "\x28\x20\x40\xc2\x85\x0e\x26\x45\xdc\x10\x50\x40"
+                                                       "\x81\x03\x0a\x14\x38\x99\x17\x70\x1f\xc5\x11\x4c"
+                                                       "\x54\x27\x0f\x24\x45\x11\xcf\xc0\x3d\x18\x60\x82"
+                                                       "\x08\x71\x78\x83\x0c\x20\x23\xbb\x16\xad\x1e\x34"
+                                                       "\x6a\xc7\xf8\x0c\x23\xbb\x16\xad\x1e\x34\x6a\xc7"
+                                                       "\xf8\x18\x53\xdb\x16\xad\x1e\x34\x6a\xc7\xf8\x2c"
+                                                       "\x03\xfb\x16\xad\x1e\x34\x6a\xc7\xf8\xc2\xf6\x66"
+                                                       "\x66\x66\xf0\x12\xf6\x66\x66\x66\xf0\x69\x66\x66"
+                                                       "\x66\x66\xf0\xd0\xf6\x66\x66\x66\xf0\xfe\x62\x61"
+                                                       "\x61\xf1\x61\x63\x62\xfe\x14\x2c\xe3\x72\x52\x5a"
+                                                       "\x4e\x46\x46\x42\xe2\x20\x21\xa6\x28\x70\xe1\xc3"
+                                                       "\x87\x89\xe0\x08\x21\xa6\x28\x70\xe1\xc3\x87\x89"
+                                                       "\xe0\x10\x51\x66\x28\x70\xe1\xc3\x87\x89\xe0\x28"
+                                                       "\xb1\xa6\x28\x70\xe1\xc3\x87\x89\xe0\x28\x01\xe6"
+                                                       "\x28\x70\xe1\xc3\x87\x89\xe0\x8a\x88\xa8\x80\x7b"
+                                                       "\x8a\x1c\x79\x74\xf1\xe2\xf8\x10\x08\xf3\x61\x61"
+                                                       "\x61\x61\x61\x61\x62\x3e\x04\x08\xf3\x61\x61\x61"
+                                                       "\x61\x61\x61\x62\x3e\x08\x14\xe3\x61\x61\x61\x61"
+                                                       "\x61\x61\x62\x3e\x14\x00\xf3\x61\x61\x61\x61\x61"
+                                                       "\x61\x62\x3e\x08\x23\xbb\x22\x86\x04\x08\x10\x20"
+                                                       "\xe0\xf1\x87\x99\x65\x97\x98\xf0\x39\x14\xd6\x45"
+                                                       "\x14\x55\xf8\x83\x01\xe9\x3a\x52\xf8\x11\x11\xe9"
+                                                       "\x3a\x52\xf8\x62\xa1\xe9\x3a\x52\xf8\xf0\x3d\x27"
+                                                       "\x4a\x5f\xd0\x3d\x27\x4a\x5f\x63\x19\x29\x3a\x52"
+                                                       "\xf8\x77\x24\x8f\xe9\x0c\x8b\xf8\x74\xa1\x08\xb9"
+                                                       "\x0c\x60\x83\x00\xe9\x7e\x11\x70\x11\x10\xe9\x7e"
+                                                       "\x11\x70\x62\xa0\xe9\x7e\x11\x70\xd0\x1d\x2f\xc2"
+                                                       "\x2e\x88\xe4\x92\xe0\x28\x64\x92\xe0\x54\x64\x92"
+                                                       "\xe0\xa3\x24\x97\xf5\x04\xe9\xce\x72\x70\x38\x03"
+                                                       "\x63\x24\x48\x91\x77\xc3\x00\xe9\x4e\x72\x70\x11"
+                                                       "\x10\xe9\x4e\x72\x70\x62\xa0\xe9\x4e\x72\x70\xf0"
+                                                       "\x1d\x29\xce\x4e\xd0\x1d\x29\xce\x4e\x21\x3e\x02"
+                                                       "\x10\x7c\xaf\xb9\x78\x20\x20\x06\x64\x48\x91\x22"
+                                                       "\x7e\x08\x20\x06\x64\x48\x91\x22\x7e\x10\x50\x06"
+                                                       "\x64\x48\x91\x22\x7e\x28\x03\x32\x24\x48\x91\x3f"
+                                                       "\x18\xc0\x3b\x48\xa3\x0c\x10\x4a\x10\xc1\x04\x1e"
+                                                       "\x45\x14\x51\x79\x04\x38\x58\x0e\xd2\x28\xc3\x04"
+                                                       "\x12\x84\x00\xc9\x25\xc0\xf0\xc1\xa3\x86\x1c\x18"
+                                                       "\xb1\xfe\xc9\xb5\x92\xe0\x7f\xd8\x8a\x12\xc2\x48"
+                                                       "\x71\x09\x21\x2e\x21\x7f\xc0\x7e\x99\x9f\x98\x99"
+                                                       "\xff\x93\x25\x28\x61\xc3\x8c\x7c\xa4\x0e\xac\x69"
+                                                       "\xe0\x29\x8d\x91\x43\x02\x04\x08\x10\x70\x2c\x31"
+                                                       "\x9a\x24\x83\x04\x18\x22\xc7\xf8\x51\x80\xf9\x18"
+                                                       "\x89\xf8\x0c\x51\x04\x78\xc2\x08\x22\x8c\x00\x54"
+                                                       "\xa8\xbc\x80\x55\x00\x51\x80\xe0\x5a\xfc\xff\x80"
+                                                       "\xf0\xf0\xf0\x9a\xab\xab\x9a\xab\x9a\x21\x09\xf2"
+                                                       "\x10\x84\x21\x08\x21\x09\xf2\x13\xe4\x21\x08\x4e"
+                                                       "\xff\x60\x88\xe4\xc0\x04\x0c\x82\x60\x48\x07\x00"
+                                                       "\x29\x8a\xca\x59\x4e\xc0\x79\x80\xcd\x00\x04\x20"
+                                                       "\x84\x20\x84\x10\x80\xf4\x76\xc8\x9b\x13\x66\x56"
+                                                       "\xf8\x07\x7d\x44\xee\x44\x44\x44\x44\xee\x38\x91"
+                                                       "\x07\x64\x48\x91\x22\xee\x3c\x89\x17\x24\x48\x91"
+                                                       "\x22\xee\x03\x9f\x24\x43\xbe\x44\x91\x24\x49\x12"
+                                                       "\xef\xc0\x03\x9f\x24\x4b\xba\x44\x91\x24\x49\x12"
+                                                       "\xef\xc0";
+
+constexpr Font bailleul_8_pt = {
+    .size = 8,
+    .numCharacters = 232,
+    .boundingBoxWidth = 14,
+    .boundingBoxHeight = 15,
+    .boundingBoxXOffset = -2,
+    .boundingBoxYOffset = -3,
+    .ascent = 10,
+    .descent = 2,
+    .asciiIndex = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                   28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+                   53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+                   78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95},
+    .characters = bailleul_8_pt_characters,
+    .bitmaps = bailleul_8_pt_bitmaps,
+};
 
 // bailleul
 //   - Copyright (c) 2019 Yomli  Copyright (c) 1850 Bailleul et Cie  Copyright (c) 1800 Justus Erich Walbaum"
 //   - Size: 12
 //   - Characters: 232
-uint8_t bailleul_12_pt[5324] = "\x0c\x00\xe8\x15\x16\xfd\xfb\x10\x04\x00\x00\x00\x13\x07\x0c\x06\x0c\x00\x00\xfe"
-                               "\x18\x61\x86\x18\x61\x86\x18\x7f\x00\x20\x00\x0a\x05\x00\x00\x00\x00\x00\x00\x21"
-                               "\x00\x0f\x05\x00\x03\x0d\x01\x00\x5f\xa4\x92\x40\x74\x00\x22\x00\x0d\x08\x00\x04"
-                               "\x06\x02\x07\x9b\x99\x99\x00\x23\x00\x19\x09\x00\x09\x0d\x00\x00\x11\x09\x04\x82"
-                               "\x47\xf8\x90\x48\x44\xff\x12\x09\x04\x82\x40\x00\x24\x00\x1a\x09\x00\x08\x10\x01"
-                               "\xff\x10\x10\x3c\x56\xd6\xd0\xf0\x78\x3e\x1e\x13\xd3\xd2\xd2\x7c\x10\x00\x25\x00"
-                               "\x20\x11\x00\x0d\x0d\x02\x00\x70\x64\x42\x22\x21\x11\x08\x90\x38\x80\x08\x00\x8e"
-                               "\x04\x88\x44\x42\x22\x21\x12\x07\x00\x00\x26\x00\x1c\x0d\x00\x0b\x0d\x01\x00\x1c"
-                               "\x04\x80\x90\x1c\x03\x3e\x71\x16\x24\x64\x8d\x30\xc7\x0c\xf1\xf7\xdc\x00\x27\x00"
-                               "\x0c\x04\x00\x02\x06\x01\x07\x75\x50\x00\x28\x00\x14\x07\x00\x05\x10\x02\xfc\x19"
-                               "\x10\x8c\x42\x10\x84\x21\x84\x20\x83\x00\x29\x00\x14\x07\x00\x05\x10\x00\xfc\xc1"
-                               "\x04\x21\x84\x21\x08\x42\x31\x08\x98\x00\x2A\x00\x0f\x07\x00\x06\x06\x00\x07\x11"
-                               "\x5e\xcc\x69\xa0\x00\x2B\x00\x13\x0a\x00\x08\x09\x01\x00\x08\x08\x08\x08\xff\x08"
-                               "\x08\x08\x08\x00\x2C\x00\x0c\x05\x00\x03\x05\x01\xfd\xfc\xac\x00\x2D\x00\x0b\x07"
-                               "\x00\x05\x01\x01\x04\xf8\x00\x2E\x00\x0b\x05\x00\x03\x02\x01\x00\xf8\x00\x2F\x00"
-                               "\x16\x07\x00\x07\x0d\x00\x00\x02\x0c\x10\x20\x81\x04\x08\x20\x41\x02\x08\x00\x00"
-                               "\x30\x00\x17\x09\x00\x08\x0d\x01\x00\x38\x44\xc2\xc2\xc3\xc3\xc3\xc3\xc3\xc2\xc2"
-                               "\x44\x38\x00\x31\x00\x14\x09\x00\x06\x0d\x02\x00\x10\xc7\x2c\x30\xc3\x0c\x30\xc3"
-                               "\x0c\xfc\x00\x32\x00\x19\x09\x00\x09\x0d\x00\x00\x3e\x21\x90\xce\x66\x30\x18\x08"
-                               "\x08\x08\x08\x48\x2f\xef\xf0\x00\x33\x00\x17\x09\x00\x08\x0d\x00\x00\x3c\x46\x67"
-                               "\x07\x06\x04\x3c\x06\x03\x03\xe3\x43\x3c\x00\x34\x00\x19\x09\x00\x09\x0d\x00\x00"
-                               "\x06\x03\x03\x82\xc1\x61\x31\x18\x8d\xff\x83\x41\xa0\xc0\x60\x00\x35\x00\x17\x09"
-                               "\x00\x07\x0e\x01\x00\x02\xf9\xf2\x04\x17\xb1\xc3\x06\x0e\x1c\x38\x6f\x00\x00\x36"
-                               "\x00\x17\x09\x00\x08\x0d\x01\x00\x3c\x62\x42\xc0\xdc\xe6\xc6\xc3\xc3\xc2\xc2\x46"
-                               "\x3c\x00\x37\x00\x19\x09\x00\x09\x0d\x01\x00\x7f\xbf\xa0\x90\x40\x40\x20\x20\x10"
-                               "\x18\x0c\x04\x06\x03\x00\x00\x38\x00\x17\x09\x00\x08\x0d\x01\x00\x3c\x42\xc2\xc2"
-                               "\xe2\x7c\x5e\x86\x83\x83\x83\xc2\x7c\x00\x39\x00\x17\x09\x00\x08\x0d\x01\x00\x3c"
-                               "\x46\xc6\xc2\xc3\xc3\xc7\x47\x3a\x06\xc6\xc4\x78\x00\x3A\x00\x0d\x05\x00\x03\x08"
-                               "\x01\x00\xf8\x00\x3e\x00\x3B\x00\x0f\x05\x00\x03\x0b\x01\xfd\xf8\x00\x3f\x2b\x00"
-                               "\x00\x3C\x00\x13\x0a\x00\x08\x09\x01\x00\x01\x06\x18\x60\x80\xe0\x38\x06\x01\x00"
-                               "\x3D\x00\x0f\x0a\x00\x08\x05\x01\x02\xff\x00\x00\x00\xff\x00\x3E\x00\x13\x0a\x00"
-                               "\x08\x09\x01\x00\x80\x60\x18\x06\x01\x07\x1c\x70\x80\x00\x3F\x00\x14\x08\x00\x06"
-                               "\x0d\x01\x00\x7b\x3c\xc3\x0c\x31\x88\x20\x80\x18\x60\x00\x40\x00\x1e\x0e\x00\x0c"
-                               "\x0d\x01\x00\x1f\x82\x04\x40\x2c\x7d\x8c\x98\x89\x98\x99\x91\x9b\x2c\xcc\x40\x03"
-                               "\x04\x0f\x80\x00\x41\x00\x1c\x0b\x00\x0b\x0d\x00\x00\x04\x00\x80\x18\x07\x00\xe0"
-                               "\x16\x04\xc0\x98\x1f\x84\x30\x86\x10\xcf\x3e\x00\x42\x00\x19\x0b\x00\x09\x0d\x01"
-                               "\x00\xff\x31\x98\xec\x66\x33\xf1\x84\xc3\x61\xb0\xd8\x6c\x3f\xf0\x00\x43\x00\x1b"
-                               "\x0c\x00\x0a\x0d\x01\x00\x1f\x8c\x36\x05\x81\xc0\x30\x0c\x03\x00\xc0\x58\x16\x04"
-                               "\x83\x1f\x00\x00\x44\x00\x20\x0e\x00\x0d\x0d\x00\x00\xff\xc1\x83\x0c\x0c\x60\x63"
-                               "\x03\x18\x18\xc0\xe6\x06\x30\x31\x81\x8c\x0c\x60\xcf\xfc\x00\x00\x45\x00\x1b\x0c"
-                               "\x00\x0a\x0d\x01\x00\xff\x98\x26\x09\x89\x62\x18\x87\xe1\x88\x62\x18\x96\x05\x83"
-                               "\xff\xc0\x00\x46\x00\x19\x0a\x00\x09\x0d\x01\x00\xff\xb0\x58\x2c\x56\x23\x11\xf8"
-                               "\xc4\x62\x31\x18\x0c\x0f\x80\x00\x47\x00\x1e\x0d\x00\x0c\x0d\x01\x00\x1f\x83\x0c"
-                               "\x60\x46\x04\xc0\x0c\x00\xc1\xfc\x04\xc0\x46\x04\x60\xc2\x0c\x1f\x80\x00\x48\x00"
-                               "\x20\x0d\x00\x0d\x0d\x00\x00\xfc\xf9\x83\x0c\x18\x60\xc3\x06\x18\x30\xff\x86\x0c"
-                               "\x30\x61\x83\x0c\x18\x60\xcf\xcf\x80\x00\x49\x00\x13\x06\x00\x05\x0d\x01\x00\xfb"
-                               "\x18\xc6\x31\x8c\x63\x18\xcf\x80\x00\x4A\x00\x16\x08\x00\x07\x0d\x00\x00\x3e\x18"
-                               "\x30\x60\xc1\x83\x06\x0c\x19\x36\x67\x80\x00\x4B\x00\x1c\x0c\x00\x0b\x0d\x01\x00"
-                               "\xfb\x8c\x41\x88\x32\x06\x40\xf8\x19\x83\x30\x63\x0c\x61\x8e\x30\xcf\xbe\x00\x4C"
-                               "\x00\x1b\x0b\x00\x0a\x0d\x01\x00\xf8\x18\x06\x01\x80\x60\x18\x06\x01\x80\x60\x58"
-                               "\x16\x05\x83\xff\xc0\x00\x4D\x00\x24\x10\x00\x10\x0d\x00\x00\xf8\x0f\x38\x1c\x38"
-                               "\x1c\x2c\x2c\x2c\x2c\x2c\x2c\x26\x4c\x26\x4c\x22\x8c\x23\x8c\x23\x0c\x21\x0c\xf1"
-                               "\x3f\x00\x4E\x00\x1e\x0d\x00\x0c\x0d\x00\x00\xf8\x73\x82\x2c\x22\xe2\x26\x22\x32"
-                               "\x23\xa2\x1a\x20\xe2\x0e\x20\x62\x06\xf0\x20\x00\x4F\x00\x1c\x0d\x00\x0b\x0d\x01"
-                               "\x00\x1f\x04\x11\x83\x30\x3c\x07\x80\xf0\x1e\x03\xc0\x6c\x0d\x83\x10\x41\xf0\x00"
-                               "\x50\x00\x19\x0a\x00\x09\x0d\x01\x00\xfe\x31\x98\x6c\x36\x1b\x0d\x8c\xfc\x60\x30"
-                               "\x18\x0c\x0f\x80\x00\x51\x00\x22\x0d\x00\x0c\x10\x01\xfd\x1f\x02\x08\x60\xc6\x06"
-                               "\xc0\x6c\x06\xc0\x6c\x06\xc0\x6c\x06\x60\x46\x0c\x31\x81\xf0\x33\x92\x1e\x00\x52"
-                               "\x00\x1b\x0b\x00\x0a\x0d\x01\x00\xfe\x18\xc6\x31\x8c\x63\x18\xc7\xc1\x8c\x61\x98"
-                               "\x66\x19\x86\xf9\xc0\x00\x53\x00\x17\x09\x00\x08\x0d\x01\x00\x3c\x42\x82\xc2\xe0"
-                               "\x78\x3e\x0e\x03\x81\x81\x82\x7c\x00\x54\x00\x1b\x0c\x00\x0a\x0d\x01\x00\xff\xe3"
-                               "\x18\xc6\x31\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30\x3f\x00\x00\x55\x00\x20\x0d"
-                               "\x00\x0d\x0d\x00\x00\xfc\x79\x81\x0c\x08\x60\x43\x02\x18\x10\xc0\x86\x04\x30\x21"
-                               "\x81\x0c\x08\x60\x41\xfc\x00\x00\x56\x00\x1c\x0b\x00\x0b\x0d\x00\x00\xf9\xe6\x08"
-                               "\xc2\x18\x41\x88\x32\x06\x40\x48\x0e\x01\xc0\x10\x02\x00\x40\x00\x57\x00\x26\x11"
-                               "\x00\x11\x0d\x00\x00\xfb\xf3\xb0\x60\x8c\x58\x86\x2c\x43\x16\x20\x91\x20\x68\xd0"
-                               "\x34\x68\x1a\x34\x06\x0c\x03\x06\x01\x82\x00\x81\x00\x00\x58\x00\x1e\x0c\x00\x0c"
-                               "\x0d\x00\x00\xfd\xe1\x88\x19\x00\xd0\x0e\x00\x60\x06\x00\x70\x0b\x01\x18\x11\x82"
-                               "\x0c\xf3\xf0\x00\x59\x00\x1b\x0a\x00\x0a\x0d\x00\x00\xf9\xcc\x23\x10\x64\x1a\x03"
-                               "\x80\xc0\x30\x0c\x03\x00\xc0\x30\x1f\x00\x00\x5A\x00\x1b\x0c\x00\x0a\x0d\x01\x00"
-                               "\x7f\xd0\xe4\x32\x1c\x06\x03\x00\xc0\x60\x38\x4c\x16\x05\x83\xff\xc0\x00\x5B\x00"
-                               "\x11\x06\x00\x03\x12\x02\xfb\xfb\x6d\xb6\xdb\x6d\xb6\xdc\x00\x5C\x00\x16\x07\x00"
-                               "\x07\x0d\x00\x00\x80\x81\x01\x02\x02\x04\x04\x08\x08\x10\x30\x20\x00\x5D\x00\x13"
-                               "\x06\x00\x04\x12\x00\xfb\xf3\x33\x33\x33\x33\x33\x33\x33\x3f\x00\x5E\x00\x11\x0a"
-                               "\x00\x08\x07\x01\x06\x08\x18\x1c\x24\x26\x42\xc3\x00\x5F\x00\x0c\x09\x00\x09\x01"
-                               "\x00\xfe\xff\x80\x00\x60\x00\x0c\x05\x00\x04\x03\x00\x0a\x8c\x30\x00\x61\x00\x13"
-                               "\x09\x00\x08\x09\x01\x00\x7c\x46\x46\x1e\x66\xc6\xc6\xce\x77\x00\x62\x00\x19\x0a"
-                               "\x00\x09\x0d\x00\x00\xe0\x10\x08\x04\x02\xf1\x8c\xc6\x43\x21\x90\xcc\x66\x22\xf0"
-                               "\x00\x63\x00\x13\x09\x00\x08\x09\x01\x00\x3c\x42\xc2\xc0\xc0\xc0\xc1\x62\x3c\x00"
-                               "\x64\x00\x19\x0a\x00\x09\x0d\x01\x00\x0e\x01\x00\x80\x47\xa2\x33\x09\x84\xc2\x61"
-                               "\x30\x88\xc7\xb8\x00\x65\x00\x13\x09\x00\x08\x09\x01\x00\x3c\x46\xc6\xff\xc0\xc0"
-                               "\xc1\x42\x3c\x00\x66\x00\x16\x06\x00\x07\x0d\x00\x00\x1c\x6c\x81\x0f\x84\x08\x10"
-                               "\x20\x40\x81\x0f\x80\x00\x67\x00\x17\x0a\x00\x08\x0d\x01\xfc\x3f\x65\x46\x66\x64"
-                               "\x98\x80\xfe\x7f\xc1\x81\x81\x7e\x00\x68\x00\x1b\x0b\x00\x0a\x0d\x00\x00\xe0\x08"
-                               "\x02\x00\x80\x2f\x0c\x63\x18\x86\x21\x88\x62\x18\x86\xfb\xc0\x00\x69\x00\x13\x05"
-                               "\x00\x05\x0d\x00\x00\x31\x80\x0f\x18\xc6\x31\x8c\x6f\x80\x00\x6A\x00\x13\x05\x00"
-                               "\x04\x11\x00\xfc\x33\x00\xf3\x33\x33\x33\x33\x24\x80\x00\x6B\x00\x1b\x0a\x00\x0a"
-                               "\x0d\x00\x00\xe0\x08\x02\x00\x80\x27\x08\x82\x40\x90\x3c\x09\x82\x30\x8c\xfb\xc0"
-                               "\x00\x6C\x00\x13\x05\x00\x05\x0d\x00\x00\xf1\x8c\x63\x18\xc6\x31\x8c\x6f\x80\x00"
-                               "\x6D\x00\x1c\x10\x00\x10\x09\x00\x00\xef\x3c\x31\xcc\x31\x84\x21\x84\x21\x84\x21"
-                               "\x84\x21\x84\x21\x84\xfb\xdf\x00\x6E\x00\x16\x0b\x00\x0a\x09\x00\x00\xef\x0c\x63"
-                               "\x18\x86\x21\x88\x62\x18\x86\xfb\xc0\x00\x6F\x00\x13\x0a\x00\x08\x09\x01\x00\x3c"
-                               "\x42\xc2\xc3\xc3\xc3\xc2\x42\x3c\x00\x70\x00\x19\x0a\x00\x09\x0d\x00\xfc\xef\x18"
-                               "\xcc\x64\x32\x19\x0c\xc6\x62\x2f\x10\x08\x04\x0f\x80\x00\x71\x00\x19\x0a\x00\x09"
-                               "\x0d\x01\xfc\x7a\x23\x30\x98\x4c\x26\x13\x08\x8c\x7a\x01\x00\x80\x40\xf8\x00\x72"
-                               "\x00\x12\x08\x00\x07\x09\x00\x00\xe6\x54\xc9\x82\x04\x08\x10\xf8\x00\x73\x00\x11"
-                               "\x08\x00\x06\x09\x01\x00\x7a\x1c\x7c\x78\x78\x61\xf8\x00\x74\x00\x13\x06\x00\x06"
-                               "\x0b\x00\x00\x61\x8f\x98\x61\x86\x18\x60\x93\x80\x00\x75\x00\x16\x0b\x00\x0a\x09"
-                               "\x00\x00\xe3\x88\x62\x18\x86\x21\x88\x62\x18\xce\x3d\xc0\x00\x76\x00\x15\x09\x00"
-                               "\x09\x09\x00\x00\xfb\x90\x8c\x86\x41\xa0\xe0\x70\x10\x08\x00\x00\x77\x00\x1a\x0e"
-                               "\x00\x0e\x09\x00\x00\xff\xdc\x8e\x23\x28\x8c\xb4\x14\xd0\x71\x41\x86\x02\x18\x08"
-                               "\x40\x00\x78\x00\x15\x0a\x00\x09\x09\x00\x00\xfb\x99\x06\x83\x80\xc0\x60\x58\x46"
-                               "\xf7\x80\x00\x79\x00\x19\x09\x00\x09\x0d\x00\xfc\xf3\x91\x0c\x86\x41\xa0\xe0\x30"
-                               "\x18\x08\x04\x12\x09\x07\x00\x00\x7A\x00\x13\x09\x00\x08\x09\x00\x00\x7f\x46\x4c"
-                               "\x0c\x18\x31\x31\x61\xff\x00\x7B\x00\x15\x06\x00\x05\x11\x00\xfc\x19\x8c\x63\x18"
-                               "\xc4\xc1\x0c\x63\x18\xc6\x18\x00\x7C\x00\x0d\x04\x00\x01\x12\x01\xfc\xff\xff\xc0"
-                               "\x00\x7D\x00\x15\x06\x00\x05\x11\x00\xfc\xe1\x0c\x63\x18\xc6\x09\x8c\x63\x18\xc4"
-                               "\xe0\x00\x7E\x00\x0c\x0a\x00\x08\x02\x01\x03\x71\x8e\x00\xA1\x00\x0f\x05\x00\x03"
-                               "\x0d\x01\xfc\x5c\x04\x92\x4b\xf4\x00\xA2\x00\x17\x09\x00\x08\x0d\x01\xfe\x08\x08"
-                               "\x34\x6a\x4b\xc8\xc8\xc8\xc9\x6a\x34\x08\x08\x00\xA3\x00\x19\x09\x00\x09\x0d\x00"
-                               "\x00\x0f\x08\xc4\x06\x03\x83\xf8\x60\x30\x18\x88\x44\x2e\x7c\xf0\x00\xA4\x00\x15"
-                               "\x09\x00\x09\x09\x00\x02\xde\xb1\x90\x48\x14\x0a\x05\x06\xc6\xde\x80\x00\xA5\x00"
-                               "\x1b\x09\x00\x0a\x0d\x00\x00\xfb\xc8\x43\x10\x48\x1a\x07\x07\xf0\x30\x7f\x03\x00"
-                               "\xc0\x30\x3e\x00\x00\xA6\x00\x0c\x04\x00\x01\x0d\x01\xfe\xf0\x78\x00\xA7\x00\x1b"
-                               "\x09\x00\x08\x11\x01\xfc\x3c\x46\x46\xc0\xa0\xb0\x98\x4c\x66\x32\x1a\x0d\x05\x42"
-                               "\xc2\xc4\x78\x00\xA8\x00\x0c\x05\x00\x05\x02\x00\x0a\x9e\xc0\x00\xA9\x00\x1e\x0e"
-                               "\x00\x0c\x0d\x01\x00\x0f\x03\x0c\x47\x69\x8a\x90\x1b\x01\xb0\x19\x01\x98\x98\x72"
-                               "\x40\x63\x0c\x0f\x00\x00\xAA\x00\x0f\x06\x00\x06\x06\x00\x06\x31\x23\x92\xd9\xb0"
-                               "\x00\xAB\x00\x0f\x07\x00\x06\x06\x01\x01\x25\x2b\x24\x48\x90\x00\xAC\x00\x0f\x0a"
-                               "\x00\x08\x05\x01\x02\xff\x01\x01\x01\x01\x00\xAD\x00\x0b\x06\x00\x03\x01\x02\x03"
-                               "\xe0\x00\xAE\x00\x10\x08\x00\x06\x07\x01\x06\x7a\xda\xed\xae\x17\x80\x00\xAF\x00"
-                               "\x0b\x05\x00\x05\x01\x00\x0b\xf8\x00\xB0\x00\x0e\x07\x00\x05\x05\x01\x07\x74\x63"
-                               "\x17\x00\x00\xB1\x00\x13\x0a\x00\x08\x09\x01\x00\x08\x08\x08\xff\x08\x08\x08\x00"
-                               "\xff\x00\xB2\x00\x10\x07\x00\x06\x08\x00\x06\x7b\x36\xc3\x18\x84\x7e\x00\xB3\x00"
-                               "\x10\x07\x00\x06\x08\x00\x06\x79\x30\x8c\x0c\x1c\xde\x00\xB4\x00\x0c\x05\x00\x04"
-                               "\x03\x01\x0a\x32\xc0\x00\xB5\x00\x1b\x0b\x00\x0a\x0d\x00\xfc\xe3\x88\x62\x18\x86"
-                               "\x21\x88\x62\x18\xce\x3d\xc8\x06\x01\x80\x20\x00\x00\xB6\x00\x1e\x0a\x00\x0a\x10"
-                               "\x00\xfd\x3f\xde\x47\x93\xe4\x79\x1e\x43\x90\x14\x05\x01\x40\x50\x14\x05\x0a\xc6"
-                               "\xe0\xe0\x00\xB7\x00\x0b\x05\x00\x02\x02\x01\x04\xf0\x00\xB8\x00\x0c\x05\x00\x03"
-                               "\x04\x01\xfc\x5c\xf0\x00\xB9\x00\x0e\x06\x00\x04\x08\x01\x06\x26\xa2\x22\x2f\x00"
-                               "\xBA\x00\x0e\x06\x00\x05\x06\x01\x06\x64\xa7\x39\x30\x00\xBB\x00\x0f\x07\x00\x06"
-                               "\x06\x01\x01\xa3\x46\x9b\xd2\x80\x00\xBC\x00\x1e\x0e\x00\x0c\x0d\x01\x00\x20\x42"
-                               "\x04\xe0\x86\x10\x61\x06\x20\x62\x26\x46\xf8\xe0\x96\x11\xf1\x07\x20\x60\x00\xBD"
-                               "\x00\x1f\x0e\x00\x0c\x0e\x01\xff\x00\x42\x08\xe0\x86\x10\x61\x06\x20\x62\xef\x49"
-                               "\x08\x10\x81\x10\x61\x09\x21\xf2\x00\x00\xBE\x00\x20\x0e\x00\x0d\x0d\x01\x00\x60"
-                               "\x44\x82\x24\x20\x21\x06\x10\x0c\x82\x68\x93\x8c\x64\x60\x45\x02\x7e\x20\x53\x02"
-                               "\x00\x00\xBF\x00\x14\x08\x00\x06\x0d\x00\xfc\x18\x70\x02\x08\x23\x10\x43\x04\xd1"
-                               "\x38\x00\xC0\x00\x22\x0b\x00\x0b\x11\x00\x00\x10\x03\x00\x10\x01\x00\x40\x08\x01"
-                               "\x80\x70\x0e\x01\x60\x4c\x09\x81\xf8\x43\x08\x61\x0c\xf3\xe0\x00\xC1\x00\x22\x0b"
-                               "\x00\x0b\x11\x00\x00\x01\x00\x60\x18\x04\x00\x40\x08\x01\x80\x70\x0e\x01\x60\x4c"
-                               "\x09\x81\xf8\x43\x08\x61\x0c\xf3\xe0\x00\xC2\x00\x22\x0b\x00\x0b\x11\x00\x00\x04"
-                               "\x01\xc0\x24\x08\x40\x40\x08\x01\x80\x70\x0e\x01\x60\x4c\x09\x81\xf8\x43\x08\x61"
-                               "\x0c\xf3\xe0\x00\xC3\x00\x20\x0b\x00\x0b\x10\x00\x00\x1c\x82\xe0\x00\x02\x00\x40"
-                               "\x0c\x03\x80\x70\x0b\x02\x60\x4c\x0f\xc2\x18\x43\x08\x67\x9f\x00\xC4\x00\x20\x0b"
-                               "\x00\x0b\x10\x00\x00\x19\x03\x60\x00\x02\x00\x40\x0c\x03\x80\x70\x0b\x02\x60\x4c"
-                               "\x0f\xc2\x18\x43\x08\x67\x9f\x00\xC5\x00\x22\x0b\x00\x0b\x11\x00\x00\x06\x01\x40"
-                               "\x28\x03\x00\x40\x08\x01\x80\x70\x0e\x01\x60\x4c\x09\x81\xf8\x43\x08\x61\x0c\xf3"
-                               "\xe0\x00\xC6\x00\x24\x11\x00\x10\x0d\x00\x00\x07\xfe\x03\x82\x03\x81\x05\x89\x05"
-                               "\x88\x09\x88\x09\xf8\x11\x88\x1f\x88\x21\x89\x21\x81\x41\x81\xe3\xff\x00\xC7\x00"
-                               "\x20\x0c\x00\x0a\x11\x01\xfc\x1f\x8c\x36\x05\x81\xc0\x30\x0c\x03\x00\xc0\x58\x16"
-                               "\x04\x83\x1f\x01\x00\xe0\x08\x0e\x00\x00\xC8\x00\x20\x0c\x00\x0a\x11\x01\x00\x10"
-                               "\x0c\x00\x80\x10\xfb\x98\x26\x09\x89\x62\x18\x87\xe1\x88\x62\x18\x96\x05\x83\xff"
-                               "\xc0\x00\xC9\x00\x20\x0c\x00\x0a\x11\x01\x00\x02\x00\xc0\x40\x20\xf7\x98\x26\x09"
-                               "\x89\x62\x18\x87\xe1\x88\x62\x18\x96\x05\x83\xff\xc0\x00\xCA\x00\x20\x0c\x00\x0a"
-                               "\x11\x01\x00\x0c\x03\x01\x20\x84\xff\x98\x26\x09\x89\x62\x18\x87\xe1\x88\x62\x18"
-                               "\x96\x05\x83\xff\xc0\x00\xCB\x00\x1e\x0c\x00\x0a\x10\x01\x00\x12\x0c\xc0\x03\xfe"
-                               "\x60\x98\x26\x25\x88\x62\x1f\x86\x21\x88\x62\x58\x16\x0f\xff\x00\xCC\x00\x15\x06"
-                               "\x00\x05\x11\x01\x00\x86\x18\x2e\xb1\x8c\x63\x18\xc6\x31\x8c\xf8\x00\xCD\x00\x15"
-                               "\x06\x00\x05\x11\x01\x00\x08\xc8\x8f\xb1\x8c\x63\x18\xc6\x31\x8c\xf8\x00\xCE\x00"
-                               "\x17\x06\x00\x06\x11\x00\x00\x10\xc4\xa1\x78\xc3\x0c\x30\xc3\x0c\x30\xc3\x0c\x7c"
-                               "\x00\xCF\x00\x14\x06\x00\x05\x10\x01\x00\x9c\xc1\xf6\x31\x8c\x63\x18\xc6\x31\x9f"
-                               "\x00\xD0\x00\x20\x0e\x00\x0d\x0d\x00\x00\xff\xc1\x83\x0c\x0c\x60\x63\x03\x7f\x18"
-                               "\xc0\xe6\x06\x30\x31\x81\x8c\x0c\x60\xcf\xfc\x00\x00\xD1\x00\x22\x0d\x00\x0c\x10"
-                               "\x00\x00\x0e\x80\xb8\x00\x0f\x87\x38\x22\xc2\x2e\x22\x62\x23\x22\x3a\x21\xa2\x0e"
-                               "\x20\xe2\x06\x20\x6f\x02\x00\xD2\x00\x22\x0d\x00\x0b\x11\x01\x00\x10\x03\x00\x10"
-                               "\x01\x01\xf0\x41\x18\x33\x03\xc0\x78\x0f\x01\xe0\x3c\x06\xc0\xd8\x31\x04\x1f\x00"
-                               "\x00\xD3\x00\x22\x0d\x00\x0b\x11\x01\x00\x01\x00\x60\x10\x04\x01\xf0\x41\x18\x33"
-                               "\x03\xc0\x78\x0f\x01\xe0\x3c\x06\xc0\xd8\x31\x04\x1f\x00\x00\xD4\x00\x22\x0d\x00"
-                               "\x0b\x11\x01\x00\x06\x01\x40\x24\x08\x81\xf0\x41\x18\x33\x03\xc0\x78\x0f\x01\xe0"
-                               "\x3c\x06\xc0\xd8\x31\x04\x1f\x00\x00\xD5\x00\x20\x0d\x00\x0b\x10\x01\x00\x1c\x82"
-                               "\xe0\x00\x0f\x82\x08\xc1\x98\x1e\x03\xc0\x78\x0f\x01\xe0\x36\x06\xc1\x88\x20\xf8"
-                               "\x00\xD6\x00\x20\x0d\x00\x0b\x10\x01\x00\x1b\x03\x20\x00\x0f\x82\x08\xc1\x98\x1e"
-                               "\x03\xc0\x78\x0f\x01\xe0\x36\x06\xc1\x88\x20\xf8\x00\xD7\x00\x12\x0a\x00\x08\x08"
-                               "\x01\x00\xc1\x62\x34\x18\x1c\x26\x43\x81\x00\xD8\x00\x1c\x0d\x00\x0b\x0d\x01\x00"
-                               "\x1f\x24\x15\x83\x20\x7c\x17\x84\xf1\x1e\x43\xd0\x6c\x0d\x83\x30\x49\xf0\x00\xD9"
-                               "\x00\x26\x0d\x00\x0d\x11\x00\x00\x08\x00\x60\x00\x80\x02\x0f\xc7\x98\x10\xc0\x86"
-                               "\x04\x30\x21\x81\x0c\x08\x60\x43\x02\x18\x10\xc0\x86\x04\x1f\xc0\x00\xDA\x00\x26"
-                               "\x0d\x00\x0d\x11\x00\x00\x00\x80\x0c\x00\x80\x08\x0f\x87\x98\x10\xc0\x86\x04\x30"
-                               "\x21\x81\x0c\x08\x60\x43\x02\x18\x10\xc0\x86\x04\x1f\xc0\x00\xDB\x00\x26\x0d\x00"
-                               "\x0d\x11\x00\x00\x02\x00\x38\x01\x20\x11\x0f\x47\x98\x10\xc0\x86\x04\x30\x21\x81"
-                               "\x0c\x08\x60\x43\x02\x18\x10\xc0\x86\x04\x1f\xc0\x00\xDC\x00\x24\x0d\x00\x0d\x10"
-                               "\x00\x00\x0c\x80\x6c\x00\x01\xf8\xf3\x02\x18\x10\xc0\x86\x04\x30\x21\x81\x0c\x08"
-                               "\x60\x43\x02\x18\x10\xc0\x83\xf8\x00\xDD\x00\x20\x0a\x00\x0a\x11\x00\x00\x02\x00"
-                               "\xc0\x40\x20\xf1\xcc\x23\x10\x64\x1a\x03\x80\xc0\x30\x0c\x03\x00\xc0\x30\x1f\x00"
-                               "\x00\xDE\x00\x19\x0a\x00\x09\x0d\x01\x00\xf8\x30\x18\x0f\xc6\x33\x0d\x86\xc3\x63"
-                               "\x3f\x18\x0c\x0f\x80\x00\xDF\x00\x19\x0a\x00\x09\x0d\x00\x00\x1f\x18\xcc\x64\x22"
-                               "\x71\x0c\x86\x43\x21\x90\xca\x65\x3f\xf0\x00\xE0\x00\x17\x09\x00\x08\x0d\x01\x00"
-                               "\x60\x30\x08\x00\x7c\x46\x46\x1e\x66\xc6\xc6\xce\x77\x00\xE1\x00\x17\x09\x00\x08"
-                               "\x0d\x01\x00\x04\x0c\x30\x00\x7c\x46\x46\x1e\x66\xc6\xc6\xce\x77\x00\xE2\x00\x17"
-                               "\x09\x00\x08\x0d\x01\x00\x18\x28\x44\x00\x7c\x46\x46\x1e\x66\xc6\xc6\xce\x77\x00"
-                               "\xE3\x00\x17\x09\x00\x08\x0d\x01\x00\x32\x5c\x00\x00\x7c\x46\x46\x1e\x66\xc6\xc6"
-                               "\xce\x77\x00\xE4\x00\x16\x09\x00\x08\x0c\x01\x00\x64\x64\x00\x7c\x46\x46\x1e\x66"
-                               "\xc6\xc6\xce\x77\x00\xE5\x00\x17\x09\x00\x08\x0d\x01\x00\x38\x24\x18\x00\x7c\x46"
-                               "\x46\x1e\x66\xc6\xc6\xce\x77\x00\xE6\x00\x18\x0e\x00\x0c\x09\x01\x00\x79\xcc\x63"
-                               "\x46\x33\xff\xc4\x0c\x60\xc6\x1c\xe1\xf3\xe0\x00\xE7\x00\x17\x09\x00\x08\x0d\x01"
-                               "\xfc\x3c\x42\xc2\xc0\xc0\xc0\xc1\x62\x3c\x10\x18\x08\x38\x00\xE8\x00\x17\x09\x00"
-                               "\x08\x0d\x01\x00\x60\x30\x08\x00\x3c\x46\xc6\xff\xc0\xc0\xc1\x42\x3c\x00\xE9\x00"
-                               "\x17\x09\x00\x08\x0d\x01\x00\x04\x0c\x30\x00\x3c\x46\xc6\xff\xc0\xc0\xc1\x42\x3c"
-                               "\x00\xEA\x00\x17\x09\x00\x08\x0d\x01\x00\x18\x28\x44\x00\x3c\x46\xc6\xff\xc0\xc0"
-                               "\xc1\x42\x3c\x00\xEB\x00\x16\x09\x00\x08\x0c\x01\x00\x64\x64\x00\x3c\x46\xc6\xff"
-                               "\xc0\xc0\xc1\x42\x3c\x00\xEC\x00\x13\x05\x00\x05\x0d\x00\x00\xc3\x04\x0f\x18\xc6"
-                               "\x31\x8c\x6f\x80\x00\xED\x00\x13\x05\x00\x05\x0d\x00\x00\x08\x98\x0f\x18\xc6\x31"
-                               "\x8c\x6f\x80\x00\xEE\x00\x13\x05\x00\x05\x0d\x00\x00\x32\xa2\x0f\x18\xc6\x31\x8c"
-                               "\x6f\x80\x00\xEF\x00\x12\x05\x00\x05\x0c\x00\x00\xde\x41\xe3\x18\xc6\x31\x8d\xf0"
-                               "\x00\xF0\x00\x18\x0a\x00\x08\x0e\x01\x00\xc4\x38\x78\x8c\x06\x3e\x43\xc3\xc3\xc3"
-                               "\xc3\xc2\x42\x3c\x00\xF1\x00\x1b\x0b\x00\x0a\x0d\x00\x00\x1d\x09\xc0\x00\x00\xef"
-                               "\x0c\x63\x18\x86\x21\x88\x62\x18\x86\xfb\xc0\x00\xF2\x00\x17\x0a\x00\x08\x0d\x01"
-                               "\x00\x60\x30\x08\x00\x3c\x42\xc2\xc3\xc3\xc3\xc2\x42\x3c\x00\xF3\x00\x17\x0a\x00"
-                               "\x08\x0d\x01\x00\x04\x0c\x10\x00\x3c\x42\xc2\xc3\xc3\xc3\xc2\x42\x3c\x00\xF4\x00"
-                               "\x17\x0a\x00\x08\x0d\x01\x00\x18\x2c\x46\x00\x3c\x42\xc2\xc3\xc3\xc3\xc2\x42\x3c"
-                               "\x00\xF5\x00\x17\x0a\x00\x08\x0d\x01\x00\x32\x5c\x00\x00\x3c\x42\xc2\xc3\xc3\xc3"
-                               "\xc2\x42\x3c\x00\xF6\x00\x16\x0a\x00\x08\x0c\x01\x00\x66\x64\x00\x3c\x42\xc2\xc3"
-                               "\xc3\xc3\xc2\x42\x3c\x00\xF7\x00\x13\x0a\x00\x08\x09\x01\x00\x18\x18\x00\x00\xff"
-                               "\x00\x00\x18\x18\x00\xF8\x00\x13\x0a\x00\x08\x09\x01\x00\x3d\x42\xc6\xcb\xd3\xd3"
-                               "\xe2\x42\xbc\x00\xF9\x00\x1b\x0b\x00\x0a\x0d\x00\x00\x10\x02\x00\x60\x00\xe3\x88"
-                               "\x62\x18\x86\x21\x88\x62\x18\xce\x3d\xc0\x00\xFA\x00\x1b\x0b\x00\x0a\x0d\x00\x00"
-                               "\x03\x01\x80\x80\x00\xe3\x88\x62\x18\x86\x21\x88\x62\x18\xce\x3d\xc0\x00\xFB\x00"
-                               "\x1b\x0b\x00\x0a\x0d\x00\x00\x0c\x02\x81\x10\x00\xe3\x88\x62\x18\x86\x21\x88\x62"
-                               "\x18\xce\x3d\xc0\x00\xFC\x00\x19\x0b\x00\x0a\x0c\x00\x00\x1b\x04\xc0\x03\x8e\x21"
-                               "\x88\x62\x18\x86\x21\x88\x63\x38\xf7\x00\xFD\x00\x1e\x09\x00\x09\x11\x00\xfc\x06"
-                               "\x06\x04\x00\x0f\x39\x10\xc8\x64\x1a\x0e\x03\x01\x80\x80\x41\x20\x90\x70\x00\x00"
-                               "\xFE\x00\x1e\x0a\x00\x09\x11\x00\xfc\xe0\x10\x08\x04\x02\xf1\x8c\xc6\x43\x21\x90"
-                               "\xcc\x66\x22\xf1\x00\x80\x40\xf8\x00\x00\xFF\x00\x1c\x09\x00\x09\x10\x00\xfc\x36"
-                               "\x13\x00\x1e\x72\x21\x90\xc8\x34\x1c\x06\x03\x01\x00\x82\x41\x20\xe0\x01\x31\x00"
-                               "\x10\x05\x00\x05\x09\x00\x00\xf1\x8c\x63\x18\xc6\xf8\x01\x41\x00\x1b\x0b\x00\x0a"
-                               "\x0d\x01\x00\xf8\x18\x06\x11\x88\x6c\x1e\x06\x01\x80\xe0\x58\x16\x05\x83\xff\xc0"
-                               "\x01\x42\x00\x13\x05\x00\x05\x0d\x00\x00\xf1\x8c\x73\x99\xd6\x31\x8c\x6f\x80\x01"
-                               "\x52\x00\x26\x13\x00\x11\x0d\x01\x00\x1f\xff\x10\x60\x98\x30\x4c\x18\x9c\x0c\x46"
-                               "\x06\x23\x03\xf1\x81\x88\xc0\xc4\x30\x62\x58\x30\x24\x18\x31\xff\xf8\x01\x53\x00"
-                               "\x19\x0f\x00\x0d\x09\x01\x00\x3c\xf2\x38\xf0\xc7\x87\xfc\x30\x61\x83\x0c\x28\xe1"
-                               "\x3c\xf0\x01\x60\x00\x1b\x09\x00\x08\x11\x01\x00\x44\x2c\x18\x10\x3c\x42\x82\xc2"
-                               "\xe0\x78\x3e\x0e\x03\x81\x81\x82\x7c\x01\x61\x00\x14\x08\x00\x06\x0d\x01\x00\xcd"
-                               "\xe3\x00\x7a\x1c\x7c\x78\x78\x61\xf8\x01\x78\x00\x1e\x0a\x00\x0a\x10\x00\x00\x13"
-                               "\x0c\xc0\x03\xe7\x30\x8c\x41\x90\x68\x0e\x03\x00\xc0\x30\x0c\x03\x00\xc0\x7c\x01"
-                               "\x7D\x00\x20\x0c\x00\x0a\x11\x01\x00\x21\x04\x80\xc0\x30\x73\xd0\xe4\x32\x1c\x06"
-                               "\x03\x00\xc0\x60\x38\x4c\x16\x05\x83\xff\xc0\x01\x7E\x00\x17\x09\x00\x08\x0d\x00"
-                               "\x00\x22\x14\x18\x00\x7f\x46\x4c\x0c\x18\x31\x31\x61\xff\x01\x92\x00\x1c\x09\x00"
-                               "\x09\x10\x00\xfd\x03\x82\x41\x20\x80\xc0\x60\xf8\x18\x08\x04\x06\x03\x01\x04\x82"
-                               "\xc1\x80\x02\xC6\x00\x0c\x05\x00\x05\x03\x00\x0a\x62\xa2\x02\xC7\x00\x0c\x05\x00"
-                               "\x05\x03\x00\x0a\x8a\x98\x02\xD8\x00\x0c\x05\x00\x05\x03\x00\x0a\x8c\x5c\x02\xD9"
-                               "\x00\x0b\x05\x00\x02\x02\x01\x0a\x70\x02\xDA\x00\x0c\x05\x00\x03\x04\x01\x0a\xd6"
-                               "\xe0\x02\xDB\x00\x0c\x05\x00\x04\x04\x00\xfc\x34\xc7\x02\xDC\x00\x0c\x05\x00\x06"
-                               "\x02\xff\x0b\x76\x70\x02\xDD\x00\x0d\x05\x00\x08\x03\xff\x0a\x13\x36\xc8\x20\x13"
-                               "\x00\x0c\x09\x00\x09\x01\x00\x04\xff\x80\x20\x14\x00\x0c\x11\x00\x0d\x01\x02\x04"
-                               "\xff\xf8\x20\x18\x00\x0d\x04\x00\x03\x06\x01\x07\x2a\x4f\x80\x20\x19\x00\x0d\x04"
-                               "\x00\x03\x06\x01\x07\xd8\xa5\x00\x20\x1A\x00\x0c\x04\x00\x03\x05\x01\xfd\xdc\xa8"
-                               "\x20\x1C\x00\x0f\x08\x00\x06\x06\x01\x07\x25\x28\xa4\xff\x30\x20\x1D\x00\x0f\x08"
-                               "\x00\x06\x06\x01\x07\xcf\x72\x51\x4a\x40\x20\x1E\x00\x0e\x08\x00\x06\x05\x01\xfd"
-                               "\xdf\x32\x51\x98\x20\x20\x00\x19\x08\x00\x08\x0f\x00\xfe\x18\x18\x18\x10\xff\x52"
-                               "\x10\x10\x18\x18\x18\x18\x18\x18\x18\x20\x21\x00\x19\x08\x00\x08\x0f\x00\xfe\x18"
-                               "\x18\x18\x10\xff\x52\x10\x18\x10\x52\xff\x10\x18\x18\x18\x20\x22\x00\x10\x09\x00"
-                               "\x06\x07\x01\x03\x11\xef\xff\xfd\xf3\x80\x20\x26\x00\x0e\x11\x00\x0d\x02\x02\x00"
-                               "\xc7\x1e\x10\xc0\x20\x30\x00\x23\x11\x00\x0f\x0d\x01\x00\x70\x81\x22\x02\x48\x04"
-                               "\x90\x09\x40\x0c\x80\x02\x00\x05\x86\x14\x92\x48\xa4\x91\x4a\x24\x9c\x39\xc0\x20"
-                               "\x39\x00\x0d\x05\x00\x03\x06\x01\x01\x2b\x64\x40\x20\x3A\x00\x0d\x05\x00\x03\x06"
-                               "\x01\x01\x99\xbd\x00\x20\x44\x00\x19\x03\x00\x09\x0d\xfd\x00\x01\x80\x80\x80\x40"
-                               "\x40\x20\x20\x20\x10\x10\x08\x08\x08\x00\x21\x22\x00\x18\x11\x00\x0f\x07\x01\x05"
-                               "\xfb\x07\x4b\x08\x86\x31\x0e\x62\x15\x44\x2e\x9c\xeb\x80\x22\x12\x00\x0b\x0a\x00"
-                               "\x08\x01\x01\x04\xff\xFB\x00\x00\x20\x0b\x00\x0d\x0d\x00\x00\x1c\xf1\xbc\xc8\xe0"
-                               "\x43\x0f\xbe\x10\xc0\x86\x04\x30\x21\x81\x0c\x08\x60\x43\x0f\xbc\x00\xFB\x01\x00"
-                               "\x1b\x0b\x00\x0a\x0d\x00\x00\x1f\x0c\x42\x00\x80\xfb\x88\x62\x18\x86\x21\x88\x62"
-                               "\x18\x86\xfb\xc0\xFB\x02\x00\x1b\x0b\x00\x0a\x0d\x00\x00\x0f\x8c\x63\x18\x86\xf9"
-                               "\x88\x62\x18\x86\x21\x88\x62\x18\x86\xfb\xc0\xFB\x03\x00\x24\x10\x00\x10\x0d\x00"
-                               "\x00\x1c\x7c\x36\x8c\x22\x80\x21\x80\xfb\xde\x21\x86\x21\x86\x21\x86\x21\x86\x21"
-                               "\x86\x21\x86\x21\x86\xfb\xdf\xFB\x04\x00\x24\x10\x00\x10\x0d\x00\x00\x1c\x7e\x36"
-                               "\xc6\x22\x86\x21\x86\xfb\xc6\x21\x86\x21\x86\x21\x86\x21\x86\x21\x86\x21\x86\x21"
-                               "\x86\xfb\xdf";
+static constexpr Character bailleul_12_pt_characters[233] = {
+    {0x0000, 0, 7, 12, 6, 12, 0, 0},
+    {0x0020, 9, 5, 0, 0, 0, 0, 0},
+    {0x0021, 9, 5, 0, 3, 13, 1, 0},
+    {0x0022, 14, 8, 0, 4, 6, 2, 7},
+    {0x0023, 17, 9, 0, 9, 13, 0, 0},
+    {0x0024, 32, 9, 0, 8, 16, 1, -1},
+    {0x0025, 48, 17, 0, 13, 13, 2, 0},
+    {0x0026, 70, 13, 0, 11, 13, 1, 0},
+    {0x0027, 88, 4, 0, 2, 6, 1, 7},
+    {0x0028, 90, 7, 0, 5, 16, 2, -4},
+    {0x0029, 100, 7, 0, 5, 16, 0, -4},
+    {0x002A, 110, 7, 0, 6, 6, 0, 7},
+    {0x002B, 115, 10, 0, 8, 9, 1, 0},
+    {0x002C, 124, 5, 0, 3, 5, 1, -3},
+    {0x002D, 126, 7, 0, 5, 1, 1, 4},
+    {0x002E, 127, 5, 0, 3, 2, 1, 0},
+    {0x002F, 128, 7, 0, 7, 13, 0, 0},
+    {0x0030, 140, 9, 0, 8, 13, 1, 0},
+    {0x0031, 153, 9, 0, 6, 13, 2, 0},
+    {0x0032, 163, 9, 0, 9, 13, 0, 0},
+    {0x0033, 178, 9, 0, 8, 13, 0, 0},
+    {0x0034, 191, 9, 0, 9, 13, 0, 0},
+    {0x0035, 206, 9, 0, 7, 14, 1, 0},
+    {0x0036, 219, 9, 0, 8, 13, 1, 0},
+    {0x0037, 232, 9, 0, 9, 13, 1, 0},
+    {0x0038, 247, 9, 0, 8, 13, 1, 0},
+    {0x0039, 260, 9, 0, 8, 13, 1, 0},
+    {0x003A, 273, 5, 0, 3, 8, 1, 0},
+    {0x003B, 276, 5, 0, 3, 11, 1, -3},
+    {0x003C, 281, 10, 0, 8, 9, 1, 0},
+    {0x003D, 290, 10, 0, 8, 5, 1, 2},
+    {0x003E, 295, 10, 0, 8, 9, 1, 0},
+    {0x003F, 304, 8, 0, 6, 13, 1, 0},
+    {0x0040, 314, 14, 0, 12, 13, 1, 0},
+    {0x0041, 334, 11, 0, 11, 13, 0, 0},
+    {0x0042, 352, 11, 0, 9, 13, 1, 0},
+    {0x0043, 367, 12, 0, 10, 13, 1, 0},
+    {0x0044, 384, 14, 0, 13, 13, 0, 0},
+    {0x0045, 406, 12, 0, 10, 13, 1, 0},
+    {0x0046, 423, 10, 0, 9, 13, 1, 0},
+    {0x0047, 438, 13, 0, 12, 13, 1, 0},
+    {0x0048, 458, 13, 0, 13, 13, 0, 0},
+    {0x0049, 480, 6, 0, 5, 13, 1, 0},
+    {0x004A, 489, 8, 0, 7, 13, 0, 0},
+    {0x004B, 501, 12, 0, 11, 13, 1, 0},
+    {0x004C, 519, 11, 0, 10, 13, 1, 0},
+    {0x004D, 536, 16, 0, 16, 13, 0, 0},
+    {0x004E, 562, 13, 0, 12, 13, 0, 0},
+    {0x004F, 582, 13, 0, 11, 13, 1, 0},
+    {0x0050, 600, 10, 0, 9, 13, 1, 0},
+    {0x0051, 615, 13, 0, 12, 16, 1, -3},
+    {0x0052, 639, 11, 0, 10, 13, 1, 0},
+    {0x0053, 656, 9, 0, 8, 13, 1, 0},
+    {0x0054, 669, 12, 0, 10, 13, 1, 0},
+    {0x0055, 686, 13, 0, 13, 13, 0, 0},
+    {0x0056, 708, 11, 0, 11, 13, 0, 0},
+    {0x0057, 726, 17, 0, 17, 13, 0, 0},
+    {0x0058, 754, 12, 0, 12, 13, 0, 0},
+    {0x0059, 774, 10, 0, 10, 13, 0, 0},
+    {0x005A, 791, 12, 0, 10, 13, 1, 0},
+    {0x005B, 808, 6, 0, 3, 18, 2, -5},
+    {0x005C, 815, 7, 0, 7, 13, 0, 0},
+    {0x005D, 827, 6, 0, 4, 18, 0, -5},
+    {0x005E, 836, 10, 0, 8, 7, 1, 6},
+    {0x005F, 843, 9, 0, 9, 1, 0, -2},
+    {0x0060, 845, 5, 0, 4, 3, 0, 10},
+    {0x0061, 847, 9, 0, 8, 9, 1, 0},
+    {0x0062, 856, 10, 0, 9, 13, 0, 0},
+    {0x0063, 871, 9, 0, 8, 9, 1, 0},
+    {0x0064, 880, 10, 0, 9, 13, 1, 0},
+    {0x0065, 895, 9, 0, 8, 9, 1, 0},
+    {0x0066, 904, 6, 0, 7, 13, 0, 0},
+    {0x0067, 916, 10, 0, 8, 13, 1, -4},
+    {0x0068, 929, 11, 0, 10, 13, 0, 0},
+    {0x0069, 946, 5, 0, 5, 13, 0, 0},
+    {0x006A, 955, 5, 0, 4, 17, 0, -4},
+    {0x006B, 964, 10, 0, 10, 13, 0, 0},
+    {0x006C, 981, 5, 0, 5, 13, 0, 0},
+    {0x006D, 990, 16, 0, 16, 9, 0, 0},
+    {0x006E, 1008, 11, 0, 10, 9, 0, 0},
+    {0x006F, 1020, 10, 0, 8, 9, 1, 0},
+    {0x0070, 1029, 10, 0, 9, 13, 0, -4},
+    {0x0071, 1044, 10, 0, 9, 13, 1, -4},
+    {0x0072, 1059, 8, 0, 7, 9, 0, 0},
+    {0x0073, 1067, 8, 0, 6, 9, 1, 0},
+    {0x0074, 1074, 6, 0, 6, 11, 0, 0},
+    {0x0075, 1083, 11, 0, 10, 9, 0, 0},
+    {0x0076, 1095, 9, 0, 9, 9, 0, 0},
+    {0x0077, 1106, 14, 0, 14, 9, 0, 0},
+    {0x0078, 1122, 10, 0, 9, 9, 0, 0},
+    {0x0079, 1133, 9, 0, 9, 13, 0, -4},
+    {0x007A, 1148, 9, 0, 8, 9, 0, 0},
+    {0x007B, 1157, 6, 0, 5, 17, 0, -4},
+    {0x007C, 1168, 4, 0, 1, 18, 1, -4},
+    {0x007D, 1171, 6, 0, 5, 17, 0, -4},
+    {0x007E, 1182, 10, 0, 8, 2, 1, 3},
+    {0x00A1, 1184, 5, 0, 3, 13, 1, -4},
+    {0x00A2, 1189, 9, 0, 8, 13, 1, -2},
+    {0x00A3, 1202, 9, 0, 9, 13, 0, 0},
+    {0x00A4, 1217, 9, 0, 9, 9, 0, 2},
+    {0x00A5, 1228, 9, 0, 10, 13, 0, 0},
+    {0x00A6, 1245, 4, 0, 1, 13, 1, -2},
+    {0x00A7, 1247, 9, 0, 8, 17, 1, -4},
+    {0x00A8, 1264, 5, 0, 5, 2, 0, 10},
+    {0x00A9, 1266, 14, 0, 12, 13, 1, 0},
+    {0x00AA, 1286, 6, 0, 6, 6, 0, 6},
+    {0x00AB, 1291, 7, 0, 6, 6, 1, 1},
+    {0x00AC, 1296, 10, 0, 8, 5, 1, 2},
+    {0x00AD, 1301, 6, 0, 3, 1, 2, 3},
+    {0x00AE, 1302, 8, 0, 6, 7, 1, 6},
+    {0x00AF, 1308, 5, 0, 5, 1, 0, 11},
+    {0x00B0, 1309, 7, 0, 5, 5, 1, 7},
+    {0x00B1, 1313, 10, 0, 8, 9, 1, 0},
+    {0x00B2, 1322, 7, 0, 6, 8, 0, 6},
+    {0x00B3, 1328, 7, 0, 6, 8, 0, 6},
+    {0x00B4, 1334, 5, 0, 4, 3, 1, 10},
+    {0x00B5, 1336, 11, 0, 10, 13, 0, -4},
+    {0x00B6, 1353, 10, 0, 10, 16, 0, -3},
+    {0x00B7, 1373, 5, 0, 2, 2, 1, 4},
+    {0x00B8, 1374, 5, 0, 3, 4, 1, -4},
+    {0x00B9, 1376, 6, 0, 4, 8, 1, 6},
+    {0x00BA, 1380, 6, 0, 5, 6, 1, 6},
+    {0x00BB, 1384, 7, 0, 6, 6, 1, 1},
+    {0x00BC, 1389, 14, 0, 12, 13, 1, 0},
+    {0x00BD, 1409, 14, 0, 12, 14, 1, -1},
+    {0x00BE, 1430, 14, 0, 13, 13, 1, 0},
+    {0x00BF, 1452, 8, 0, 6, 13, 0, -4},
+    {0x00C0, 1462, 11, 0, 11, 17, 0, 0},
+    {0x00C1, 1486, 11, 0, 11, 17, 0, 0},
+    {0x00C2, 1510, 11, 0, 11, 17, 0, 0},
+    {0x00C3, 1534, 11, 0, 11, 16, 0, 0},
+    {0x00C4, 1556, 11, 0, 11, 16, 0, 0},
+    {0x00C5, 1578, 11, 0, 11, 17, 0, 0},
+    {0x00C6, 1602, 17, 0, 16, 13, 0, 0},
+    {0x00C7, 1628, 12, 0, 10, 17, 1, -4},
+    {0x00C8, 1650, 12, 0, 10, 17, 1, 0},
+    {0x00C9, 1672, 12, 0, 10, 17, 1, 0},
+    {0x00CA, 1694, 12, 0, 10, 17, 1, 0},
+    {0x00CB, 1716, 12, 0, 10, 16, 1, 0},
+    {0x00CC, 1736, 6, 0, 5, 17, 1, 0},
+    {0x00CD, 1747, 6, 0, 5, 17, 1, 0},
+    {0x00CE, 1758, 6, 0, 6, 17, 0, 0},
+    {0x00CF, 1771, 6, 0, 5, 16, 1, 0},
+    {0x00D0, 1781, 14, 0, 13, 13, 0, 0},
+    {0x00D1, 1803, 13, 0, 12, 16, 0, 0},
+    {0x00D2, 1827, 13, 0, 11, 17, 1, 0},
+    {0x00D3, 1851, 13, 0, 11, 17, 1, 0},
+    {0x00D4, 1875, 13, 0, 11, 17, 1, 0},
+    {0x00D5, 1899, 13, 0, 11, 16, 1, 0},
+    {0x00D6, 1921, 13, 0, 11, 16, 1, 0},
+    {0x00D7, 1943, 10, 0, 8, 8, 1, 0},
+    {0x00D8, 1951, 13, 0, 11, 13, 1, 0},
+    {0x00D9, 1969, 13, 0, 13, 17, 0, 0},
+    {0x00DA, 1997, 13, 0, 13, 17, 0, 0},
+    {0x00DB, 2025, 13, 0, 13, 17, 0, 0},
+    {0x00DC, 2053, 13, 0, 13, 16, 0, 0},
+    {0x00DD, 2079, 10, 0, 10, 17, 0, 0},
+    {0x00DE, 2101, 10, 0, 9, 13, 1, 0},
+    {0x00DF, 2116, 10, 0, 9, 13, 0, 0},
+    {0x00E0, 2131, 9, 0, 8, 13, 1, 0},
+    {0x00E1, 2144, 9, 0, 8, 13, 1, 0},
+    {0x00E2, 2157, 9, 0, 8, 13, 1, 0},
+    {0x00E3, 2170, 9, 0, 8, 13, 1, 0},
+    {0x00E4, 2183, 9, 0, 8, 12, 1, 0},
+    {0x00E5, 2195, 9, 0, 8, 13, 1, 0},
+    {0x00E6, 2208, 14, 0, 12, 9, 1, 0},
+    {0x00E7, 2222, 9, 0, 8, 13, 1, -4},
+    {0x00E8, 2235, 9, 0, 8, 13, 1, 0},
+    {0x00E9, 2248, 9, 0, 8, 13, 1, 0},
+    {0x00EA, 2261, 9, 0, 8, 13, 1, 0},
+    {0x00EB, 2274, 9, 0, 8, 12, 1, 0},
+    {0x00EC, 2286, 5, 0, 5, 13, 0, 0},
+    {0x00ED, 2295, 5, 0, 5, 13, 0, 0},
+    {0x00EE, 2304, 5, 0, 5, 13, 0, 0},
+    {0x00EF, 2313, 5, 0, 5, 12, 0, 0},
+    {0x00F0, 2321, 10, 0, 8, 14, 1, 0},
+    {0x00F1, 2335, 11, 0, 10, 13, 0, 0},
+    {0x00F2, 2352, 10, 0, 8, 13, 1, 0},
+    {0x00F3, 2365, 10, 0, 8, 13, 1, 0},
+    {0x00F4, 2378, 10, 0, 8, 13, 1, 0},
+    {0x00F5, 2391, 10, 0, 8, 13, 1, 0},
+    {0x00F6, 2404, 10, 0, 8, 12, 1, 0},
+    {0x00F7, 2416, 10, 0, 8, 9, 1, 0},
+    {0x00F8, 2425, 10, 0, 8, 9, 1, 0},
+    {0x00F9, 2434, 11, 0, 10, 13, 0, 0},
+    {0x00FA, 2451, 11, 0, 10, 13, 0, 0},
+    {0x00FB, 2468, 11, 0, 10, 13, 0, 0},
+    {0x00FC, 2485, 11, 0, 10, 12, 0, 0},
+    {0x00FD, 2500, 9, 0, 9, 17, 0, -4},
+    {0x00FE, 2520, 10, 0, 9, 17, 0, -4},
+    {0x00FF, 2540, 9, 0, 9, 16, 0, -4},
+    {0x0131, 2558, 5, 0, 5, 9, 0, 0},
+    {0x0141, 2564, 11, 0, 10, 13, 1, 0},
+    {0x0142, 2581, 5, 0, 5, 13, 0, 0},
+    {0x0152, 2590, 19, 0, 17, 13, 1, 0},
+    {0x0153, 2618, 15, 0, 13, 9, 1, 0},
+    {0x0160, 2633, 9, 0, 8, 17, 1, 0},
+    {0x0161, 2650, 8, 0, 6, 13, 1, 0},
+    {0x0178, 2660, 10, 0, 10, 16, 0, 0},
+    {0x017D, 2680, 12, 0, 10, 17, 1, 0},
+    {0x017E, 2702, 9, 0, 8, 13, 0, 0},
+    {0x0192, 2715, 9, 0, 9, 16, 0, -3},
+    {0x02C6, 2733, 5, 0, 5, 3, 0, 10},
+    {0x02C7, 2735, 5, 0, 5, 3, 0, 10},
+    {0x02D8, 2737, 5, 0, 5, 3, 0, 10},
+    {0x02D9, 2739, 5, 0, 2, 2, 1, 10},
+    {0x02DA, 2740, 5, 0, 3, 4, 1, 10},
+    {0x02DB, 2742, 5, 0, 4, 4, 0, -4},
+    {0x02DC, 2744, 5, 0, 6, 2, -1, 11},
+    {0x02DD, 2746, 5, 0, 8, 3, -1, 10},
+    {0x2013, 2749, 9, 0, 9, 1, 0, 4},
+    {0x2014, 2751, 17, 0, 13, 1, 2, 4},
+    {0x2018, 2753, 4, 0, 3, 6, 1, 7},
+    {0x2019, 2756, 4, 0, 3, 6, 1, 7},
+    {0x201A, 2759, 4, 0, 3, 5, 1, -3},
+    {0x201C, 2761, 8, 0, 6, 6, 1, 7},
+    {0x201D, 2766, 8, 0, 6, 6, 1, 7},
+    {0x201E, 2771, 8, 0, 6, 5, 1, -3},
+    {0x2020, 2775, 8, 0, 8, 15, 0, -2},
+    {0x2021, 2790, 8, 0, 8, 15, 0, -2},
+    {0x2022, 2805, 9, 0, 6, 7, 1, 3},
+    {0x2026, 2811, 17, 0, 13, 2, 2, 0},
+    {0x2030, 2815, 17, 0, 15, 13, 1, 0},
+    {0x2039, 2840, 5, 0, 3, 6, 1, 1},
+    {0x203A, 2843, 5, 0, 3, 6, 1, 1},
+    {0x2044, 2846, 3, 0, 9, 13, -3, 0},
+    {0x2122, 2861, 17, 0, 15, 7, 1, 5},
+    {0x2212, 2875, 10, 0, 8, 1, 1, 4},
+    {0xFB00, 2876, 11, 0, 13, 13, 0, 0},
+    {0xFB01, 2898, 11, 0, 10, 13, 0, 0},
+    {0xFB02, 2915, 11, 0, 10, 13, 0, 0},
+    {0xFB03, 2932, 16, 0, 16, 13, 0, 0},
+    {0xFB04, 2958, 16, 0, 16, 13, 0, 0},
+};
+
+static constexpr uint8_t bailleul_12_pt_bitmaps[2985] = "\xfe\x18\x61\x86\x18\x61\x86\x18\x7f\x5f\xa4\x92"
+                                                        "\x40\x74\x9b\x99\x99\x11\x09\x04\x82\x47\xf8\x90"
+                                                        "\x48\x44\xff\x12\x09\x04\x82\x40\x10\x10\x3c\x56"
+                                                        "\xd6\xd0\xf0\x78\x3e\x1e\x13\xd3\xd2\xd2\x7c\x10"
+                                                        "\x70\x64\x42\x22\x21\x11\x08\x90\x38\x80\x08\x00"
+                                                        "\x8e\x04\x88\x44\x42\x22\x21\x12\x07\x00\x1c\x04"
+                                                        "\x80\x90\x1c\x03\x3e\x71\x16\x24\x64\x8d\x30\xc7"
+                                                        "\x0c\xf1\xf7\xdc\x75\x50\x19\x10\x8c\x42\x10\x84"
+                                                        "\x21\x84\x20\x83\xc1\x04\x21\x84\x21\x08\x42\x31"
+                                                        "\x08\x98\x11\x5e\xcc\x69\xa0\x08\x08\x08\x08\xff"
+                                                        "\x08\x08\x08\x08\xfc\xac\xf8\xf8\x02\x0c\x10\x20"
+                                                        "\x81\x04\x08\x20\x41\x02\x08\x00\x38\x44\xc2\xc2"
+                                                        "\xc3\xc3\xc3\xc3\xc3\xc2\xc2\x44\x38\x10\xc7\x2c"
+                                                        "\x30\xc3\x0c\x30\xc3\x0c\xfc\x3e\x21\x90\xce\x66"
+                                                        "\x30\x18\x08\x08\x08\x08\x48\x2f\xef\xf0\x3c\x46"
+                                                        "\x67\x07\x06\x04\x3c\x06\x03\x03\xe3\x43\x3c\x06"
+                                                        "\x03\x03\x82\xc1\x61\x31\x18\x8d\xff\x83\x41\xa0"
+                                                        "\xc0\x60\x02\xf9\xf2\x04\x17\xb1\xc3\x06\x0e\x1c"
+                                                        "\x38\x6f\x00\x3c\x62\x42\xc0\xdc\xe6\xc6\xc3\xc3"
+                                                        "\xc2\xc2\x46\x3c\x7f\xbf\xa0\x90\x40\x40\x20\x20"
+                                                        "\x10\x18\x0c\x04\x06\x03\x00\x3c\x42\xc2\xc2\xe2"
+                                                        "\x7c\x5e\x86\x83\x83\x83\xc2\x7c\x3c\x46\xc6\xc2"
+                                                        "\xc3\xc3\xc7\x47\x3a\x06\xc6\xc4\x78\xf8\x00\x3e"
+                                                        "\xf8\x00\x3f\x2b\x00\x01\x06\x18\x60\x80\xe0\x38"
+                                                        "\x06\x01\xff\x00\x00\x00\xff\x80\x60\x18\x06\x01"
+                                                        "\x07\x1c\x70\x80\x7b\x3c\xc3\x0c\x31\x88\x20\x80"
+                                                        "\x18\x60\x1f\x82\x04\x40\x2c\x7d\x8c\x98\x89\x98"
+                                                        "\x99\x91\x9b\x2c\xcc\x40\x03\x04\x0f\x80\x04\x00"
+                                                        "\x80\x18\x07\x00\xe0\x16\x04\xc0\x98\x1f\x84\x30"
+                                                        "\x86\x10\xcf\x3e\xff\x31\x98\xec\x66\x33\xf1\x84"
+                                                        "\xc3\x61\xb0\xd8\x6c\x3f\xf0\x1f\x8c\x36\x05\x81"
+                                                        "\xc0\x30\x0c\x03\x00\xc0\x58\x16\x04\x83\x1f\x00"
+                                                        "\xff\xc1\x83\x0c\x0c\x60\x63\x03\x18\x18\xc0\xe6"
+                                                        "\x06\x30\x31\x81\x8c\x0c\x60\xcf\xfc\x00\xff\x98"
+                                                        "\x26\x09\x89\x62\x18\x87\xe1\x88\x62\x18\x96\x05"
+                                                        "\x83\xff\xc0\xff\xb0\x58\x2c\x56\x23\x11\xf8\xc4"
+                                                        "\x62\x31\x18\x0c\x0f\x80\x1f\x83\x0c\x60\x46\x04"
+                                                        "\xc0\x0c\x00\xc1\xfc\x04\xc0\x46\x04\x60\xc2\x0c"
+                                                        "\x1f\x80\xfc\xf9\x83\x0c\x18\x60\xc3\x06\x18\x30"
+                                                        "\xff\x86\x0c\x30\x61\x83\x0c\x18\x60\xcf\xcf\x80"
+                                                        "\xfb\x18\xc6\x31\x8c\x63\x18\xcf\x80\x3e\x18\x30"
+                                                        "\x60\xc1\x83\x06\x0c\x19\x36\x67\x80\xfb\x8c\x41"
+                                                        "\x88\x32\x06\x40\xf8\x19\x83\x30\x63\x0c\x61\x8e"
+                                                        "\x30\xcf\xbe\xf8\x18\x06\x01\x80\x60\x18\x06\x01"
+                                                        "\x80\x60\x58\x16\x05\x83\xff\xc0\xf8\x0f\x38\x1c"
+                                                        "\x38\x1c\x2c\x2c\x2c\x2c\x2c\x2c\x26\x4c\x26\x4c"
+                                                        "\x22\x8c\x23\x8c\x23\x0c\x21\x0c\xf1\x3f\xf8\x73"
+                                                        "\x82\x2c\x22\xe2\x26\x22\x32\x23\xa2\x1a\x20\xe2"
+                                                        "\x0e\x20\x62\x06\xf0\x20\x1f\x04\x11\x83\x30\x3c"
+                                                        "\x07\x80\xf0\x1e\x03\xc0\x6c\x0d\x83\x10\x41\xf0"
+                                                        "\xfe\x31\x98\x6c\x36\x1b\x0d\x8c\xfc\x60\x30\x18"
+                                                        "\x0c\x0f\x80\x1f\x02\x08\x60\xc6\x06\xc0\x6c\x06"
+                                                        "\xc0\x6c\x06\xc0\x6c\x06\x60\x46\x0c\x31\x81\xf0"
+                                                        "\x33\x92\x1e\xfe\x18\xc6\x31\x8c\x63\x18\xc7\xc1"
+                                                        "\x8c\x61\x98\x66\x19\x86\xf9\xc0\x3c\x42\x82\xc2"
+                                                        "\xe0\x78\x3e\x0e\x03\x81\x81\x82\x7c\xff\xe3\x18"
+                                                        "\xc6\x31\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30"
+                                                        "\x3f\x00\xfc\x79\x81\x0c\x08\x60\x43\x02\x18\x10"
+                                                        "\xc0\x86\x04\x30\x21\x81\x0c\x08\x60\x41\xfc\x00"
+                                                        "\xf9\xe6\x08\xc2\x18\x41\x88\x32\x06\x40\x48\x0e"
+                                                        "\x01\xc0\x10\x02\x00\x40\xfb\xf3\xb0\x60\x8c\x58"
+                                                        "\x86\x2c\x43\x16\x20\x91\x20\x68\xd0\x34\x68\x1a"
+                                                        "\x34\x06\x0c\x03\x06\x01\x82\x00\x81\x00\xfd\xe1"
+                                                        "\x88\x19\x00\xd0\x0e\x00\x60\x06\x00\x70\x0b\x01"
+                                                        "\x18\x11\x82\x0c\xf3\xf0\xf9\xcc\x23\x10\x64\x1a"
+                                                        "\x03\x80\xc0\x30\x0c\x03\x00\xc0\x30\x1f\x00\x7f"
+                                                        "\xd0\xe4\x32\x1c\x06\x03\x00\xc0\x60\x38\x4c\x16"
+                                                        "\x05\x83\xff\xc0\xfb\x6d\xb6\xdb\x6d\xb6\xdc\x80"
+                                                        "\x81\x01\x02\x02\x04\x04\x08\x08\x10\x30\x20\xf3"
+                                                        "\x33\x33\x33\x33\x33\x33\x33\x3f\x08\x18\x1c\x24"
+                                                        "\x26\x42\xc3\xff\x80\x8c\x30\x7c\x46\x46\x1e\x66"
+                                                        "\xc6\xc6\xce\x77\xe0\x10\x08\x04\x02\xf1\x8c\xc6"
+                                                        "\x43\x21\x90\xcc\x66\x22\xf0\x3c\x42\xc2\xc0\xc0"
+                                                        "\xc0\xc1\x62\x3c\x0e\x01\x00\x80\x47\xa2\x33\x09"
+                                                        "\x84\xc2\x61\x30\x88\xc7\xb8\x3c\x46\xc6\xff\xc0"
+                                                        "\xc0\xc1\x42\x3c\x1c\x6c\x81\x0f\x84\x08\x10\x20"
+                                                        "\x40\x81\x0f\x80\x3f\x65\x46\x66\x64\x98\x80\xfe"
+                                                        "\x7f\xc1\x81\x81\x7e\xe0\x08\x02\x00\x80\x2f\x0c"
+                                                        "\x63\x18\x86\x21\x88\x62\x18\x86\xfb\xc0\x31\x80"
+                                                        "\x0f\x18\xc6\x31\x8c\x6f\x80\x33\x00\xf3\x33\x33"
+                                                        "\x33\x33\x24\x80\xe0\x08\x02\x00\x80\x27\x08\x82"
+                                                        "\x40\x90\x3c\x09\x82\x30\x8c\xfb\xc0\xf1\x8c\x63"
+                                                        "\x18\xc6\x31\x8c\x6f\x80\xef\x3c\x31\xcc\x31\x84"
+                                                        "\x21\x84\x21\x84\x21\x84\x21\x84\x21\x84\xfb\xdf"
+                                                        "\xef\x0c\x63\x18\x86\x21\x88\x62\x18\x86\xfb\xc0"
+                                                        "\x3c\x42\xc2\xc3\xc3\xc3\xc2\x42\x3c\xef\x18\xcc"
+                                                        "\x64\x32\x19\x0c\xc6\x62\x2f\x10\x08\x04\x0f\x80"
+                                                        "\x7a\x23\x30\x98\x4c\x26\x13\x08\x8c\x7a\x01\x00"
+                                                        "\x80\x40\xf8\xe6\x54\xc9\x82\x04\x08\x10\xf8\x7a"
+                                                        "\x1c\x7c\x78\x78\x61\xf8\x61\x8f\x98\x61\x86\x18"
+                                                        "\x60\x93\x80\xe3\x88\x62\x18\x86\x21\x88\x62\x18"
+                                                        "\xce\x3d\xc0\xfb\x90\x8c\x86\x41\xa0\xe0\x70\x10"
+                                                        "\x08\x00\xff\xdc\x8e\x23\x28\x8c\xb4\x14\xd0\x71"
+                                                        "\x41\x86\x02\x18\x08\x40\xfb\x99\x06\x83\x80\xc0"
+                                                        "\x60\x58\x46\xf7\x80\xf3\x91\x0c\x86\x41\xa0\xe0"
+                                                        "\x30\x18\x08\x04\x12\x09\x07\x00\x7f\x46\x4c\x0c"
+                                                        "\x18\x31\x31\x61\xff\x19\x8c\x63\x18\xc4\xc1\x0c"
+                                                        "\x63\x18\xc6\x18\xff\xff\xc0\xe1\x0c\x63\x18\xc6"
+                                                        "\x09\x8c\x63\x18\xc4\xe0\x71\x8e\x5c\x04\x92\x4b"
+                                                        "\xf4\x08\x08\x34\x6a\x4b\xc8\xc8\xc8\xc9\x6a\x34"
+                                                        "\x08\x08\x0f\x08\xc4\x06\x03\x83\xf8\x60\x30\x18"
+                                                        "\x88\x44\x2e\x7c\xf0\xde\xb1\x90\x48\x14\x0a\x05"
+                                                        "\x06\xc6\xde\x80\xfb\xc8\x43\x10\x48\x1a\x07\x07"
+                                                        "\xf0\x30\x7f\x03\x00\xc0\x30\x3e\x00\xf0\x78\x3c"
+                                                        "\x46\x46\xc0\xa0\xb0\x98\x4c\x66\x32\x1a\x0d\x05"
+                                                        "\x42\xc2\xc4\x78\x9e\xc0\x0f\x03\x0c\x47\x69\x8a"
+                                                        "\x90\x1b\x01\xb0\x19\x01\x98\x98\x72\x40\x63\x0c"
+                                                        "\x0f\x00\x31\x23\x92\xd9\xb0\x25\x2b\x24\x48\x90"
+                                                        "\xff\x01\x01\x01\x01\xe0\x7a\xda\xed\xae\x17\x80"
+                                                        "\xf8\x74\x63\x17\x00\x08\x08\x08\xff\x08\x08\x08"
+                                                        "\x00\xff\x7b\x36\xc3\x18\x84\x7e\x79\x30\x8c\x0c"
+                                                        "\x1c\xde\x32\xc0\xe3\x88\x62\x18\x86\x21\x88\x62"
+                                                        "\x18\xce\x3d\xc8\x06\x01\x80\x20\x00\x3f\xde\x47"
+                                                        "\x93\xe4\x79\x1e\x43\x90\x14\x05\x01\x40\x50\x14"
+                                                        "\x05\x0a\xc6\xe0\xe0\xf0\x5c\xf0\x26\xa2\x22\x2f"
+                                                        "\x64\xa7\x39\x30\xa3\x46\x9b\xd2\x80\x20\x42\x04"
+                                                        "\xe0\x86\x10\x61\x06\x20\x62\x26\x46\xf8\xe0\x96"
+                                                        "\x11\xf1\x07\x20\x60\x00\x42\x08\xe0\x86\x10\x61"
+                                                        "\x06\x20\x62\xef\x49\x08\x10\x81\x10\x61\x09\x21"
+                                                        "\xf2\x00\x60\x44\x82\x24\x20\x21\x06\x10\x0c\x82"
+                                                        "\x68\x93\x8c\x64\x60\x45\x02\x7e\x20\x53\x02\x00"
+                                                        "\x18\x70\x02\x08\x23\x10\x43\x04\xd1\x38\x10\x03"
+                                                        "\x00\x10\x01\x00\x40\x08\x01\x80\x70\x0e\x01\x60"
+                                                        "\x4c\x09\x81\xf8\x43\x08\x61\x0c\xf3\xe0\x01\x00"
+                                                        "\x60\x18\x04\x00\x40\x08\x01\x80\x70\x0e\x01\x60"
+                                                        "\x4c\x09\x81\xf8\x43\x08\x61\x0c\xf3\xe0\x04\x01"
+                                                        "\xc0\x24\x08\x40\x40\x08\x01\x80\x70\x0e\x01\x60"
+                                                        "\x4c\x09\x81\xf8\x43\x08\x61\x0c\xf3\xe0\x1c\x82"
+                                                        "\xe0\x00\x02\x00\x40\x0c\x03\x80\x70\x0b\x02\x60"
+                                                        "\x4c\x0f\xc2\x18\x43\x08\x67\x9f\x19\x03\x60\x00"
+                                                        "\x02\x00\x40\x0c\x03\x80\x70\x0b\x02\x60\x4c\x0f"
+                                                        "\xc2\x18\x43\x08\x67\x9f\x06\x01\x40\x28\x03\x00"
+                                                        "\x40\x08\x01\x80\x70\x0e\x01\x60\x4c\x09\x81\xf8"
+                                                        "\x43\x08\x61\x0c\xf3\xe0\x07\xfe\x03\x82\x03\x81"
+                                                        "\x05\x89\x05\x88\x09\x88\x09\xf8\x11\x88\x1f\x88"
+                                                        "\x21\x89\x21\x81\x41\x81\xe3\xff\x1f\x8c\x36\x05"
+                                                        "\x81\xc0\x30\x0c\x03\x00\xc0\x58\x16\x04\x83\x1f"
+                                                        "\x01\x00\xe0\x08\x0e\x00\x10\x0c\x00\x80\x10\xfb"
+                                                        "\x98\x26\x09\x89\x62\x18\x87\xe1\x88\x62\x18\x96"
+                                                        "\x05\x83\xff\xc0\x02\x00\xc0\x40\x20\xf7\x98\x26"
+                                                        "\x09\x89\x62\x18\x87\xe1\x88\x62\x18\x96\x05\x83"
+                                                        "\xff\xc0\x0c\x03\x01\x20\x84\xff\x98\x26\x09\x89"
+                                                        "\x62\x18\x87\xe1\x88\x62\x18\x96\x05\x83\xff\xc0"
+                                                        "\x12\x0c\xc0\x03\xfe\x60\x98\x26\x25\x88\x62\x1f"
+                                                        "\x86\x21\x88\x62\x58\x16\x0f\xff\x86\x18\x2e\xb1"
+                                                        "\x8c\x63\x18\xc6\x31\x8c\xf8\x08\xc8\x8f\xb1\x8c"
+                                                        "\x63\x18\xc6\x31\x8c\xf8\x10\xc4\xa1\x78\xc3\x0c"
+                                                        "\x30\xc3\x0c\x30\xc3\x0c\x7c\x9c\xc1\xf6\x31\x8c"
+                                                        "\x63\x18\xc6\x31\x9f\xff\xc1\x83\x0c\x0c\x60\x63"
+                                                        "\x03\x7f\x18\xc0\xe6\x06\x30\x31\x81\x8c\x0c\x60"
+                                                        "\xcf\xfc\x00\x0e\x80\xb8\x00\x0f\x87\x38\x22\xc2"
+                                                        "\x2e\x22\x62\x23\x22\x3a\x21\xa2\x0e\x20\xe2\x06"
+                                                        "\x20\x6f\x02\x10\x03\x00\x10\x01\x01\xf0\x41\x18"
+                                                        "\x33\x03\xc0\x78\x0f\x01\xe0\x3c\x06\xc0\xd8\x31"
+                                                        "\x04\x1f\x00\x01\x00\x60\x10\x04\x01\xf0\x41\x18"
+                                                        "\x33\x03\xc0\x78\x0f\x01\xe0\x3c\x06\xc0\xd8\x31"
+                                                        "\x04\x1f\x00\x06\x01\x40\x24\x08\x81\xf0\x41\x18"
+                                                        "\x33\x03\xc0\x78\x0f\x01\xe0\x3c\x06\xc0\xd8\x31"
+                                                        "\x04\x1f\x00\x1c\x82\xe0\x00\x0f\x82\x08\xc1\x98"
+                                                        "\x1e\x03\xc0\x78\x0f\x01\xe0\x36\x06\xc1\x88\x20"
+                                                        "\xf8\x1b\x03\x20\x00\x0f\x82\x08\xc1\x98\x1e\x03"
+                                                        "\xc0\x78\x0f\x01\xe0\x36\x06\xc1\x88\x20\xf8\xc1"
+                                                        "\x62\x34\x18\x1c\x26\x43\x81\x1f\x24\x15\x83\x20"
+                                                        "\x7c\x17\x84\xf1\x1e\x43\xd0\x6c\x0d\x83\x30\x49"
+                                                        "\xf0\x08\x00\x60\x00\x80\x02\x0f\xc7\x98\x10\xc0"
+                                                        "\x86\x04\x30\x21\x81\x0c\x08\x60\x43\x02\x18\x10"
+                                                        "\xc0\x86\x04\x1f\xc0\x00\x80\x0c\x00\x80\x08\x0f"
+                                                        "\x87\x98\x10\xc0\x86\x04\x30\x21\x81\x0c\x08\x60"
+                                                        "\x43\x02\x18\x10\xc0\x86\x04\x1f\xc0\x02\x00\x38"
+                                                        "\x01\x20\x11\x0f\x47\x98\x10\xc0\x86\x04\x30\x21"
+                                                        "\x81\x0c\x08\x60\x43\x02\x18\x10\xc0\x86\x04\x1f"
+                                                        "\xc0\x0c\x80\x6c\x00\x01\xf8\xf3\x02\x18\x10\xc0"
+                                                        "\x86\x04\x30\x21\x81\x0c\x08\x60\x43\x02\x18\x10"
+                                                        "\xc0\x83\xf8\x02\x00\xc0\x40\x20\xf1\xcc\x23\x10"
+                                                        "\x64\x1a\x03\x80\xc0\x30\x0c\x03\x00\xc0\x30\x1f"
+                                                        "\x00\xf8\x30\x18\x0f\xc6\x33\x0d\x86\xc3\x63\x3f"
+                                                        "\x18\x0c\x0f\x80\x1f\x18\xcc\x64\x22\x71\x0c\x86"
+                                                        "\x43\x21\x90\xca\x65\x3f\xf0\x60\x30\x08\x00\x7c"
+                                                        "\x46\x46\x1e\x66\xc6\xc6\xce\x77\x04\x0c\x30\x00"
+                                                        "\x7c\x46\x46\x1e\x66\xc6\xc6\xce\x77\x18\x28\x44"
+                                                        "\x00\x7c\x46\x46\x1e\x66\xc6\xc6\xce\x77\x32\x5c"
+                                                        "\x00\x00\x7c\x46\x46\x1e\x66\xc6\xc6\xce\x77\x64"
+                                                        "\x64\x00\x7c\x46\x46\x1e\x66\xc6\xc6\xce\x77\x38"
+                                                        "\x24\x18\x00\x7c\x46\x46\x1e\x66\xc6\xc6\xce\x77"
+                                                        "\x79\xcc\x63\x46\x33\xff\xc4\x0c\x60\xc6\x1c\xe1"
+                                                        "\xf3\xe0\x3c\x42\xc2\xc0\xc0\xc0\xc1\x62\x3c\x10"
+                                                        "\x18\x08\x38\x60\x30\x08\x00\x3c\x46\xc6\xff\xc0"
+                                                        "\xc0\xc1\x42\x3c\x04\x0c\x30\x00\x3c\x46\xc6\xff"
+                                                        "\xc0\xc0\xc1\x42\x3c\x18\x28\x44\x00\x3c\x46\xc6"
+                                                        "\xff\xc0\xc0\xc1\x42\x3c\x64\x64\x00\x3c\x46\xc6"
+                                                        "\xff\xc0\xc0\xc1\x42\x3c\xc3\x04\x0f\x18\xc6\x31"
+                                                        "\x8c\x6f\x80\x08\x98\x0f\x18\xc6\x31\x8c\x6f\x80"
+                                                        "\x32\xa2\x0f\x18\xc6\x31\x8c\x6f\x80\xde\x41\xe3"
+                                                        "\x18\xc6\x31\x8d\xf0\xc4\x38\x78\x8c\x06\x3e\x43"
+                                                        "\xc3\xc3\xc3\xc3\xc2\x42\x3c\x1d\x09\xc0\x00\x00"
+                                                        "\xef\x0c\x63\x18\x86\x21\x88\x62\x18\x86\xfb\xc0"
+                                                        "\x60\x30\x08\x00\x3c\x42\xc2\xc3\xc3\xc3\xc2\x42"
+                                                        "\x3c\x04\x0c\x10\x00\x3c\x42\xc2\xc3\xc3\xc3\xc2"
+                                                        "\x42\x3c\x18\x2c\x46\x00\x3c\x42\xc2\xc3\xc3\xc3"
+                                                        "\xc2\x42\x3c\x32\x5c\x00\x00\x3c\x42\xc2\xc3\xc3"
+                                                        "\xc3\xc2\x42\x3c\x66\x64\x00\x3c\x42\xc2\xc3\xc3"
+                                                        "\xc3\xc2\x42\x3c\x18\x18\x00\x00\xff\x00\x00\x18"
+                                                        "\x18\x3d\x42\xc6\xcb\xd3\xd3\xe2\x42\xbc\x10\x02"
+                                                        "\x00\x60\x00\xe3\x88\x62\x18\x86\x21\x88\x62\x18"
+                                                        "\xce\x3d\xc0\x03\x01\x80\x80\x00\xe3\x88\x62\x18"
+                                                        "\x86\x21\x88\x62\x18\xce\x3d\xc0\x0c\x02\x81\x10"
+                                                        "\x00\xe3\x88\x62\x18\x86\x21\x88\x62\x18\xce\x3d"
+                                                        "\xc0\x1b\x04\xc0\x03\x8e\x21\x88\x62\x18\x86\x21"
+                                                        "\x88\x63\x38\xf7\x06\x06\x04\x00\x0f\x39\x10\xc8"
+                                                        "\x64\x1a\x0e\x03\x01\x80\x80\x41\x20\x90\x70\x00"
+                                                        "\xe0\x10\x08\x04\x02\xf1\x8c\xc6\x43\x21\x90\xcc"
+                                                        "\x66\x22\xf1\x00\x80\x40\xf8\x00\x36\x13\x00\x1e"
+                                                        "\x72\x21\x90\xc8\x34\x1c\x06\x03\x01\x00\x82\x41"
+                                                        "\x20\xe0\xf1\x8c\x63\x18\xc6\xf8\xf8\x18\x06\x11"
+                                                        "\x88\x6c\x1e\x06\x01\x80\xe0\x58\x16\x05\x83\xff"
+                                                        "\xc0\xf1\x8c\x73\x99\xd6\x31\x8c\x6f\x80\x1f\xff"
+                                                        "\x10\x60\x98\x30\x4c\x18\x9c\x0c\x46\x06\x23\x03"
+                                                        "\xf1\x81\x88\xc0\xc4\x30\x62\x58\x30\x24\x18\x31"
+                                                        "\xff\xf8\x3c\xf2\x38\xf0\xc7\x87\xfc\x30\x61\x83"
+                                                        "\x0c\x28\xe1\x3c\xf0\x44\x2c\x18\x10\x3c\x42\x82"
+                                                        "\xc2\xe0\x78\x3e\x0e\x03\x81\x81\x82\x7c\xcd\xe3"
+                                                        "\x00\x7a\x1c\x7c\x78\x78\x61\xf8\x13\x0c\xc0\x03"
+                                                        "\xe7\x30\x8c\x41\x90\x68\x0e\x03\x00\xc0\x30\x0c"
+                                                        "\x03\x00\xc0\x7c\x21\x04\x80\xc0\x30\x73\xd0\xe4"
+                                                        "\x32\x1c\x06\x03\x00\xc0\x60\x38\x4c\x16\x05\x83"
+                                                        "\xff\xc0\x22\x14\x18\x00\x7f\x46\x4c\x0c\x18\x31"
+                                                        "\x31\x61\xff\x03\x82\x41\x20\x80\xc0\x60\xf8\x18"
+                                                        "\x08\x04\x06\x03\x01\x04\x82\xc1\x80\x62\xa2\x8a"
+                                                        "\x98\x8c\x5c\x70\xd6\xe0\x34\xc7\x76\x70\x13\x36"
+                                                        "\xc8\xff\x80\xff\xf8\x2a\x4f\x80\xd8\xa5\x00\xdc"
+                                                        "\xa8\x25\x28\xa4\xff\x30\xcf\x72\x51\x4a\x40\xdf"
+                                                        "\x32\x51\x98\x18\x18\x18\x10\xff\x52\x10\x10\x18"
+                                                        "\x18\x18\x18\x18\x18\x18\x18\x18\x18\x10\xff\x52"
+                                                        "\x10\x18\x10\x52\xff\x10\x18\x18\x18\x11\xef\xff"
+                                                        "\xfd\xf3\x80\xc7\x1e\x10\xc0\x70\x81\x22\x02\x48"
+                                                        "\x04\x90\x09\x40\x0c\x80\x02\x00\x05\x86\x14\x92"
+                                                        "\x48\xa4\x91\x4a\x24\x9c\x39\xc0\x2b\x64\x40\x99"
+                                                        "\xbd\x00\x01\x80\x80\x80\x40\x40\x20\x20\x20\x10"
+                                                        "\x10\x08\x08\x08\x00\xfb\x07\x4b\x08\x86\x31\x0e"
+                                                        "\x62\x15\x44\x2e\x9c\xeb\x80\xff\x1c\xf1\xbc\xc8"
+                                                        "\xe0\x43\x0f\xbe\x10\xc0\x86\x04\x30\x21\x81\x0c"
+                                                        "\x08\x60\x43\x0f\xbc\x00\x1f\x0c\x42\x00\x80\xfb"
+                                                        "\x88\x62\x18\x86\x21\x88\x62\x18\x86\xfb\xc0\x0f"
+                                                        "\x8c\x63\x18\x86\xf9\x88\x62\x18\x86\x21\x88\x62"
+                                                        "\x18\x86\xfb\xc0\x1c\x7c\x36\x8c\x22\x80\x21\x80"
+                                                        "\xfb\xde\x21\x86\x21\x86\x21\x86\x21\x86\x21\x86"
+                                                        "\x21\x86\x21\x86\xfb\xdf\x1c\x7e\x36\xc6\x22\x86"
+                                                        "\x21\x86\xfb\xc6\x21\x86\x21\x86\x21\x86\x21\x86"
+                                                        "\x21\x86\x21\x86\x21\x86\xfb\xdf";
+
+constexpr Font bailleul_12_pt = {
+    .size = 12,
+    .numCharacters = 232,
+    .boundingBoxWidth = 21,
+    .boundingBoxHeight = 22,
+    .boundingBoxXOffset = -3,
+    .boundingBoxYOffset = -5,
+    .ascent = 16,
+    .descent = 4,
+    .asciiIndex = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                   28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+                   53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+                   78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95},
+    .characters = bailleul_12_pt_characters,
+    .bitmaps = bailleul_12_pt_bitmaps,
+};
 
 // bailleul
 //   - Copyright (c) 2019 Yomli  Copyright (c) 1850 Bailleul et Cie  Copyright (c) 1800 Justus Erich Walbaum"
 //   - Size: 16
 //   - Characters: 232
-uint8_t bailleul_16_pt[7002] = "\x10\x00\xe8\x1b\x1b\xfc\xfa\x14\x05\x00\x00\x00\x1a\x09\x10\x08\x10\x00\x00\xff"
-                               "\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\xff\x00\x20\x00\x0a\x06"
-                               "\x00\x00\x00\x00\x00\x00\x21\x00\x10\x07\x00\x03\x10\x02\x00\xdf\xfd\xb6\x49\x21"
-                               "\xbe\x00\x22\x00\x10\x0a\x00\x06\x07\x02\x09\x4f\x34\xd3\x49\x24\x80\x00\x23\x00"
-                               "\x20\x0c\x00\x0b\x10\x01\x00\x19\x83\x30\x46\x08\x81\x11\xff\xcc\x41\x88\x33\x04"
-                               "\x63\xff\x11\x02\x20\x44\x18\x83\x30\x00\x24\x00\x23\x0c\x00\x0a\x14\x01\xfe\x04"
-                               "\x01\x01\xf0\x96\x45\xd1\x26\x41\xd0\x7c\x0f\xc0\xf8\x1f\x04\xd1\x3e\x47\x13\x65"
-                               "\x8f\x80\x40\x10\x00\x25\x00\x2e\x16\x00\x12\x10\x02\x00\x3c\x04\x10\x82\x0c\x20"
-                               "\x83\x0c\x40\xc2\x10\x10\x88\x04\x64\x00\xe1\x00\x00\x87\x00\x26\x20\x11\x08\x08"
-                               "\x43\x02\x30\xc1\x04\x20\x81\x08\x20\x3c\x00\x26\x00\x28\x11\x00\x0f\x10\x01\x00"
-                               "\x0f\x00\x22\x00\x44\x00\xc8\x01\xa0\x03\x9f\x87\x0c\x17\x10\x46\x21\x8e\x47\x0e"
-                               "\x8e\x0e\x1e\x1c\x3c\x1c\x5c\x5f\x1f\x1c\x00\x27\x00\x0c\x06\x00\x02\x07\x02\x09"
-                               "\xff\xe8\x00\x28\x00\x1e\x09\x00\x07\x16\x02\xfa\x06\x10\x41\x82\x0c\x18\x60\xc1"
-                               "\x83\x06\x0c\x18\x30\x30\x60\x40\xc0\xc0\x40\x40\x00\x29\x00\x1e\x09\x00\x07\x16"
-                               "\x00\xfa\xc0\x40\x40\xc0\x81\x83\x03\x06\x0c\x18\x30\x60\xc1\x86\x0c\x10\x41\x84"
-                               "\x10\x00\x00\x2A\x00\x11\x09\x00\x07\x07\x01\x09\x30\x63\x5f\xf3\x0d\x93\x00\x00"
-                               "\x2B\x00\x1a\x0d\x00\x0b\x0b\x01\x00\x04\x00\x80\x10\x02\x00\x41\xff\xc1\x00\x20"
-                               "\x04\x00\x80\x10\x00\x00\x2C\x00\x0d\x06\x00\x03\x07\x02\xfc\xdf\x92\xa0\x00\x2D"
-                               "\x00\x0b\x09\x00\x06\x01\x01\x05\xfc\x00\x2E\x00\x0c\x06\x00\x03\x03\x02\x00\xdf"
-                               "\x00\x00\x2F\x00\x1e\x09\x00\x0a\x10\x00\x00\x00\xc0\x60\x10\x0c\x02\x01\x80\x40"
-                               "\x30\x08\x06\x01\x00\xc0\x20\x18\x04\x03\x00\x00\x30\x00\x1e\x0c\x00\x0a\x10\x01"
-                               "\x00\x1e\x08\x46\x19\x83\xe0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x83\x60\xd8\x62\x10"
-                               "\x78\x00\x31\x00\x1a\x0c\x00\x08\x10\x02\x00\x0c\x0c\x1c\x3c\x5c\x9c\x1c\x1c\x1c"
-                               "\x1c\x1c\x1c\x1c\x1c\x1c\x7f\x00\x32\x00\x20\x0c\x00\x0b\x10\x00\x00\x1f\x84\x39"
-                               "\x03\x28\x77\x8e\x61\xc0\x30\x06\x01\x80\x60\x18\x06\x01\x02\x40\xdf\xf7\xfe\x00"
-                               "\x33\x00\x1e\x0c\x00\x0a\x10\x01\x00\x3e\x10\xce\x39\x8e\x03\x80\xc0\x60\xf0\x03"
-                               "\x00\xe0\x1c\x07\xc1\xf0\xe8\x31\xf8\x00\x34\x00\x20\x0c\x00\x0b\x10\x00\x00\x01"
-                               "\x00\x20\x0c\x03\x80\xb0\x16\x04\xc1\x18\x23\x28\x67\xff\x81\x90\x32\x06\x00\xc0"
-                               "\x18\x00\x35\x00\x20\x0c\x00\x0a\x11\x01\x00\x00\x8f\xe3\xf0\x80\x40\x10\x05\xe1"
-                               "\x8e\x41\xa0\x70\x1c\x07\x01\xe0\x78\x19\x0c\x3e\x00\x00\x36\x00\x1e\x0c\x00\x0a"
-                               "\x10\x01\x00\x0f\x0c\x62\x1d\x83\x60\x3b\xcf\x1b\x87\xe1\xf8\x3e\x0f\x83\x60\xd8"
-                               "\x63\x18\x7c\x00\x37\x00\x20\x0c\x00\x0b\x10\x01\x00\x3f\xe7\xf9\x01\x20\x48\x18"
-                               "\x02\x00\xc0\x10\x06\x00\xc0\x30\x06\x00\xc0\x38\x07\x00\xe0\x00\x38\x00\x1e\x0c"
-                               "\x00\x0a\x10\x01\x00\x1f\x08\x66\x0d\x03\x60\xdc\x27\xd0\x7c\x67\xd0\x7c\x0f\x03"
-                               "\xc0\xf0\x36\x08\xfc\x00\x39\x00\x1e\x0c\x00\x0a\x10\x01\x00\x1e\x18\x66\x1b\x87"
-                               "\xe0\xf8\x3e\x0f\x87\x61\xdc\xb3\xcc\x07\x41\xb8\x66\x30\xf8\x00\x3A\x00\x0e\x06"
-                               "\x00\x03\x0a\x02\x00\xdf\x00\x06\xf8\x00\x3B\x00\x10\x06\x00\x03\x0e\x02\xfc\xdf"
-                               "\x00\x06\xfc\x95\x00\x00\x3C\x00\x1a\x0d\x00\x0b\x0b\x01\x00\x00\x60\x30\x18\x0c"
-                               "\x06\x01\x80\x1c\x00\xe0\x07\x00\x3c\x01\x80\x00\x3D\x00\x11\x0d\x00\x0b\x05\x01"
-                               "\x03\xff\xe0\x00\x00\x00\x0f\xfe\x00\x3E\x00\x1a\x0d\x00\x0b\x0b\x01\x00\xc0\x06"
-                               "\x00\x30\x01\xc0\x06\x00\xc0\x78\x38\x1c\x1e\x03\x00\x00\x00\x3F\x00\x18\x0a\x00"
-                               "\x07\x10\x02\x00\x79\x8b\x1e\x30\x60\xc1\x86\x30\x40\x81\x00\x0c\x1c\x30\x00\x40"
-                               "\x00\x2a\x12\x00\x10\x10\x01\x00\x07\xe0\x18\x18\x30\x04\x60\x02\x41\xd9\xc3\x31"
-                               "\xc6\x31\xc4\x31\xc4\x21\xcc\x62\xc6\xa4\xc7\x38\x60\x00\x30\x00\x18\x18\x07\xe0"
-                               "\x00\x41\x00\x28\x0f\x00\x0f\x10\x00\x00\x01\x00\x02\x00\x0c\x00\x1c\x00\x38\x00"
-                               "\xb0\x01\x70\x02\xe0\x08\xc0\x11\xc0\x3f\x80\x83\x01\x07\x04\x0e\x08\x0c\x7c\x7f"
-                               "\x00\x42\x00\x24\x0f\x00\x0d\x10\x01\x00\xff\xc1\x87\x0c\x18\x60\xc3\x06\x18\x30"
-                               "\xc3\x07\xf0\x30\x61\x81\x8c\x0c\x60\x73\x03\x18\x18\xc1\xdf\xf8\x00\x43\x00\x24"
-                               "\x10\x00\x0d\x10\x01\x00\x07\xe0\xc0\xcc\x02\xe0\x17\x00\xb0\x03\x80\x1c\x00\xe0"
-                               "\x07\x00\x18\x02\xe0\x17\x00\x98\x0c\x60\xe0\xfc\x00\x44\x00\x28\x12\x00\x0f\x10"
-                               "\x01\x00\xff\xe0\x60\x30\xc0\x71\x80\x63\x00\xe6\x01\xcc\x03\x98\x07\x30\x0e\x60"
-                               "\x1c\xc0\x39\x80\x73\x00\xc6\x03\x8c\x0e\x7f\xf0\x00\x45\x00\x24\x0f\x00\x0d\x10"
-                               "\x01\x00\xff\xf1\x80\x8c\x04\x60\x13\x08\x98\x40\xc2\x07\xf0\x30\x81\x84\x0c\x22"
-                               "\x61\x13\x00\x98\x04\xc0\x7f\xff\x00\x46\x00\x22\x0d\x00\x0c\x10\x01\x00\xff\xf3"
-                               "\x01\x30\x13\x01\x30\x93\x08\x30\x83\xf8\x30\x83\x08\x30\x83\x08\x30\x03\x00\x30"
-                               "\x0f\xc0\x00\x47\x00\x2a\x11\x00\x10\x10\x01\x00\x07\xe0\x18\x38\x30\x18\x70\x08"
-                               "\x70\x08\x60\x08\xe0\x00\xe0\x00\xe0\x7f\xe0\x1c\x60\x1c\x70\x1c\x70\x1c\x30\x1c"
-                               "\x18\x1c\x07\xe0\x00\x48\x00\x2a\x11\x00\x10\x10\x01\x00\xfc\x7f\x30\x18\x30\x18"
-                               "\x30\x18\x30\x18\x30\x18\x30\x18\x3f\xf8\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18"
-                               "\x30\x18\x30\x18\xfc\x7f\x00\x49\x00\x16\x08\x00\x06\x10\x01\x00\xfc\xc3\x0c\x30"
-                               "\xc3\x0c\x30\xc3\x0c\x30\xc3\x3f\x00\x4A\x00\x1c\x0a\x00\x09\x10\x01\x00\x3f\x87"
-                               "\x03\x81\xc0\xe0\x70\x38\x1c\x0e\x07\x03\x81\xcc\xe6\x72\x30\xf0\x00\x4B\x00\x28"
-                               "\x0f\x00\x0f\x10\x01\x00\xfc\xf0\x60\x80\xc2\x01\x84\x03\x10\x06\x20\x0c\xc0\x1f"
-                               "\xc0\x33\x80\x63\x80\xc7\x01\x87\x03\x0e\x06\x0e\x0c\x1c\x7e\x7f\x00\x4C\x00\x24"
-                               "\x0f\x00\x0d\x10\x01\x00\xfc\x01\x80\x0c\x00\x60\x03\x00\x18\x00\xc0\x06\x00\x30"
-                               "\x01\x80\x0c\x02\x60\x13\x00\x98\x04\xc0\x7f\xff\x00\x4D\x00\x30\x15\x00\x13\x10"
-                               "\x01\x00\xf8\x03\xe7\x00\x70\xf0\x16\x1e\x02\xc2\xc0\x98\x5c\x13\x09\x82\x61\x38"
-                               "\x8c\x27\x11\x84\x64\x30\x8e\x86\x10\xd0\xc2\x1c\x18\x43\x83\x08\x20\x67\xc4\x7f"
-                               "\x00\x4E\x00\x28\x11\x00\x0f\x10\x01\x00\xf8\x3e\xb8\x11\x70\x22\x70\x44\x70\x88"
-                               "\xe1\x10\xe2\x20\xe4\x41\xc8\x81\xd1\x01\xe2\x03\xc4\x03\x88\x03\x10\x06\x7c\x04"
-                               "\x00\x4F\x00\x28\x11\x00\x0f\x10\x01\x00\x07\xc0\x30\x60\xc0\x63\x80\xe6\x00\xcc"
-                               "\x01\xb8\x03\xf0\x07\xe0\x0f\xc0\x1d\x80\x33\x80\x67\x01\xc6\x03\x06\x0c\x03\xe0"
-                               "\x00\x50\x00\x22\x0d\x00\x0c\x10\x01\x00\xff\xc3\x0e\x30\x63\x07\x30\x73\x07\x30"
-                               "\x63\x0e\x3f\x83\x00\x30\x03\x00\x30\x03\x00\x30\x0f\xc0\x00\x51\x00\x32\x11\x00"
-                               "\x10\x14\x01\xfc\x07\xc0\x18\x30\x30\x18\x30\x1c\x70\x0c\x60\x0c\xe0\x0e\xe0\x0e"
-                               "\xe0\x0e\xe0\x0e\x60\x0e\x60\x0c\x70\x1c\x30\x18\x30\x18\x0c\x60\x0f\xc0\x0c\xe1"
-                               "\x10\x7e\x00\x3c\x00\x52\x00\x26\x0e\x00\x0e\x10\x01\x00\xff\x80\xc3\x03\x0e\x0c"
-                               "\x38\x30\xe0\xc3\x83\x0c\x0f\xc0\x30\xe0\xc1\x83\x07\x0c\x1c\x30\x70\xc1\xc3\x03"
-                               "\x3f\x0f\x00\x53\x00\x1e\x0c\x00\x0a\x10\x01\x00\x1f\x18\x64\x0b\x01\xc0\x3c\x07"
-                               "\xc0\xfc\x0f\x80\x70\x0e\x01\x80\x70\x1e\x09\xfc\x00\x54\x00\x26\x0f\x00\x0e\x10"
-                               "\x01\x00\xff\xff\x1c\x38\x70\xe1\xc1\x87\x04\x1c\x00\x70\x01\xc0\x07\x00\x1c\x00"
-                               "\x70\x01\xc0\x07\x00\x1c\x00\x70\x07\xf0\x00\x55\x00\x28\x11\x00\x0f\x10\x01\x00"
-                               "\xfc\x3e\x60\x08\xc0\x11\x80\x23\x00\x46\x00\x8c\x01\x18\x02\x30\x04\x60\x08\xc0"
-                               "\x11\x80\x23\x00\x46\x01\x0e\x02\x07\xf8\x00\x56\x00\x26\x0e\x00\x0e\x10\x00\x00"
-                               "\xfe\x3c\xe0\x23\x81\x06\x04\x1c\x20\x70\x80\xc2\x03\x90\x0e\x40\x19\x00\x68\x01"
-                               "\xe0\x03\x80\x0c\x00\x30\x00\x40\x00\x57\x00\x36\x16\x00\x16\x10\x00\x00\xfc\xfe"
-                               "\x3c\xc0\xe0\x43\x83\xc1\x0e\x17\x04\x18\x4c\x20\x61\x30\x81\xc4\xe2\x07\x21\x90"
-                               "\x0c\x86\x40\x3a\x1d\x00\xf0\x78\x01\xc0\xe0\x07\x03\x00\x18\x0c\x00\x20\x30\x00"
-                               "\x80\x40\x00\x58\x00\x26\x10\x00\x0e\x10\x01\x00\xfe\x78\xe0\x81\x84\x07\x10\x0c"
-                               "\x80\x3c\x00\x70\x01\xc0\x03\x80\x1e\x00\x9c\x02\x70\x10\xe0\x43\x82\x07\x3e\x7f"
-                               "\x00\x59\x00\x24\x0d\x00\x0d\x10\x00\x00\xfe\x79\xc1\x06\x08\x38\x80\xc4\x07\x40"
-                               "\x1a\x00\xe0\x03\x00\x18\x00\xc0\x06\x00\x30\x01\x80\x0c\x03\xf8\x00\x5A\x00\x24"
-                               "\x0f\x00\x0d\x10\x01\x00\x7f\xfb\x03\x90\x38\x81\xc4\x1c\x01\xc0\x0e\x00\xe0\x06"
-                               "\x00\x70\x07\x02\x38\x13\x80\x98\x05\xc0\x7f\xff\x00\x5B\x00\x15\x07\x00\x04\x15"
-                               "\x03\xfb\xfc\xcc\xcc\xcc\xcc\xcc\xcc\xcc\xcc\xcc\xf0\x00\x5C\x00\x1e\x09\x00\x0a"
-                               "\x10\x00\x00\xc0\x10\x06\x00\x80\x30\x04\x01\x80\x20\x0c\x01\x00\x60\x08\x03\x00"
-                               "\x40\x18\x03\x00\x5D\x00\x18\x07\x00\x05\x15\x00\xfb\xf8\xc6\x31\x8c\x63\x18\xc6"
-                               "\x31\x8c\x63\x18\xc6\x3f\x80\x00\x5E\x00\x14\x0d\x00\x0a\x08\x02\x07\x0c\x07\x01"
-                               "\x60\xc8\x23\x18\x4c\x1b\x03\x00\x5F\x00\x0c\x0b\x00\x0b\x01\x00\xfd\xff\xe0\x00"
-                               "\x60\x00\x0d\x06\x00\x05\x04\x00\x0c\x86\x18\x30\x00\x61\x00\x1a\x0c\x00\x0b\x0b"
-                               "\x01\x00\x3f\x0c\x31\x86\x00\xc0\xf8\x63\x18\x67\x0c\xe3\x9c\x71\xf7\x80\x00\x62"
-                               "\x00\x20\x0d\x00\x0b\x10\x01\x00\xe0\x0c\x01\x80\x30\x06\x00\xdf\x1c\x33\x86\x60"
-                               "\xec\x1d\x83\xb0\x76\x0e\xe1\x9c\x33\x7c\x00\x63\x00\x18\x0b\x00\x0a\x0b\x01\x00"
-                               "\x1f\x0c\x66\x0d\x83\xe0\x38\x0e\x01\x81\x60\x4c\x21\xf0\x00\x64\x00\x22\x0d\x00"
-                               "\x0c\x10\x01\x00\x07\xc0\x0c\x00\xc0\x0c\x00\xc3\xec\x61\xc6\x1c\xe0\xce\x0c\xe0"
-                               "\xce\x0c\xe0\xc6\x1c\x61\xc3\xef\x00\x65\x00\x18\x0c\x00\x0a\x0b\x01\x00\x1f\x08"
-                               "\x66\x1d\x87\xff\xf8\x0e\x03\x80\x60\x4c\x21\xf0\x00\x66\x00\x1c\x07\x00\x09\x10"
-                               "\x00\x00\x1f\x0c\xce\x67\x03\x87\xf0\xe0\x70\x38\x1c\x0e\x07\x03\x81\xc0\xe1\xf8"
-                               "\x00\x67\x00\x20\x0d\x00\x0b\x10\x01\xfb\x1e\xe6\x25\xc6\x38\xc3\x18\x66\x13\x84"
-                               "\x00\x80\x0f\xf8\xff\x30\x3c\x03\x80\x50\x11\xfc\x00\x68\x00\x24\x0e\x00\x0d\x10"
-                               "\x00\x00\xf8\x01\xc0\x0e\x00\x70\x03\x80\x1d\xf0\xf1\x87\x0e\x38\x71\xc3\x8e\x1c"
-                               "\x70\xe3\x87\x1c\x38\xe1\xdf\x9f\x00\x69\x00\x16\x07\x00\x06\x10\x00\x00\x38\xe1"
-                               "\x00\x03\xe3\x8e\x38\xe3\x8e\x38\xe3\xbf\x00\x6A\x00\x18\x07\x00\x05\x15\x00\xfb"
-                               "\x39\xc4\x00\x7c\xe7\x39\xce\x73\x9c\xe7\x39\x8c\x88\x00\x00\x6B\x00\x24\x0d\x00"
-                               "\x0d\x10\x00\x00\x78\x01\xc0\x0e\x00\x70\x03\x80\x1d\xf0\xe2\x07\x20\x39\x01\xd0"
-                               "\x0f\xc0\x77\x03\x9c\x1c\x60\xe3\x9f\xbf\x00\x6C\x00\x16\x07\x00\x06\x10\x00\x00"
-                               "\xf8\xe3\x8e\x38\xe3\x8e\x38\xe3\x8e\x38\xe3\xbf\x00\x6D\x00\x26\x15\x00\x14\x0b"
-                               "\x00\x00\xfb\xc7\x83\xc6\x8c\x38\x70\xc3\x87\x0e\x38\x70\xe3\x87\x0e\x38\x70\xe3"
-                               "\x87\x0e\x38\x70\xe3\x87\x0e\xfc\xf9\xf0\x00\x6E\x00\x1c\x0e\x00\x0d\x0b\x00\x00"
-                               "\xfb\xe1\xe3\x0e\x1c\x70\xe3\x87\x1c\x38\xe1\xc7\x0e\x38\x71\xc3\xbf\x3e\x00\x6F"
-                               "\x00\x18\x0d\x00\x0a\x0b\x01\x00\x1f\x08\x66\x0d\x83\xe0\xf8\x3e\x0d\x83\x60\xc8"
-                               "\x61\xf0\x00\x70\x00\x22\x0d\x00\x0c\x10\x00\xfb\xf7\xc3\x86\x38\x63\x07\x30\x73"
-                               "\x07\x30\x73\x07\x38\x63\x86\x37\xc3\x00\x30\x03\x00\x30\x0f\xc0\x00\x71\x00\x22"
-                               "\x0d\x00\x0c\x10\x01\xfb\x3e\xc6\x1c\x61\xce\x0c\xe0\xce\x0c\xe0\xce\x0c\x61\xc6"
-                               "\x2c\x3c\xc0\x0c\x00\xc0\x0c\x00\xc0\x3f\x00\x72\x00\x18\x0a\x00\x0a\x0b\x00\x00"
-                               "\xfb\x8f\x73\x9c\xe2\x38\x0e\x03\x80\xe0\x38\x0e\x0f\xc0\x00\x73\x00\x15\x0a\x00"
-                               "\x08\x0b\x01\x00\x3e\x42\x42\x60\x7c\x3e\x0f\x83\x83\xc3\x7c\x00\x74\x00\x17\x07"
-                               "\x00\x07\x0e\x00\x00\x10\x60\xc7\xf3\x06\x0c\x18\x30\x60\xc1\x83\x23\x80\x00\x75"
-                               "\x00\x1b\x0e\x00\x0c\x0b\x01\x00\xf3\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e"
-                               "\x70\xe3\x1e\x3e\xf0\x00\x76\x00\x1b\x0c\x00\x0c\x0b\x00\x00\xfd\xf3\x04\x38\x41"
-                               "\x88\x1c\x81\xc8\x0d\x00\xf0\x06\x00\x60\x04\x00\x00\x77\x00\x25\x12\x00\x13\x0b"
-                               "\x00\x00\xfd\xfb\xe6\x0e\x10\xe2\xc4\x0c\x58\x81\x93\x90\x3a\x34\x03\x46\x80\x70"
-                               "\xe0\x0e\x0c\x00\x81\x80\x10\x20\x00\x00\x78\x00\x1b\x0d\x00\x0c\x0b\x00\x00\x7e"
-                               "\xf1\x84\x1c\x80\xf0\x06\x00\x70\x07\x00\xb8\x11\x81\x0c\xfb\xf0\x00\x79\x00\x22"
-                               "\x0b\x00\x0c\x10\x00\xfb\xfd\xf3\x04\x38\x81\x88\x1c\x80\xd0\x0d\x00\xf0\x06\x00"
-                               "\x60\x02\x00\x20\x04\x06\x40\x68\x07\x00\x00\x7A\x00\x18\x0b\x00\x0a\x0b\x00\x00"
-                               "\x7f\xd0\x64\x39\x1c\x06\x03\x81\xc0\x61\x38\x5c\x1f\xfc\x00\x7B\x00\x1d\x07\x00"
-                               "\x07\x15\x00\xfb\x0e\x30\x60\xc1\x83\x06\x0c\x18\x63\x81\x81\x03\x06\x0c\x18\x30"
-                               "\x60\xc0\xe0\x00\x7C\x00\x0d\x05\x00\x01\x16\x02\xfb\xff\xff\xfc\x00\x7D\x00\x1d"
-                               "\x07\x00\x07\x15\x00\xfb\xe0\x60\x60\xc1\x83\x06\x0c\x18\x30\x18\xc1\x83\x06\x0c"
-                               "\x18\x30\x61\x8e\x00\x00\x7E\x00\x0e\x0d\x00\x0a\x03\x02\x04\x70\xe3\x28\x70\x00"
-                               "\xA1\x00\x10\x07\x00\x03\x10\x02\xfb\xdf\x04\x92\xdb\x6f\xfe\x00\xA2\x00\x1e\x0c"
-                               "\x00\x0a\x10\x01\xfe\x04\x01\x00\x40\x3c\x34\xd9\x36\x4d\x90\xe4\x19\x06\x45\x91"
-                               "\x34\xc7\xc0\x40\x10\x00\xA3\x00\x22\x0c\x00\x0c\x10\x00\x00\x03\xc0\x46\x08\x60"
-                               "\x80\x1c\x01\xc0\x1c\x07\xfc\x0c\x00\xc0\x0c\x00\xc1\x08\x10\x83\xff\xee\x7c\x00"
-                               "\xA4\x00\x1a\x0c\x00\x0b\x0b\x01\x02\x9f\x7e\x79\x03\x60\x28\x05\x00\xe0\x1e\x02"
-                               "\xc0\xdc\x3a\xfd\x80\x00\xA5\x00\x24\x0c\x00\x0d\x10\x00\x00\xfc\xf9\x81\x06\x10"
-                               "\x30\x80\xc8\x06\x40\x1c\x07\xfc\x06\x00\x30\x0f\xf8\x0c\x00\x60\x03\x00\x18\x03"
-                               "\xf8\x00\xA6\x00\x0c\x05\x00\x01\x10\x02\xfe\xf8\x1f\x00\xA7\x00\x25\x0c\x00\x0a"
-                               "\x15\x01\xfb\x1f\x0c\x66\x19\x86\x60\x1c\x05\x81\x70\x46\x18\xc3\x18\x63\x0e\xc1"
-                               "\xd0\x34\x05\x40\xf8\x36\x09\x84\x3e\x00\x00\xA8\x00\x0c\x06\x00\x06\x02\x00\x0d"
-                               "\xcf\x30\x00\xA9\x00\x2a\x12\x00\x10\x10\x01\x00\x07\xe0\x1c\x30\x30\x0c\x63\xc4"
-                               "\x44\x22\xcc\x13\x88\x03\x98\x03\x98\x03\x98\x03\xcc\x13\xc4\x22\x63\xc6\x30\x0c"
-                               "\x18\x38\x07\xe0\x00\xAA\x00\x10\x08\x00\x06\x07\x01\x09\x73\x21\xba\x8a\x6e\xc0"
-                               "\x00\xAB\x00\x12\x09\x00\x08\x08\x01\x01\x11\x26\x6c\xdc\xcc\x66\x32\x11\x00\xAC"
-                               "\x00\x13\x0d\x00\x0b\x06\x01\x02\xff\xe0\x04\x00\x80\x10\x02\x00\x40\x00\xAD\x00"
-                               "\x0b\x08\x00\x04\x01\x02\x04\xf0\x00\xAE\x00\x13\x0b\x00\x08\x09\x01\x07\x3c\x43"
-                               "\x99\x95\x99\x95\x9b\x43\x3c\x00\xAF\x00\x0b\x06\x00\x06\x01\x00\x0e\xfc\x00\xB0"
-                               "\x00\x10\x09\x00\x07\x06\x01\x09\x38\x8a\x1c\x34\x47\x00\x00\xB1\x00\x1a\x0d\x00"
-                               "\x0b\x0b\x01\x00\x04\x00\x80\x10\x02\x0f\xfe\x08\x01\x00\x20\x04\x00\x03\xff\x80"
-                               "\x00\xB2\x00\x14\x09\x00\x08\x0a\x00\x08\x3c\x46\x63\x63\x06\x04\x08\x11\x3e\xfe"
-                               "\x00\xB3\x00\x13\x09\x00\x07\x0a\x01\x08\x79\x98\x30\x67\x81\x81\xe3\x86\xf0\x00"
-                               "\xB4\x00\x0d\x06\x00\x05\x04\x01\x0c\x08\xcd\x80\x00\xB5\x00\x22\x0e\x00\x0c\x10"
-                               "\x01\xfb\xf3\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7\x1e\x7e\xf6\x00"
-                               "\x60\x06\x00\x60\x06\x00\x00\xB6\x00\x28\x0d\x00\x0c\x14\x01\xfc\x3f\xf7\xcc\xfc"
-                               "\xcf\xcc\xfc\xcf\xcc\xfc\xc7\xcc\x3c\xc0\x4c\x04\xc0\x4c\x04\xc0\x4c\x04\xc0\x48"
-                               "\x05\x86\x50\x6a\x03\xc0\x00\xB7\x00\x0b\x06\x00\x02\x03\x02\x05\xfc\x00\xB8\x00"
-                               "\x0e\x06\x00\x05\x05\x01\xfb\x23\x86\x3f\x00\x00\xB9\x00\x12\x08\x00\x06\x0a\x01"
-                               "\x08\x10\x47\x2c\x30\xc3\x0c\x31\xf0\x00\xBA\x00\x10\x08\x00\x06\x07\x01\x08\x33"
-                               "\x3c\x61\xc7\x33\x00\x00\xBB\x00\x12\x09\x00\x08\x08\x01\x01\x90\xc8\x66\x37\x76"
-                               "\x6c\xc8\x90\x00\xBC\x00\x2a\x12\x00\x10\x10\x01\x00\x10\x08\x30\x10\x70\x10\xb0"
-                               "\x20\x30\x40\x30\x40\x30\x84\x30\x84\x31\x0c\x7a\x14\x02\x24\x04\x45\x04\x7f\x08"
-                               "\x05\x10\x04\x30\x04\x00\xBD\x00\x2a\x12\x00\x10\x10\x01\xff\x30\x08\x70\x10\xb0"
-                               "\x20\x30\x20\x30\x40\x30\x40\x30\x9e\x31\x23\x79\x33\x02\x13\x02\x02\x04\x04\x08"
-                               "\x08\x08\x11\x10\x3e\x20\x00\x00\xBE\x00\x2c\x12\x00\x11\x10\x01\x00\x30\x04\x66"
-                               "\x04\x13\x04\x01\x02\x07\x02\x00\x62\x00\x19\x09\x8d\x0c\x8c\x8e\x38\x87\x00\x85"
-                               "\x80\x44\xd0\x43\xf8\x20\x34\x20\x18\x20\x0c\x00\xBF\x00\x18\x0a\x00\x07\x10\x01"
-                               "\xfb\x0c\x38\x30\x00\x81\x02\x08\x61\x83\x06\x0c\x78\xf1\xbe\x00\xC0\x00\x32\x0f"
-                               "\x00\x0f\x15\x00\x00\x08\x00\x18\x00\x18\x00\x18\x00\x08\x00\x20\x00\x40\x01\x80"
-                               "\x03\x80\x07\x00\x16\x00\x2e\x00\x5c\x01\x18\x02\x38\x07\xf0\x10\x60\x20\xe0\x81"
-                               "\xc1\x01\x8f\x8f\xe0\x00\xC1\x00\x32\x0f\x00\x0f\x15\x00\x00\x00\x40\x01\xc0\x03"
-                               "\x00\x08\x00\x20\x00\x20\x00\x40\x01\x80\x03\x80\x07\x00\x16\x00\x2e\x00\x5c\x01"
-                               "\x18\x02\x38\x07\xf0\x10\x60\x20\xe0\x81\xc1\x01\x8f\x8f\xe0\x00\xC2\x00\x32\x0f"
-                               "\x00\x0f\x15\x00\x00\x01\x00\x07\x00\x1a\x00\x22\x00\x82\x00\x20\x00\x40\x01\x80"
-                               "\x03\x80\x07\x00\x16\x00\x2e\x00\x5c\x01\x18\x02\x38\x07\xf0\x10\x60\x20\xe0\x81"
-                               "\xc1\x01\x8f\x8f\xe0\x00\xC3\x00\x2e\x0f\x00\x0f\x13\x00\x00\x0f\x20\x17\x80\x00"
-                               "\x00\x08\x00\x10\x00\x60\x00\xe0\x01\xc0\x05\x80\x0b\x80\x17\x00\x46\x00\x8e\x01"
-                               "\xfc\x04\x18\x08\x38\x20\x70\x40\x63\xe3\xf8\x00\xC4\x00\x2e\x0f\x00\x0f\x13\x00"
-                               "\x00\x0c\x60\x19\xc0\x00\x00\x08\x00\x10\x00\x60\x00\xe0\x01\xc0\x05\x80\x0b\x80"
-                               "\x17\x00\x46\x00\x8e\x01\xfc\x04\x18\x08\x38\x20\x70\x40\x63\xe3\xf8\x00\xC5\x00"
-                               "\x32\x0f\x00\x0f\x15\x00\x00\x03\x80\x09\x00\x11\x00\x24\x00\x38\x00\x20\x00\x40"
-                               "\x01\x80\x03\x80\x07\x00\x16\x00\x2e\x00\x5c\x01\x18\x02\x38\x07\xf0\x10\x60\x20"
-                               "\xe0\x81\xc1\x01\x8f\x8f\xe0\x00\xC6\x00\x34\x16\x00\x15\x10\x00\x00\x01\xff\xf0"
-                               "\x07\x81\x80\x3c\x04\x02\xe0\x20\x17\x09\x01\x38\x40\x09\xc4\x00\x8f\xe0\x04\x71"
-                               "\x00\x43\x88\x03\xfc\x20\x20\xe1\x11\x07\x00\x90\x38\x0c\x81\xc0\xfe\x3f\xff\x00"
-                               "\xC7\x00\x2d\x10\x00\x0d\x15\x01\xfb\x07\xe0\xc0\xcc\x02\xe0\x17\x00\xb0\x03\x80"
-                               "\x1c\x00\xe0\x07\x00\x18\x02\xe0\x17\x00\x98\x0c\x60\xe0\xfc\x02\x00\x1c\x00\x30"
-                               "\x01\x00\x78\x00\x00\xC8\x00\x2d\x0f\x00\x0d\x15\x01\x00\x08\x00\xe0\x03\x80\x04"
-                               "\x00\x10\x7f\xf8\xc0\x46\x02\x30\x09\x84\x4c\x20\x61\x03\xf8\x18\x40\xc2\x06\x11"
-                               "\x30\x89\x80\x4c\x02\x60\x3f\xff\x80\x00\xC9\x00\x2d\x0f\x00\x0d\x15\x01\x00\x00"
-                               "\x40\x06\x00\x60\x06\x00\x40\x7f\xf8\xc0\x46\x02\x30\x09\x84\x4c\x20\x61\x03\xf8"
-                               "\x18\x40\xc2\x06\x11\x30\x89\x80\x4c\x02\x60\x3f\xff\x80\x00\xCA\x00\x2d\x0f\x00"
-                               "\x0d\x15\x01\x00\x03\x00\x38\x01\x60\x11\x81\x04\x7f\xf8\xc0\x46\x02\x30\x09\x84"
-                               "\x4c\x20\x61\x03\xf8\x18\x40\xc2\x06\x11\x30\x89\x80\x4c\x02\x60\x3f\xff\x80\x00"
-                               "\xCB\x00\x29\x0f\x00\x0d\x13\x01\x00\x1c\xc0\x66\x00\x01\xff\xe3\x01\x18\x08\xc0"
-                               "\x26\x11\x30\x81\x84\x0f\xe0\x61\x03\x08\x18\x44\xc2\x26\x01\x30\x09\x80\xff\xfe"
-                               "\x00\xCC\x00\x1a\x08\x00\x06\x15\x01\x00\x83\x06\x0c\x0b\xf3\x0c\x30\xc3\x0c\x30"
-                               "\xc3\x0c\x30\xc3\x0c\xfc\x00\xCD\x00\x1a\x08\x00\x06\x15\x01\x00\x04\x31\xcc\x43"
-                               "\xf3\x0c\x30\xc3\x0c\x30\xc3\x0c\x30\xc3\x0c\xfc\x00\xCE\x00\x1d\x08\x00\x07\x15"
-                               "\x01\x00\x30\x71\xa6\x28\x3f\x8c\x18\x30\x60\xc1\x83\x06\x0c\x18\x30\x60\xc1\x8f"
-                               "\xc0\x00\xCF\x00\x19\x08\x00\x06\x13\x01\x00\xcf\x30\x3f\x30\xc3\x0c\x30\xc3\x0c"
-                               "\x30\xc3\x0c\x30\xcf\xc0\x00\xD0\x00\x28\x12\x00\x0f\x10\x01\x00\xff\xe0\x60\x30"
-                               "\xc0\x71\x80\x63\x00\xe6\x01\xcc\x03\xff\x87\x30\x0e\x60\x1c\xc0\x39\x80\x73\x00"
-                               "\xc6\x03\x8c\x0e\x7f\xf0\x00\xD1\x00\x2e\x11\x00\x0f\x13\x01\x00\x0f\x20\x17\x80"
-                               "\x00\x07\xc1\xf5\xc0\x8b\x81\x13\x82\x23\x84\x47\x08\x87\x11\x07\x22\x0e\x44\x0e"
-                               "\x88\x0f\x10\x1e\x20\x1c\x40\x18\x80\x33\xe0\x20\x00\xD2\x00\x32\x11\x00\x0f\x15"
-                               "\x01\x00\x04\x00\x1c\x00\x0c\x00\x0c\x00\x00\x00\xf8\x06\x0c\x18\x0c\x70\x1c\xc0"
-                               "\x19\x80\x37\x00\x7e\x00\xfc\x01\xf8\x03\xb0\x06\x70\x0c\xe0\x38\xc0\x60\xc1\x80"
-                               "\x7c\x00\x00\xD3\x00\x32\x11\x00\x0f\x15\x01\x00\x00\x20\x00\xc0\x07\x00\x18\x00"
-                               "\x00\x00\xf8\x06\x0c\x18\x0c\x70\x1c\xc0\x19\x80\x37\x00\x7e\x00\xfc\x01\xf8\x03"
-                               "\xb0\x06\x70\x0c\xe0\x38\xc0\x60\xc1\x80\x7c\x00\x00\xD4\x00\x32\x11\x00\x0f\x15"
-                               "\x01\x00\x01\x00\x07\x00\x1b\x00\x61\x00\x00\x00\xf8\x06\x0c\x18\x0c\x70\x1c\xc0"
-                               "\x19\x80\x37\x00\x7e\x00\xfc\x01\xf8\x03\xb0\x06\x70\x0c\xe0\x38\xc0\x60\xc1\x80"
-                               "\x7c\x00\x00\xD5\x00\x30\x11\x00\x0f\x14\x01\x00\x07\x20\x17\xc0\x00\x00\x00\x00"
-                               "\x7c\x03\x06\x0c\x06\x38\x0e\x60\x0c\xc0\x1b\x80\x3f\x00\x7e\x00\xfc\x01\xd8\x03"
-                               "\x38\x06\x70\x1c\x60\x30\x60\xc0\x3e\x00\x00\xD6\x00\x2e\x11\x00\x0f\x13\x01\x00"
-                               "\x0e\x60\x18\xc0\x00\x00\x3e\x01\x83\x06\x03\x1c\x07\x30\x06\x60\x0d\xc0\x1f\x80"
-                               "\x3f\x00\x7e\x00\xec\x01\x9c\x03\x38\x0e\x30\x18\x30\x60\x1f\x00\x00\xD7\x00\x18"
-                               "\x0d\x00\x0a\x0b\x02\x00\x80\xb0\x36\x18\xcc\x1e\x03\x01\xe0\xcc\x61\xb0\x38\x08"
-                               "\x00\xD8\x00\x28\x11\x00\x0f\x10\x01\x00\x07\xc2\x30\x68\xc0\x63\x80\xe6\x02\xcc"
-                               "\x09\xb8\x23\xf0\x47\xe1\x0f\xc4\x1d\x90\x33\x40\x67\x01\xc6\x03\x16\x0c\x43\xe0"
-                               "\x00\xD9\x00\x32\x11\x00\x0f\x15\x01\x00\x04\x00\x18\x00\x18\x00\x08\x00\x08\x1f"
-                               "\x87\xcc\x01\x18\x02\x30\x04\x60\x08\xc0\x11\x80\x23\x00\x46\x00\x8c\x01\x18\x02"
-                               "\x30\x04\x60\x08\xc0\x21\xc0\x40\xff\x00\x00\xDA\x00\x32\x11\x00\x0f\x15\x01\x00"
-                               "\x00\x20\x00\xc0\x03\x00\x08\x00\x20\x1f\x87\xcc\x01\x18\x02\x30\x04\x60\x08\xc0"
-                               "\x11\x80\x23\x00\x46\x00\x8c\x01\x18\x02\x30\x04\x60\x08\xc0\x21\xc0\x40\xff\x00"
-                               "\x00\xDB\x00\x32\x11\x00\x0f\x15\x01\x00\x01\x00\x07\x00\x1b\x00\x22\x00\x82\x1f"
-                               "\x87\xcc\x01\x18\x02\x30\x04\x60\x08\xc0\x11\x80\x23\x00\x46\x00\x8c\x01\x18\x02"
-                               "\x30\x04\x60\x08\xc0\x21\xc0\x40\xff\x00\x00\xDC\x00\x2e\x11\x00\x0f\x13\x01\x00"
-                               "\x0e\x60\x18\xc0\x00\x07\xe1\xf3\x00\x46\x00\x8c\x01\x18\x02\x30\x04\x60\x08\xc0"
-                               "\x11\x80\x23\x00\x46\x00\x8c\x01\x18\x02\x30\x08\x70\x10\x3f\xc0\x00\xDD\x00\x2d"
-                               "\x0d\x00\x0d\x15\x00\x00\x00\x80\x06\x00\x60\x04\x00\x40\x7f\x3c\xe0\x83\x04\x1c"
-                               "\x40\x62\x03\xa0\x0d\x00\x70\x01\x80\x0c\x00\x60\x03\x00\x18\x00\xc0\x06\x01\xfc"
-                               "\x00\x00\xDE\x00\x22\x0d\x00\x0c\x10\x01\x00\xfc\x03\x00\x30\x03\xf8\x30\xe3\x06"
-                               "\x30\x73\x07\x30\x73\x06\x30\xe3\xf8\x30\x03\x00\x30\x0f\xc0\x00\xDF\x00\x20\x0d"
-                               "\x00\x0b\x10\x01\x00\x1f\x86\x19\xc3\x38\x67\x0c\xe7\x1c\x33\x86\x70\xee\x1d\xc3"
-                               "\xb8\x77\x4e\xe9\xdd\x37\xdc\x00\xE0\x00\x20\x0c\x00\x0b\x10\x01\x00\x30\x07\x00"
-                               "\x30\x03\x00\x00\x7e\x18\x63\x0c\x01\x81\xf0\xc6\x30\xce\x19\xc7\x38\xe3\xef\x00"
-                               "\xE1\x00\x20\x0c\x00\x0b\x10\x01\x00\x01\x00\x60\x10\x0c\x00\x00\x7e\x18\x63\x0c"
-                               "\x01\x81\xf0\xc6\x30\xce\x19\xc7\x38\xe3\xef\x00\xE2\x00\x20\x0c\x00\x0b\x10\x01"
-                               "\x00\x0c\x03\xc0\x4c\x10\xc0\x00\x7e\x18\x63\x0c\x01\x81\xf0\xc6\x30\xce\x19\xc7"
-                               "\x38\xe3\xef\x00\xE3\x00\x20\x0c\x00\x0b\x10\x01\x00\x38\x87\x91\x1c\x00\x00\x00"
-                               "\x7e\x18\x63\x0c\x01\x81\xf0\xc6\x30\xce\x19\xc7\x38\xe3\xef\x00\xE4\x00\x1f\x0c"
-                               "\x00\x0b\x0f\x01\x00\x33\x86\x60\x00\x00\x03\xf0\xc3\x18\x60\x0c\x0f\x86\x31\x86"
-                               "\x70\xce\x39\xc7\x1f\x78\x00\xE5\x00\x20\x0c\x00\x0b\x10\x01\x00\x0e\x02\x40\x48"
-                               "\x06\x00\x00\x7e\x18\x63\x0c\x01\x81\xf0\xc6\x30\xce\x19\xc7\x38\xe3\xef\x00\xE6"
-                               "\x00\x20\x12\x00\x10\x0b\x01\x00\x3e\x7c\x63\x86\x63\x87\x03\x87\x0f\xff\x73\x80"
-                               "\xe3\x80\xc3\x80\xc3\x81\xe5\xc2\x78\x7c\x00\xE7\x00\x1e\x0b\x00\x0a\x10\x01\xfb"
-                               "\x1f\x0c\x66\x0d\x83\xe0\x38\x0e\x01\x81\x60\x4c\x21\xf0\x20\x0e\x01\x80\x20\x78"
-                               "\x00\xE8\x00\x1e\x0c\x00\x0a\x10\x01\x00\x30\x0e\x00\xc0\x18\x00\x07\xc2\x19\x87"
-                               "\x61\xff\xfe\x03\x80\xe0\x18\x13\x08\x7c\x00\xE9\x00\x1e\x0c\x00\x0a\x10\x01\x00"
-                               "\x01\x00\xc0\x40\x60\x00\x07\xc2\x19\x87\x61\xff\xfe\x03\x80\xe0\x18\x13\x08\x7c"
-                               "\x00\xEA\x00\x1e\x0c\x00\x0a\x10\x01\x00\x0c\x07\x81\x30\x86\x00\x07\xc2\x19\x87"
-                               "\x61\xff\xfe\x03\x80\xe0\x18\x13\x08\x7c\x00\xEB\x00\x1d\x0c\x00\x0a\x0f\x01\x00"
-                               "\x33\x8c\xc0\x00\x00\x1f\x08\x66\x1d\x87\xff\xf8\x0e\x03\x80\x60\x4c\x21\xf0\x00"
-                               "\xEC\x00\x16\x07\x00\x06\x10\x00\x00\xc1\x83\x02\x03\xe3\x8e\x38\xe3\x8e\x38\xe3"
-                               "\xbf\x00\xED\x00\x18\x07\x00\x07\x10\x00\x00\x06\x18\x61\x00\x1f\x0e\x1c\x38\x70"
-                               "\xe1\xc3\x87\x0e\x7e\x00\xEE\x00\x18\x07\x00\x07\x10\x00\x00\x38\x51\x14\x10\x1f"
-                               "\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7e\x00\xEF\x00\x18\x07\x00\x07\x0f\x00\x00\xc7"
-                               "\x9c\x00\x0f\x87\x0e\x1c\x38\x70\xe1\xc3\x87\x3f\x00\x00\xF0\x00\x20\x0d\x00\x0a"
-                               "\x11\x01\x00\x61\x0f\x81\xc1\x98\x03\x00\x61\xfc\x87\x60\xd8\x3e\x0f\x83\xe0\xd8"
-                               "\x36\x0c\x86\x1f\x00\x00\xF1\x00\x24\x0e\x00\x0d\x10\x00\x00\x0e\x20\x7a\x04\x70"
-                               "\x00\x00\x00\x7d\xf0\xf1\x87\x0e\x38\x71\xc3\x8e\x1c\x70\xe3\x87\x1c\x38\xe1\xdf"
-                               "\x9f\x00\xF2\x00\x1e\x0d\x00\x0a\x10\x01\x00\x30\x0e\x00\xc0\x08\x00\x07\xc2\x19"
-                               "\x83\x60\xf8\x3e\x0f\x83\x60\xd8\x32\x18\x7c\x00\xF3\x00\x1e\x0d\x00\x0a\x10\x01"
-                               "\x00\x01\x80\xc0\x60\x20\x00\x07\xc2\x19\x83\x60\xf8\x3e\x0f\x83\x60\xd8\x32\x18"
-                               "\x7c\x00\xF4\x00\x1e\x0d\x00\x0a\x10\x01\x00\x0c\x07\x81\x10\x82\x00\x07\xc2\x19"
-                               "\x83\x60\xf8\x3e\x0f\x83\x60\xd8\x32\x18\x7c\x00\xF5\x00\x1e\x0d\x00\x0a\x10\x01"
-                               "\x00\x18\x8b\x22\x70\x00\x00\x07\xc2\x19\x83\x60\xf8\x3e\x0f\x83\x60\xd8\x32\x18"
-                               "\x7c\x00\xF6\x00\x1d\x0d\x00\x0a\x0f\x01\x00\x33\x8c\x40\x00\x00\x1f\x08\x66\x0d"
-                               "\x83\xe0\xf8\x3e\x0d\x83\x60\xc8\x61\xf0\x00\xF7\x00\x1a\x0d\x00\x0b\x0b\x01\x00"
-                               "\x0e\x01\xc0\x38\x00\x00\x01\xff\xc0\x00\x00\x0e\x01\xc0\x38\x00\x00\xF8\x00\x18"
-                               "\x0d\x00\x0a\x0b\x01\x00\x1f\x48\x76\x0d\x87\xe2\xf9\x3e\x8f\xc3\x60\xd8\x69\xf0"
-                               "\x00\xF9\x00\x22\x0e\x00\x0c\x10\x01\x00\x10\x01\x80\x06\x00\x10\x00\x0f\x3e\x70"
-                               "\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x31\xe3\xef\x00\xFA\x00\x22\x0e\x00"
-                               "\x0c\x10\x01\x00\x01\x80\x38\x06\x00\x80\x00\x0f\x3e\x70\xe7\x0e\x70\xe7\x0e\x70"
-                               "\xe7\x0e\x70\xe7\x0e\x31\xe3\xef\x00\xFB\x00\x22\x0e\x00\x0c\x10\x01\x00\x06\x00"
-                               "\xf0\x19\x82\x08\x00\x0f\x3e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x31"
-                               "\xe3\xef\x00\xFC\x00\x21\x0e\x00\x0c\x0f\x01\x00\x19\x81\x98\x00\x00\x00\xf3\xe7"
-                               "\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe3\x1e\x3e\xf0\x00\xFD\x00\x2a\x0b"
-                               "\x00\x0c\x15\x00\xfb\x01\x80\x38\x06\x00\x80\x00\x0f\xdf\x30\x43\x88\x18\x81\xc8"
-                               "\x0d\x00\xd0\x0f\x00\x60\x06\x00\x20\x02\x00\x40\x64\x06\x80\x70\x00\x00\xFE\x00"
-                               "\x2a\x0d\x00\x0c\x15\x00\xfb\xf0\x03\x00\x30\x03\x00\x30\x03\x7c\x38\x63\x86\x30"
-                               "\x73\x07\x30\x73\x07\x30\x73\x86\x38\x63\x7c\x30\x03\x00\x30\x03\x00\xfc\x00\x00"
-                               "\xFF\x00\x28\x0b\x00\x0c\x14\x00\xfb\x11\x83\x98\x00\x00\x00\xfd\xf3\x04\x38\x81"
-                               "\x88\x1c\x80\xd0\x0d\x00\xf0\x06\x00\x60\x02\x00\x20\x04\x06\x40\x68\x07\x00\x01"
-                               "\x31\x00\x13\x07\x00\x06\x0b\x00\x00\xf8\xe3\x8e\x38\xe3\x8e\x38\xef\xc0\x01\x41"
-                               "\x00\x24\x0f\x00\x0d\x10\x01\x00\xfc\x01\x80\x0c\x00\x60\x83\x08\x19\x80\xd8\x07"
-                               "\x00\x30\x03\x80\x2c\x02\x60\x13\x00\x98\x04\xc0\x7f\xff\x01\x42\x00\x16\x07\x00"
-                               "\x06\x10\x00\x00\xf8\xe3\x8e\x3c\xf3\x8e\x7a\xe3\x8e\x38\xe3\xbf\x01\x52\x00\x36"
-                               "\x18\x00\x16\x10\x01\x00\x07\xff\xf8\x60\xe0\x23\x01\x80\x9c\x06\x02\x60\x18\x45"
-                               "\x80\x61\x0e\x01\x84\x38\x07\xf0\xe0\x18\x43\x80\x61\x06\x01\x84\x58\x06\x11\x70"
-                               "\x18\x04\xc0\x60\x11\x83\x80\xc1\xff\xff\x01\x53\x00\x23\x14\x00\x12\x0b\x01\x00"
-                               "\x1f\x1e\x08\x78\xc6\x0c\x19\x83\x06\xe0\xff\xf8\x30\x0e\x0c\x01\x83\x01\x60\xe0"
-                               "\x88\x78\x21\xf3\xf0\x01\x60\x00\x25\x0c\x00\x0a\x15\x01\x00\x20\x8c\x41\xe0\x30"
-                               "\x00\x07\xc6\x19\x02\xc0\x70\x0f\x01\xf0\x3f\x03\xe0\x1c\x03\x80\x60\x1c\x07\x82"
-                               "\x7f\x00\x01\x61\x00\x1a\x0a\x00\x08\x10\x01\x00\x43\x24\x3c\x18\x00\x3e\x42\x42"
-                               "\x60\x7c\x3e\x0f\x83\x83\xc3\x7c\x01\x78\x00\x29\x0d\x00\x0d\x13\x00\x00\x18\xc0"
-                               "\xe6\x00\x01\xfc\xf3\x82\x0c\x10\x71\x01\x88\x0e\x80\x34\x01\xc0\x06\x00\x30\x01"
-                               "\x80\x0c\x00\x60\x03\x00\x18\x07\xf0\x01\x7D\x00\x2d\x0f\x00\x0d\x15\x01\x00\x10"
-                               "\x40\x46\x01\x60\x0e\x00\x30\x3f\xfd\x81\xc8\x1c\x40\xe2\x0e\x00\xe0\x07\x00\x70"
-                               "\x03\x00\x38\x03\x81\x1c\x09\xc0\x4c\x02\xe0\x3f\xff\x80\x01\x7E\x00\x1e\x0b\x00"
-                               "\x0a\x10\x00\x00\x20\x86\xc0\xe0\x10\x00\x1f\xf4\x19\x0e\x47\x01\x80\xe0\x70\x18"
-                               "\x4e\x17\x07\xff\x01\x92\x00\x28\x0c\x00\x0c\x14\x00\xfc\x00\xe0\x1b\x01\x30\x30"
-                               "\x03\x00\x70\x06\x01\xf8\x06\x00\x60\x06\x00\x60\x0c\x00\xc0\x0c\x00\xc0\x08\x0d"
-                               "\x80\x90\x0e\x00\x02\xC6\x00\x0e\x06\x00\x07\x04\x00\x0c\x30\x71\x24\x30\x02\xC7"
-                               "\x00\x0e\x06\x00\x07\x04\x00\x0c\x83\x99\xe1\x80\x02\xD8\x00\x0d\x06\x00\x06\x03"
-                               "\x00\x0d\x87\x17\x80\x02\xD9\x00\x0b\x06\x00\x02\x02\x02\x0d\xf0\x02\xDA\x00\x0d"
-                               "\x06\x00\x04\x05\x01\x0c\x69\x99\x60\x02\xDB\x00\x0d\x06\x00\x04\x05\x01\xfb\x3c"
-                               "\x88\xf0\x02\xDC\x00\x0c\x06\x00\x08\x02\xff\x0d\x71\x9e\x02\xDD\x00\x0f\x06\x00"
-                               "\x0a\x04\xff\x0c\x08\xc6\x63\x33\x10\x20\x13\x00\x0c\x0b\x00\x0b\x01\x00\x05\xff"
-                               "\xe0\x20\x14\x00\x0c\x16\x00\x10\x01\x03\x05\xff\xff\x20\x18\x00\x0e\x06\x00\x04"
-                               "\x07\x01\x09\x34\x48\xef\x60\x20\x19\x00\x0e\x06\x00\x04\x07\x01\x09\x6e\xf1\x24"
-                               "\x80\x20\x1A\x00\x0e\x06\x00\x04\x07\x01\xfc\x6e\x71\x24\x80\x20\x1C\x00\x11\x0a"
-                               "\x00\x08\x07\x01\x09\x31\x42\x44\x84\xe7\xf7\x67\x20\x1D\x00\x11\x0a\x00\x08\x07"
-                               "\x01\x09\xe6\xe7\xf7\x21\x21\x42\x84\x20\x1E\x00\x11\x0a\x00\x08\x07\x01\xfc\xe6"
-                               "\xe7\xf7\x21\x21\x42\x84\x20\x20\x00\x22\x0a\x00\x0a\x13\x00\xfd\x0c\x03\x00\xc0"
-                               "\x30\x0c\x19\x7f\xfc\x10\x04\x01\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\x40"
-                               "\x20\x21\x00\x22\x0a\x00\x0a\x13\x00\xfd\x0c\x03\x00\xc0\x30\x0c\x19\x7f\xfc\x10"
-                               "\x0c\x03\x00\xc1\x97\xff\xc1\x00\xc0\x30\x0c\x03\x00\x40\x20\x22\x00\x11\x0b\x00"
-                               "\x07\x08\x02\x04\x39\xff\xff\xff\xff\xff\x9c\x20\x26\x00\x11\x16\x00\x12\x03\x02"
-                               "\x00\x60\xc1\xb8\x78\x76\x0c\x18\x20\x30\x00\x32\x16\x00\x14\x10\x01\x00\x78\x30"
-                               "\x08\xc2\x00\x84\x40\x08\x44\x00\x84\x80\x0c\x90\x00\x71\x00\x00\x20\x00\x04\xe0"
-                               "\xe0\x51\x13\x09\x1a\x10\x90\xa1\x11\x0a\x12\x11\xa1\x21\x11\x34\x0e\x1e\x20\x39"
-                               "\x00\x0e\x06\x00\x04\x08\x01\x01\x12\x6c\xc6\x11\x20\x3A\x00\x0e\x06\x00\x04\x08"
-                               "\x01\x01\x84\x63\x36\xc8\x20\x44\x00\x20\x04\x00\x0b\x10\xfc\x00\x00\x20\x08\x01"
-                               "\x00\x40\x10\x02\x00\x80\x10\x04\x01\x00\x20\x08\x01\x00\x40\x10\x06\x00\x21\x22"
-                               "\x00\x21\x16\x00\x14\x09\x01\x07\xfe\xe0\x39\x27\x06\x91\x30\x61\x03\x8e\x10\x38"
-                               "\xe1\x02\x96\x10\x2d\x61\x02\x66\x38\x64\xf0\x22\x12\x00\x0c\x0d\x00\x0b\x01\x01"
-                               "\x05\xff\xe0\xFB\x00\x00\x2a\x0f\x00\x10\x10\x00\x00\x0f\x1e\x19\xb3\x39\xb1\x38"
-                               "\x70\x38\x70\xfe\xfc\x38\x70\x38\x70\x38\x70\x38\x70\x38\x70\x38\x70\x38\x70\x38"
-                               "\x70\x38\x70\xfc\xfc\xFB\x01\x00\x24\x0e\x00\x0d\x10\x00\x00\x07\xc0\xc3\x06\x18"
-                               "\x70\x03\x80\x7e\xf8\xe1\xc7\x0e\x38\x71\xc3\x8e\x1c\x70\xe3\x87\x1c\x38\xe1\xdf"
-                               "\xbf\xFB\x02\x00\x24\x0e\x00\x0d\x10\x00\x00\x07\xf0\xe3\x86\x1c\x70\xe3\x87\x7e"
-                               "\x38\xe1\xc7\x0e\x38\x71\xc3\x8e\x1c\x70\xe3\x87\x1c\x38\xe1\xdf\xbf\xFB\x03\x00"
-                               "\x34\x15\x00\x15\x10\x00\x00\x0f\x0f\x80\xcd\x86\x0e\x6c\x00\x70\x60\x03\x83\x00"
-                               "\x7f\x7e\xf0\xe1\xc1\x87\x0e\x0c\x38\x70\x61\xc3\x83\x0e\x1c\x18\x70\xe0\xc3\x87"
-                               "\x06\x1c\x38\x30\xe1\xc1\x9f\x9f\xbf\xFB\x04\x00\x34\x15\x00\x15\x10\x00\x00\x0f"
-                               "\x0f\xe0\xcc\x83\x0e\x6c\x18\x70\x60\xc3\x83\x06\x7f\x7e\x30\xe1\xc1\x87\x0e\x0c"
-                               "\x38\x70\x61\xc3\x83\x0e\x1c\x18\x70\xe0\xc3\x87\x06\x1c\x38\x30\xe1\xc1\x9f\x9f"
-                               "\xbf";
+static constexpr Character bailleul_16_pt_characters[233] = {
+    {0x0000, 0, 9, 16, 8, 16, 0, 0},
+    {0x0020, 16, 6, 0, 0, 0, 0, 0},
+    {0x0021, 16, 7, 0, 3, 16, 2, 0},
+    {0x0022, 22, 10, 0, 6, 7, 2, 9},
+    {0x0023, 28, 12, 0, 11, 16, 1, 0},
+    {0x0024, 50, 12, 0, 10, 20, 1, -2},
+    {0x0025, 75, 22, 0, 18, 16, 2, 0},
+    {0x0026, 111, 17, 0, 15, 16, 1, 0},
+    {0x0027, 141, 6, 0, 2, 7, 2, 9},
+    {0x0028, 143, 9, 0, 7, 22, 2, -6},
+    {0x0029, 163, 9, 0, 7, 22, 0, -6},
+    {0x002A, 183, 9, 0, 7, 7, 1, 9},
+    {0x002B, 190, 13, 0, 11, 11, 1, 0},
+    {0x002C, 206, 6, 0, 3, 7, 2, -4},
+    {0x002D, 209, 9, 0, 6, 1, 1, 5},
+    {0x002E, 210, 6, 0, 3, 3, 2, 0},
+    {0x002F, 212, 9, 0, 10, 16, 0, 0},
+    {0x0030, 232, 12, 0, 10, 16, 1, 0},
+    {0x0031, 252, 12, 0, 8, 16, 2, 0},
+    {0x0032, 268, 12, 0, 11, 16, 0, 0},
+    {0x0033, 290, 12, 0, 10, 16, 1, 0},
+    {0x0034, 310, 12, 0, 11, 16, 0, 0},
+    {0x0035, 332, 12, 0, 10, 17, 1, 0},
+    {0x0036, 354, 12, 0, 10, 16, 1, 0},
+    {0x0037, 374, 12, 0, 11, 16, 1, 0},
+    {0x0038, 396, 12, 0, 10, 16, 1, 0},
+    {0x0039, 416, 12, 0, 10, 16, 1, 0},
+    {0x003A, 436, 6, 0, 3, 10, 2, 0},
+    {0x003B, 440, 6, 0, 3, 14, 2, -4},
+    {0x003C, 446, 13, 0, 11, 11, 1, 0},
+    {0x003D, 462, 13, 0, 11, 5, 1, 3},
+    {0x003E, 469, 13, 0, 11, 11, 1, 0},
+    {0x003F, 485, 10, 0, 7, 16, 2, 0},
+    {0x0040, 499, 18, 0, 16, 16, 1, 0},
+    {0x0041, 531, 15, 0, 15, 16, 0, 0},
+    {0x0042, 561, 15, 0, 13, 16, 1, 0},
+    {0x0043, 587, 16, 0, 13, 16, 1, 0},
+    {0x0044, 613, 18, 0, 15, 16, 1, 0},
+    {0x0045, 643, 15, 0, 13, 16, 1, 0},
+    {0x0046, 669, 13, 0, 12, 16, 1, 0},
+    {0x0047, 693, 17, 0, 16, 16, 1, 0},
+    {0x0048, 725, 17, 0, 16, 16, 1, 0},
+    {0x0049, 757, 8, 0, 6, 16, 1, 0},
+    {0x004A, 769, 10, 0, 9, 16, 1, 0},
+    {0x004B, 787, 15, 0, 15, 16, 1, 0},
+    {0x004C, 817, 15, 0, 13, 16, 1, 0},
+    {0x004D, 843, 21, 0, 19, 16, 1, 0},
+    {0x004E, 881, 17, 0, 15, 16, 1, 0},
+    {0x004F, 911, 17, 0, 15, 16, 1, 0},
+    {0x0050, 941, 13, 0, 12, 16, 1, 0},
+    {0x0051, 965, 17, 0, 16, 20, 1, -4},
+    {0x0052, 1005, 14, 0, 14, 16, 1, 0},
+    {0x0053, 1033, 12, 0, 10, 16, 1, 0},
+    {0x0054, 1053, 15, 0, 14, 16, 1, 0},
+    {0x0055, 1081, 17, 0, 15, 16, 1, 0},
+    {0x0056, 1111, 14, 0, 14, 16, 0, 0},
+    {0x0057, 1139, 22, 0, 22, 16, 0, 0},
+    {0x0058, 1183, 16, 0, 14, 16, 1, 0},
+    {0x0059, 1211, 13, 0, 13, 16, 0, 0},
+    {0x005A, 1237, 15, 0, 13, 16, 1, 0},
+    {0x005B, 1263, 7, 0, 4, 21, 3, -5},
+    {0x005C, 1274, 9, 0, 10, 16, 0, 0},
+    {0x005D, 1294, 7, 0, 5, 21, 0, -5},
+    {0x005E, 1308, 13, 0, 10, 8, 2, 7},
+    {0x005F, 1318, 11, 0, 11, 1, 0, -3},
+    {0x0060, 1320, 6, 0, 5, 4, 0, 12},
+    {0x0061, 1323, 12, 0, 11, 11, 1, 0},
+    {0x0062, 1339, 13, 0, 11, 16, 1, 0},
+    {0x0063, 1361, 11, 0, 10, 11, 1, 0},
+    {0x0064, 1375, 13, 0, 12, 16, 1, 0},
+    {0x0065, 1399, 12, 0, 10, 11, 1, 0},
+    {0x0066, 1413, 7, 0, 9, 16, 0, 0},
+    {0x0067, 1431, 13, 0, 11, 16, 1, -5},
+    {0x0068, 1453, 14, 0, 13, 16, 0, 0},
+    {0x0069, 1479, 7, 0, 6, 16, 0, 0},
+    {0x006A, 1491, 7, 0, 5, 21, 0, -5},
+    {0x006B, 1505, 13, 0, 13, 16, 0, 0},
+    {0x006C, 1531, 7, 0, 6, 16, 0, 0},
+    {0x006D, 1543, 21, 0, 20, 11, 0, 0},
+    {0x006E, 1571, 14, 0, 13, 11, 0, 0},
+    {0x006F, 1589, 13, 0, 10, 11, 1, 0},
+    {0x0070, 1603, 13, 0, 12, 16, 0, -5},
+    {0x0071, 1627, 13, 0, 12, 16, 1, -5},
+    {0x0072, 1651, 10, 0, 10, 11, 0, 0},
+    {0x0073, 1665, 10, 0, 8, 11, 1, 0},
+    {0x0074, 1676, 7, 0, 7, 14, 0, 0},
+    {0x0075, 1689, 14, 0, 12, 11, 1, 0},
+    {0x0076, 1706, 12, 0, 12, 11, 0, 0},
+    {0x0077, 1723, 18, 0, 19, 11, 0, 0},
+    {0x0078, 1750, 13, 0, 12, 11, 0, 0},
+    {0x0079, 1767, 11, 0, 12, 16, 0, -5},
+    {0x007A, 1791, 11, 0, 10, 11, 0, 0},
+    {0x007B, 1805, 7, 0, 7, 21, 0, -5},
+    {0x007C, 1824, 5, 0, 1, 22, 2, -5},
+    {0x007D, 1827, 7, 0, 7, 21, 0, -5},
+    {0x007E, 1846, 13, 0, 10, 3, 2, 4},
+    {0x00A1, 1850, 7, 0, 3, 16, 2, -5},
+    {0x00A2, 1856, 12, 0, 10, 16, 1, -2},
+    {0x00A3, 1876, 12, 0, 12, 16, 0, 0},
+    {0x00A4, 1900, 12, 0, 11, 11, 1, 2},
+    {0x00A5, 1916, 12, 0, 13, 16, 0, 0},
+    {0x00A6, 1942, 5, 0, 1, 16, 2, -2},
+    {0x00A7, 1944, 12, 0, 10, 21, 1, -5},
+    {0x00A8, 1971, 6, 0, 6, 2, 0, 13},
+    {0x00A9, 1973, 18, 0, 16, 16, 1, 0},
+    {0x00AA, 2005, 8, 0, 6, 7, 1, 9},
+    {0x00AB, 2011, 9, 0, 8, 8, 1, 1},
+    {0x00AC, 2019, 13, 0, 11, 6, 1, 2},
+    {0x00AD, 2028, 8, 0, 4, 1, 2, 4},
+    {0x00AE, 2029, 11, 0, 8, 9, 1, 7},
+    {0x00AF, 2038, 6, 0, 6, 1, 0, 14},
+    {0x00B0, 2039, 9, 0, 7, 6, 1, 9},
+    {0x00B1, 2045, 13, 0, 11, 11, 1, 0},
+    {0x00B2, 2061, 9, 0, 8, 10, 0, 8},
+    {0x00B3, 2071, 9, 0, 7, 10, 1, 8},
+    {0x00B4, 2080, 6, 0, 5, 4, 1, 12},
+    {0x00B5, 2083, 14, 0, 12, 16, 1, -5},
+    {0x00B6, 2107, 13, 0, 12, 20, 1, -4},
+    {0x00B7, 2137, 6, 0, 2, 3, 2, 5},
+    {0x00B8, 2138, 6, 0, 5, 5, 1, -5},
+    {0x00B9, 2142, 8, 0, 6, 10, 1, 8},
+    {0x00BA, 2150, 8, 0, 6, 7, 1, 8},
+    {0x00BB, 2156, 9, 0, 8, 8, 1, 1},
+    {0x00BC, 2164, 18, 0, 16, 16, 1, 0},
+    {0x00BD, 2196, 18, 0, 16, 16, 1, -1},
+    {0x00BE, 2228, 18, 0, 17, 16, 1, 0},
+    {0x00BF, 2262, 10, 0, 7, 16, 1, -5},
+    {0x00C0, 2276, 15, 0, 15, 21, 0, 0},
+    {0x00C1, 2316, 15, 0, 15, 21, 0, 0},
+    {0x00C2, 2356, 15, 0, 15, 21, 0, 0},
+    {0x00C3, 2396, 15, 0, 15, 19, 0, 0},
+    {0x00C4, 2432, 15, 0, 15, 19, 0, 0},
+    {0x00C5, 2468, 15, 0, 15, 21, 0, 0},
+    {0x00C6, 2508, 22, 0, 21, 16, 0, 0},
+    {0x00C7, 2550, 16, 0, 13, 21, 1, -5},
+    {0x00C8, 2585, 15, 0, 13, 21, 1, 0},
+    {0x00C9, 2620, 15, 0, 13, 21, 1, 0},
+    {0x00CA, 2655, 15, 0, 13, 21, 1, 0},
+    {0x00CB, 2690, 15, 0, 13, 19, 1, 0},
+    {0x00CC, 2721, 8, 0, 6, 21, 1, 0},
+    {0x00CD, 2737, 8, 0, 6, 21, 1, 0},
+    {0x00CE, 2753, 8, 0, 7, 21, 1, 0},
+    {0x00CF, 2772, 8, 0, 6, 19, 1, 0},
+    {0x00D0, 2787, 18, 0, 15, 16, 1, 0},
+    {0x00D1, 2817, 17, 0, 15, 19, 1, 0},
+    {0x00D2, 2853, 17, 0, 15, 21, 1, 0},
+    {0x00D3, 2893, 17, 0, 15, 21, 1, 0},
+    {0x00D4, 2933, 17, 0, 15, 21, 1, 0},
+    {0x00D5, 2973, 17, 0, 15, 20, 1, 0},
+    {0x00D6, 3011, 17, 0, 15, 19, 1, 0},
+    {0x00D7, 3047, 13, 0, 10, 11, 2, 0},
+    {0x00D8, 3061, 17, 0, 15, 16, 1, 0},
+    {0x00D9, 3091, 17, 0, 15, 21, 1, 0},
+    {0x00DA, 3131, 17, 0, 15, 21, 1, 0},
+    {0x00DB, 3171, 17, 0, 15, 21, 1, 0},
+    {0x00DC, 3211, 17, 0, 15, 19, 1, 0},
+    {0x00DD, 3247, 13, 0, 13, 21, 0, 0},
+    {0x00DE, 3282, 13, 0, 12, 16, 1, 0},
+    {0x00DF, 3306, 13, 0, 11, 16, 1, 0},
+    {0x00E0, 3328, 12, 0, 11, 16, 1, 0},
+    {0x00E1, 3350, 12, 0, 11, 16, 1, 0},
+    {0x00E2, 3372, 12, 0, 11, 16, 1, 0},
+    {0x00E3, 3394, 12, 0, 11, 16, 1, 0},
+    {0x00E4, 3416, 12, 0, 11, 15, 1, 0},
+    {0x00E5, 3437, 12, 0, 11, 16, 1, 0},
+    {0x00E6, 3459, 18, 0, 16, 11, 1, 0},
+    {0x00E7, 3481, 11, 0, 10, 16, 1, -5},
+    {0x00E8, 3501, 12, 0, 10, 16, 1, 0},
+    {0x00E9, 3521, 12, 0, 10, 16, 1, 0},
+    {0x00EA, 3541, 12, 0, 10, 16, 1, 0},
+    {0x00EB, 3561, 12, 0, 10, 15, 1, 0},
+    {0x00EC, 3580, 7, 0, 6, 16, 0, 0},
+    {0x00ED, 3592, 7, 0, 7, 16, 0, 0},
+    {0x00EE, 3606, 7, 0, 7, 16, 0, 0},
+    {0x00EF, 3620, 7, 0, 7, 15, 0, 0},
+    {0x00F0, 3634, 13, 0, 10, 17, 1, 0},
+    {0x00F1, 3656, 14, 0, 13, 16, 0, 0},
+    {0x00F2, 3682, 13, 0, 10, 16, 1, 0},
+    {0x00F3, 3702, 13, 0, 10, 16, 1, 0},
+    {0x00F4, 3722, 13, 0, 10, 16, 1, 0},
+    {0x00F5, 3742, 13, 0, 10, 16, 1, 0},
+    {0x00F6, 3762, 13, 0, 10, 15, 1, 0},
+    {0x00F7, 3781, 13, 0, 11, 11, 1, 0},
+    {0x00F8, 3797, 13, 0, 10, 11, 1, 0},
+    {0x00F9, 3811, 14, 0, 12, 16, 1, 0},
+    {0x00FA, 3835, 14, 0, 12, 16, 1, 0},
+    {0x00FB, 3859, 14, 0, 12, 16, 1, 0},
+    {0x00FC, 3883, 14, 0, 12, 15, 1, 0},
+    {0x00FD, 3906, 11, 0, 12, 21, 0, -5},
+    {0x00FE, 3938, 13, 0, 12, 21, 0, -5},
+    {0x00FF, 3970, 11, 0, 12, 20, 0, -5},
+    {0x0131, 4000, 7, 0, 6, 11, 0, 0},
+    {0x0141, 4009, 15, 0, 13, 16, 1, 0},
+    {0x0142, 4035, 7, 0, 6, 16, 0, 0},
+    {0x0152, 4047, 24, 0, 22, 16, 1, 0},
+    {0x0153, 4091, 20, 0, 18, 11, 1, 0},
+    {0x0160, 4116, 12, 0, 10, 21, 1, 0},
+    {0x0161, 4143, 10, 0, 8, 16, 1, 0},
+    {0x0178, 4159, 13, 0, 13, 19, 0, 0},
+    {0x017D, 4190, 15, 0, 13, 21, 1, 0},
+    {0x017E, 4225, 11, 0, 10, 16, 0, 0},
+    {0x0192, 4245, 12, 0, 12, 20, 0, -4},
+    {0x02C6, 4275, 6, 0, 7, 4, 0, 12},
+    {0x02C7, 4279, 6, 0, 7, 4, 0, 12},
+    {0x02D8, 4283, 6, 0, 6, 3, 0, 13},
+    {0x02D9, 4286, 6, 0, 2, 2, 2, 13},
+    {0x02DA, 4287, 6, 0, 4, 5, 1, 12},
+    {0x02DB, 4290, 6, 0, 4, 5, 1, -5},
+    {0x02DC, 4293, 6, 0, 8, 2, -1, 13},
+    {0x02DD, 4295, 6, 0, 10, 4, -1, 12},
+    {0x2013, 4300, 11, 0, 11, 1, 0, 5},
+    {0x2014, 4302, 22, 0, 16, 1, 3, 5},
+    {0x2018, 4304, 6, 0, 4, 7, 1, 9},
+    {0x2019, 4308, 6, 0, 4, 7, 1, 9},
+    {0x201A, 4312, 6, 0, 4, 7, 1, -4},
+    {0x201C, 4316, 10, 0, 8, 7, 1, 9},
+    {0x201D, 4323, 10, 0, 8, 7, 1, 9},
+    {0x201E, 4330, 10, 0, 8, 7, 1, -4},
+    {0x2020, 4337, 10, 0, 10, 19, 0, -3},
+    {0x2021, 4361, 10, 0, 10, 19, 0, -3},
+    {0x2022, 4385, 11, 0, 7, 8, 2, 4},
+    {0x2026, 4392, 22, 0, 18, 3, 2, 0},
+    {0x2030, 4399, 22, 0, 20, 16, 1, 0},
+    {0x2039, 4439, 6, 0, 4, 8, 1, 1},
+    {0x203A, 4443, 6, 0, 4, 8, 1, 1},
+    {0x2044, 4447, 4, 0, 11, 16, -4, 0},
+    {0x2122, 4469, 22, 0, 20, 9, 1, 7},
+    {0x2212, 4492, 13, 0, 11, 1, 1, 5},
+    {0xFB00, 4494, 15, 0, 16, 16, 0, 0},
+    {0xFB01, 4526, 14, 0, 13, 16, 0, 0},
+    {0xFB02, 4552, 14, 0, 13, 16, 0, 0},
+    {0xFB03, 4578, 21, 0, 21, 16, 0, 0},
+    {0xFB04, 4620, 21, 0, 21, 16, 0, 0},
+};
+
+static constexpr uint8_t bailleul_16_pt_bitmaps[4663] = "\xff\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81"
+                                                        "\x81\x81\x81\xff\xdf\xfd\xb6\x49\x21\xbe\x4f\x34"
+                                                        "\xd3\x49\x24\x80\x19\x83\x30\x46\x08\x81\x11\xff"
+                                                        "\xcc\x41\x88\x33\x04\x63\xff\x11\x02\x20\x44\x18"
+                                                        "\x83\x30\x04\x01\x01\xf0\x96\x45\xd1\x26\x41\xd0"
+                                                        "\x7c\x0f\xc0\xf8\x1f\x04\xd1\x3e\x47\x13\x65\x8f"
+                                                        "\x80\x40\x10\x3c\x04\x10\x82\x0c\x20\x83\x0c\x40"
+                                                        "\xc2\x10\x10\x88\x04\x64\x00\xe1\x00\x00\x87\x00"
+                                                        "\x26\x20\x11\x08\x08\x43\x02\x30\xc1\x04\x20\x81"
+                                                        "\x08\x20\x3c\x0f\x00\x22\x00\x44\x00\xc8\x01\xa0"
+                                                        "\x03\x9f\x87\x0c\x17\x10\x46\x21\x8e\x47\x0e\x8e"
+                                                        "\x0e\x1e\x1c\x3c\x1c\x5c\x5f\x1f\x1c\xff\xe8\x06"
+                                                        "\x10\x41\x82\x0c\x18\x60\xc1\x83\x06\x0c\x18\x30"
+                                                        "\x30\x60\x40\xc0\xc0\x40\x40\xc0\x40\x40\xc0\x81"
+                                                        "\x83\x03\x06\x0c\x18\x30\x60\xc1\x86\x0c\x10\x41"
+                                                        "\x84\x10\x00\x30\x63\x5f\xf3\x0d\x93\x00\x04\x00"
+                                                        "\x80\x10\x02\x00\x41\xff\xc1\x00\x20\x04\x00\x80"
+                                                        "\x10\x00\xdf\x92\xa0\xfc\xdf\x00\x00\xc0\x60\x10"
+                                                        "\x0c\x02\x01\x80\x40\x30\x08\x06\x01\x00\xc0\x20"
+                                                        "\x18\x04\x03\x00\x1e\x08\x46\x19\x83\xe0\xf0\x3c"
+                                                        "\x0f\x03\xc0\xf0\x3c\x0f\x83\x60\xd8\x62\x10\x78"
+                                                        "\x0c\x0c\x1c\x3c\x5c\x9c\x1c\x1c\x1c\x1c\x1c\x1c"
+                                                        "\x1c\x1c\x1c\x7f\x1f\x84\x39\x03\x28\x77\x8e\x61"
+                                                        "\xc0\x30\x06\x01\x80\x60\x18\x06\x01\x02\x40\xdf"
+                                                        "\xf7\xfe\x3e\x10\xce\x39\x8e\x03\x80\xc0\x60\xf0"
+                                                        "\x03\x00\xe0\x1c\x07\xc1\xf0\xe8\x31\xf8\x01\x00"
+                                                        "\x20\x0c\x03\x80\xb0\x16\x04\xc1\x18\x23\x28\x67"
+                                                        "\xff\x81\x90\x32\x06\x00\xc0\x18\x00\x8f\xe3\xf0"
+                                                        "\x80\x40\x10\x05\xe1\x8e\x41\xa0\x70\x1c\x07\x01"
+                                                        "\xe0\x78\x19\x0c\x3e\x00\x0f\x0c\x62\x1d\x83\x60"
+                                                        "\x3b\xcf\x1b\x87\xe1\xf8\x3e\x0f\x83\x60\xd8\x63"
+                                                        "\x18\x7c\x3f\xe7\xf9\x01\x20\x48\x18\x02\x00\xc0"
+                                                        "\x10\x06\x00\xc0\x30\x06\x00\xc0\x38\x07\x00\xe0"
+                                                        "\x1f\x08\x66\x0d\x03\x60\xdc\x27\xd0\x7c\x67\xd0"
+                                                        "\x7c\x0f\x03\xc0\xf0\x36\x08\xfc\x1e\x18\x66\x1b"
+                                                        "\x87\xe0\xf8\x3e\x0f\x87\x61\xdc\xb3\xcc\x07\x41"
+                                                        "\xb8\x66\x30\xf8\xdf\x00\x06\xf8\xdf\x00\x06\xfc"
+                                                        "\x95\x00\x00\x60\x30\x18\x0c\x06\x01\x80\x1c\x00"
+                                                        "\xe0\x07\x00\x3c\x01\x80\xff\xe0\x00\x00\x00\x0f"
+                                                        "\xfe\xc0\x06\x00\x30\x01\xc0\x06\x00\xc0\x78\x38"
+                                                        "\x1c\x1e\x03\x00\x00\x79\x8b\x1e\x30\x60\xc1\x86"
+                                                        "\x30\x40\x81\x00\x0c\x1c\x30\x07\xe0\x18\x18\x30"
+                                                        "\x04\x60\x02\x41\xd9\xc3\x31\xc6\x31\xc4\x31\xc4"
+                                                        "\x21\xcc\x62\xc6\xa4\xc7\x38\x60\x00\x30\x00\x18"
+                                                        "\x18\x07\xe0\x01\x00\x02\x00\x0c\x00\x1c\x00\x38"
+                                                        "\x00\xb0\x01\x70\x02\xe0\x08\xc0\x11\xc0\x3f\x80"
+                                                        "\x83\x01\x07\x04\x0e\x08\x0c\x7c\x7f\xff\xc1\x87"
+                                                        "\x0c\x18\x60\xc3\x06\x18\x30\xc3\x07\xf0\x30\x61"
+                                                        "\x81\x8c\x0c\x60\x73\x03\x18\x18\xc1\xdf\xf8\x07"
+                                                        "\xe0\xc0\xcc\x02\xe0\x17\x00\xb0\x03\x80\x1c\x00"
+                                                        "\xe0\x07\x00\x18\x02\xe0\x17\x00\x98\x0c\x60\xe0"
+                                                        "\xfc\xff\xe0\x60\x30\xc0\x71\x80\x63\x00\xe6\x01"
+                                                        "\xcc\x03\x98\x07\x30\x0e\x60\x1c\xc0\x39\x80\x73"
+                                                        "\x00\xc6\x03\x8c\x0e\x7f\xf0\xff\xf1\x80\x8c\x04"
+                                                        "\x60\x13\x08\x98\x40\xc2\x07\xf0\x30\x81\x84\x0c"
+                                                        "\x22\x61\x13\x00\x98\x04\xc0\x7f\xff\xff\xf3\x01"
+                                                        "\x30\x13\x01\x30\x93\x08\x30\x83\xf8\x30\x83\x08"
+                                                        "\x30\x83\x08\x30\x03\x00\x30\x0f\xc0\x07\xe0\x18"
+                                                        "\x38\x30\x18\x70\x08\x70\x08\x60\x08\xe0\x00\xe0"
+                                                        "\x00\xe0\x7f\xe0\x1c\x60\x1c\x70\x1c\x70\x1c\x30"
+                                                        "\x1c\x18\x1c\x07\xe0\xfc\x7f\x30\x18\x30\x18\x30"
+                                                        "\x18\x30\x18\x30\x18\x30\x18\x3f\xf8\x30\x18\x30"
+                                                        "\x18\x30\x18\x30\x18\x30\x18\x30\x18\x30\x18\xfc"
+                                                        "\x7f\xfc\xc3\x0c\x30\xc3\x0c\x30\xc3\x0c\x30\xc3"
+                                                        "\x3f\x3f\x87\x03\x81\xc0\xe0\x70\x38\x1c\x0e\x07"
+                                                        "\x03\x81\xcc\xe6\x72\x30\xf0\xfc\xf0\x60\x80\xc2"
+                                                        "\x01\x84\x03\x10\x06\x20\x0c\xc0\x1f\xc0\x33\x80"
+                                                        "\x63\x80\xc7\x01\x87\x03\x0e\x06\x0e\x0c\x1c\x7e"
+                                                        "\x7f\xfc\x01\x80\x0c\x00\x60\x03\x00\x18\x00\xc0"
+                                                        "\x06\x00\x30\x01\x80\x0c\x02\x60\x13\x00\x98\x04"
+                                                        "\xc0\x7f\xff\xf8\x03\xe7\x00\x70\xf0\x16\x1e\x02"
+                                                        "\xc2\xc0\x98\x5c\x13\x09\x82\x61\x38\x8c\x27\x11"
+                                                        "\x84\x64\x30\x8e\x86\x10\xd0\xc2\x1c\x18\x43\x83"
+                                                        "\x08\x20\x67\xc4\x7f\xf8\x3e\xb8\x11\x70\x22\x70"
+                                                        "\x44\x70\x88\xe1\x10\xe2\x20\xe4\x41\xc8\x81\xd1"
+                                                        "\x01\xe2\x03\xc4\x03\x88\x03\x10\x06\x7c\x04\x07"
+                                                        "\xc0\x30\x60\xc0\x63\x80\xe6\x00\xcc\x01\xb8\x03"
+                                                        "\xf0\x07\xe0\x0f\xc0\x1d\x80\x33\x80\x67\x01\xc6"
+                                                        "\x03\x06\x0c\x03\xe0\xff\xc3\x0e\x30\x63\x07\x30"
+                                                        "\x73\x07\x30\x63\x0e\x3f\x83\x00\x30\x03\x00\x30"
+                                                        "\x03\x00\x30\x0f\xc0\x07\xc0\x18\x30\x30\x18\x30"
+                                                        "\x1c\x70\x0c\x60\x0c\xe0\x0e\xe0\x0e\xe0\x0e\xe0"
+                                                        "\x0e\x60\x0e\x60\x0c\x70\x1c\x30\x18\x30\x18\x0c"
+                                                        "\x60\x0f\xc0\x0c\xe1\x10\x7e\x00\x3c\xff\x80\xc3"
+                                                        "\x03\x0e\x0c\x38\x30\xe0\xc3\x83\x0c\x0f\xc0\x30"
+                                                        "\xe0\xc1\x83\x07\x0c\x1c\x30\x70\xc1\xc3\x03\x3f"
+                                                        "\x0f\x1f\x18\x64\x0b\x01\xc0\x3c\x07\xc0\xfc\x0f"
+                                                        "\x80\x70\x0e\x01\x80\x70\x1e\x09\xfc\xff\xff\x1c"
+                                                        "\x38\x70\xe1\xc1\x87\x04\x1c\x00\x70\x01\xc0\x07"
+                                                        "\x00\x1c\x00\x70\x01\xc0\x07\x00\x1c\x00\x70\x07"
+                                                        "\xf0\xfc\x3e\x60\x08\xc0\x11\x80\x23\x00\x46\x00"
+                                                        "\x8c\x01\x18\x02\x30\x04\x60\x08\xc0\x11\x80\x23"
+                                                        "\x00\x46\x01\x0e\x02\x07\xf8\xfe\x3c\xe0\x23\x81"
+                                                        "\x06\x04\x1c\x20\x70\x80\xc2\x03\x90\x0e\x40\x19"
+                                                        "\x00\x68\x01\xe0\x03\x80\x0c\x00\x30\x00\x40\xfc"
+                                                        "\xfe\x3c\xc0\xe0\x43\x83\xc1\x0e\x17\x04\x18\x4c"
+                                                        "\x20\x61\x30\x81\xc4\xe2\x07\x21\x90\x0c\x86\x40"
+                                                        "\x3a\x1d\x00\xf0\x78\x01\xc0\xe0\x07\x03\x00\x18"
+                                                        "\x0c\x00\x20\x30\x00\x80\x40\xfe\x78\xe0\x81\x84"
+                                                        "\x07\x10\x0c\x80\x3c\x00\x70\x01\xc0\x03\x80\x1e"
+                                                        "\x00\x9c\x02\x70\x10\xe0\x43\x82\x07\x3e\x7f\xfe"
+                                                        "\x79\xc1\x06\x08\x38\x80\xc4\x07\x40\x1a\x00\xe0"
+                                                        "\x03\x00\x18\x00\xc0\x06\x00\x30\x01\x80\x0c\x03"
+                                                        "\xf8\x7f\xfb\x03\x90\x38\x81\xc4\x1c\x01\xc0\x0e"
+                                                        "\x00\xe0\x06\x00\x70\x07\x02\x38\x13\x80\x98\x05"
+                                                        "\xc0\x7f\xff\xfc\xcc\xcc\xcc\xcc\xcc\xcc\xcc\xcc"
+                                                        "\xcc\xf0\xc0\x10\x06\x00\x80\x30\x04\x01\x80\x20"
+                                                        "\x0c\x01\x00\x60\x08\x03\x00\x40\x18\x03\xf8\xc6"
+                                                        "\x31\x8c\x63\x18\xc6\x31\x8c\x63\x18\xc6\x3f\x80"
+                                                        "\x0c\x07\x01\x60\xc8\x23\x18\x4c\x1b\x03\xff\xe0"
+                                                        "\x86\x18\x30\x3f\x0c\x31\x86\x00\xc0\xf8\x63\x18"
+                                                        "\x67\x0c\xe3\x9c\x71\xf7\x80\xe0\x0c\x01\x80\x30"
+                                                        "\x06\x00\xdf\x1c\x33\x86\x60\xec\x1d\x83\xb0\x76"
+                                                        "\x0e\xe1\x9c\x33\x7c\x1f\x0c\x66\x0d\x83\xe0\x38"
+                                                        "\x0e\x01\x81\x60\x4c\x21\xf0\x07\xc0\x0c\x00\xc0"
+                                                        "\x0c\x00\xc3\xec\x61\xc6\x1c\xe0\xce\x0c\xe0\xce"
+                                                        "\x0c\xe0\xc6\x1c\x61\xc3\xef\x1f\x08\x66\x1d\x87"
+                                                        "\xff\xf8\x0e\x03\x80\x60\x4c\x21\xf0\x1f\x0c\xce"
+                                                        "\x67\x03\x87\xf0\xe0\x70\x38\x1c\x0e\x07\x03\x81"
+                                                        "\xc0\xe1\xf8\x1e\xe6\x25\xc6\x38\xc3\x18\x66\x13"
+                                                        "\x84\x00\x80\x0f\xf8\xff\x30\x3c\x03\x80\x50\x11"
+                                                        "\xfc\xf8\x01\xc0\x0e\x00\x70\x03\x80\x1d\xf0\xf1"
+                                                        "\x87\x0e\x38\x71\xc3\x8e\x1c\x70\xe3\x87\x1c\x38"
+                                                        "\xe1\xdf\x9f\x38\xe1\x00\x03\xe3\x8e\x38\xe3\x8e"
+                                                        "\x38\xe3\xbf\x39\xc4\x00\x7c\xe7\x39\xce\x73\x9c"
+                                                        "\xe7\x39\x8c\x88\x00\x78\x01\xc0\x0e\x00\x70\x03"
+                                                        "\x80\x1d\xf0\xe2\x07\x20\x39\x01\xd0\x0f\xc0\x77"
+                                                        "\x03\x9c\x1c\x60\xe3\x9f\xbf\xf8\xe3\x8e\x38\xe3"
+                                                        "\x8e\x38\xe3\x8e\x38\xe3\xbf\xfb\xc7\x83\xc6\x8c"
+                                                        "\x38\x70\xc3\x87\x0e\x38\x70\xe3\x87\x0e\x38\x70"
+                                                        "\xe3\x87\x0e\x38\x70\xe3\x87\x0e\xfc\xf9\xf0\xfb"
+                                                        "\xe1\xe3\x0e\x1c\x70\xe3\x87\x1c\x38\xe1\xc7\x0e"
+                                                        "\x38\x71\xc3\xbf\x3e\x1f\x08\x66\x0d\x83\xe0\xf8"
+                                                        "\x3e\x0d\x83\x60\xc8\x61\xf0\xf7\xc3\x86\x38\x63"
+                                                        "\x07\x30\x73\x07\x30\x73\x07\x38\x63\x86\x37\xc3"
+                                                        "\x00\x30\x03\x00\x30\x0f\xc0\x3e\xc6\x1c\x61\xce"
+                                                        "\x0c\xe0\xce\x0c\xe0\xce\x0c\x61\xc6\x2c\x3c\xc0"
+                                                        "\x0c\x00\xc0\x0c\x00\xc0\x3f\xfb\x8f\x73\x9c\xe2"
+                                                        "\x38\x0e\x03\x80\xe0\x38\x0e\x0f\xc0\x3e\x42\x42"
+                                                        "\x60\x7c\x3e\x0f\x83\x83\xc3\x7c\x10\x60\xc7\xf3"
+                                                        "\x06\x0c\x18\x30\x60\xc1\x83\x23\x80\xf3\xe7\x0e"
+                                                        "\x70\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe3\x1e"
+                                                        "\x3e\xf0\xfd\xf3\x04\x38\x41\x88\x1c\x81\xc8\x0d"
+                                                        "\x00\xf0\x06\x00\x60\x04\x00\xfd\xfb\xe6\x0e\x10"
+                                                        "\xe2\xc4\x0c\x58\x81\x93\x90\x3a\x34\x03\x46\x80"
+                                                        "\x70\xe0\x0e\x0c\x00\x81\x80\x10\x20\x00\x7e\xf1"
+                                                        "\x84\x1c\x80\xf0\x06\x00\x70\x07\x00\xb8\x11\x81"
+                                                        "\x0c\xfb\xf0\xfd\xf3\x04\x38\x81\x88\x1c\x80\xd0"
+                                                        "\x0d\x00\xf0\x06\x00\x60\x02\x00\x20\x04\x06\x40"
+                                                        "\x68\x07\x00\x7f\xd0\x64\x39\x1c\x06\x03\x81\xc0"
+                                                        "\x61\x38\x5c\x1f\xfc\x0e\x30\x60\xc1\x83\x06\x0c"
+                                                        "\x18\x63\x81\x81\x03\x06\x0c\x18\x30\x60\xc0\xe0"
+                                                        "\xff\xff\xfc\xe0\x60\x60\xc1\x83\x06\x0c\x18\x30"
+                                                        "\x18\xc1\x83\x06\x0c\x18\x30\x61\x8e\x00\x70\xe3"
+                                                        "\x28\x70\xdf\x04\x92\xdb\x6f\xfe\x04\x01\x00\x40"
+                                                        "\x3c\x34\xd9\x36\x4d\x90\xe4\x19\x06\x45\x91\x34"
+                                                        "\xc7\xc0\x40\x10\x03\xc0\x46\x08\x60\x80\x1c\x01"
+                                                        "\xc0\x1c\x07\xfc\x0c\x00\xc0\x0c\x00\xc1\x08\x10"
+                                                        "\x83\xff\xee\x7c\x9f\x7e\x79\x03\x60\x28\x05\x00"
+                                                        "\xe0\x1e\x02\xc0\xdc\x3a\xfd\x80\xfc\xf9\x81\x06"
+                                                        "\x10\x30\x80\xc8\x06\x40\x1c\x07\xfc\x06\x00\x30"
+                                                        "\x0f\xf8\x0c\x00\x60\x03\x00\x18\x03\xf8\xf8\x1f"
+                                                        "\x1f\x0c\x66\x19\x86\x60\x1c\x05\x81\x70\x46\x18"
+                                                        "\xc3\x18\x63\x0e\xc1\xd0\x34\x05\x40\xf8\x36\x09"
+                                                        "\x84\x3e\x00\xcf\x30\x07\xe0\x1c\x30\x30\x0c\x63"
+                                                        "\xc4\x44\x22\xcc\x13\x88\x03\x98\x03\x98\x03\x98"
+                                                        "\x03\xcc\x13\xc4\x22\x63\xc6\x30\x0c\x18\x38\x07"
+                                                        "\xe0\x73\x21\xba\x8a\x6e\xc0\x11\x26\x6c\xdc\xcc"
+                                                        "\x66\x32\x11\xff\xe0\x04\x00\x80\x10\x02\x00\x40"
+                                                        "\xf0\x3c\x43\x99\x95\x99\x95\x9b\x43\x3c\xfc\x38"
+                                                        "\x8a\x1c\x34\x47\x00\x04\x00\x80\x10\x02\x0f\xfe"
+                                                        "\x08\x01\x00\x20\x04\x00\x03\xff\x80\x3c\x46\x63"
+                                                        "\x63\x06\x04\x08\x11\x3e\xfe\x79\x98\x30\x67\x81"
+                                                        "\x81\xe3\x86\xf0\x08\xcd\x80\xf3\xe7\x0e\x70\xe7"
+                                                        "\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7\x1e\x7e\xf6"
+                                                        "\x00\x60\x06\x00\x60\x06\x00\x3f\xf7\xcc\xfc\xcf"
+                                                        "\xcc\xfc\xcf\xcc\xfc\xc7\xcc\x3c\xc0\x4c\x04\xc0"
+                                                        "\x4c\x04\xc0\x4c\x04\xc0\x48\x05\x86\x50\x6a\x03"
+                                                        "\xc0\xfc\x23\x86\x3f\x00\x10\x47\x2c\x30\xc3\x0c"
+                                                        "\x31\xf0\x33\x3c\x61\xc7\x33\x00\x90\xc8\x66\x37"
+                                                        "\x76\x6c\xc8\x90\x10\x08\x30\x10\x70\x10\xb0\x20"
+                                                        "\x30\x40\x30\x40\x30\x84\x30\x84\x31\x0c\x7a\x14"
+                                                        "\x02\x24\x04\x45\x04\x7f\x08\x05\x10\x04\x30\x04"
+                                                        "\x30\x08\x70\x10\xb0\x20\x30\x20\x30\x40\x30\x40"
+                                                        "\x30\x9e\x31\x23\x79\x33\x02\x13\x02\x02\x04\x04"
+                                                        "\x08\x08\x08\x11\x10\x3e\x20\x00\x30\x04\x66\x04"
+                                                        "\x13\x04\x01\x02\x07\x02\x00\x62\x00\x19\x09\x8d"
+                                                        "\x0c\x8c\x8e\x38\x87\x00\x85\x80\x44\xd0\x43\xf8"
+                                                        "\x20\x34\x20\x18\x20\x0c\x0c\x38\x30\x00\x81\x02"
+                                                        "\x08\x61\x83\x06\x0c\x78\xf1\xbe\x08\x00\x18\x00"
+                                                        "\x18\x00\x18\x00\x08\x00\x20\x00\x40\x01\x80\x03"
+                                                        "\x80\x07\x00\x16\x00\x2e\x00\x5c\x01\x18\x02\x38"
+                                                        "\x07\xf0\x10\x60\x20\xe0\x81\xc1\x01\x8f\x8f\xe0"
+                                                        "\x00\x40\x01\xc0\x03\x00\x08\x00\x20\x00\x20\x00"
+                                                        "\x40\x01\x80\x03\x80\x07\x00\x16\x00\x2e\x00\x5c"
+                                                        "\x01\x18\x02\x38\x07\xf0\x10\x60\x20\xe0\x81\xc1"
+                                                        "\x01\x8f\x8f\xe0\x01\x00\x07\x00\x1a\x00\x22\x00"
+                                                        "\x82\x00\x20\x00\x40\x01\x80\x03\x80\x07\x00\x16"
+                                                        "\x00\x2e\x00\x5c\x01\x18\x02\x38\x07\xf0\x10\x60"
+                                                        "\x20\xe0\x81\xc1\x01\x8f\x8f\xe0\x0f\x20\x17\x80"
+                                                        "\x00\x00\x08\x00\x10\x00\x60\x00\xe0\x01\xc0\x05"
+                                                        "\x80\x0b\x80\x17\x00\x46\x00\x8e\x01\xfc\x04\x18"
+                                                        "\x08\x38\x20\x70\x40\x63\xe3\xf8\x0c\x60\x19\xc0"
+                                                        "\x00\x00\x08\x00\x10\x00\x60\x00\xe0\x01\xc0\x05"
+                                                        "\x80\x0b\x80\x17\x00\x46\x00\x8e\x01\xfc\x04\x18"
+                                                        "\x08\x38\x20\x70\x40\x63\xe3\xf8\x03\x80\x09\x00"
+                                                        "\x11\x00\x24\x00\x38\x00\x20\x00\x40\x01\x80\x03"
+                                                        "\x80\x07\x00\x16\x00\x2e\x00\x5c\x01\x18\x02\x38"
+                                                        "\x07\xf0\x10\x60\x20\xe0\x81\xc1\x01\x8f\x8f\xe0"
+                                                        "\x01\xff\xf0\x07\x81\x80\x3c\x04\x02\xe0\x20\x17"
+                                                        "\x09\x01\x38\x40\x09\xc4\x00\x8f\xe0\x04\x71\x00"
+                                                        "\x43\x88\x03\xfc\x20\x20\xe1\x11\x07\x00\x90\x38"
+                                                        "\x0c\x81\xc0\xfe\x3f\xff\x07\xe0\xc0\xcc\x02\xe0"
+                                                        "\x17\x00\xb0\x03\x80\x1c\x00\xe0\x07\x00\x18\x02"
+                                                        "\xe0\x17\x00\x98\x0c\x60\xe0\xfc\x02\x00\x1c\x00"
+                                                        "\x30\x01\x00\x78\x00\x08\x00\xe0\x03\x80\x04\x00"
+                                                        "\x10\x7f\xf8\xc0\x46\x02\x30\x09\x84\x4c\x20\x61"
+                                                        "\x03\xf8\x18\x40\xc2\x06\x11\x30\x89\x80\x4c\x02"
+                                                        "\x60\x3f\xff\x80\x00\x40\x06\x00\x60\x06\x00\x40"
+                                                        "\x7f\xf8\xc0\x46\x02\x30\x09\x84\x4c\x20\x61\x03"
+                                                        "\xf8\x18\x40\xc2\x06\x11\x30\x89\x80\x4c\x02\x60"
+                                                        "\x3f\xff\x80\x03\x00\x38\x01\x60\x11\x81\x04\x7f"
+                                                        "\xf8\xc0\x46\x02\x30\x09\x84\x4c\x20\x61\x03\xf8"
+                                                        "\x18\x40\xc2\x06\x11\x30\x89\x80\x4c\x02\x60\x3f"
+                                                        "\xff\x80\x1c\xc0\x66\x00\x01\xff\xe3\x01\x18\x08"
+                                                        "\xc0\x26\x11\x30\x81\x84\x0f\xe0\x61\x03\x08\x18"
+                                                        "\x44\xc2\x26\x01\x30\x09\x80\xff\xfe\x83\x06\x0c"
+                                                        "\x0b\xf3\x0c\x30\xc3\x0c\x30\xc3\x0c\x30\xc3\x0c"
+                                                        "\xfc\x04\x31\xcc\x43\xf3\x0c\x30\xc3\x0c\x30\xc3"
+                                                        "\x0c\x30\xc3\x0c\xfc\x30\x71\xa6\x28\x3f\x8c\x18"
+                                                        "\x30\x60\xc1\x83\x06\x0c\x18\x30\x60\xc1\x8f\xc0"
+                                                        "\xcf\x30\x3f\x30\xc3\x0c\x30\xc3\x0c\x30\xc3\x0c"
+                                                        "\x30\xcf\xc0\xff\xe0\x60\x30\xc0\x71\x80\x63\x00"
+                                                        "\xe6\x01\xcc\x03\xff\x87\x30\x0e\x60\x1c\xc0\x39"
+                                                        "\x80\x73\x00\xc6\x03\x8c\x0e\x7f\xf0\x0f\x20\x17"
+                                                        "\x80\x00\x07\xc1\xf5\xc0\x8b\x81\x13\x82\x23\x84"
+                                                        "\x47\x08\x87\x11\x07\x22\x0e\x44\x0e\x88\x0f\x10"
+                                                        "\x1e\x20\x1c\x40\x18\x80\x33\xe0\x20\x04\x00\x1c"
+                                                        "\x00\x0c\x00\x0c\x00\x00\x00\xf8\x06\x0c\x18\x0c"
+                                                        "\x70\x1c\xc0\x19\x80\x37\x00\x7e\x00\xfc\x01\xf8"
+                                                        "\x03\xb0\x06\x70\x0c\xe0\x38\xc0\x60\xc1\x80\x7c"
+                                                        "\x00\x00\x20\x00\xc0\x07\x00\x18\x00\x00\x00\xf8"
+                                                        "\x06\x0c\x18\x0c\x70\x1c\xc0\x19\x80\x37\x00\x7e"
+                                                        "\x00\xfc\x01\xf8\x03\xb0\x06\x70\x0c\xe0\x38\xc0"
+                                                        "\x60\xc1\x80\x7c\x00\x01\x00\x07\x00\x1b\x00\x61"
+                                                        "\x00\x00\x00\xf8\x06\x0c\x18\x0c\x70\x1c\xc0\x19"
+                                                        "\x80\x37\x00\x7e\x00\xfc\x01\xf8\x03\xb0\x06\x70"
+                                                        "\x0c\xe0\x38\xc0\x60\xc1\x80\x7c\x00\x07\x20\x17"
+                                                        "\xc0\x00\x00\x00\x00\x7c\x03\x06\x0c\x06\x38\x0e"
+                                                        "\x60\x0c\xc0\x1b\x80\x3f\x00\x7e\x00\xfc\x01\xd8"
+                                                        "\x03\x38\x06\x70\x1c\x60\x30\x60\xc0\x3e\x00\x0e"
+                                                        "\x60\x18\xc0\x00\x00\x3e\x01\x83\x06\x03\x1c\x07"
+                                                        "\x30\x06\x60\x0d\xc0\x1f\x80\x3f\x00\x7e\x00\xec"
+                                                        "\x01\x9c\x03\x38\x0e\x30\x18\x30\x60\x1f\x00\x80"
+                                                        "\xb0\x36\x18\xcc\x1e\x03\x01\xe0\xcc\x61\xb0\x38"
+                                                        "\x08\x07\xc2\x30\x68\xc0\x63\x80\xe6\x02\xcc\x09"
+                                                        "\xb8\x23\xf0\x47\xe1\x0f\xc4\x1d\x90\x33\x40\x67"
+                                                        "\x01\xc6\x03\x16\x0c\x43\xe0\x04\x00\x18\x00\x18"
+                                                        "\x00\x08\x00\x08\x1f\x87\xcc\x01\x18\x02\x30\x04"
+                                                        "\x60\x08\xc0\x11\x80\x23\x00\x46\x00\x8c\x01\x18"
+                                                        "\x02\x30\x04\x60\x08\xc0\x21\xc0\x40\xff\x00\x00"
+                                                        "\x20\x00\xc0\x03\x00\x08\x00\x20\x1f\x87\xcc\x01"
+                                                        "\x18\x02\x30\x04\x60\x08\xc0\x11\x80\x23\x00\x46"
+                                                        "\x00\x8c\x01\x18\x02\x30\x04\x60\x08\xc0\x21\xc0"
+                                                        "\x40\xff\x00\x01\x00\x07\x00\x1b\x00\x22\x00\x82"
+                                                        "\x1f\x87\xcc\x01\x18\x02\x30\x04\x60\x08\xc0\x11"
+                                                        "\x80\x23\x00\x46\x00\x8c\x01\x18\x02\x30\x04\x60"
+                                                        "\x08\xc0\x21\xc0\x40\xff\x00\x0e\x60\x18\xc0\x00"
+                                                        "\x07\xe1\xf3\x00\x46\x00\x8c\x01\x18\x02\x30\x04"
+                                                        "\x60\x08\xc0\x11\x80\x23\x00\x46\x00\x8c\x01\x18"
+                                                        "\x02\x30\x08\x70\x10\x3f\xc0\x00\x80\x06\x00\x60"
+                                                        "\x04\x00\x40\x7f\x3c\xe0\x83\x04\x1c\x40\x62\x03"
+                                                        "\xa0\x0d\x00\x70\x01\x80\x0c\x00\x60\x03\x00\x18"
+                                                        "\x00\xc0\x06\x01\xfc\x00\xfc\x03\x00\x30\x03\xf8"
+                                                        "\x30\xe3\x06\x30\x73\x07\x30\x73\x06\x30\xe3\xf8"
+                                                        "\x30\x03\x00\x30\x0f\xc0\x1f\x86\x19\xc3\x38\x67"
+                                                        "\x0c\xe7\x1c\x33\x86\x70\xee\x1d\xc3\xb8\x77\x4e"
+                                                        "\xe9\xdd\x37\xdc\x30\x07\x00\x30\x03\x00\x00\x7e"
+                                                        "\x18\x63\x0c\x01\x81\xf0\xc6\x30\xce\x19\xc7\x38"
+                                                        "\xe3\xef\x01\x00\x60\x10\x0c\x00\x00\x7e\x18\x63"
+                                                        "\x0c\x01\x81\xf0\xc6\x30\xce\x19\xc7\x38\xe3\xef"
+                                                        "\x0c\x03\xc0\x4c\x10\xc0\x00\x7e\x18\x63\x0c\x01"
+                                                        "\x81\xf0\xc6\x30\xce\x19\xc7\x38\xe3\xef\x38\x87"
+                                                        "\x91\x1c\x00\x00\x00\x7e\x18\x63\x0c\x01\x81\xf0"
+                                                        "\xc6\x30\xce\x19\xc7\x38\xe3\xef\x33\x86\x60\x00"
+                                                        "\x00\x03\xf0\xc3\x18\x60\x0c\x0f\x86\x31\x86\x70"
+                                                        "\xce\x39\xc7\x1f\x78\x0e\x02\x40\x48\x06\x00\x00"
+                                                        "\x7e\x18\x63\x0c\x01\x81\xf0\xc6\x30\xce\x19\xc7"
+                                                        "\x38\xe3\xef\x3e\x7c\x63\x86\x63\x87\x03\x87\x0f"
+                                                        "\xff\x73\x80\xe3\x80\xc3\x80\xc3\x81\xe5\xc2\x78"
+                                                        "\x7c\x1f\x0c\x66\x0d\x83\xe0\x38\x0e\x01\x81\x60"
+                                                        "\x4c\x21\xf0\x20\x0e\x01\x80\x20\x78\x30\x0e\x00"
+                                                        "\xc0\x18\x00\x07\xc2\x19\x87\x61\xff\xfe\x03\x80"
+                                                        "\xe0\x18\x13\x08\x7c\x01\x00\xc0\x40\x60\x00\x07"
+                                                        "\xc2\x19\x87\x61\xff\xfe\x03\x80\xe0\x18\x13\x08"
+                                                        "\x7c\x0c\x07\x81\x30\x86\x00\x07\xc2\x19\x87\x61"
+                                                        "\xff\xfe\x03\x80\xe0\x18\x13\x08\x7c\x33\x8c\xc0"
+                                                        "\x00\x00\x1f\x08\x66\x1d\x87\xff\xf8\x0e\x03\x80"
+                                                        "\x60\x4c\x21\xf0\xc1\x83\x02\x03\xe3\x8e\x38\xe3"
+                                                        "\x8e\x38\xe3\xbf\x06\x18\x61\x00\x1f\x0e\x1c\x38"
+                                                        "\x70\xe1\xc3\x87\x0e\x7e\x38\x51\x14\x10\x1f\x0e"
+                                                        "\x1c\x38\x70\xe1\xc3\x87\x0e\x7e\xc7\x9c\x00\x0f"
+                                                        "\x87\x0e\x1c\x38\x70\xe1\xc3\x87\x3f\x00\x61\x0f"
+                                                        "\x81\xc1\x98\x03\x00\x61\xfc\x87\x60\xd8\x3e\x0f"
+                                                        "\x83\xe0\xd8\x36\x0c\x86\x1f\x00\x0e\x20\x7a\x04"
+                                                        "\x70\x00\x00\x00\x7d\xf0\xf1\x87\x0e\x38\x71\xc3"
+                                                        "\x8e\x1c\x70\xe3\x87\x1c\x38\xe1\xdf\x9f\x30\x0e"
+                                                        "\x00\xc0\x08\x00\x07\xc2\x19\x83\x60\xf8\x3e\x0f"
+                                                        "\x83\x60\xd8\x32\x18\x7c\x01\x80\xc0\x60\x20\x00"
+                                                        "\x07\xc2\x19\x83\x60\xf8\x3e\x0f\x83\x60\xd8\x32"
+                                                        "\x18\x7c\x0c\x07\x81\x10\x82\x00\x07\xc2\x19\x83"
+                                                        "\x60\xf8\x3e\x0f\x83\x60\xd8\x32\x18\x7c\x18\x8b"
+                                                        "\x22\x70\x00\x00\x07\xc2\x19\x83\x60\xf8\x3e\x0f"
+                                                        "\x83\x60\xd8\x32\x18\x7c\x33\x8c\x40\x00\x00\x1f"
+                                                        "\x08\x66\x0d\x83\xe0\xf8\x3e\x0d\x83\x60\xc8\x61"
+                                                        "\xf0\x0e\x01\xc0\x38\x00\x00\x01\xff\xc0\x00\x00"
+                                                        "\x0e\x01\xc0\x38\x00\x1f\x48\x76\x0d\x87\xe2\xf9"
+                                                        "\x3e\x8f\xc3\x60\xd8\x69\xf0\x10\x01\x80\x06\x00"
+                                                        "\x10\x00\x0f\x3e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7"
+                                                        "\x0e\x70\xe7\x0e\x31\xe3\xef\x01\x80\x38\x06\x00"
+                                                        "\x80\x00\x0f\x3e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7"
+                                                        "\x0e\x70\xe7\x0e\x31\xe3\xef\x06\x00\xf0\x19\x82"
+                                                        "\x08\x00\x0f\x3e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7"
+                                                        "\x0e\x70\xe7\x0e\x31\xe3\xef\x19\x81\x98\x00\x00"
+                                                        "\x00\xf3\xe7\x0e\x70\xe7\x0e\x70\xe7\x0e\x70\xe7"
+                                                        "\x0e\x70\xe3\x1e\x3e\xf0\x01\x80\x38\x06\x00\x80"
+                                                        "\x00\x0f\xdf\x30\x43\x88\x18\x81\xc8\x0d\x00\xd0"
+                                                        "\x0f\x00\x60\x06\x00\x20\x02\x00\x40\x64\x06\x80"
+                                                        "\x70\x00\xf0\x03\x00\x30\x03\x00\x30\x03\x7c\x38"
+                                                        "\x63\x86\x30\x73\x07\x30\x73\x07\x30\x73\x86\x38"
+                                                        "\x63\x7c\x30\x03\x00\x30\x03\x00\xfc\x00\x11\x83"
+                                                        "\x98\x00\x00\x00\xfd\xf3\x04\x38\x81\x88\x1c\x80"
+                                                        "\xd0\x0d\x00\xf0\x06\x00\x60\x02\x00\x20\x04\x06"
+                                                        "\x40\x68\x07\x00\xf8\xe3\x8e\x38\xe3\x8e\x38\xef"
+                                                        "\xc0\xfc\x01\x80\x0c\x00\x60\x83\x08\x19\x80\xd8"
+                                                        "\x07\x00\x30\x03\x80\x2c\x02\x60\x13\x00\x98\x04"
+                                                        "\xc0\x7f\xff\xf8\xe3\x8e\x3c\xf3\x8e\x7a\xe3\x8e"
+                                                        "\x38\xe3\xbf\x07\xff\xf8\x60\xe0\x23\x01\x80\x9c"
+                                                        "\x06\x02\x60\x18\x45\x80\x61\x0e\x01\x84\x38\x07"
+                                                        "\xf0\xe0\x18\x43\x80\x61\x06\x01\x84\x58\x06\x11"
+                                                        "\x70\x18\x04\xc0\x60\x11\x83\x80\xc1\xff\xff\x1f"
+                                                        "\x1e\x08\x78\xc6\x0c\x19\x83\x06\xe0\xff\xf8\x30"
+                                                        "\x0e\x0c\x01\x83\x01\x60\xe0\x88\x78\x21\xf3\xf0"
+                                                        "\x20\x8c\x41\xe0\x30\x00\x07\xc6\x19\x02\xc0\x70"
+                                                        "\x0f\x01\xf0\x3f\x03\xe0\x1c\x03\x80\x60\x1c\x07"
+                                                        "\x82\x7f\x00\x43\x24\x3c\x18\x00\x3e\x42\x42\x60"
+                                                        "\x7c\x3e\x0f\x83\x83\xc3\x7c\x18\xc0\xe6\x00\x01"
+                                                        "\xfc\xf3\x82\x0c\x10\x71\x01\x88\x0e\x80\x34\x01"
+                                                        "\xc0\x06\x00\x30\x01\x80\x0c\x00\x60\x03\x00\x18"
+                                                        "\x07\xf0\x10\x40\x46\x01\x60\x0e\x00\x30\x3f\xfd"
+                                                        "\x81\xc8\x1c\x40\xe2\x0e\x00\xe0\x07\x00\x70\x03"
+                                                        "\x00\x38\x03\x81\x1c\x09\xc0\x4c\x02\xe0\x3f\xff"
+                                                        "\x80\x20\x86\xc0\xe0\x10\x00\x1f\xf4\x19\x0e\x47"
+                                                        "\x01\x80\xe0\x70\x18\x4e\x17\x07\xff\x00\xe0\x1b"
+                                                        "\x01\x30\x30\x03\x00\x70\x06\x01\xf8\x06\x00\x60"
+                                                        "\x06\x00\x60\x0c\x00\xc0\x0c\x00\xc0\x08\x0d\x80"
+                                                        "\x90\x0e\x00\x30\x71\x24\x30\x83\x99\xe1\x80\x87"
+                                                        "\x17\x80\xf0\x69\x99\x60\x3c\x88\xf0\x71\x9e\x08"
+                                                        "\xc6\x63\x33\x10\xff\xe0\xff\xff\x34\x48\xef\x60"
+                                                        "\x6e\xf1\x24\x80\x6e\x71\x24\x80\x31\x42\x44\x84"
+                                                        "\xe7\xf7\x67\xe6\xe7\xf7\x21\x21\x42\x84\xe6\xe7"
+                                                        "\xf7\x21\x21\x42\x84\x0c\x03\x00\xc0\x30\x0c\x19"
+                                                        "\x7f\xfc\x10\x04\x01\x00\xc0\x30\x0c\x03\x00\xc0"
+                                                        "\x30\x0c\x03\x00\x40\x0c\x03\x00\xc0\x30\x0c\x19"
+                                                        "\x7f\xfc\x10\x0c\x03\x00\xc1\x97\xff\xc1\x00\xc0"
+                                                        "\x30\x0c\x03\x00\x40\x39\xff\xff\xff\xff\xff\x9c"
+                                                        "\x60\xc1\xb8\x78\x76\x0c\x18\x78\x30\x08\xc2\x00"
+                                                        "\x84\x40\x08\x44\x00\x84\x80\x0c\x90\x00\x71\x00"
+                                                        "\x00\x20\x00\x04\xe0\xe0\x51\x13\x09\x1a\x10\x90"
+                                                        "\xa1\x11\x0a\x12\x11\xa1\x21\x11\x34\x0e\x1e\x12"
+                                                        "\x6c\xc6\x11\x84\x63\x36\xc8\x00\x20\x08\x01\x00"
+                                                        "\x40\x10\x02\x00\x80\x10\x04\x01\x00\x20\x08\x01"
+                                                        "\x00\x40\x10\x06\x00\xfe\xe0\x39\x27\x06\x91\x30"
+                                                        "\x61\x03\x8e\x10\x38\xe1\x02\x96\x10\x2d\x61\x02"
+                                                        "\x66\x38\x64\xf0\xff\xe0\x0f\x1e\x19\xb3\x39\xb1"
+                                                        "\x38\x70\x38\x70\xfe\xfc\x38\x70\x38\x70\x38\x70"
+                                                        "\x38\x70\x38\x70\x38\x70\x38\x70\x38\x70\x38\x70"
+                                                        "\xfc\xfc\x07\xc0\xc3\x06\x18\x70\x03\x80\x7e\xf8"
+                                                        "\xe1\xc7\x0e\x38\x71\xc3\x8e\x1c\x70\xe3\x87\x1c"
+                                                        "\x38\xe1\xdf\xbf\x07\xf0\xe3\x86\x1c\x70\xe3\x87"
+                                                        "\x7e\x38\xe1\xc7\x0e\x38\x71\xc3\x8e\x1c\x70\xe3"
+                                                        "\x87\x1c\x38\xe1\xdf\xbf\x0f\x0f\x80\xcd\x86\x0e"
+                                                        "\x6c\x00\x70\x60\x03\x83\x00\x7f\x7e\xf0\xe1\xc1"
+                                                        "\x87\x0e\x0c\x38\x70\x61\xc3\x83\x0e\x1c\x18\x70"
+                                                        "\xe0\xc3\x87\x06\x1c\x38\x30\xe1\xc1\x9f\x9f\xbf"
+                                                        "\x0f\x0f\xe0\xcc\x83\x0e\x6c\x18\x70\x60\xc3\x83"
+                                                        "\x06\x7f\x7e\x30\xe1\xc1\x87\x0e\x0c\x38\x70\x61"
+                                                        "\xc3\x83\x0e\x1c\x18\x70\xe0\xc3\x87\x06\x1c\x38"
+                                                        "\x30\xe1\xc1\x9f\x9f\xbf";
+
+constexpr Font bailleul_16_pt = {
+    .size = 16,
+    .numCharacters = 232,
+    .boundingBoxWidth = 27,
+    .boundingBoxHeight = 27,
+    .boundingBoxXOffset = -4,
+    .boundingBoxYOffset = -6,
+    .ascent = 20,
+    .descent = 5,
+    .asciiIndex = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                   28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+                   53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+                   78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95},
+    .characters = bailleul_16_pt_characters,
+    .bitmaps = bailleul_16_pt_bitmaps,
+};
 
 // bailleul_bold
 //   - Copyright (c) 2019 Yomli  Copyright (c) 1850 Bailleul et Cie  Copyright (c) 1800 Justus Erich Walbaum"
 //   - Size: 8
 //   - Characters: 232
-uint8_t bailleul_bold_8_pt[3850] = "\x08\x00\xe8\x0e\x0e\xfe\xfd\x0a\x02\x00\x00\x00\x0e\x05\x08\x04\x08\x00\x00\xf9"
-                                   "\x99\x99\x9f\x00\x20\x00\x0a\x03\x00\x00\x00\x00\x00\x00\x21\x00\x0d\x03\x00\x02"
-                                   "\x09\x01\x00\xaa\xa2\xc0\x00\x22\x00\x0c\x05\x00\x03\x04\x01\x05\xb6\xd0\x00\x23"
-                                   "\x00\x11\x06\x00\x06\x09\x00\x00\x28\xa2\x9f\x29\x2f\x94\x50\x00\x24\x00\x13\x06"
-                                   "\x00\x06\x0b\x00\xff\x11\xe5\xb5\x71\xe1\xe5\x97\xe1\x00\x00\x25\x00\x15\x0b\x00"
-                                   "\x09\x09\x01\x00\x62\x49\x25\x12\x86\x80\x98\x52\x49\x23\x00\x00\x26\x00\x15\x09"
-                                   "\x00\x09\x09\x00\x00\x1c\x1a\x0d\x03\x73\xa2\x73\x33\x8d\x7f\x00\x00\x27\x00\x0b"
-                                   "\x02\x00\x01\x04\x01\x05\xf0\x00\x28\x00\x10\x05\x00\x04\x0b\x01\xfd\x12\x4c\xcc"
-                                   "\xcc\x42\x10\x00\x29\x00\x10\x05\x00\x04\x0b\x00\xfd\x84\x23\x33\x33\x24\x80\x00"
-                                   "\x2A\x00\x0c\x04\x00\x04\x04\x00\x05\x2f\x65\x00\x2B\x00\x0e\x07\x00\x05\x06\x01"
-                                   "\x00\x21\x3e\x42\x10\x00\x2C\x00\x0b\x03\x00\x02\x04\x01\xfe\xb6\x00\x2D\x00\x0b"
-                                   "\x04\x00\x04\x01\x00\x02\xf0\x00\x2E\x00\x0b\x03\x00\x01\x02\x01\x00\xc0\x00\x2F"
-                                   "\x00\x0f\x04\x00\x04\x09\x00\x00\x11\x22\x24\x44\x80\x00\x30\x00\x11\x06\x00\x06"
-                                   "\x09\x00\x00\x31\x24\xb3\xcf\x34\x92\x30\x00\x31\x00\x0f\x06\x00\x04\x09\x01\x00"
-                                   "\x26\xe6\x66\x66\xf0\x00\x32\x00\x11\x06\x00\x06\x09\x00\x00\x7a\x34\xd2\x08\x42"
-                                   "\x11\xf8\x00\x33\x00\x11\x06\x00\x06\x09\x00\x00\x71\x20\x86\x30\x20\xf3\x78\x00"
-                                   "\x34\x00\x11\x06\x00\x06\x09\x00\x00\x18\x63\x8e\x59\x7f\xc7\x18\x00\x35\x00\x11"
-                                   "\x06\x00\x05\x0a\x00\x00\x0b\xdc\x87\x2c\x21\x8b\x80\x00\x36\x00\x10\x06\x00\x05"
-                                   "\x09\x01\x00\x74\xa1\xe9\x4e\x72\x70\x00\x37\x00\x10\x06\x00\x05\x09\x01\x00\xfc"
-                                   "\xa4\x22\x11\x8c\x60\x00\x38\x00\x11\x06\x00\x06\x09\x00\x00\x39\x24\x9e\x39\x3c"
-                                   "\xd2\x78\x00\x39\x00\x11\x06\x00\x06\x09\x00\x00\x71\x2c\xb3\x4c\xf0\x92\x70\x00"
-                                   "\x3A\x00\x0b\x03\x00\x01\x06\x01\x00\xcc\x00\x3B\x00\x0c\x03\x00\x02\x08\x01\xfe"
-                                   "\xa0\xb6\x00\x3C\x00\x0e\x07\x00\x05\x06\x01\x00\x09\xf9\x87\x04\x00\x3D\x00\x0d"
-                                   "\x07\x00\x05\x04\x01\x01\xf8\x01\xf0\x00\x3E\x00\x0e\x07\x00\x05\x06\x01\x00\x86"
-                                   "\x0e\x36\x40\x00\x3F\x00\x0f\x05\x00\x04\x09\x01\x00\xeb\x13\x24\x04\x40\x00\x40"
-                                   "\x00\x13\x09\x00\x08\x09\x00\x00\x1e\x61\x4f\xd3\xd5\xd5\x5e\x61\x1e\x00\x41\x00"
-                                   "\x13\x08\x00\x08\x09\x00\x00\x08\x18\x18\x18\x2c\x2c\x3c\x46\xef\x00\x42\x00\x12"
-                                   "\x08\x00\x07\x09\x00\x00\xfc\xcd\x9b\x37\xcc\xd8\xb3\xfe\x00\x43\x00\x12\x08\x00"
-                                   "\x07\x09\x01\x00\x3c\x87\x0e\x0c\x18\x30\xa1\x3c\x00\x44\x00\x15\x0a\x00\x09\x09"
-                                   "\x00\x00\xfe\x31\x98\x6c\x36\x1b\x0d\x86\xc6\xfe\x00\x00\x45\x00\x12\x08\x00\x07"
-                                   "\x09\x00\x00\xfe\xc5\x9b\x47\x8c\x99\xb1\xfe\x00\x46\x00\x12\x07\x00\x07\x09\x00"
-                                   "\x00\xfe\xc5\x9b\x27\x8c\x99\x30\xf0\x00\x47\x00\x13\x09\x00\x08\x09\x01\x00\x3e"
-                                   "\x42\xc2\xc0\xc7\xc2\xc2\x42\x3c\x00\x48\x00\x15\x09\x00\x09\x09\x00\x00\xf7\xb1"
-                                   "\x98\xcc\x67\xf3\x19\x8c\xc6\xf7\x80\x00\x49\x00\x0f\x04\x00\x04\x09\x00\x00\xf6"
-                                   "\x66\x66\x66\xf0\x00\x4A\x00\x10\x06\x00\x05\x09\x00\x00\x38\x84\x21\x08\x52\xf0"
-                                   "\x00\x4B\x00\x15\x09\x00\x09\x09\x00\x00\xf7\x32\x19\x0d\x07\xc3\x61\x98\xcc\xf7"
-                                   "\x80\x00\x4C\x00\x13\x08\x00\x08\x09\x00\x00\xf0\x60\x60\x60\x60\x60\x61\x61\xff"
-                                   "\x00\x4D\x00\x17\x0b\x00\x0b\x09\x00\x00\xe0\xee\x39\xc7\x39\x65\xac\xb9\x93\x32"
-                                   "\x46\xe9\xe0\x00\x4E\x00\x15\x09\x00\x09\x09\x00\x00\xf3\xb8\x96\x49\xa4\xd2\x39"
-                                   "\x0c\x86\xe1\x00\x00\x4F\x00\x13\x0a\x00\x08\x09\x01\x00\x3c\x42\xc3\xc3\xc3\xc3"
-                                   "\xc3\x42\x3c\x00\x50\x00\x13\x08\x00\x08\x09\x00\x00\xfe\x63\x63\x62\x7c\x60\x60"
-                                   "\x60\xf0\x00\x51\x00\x16\x0a\x00\x08\x0c\x01\xfd\x3c\x46\xc2\xc3\xc3\xc3\xc3\xc2"
-                                   "\x44\x38\x2d\x47\x00\x52\x00\x13\x08\x00\x08\x09\x00\x00\xfc\x66\x66\x64\x78\x66"
-                                   "\x66\x66\xf3\x00\x53\x00\x11\x07\x00\x06\x09\x00\x00\x39\x14\x5c\x78\x78\x61\x78"
-                                   "\x00\x54\x00\x13\x08\x00\x08\x09\x00\x00\xff\x99\x99\x18\x18\x18\x18\x18\x3c\x00"
-                                   "\x55\x00\x15\x09\x00\x09\x09\x00\x00\xf3\xb0\x98\x4c\x26\x13\x09\x84\xc2\x3e\x00"
-                                   "\x00\x56\x00\x13\x08\x00\x08\x09\x00\x00\xf7\x62\x24\x34\x34\x18\x18\x18\x10\x00"
-                                   "\x57\x00\x18\x0c\x00\x0c\x09\x00\x00\xf7\xb6\x31\x25\xa3\x5a\x35\xa3\x8c\x18\xc1"
-                                   "\x0c\x10\x80\x00\x58\x00\x13\x08\x00\x08\x09\x00\x00\xf6\x74\x38\x18\x18\x1c\x2c"
-                                   "\x26\xef\x00\x59\x00\x13\x08\x00\x08\x09\x00\x00\xf7\x32\x34\x18\x18\x18\x18\x18"
-                                   "\x3c\x00\x5A\x00\x12\x07\x00\x07\x09\x00\x00\x7e\x9a\x30\xc1\x86\x0c\xb1\xfe\x00"
-                                   "\x5B\x00\x0f\x04\x00\x03\x0c\x01\xfd\xfb\x6d\xb6\xdb\x70\x00\x5C\x00\x0f\x04\x00"
-                                   "\x04\x09\x00\x00\x84\x44\x22\x21\x10\x00\x5D\x00\x0f\x04\x00\x03\x0c\x00\xfd\xe4"
-                                   "\x92\x49\x24\xf0\x00\x5E\x00\x0e\x06\x00\x05\x05\x01\x04\x23\x19\x29\x80\x00\x5F"
-                                   "\x00\x0b\x06\x00\x06\x01\x00\xfe\xfc\x00\x60\x00\x0b\x03\x00\x03\x02\xff\x07\xc4"
-                                   "\x00\x61\x00\x0f\x07\x00\x06\x06\x00\x00\x79\x33\xd3\xcd\xf0\x00\x62\x00\x11\x07"
-                                   "\x00\x06\x09\x00\x00\xc1\x04\x1e\x45\x14\x51\x78\x00\x63\x00\x0f\x06\x00\x06\x06"
-                                   "\x00\x00\x39\x24\x30\x44\xe0\x00\x64\x00\x12\x07\x00\x07\x09\x00\x00\x0c\x08\x13"
-                                   "\xa4\xc8\xb1\x26\x7e\x00\x65\x00\x0f\x06\x00\x06\x06\x00\x00\x39\x37\xf0\x44\xe0"
-                                   "\x00\x66\x00\x10\x04\x00\x05\x09\x00\x00\x3b\x59\xc6\x31\x8c\xe0\x00\x67\x00\x12"
-                                   "\x07\x00\x07\x09\x00\xfd\x3e\x91\x23\x84\x0f\x91\x42\x78\x00\x68\x00\x12\x07\x00"
-                                   "\x07\x09\x00\x00\xe0\xc1\x83\xe6\x4c\x99\x32\xee\x00\x69\x00\x0e\x04\x00\x03\x09"
-                                   "\x00\x00\x6c\x76\xdb\xe0\x00\x6A\x00\x0f\x04\x00\x03\x0c\x00\xfd\x6c\x76\xdb\x6d"
-                                   "\x60\x00\x6B\x00\x12\x07\x00\x07\x09\x00\x00\xe0\xc1\x83\x66\x8d\x1e\x36\xee\x00"
-                                   "\x6C\x00\x0e\x04\x00\x03\x09\x00\x00\xed\xb6\xdb\xe0\x00\x6D\x00\x13\x0b\x00\x0b"
-                                   "\x06\x00\x00\xff\xcc\x99\x93\x32\x66\x4d\xdd\xc0\x00\x6E\x00\x10\x07\x00\x07\x06"
-                                   "\x00\x00\xfc\xc9\x93\x26\x5d\xc0\x00\x6F\x00\x0f\x07\x00\x06\x06\x00\x00\x39\x34"
-                                   "\xf3\x4c\xe0\x00\x70\x00\x12\x07\x00\x07\x09\x00\xfd\xfc\xc9\x9b\x36\x4f\x98\x30"
-                                   "\xe0\x00\x71\x00\x12\x07\x00\x07\x09\x00\xfd\x74\x99\x16\x24\xcf\x81\x02\x0e\x00"
-                                   "\x72\x00\x0e\x05\x00\x05\x06\x00\x00\xfb\x58\xc6\x70\x00\x73\x00\x0e\x05\x00\x05"
-                                   "\x06\x00\x00\x72\x9c\x79\xf8\x00\x74\x00\x0e\x04\x00\x04\x08\x00\x00\x26\xf6\x66"
-                                   "\x67\x00\x75\x00\x10\x07\x00\x07\x06\x00\x00\xec\xc9\x93\x26\x4f\xc0\x00\x76\x00"
-                                   "\x0f\x06\x00\x06\x06\x00\x00\xed\xa2\x8c\x30\x40\x00\x77\x00\x12\x0a\x00\x0a\x06"
-                                   "\x00\x00\xee\xdb\xa2\xe8\xcc\x33\x08\x80\x00\x78\x00\x10\x07\x00\x07\x06\x00\x00"
-                                   "\xfc\x50\xc0\xc3\x9b\xc0\x00\x79\x00\x11\x06\x00\x06\x09\x00\xfd\xed\xa2\x8c\x30"
-                                   "\x41\x38\xe0\x00\x7A\x00\x0e\x06\x00\x05\x06\x00\x00\x7c\x8c\x46\xfc\x00\x7B\x00"
-                                   "\x0f\x04\x00\x03\x0b\x01\xfe\x7b\x6d\x36\xdb\x80\x00\x7C\x00\x0c\x02\x00\x01\x0c"
-                                   "\x01\xfd\xff\xf0\x00\x7D\x00\x0f\x04\x00\x03\x0b\x01\xfe\xc9\x24\xd2\x4b\x00\x00"
-                                   "\x7E\x00\x0c\x06\x00\x05\x02\x01\x02\xcd\x80\x00\xA1\x00\x0d\x03\x00\x02\x09\x01"
-                                   "\xfd\xe2\xaa\x80\x00\xA2\x00\x11\x06\x00\x06\x09\x00\xff\x10\x42\x96\x53\x45\x4a"
-                                   "\x10\x00\xA3\x00\x11\x06\x00\x06\x09\x00\x00\x38\xa6\x18\xf8\x82\x49\xf8\x00\xA4"
-                                   "\x00\x0f\x06\x00\x06\x06\x00\x01\xfd\x2c\x71\x4f\xf0\x00\xA5\x00\x12\x06\x00\x07"
-                                   "\x09\x00\x00\xee\xc9\xa1\x43\x0f\x1e\x18\x78\x00\xA6\x00\x0c\x02\x00\x01\x09\x01"
-                                   "\xff\xe3\x80\x00\xA7\x00\x12\x06\x00\x05\x0c\x01\xfd\x74\xa5\x8e\x79\x4d\x1c\xa5"
-                                   "\xc0\x00\xA8\x00\x0b\x03\x00\x03\x02\x00\x07\xb4\x00\xA9\x00\x13\x09\x00\x08\x09"
-                                   "\x00\x00\x1c\x62\x4d\xb3\xa1\xb3\x4d\x62\x1c\x00\xAA\x00\x0c\x04\x00\x04\x04\x00"
-                                   "\x04\x69\xf5\x00\xAB\x00\x0c\x05\x00\x04\x03\x00\x01\x7f\x70\x00\xAC\x00\x0d\x07"
-                                   "\x00\x05\x04\x01\x01\xf8\x42\x10\x00\xAD\x00\x0b\x04\x00\x02\x01\x01\x02\xc0\x00"
-                                   "\xAE\x00\x0d\x05\x00\x04\x05\x01\x04\x6d\xde\x40\x00\xAF\x00\x0b\x03\x00\x03\x01"
-                                   "\x00\x07\xe0\x00\xB0\x00\x0c\x04\x00\x03\x04\x01\x05\xd6\xe0\x00\xB1\x00\x0e\x07"
-                                   "\x00\x05\x06\x01\x00\x21\x3e\x40\x7c\x00\xB2\x00\x0d\x04\x00\x04\x05\x00\x05\xfd"
-                                   "\x24\xf0\x00\xB3\x00\x0d\x05\x00\x04\x05\x00\x05\x71\x61\xf0\x00\xB4\x00\x0b\x03"
-                                   "\x00\x03\x02\x01\x07\x70\x00\xB5\x00\x12\x07\x00\x07\x09\x00\xfd\xec\xc9\x93\x26"
-                                   "\x4f\xd0\x20\x40\x00\xB6\x00\x13\x07\x00\x06\x0b\x00\xfe\x7f\xae\xba\x68\x61\x86"
-                                   "\x19\x62\x00\x00\xB7\x00\x0b\x03\x00\x01\x02\x01\x02\xc0\x00\xB8\x00\x0c\x03\x00"
-                                   "\x03\x03\x00\xfd\x47\x00\x00\xB9\x00\x0c\x04\x00\x03\x05\x01\x05\x59\x2e\x00\xBA"
-                                   "\x00\x0c\x04\x00\x04\x04\x00\x04\x6d\xd6\x00\xBB\x00\x0c\x05\x00\x04\x03\x00\x01"
-                                   "\xf7\xe0\x00\xBC\x00\x15\x09\x00\x09\x09\x00\x00\x22\x71\x19\x0c\x86\x93\x98\x56"
-                                   "\x4f\x21\x00\x00\xBD\x00\x15\x09\x00\x09\x09\x00\x00\x22\x31\x39\x0c\x86\xb3\x74"
-                                   "\x44\x45\x27\x00\x00\xBE\x00\x15\x09\x00\x09\x09\x00\x00\x62\x51\x19\x02\x89\x93"
-                                   "\x98\x56\x4f\x21\x00\x00\xBF\x00\x10\x05\x00\x05\x09\x00\xfd\x31\x80\x46\x63\x1b"
-                                   "\x70\x00\xC0\x00\x15\x08\x00\x08\x0b\x00\x00\x30\x10\x08\x18\x18\x18\x2c\x2c\x3c"
-                                   "\x46\xef\x00\xC1\x00\x15\x08\x00\x08\x0b\x00\x00\x04\x18\x08\x18\x18\x18\x2c\x2c"
-                                   "\x3c\x46\xef\x00\xC2\x00\x15\x08\x00\x08\x0b\x00\x00\x18\x24\x08\x18\x18\x18\x2c"
-                                   "\x2c\x3c\x46\xef\x00\xC3\x00\x15\x08\x00\x08\x0b\x00\x00\x14\x2c\x08\x18\x18\x18"
-                                   "\x2c\x2c\x3c\x46\xef\x00\xC4\x00\x15\x08\x00\x08\x0b\x00\x00\x24\x3c\x08\x18\x18"
-                                   "\x18\x2c\x2c\x3c\x46\xef\x00\xC5\x00\x15\x08\x00\x08\x0b\x00\x00\x18\x18\x18\x18"
-                                   "\x18\x18\x2c\x2c\x3c\x46\xef\x00\xC6\x00\x17\x0c\x00\x0b\x09\x00\x00\x0f\xe1\xc4"
-                                   "\x5a\x8b\x42\x78\x7d\x09\x8a\x31\xcf\xe0\x00\xC7\x00\x15\x08\x00\x07\x0c\x01\xfd"
-                                   "\x3c\x87\x0e\x0c\x18\x30\xa1\x2c\x20\x20\xc0\x00\xC8\x00\x14\x08\x00\x07\x0b\x00"
-                                   "\x00\x30\x23\xbb\x16\x6d\x1e\x32\x66\xc7\xf8\x00\xC9\x00\x14\x08\x00\x07\x0b\x00"
-                                   "\x00\x0c\x13\xdb\x16\x6d\x1e\x32\x66\xc7\xf8\x00\xCA\x00\x14\x08\x00\x07\x0b\x00"
-                                   "\x00\x18\x4b\xfb\x16\x6d\x1e\x32\x66\xc7\xf8\x00\xCB\x00\x14\x08\x00\x07\x0b\x00"
-                                   "\x00\x24\x7b\xdb\x16\x6d\x1e\x32\x66\xc7\xf8\x00\xCC\x00\x10\x04\x00\x04\x0b\x00"
-                                   "\x00\x42\xf6\x66\x66\x66\xf0\x00\xCD\x00\x10\x04\x00\x04\x0b\x00\x00\x12\xf6\x66"
-                                   "\x66\x66\xf0\x00\xCE\x00\x10\x04\x00\x04\x0b\x00\x00\x65\xe6\x66\x66\x66\xf0\x00"
-                                   "\xCF\x00\x10\x04\x00\x04\x0b\x00\x00\x5d\x66\x66\x66\x66\xf0\x00\xD0\x00\x15\x0a"
-                                   "\x00\x09\x09\x00\x00\xfe\x31\x98\x6c\x3f\x9b\x0d\x86\xc6\xfe\x00\x00\xD1\x00\x17"
-                                   "\x09\x00\x09\x0b\x00\x00\x1a\x16\x3c\xee\x25\x92\x69\x34\x8e\x43\x21\xb8\x40\x00"
-                                   "\xD2\x00\x15\x0a\x00\x08\x0b\x01\x00\x30\x10\x2c\x42\xc3\xc3\xc3\xc3\xc3\x42\x3c"
-                                   "\x00\xD3\x00\x15\x0a\x00\x08\x0b\x01\x00\x04\x08\x34\x42\xc3\xc3\xc3\xc3\xc3\x42"
-                                   "\x3c\x00\xD4\x00\x15\x0a\x00\x08\x0b\x01\x00\x18\x28\x34\x42\xc3\xc3\xc3\xc3\xc3"
-                                   "\x42\x3c\x00\xD5\x00\x15\x0a\x00\x08\x0b\x01\x00\x34\x28\x34\x42\xc3\xc3\xc3\xc3"
-                                   "\xc3\x42\x3c\x00\xD6\x00\x15\x0a\x00\x08\x0b\x01\x00\x28\x2c\x34\x42\xc3\xc3\xc3"
-                                   "\xc3\xc3\x42\x3c\x00\xD7\x00\x0e\x07\x00\x05\x05\x01\x00\x9b\x99\xa8\x80\x00\xD8"
-                                   "\x00\x13\x0a\x00\x08\x09\x01\x00\x3d\x46\xc7\xcb\xd3\xe3\xc3\x42\xbc\x00\xD9\x00"
-                                   "\x17\x09\x00\x09\x0b\x00\x00\x10\x04\x3c\xec\x26\x13\x09\x84\xc2\x61\x30\x8f\x80"
-                                   "\x00\xDA\x00\x17\x09\x00\x09\x0b\x00\x00\x04\x04\x3c\xec\x26\x13\x09\x84\xc2\x61"
-                                   "\x30\x8f\x80\x00\xDB\x00\x17\x09\x00\x09\x0b\x00\x00\x08\x0a\x38\xec\x26\x13\x09"
-                                   "\x84\xc2\x61\x30\x8f\x80\x00\xDC\x00\x17\x09\x00\x09\x0b\x00\x00\x14\x0a\x38\xec"
-                                   "\x26\x13\x09\x84\xc2\x61\x30\x8f\x80\x00\xDD\x00\x15\x08\x00\x08\x0b\x00\x00\x04"
-                                   "\x08\xf7\x32\x34\x18\x18\x18\x18\x18\x3c\x00\xDE\x00\x13\x08\x00\x08\x09\x00\x00"
-                                   "\xf0\x60\x7c\x62\x63\x62\x7c\x60\xf0\x00\xDF\x00\x11\x07\x00\x06\x09\x00\x00\x3d"
-                                   "\xb6\xde\x65\x96\x5d\xfc\x00\xE0\x00\x11\x07\x00\x06\x09\x00\x00\x20\x40\x1e\x4c"
-                                   "\xf4\xf3\x7c\x00\xE1\x00\x11\x07\x00\x06\x09\x00\x00\x08\x40\x1e\x4c\xf4\xf3\x7c"
-                                   "\x00\xE2\x00\x11\x07\x00\x06\x09\x00\x00\x31\xa0\x1e\x4c\xf4\xf3\x7c\x00\xE3\x00"
-                                   "\x11\x07\x00\x06\x09\x00\x00\x29\x60\x1e\x4c\xf4\xf3\x7c\x00\xE4\x00\x11\x07\x00"
-                                   "\x06\x09\x00\x00\x29\xa0\x1e\x4c\xf4\xf3\x7c\x00\xE5\x00\x11\x07\x00\x06\x09\x00"
-                                   "\x00\x10\xa1\x1a\x4c\xf4\xf3\x7c\x00\xE6\x00\x11\x0a\x00\x09\x06\x00\x00\x7f\x24"
-                                   "\xcf\xe9\x0c\xcb\xb8\x00\xE7\x00\x11\x06\x00\x06\x09\x00\xfd\x39\x24\x30\x44\xa1"
-                                   "\x06\x30\x00\xE8\x00\x11\x06\x00\x06\x09\x00\x00\x20\x40\x0e\x4d\xfc\x11\x38\x00"
-                                   "\xE9\x00\x11\x06\x00\x06\x09\x00\x00\x08\x40\x0e\x4d\xfc\x11\x38\x00\xEA\x00\x11"
-                                   "\x06\x00\x06\x09\x00\x00\x31\xa0\x0e\x4d\xfc\x11\x38\x00\xEB\x00\x11\x06\x00\x06"
-                                   "\x09\x00\x00\x69\xa0\x0e\x4d\xfc\x11\x38\x00\xEC\x00\x0e\x04\x00\x03\x09\x00\x00"
-                                   "\x8c\x76\xdb\xe0\x00\xED\x00\x0f\x04\x00\x04\x09\x00\x00\x34\x0e\x66\x66\xe0\x00"
-                                   "\xEE\x00\x0f\x04\x00\x04\x09\x00\x00\x6b\x0e\x66\x66\xe0\x00\xEF\x00\x0f\x04\x00"
-                                   "\x04\x09\x00\x00\xbb\x0e\x66\x66\xe0\x00\xF0\x00\x11\x07\x00\x06\x09\x00\x00\x68"
-                                   "\xc4\x8f\x4f\x34\xd3\x38\x00\xF1\x00\x12\x07\x00\x07\x09\x00\x00\x34\xb0\x07\xe6"
-                                   "\x4c\x99\x32\xee\x00\xF2\x00\x11\x07\x00\x06\x09\x00\x00\x20\x40\x0e\x4d\x3c\xd3"
-                                   "\x38\x00\xF3\x00\x11\x07\x00\x06\x09\x00\x00\x08\x40\x0e\x4d\x3c\xd3\x38\x00\xF4"
-                                   "\x00\x11\x07\x00\x06\x09\x00\x00\x10\xa0\x0e\x4d\x3c\xd3\x38\x00\xF5\x00\x11\x07"
-                                   "\x00\x06\x09\x00\x00\x35\x60\x0e\x4d\x3c\xd3\x38\x00\xF6\x00\x11\x07\x00\x06\x09"
-                                   "\x00\x00\x29\xa0\x0e\x4d\x3c\xd3\x38\x00\xF7\x00\x0f\x07\x00\x05\x07\x01\x00\x23"
-                                   "\x01\xf0\x11\x80\x00\xF8\x00\x0f\x07\x00\x06\x06\x00\x00\x3d\x35\xfb\x4e\xe0\x00"
-                                   "\xF9\x00\x12\x07\x00\x07\x09\x00\x00\x20\x20\x07\x66\x4c\x99\x32\x7e\x00\xFA\x00"
-                                   "\x12\x07\x00\x07\x09\x00\x00\x08\x20\x07\x66\x4c\x99\x32\x7e\x00\xFB\x00\x12\x07"
-                                   "\x00\x07\x09\x00\x00\x10\x50\x07\x66\x4c\x99\x32\x7e\x00\xFC\x00\x12\x07\x00\x07"
-                                   "\x09\x00\x00\x28\x50\x07\x66\x4c\x99\x32\x7e\x00\xFD\x00\x13\x06\x00\x06\x0c\x00"
-                                   "\xfd\x08\x40\x3b\x68\xa3\x0c\x10\x4e\x38\x00\xFE\x00\x15\x07\x00\x07\x0c\x00\xfd"
-                                   "\xe0\xc1\x83\xe6\x4c\xd9\xb2\x7c\xc1\x87\x00\x00\xFF\x00\x13\x06\x00\x06\x0c\x00"
-                                   "\xfd\x69\xa0\x3b\x68\xa3\x0c\x10\x4e\x38\x01\x31\x00\x0d\x04\x00\x03\x06\x00\x00"
-                                   "\xed\xb7\xc0\x01\x41\x00\x13\x08\x00\x08\x09\x00\x00\xf0\x60\x68\x70\x60\xe0\xe1"
-                                   "\x61\xff\x01\x42\x00\x0e\x04\x00\x03\x09\x00\x00\xed\xb7\xdb\xe0\x01\x52\x00\x17"
-                                   "\x0d\x00\x0b\x09\x01\x00\x3f\xe8\xc7\x1a\xe3\x4c\x79\x8d\x31\xaa\x31\x3f\xe0\x01"
-                                   "\x53\x00\x12\x0a\x00\x0a\x06\x00\x00\x3f\x93\x24\xff\x30\x4c\x4f\xe0\x01\x60\x00"
-                                   "\x13\x07\x00\x06\x0b\x00\x00\x68\xc2\x91\x45\xc7\x87\x86\x17\x80\x01\x61\x00\x10"
-                                   "\x05\x00\x05\x09\x00\x00\x51\x00\xe5\x38\xf3\xf0\x01\x78\x00\x15\x08\x00\x08\x0b"
-                                   "\x00\x00\x14\x34\xe3\x32\x34\x18\x18\x18\x18\x18\x3c\x01\x7D\x00\x14\x07\x00\x07"
-                                   "\x0b\x00\x00\x2c\x31\x9a\x68\xc3\x06\x18\x32\xc7\xf8\x01\x7E\x00\x10\x06\x00\x05"
-                                   "\x09\x00\x00\x59\x80\xf9\x18\x8d\xf8\x01\x92\x00\x13\x06\x00\x06\x0c\x00\xfd\x0c"
-                                   "\x51\x4c\x31\xe3\x0c\x20\x8a\x30\x02\xC6\x00\x0b\x03\x00\x03\x02\x00\x07\x54\x02"
-                                   "\xC7\x00\x0b\x03\x00\x03\x02\x00\x07\xa8\x02\xD8\x00\x0b\x03\x00\x03\x02\x00\x07"
-                                   "\xbc\x02\xD9\x00\x0b\x03\x00\x01\x02\x01\x07\xc0\x02\xDA\x00\x0c\x03\x00\x03\x03"
-                                   "\x00\x06\x55\x00\x02\xDB\x00\x0c\x03\x00\x03\x03\x00\xfd\x57\x00\x02\xDC\x00\x0b"
-                                   "\x03\x00\x04\x02\x00\x07\xde\x02\xDD\x00\x0c\x03\x00\x05\x02\x00\x07\x7d\x80\x20"
-                                   "\x13\x00\x0b\x06\x00\x06\x01\x00\x02\xfc\x20\x14\x00\x0c\x0b\x00\x09\x01\x01\x02"
-                                   "\xff\x80\x20\x18\x00\x0b\x02\x00\x02\x04\x00\x05\x6f\x20\x19\x00\x0b\x02\x00\x02"
-                                   "\x04\x00\x05\xf7\x20\x1A\x00\x0b\x02\x00\x02\x04\x00\xfe\xf7\x20\x1C\x00\x0d\x05"
-                                   "\x00\x05\x04\x00\x05\x4c\xb6\xb0\x20\x1D\x00\x0d\x05\x00\x05\x04\x00\x05\xda\xd2"
-                                   "\xa0\x20\x1E\x00\x0d\x05\x00\x05\x04\x00\xfe\x5e\xd2\xa0\x20\x20\x00\x11\x06\x00"
-                                   "\x05\x0b\x01\xfe\x63\x09\xfb\x10\x8c\x63\x08\x20\x21\x00\x11\x06\x00\x05\x0b\x01"
-                                   "\xfe\x63\x09\xfb\x12\xdf\x23\x08\x20\x22\x00\x0d\x06\x00\x04\x05\x01\x02\x4e\xff"
-                                   "\x60\x20\x26\x00\x0d\x0b\x00\x09\x02\x01\x00\xc9\xe4\xc0\x20\x30\x00\x17\x0b\x00"
-                                   "\x0b\x09\x00\x00\x64\x14\x82\xe0\x54\x05\x00\x29\x8a\xaa\x5d\x4e\xe0\x20\x39\x00"
-                                   "\x0c\x03\x00\x03\x03\x00\x01\x79\x80\x20\x3A\x00\x0c\x03\x00\x03\x03\x00\x01\xcf"
-                                   "\x00\x20\x44\x00\x11\x02\x00\x06\x09\xfe\x00\x04\x21\x04\x20\x84\x10\x80\x21\x22"
-                                   "\x00\x11\x0b\x00\x0b\x05\x00\x03\xf6\x75\xc8\x9b\x12\xa6\x56\x22\x12\x00\x0b\x07"
-                                   "\x00\x05\x01\x01\x02\xf8\xFB\x00\x00\x15\x08\x00\x09\x09\x00\x00\x37\xb6\xd9\x1d"
-                                   "\xc6\x43\x21\x90\xc8\xee\x00\xFB\x01\x00\x12\x07\x00\x07\x09\x00\x00\x38\xd9\x87"
-                                   "\x66\x4c\x99\x32\xee\xFB\x02\x00\x12\x07\x00\x07\x09\x00\x00\x3c\xc9\x97\x26\x4c"
-                                   "\x99\x32\xee\xFB\x03\x00\x17\x0b\x00\x0b\x09\x00\x00\x33\x8d\x91\x90\x77\x66\x4c"
-                                   "\xc9\x99\x33\x26\xee\xe0\xFB\x04\x00\x17\x0b\x00\x0b\x09\x00\x00\x33\xcd\x99\x93"
-                                   "\x77\x66\x4c\xc9\x99\x33\x26\xee\xe0";
+static constexpr Character bailleul_bold_8_pt_characters[233] = {
+    {0x0000, 0, 5, 8, 4, 8, 0, 0},
+    {0x0020, 4, 3, 0, 0, 0, 0, 0},
+    {0x0021, 4, 3, 0, 2, 9, 1, 0},
+    {0x0022, 7, 5, 0, 3, 4, 1, 5},
+    {0x0023, 9, 6, 0, 6, 9, 0, 0},
+    {0x0024, 16, 6, 0, 6, 11, 0, -1},
+    {0x0025, 25, 11, 0, 9, 9, 1, 0},
+    {0x0026, 36, 9, 0, 9, 9, 0, 0},
+    {0x0027, 47, 2, 0, 1, 4, 1, 5},
+    {0x0028, 48, 5, 0, 4, 11, 1, -3},
+    {0x0029, 54, 5, 0, 4, 11, 0, -3},
+    {0x002A, 60, 4, 0, 4, 4, 0, 5},
+    {0x002B, 62, 7, 0, 5, 6, 1, 0},
+    {0x002C, 66, 3, 0, 2, 4, 1, -2},
+    {0x002D, 67, 4, 0, 4, 1, 0, 2},
+    {0x002E, 68, 3, 0, 1, 2, 1, 0},
+    {0x002F, 69, 4, 0, 4, 9, 0, 0},
+    {0x0030, 74, 6, 0, 6, 9, 0, 0},
+    {0x0031, 81, 6, 0, 4, 9, 1, 0},
+    {0x0032, 86, 6, 0, 6, 9, 0, 0},
+    {0x0033, 93, 6, 0, 6, 9, 0, 0},
+    {0x0034, 100, 6, 0, 6, 9, 0, 0},
+    {0x0035, 107, 6, 0, 5, 10, 0, 0},
+    {0x0036, 114, 6, 0, 5, 9, 1, 0},
+    {0x0037, 120, 6, 0, 5, 9, 1, 0},
+    {0x0038, 126, 6, 0, 6, 9, 0, 0},
+    {0x0039, 133, 6, 0, 6, 9, 0, 0},
+    {0x003A, 140, 3, 0, 1, 6, 1, 0},
+    {0x003B, 141, 3, 0, 2, 8, 1, -2},
+    {0x003C, 143, 7, 0, 5, 6, 1, 0},
+    {0x003D, 147, 7, 0, 5, 4, 1, 1},
+    {0x003E, 150, 7, 0, 5, 6, 1, 0},
+    {0x003F, 154, 5, 0, 4, 9, 1, 0},
+    {0x0040, 159, 9, 0, 8, 9, 0, 0},
+    {0x0041, 168, 8, 0, 8, 9, 0, 0},
+    {0x0042, 177, 8, 0, 7, 9, 0, 0},
+    {0x0043, 185, 8, 0, 7, 9, 1, 0},
+    {0x0044, 193, 10, 0, 9, 9, 0, 0},
+    {0x0045, 204, 8, 0, 7, 9, 0, 0},
+    {0x0046, 212, 7, 0, 7, 9, 0, 0},
+    {0x0047, 220, 9, 0, 8, 9, 1, 0},
+    {0x0048, 229, 9, 0, 9, 9, 0, 0},
+    {0x0049, 240, 4, 0, 4, 9, 0, 0},
+    {0x004A, 245, 6, 0, 5, 9, 0, 0},
+    {0x004B, 251, 9, 0, 9, 9, 0, 0},
+    {0x004C, 262, 8, 0, 8, 9, 0, 0},
+    {0x004D, 271, 11, 0, 11, 9, 0, 0},
+    {0x004E, 284, 9, 0, 9, 9, 0, 0},
+    {0x004F, 295, 10, 0, 8, 9, 1, 0},
+    {0x0050, 304, 8, 0, 8, 9, 0, 0},
+    {0x0051, 313, 10, 0, 8, 12, 1, -3},
+    {0x0052, 325, 8, 0, 8, 9, 0, 0},
+    {0x0053, 334, 7, 0, 6, 9, 0, 0},
+    {0x0054, 341, 8, 0, 8, 9, 0, 0},
+    {0x0055, 350, 9, 0, 9, 9, 0, 0},
+    {0x0056, 361, 8, 0, 8, 9, 0, 0},
+    {0x0057, 370, 12, 0, 12, 9, 0, 0},
+    {0x0058, 384, 8, 0, 8, 9, 0, 0},
+    {0x0059, 393, 8, 0, 8, 9, 0, 0},
+    {0x005A, 402, 7, 0, 7, 9, 0, 0},
+    {0x005B, 410, 4, 0, 3, 12, 1, -3},
+    {0x005C, 415, 4, 0, 4, 9, 0, 0},
+    {0x005D, 420, 4, 0, 3, 12, 0, -3},
+    {0x005E, 425, 6, 0, 5, 5, 1, 4},
+    {0x005F, 429, 6, 0, 6, 1, 0, -2},
+    {0x0060, 430, 3, 0, 3, 2, -1, 7},
+    {0x0061, 431, 7, 0, 6, 6, 0, 0},
+    {0x0062, 436, 7, 0, 6, 9, 0, 0},
+    {0x0063, 443, 6, 0, 6, 6, 0, 0},
+    {0x0064, 448, 7, 0, 7, 9, 0, 0},
+    {0x0065, 456, 6, 0, 6, 6, 0, 0},
+    {0x0066, 461, 4, 0, 5, 9, 0, 0},
+    {0x0067, 467, 7, 0, 7, 9, 0, -3},
+    {0x0068, 475, 7, 0, 7, 9, 0, 0},
+    {0x0069, 483, 4, 0, 3, 9, 0, 0},
+    {0x006A, 487, 4, 0, 3, 12, 0, -3},
+    {0x006B, 492, 7, 0, 7, 9, 0, 0},
+    {0x006C, 500, 4, 0, 3, 9, 0, 0},
+    {0x006D, 504, 11, 0, 11, 6, 0, 0},
+    {0x006E, 513, 7, 0, 7, 6, 0, 0},
+    {0x006F, 519, 7, 0, 6, 6, 0, 0},
+    {0x0070, 524, 7, 0, 7, 9, 0, -3},
+    {0x0071, 532, 7, 0, 7, 9, 0, -3},
+    {0x0072, 540, 5, 0, 5, 6, 0, 0},
+    {0x0073, 544, 5, 0, 5, 6, 0, 0},
+    {0x0074, 548, 4, 0, 4, 8, 0, 0},
+    {0x0075, 552, 7, 0, 7, 6, 0, 0},
+    {0x0076, 558, 6, 0, 6, 6, 0, 0},
+    {0x0077, 563, 10, 0, 10, 6, 0, 0},
+    {0x0078, 571, 7, 0, 7, 6, 0, 0},
+    {0x0079, 577, 6, 0, 6, 9, 0, -3},
+    {0x007A, 584, 6, 0, 5, 6, 0, 0},
+    {0x007B, 588, 4, 0, 3, 11, 1, -2},
+    {0x007C, 593, 2, 0, 1, 12, 1, -3},
+    {0x007D, 595, 4, 0, 3, 11, 1, -2},
+    {0x007E, 600, 6, 0, 5, 2, 1, 2},
+    {0x00A1, 602, 3, 0, 2, 9, 1, -3},
+    {0x00A2, 605, 6, 0, 6, 9, 0, -1},
+    {0x00A3, 612, 6, 0, 6, 9, 0, 0},
+    {0x00A4, 619, 6, 0, 6, 6, 0, 1},
+    {0x00A5, 624, 6, 0, 7, 9, 0, 0},
+    {0x00A6, 632, 2, 0, 1, 9, 1, -1},
+    {0x00A7, 634, 6, 0, 5, 12, 1, -3},
+    {0x00A8, 642, 3, 0, 3, 2, 0, 7},
+    {0x00A9, 643, 9, 0, 8, 9, 0, 0},
+    {0x00AA, 652, 4, 0, 4, 4, 0, 4},
+    {0x00AB, 654, 5, 0, 4, 3, 0, 1},
+    {0x00AC, 656, 7, 0, 5, 4, 1, 1},
+    {0x00AD, 659, 4, 0, 2, 1, 1, 2},
+    {0x00AE, 660, 5, 0, 4, 5, 1, 4},
+    {0x00AF, 663, 3, 0, 3, 1, 0, 7},
+    {0x00B0, 664, 4, 0, 3, 4, 1, 5},
+    {0x00B1, 666, 7, 0, 5, 6, 1, 0},
+    {0x00B2, 670, 4, 0, 4, 5, 0, 5},
+    {0x00B3, 673, 5, 0, 4, 5, 0, 5},
+    {0x00B4, 676, 3, 0, 3, 2, 1, 7},
+    {0x00B5, 677, 7, 0, 7, 9, 0, -3},
+    {0x00B6, 685, 7, 0, 6, 11, 0, -2},
+    {0x00B7, 694, 3, 0, 1, 2, 1, 2},
+    {0x00B8, 695, 3, 0, 3, 3, 0, -3},
+    {0x00B9, 697, 4, 0, 3, 5, 1, 5},
+    {0x00BA, 699, 4, 0, 4, 4, 0, 4},
+    {0x00BB, 701, 5, 0, 4, 3, 0, 1},
+    {0x00BC, 703, 9, 0, 9, 9, 0, 0},
+    {0x00BD, 714, 9, 0, 9, 9, 0, 0},
+    {0x00BE, 725, 9, 0, 9, 9, 0, 0},
+    {0x00BF, 736, 5, 0, 5, 9, 0, -3},
+    {0x00C0, 742, 8, 0, 8, 11, 0, 0},
+    {0x00C1, 753, 8, 0, 8, 11, 0, 0},
+    {0x00C2, 764, 8, 0, 8, 11, 0, 0},
+    {0x00C3, 775, 8, 0, 8, 11, 0, 0},
+    {0x00C4, 786, 8, 0, 8, 11, 0, 0},
+    {0x00C5, 797, 8, 0, 8, 11, 0, 0},
+    {0x00C6, 808, 12, 0, 11, 9, 0, 0},
+    {0x00C7, 821, 8, 0, 7, 12, 1, -3},
+    {0x00C8, 832, 8, 0, 7, 11, 0, 0},
+    {0x00C9, 842, 8, 0, 7, 11, 0, 0},
+    {0x00CA, 852, 8, 0, 7, 11, 0, 0},
+    {0x00CB, 862, 8, 0, 7, 11, 0, 0},
+    {0x00CC, 872, 4, 0, 4, 11, 0, 0},
+    {0x00CD, 878, 4, 0, 4, 11, 0, 0},
+    {0x00CE, 884, 4, 0, 4, 11, 0, 0},
+    {0x00CF, 890, 4, 0, 4, 11, 0, 0},
+    {0x00D0, 896, 10, 0, 9, 9, 0, 0},
+    {0x00D1, 907, 9, 0, 9, 11, 0, 0},
+    {0x00D2, 920, 10, 0, 8, 11, 1, 0},
+    {0x00D3, 931, 10, 0, 8, 11, 1, 0},
+    {0x00D4, 942, 10, 0, 8, 11, 1, 0},
+    {0x00D5, 953, 10, 0, 8, 11, 1, 0},
+    {0x00D6, 964, 10, 0, 8, 11, 1, 0},
+    {0x00D7, 975, 7, 0, 5, 5, 1, 0},
+    {0x00D8, 979, 10, 0, 8, 9, 1, 0},
+    {0x00D9, 988, 9, 0, 9, 11, 0, 0},
+    {0x00DA, 1001, 9, 0, 9, 11, 0, 0},
+    {0x00DB, 1014, 9, 0, 9, 11, 0, 0},
+    {0x00DC, 1027, 9, 0, 9, 11, 0, 0},
+    {0x00DD, 1040, 8, 0, 8, 11, 0, 0},
+    {0x00DE, 1051, 8, 0, 8, 9, 0, 0},
+    {0x00DF, 1060, 7, 0, 6, 9, 0, 0},
+    {0x00E0, 1067, 7, 0, 6, 9, 0, 0},
+    {0x00E1, 1074, 7, 0, 6, 9, 0, 0},
+    {0x00E2, 1081, 7, 0, 6, 9, 0, 0},
+    {0x00E3, 1088, 7, 0, 6, 9, 0, 0},
+    {0x00E4, 1095, 7, 0, 6, 9, 0, 0},
+    {0x00E5, 1102, 7, 0, 6, 9, 0, 0},
+    {0x00E6, 1109, 10, 0, 9, 6, 0, 0},
+    {0x00E7, 1116, 6, 0, 6, 9, 0, -3},
+    {0x00E8, 1123, 6, 0, 6, 9, 0, 0},
+    {0x00E9, 1130, 6, 0, 6, 9, 0, 0},
+    {0x00EA, 1137, 6, 0, 6, 9, 0, 0},
+    {0x00EB, 1144, 6, 0, 6, 9, 0, 0},
+    {0x00EC, 1151, 4, 0, 3, 9, 0, 0},
+    {0x00ED, 1155, 4, 0, 4, 9, 0, 0},
+    {0x00EE, 1160, 4, 0, 4, 9, 0, 0},
+    {0x00EF, 1165, 4, 0, 4, 9, 0, 0},
+    {0x00F0, 1170, 7, 0, 6, 9, 0, 0},
+    {0x00F1, 1177, 7, 0, 7, 9, 0, 0},
+    {0x00F2, 1185, 7, 0, 6, 9, 0, 0},
+    {0x00F3, 1192, 7, 0, 6, 9, 0, 0},
+    {0x00F4, 1199, 7, 0, 6, 9, 0, 0},
+    {0x00F5, 1206, 7, 0, 6, 9, 0, 0},
+    {0x00F6, 1213, 7, 0, 6, 9, 0, 0},
+    {0x00F7, 1220, 7, 0, 5, 7, 1, 0},
+    {0x00F8, 1225, 7, 0, 6, 6, 0, 0},
+    {0x00F9, 1230, 7, 0, 7, 9, 0, 0},
+    {0x00FA, 1238, 7, 0, 7, 9, 0, 0},
+    {0x00FB, 1246, 7, 0, 7, 9, 0, 0},
+    {0x00FC, 1254, 7, 0, 7, 9, 0, 0},
+    {0x00FD, 1262, 6, 0, 6, 12, 0, -3},
+    {0x00FE, 1271, 7, 0, 7, 12, 0, -3},
+    {0x00FF, 1282, 6, 0, 6, 12, 0, -3},
+    {0x0131, 1291, 4, 0, 3, 6, 0, 0},
+    {0x0141, 1294, 8, 0, 8, 9, 0, 0},
+    {0x0142, 1303, 4, 0, 3, 9, 0, 0},
+    {0x0152, 1307, 13, 0, 11, 9, 1, 0},
+    {0x0153, 1320, 10, 0, 10, 6, 0, 0},
+    {0x0160, 1328, 7, 0, 6, 11, 0, 0},
+    {0x0161, 1337, 5, 0, 5, 9, 0, 0},
+    {0x0178, 1343, 8, 0, 8, 11, 0, 0},
+    {0x017D, 1354, 7, 0, 7, 11, 0, 0},
+    {0x017E, 1364, 6, 0, 5, 9, 0, 0},
+    {0x0192, 1370, 6, 0, 6, 12, 0, -3},
+    {0x02C6, 1379, 3, 0, 3, 2, 0, 7},
+    {0x02C7, 1380, 3, 0, 3, 2, 0, 7},
+    {0x02D8, 1381, 3, 0, 3, 2, 0, 7},
+    {0x02D9, 1382, 3, 0, 1, 2, 1, 7},
+    {0x02DA, 1383, 3, 0, 3, 3, 0, 6},
+    {0x02DB, 1385, 3, 0, 3, 3, 0, -3},
+    {0x02DC, 1387, 3, 0, 4, 2, 0, 7},
+    {0x02DD, 1388, 3, 0, 5, 2, 0, 7},
+    {0x2013, 1390, 6, 0, 6, 1, 0, 2},
+    {0x2014, 1391, 11, 0, 9, 1, 1, 2},
+    {0x2018, 1393, 2, 0, 2, 4, 0, 5},
+    {0x2019, 1394, 2, 0, 2, 4, 0, 5},
+    {0x201A, 1395, 2, 0, 2, 4, 0, -2},
+    {0x201C, 1396, 5, 0, 5, 4, 0, 5},
+    {0x201D, 1399, 5, 0, 5, 4, 0, 5},
+    {0x201E, 1402, 5, 0, 5, 4, 0, -2},
+    {0x2020, 1405, 6, 0, 5, 11, 1, -2},
+    {0x2021, 1412, 6, 0, 5, 11, 1, -2},
+    {0x2022, 1419, 6, 0, 4, 5, 1, 2},
+    {0x2026, 1422, 11, 0, 9, 2, 1, 0},
+    {0x2030, 1425, 11, 0, 11, 9, 0, 0},
+    {0x2039, 1438, 3, 0, 3, 3, 0, 1},
+    {0x203A, 1440, 3, 0, 3, 3, 0, 1},
+    {0x2044, 1442, 2, 0, 6, 9, -2, 0},
+    {0x2122, 1449, 11, 0, 11, 5, 0, 3},
+    {0x2212, 1456, 7, 0, 5, 1, 1, 2},
+    {0xFB00, 1457, 8, 0, 9, 9, 0, 0},
+    {0xFB01, 1468, 7, 0, 7, 9, 0, 0},
+    {0xFB02, 1476, 7, 0, 7, 9, 0, 0},
+    {0xFB03, 1484, 11, 0, 11, 9, 0, 0},
+    {0xFB04, 1497, 11, 0, 11, 9, 0, 0},
+};
+
+static constexpr uint8_t bailleul_bold_8_pt_bitmaps[1511] = "\xf9\x99\x99\x9f\xaa\xa2\xc0\xb6\xd0\x28\xa2\x9f"
+                                                            "\x29\x2f\x94\x50\x11\xe5\xb5\x71\xe1\xe5\x97\xe1"
+                                                            "\x00\x62\x49\x25\x12\x86\x80\x98\x52\x49\x23\x00"
+                                                            "\x1c\x1a\x0d\x03\x73\xa2\x73\x33\x8d\x7f\x00\xf0"
+                                                            "\x12\x4c\xcc\xcc\x42\x10\x84\x23\x33\x33\x24\x80"
+                                                            "\x2f\x65\x21\x3e\x42\x10\xb6\xf0\xc0\x11\x22\x24"
+                                                            "\x44\x80\x31\x24\xb3\xcf\x34\x92\x30\x26\xe6\x66"
+                                                            "\x66\xf0\x7a\x34\xd2\x08\x42\x11\xf8\x71\x20\x86"
+                                                            "\x30\x20\xf3\x78\x18\x63\x8e\x59\x7f\xc7\x18\x0b"
+                                                            "\xdc\x87\x2c\x21\x8b\x80\x74\xa1\xe9\x4e\x72\x70"
+                                                            "\xfc\xa4\x22\x11\x8c\x60\x39\x24\x9e\x39\x3c\xd2"
+                                                            "\x78\x71\x2c\xb3\x4c\xf0\x92\x70\xcc\xa0\xb6\x09"
+                                                            "\xf9\x87\x04\xf8\x01\xf0\x86\x0e\x36\x40\xeb\x13"
+                                                            "\x24\x04\x40\x1e\x61\x4f\xd3\xd5\xd5\x5e\x61\x1e"
+                                                            "\x08\x18\x18\x18\x2c\x2c\x3c\x46\xef\xfc\xcd\x9b"
+                                                            "\x37\xcc\xd8\xb3\xfe\x3c\x87\x0e\x0c\x18\x30\xa1"
+                                                            "\x3c\xfe\x31\x98\x6c\x36\x1b\x0d\x86\xc6\xfe\x00"
+                                                            "\xfe\xc5\x9b\x47\x8c\x99\xb1\xfe\xfe\xc5\x9b\x27"
+                                                            "\x8c\x99\x30\xf0\x3e\x42\xc2\xc0\xc7\xc2\xc2\x42"
+                                                            "\x3c\xf7\xb1\x98\xcc\x67\xf3\x19\x8c\xc6\xf7\x80"
+                                                            "\xf6\x66\x66\x66\xf0\x38\x84\x21\x08\x52\xf0\xf7"
+                                                            "\x32\x19\x0d\x07\xc3\x61\x98\xcc\xf7\x80\xf0\x60"
+                                                            "\x60\x60\x60\x60\x61\x61\xff\xe0\xee\x39\xc7\x39"
+                                                            "\x65\xac\xb9\x93\x32\x46\xe9\xe0\xf3\xb8\x96\x49"
+                                                            "\xa4\xd2\x39\x0c\x86\xe1\x00\x3c\x42\xc3\xc3\xc3"
+                                                            "\xc3\xc3\x42\x3c\xfe\x63\x63\x62\x7c\x60\x60\x60"
+                                                            "\xf0\x3c\x46\xc2\xc3\xc3\xc3\xc3\xc2\x44\x38\x2d"
+                                                            "\x47\xfc\x66\x66\x64\x78\x66\x66\x66\xf3\x39\x14"
+                                                            "\x5c\x78\x78\x61\x78\xff\x99\x99\x18\x18\x18\x18"
+                                                            "\x18\x3c\xf3\xb0\x98\x4c\x26\x13\x09\x84\xc2\x3e"
+                                                            "\x00\xf7\x62\x24\x34\x34\x18\x18\x18\x10\xf7\xb6"
+                                                            "\x31\x25\xa3\x5a\x35\xa3\x8c\x18\xc1\x0c\x10\x80"
+                                                            "\xf6\x74\x38\x18\x18\x1c\x2c\x26\xef\xf7\x32\x34"
+                                                            "\x18\x18\x18\x18\x18\x3c\x7e\x9a\x30\xc1\x86\x0c"
+                                                            "\xb1\xfe\xfb\x6d\xb6\xdb\x70\x84\x44\x22\x21\x10"
+                                                            "\xe4\x92\x49\x24\xf0\x23\x19\x29\x80\xfc\xc4\x79"
+                                                            "\x33\xd3\xcd\xf0\xc1\x04\x1e\x45\x14\x51\x78\x39"
+                                                            "\x24\x30\x44\xe0\x0c\x08\x13\xa4\xc8\xb1\x26\x7e"
+                                                            "\x39\x37\xf0\x44\xe0\x3b\x59\xc6\x31\x8c\xe0\x3e"
+                                                            "\x91\x23\x84\x0f\x91\x42\x78\xe0\xc1\x83\xe6\x4c"
+                                                            "\x99\x32\xee\x6c\x76\xdb\xe0\x6c\x76\xdb\x6d\x60"
+                                                            "\xe0\xc1\x83\x66\x8d\x1e\x36\xee\xed\xb6\xdb\xe0"
+                                                            "\xff\xcc\x99\x93\x32\x66\x4d\xdd\xc0\xfc\xc9\x93"
+                                                            "\x26\x5d\xc0\x39\x34\xf3\x4c\xe0\xfc\xc9\x9b\x36"
+                                                            "\x4f\x98\x30\xe0\x74\x99\x16\x24\xcf\x81\x02\x0e"
+                                                            "\xfb\x58\xc6\x70\x72\x9c\x79\xf8\x26\xf6\x66\x67"
+                                                            "\xec\xc9\x93\x26\x4f\xc0\xed\xa2\x8c\x30\x40\xee"
+                                                            "\xdb\xa2\xe8\xcc\x33\x08\x80\xfc\x50\xc0\xc3\x9b"
+                                                            "\xc0\xed\xa2\x8c\x30\x41\x38\xe0\x7c\x8c\x46\xfc"
+                                                            "\x7b\x6d\x36\xdb\x80\xff\xf0\xc9\x24\xd2\x4b\x00"
+                                                            "\xcd\x80\xe2\xaa\x80\x10\x42\x96\x53\x45\x4a\x10"
+                                                            "\x38\xa6\x18\xf8\x82\x49\xf8\xfd\x2c\x71\x4f\xf0"
+                                                            "\xee\xc9\xa1\x43\x0f\x1e\x18\x78\xe3\x80\x74\xa5"
+                                                            "\x8e\x79\x4d\x1c\xa5\xc0\xb4\x1c\x62\x4d\xb3\xa1"
+                                                            "\xb3\x4d\x62\x1c\x69\xf5\x7f\x70\xf8\x42\x10\xc0"
+                                                            "\x6d\xde\x40\xe0\xd6\xe0\x21\x3e\x40\x7c\xfd\x24"
+                                                            "\xf0\x71\x61\xf0\x70\xec\xc9\x93\x26\x4f\xd0\x20"
+                                                            "\x40\x7f\xae\xba\x68\x61\x86\x19\x62\x00\xc0\x47"
+                                                            "\x00\x59\x2e\x6d\xd6\xf7\xe0\x22\x71\x19\x0c\x86"
+                                                            "\x93\x98\x56\x4f\x21\x00\x22\x31\x39\x0c\x86\xb3"
+                                                            "\x74\x44\x45\x27\x00\x62\x51\x19\x02\x89\x93\x98"
+                                                            "\x56\x4f\x21\x00\x31\x80\x46\x63\x1b\x70\x30\x10"
+                                                            "\x08\x18\x18\x18\x2c\x2c\x3c\x46\xef\x04\x18\x08"
+                                                            "\x18\x18\x18\x2c\x2c\x3c\x46\xef\x18\x24\x08\x18"
+                                                            "\x18\x18\x2c\x2c\x3c\x46\xef\x14\x2c\x08\x18\x18"
+                                                            "\x18\x2c\x2c\x3c\x46\xef\x24\x3c\x08\x18\x18\x18"
+                                                            "\x2c\x2c\x3c\x46\xef\x18\x18\x18\x18\x18\x18\x2c"
+                                                            "\x2c\x3c\x46\xef\x0f\xe1\xc4\x5a\x8b\x42\x78\x7d"
+                                                            "\x09\x8a\x31\xcf\xe0\x3c\x87\x0e\x0c\x18\x30\xa1"
+                                                            "\x2c\x20\x20\xc0\x30\x23\xbb\x16\x6d\x1e\x32\x66"
+                                                            "\xc7\xf8\x0c\x13\xdb\x16\x6d\x1e\x32\x66\xc7\xf8"
+                                                            "\x18\x4b\xfb\x16\x6d\x1e\x32\x66\xc7\xf8\x24\x7b"
+                                                            "\xdb\x16\x6d\x1e\x32\x66\xc7\xf8\x42\xf6\x66\x66"
+                                                            "\x66\xf0\x12\xf6\x66\x66\x66\xf0\x65\xe6\x66\x66"
+                                                            "\x66\xf0\x5d\x66\x66\x66\x66\xf0\xfe\x31\x98\x6c"
+                                                            "\x3f\x9b\x0d\x86\xc6\xfe\x00\x1a\x16\x3c\xee\x25"
+                                                            "\x92\x69\x34\x8e\x43\x21\xb8\x40\x30\x10\x2c\x42"
+                                                            "\xc3\xc3\xc3\xc3\xc3\x42\x3c\x04\x08\x34\x42\xc3"
+                                                            "\xc3\xc3\xc3\xc3\x42\x3c\x18\x28\x34\x42\xc3\xc3"
+                                                            "\xc3\xc3\xc3\x42\x3c\x34\x28\x34\x42\xc3\xc3\xc3"
+                                                            "\xc3\xc3\x42\x3c\x28\x2c\x34\x42\xc3\xc3\xc3\xc3"
+                                                            "\xc3\x42\x3c\x9b\x99\xa8\x80\x3d\x46\xc7\xcb\xd3"
+                                                            "\xe3\xc3\x42\xbc\x10\x04\x3c\xec\x26\x13\x09\x84"
+                                                            "\xc2\x61\x30\x8f\x80\x04\x04\x3c\xec\x26\x13\x09"
+                                                            "\x84\xc2\x61\x30\x8f\x80\x08\x0a\x38\xec\x26\x13"
+                                                            "\x09\x84\xc2\x61\x30\x8f\x80\x14\x0a\x38\xec\x26"
+                                                            "\x13\x09\x84\xc2\x61\x30\x8f\x80\x04\x08\xf7\x32"
+                                                            "\x34\x18\x18\x18\x18\x18\x3c\xf0\x60\x7c\x62\x63"
+                                                            "\x62\x7c\x60\xf0\x3d\xb6\xde\x65\x96\x5d\xfc\x20"
+                                                            "\x40\x1e\x4c\xf4\xf3\x7c\x08\x40\x1e\x4c\xf4\xf3"
+                                                            "\x7c\x31\xa0\x1e\x4c\xf4\xf3\x7c\x29\x60\x1e\x4c"
+                                                            "\xf4\xf3\x7c\x29\xa0\x1e\x4c\xf4\xf3\x7c\x10\xa1"
+                                                            "\x1a\x4c\xf4\xf3\x7c\x7f\x24\xcf\xe9\x0c\xcb\xb8"
+                                                            "\x39\x24\x30\x44\xa1\x06\x30\x20\x40\x0e\x4d\xfc"
+                                                            "\x11\x38\x08\x40\x0e\x4d\xfc\x11\x38\x31\xa0\x0e"
+                                                            "\x4d\xfc\x11\x38\x69\xa0\x0e\x4d\xfc\x11\x38\x8c"
+                                                            "\x76\xdb\xe0\x34\x0e\x66\x66\xe0\x6b\x0e\x66\x66"
+                                                            "\xe0\xbb\x0e\x66\x66\xe0\x68\xc4\x8f\x4f\x34\xd3"
+                                                            "\x38\x34\xb0\x07\xe6\x4c\x99\x32\xee\x20\x40\x0e"
+                                                            "\x4d\x3c\xd3\x38\x08\x40\x0e\x4d\x3c\xd3\x38\x10"
+                                                            "\xa0\x0e\x4d\x3c\xd3\x38\x35\x60\x0e\x4d\x3c\xd3"
+                                                            "\x38\x29\xa0\x0e\x4d\x3c\xd3\x38\x23\x01\xf0\x11"
+                                                            "\x80\x3d\x35\xfb\x4e\xe0\x20\x20\x07\x66\x4c\x99"
+                                                            "\x32\x7e\x08\x20\x07\x66\x4c\x99\x32\x7e\x10\x50"
+                                                            "\x07\x66\x4c\x99\x32\x7e\x28\x50\x07\x66\x4c\x99"
+                                                            "\x32\x7e\x08\x40\x3b\x68\xa3\x0c\x10\x4e\x38\xe0"
+                                                            "\xc1\x83\xe6\x4c\xd9\xb2\x7c\xc1\x87\x00\x69\xa0"
+                                                            "\x3b\x68\xa3\x0c\x10\x4e\x38\xed\xb7\xc0\xf0\x60"
+                                                            "\x68\x70\x60\xe0\xe1\x61\xff\xed\xb7\xdb\xe0\x3f"
+                                                            "\xe8\xc7\x1a\xe3\x4c\x79\x8d\x31\xaa\x31\x3f\xe0"
+                                                            "\x3f\x93\x24\xff\x30\x4c\x4f\xe0\x68\xc2\x91\x45"
+                                                            "\xc7\x87\x86\x17\x80\x51\x00\xe5\x38\xf3\xf0\x14"
+                                                            "\x34\xe3\x32\x34\x18\x18\x18\x18\x18\x3c\x2c\x31"
+                                                            "\x9a\x68\xc3\x06\x18\x32\xc7\xf8\x59\x80\xf9\x18"
+                                                            "\x8d\xf8\x0c\x51\x4c\x31\xe3\x0c\x20\x8a\x30\x54"
+                                                            "\xa8\xbc\xc0\x55\x00\x57\x00\xde\x7d\x80\xfc\xff"
+                                                            "\x80\x6f\xf7\xf7\x4c\xb6\xb0\xda\xd2\xa0\x5e\xd2"
+                                                            "\xa0\x63\x09\xfb\x10\x8c\x63\x08\x63\x09\xfb\x12"
+                                                            "\xdf\x23\x08\x4e\xff\x60\xc9\xe4\xc0\x64\x14\x82"
+                                                            "\xe0\x54\x05\x00\x29\x8a\xaa\x5d\x4e\xe0\x79\x80"
+                                                            "\xcf\x00\x04\x21\x04\x20\x84\x10\x80\xf6\x75\xc8"
+                                                            "\x9b\x12\xa6\x56\xf8\x37\xb6\xd9\x1d\xc6\x43\x21"
+                                                            "\x90\xc8\xee\x00\x38\xd9\x87\x66\x4c\x99\x32\xee"
+                                                            "\x3c\xc9\x97\x26\x4c\x99\x32\xee\x33\x8d\x91\x90"
+                                                            "\x77\x66\x4c\xc9\x99\x33\x26\xee\xe0\x33\xcd\x99"
+                                                            "\x93\x77\x66\x4c\xc9\x99\x33\x26\xee\xe0";
+
+constexpr Font bailleul_bold_8_pt = {
+    .size = 8,
+    .numCharacters = 232,
+    .boundingBoxWidth = 14,
+    .boundingBoxHeight = 14,
+    .boundingBoxXOffset = -2,
+    .boundingBoxYOffset = -3,
+    .ascent = 10,
+    .descent = 2,
+    .asciiIndex = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                   28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+                   53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+                   78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95},
+    .characters = bailleul_bold_8_pt_characters,
+    .bitmaps = bailleul_bold_8_pt_bitmaps,
+};
 
 // bailleul_bold
 //   - Copyright (c) 2019 Yomli  Copyright (c) 1850 Bailleul et Cie  Copyright (c) 1800 Justus Erich Walbaum"
 //   - Size: 12
 //   - Characters: 232
-uint8_t bailleul_bold_12_pt[5584] = "\x0c\x00\xe8\x16\x16\xfd\xfc\x10\x04\x00\x00\x00\x13\x07\x0c\x06\x0c\x00\x00\xfe"
-                                    "\x18\x61\x86\x18\x61\x86\x18\x7f\x00\x20\x00\x0a\x05\x00\x00\x00\x00\x00\x00\x21"
-                                    "\x00\x0f\x05\x00\x03\x0d\x01\x00\x7f\xf4\x92\x41\x7e\x00\x22\x00\x0e\x08\x00\x05"
-                                    "\x06\x02\x07\x94\xe5\x29\x48\x00\x23\x00\x19\x09\x00\x09\x0d\x00\x00\x1b\x09\x84"
-                                    "\xc2\x67\xfb\x90\xc8\x64\xff\x73\x09\x84\x82\x40\x00\x24\x00\x1c\x09\x00\x09\x10"
-                                    "\x00\xff\x08\x04\x0f\x8d\x64\x93\x49\xe0\xfc\x3f\x07\xc2\xf1\x34\x9a\x49\xf8\x10"
-                                    "\x00\x25\x00\x20\x11\x00\x0d\x0d\x02\x00\x70\x66\xc2\x22\x21\x11\x08\x90\x6c\x81"
-                                    "\xc8\x00\x4e\x04\xd8\x44\x42\x22\x21\x33\x07\x00\x00\x26\x00\x1e\x0e\x00\x0c\x0d"
-                                    "\x01\x00\x0f\x01\x90\x39\x01\xa0\x1c\xf3\xc4\x4e\x4c\xe4\xc7\x9c\x79\xe3\x9e\x3d"
-                                    "\x7d\xe0\x00\x27\x00\x0c\x04\x00\x02\x06\x01\x07\xff\xa0\x00\x28\x00\x14\x08\x00"
-                                    "\x05\x10\x02\xfc\x08\x88\xcc\x63\x18\xc6\x31\x86\x30\xc1\x00\x29\x00\x16\x08\x00"
-                                    "\x06\x10\x00\xfc\xc0\x83\x06\x18\x71\xc3\x0c\x71\xc6\x18\xc2\x30\x00\x2A\x00\x0e"
-                                    "\x07\x00\x05\x06\x01\x07\x65\x7e\x4d\xa8\x00\x2B\x00\x13\x0a\x00\x08\x09\x01\x00"
-                                    "\x18\x18\x18\xff\xff\x18\x18\x18\x18\x00\x2C\x00\x0d\x05\x00\x03\x06\x01\xfd\xdf"
-                                    "\x95\x00\x00\x2D\x00\x0c\x07\x00\x05\x02\x01\x03\xff\xc0\x00\x2E\x00\x0c\x05\x00"
-                                    "\x03\x03\x01\x00\xdf\x00\x00\x2F\x00\x16\x07\x00\x07\x0d\x00\x00\x06\x18\x30\xc1"
-                                    "\x83\x0c\x18\x20\xc1\x82\x0c\x00\x00\x30\x00\x17\x09\x00\x08\x0d\x01\x00\x38\x64"
-                                    "\xc6\xc6\xc7\xc7\xc7\xc7\xc7\xc6\xc6\x64\x38\x00\x31\x00\x14\x09\x00\x06\x0d\x02"
-                                    "\x00\x10\xc7\x2c\x30\xc3\x0c\x30\xc3\x0c\xfc\x00\x32\x00\x19\x0a\x00\x09\x0d\x00"
-                                    "\x00\x3e\x21\x90\xec\x77\x39\x18\x0c\x08\x08\x08\x48\x2f\xef\xf0\x00\x33\x00\x19"
-                                    "\x0a\x00\x09\x0d\x00\x00\x3e\x33\x98\xc0\x60\x70\x30\xf0\x06\x03\x81\xf8\xe8\x63"
-                                    "\xe0\x00\x34\x00\x19\x09\x00\x09\x0d\x00\x00\x06\x03\x03\x81\xc1\x61\x30\x98\x8d"
-                                    "\xff\x83\x41\xa0\xc0\x60\x00\x35\x00\x17\x09\x00\x07\x0e\x01\x00\x02\xf9\xf2\x04"
-                                    "\x10\x2f\x67\x86\x0c\x1c\x38\xef\x00\x00\x36\x00\x17\x09\x00\x08\x0d\x01\x00\x1c"
-                                    "\x62\x66\xe2\xc0\xdc\xe6\xc7\xc7\xc7\xc6\x66\x3c\x00\x37\x00\x17\x09\x00\x08\x0d"
-                                    "\x01\x00\x7f\xfe\x82\x84\x04\x0c\x08\x18\x18\x18\x38\x38\x38\x00\x38\x00\x17\x09"
-                                    "\x00\x08\x0d\x01\x00\x3c\x46\xc2\xc2\xf6\x7c\x3e\xcf\xc7\xc3\xc2\xc2\x3c\x00\x39"
-                                    "\x00\x17\x09\x00\x08\x0d\x01\x00\x38\x64\xc6\xc6\xc7\xc7\xc7\xe7\x3e\x06\xc6\xcc"
-                                    "\x78\x00\x3A\x00\x0e\x05\x00\x03\x09\x01\x00\xdf\x00\x37\xc0\x00\x3B\x00\x0f\x05"
-                                    "\x00\x03\x0c\x01\xfd\xdf\x00\x37\xe5\x40\x00\x3C\x00\x13\x0a\x00\x08\x09\x01\x00"
-                                    "\x01\x03\x1e\x78\xe0\xf0\x3c\x07\x01\x00\x3D\x00\x10\x0a\x00\x08\x06\x01\x02\xff"
-                                    "\xff\x00\x00\xff\xff\x00\x3E\x00\x13\x0a\x00\x08\x09\x01\x00\x80\xe0\x78\x1e\x03"
-                                    "\x0f\x3c\xf0\x80\x00\x3F\x00\x16\x08\x00\x07\x0d\x01\x00\x79\x9b\x38\x70\xe1\x86"
-                                    "\x10\x20\x00\xc3\x83\x00\x00\x40\x00\x1e\x0e\x00\x0c\x0d\x01\x00\x0f\x83\x8c\x60"
-                                    "\x6c\x7f\xcc\x9c\x89\x98\x99\x9b\xdb\x2c\xdc\x60\x03\x8c\x0f\x80\x00\x41\x00\x1e"
-                                    "\x0d\x00\x0c\x0d\x00\x00\x02\x00\x60\x06\x00\x70\x0f\x00\xb0\x13\x81\x38\x1f\x82"
-                                    "\x1c\x21\xc2\x0c\xf3\xf0\x00\x42\x00\x1c\x0c\x00\x0b\x0d\x01\x00\xff\x8e\x31\xc7"
-                                    "\x38\xe7\x18\xe3\x1f\xc3\x8e\x70\xce\x1d\xc3\x38\xef\xf8\x00\x43\x00\x1c\x0d\x00"
-                                    "\x0b\x0d\x01\x00\x0f\x86\x0d\xc0\xb0\x1e\x03\xc0\x38\x07\x00\xe0\x2c\x05\x80\x98"
-                                    "\x30\xfc\x00\x44\x00\x20\x0f\x00\x0d\x0d\x01\x00\xff\x83\x87\x1c\x1c\xe0\xe7\x03"
-                                    "\xb8\x1d\xc0\xee\x07\x70\x3b\x83\x9c\x1c\xe1\xcf\xf8\x00\x00\x45\x00\x1b\x0c\x00"
-                                    "\x0a\x0d\x01\x00\xff\xdc\x37\x05\xc1\x72\x1c\x87\xe1\xc8\x72\x1c\x17\x05\xc1\xff"
-                                    "\xc0\x00\x46\x00\x1c\x0b\x00\x0b\x0d\x00\x00\xff\xe7\x0c\xe0\x9c\x53\x88\x72\x0f"
-                                    "\xc1\xc8\x38\x87\x10\xe0\x1c\x0f\xc0\x00\x47\x00\x20\x0e\x00\x0d\x0d\x01\x00\x0f"
-                                    "\xc1\x81\x1c\x08\xc0\x2e\x00\x70\x03\x83\xfc\x0e\xe0\x73\x03\x98\x1c\x60\xe0\xf8"
-                                    "\x00\x00\x48\x00\x20\x0e\x00\x0d\x0d\x01\x00\xf9\xfb\x83\x1c\x18\xe0\xc7\x06\x38"
-                                    "\x31\xff\x8e\x0c\x70\x63\x83\x1c\x18\xe0\xcf\x9f\x80\x00\x49\x00\x13\x07\x00\x05"
-                                    "\x0d\x01\x00\xfb\x9c\xe7\x39\xce\x73\x9c\xef\x80\x00\x4A\x00\x17\x09\x00\x08\x0d"
-                                    "\x00\x00\x3f\x0e\x0e\x0e\x0e\x0e\x0e\x0e\x0e\x4e\xce\xcc\x78\x00\x4B\x00\x20\x0e"
-                                    "\x00\x0d\x0d\x01\x00\xf9\xe3\x84\x1c\x40\xe4\x07\x20\x3b\x01\xfc\x0e\xe0\x73\x83"
-                                    "\x9e\x1c\x70\xe1\xcf\x9f\x80\x00\x4C\x00\x1c\x0c\x00\x0b\x0d\x01\x00\xf8\x0e\x01"
-                                    "\xc0\x38\x07\x00\xe0\x1c\x03\x80\x70\x2e\x05\xc0\xb8\x3f\xfe\x00\x4D\x00\x24\x11"
-                                    "\x00\x10\x0d\x00\x00\xf8\x0f\x38\x1e\x3c\x1e\x3c\x2e\x2e\x2e\x2e\x2e\x2e\x4e\x27"
-                                    "\x4e\x27\x8e\x23\x8e\x23\x0e\x23\x0e\xf1\x3f\x00\x4E\x00\x21\x0e\x00\x0e\x0d\x00"
-                                    "\x00\xfc\x3c\xf0\x42\xe1\x0b\xc4\x27\x90\x8e\x42\x1d\x08\x7c\x20\xf0\x81\xc2\x03"
-                                    "\x08\x0c\xf8\x10\x00\x4F\x00\x20\x0f\x00\x0d\x0d\x01\x00\x0f\x81\x83\x1c\x1c\xc0"
-                                    "\x6e\x03\xf0\x1f\x80\xfc\x07\xe0\x3b\x01\x9c\x1c\x60\xc0\xf8\x00\x00\x50\x00\x1c"
-                                    "\x0c\x00\x0b\x0d\x01\x00\xff\x8e\x39\xc3\xb8\x77\x0e\xe3\x9f\xc3\x80\x70\x0e\x01"
-                                    "\xc0\x38\x0f\xc0\x00\x51\x00\x26\x0f\x00\x0d\x11\x01\xfc\x0f\x81\x83\x1c\x18\xc0"
-                                    "\xee\x03\x70\x1f\x80\xfc\x07\xe0\x3b\x01\x98\x1c\x60\xc1\x8c\x07\xc0\x7e\x22\x1f"
-                                    "\x00\x70\x00\x52\x00\x1e\x0d\x00\x0c\x0d\x01\x00\xff\x07\x18\x71\xc7\x1c\x71\x87"
-                                    "\x10\x7e\x07\x18\x71\xc7\x1c\x71\xc7\x0c\xfc\xf0\x00\x53\x00\x17\x0a\x00\x08\x0d"
-                                    "\x01\x00\x3e\x42\xc2\xc1\xf0\xfc\x7e\x1f\x07\x83\x81\xc2\x7c\x00\x54\x00\x1c\x0d"
-                                    "\x00\x0b\x0d\x01\x00\xff\xf1\xc6\x38\xc7\x10\xe0\x1c\x03\x80\x70\x0e\x01\xc0\x38"
-                                    "\x07\x03\xf0\x00\x55\x00\x20\x0e\x00\x0d\x0d\x00\x00\xfc\x79\xc0\x8e\x04\x70\x23"
-                                    "\x81\x1c\x08\xe0\x47\x02\x38\x11\xc0\x8e\x04\x70\x40\xfc\x00\x00\x56\x00\x1e\x0c"
-                                    "\x00\x0c\x0d\x00\x00\xfc\xf3\x84\x38\x43\x84\x1c\x81\xc8\x1c\x80\xf0\x0f\x00\xe0"
-                                    "\x06\x00\x60\x04\x00\x00\x57\x00\x29\x13\x00\x13\x0d\x00\x00\xfc\xfc\xe7\x0f\x08"
-                                    "\xe2\xe1\x1c\x5c\x41\x89\xc8\x39\x39\x07\x47\x40\x68\x68\x0e\x0e\x01\xc1\xc0\x18"
-                                    "\x18\x02\x03\x00\x40\x40\x00\x58\x00\x1e\x0d\x00\x0c\x0d\x00\x00\xfc\xe3\x88\x3c"
-                                    "\x81\xd0\x0e\x00\xe0\x07\x00\x70\x0b\x81\x38\x11\xc2\x1e\xf3\xf0\x00\x59\x00\x1e"
-                                    "\x0c\x00\x0c\x0d\x00\x00\xfc\xf3\x84\x1c\x41\xc8\x0e\x80\xf0\x06\x00\x60\x06\x00"
-                                    "\x60\x06\x00\x60\x1f\x80\x00\x5A\x00\x1c\x0b\x00\x0b\x0d\x00\x00\x7f\xec\x39\x07"
-                                    "\x21\xc0\x70\x0e\x03\x80\x70\x1c\x07\x04\xe0\xb8\x3f\xfe\x00\x5B\x00\x15\x07\x00"
-                                    "\x05\x11\x02\xfc\xfe\x31\x8c\x63\x18\xc6\x31\x8c\x63\x18\xf8\x00\x5C\x00\x16\x07"
-                                    "\x00\x07\x0d\x00\x00\xc0\x81\x83\x02\x06\x0c\x0c\x18\x30\x30\x60\x60\x00\x5D\x00"
-                                    "\x15\x07\x00\x05\x11\x00\xfc\xf8\xc6\x31\x8c\x63\x18\xc6\x31\x8c\x63\xf8\x00\x5E"
-                                    "\x00\x11\x09\x00\x08\x07\x01\x06\x18\x38\x38\x2c\x64\x46\xc3\x00\x5F\x00\x0c\x09"
-                                    "\x00\x09\x01\x00\xfe\xff\x80\x00\x60\x00\x0c\x05\x00\x04\x04\xff\x0a\x8c\x63\x00"
-                                    "\x61\x00\x15\x0a\x00\x09\x09\x01\x00\x7e\x63\x31\xc3\xe6\x76\x3b\x1d\x8e\x7f\x80"
-                                    "\x00\x62\x00\x1b\x0b\x00\x0a\x0d\x00\x00\xf0\x1c\x07\x01\xc0\x7f\x1c\x67\x1d\xc7"
-                                    "\x71\xdc\x77\x1d\xc6\x7f\x00\x00\x63\x00\x13\x09\x00\x08\x09\x01\x00\x3e\x66\xc6"
-                                    "\xc0\xc0\xc0\xe1\x62\x3c\x00\x64\x00\x1b\x0b\x00\x0a\x0d\x01\x00\x07\x00\xc0\x30"
-                                    "\x0c\x3b\x19\xcc\x33\x0c\xc3\x30\xcc\x31\x8c\x7f\xc0\x00\x65\x00\x13\x0a\x00\x08"
-                                    "\x09\x01\x00\x3c\x66\xc7\xff\xc0\xc0\xe1\x62\x3c\x00\x66\x00\x17\x06\x00\x08\x0d"
-                                    "\x00\x00\x1e\x37\x33\x70\xf8\x70\x70\x70\x70\x70\x70\x70\xf8\x00\x67\x00\x19\x0a"
-                                    "\x00\x09\x0d\x01\xfc\x3d\xb3\x59\x8c\xc6\x65\xc2\x01\xfe\x7f\x61\xa0\x50\x67\xc0"
-                                    "\x00\x68\x00\x1c\x0b\x00\x0b\x0d\x00\x00\xf0\x06\x00\xc0\x18\x03\x78\x73\x0c\x71"
-                                    "\x8e\x31\xc6\x38\xc7\x18\xef\xbe\x00\x69\x00\x13\x06\x00\x05\x0d\x00\x00\x31\x8c"
-                                    "\x0f\x18\xc6\x31\x8c\x6f\x80\x00\x6A\x00\x13\x06\x00\x04\x11\x00\xfc\x33\x30\xf3"
-                                    "\x33\x33\x33\x33\x37\xc0\x00\x6B\x00\x1c\x0b\x00\x0b\x0d\x00\x00\xf0\x06\x00\xc0"
-                                    "\x18\x03\x38\x64\x0c\x81\xb0\x3f\x06\xe0\xce\x18\xcf\xbe\x00\x6C\x00\x13\x06\x00"
-                                    "\x05\x0d\x00\x00\xf1\x8c\x63\x18\xc6\x31\x8c\x6f\x80\x00\x6D\x00\x1e\x11\x00\x11"
-                                    "\x09\x00\x00\xf7\xbc\x1c\xe3\x0c\x71\x86\x38\xc3\x1c\x61\x8e\x30\xc7\x18\x63\x8c"
-                                    "\xfb\xef\x80\x00\x6E\x00\x17\x0b\x00\x0b\x09\x00\x00\xf7\x87\x30\xc7\x18\xe3\x1c"
-                                    "\x63\x8c\x71\x8e\xfb\xe0\x00\x6F\x00\x15\x0a\x00\x09\x09\x01\x00\x3c\x31\xb0\xd8"
-                                    "\x7c\x3e\x1f\x0c\xc6\x3c\x00\x00\x70\x00\x1b\x0b\x00\x0a\x0d\x00\xfc\xf7\x0e\x63"
-                                    "\x0c\xc3\x30\xcc\x33\x0c\xc6\x3f\x0c\x03\x00\xc0\xf8\x00\x00\x71\x00\x1b\x0b\x00"
-                                    "\x0a\x0d\x01\xfc\x3b\x19\xcc\x33\x0c\xc3\x30\xcc\x31\x8c\x3f\x00\xc0\x30\x0c\x07"
-                                    "\xc0\x00\x72\x00\x13\x08\x00\x08\x09\x00\x00\xf6\x3b\x33\x30\x30\x30\x30\x30\xf8"
-                                    "\x00\x73\x00\x11\x08\x00\x06\x09\x01\x00\x7a\x2c\x7e\x7c\xf8\xe3\xf8\x00\x74\x00"
-                                    "\x13\x07\x00\x06\x0b\x00\x00\x30\xcf\xcc\x30\xc3\x0c\x30\xc3\xc0\x00\x75\x00\x17"
-                                    "\x0b\x00\x0b\x09\x00\x00\xf3\xc6\x38\xc7\x18\xe3\x1c\x63\x8c\x71\x8e\x1f\xe0\x00"
-                                    "\x76\x00\x16\x0a\x00\x0a\x09\x00\x00\xf9\xdc\x43\x90\xe4\x1a\x07\x80\xc0\x30\x08"
-                                    "\x00\x00\x77\x00\x1b\x0f\x00\x0f\x09\x00\x00\xfb\xee\x63\x88\xcb\x21\xd7\x41\xa6"
-                                    "\x83\x8e\x07\x1c\x04\x10\x08\x20\x00\x78\x00\x16\x0a\x00\x0a\x09\x00\x00\xff\x8e"
-                                    "\x41\xe0\x70\x0e\x03\x81\x70\x8c\xf7\xc0\x00\x79\x00\x1b\x0a\x00\x0a\x0d\x00\xfc"
-                                    "\xf9\xcc\x43\x90\xe4\x1e\x07\x80\xc0\x30\x0c\x01\x0e\x83\x20\x70\x00\x00\x7A\x00"
-                                    "\x13\x09\x00\x08\x09\x00\x00\x7f\x46\x4e\x1c\x1c\x38\x39\x71\xff\x00\x7B\x00\x15"
-                                    "\x07\x00\x05\x11\x01\xfc\x3b\x18\xc6\x31\x8c\xc3\x18\xc6\x31\x8c\x38\x00\x7C\x00"
-                                    "\x0f\x04\x00\x02\x12\x01\xfc\xff\xff\xff\xff\xf0\x00\x7D\x00\x15\x07\x00\x05\x11"
-                                    "\x01\xfc\xe1\x8c\x63\x18\xc6\x19\x8c\x63\x18\xc6\xe0\x00\x7E\x00\x0d\x09\x00\x08"
-                                    "\x03\x01\x03\x72\xff\x8e\x00\xA1\x00\x0f\x05\x00\x03\x0d\x01\xfc\xfd\x04\x92\x5f"
-                                    "\xfe\x00\xA2\x00\x17\x09\x00\x08\x0d\x01\xfe\x10\x10\x3e\x76\xf6\xd0\xd0\xd0\xf1"
-                                    "\x72\x3c\x10\x10\x00\xA3\x00\x19\x09\x00\x09\x0d\x00\x00\x0e\x09\x84\xc6\x03\x01"
-                                    "\xc1\xf8\x30\x18\x0c\x44\x3f\xe4\xf0\x00\xA4\x00\x15\x09\x00\x09\x09\x00\x02\xdf"
-                                    "\xbf\xd8\xe8\x3c\x1a\x0d\x8e\xff\xdf\x80\x00\xA5\x00\x1c\x09\x00\x0b\x0d\xff\x00"
-                                    "\xfc\xe7\x08\xe2\x0e\x41\xd0\x1e\x03\x81\xfc\x0e\x07\xf0\x38\x07\x01\xf8\x00\xA6"
-                                    "\x00\x0e\x04\x00\x02\x0d\x01\xfe\xff\x00\x3f\xc0\x00\xA7\x00\x1b\x09\x00\x08\x11"
-                                    "\x01\xfc\x3c\x46\xc6\xc2\xe0\xb0\xb8\xdc\x6e\x36\x1a\x0d\x05\xc5\xc2\xc4\x78\x00"
-                                    "\xA8\x00\x0c\x05\x00\x06\x02\xff\x0a\xed\xb0\x00\xA9\x00\x1e\x0e\x00\x0c\x0d\x01"
-                                    "\x00\x1f\x03\x0c\x60\x6c\x72\x98\xb9\x01\xb0\x1b\x01\x90\x3d\x8a\x47\x63\x0c\x1f"
-                                    "\x80\x00\xAA\x00\x0f\x07\x00\x06\x06\x00\x07\x39\x33\xf3\xcd\xf0\x00\xAB\x00\x10"
-                                    "\x07\x00\x07\x06\x00\x01\x12\x4b\xf3\x62\x42\x40\x00\xAC\x00\x0f\x0a\x00\x08\x05"
-                                    "\x01\x02\xff\xff\x01\x01\x01\x00\xAD\x00\x0b\x06\x00\x03\x01\x02\x03\xe0\x00\xAE"
-                                    "\x00\x10\x08\x00\x06\x07\x01\x06\x7a\xda\xed\xae\x17\x80\x00\xAF\x00\x0b\x05\x00"
-                                    "\x05\x01\x00\x0b\xf8\x00\xB0\x00\x0e\x07\x00\x05\x05\x01\x08\x74\x63\x17\x00\x00"
-                                    "\xB1\x00\x13\x0a\x00\x08\x09\x01\x00\x18\x18\xff\xff\x18\x18\x00\xff\xff\x00\xB2"
-                                    "\x00\x10\x07\x00\x06\x07\x00\x08\x79\x30\xc2\x35\x1f\x80\x00\xB3\x00\x11\x07\x00"
-                                    "\x07\x07\x00\x08\x7c\x18\xe0\x60\x78\x9e\x00\x00\xB4\x00\x0c\x05\x00\x04\x04\x02"
-                                    "\x0a\x23\x68\x00\xB5\x00\x1c\x0b\x00\x0b\x0d\x00\xfc\xf3\xc6\x38\xc7\x18\xe3\x1c"
-                                    "\x63\x8c\x71\x8e\x7f\xec\x01\x80\x38\x06\x00\x00\xB6\x00\x1c\x0a\x00\x09\x10\x00"
-                                    "\xfd\x3f\xbc\x9e\x5f\x27\x93\xc8\xe4\x0a\x05\x02\x81\x40\xe0\x71\xd8\xb8\x30\x00"
-                                    "\xB7\x00\x0c\x05\x00\x03\x03\x01\x04\xdf\x00\x00\xB8\x00\x0c\x05\x00\x04\x04\x01"
-                                    "\xfc\x46\x3e\x00\xB9\x00\x0e\x07\x00\x04\x07\x01\x08\x2e\x22\x22\xf0\x00\xBA\x00"
-                                    "\x0f\x07\x00\x06\x06\x00\x06\x39\x3c\xf3\x4c\xe0\x00\xBB\x00\x10\x07\x00\x07\x06"
-                                    "\x00\x01\x90\x90\xd9\xb4\x92\x00\x00\xBC\x00\x1e\x0e\x00\x0c\x0d\x01\x00\x20\x46"
-                                    "\x04\xe0\x86\x10\x61\x06\x22\x62\x26\x46\xf4\xe0\x96\x11\xf1\x07\x20\x60\x00\xBD"
-                                    "\x00\x21\x0e\x00\x0d\x0e\x01\xff\x00\x43\x04\x38\x20\xc2\x06\x10\x31\x71\x94\x5e"
-                                    "\xb2\x08\x90\x41\x04\x10\x21\x12\x1f\x30\x00\x00\xBE\x00\x20\x0e\x00\x0d\x0d\x00"
-                                    "\x00\x30\x22\x41\x12\x10\x31\x03\x08\x06\x81\x34\x59\xc6\x72\x70\x25\x82\x3e\x10"
-                                    "\x71\x03\x00\x00\xBF\x00\x16\x08\x00\x07\x0d\x00\xfc\x18\x38\x60\x00\x81\x0c\x30"
-                                    "\x61\xc3\x9b\x33\xc0\x00\xC0\x00\x25\x0d\x00\x0c\x12\x00\x00\x08\x01\xc0\x0c\x00"
-                                    "\x30\x00\x00\x20\x06\x00\x60\x07\x00\xf0\x0b\x01\x38\x13\x81\xf8\x21\xc2\x1c\x20"
-                                    "\xcf\x3f\x00\xC1\x00\x25\x0d\x00\x0c\x12\x00\x00\x00\x80\x18\x03\x00\x60\x00\x00"
-                                    "\x20\x06\x00\x60\x07\x00\xf0\x0b\x01\x38\x13\x81\xf8\x21\xc2\x1c\x20\xcf\x3f\x00"
-                                    "\xC2\x00\x24\x0d\x00\x0c\x11\x00\x00\x06\x00\xf0\x18\x80\x00\x02\x00\x60\x06\x00"
-                                    "\x70\x0f\x00\xb0\x13\x81\x38\x1f\x82\x1c\x21\xc2\x0c\xf3\xf0\x00\xC3\x00\x24\x0d"
-                                    "\x00\x0c\x11\x00\x00\x0e\x81\x38\x00\x00\x00\x02\x00\x60\x06\x00\x70\x0f\x00\xb0"
-                                    "\x13\x81\x38\x1f\x82\x1c\x21\xc2\x0c\xf3\xf0\x00\xC4\x00\x22\x0d\x00\x0c\x10\x00"
-                                    "\x00\x1d\x80\x98\x00\x00\x20\x06\x00\x60\x07\x00\xf0\x0b\x01\x38\x13\x81\xf8\x21"
-                                    "\xc2\x1c\x20\xcf\x3f\x00\xC5\x00\x24\x0d\x00\x0c\x11\x00\x00\x06\x00\x90\x09\x00"
-                                    "\x60\x02\x00\x60\x06\x00\x70\x0f\x00\xb0\x13\x81\x38\x1f\x82\x1c\x21\xc2\x0c\xf3"
-                                    "\xf0\x00\xC6\x00\x26\x12\x00\x11\x0d\x00\x00\x03\xff\x01\x60\x80\xb0\x40\x98\x10"
-                                    "\x4c\x40\x26\x60\x23\xf0\x11\x98\x1f\xc4\x08\x62\x48\x30\x24\x18\x3f\x3f\xf8\x00"
-                                    "\xC7\x00\x22\x0d\x00\x0b\x11\x01\xfc\x0f\x86\x0d\xc0\xb0\x1e\x03\xc0\x38\x07\x00"
-                                    "\xe0\x2c\x05\x80\x98\x30\xdc\x04\x00\xc0\x0c\x07\x00\x00\xC8\x00\x21\x0c\x00\x0a"
-                                    "\x12\x01\x00\x10\x0e\x01\x80\x18\x00\x3f\xf7\x0d\xc1\x70\x5c\x87\x21\xf8\x72\x1c"
-                                    "\x87\x05\xc1\x70\x7f\xf0\x00\xC9\x00\x21\x0c\x00\x0a\x12\x01\x00\x01\x00\xc0\x60"
-                                    "\x30\x00\x3f\xf7\x0d\xc1\x70\x5c\x87\x21\xf8\x72\x1c\x87\x05\xc1\x70\x7f\xf0\x00"
-                                    "\xCA\x00\x20\x0c\x00\x0a\x11\x01\x00\x0c\x07\x83\x30\x00\xff\xdc\x37\x05\xc1\x72"
-                                    "\x1c\x87\xe1\xc8\x72\x1c\x17\x05\xc1\xff\xc0\x00\xCB\x00\x1e\x0c\x00\x0a\x10\x01"
-                                    "\x00\x33\x0c\xc0\x03\xff\x70\xdc\x17\x05\xc8\x72\x1f\x87\x21\xc8\x70\x5c\x17\x07"
-                                    "\xff\x00\xCC\x00\x16\x07\x00\x05\x12\x01\x00\x86\x18\x60\x7d\xce\x73\x9c\xe7\x39"
-                                    "\xce\x77\xc0\x00\xCD\x00\x16\x07\x00\x05\x12\x01\x00\x08\xcc\xc0\x7d\xce\x73\x9c"
-                                    "\xe7\x39\xce\x77\xc0\x00\xCE\x00\x15\x07\x00\x05\x11\x01\x00\x72\xa2\x0f\xb9\xce"
-                                    "\x73\x9c\xe7\x39\xce\xf8\x00\xCF\x00\x14\x07\x00\x05\x10\x01\x00\xde\xc1\xf7\x39"
-                                    "\xce\x73\x9c\xe7\x39\xdf\x00\xD0\x00\x20\x0f\x00\x0d\x0d\x01\x00\xff\x83\x87\x1c"
-                                    "\x1c\xe0\xe7\x03\xb8\x1f\xf8\xee\x07\x70\x3b\x83\x9c\x1c\xe1\xcf\xf8\x00\x00\xD1"
-                                    "\x00\x28\x0e\x00\x0e\x11\x00\x00\x06\x40\x2f\x00\x00\x00\x00\xfc\x3c\xf0\x42\xe1"
-                                    "\x0b\xc4\x27\x90\x8e\x42\x1d\x08\x7c\x20\xf0\x81\xc2\x03\x08\x0c\xf8\x10\x00\xD2"
-                                    "\x00\x26\x0f\x00\x0d\x11\x01\x00\x08\x00\x60\x01\x80\x06\x00\xf8\x18\x31\xc1\xcc"
-                                    "\x06\xe0\x3f\x01\xf8\x0f\xc0\x7e\x03\xb0\x19\xc1\xc6\x0c\x0f\x80\x00\xD3\x00\x26"
-                                    "\x0f\x00\x0d\x11\x01\x00\x00\x80\x06\x00\x60\x04\x00\xf8\x18\x31\xc1\xcc\x06\xe0"
-                                    "\x3f\x01\xf8\x0f\xc0\x7e\x03\xb0\x19\xc1\xc6\x0c\x0f\x80\x00\xD4\x00\x24\x0f\x00"
-                                    "\x0d\x10\x01\x00\x07\x00\x28\x02\x20\x1f\x03\x06\x38\x39\x80\xdc\x07\xe0\x3f\x01"
-                                    "\xf8\x0f\xc0\x76\x03\x38\x38\xc1\x81\xf0\x00\xD5\x00\x24\x0f\x00\x0d\x10\x01\x00"
-                                    "\x0e\x40\x9c\x00\x00\x1f\x03\x06\x38\x39\x80\xdc\x07\xe0\x3f\x01\xf8\x0f\xc0\x76"
-                                    "\x03\x38\x38\xc1\x81\xf0\x00\xD6\x00\x23\x0f\x00\x0d\x0f\x01\x00\x1d\x80\x6c\x03"
-                                    "\xe0\x60\xc7\x07\x30\x1b\x80\xfc\x07\xe0\x3f\x01\xf8\x0e\xc0\x67\x07\x18\x30\x3e"
-                                    "\x00\x00\xD7\x00\x12\x0a\x00\x08\x08\x01\x00\xc3\x67\x3e\x1c\x3c\x76\xe3\x42\x00"
-                                    "\xD8\x00\x20\x0f\x00\x0d\x0d\x01\x00\x0f\x89\x83\x9c\x1c\xc0\xee\x0b\xf0\x9f\x88"
-                                    "\xfc\x87\xe8\x3b\x81\x9c\x1c\xe0\xc8\xf8\x00\x00\xD9\x00\x28\x0e\x00\x0d\x12\x00"
-                                    "\x00\x04\x00\x70\x01\x80\x02\x00\x00\x7e\x3c\xe0\x47\x02\x38\x11\xc0\x8e\x04\x70"
-                                    "\x23\x81\x1c\x08\xe0\x47\x02\x38\x20\x7e\x00\x00\xDA\x00\x28\x0e\x00\x0d\x12\x00"
-                                    "\x00\x00\x40\x06\x00\x60\x06\x00\x00\x7e\x3c\xe0\x47\x02\x38\x11\xc0\x8e\x04\x70"
-                                    "\x23\x81\x1c\x08\xe0\x47\x02\x38\x20\x7e\x00\x00\xDB\x00\x26\x0e\x00\x0d\x11\x00"
-                                    "\x00\x03\x00\x3c\x02\x30\x00\x0f\xc7\x9c\x08\xe0\x47\x02\x38\x11\xc0\x8e\x04\x70"
-                                    "\x23\x81\x1c\x08\xe0\x47\x04\x0f\xc0\x00\xDC\x00\x24\x0e\x00\x0d\x10\x00\x00\x0c"
-                                    "\xc0\x66\x00\x01\xf8\xf3\x81\x1c\x08\xe0\x47\x02\x38\x11\xc0\x8e\x04\x70\x23\x81"
-                                    "\x1c\x08\xe0\x81\xf8\x00\xDD\x00\x25\x0c\x00\x0c\x12\x00\x00\x00\x80\x18\x01\x80"
-                                    "\x60\x00\x0f\xcf\x38\x41\xc4\x1c\x80\xe8\x0f\x00\x60\x06\x00\x60\x06\x00\x60\x06"
-                                    "\x01\xf8\x00\xDE\x00\x1c\x0c\x00\x0b\x0d\x01\x00\xf8\x0e\x01\xfe\x38\xe7\x0e\xe1"
-                                    "\xdc\x3b\x87\x71\xcf\xe1\xc0\x38\x0f\x80\x00\xDF\x00\x1b\x0b\x00\x0a\x0d\x00\x00"
-                                    "\x1f\x0c\x63\x1c\xc6\x31\x8d\x83\x18\xc7\x31\xcc\x73\x1c\xd7\xfb\x80\x00\xE0\x00"
-                                    "\x1a\x0a\x00\x09\x0e\x01\x00\x20\x30\x0c\x01\x00\x03\xf3\x19\x8e\x1f\x33\xb1\xd8"
-                                    "\xec\x73\xfc\x00\xE1\x00\x1a\x0a\x00\x09\x0e\x01\x00\x02\x03\x03\x03\x00\x03\xf3"
-                                    "\x19\x8e\x1f\x33\xb1\xd8\xec\x73\xfc\x00\xE2\x00\x19\x0a\x00\x09\x0d\x01\x00\x18"
-                                    "\x1e\x19\x80\x07\xe6\x33\x1c\x3e\x67\x63\xb1\xd8\xe7\xf8\x00\xE3\x00\x19\x0a\x00"
-                                    "\x09\x0d\x01\x00\x32\x2f\x00\x00\x07\xe6\x33\x1c\x3e\x67\x63\xb1\xd8\xe7\xf8\x00"
-                                    "\xE4\x00\x18\x0a\x00\x09\x0c\x01\x00\x66\x33\x00\x0f\xcc\x66\x38\x7c\xce\xc7\x63"
-                                    "\xb1\xcf\xf0\x00\xE5\x00\x1a\x0a\x00\x09\x0e\x01\x00\x18\x12\x09\x03\x00\x03\xf3"
-                                    "\x19\x8e\x1f\x33\xb1\xd8\xec\x73\xfc\x00\xE6\x00\x19\x0f\x00\x0d\x09\x01\x00\x7d"
-                                    "\xe6\x39\x91\x86\x7f\xfe\x60\x63\x03\x1c\x39\x62\x71\xe0\x00\xE7\x00\x17\x09\x00"
-                                    "\x08\x0d\x01\xfc\x3c\x66\xc6\xc0\xc0\xc0\xe1\x62\x3c\x08\x1c\x04\x3c\x00\xE8\x00"
-                                    "\x18\x0a\x00\x08\x0e\x01\x00\x20\x30\x30\x0c\x00\x3c\x66\xc7\xff\xc0\xc0\xe1\x62"
-                                    "\x3c\x00\xE9\x00\x18\x0a\x00\x08\x0e\x01\x00\x02\x06\x0c\x18\x00\x3c\x66\xc7\xff"
-                                    "\xc0\xc0\xe1\x62\x3c\x00\xEA\x00\x17\x0a\x00\x08\x0d\x01\x00\x18\x3c\x66\x00\x3c"
-                                    "\x66\xc7\xff\xc0\xc0\xe1\x62\x3c\x00\xEB\x00\x16\x0a\x00\x08\x0c\x01\x00\x66\x66"
-                                    "\x00\x3c\x66\xc7\xff\xc0\xc0\xe1\x62\x3c\x00\xEC\x00\x13\x06\x00\x05\x0e\x00\x00"
-                                    "\x86\x18\x60\x78\xc6\x31\x8c\x63\x7c\x00\xED\x00\x13\x06\x00\x05\x0e\x00\x00\x08"
-                                    "\xc6\xc0\x78\xc6\x31\x8c\x63\x7c\x00\xEE\x00\x14\x06\x00\x06\x0d\x00\x00\x31\xe8"
-                                    "\xc0\xf0\xc3\x0c\x30\xc3\x0c\xf8\x00\xEF\x00\x13\x06\x00\x06\x0c\x00\x00\xdf\x30"
-                                    "\x3c\x30\xc3\x0c\x30\xc3\x3e\x00\xF0\x00\x1a\x0a\x00\x09\x0e\x01\x00\x02\x3e\x0f"
-                                    "\x09\xc0\x61\xf9\x8d\x87\xc3\xe1\xf0\xd8\x66\x31\xe0\x00\xF1\x00\x1c\x0b\x00\x0b"
-                                    "\x0d\x00\x00\x1c\x82\xe0\x00\x00\x0f\x78\x73\x0c\x71\x8e\x31\xc6\x38\xc7\x18\xef"
-                                    "\xbe\x00\xF2\x00\x1a\x0a\x00\x09\x0e\x01\x00\x20\x18\x0c\x01\x80\x01\xe1\x8d\x86"
-                                    "\xc3\xe1\xf0\xf8\x66\x31\xe0\x00\xF3\x00\x1a\x0a\x00\x09\x0e\x01\x00\x02\x03\x03"
-                                    "\x03\x00\x01\xe1\x8d\x86\xc3\xe1\xf0\xf8\x66\x31\xe0\x00\xF4\x00\x19\x0a\x00\x09"
-                                    "\x0d\x01\x00\x18\x1e\x18\x80\x03\xc3\x1b\x0d\x87\xc3\xe1\xf0\xcc\x63\xc0\x00\xF5"
-                                    "\x00\x19\x0a\x00\x09\x0d\x01\x00\x32\x2f\x00\x00\x03\xc3\x1b\x0d\x87\xc3\xe1\xf0"
-                                    "\xcc\x63\xc0\x00\xF6\x00\x18\x0a\x00\x09\x0c\x01\x00\x76\x33\x00\x07\x86\x36\x1b"
-                                    "\x0f\x87\xc3\xe1\x98\xc7\x80\x00\xF7\x00\x14\x0a\x00\x08\x0a\x01\xff\x18\x1c\x18"
-                                    "\x00\xff\xff\x00\x18\x1c\x18\x00\xF8\x00\x15\x0a\x00\x09\x09\x01\x00\x3c\xb1\xb0"
-                                    "\xd8\xfc\xbe\x9f\x8c\xc6\xbc\x00\x00\xF9\x00\x1e\x0b\x00\x0b\x0e\x00\x00\x10\x03"
-                                    "\x00\x30\x03\x00\x01\xe7\x8c\x71\x8e\x31\xc6\x38\xc7\x18\xe3\x1c\x3f\xc0\x00\xFA"
-                                    "\x00\x1e\x0b\x00\x0b\x0e\x00\x00\x01\x00\x60\x0c\x06\x00\x01\xe7\x8c\x71\x8e\x31"
-                                    "\xc6\x38\xc7\x18\xe3\x1c\x3f\xc0\x00\xFB\x00\x1c\x0b\x00\x0b\x0d\x00\x00\x0e\x01"
-                                    "\x40\x44\x00\x0f\x3c\x63\x8c\x71\x8e\x31\xc6\x38\xc7\x18\xe1\xfe\x00\xFC\x00\x1b"
-                                    "\x0b\x00\x0b\x0c\x00\x00\x1b\x03\x60\x00\x79\xe3\x1c\x63\x8c\x71\x8e\x31\xc6\x38"
-                                    "\xc7\x0f\xf0\x00\xFD\x00\x21\x0a\x00\x0a\x12\x00\xfc\x01\x00\xc0\x60\x30\x00\x3e"
-                                    "\x73\x10\xe4\x39\x07\x81\xe0\x30\x0c\x03\x00\x43\xa0\xc8\x1c\x00\x00\xFE\x00\x20"
-                                    "\x0b\x00\x0a\x11\x00\xfc\xf0\x0c\x03\x00\xc0\x37\x0e\x63\x0c\xc3\x30\xcc\x33\x0c"
-                                    "\xc6\x3f\x0c\x03\x00\xc0\xf8\x00\x00\xFF\x00\x1e\x0a\x00\x0a\x10\x00\xfc\x33\x0c"
-                                    "\xc0\x03\xe7\x31\x0e\x43\x90\x78\x1e\x03\x00\xc0\x30\x04\x3a\x0c\x81\xc0\x01\x31"
-                                    "\x00\x10\x06\x00\x05\x09\x00\x00\xf1\x8c\x63\x18\xc6\xf8\x01\x41\x00\x1c\x0c\x00"
-                                    "\x0b\x0d\x01\x00\xf8\x0e\x01\xc8\x39\x07\xc0\xf0\x1c\x07\x80\xf0\x3e\x05\xc0\xb8"
-                                    "\x3f\xfe\x01\x42\x00\x13\x06\x00\x05\x0d\x00\x00\xf1\x8c\x73\x99\xd6\x31\x8c\x6f"
-                                    "\x80\x01\x52\x00\x28\x14\x00\x12\x0d\x01\x00\x0f\xff\xcc\x38\x37\x06\x05\x81\x81"
-                                    "\xe0\x62\x38\x18\x8e\x07\xe3\x81\x88\xe0\x62\x18\x18\x17\x06\x04\xc3\x83\x0f\xff"
-                                    "\xc0\x01\x53\x00\x1a\x0f\x00\x0e\x09\x01\x00\x3c\xf1\x9c\x6c\x31\xf0\xff\xc3\x03"
-                                    "\x0c\x0c\x30\x59\xe2\x3c\xf0\x01\x60\x00\x1b\x0a\x00\x08\x11\x01\x00\x66\x3c\x18"
-                                    "\x00\x3e\x42\xc2\xc1\xf0\xfc\x7e\x1f\x07\x83\x81\xc2\x7c\x01\x61\x00\x14\x08\x00"
-                                    "\x06\x0d\x01\x00\xcd\xe3\x00\x7a\x2c\x7e\x7c\xf8\xe3\xf8\x01\x78\x00\x22\x0c\x00"
-                                    "\x0c\x10\x00\x00\x0d\xc0\xc8\x00\x0f\xcf\x38\x41\xc4\x1c\x80\xe8\x0f\x00\x60\x06"
-                                    "\x00\x60\x06\x00\x60\x06\x01\xf8\x01\x7D\x00\x22\x0b\x00\x0b\x11\x00\x00\x11\x81"
-                                    "\x40\x18\x00\x07\xfe\xc3\x90\x72\x1c\x07\x00\xe0\x38\x07\x01\xc0\x70\x4e\x0b\x83"
-                                    "\xff\xe0\x01\x7E\x00\x17\x09\x00\x08\x0d\x00\x00\x62\x3c\x18\x00\x7f\x46\x4e\x1c"
-                                    "\x1c\x38\x39\x71\xff\x01\x92\x00\x20\x09\x00\x0a\x11\xff\xfc\x01\xc0\x90\x6c\x18"
-                                    "\x06\x01\x81\xf8\x38\x0e\x03\x80\xc0\x30\x0c\x03\x04\xc3\x20\x70\x00\x02\xC6\x00"
-                                    "\x0d\x05\x00\x06\x03\xff\x0a\x30\xac\x40\x02\xC7\x00\x0d\x05\x00\x06\x03\xff\x0a"
-                                    "\xc4\xa3\x00\x02\xD8\x00\x0c\x05\x00\x05\x03\x00\x0a\x8c\x5c\x02\xD9\x00\x0b\x05"
-                                    "\x00\x02\x02\x01\x0a\xf0\x02\xDA\x00\x0c\x05\x00\x03\x04\x01\x0a\xd6\xe0\x02\xDB"
-                                    "\x00\x0c\x05\x00\x04\x04\x00\xfc\x6c\xd6\x02\xDC\x00\x0c\x05\x00\x06\x02\xff\x0b"
-                                    "\x76\x70\x02\xDD\x00\x0d\x05\x00\x07\x03\x00\x0a\x32\xcf\x60\x20\x13\x00\x0d\x09"
-                                    "\x00\x09\x02\x00\x03\xff\xff\xc0\x20\x14\x00\x0e\x11\x00\x0d\x02\x02\x03\xff\xff"
-                                    "\xff\xc0\x20\x18\x00\x0d\x04\x00\x03\x06\x00\x07\x2a\x7e\xc0\x20\x19\x00\x0d\x04"
-                                    "\x00\x03\x06\x00\x07\x7d\x92\x80\x20\x1A\x00\x0d\x04\x00\x03\x06\x00\xfd\x7d\x92"
-                                    "\x80\x20\x1C\x00\x10\x08\x00\x07\x06\x01\x07\x45\x12\x26\x6e\xf9\x80\x20\x1D\x00"
-                                    "\x10\x08\x00\x07\x06\x01\x07\xcd\xdf\xb9\x14\x51\x00\x20\x1E\x00\x10\x08\x00\x07"
-                                    "\x06\x01\xfd\xcd\xdb\xb9\x14\x51\x00\x20\x20\x00\x19\x09\x00\x08\x0f\x01\xfe\x18"
-                                    "\x38\x18\x18\xd2\xff\x10\x10\x10\x18\x18\x18\x38\x38\x38\x20\x21\x00\x1a\x09\x00"
-                                    "\x08\x10\x01\xfd\x18\x38\x18\x10\xd2\xff\x10\x10\x10\x10\xff\xd2\x10\x18\x38\x18"
-                                    "\x20\x22\x00\x10\x09\x00\x06\x07\x01\x03\x11\xef\xff\xfd\xf3\x80\x20\x26\x00\x10"
-                                    "\x11\x00\x0f\x03\x01\x00\x61\x0d\xc7\x1d\x8e\x30\x20\x30\x00\x26\x11\x00\x11\x0d"
-                                    "\x00\x00\x70\x40\x64\x40\x32\x40\x19\x20\x04\xa0\x01\x90\x00\x10\x00\x0b\x8c\x0a"
-                                    "\x69\x05\x34\xc4\x9a\x64\x4d\x36\x1c\x70\x20\x39\x00\x0d\x04\x00\x04\x06\x00\x01"
-                                    "\x12\xe6\x21\x20\x3A\x00\x0d\x04\x00\x04\x06\x00\x01\x86\x33\x68\x20\x44\x00\x19"
-                                    "\x03\x00\x09\x0d\xfd\x00\x01\x80\x80\x80\x40\x40\x20\x20\x20\x10\x10\x08\x08\x0c"
-                                    "\x00\x21\x22\x00\x19\x11\x00\x11\x07\x00\x05\xff\xc3\xc9\x71\x84\x39\xc2\x16\xe1"
-                                    "\x0b\xb0\x84\x98\xe3\x5e\x22\x12\x00\x0c\x0a\x00\x08\x02\x01\x03\xff\xff\xFB\x00"
-                                    "\x00\x21\x0c\x00\x0e\x0d\x00\x00\x1c\x78\xcb\x73\x3c\x9c\x70\xfb\xe1\xc7\x07\x1c"
-                                    "\x1c\x70\x71\xc1\xc7\x07\x1c\x1c\x70\xfb\xe0\xFB\x01\x00\x1c\x0b\x00\x0b\x0d\x00"
-                                    "\x00\x1f\x06\x70\xc4\x18\x0f\xbc\xe3\x9c\x73\x8e\x71\xce\x39\xc7\x38\xef\xbe\xFB"
-                                    "\x02\x00\x1c\x0b\x00\x0b\x0d\x00\x00\x0f\xc6\x38\xc7\x18\xef\x9c\xe3\x9c\x73\x8e"
-                                    "\x71\xce\x39\xc7\x38\xef\xbe\xFB\x03\x00\x26\x11\x00\x11\x0d\x00\x00\x1c\x7c\x19"
-                                    "\x67\x0c\xb0\x0e\x38\x0f\xbe\xf3\x8e\x39\xc7\x1c\xe3\x8e\x71\xc7\x38\xe3\x9c\x71"
-                                    "\xce\x38\xef\xbe\xf8\xFB\x04\x00\x26\x11\x00\x11\x0d\x00\x00\x1c\x3f\x19\x63\x8c"
-                                    "\xb1\xce\x38\xef\xbe\x73\x8e\x39\xc7\x1c\xe3\x8e\x71\xc7\x38\xe3\x9c\x71\xce\x38"
-                                    "\xef\xbe\xf8";
+static constexpr Character bailleul_bold_12_pt_characters[233] = {
+    {0x0000, 0, 7, 12, 6, 12, 0, 0},
+    {0x0020, 9, 5, 0, 0, 0, 0, 0},
+    {0x0021, 9, 5, 0, 3, 13, 1, 0},
+    {0x0022, 14, 8, 0, 5, 6, 2, 7},
+    {0x0023, 18, 9, 0, 9, 13, 0, 0},
+    {0x0024, 33, 9, 0, 9, 16, 0, -1},
+    {0x0025, 51, 17, 0, 13, 13, 2, 0},
+    {0x0026, 73, 14, 0, 12, 13, 1, 0},
+    {0x0027, 93, 4, 0, 2, 6, 1, 7},
+    {0x0028, 95, 8, 0, 5, 16, 2, -4},
+    {0x0029, 105, 8, 0, 6, 16, 0, -4},
+    {0x002A, 117, 7, 0, 5, 6, 1, 7},
+    {0x002B, 121, 10, 0, 8, 9, 1, 0},
+    {0x002C, 130, 5, 0, 3, 6, 1, -3},
+    {0x002D, 133, 7, 0, 5, 2, 1, 3},
+    {0x002E, 135, 5, 0, 3, 3, 1, 0},
+    {0x002F, 137, 7, 0, 7, 13, 0, 0},
+    {0x0030, 149, 9, 0, 8, 13, 1, 0},
+    {0x0031, 162, 9, 0, 6, 13, 2, 0},
+    {0x0032, 172, 10, 0, 9, 13, 0, 0},
+    {0x0033, 187, 10, 0, 9, 13, 0, 0},
+    {0x0034, 202, 9, 0, 9, 13, 0, 0},
+    {0x0035, 217, 9, 0, 7, 14, 1, 0},
+    {0x0036, 230, 9, 0, 8, 13, 1, 0},
+    {0x0037, 243, 9, 0, 8, 13, 1, 0},
+    {0x0038, 256, 9, 0, 8, 13, 1, 0},
+    {0x0039, 269, 9, 0, 8, 13, 1, 0},
+    {0x003A, 282, 5, 0, 3, 9, 1, 0},
+    {0x003B, 286, 5, 0, 3, 12, 1, -3},
+    {0x003C, 291, 10, 0, 8, 9, 1, 0},
+    {0x003D, 300, 10, 0, 8, 6, 1, 2},
+    {0x003E, 306, 10, 0, 8, 9, 1, 0},
+    {0x003F, 315, 8, 0, 7, 13, 1, 0},
+    {0x0040, 327, 14, 0, 12, 13, 1, 0},
+    {0x0041, 347, 13, 0, 12, 13, 0, 0},
+    {0x0042, 367, 12, 0, 11, 13, 1, 0},
+    {0x0043, 385, 13, 0, 11, 13, 1, 0},
+    {0x0044, 403, 15, 0, 13, 13, 1, 0},
+    {0x0045, 425, 12, 0, 10, 13, 1, 0},
+    {0x0046, 442, 11, 0, 11, 13, 0, 0},
+    {0x0047, 460, 14, 0, 13, 13, 1, 0},
+    {0x0048, 482, 14, 0, 13, 13, 1, 0},
+    {0x0049, 504, 7, 0, 5, 13, 1, 0},
+    {0x004A, 513, 9, 0, 8, 13, 0, 0},
+    {0x004B, 526, 14, 0, 13, 13, 1, 0},
+    {0x004C, 548, 12, 0, 11, 13, 1, 0},
+    {0x004D, 566, 17, 0, 16, 13, 0, 0},
+    {0x004E, 592, 14, 0, 14, 13, 0, 0},
+    {0x004F, 615, 15, 0, 13, 13, 1, 0},
+    {0x0050, 637, 12, 0, 11, 13, 1, 0},
+    {0x0051, 655, 15, 0, 13, 17, 1, -4},
+    {0x0052, 683, 13, 0, 12, 13, 1, 0},
+    {0x0053, 703, 10, 0, 8, 13, 1, 0},
+    {0x0054, 716, 13, 0, 11, 13, 1, 0},
+    {0x0055, 734, 14, 0, 13, 13, 0, 0},
+    {0x0056, 756, 12, 0, 12, 13, 0, 0},
+    {0x0057, 776, 19, 0, 19, 13, 0, 0},
+    {0x0058, 807, 13, 0, 12, 13, 0, 0},
+    {0x0059, 827, 12, 0, 12, 13, 0, 0},
+    {0x005A, 847, 11, 0, 11, 13, 0, 0},
+    {0x005B, 865, 7, 0, 5, 17, 2, -4},
+    {0x005C, 876, 7, 0, 7, 13, 0, 0},
+    {0x005D, 888, 7, 0, 5, 17, 0, -4},
+    {0x005E, 899, 9, 0, 8, 7, 1, 6},
+    {0x005F, 906, 9, 0, 9, 1, 0, -2},
+    {0x0060, 908, 5, 0, 4, 4, -1, 10},
+    {0x0061, 910, 10, 0, 9, 9, 1, 0},
+    {0x0062, 921, 11, 0, 10, 13, 0, 0},
+    {0x0063, 938, 9, 0, 8, 9, 1, 0},
+    {0x0064, 947, 11, 0, 10, 13, 1, 0},
+    {0x0065, 964, 10, 0, 8, 9, 1, 0},
+    {0x0066, 973, 6, 0, 8, 13, 0, 0},
+    {0x0067, 986, 10, 0, 9, 13, 1, -4},
+    {0x0068, 1001, 11, 0, 11, 13, 0, 0},
+    {0x0069, 1019, 6, 0, 5, 13, 0, 0},
+    {0x006A, 1028, 6, 0, 4, 17, 0, -4},
+    {0x006B, 1037, 11, 0, 11, 13, 0, 0},
+    {0x006C, 1055, 6, 0, 5, 13, 0, 0},
+    {0x006D, 1064, 17, 0, 17, 9, 0, 0},
+    {0x006E, 1084, 11, 0, 11, 9, 0, 0},
+    {0x006F, 1097, 10, 0, 9, 9, 1, 0},
+    {0x0070, 1108, 11, 0, 10, 13, 0, -4},
+    {0x0071, 1125, 11, 0, 10, 13, 1, -4},
+    {0x0072, 1142, 8, 0, 8, 9, 0, 0},
+    {0x0073, 1151, 8, 0, 6, 9, 1, 0},
+    {0x0074, 1158, 7, 0, 6, 11, 0, 0},
+    {0x0075, 1167, 11, 0, 11, 9, 0, 0},
+    {0x0076, 1180, 10, 0, 10, 9, 0, 0},
+    {0x0077, 1192, 15, 0, 15, 9, 0, 0},
+    {0x0078, 1209, 10, 0, 10, 9, 0, 0},
+    {0x0079, 1221, 10, 0, 10, 13, 0, -4},
+    {0x007A, 1238, 9, 0, 8, 9, 0, 0},
+    {0x007B, 1247, 7, 0, 5, 17, 1, -4},
+    {0x007C, 1258, 4, 0, 2, 18, 1, -4},
+    {0x007D, 1263, 7, 0, 5, 17, 1, -4},
+    {0x007E, 1274, 9, 0, 8, 3, 1, 3},
+    {0x00A1, 1277, 5, 0, 3, 13, 1, -4},
+    {0x00A2, 1282, 9, 0, 8, 13, 1, -2},
+    {0x00A3, 1295, 9, 0, 9, 13, 0, 0},
+    {0x00A4, 1310, 9, 0, 9, 9, 0, 2},
+    {0x00A5, 1321, 9, 0, 11, 13, -1, 0},
+    {0x00A6, 1339, 4, 0, 2, 13, 1, -2},
+    {0x00A7, 1343, 9, 0, 8, 17, 1, -4},
+    {0x00A8, 1360, 5, 0, 6, 2, -1, 10},
+    {0x00A9, 1362, 14, 0, 12, 13, 1, 0},
+    {0x00AA, 1382, 7, 0, 6, 6, 0, 7},
+    {0x00AB, 1387, 7, 0, 7, 6, 0, 1},
+    {0x00AC, 1393, 10, 0, 8, 5, 1, 2},
+    {0x00AD, 1398, 6, 0, 3, 1, 2, 3},
+    {0x00AE, 1399, 8, 0, 6, 7, 1, 6},
+    {0x00AF, 1405, 5, 0, 5, 1, 0, 11},
+    {0x00B0, 1406, 7, 0, 5, 5, 1, 8},
+    {0x00B1, 1410, 10, 0, 8, 9, 1, 0},
+    {0x00B2, 1419, 7, 0, 6, 7, 0, 8},
+    {0x00B3, 1425, 7, 0, 7, 7, 0, 8},
+    {0x00B4, 1432, 5, 0, 4, 4, 2, 10},
+    {0x00B5, 1434, 11, 0, 11, 13, 0, -4},
+    {0x00B6, 1452, 10, 0, 9, 16, 0, -3},
+    {0x00B7, 1470, 5, 0, 3, 3, 1, 4},
+    {0x00B8, 1472, 5, 0, 4, 4, 1, -4},
+    {0x00B9, 1474, 7, 0, 4, 7, 1, 8},
+    {0x00BA, 1478, 7, 0, 6, 6, 0, 6},
+    {0x00BB, 1483, 7, 0, 7, 6, 0, 1},
+    {0x00BC, 1489, 14, 0, 12, 13, 1, 0},
+    {0x00BD, 1509, 14, 0, 13, 14, 1, -1},
+    {0x00BE, 1532, 14, 0, 13, 13, 0, 0},
+    {0x00BF, 1554, 8, 0, 7, 13, 0, -4},
+    {0x00C0, 1566, 13, 0, 12, 18, 0, 0},
+    {0x00C1, 1593, 13, 0, 12, 18, 0, 0},
+    {0x00C2, 1620, 13, 0, 12, 17, 0, 0},
+    {0x00C3, 1646, 13, 0, 12, 17, 0, 0},
+    {0x00C4, 1672, 13, 0, 12, 16, 0, 0},
+    {0x00C5, 1696, 13, 0, 12, 17, 0, 0},
+    {0x00C6, 1722, 18, 0, 17, 13, 0, 0},
+    {0x00C7, 1750, 13, 0, 11, 17, 1, -4},
+    {0x00C8, 1774, 12, 0, 10, 18, 1, 0},
+    {0x00C9, 1797, 12, 0, 10, 18, 1, 0},
+    {0x00CA, 1820, 12, 0, 10, 17, 1, 0},
+    {0x00CB, 1842, 12, 0, 10, 16, 1, 0},
+    {0x00CC, 1862, 7, 0, 5, 18, 1, 0},
+    {0x00CD, 1874, 7, 0, 5, 18, 1, 0},
+    {0x00CE, 1886, 7, 0, 5, 17, 1, 0},
+    {0x00CF, 1897, 7, 0, 5, 16, 1, 0},
+    {0x00D0, 1907, 15, 0, 13, 13, 1, 0},
+    {0x00D1, 1929, 14, 0, 14, 17, 0, 0},
+    {0x00D2, 1959, 15, 0, 13, 17, 1, 0},
+    {0x00D3, 1987, 15, 0, 13, 17, 1, 0},
+    {0x00D4, 2015, 15, 0, 13, 16, 1, 0},
+    {0x00D5, 2041, 15, 0, 13, 16, 1, 0},
+    {0x00D6, 2067, 15, 0, 13, 15, 1, 0},
+    {0x00D7, 2092, 10, 0, 8, 8, 1, 0},
+    {0x00D8, 2100, 15, 0, 13, 13, 1, 0},
+    {0x00D9, 2122, 14, 0, 13, 18, 0, 0},
+    {0x00DA, 2152, 14, 0, 13, 18, 0, 0},
+    {0x00DB, 2182, 14, 0, 13, 17, 0, 0},
+    {0x00DC, 2210, 14, 0, 13, 16, 0, 0},
+    {0x00DD, 2236, 12, 0, 12, 18, 0, 0},
+    {0x00DE, 2263, 12, 0, 11, 13, 1, 0},
+    {0x00DF, 2281, 11, 0, 10, 13, 0, 0},
+    {0x00E0, 2298, 10, 0, 9, 14, 1, 0},
+    {0x00E1, 2314, 10, 0, 9, 14, 1, 0},
+    {0x00E2, 2330, 10, 0, 9, 13, 1, 0},
+    {0x00E3, 2345, 10, 0, 9, 13, 1, 0},
+    {0x00E4, 2360, 10, 0, 9, 12, 1, 0},
+    {0x00E5, 2374, 10, 0, 9, 14, 1, 0},
+    {0x00E6, 2390, 15, 0, 13, 9, 1, 0},
+    {0x00E7, 2405, 9, 0, 8, 13, 1, -4},
+    {0x00E8, 2418, 10, 0, 8, 14, 1, 0},
+    {0x00E9, 2432, 10, 0, 8, 14, 1, 0},
+    {0x00EA, 2446, 10, 0, 8, 13, 1, 0},
+    {0x00EB, 2459, 10, 0, 8, 12, 1, 0},
+    {0x00EC, 2471, 6, 0, 5, 14, 0, 0},
+    {0x00ED, 2480, 6, 0, 5, 14, 0, 0},
+    {0x00EE, 2489, 6, 0, 6, 13, 0, 0},
+    {0x00EF, 2499, 6, 0, 6, 12, 0, 0},
+    {0x00F0, 2508, 10, 0, 9, 14, 1, 0},
+    {0x00F1, 2524, 11, 0, 11, 13, 0, 0},
+    {0x00F2, 2542, 10, 0, 9, 14, 1, 0},
+    {0x00F3, 2558, 10, 0, 9, 14, 1, 0},
+    {0x00F4, 2574, 10, 0, 9, 13, 1, 0},
+    {0x00F5, 2589, 10, 0, 9, 13, 1, 0},
+    {0x00F6, 2604, 10, 0, 9, 12, 1, 0},
+    {0x00F7, 2618, 10, 0, 8, 10, 1, -1},
+    {0x00F8, 2628, 10, 0, 9, 9, 1, 0},
+    {0x00F9, 2639, 11, 0, 11, 14, 0, 0},
+    {0x00FA, 2659, 11, 0, 11, 14, 0, 0},
+    {0x00FB, 2679, 11, 0, 11, 13, 0, 0},
+    {0x00FC, 2697, 11, 0, 11, 12, 0, 0},
+    {0x00FD, 2714, 10, 0, 10, 18, 0, -4},
+    {0x00FE, 2737, 11, 0, 10, 17, 0, -4},
+    {0x00FF, 2759, 10, 0, 10, 16, 0, -4},
+    {0x0131, 2779, 6, 0, 5, 9, 0, 0},
+    {0x0141, 2785, 12, 0, 11, 13, 1, 0},
+    {0x0142, 2803, 6, 0, 5, 13, 0, 0},
+    {0x0152, 2812, 20, 0, 18, 13, 1, 0},
+    {0x0153, 2842, 15, 0, 14, 9, 1, 0},
+    {0x0160, 2858, 10, 0, 8, 17, 1, 0},
+    {0x0161, 2875, 8, 0, 6, 13, 1, 0},
+    {0x0178, 2885, 12, 0, 12, 16, 0, 0},
+    {0x017D, 2909, 11, 0, 11, 17, 0, 0},
+    {0x017E, 2933, 9, 0, 8, 13, 0, 0},
+    {0x0192, 2946, 9, 0, 10, 17, -1, -4},
+    {0x02C6, 2968, 5, 0, 6, 3, -1, 10},
+    {0x02C7, 2971, 5, 0, 6, 3, -1, 10},
+    {0x02D8, 2974, 5, 0, 5, 3, 0, 10},
+    {0x02D9, 2976, 5, 0, 2, 2, 1, 10},
+    {0x02DA, 2977, 5, 0, 3, 4, 1, 10},
+    {0x02DB, 2979, 5, 0, 4, 4, 0, -4},
+    {0x02DC, 2981, 5, 0, 6, 2, -1, 11},
+    {0x02DD, 2983, 5, 0, 7, 3, 0, 10},
+    {0x2013, 2986, 9, 0, 9, 2, 0, 3},
+    {0x2014, 2989, 17, 0, 13, 2, 2, 3},
+    {0x2018, 2993, 4, 0, 3, 6, 0, 7},
+    {0x2019, 2996, 4, 0, 3, 6, 0, 7},
+    {0x201A, 2999, 4, 0, 3, 6, 0, -3},
+    {0x201C, 3002, 8, 0, 7, 6, 1, 7},
+    {0x201D, 3008, 8, 0, 7, 6, 1, 7},
+    {0x201E, 3014, 8, 0, 7, 6, 1, -3},
+    {0x2020, 3020, 9, 0, 8, 15, 1, -2},
+    {0x2021, 3035, 9, 0, 8, 16, 1, -3},
+    {0x2022, 3051, 9, 0, 6, 7, 1, 3},
+    {0x2026, 3057, 17, 0, 15, 3, 1, 0},
+    {0x2030, 3063, 17, 0, 17, 13, 0, 0},
+    {0x2039, 3091, 4, 0, 4, 6, 0, 1},
+    {0x203A, 3094, 4, 0, 4, 6, 0, 1},
+    {0x2044, 3097, 3, 0, 9, 13, -3, 0},
+    {0x2122, 3112, 17, 0, 17, 7, 0, 5},
+    {0x2212, 3127, 10, 0, 8, 2, 1, 3},
+    {0xFB00, 3129, 12, 0, 14, 13, 0, 0},
+    {0xFB01, 3152, 11, 0, 11, 13, 0, 0},
+    {0xFB02, 3170, 11, 0, 11, 13, 0, 0},
+    {0xFB03, 3188, 17, 0, 17, 13, 0, 0},
+    {0xFB04, 3216, 17, 0, 17, 13, 0, 0},
+};
+
+static constexpr uint8_t bailleul_bold_12_pt_bitmaps[3245] = "\xfe\x18\x61\x86\x18\x61\x86\x18\x7f\x7f\xf4\x92"
+                                                             "\x41\x7e\x94\xe5\x29\x48\x1b\x09\x84\xc2\x67\xfb"
+                                                             "\x90\xc8\x64\xff\x73\x09\x84\x82\x40\x08\x04\x0f"
+                                                             "\x8d\x64\x93\x49\xe0\xfc\x3f\x07\xc2\xf1\x34\x9a"
+                                                             "\x49\xf8\x10\x70\x66\xc2\x22\x21\x11\x08\x90\x6c"
+                                                             "\x81\xc8\x00\x4e\x04\xd8\x44\x42\x22\x21\x33\x07"
+                                                             "\x00\x0f\x01\x90\x39\x01\xa0\x1c\xf3\xc4\x4e\x4c"
+                                                             "\xe4\xc7\x9c\x79\xe3\x9e\x3d\x7d\xe0\xff\xa0\x08"
+                                                             "\x88\xcc\x63\x18\xc6\x31\x86\x30\xc1\xc0\x83\x06"
+                                                             "\x18\x71\xc3\x0c\x71\xc6\x18\xc2\x30\x65\x7e\x4d"
+                                                             "\xa8\x18\x18\x18\xff\xff\x18\x18\x18\x18\xdf\x95"
+                                                             "\x00\xff\xc0\xdf\x00\x06\x18\x30\xc1\x83\x0c\x18"
+                                                             "\x20\xc1\x82\x0c\x00\x38\x64\xc6\xc6\xc7\xc7\xc7"
+                                                             "\xc7\xc7\xc6\xc6\x64\x38\x10\xc7\x2c\x30\xc3\x0c"
+                                                             "\x30\xc3\x0c\xfc\x3e\x21\x90\xec\x77\x39\x18\x0c"
+                                                             "\x08\x08\x08\x48\x2f\xef\xf0\x3e\x33\x98\xc0\x60"
+                                                             "\x70\x30\xf0\x06\x03\x81\xf8\xe8\x63\xe0\x06\x03"
+                                                             "\x03\x81\xc1\x61\x30\x98\x8d\xff\x83\x41\xa0\xc0"
+                                                             "\x60\x02\xf9\xf2\x04\x10\x2f\x67\x86\x0c\x1c\x38"
+                                                             "\xef\x00\x1c\x62\x66\xe2\xc0\xdc\xe6\xc7\xc7\xc7"
+                                                             "\xc6\x66\x3c\x7f\xfe\x82\x84\x04\x0c\x08\x18\x18"
+                                                             "\x18\x38\x38\x38\x3c\x46\xc2\xc2\xf6\x7c\x3e\xcf"
+                                                             "\xc7\xc3\xc2\xc2\x3c\x38\x64\xc6\xc6\xc7\xc7\xc7"
+                                                             "\xe7\x3e\x06\xc6\xcc\x78\xdf\x00\x37\xc0\xdf\x00"
+                                                             "\x37\xe5\x40\x01\x03\x1e\x78\xe0\xf0\x3c\x07\x01"
+                                                             "\xff\xff\x00\x00\xff\xff\x80\xe0\x78\x1e\x03\x0f"
+                                                             "\x3c\xf0\x80\x79\x9b\x38\x70\xe1\x86\x10\x20\x00"
+                                                             "\xc3\x83\x00\x0f\x83\x8c\x60\x6c\x7f\xcc\x9c\x89"
+                                                             "\x98\x99\x9b\xdb\x2c\xdc\x60\x03\x8c\x0f\x80\x02"
+                                                             "\x00\x60\x06\x00\x70\x0f\x00\xb0\x13\x81\x38\x1f"
+                                                             "\x82\x1c\x21\xc2\x0c\xf3\xf0\xff\x8e\x31\xc7\x38"
+                                                             "\xe7\x18\xe3\x1f\xc3\x8e\x70\xce\x1d\xc3\x38\xef"
+                                                             "\xf8\x0f\x86\x0d\xc0\xb0\x1e\x03\xc0\x38\x07\x00"
+                                                             "\xe0\x2c\x05\x80\x98\x30\xfc\xff\x83\x87\x1c\x1c"
+                                                             "\xe0\xe7\x03\xb8\x1d\xc0\xee\x07\x70\x3b\x83\x9c"
+                                                             "\x1c\xe1\xcf\xf8\x00\xff\xdc\x37\x05\xc1\x72\x1c"
+                                                             "\x87\xe1\xc8\x72\x1c\x17\x05\xc1\xff\xc0\xff\xe7"
+                                                             "\x0c\xe0\x9c\x53\x88\x72\x0f\xc1\xc8\x38\x87\x10"
+                                                             "\xe0\x1c\x0f\xc0\x0f\xc1\x81\x1c\x08\xc0\x2e\x00"
+                                                             "\x70\x03\x83\xfc\x0e\xe0\x73\x03\x98\x1c\x60\xe0"
+                                                             "\xf8\x00\xf9\xfb\x83\x1c\x18\xe0\xc7\x06\x38\x31"
+                                                             "\xff\x8e\x0c\x70\x63\x83\x1c\x18\xe0\xcf\x9f\x80"
+                                                             "\xfb\x9c\xe7\x39\xce\x73\x9c\xef\x80\x3f\x0e\x0e"
+                                                             "\x0e\x0e\x0e\x0e\x0e\x0e\x4e\xce\xcc\x78\xf9\xe3"
+                                                             "\x84\x1c\x40\xe4\x07\x20\x3b\x01\xfc\x0e\xe0\x73"
+                                                             "\x83\x9e\x1c\x70\xe1\xcf\x9f\x80\xf8\x0e\x01\xc0"
+                                                             "\x38\x07\x00\xe0\x1c\x03\x80\x70\x2e\x05\xc0\xb8"
+                                                             "\x3f\xfe\xf8\x0f\x38\x1e\x3c\x1e\x3c\x2e\x2e\x2e"
+                                                             "\x2e\x2e\x2e\x4e\x27\x4e\x27\x8e\x23\x8e\x23\x0e"
+                                                             "\x23\x0e\xf1\x3f\xfc\x3c\xf0\x42\xe1\x0b\xc4\x27"
+                                                             "\x90\x8e\x42\x1d\x08\x7c\x20\xf0\x81\xc2\x03\x08"
+                                                             "\x0c\xf8\x10\x0f\x81\x83\x1c\x1c\xc0\x6e\x03\xf0"
+                                                             "\x1f\x80\xfc\x07\xe0\x3b\x01\x9c\x1c\x60\xc0\xf8"
+                                                             "\x00\xff\x8e\x39\xc3\xb8\x77\x0e\xe3\x9f\xc3\x80"
+                                                             "\x70\x0e\x01\xc0\x38\x0f\xc0\x0f\x81\x83\x1c\x18"
+                                                             "\xc0\xee\x03\x70\x1f\x80\xfc\x07\xe0\x3b\x01\x98"
+                                                             "\x1c\x60\xc1\x8c\x07\xc0\x7e\x22\x1f\x00\x70\xff"
+                                                             "\x07\x18\x71\xc7\x1c\x71\x87\x10\x7e\x07\x18\x71"
+                                                             "\xc7\x1c\x71\xc7\x0c\xfc\xf0\x3e\x42\xc2\xc1\xf0"
+                                                             "\xfc\x7e\x1f\x07\x83\x81\xc2\x7c\xff\xf1\xc6\x38"
+                                                             "\xc7\x10\xe0\x1c\x03\x80\x70\x0e\x01\xc0\x38\x07"
+                                                             "\x03\xf0\xfc\x79\xc0\x8e\x04\x70\x23\x81\x1c\x08"
+                                                             "\xe0\x47\x02\x38\x11\xc0\x8e\x04\x70\x40\xfc\x00"
+                                                             "\xfc\xf3\x84\x38\x43\x84\x1c\x81\xc8\x1c\x80\xf0"
+                                                             "\x0f\x00\xe0\x06\x00\x60\x04\x00\xfc\xfc\xe7\x0f"
+                                                             "\x08\xe2\xe1\x1c\x5c\x41\x89\xc8\x39\x39\x07\x47"
+                                                             "\x40\x68\x68\x0e\x0e\x01\xc1\xc0\x18\x18\x02\x03"
+                                                             "\x00\x40\x40\xfc\xe3\x88\x3c\x81\xd0\x0e\x00\xe0"
+                                                             "\x07\x00\x70\x0b\x81\x38\x11\xc2\x1e\xf3\xf0\xfc"
+                                                             "\xf3\x84\x1c\x41\xc8\x0e\x80\xf0\x06\x00\x60\x06"
+                                                             "\x00\x60\x06\x00\x60\x1f\x80\x7f\xec\x39\x07\x21"
+                                                             "\xc0\x70\x0e\x03\x80\x70\x1c\x07\x04\xe0\xb8\x3f"
+                                                             "\xfe\xfe\x31\x8c\x63\x18\xc6\x31\x8c\x63\x18\xf8"
+                                                             "\xc0\x81\x83\x02\x06\x0c\x0c\x18\x30\x30\x60\x60"
+                                                             "\xf8\xc6\x31\x8c\x63\x18\xc6\x31\x8c\x63\xf8\x18"
+                                                             "\x38\x38\x2c\x64\x46\xc3\xff\x80\x8c\x63\x7e\x63"
+                                                             "\x31\xc3\xe6\x76\x3b\x1d\x8e\x7f\x80\xf0\x1c\x07"
+                                                             "\x01\xc0\x7f\x1c\x67\x1d\xc7\x71\xdc\x77\x1d\xc6"
+                                                             "\x7f\x00\x3e\x66\xc6\xc0\xc0\xc0\xe1\x62\x3c\x07"
+                                                             "\x00\xc0\x30\x0c\x3b\x19\xcc\x33\x0c\xc3\x30\xcc"
+                                                             "\x31\x8c\x7f\xc0\x3c\x66\xc7\xff\xc0\xc0\xe1\x62"
+                                                             "\x3c\x1e\x37\x33\x70\xf8\x70\x70\x70\x70\x70\x70"
+                                                             "\x70\xf8\x3d\xb3\x59\x8c\xc6\x65\xc2\x01\xfe\x7f"
+                                                             "\x61\xa0\x50\x67\xc0\xf0\x06\x00\xc0\x18\x03\x78"
+                                                             "\x73\x0c\x71\x8e\x31\xc6\x38\xc7\x18\xef\xbe\x31"
+                                                             "\x8c\x0f\x18\xc6\x31\x8c\x6f\x80\x33\x30\xf3\x33"
+                                                             "\x33\x33\x33\x37\xc0\xf0\x06\x00\xc0\x18\x03\x38"
+                                                             "\x64\x0c\x81\xb0\x3f\x06\xe0\xce\x18\xcf\xbe\xf1"
+                                                             "\x8c\x63\x18\xc6\x31\x8c\x6f\x80\xf7\xbc\x1c\xe3"
+                                                             "\x0c\x71\x86\x38\xc3\x1c\x61\x8e\x30\xc7\x18\x63"
+                                                             "\x8c\xfb\xef\x80\xf7\x87\x30\xc7\x18\xe3\x1c\x63"
+                                                             "\x8c\x71\x8e\xfb\xe0\x3c\x31\xb0\xd8\x7c\x3e\x1f"
+                                                             "\x0c\xc6\x3c\x00\xf7\x0e\x63\x0c\xc3\x30\xcc\x33"
+                                                             "\x0c\xc6\x3f\x0c\x03\x00\xc0\xf8\x00\x3b\x19\xcc"
+                                                             "\x33\x0c\xc3\x30\xcc\x31\x8c\x3f\x00\xc0\x30\x0c"
+                                                             "\x07\xc0\xf6\x3b\x33\x30\x30\x30\x30\x30\xf8\x7a"
+                                                             "\x2c\x7e\x7c\xf8\xe3\xf8\x30\xcf\xcc\x30\xc3\x0c"
+                                                             "\x30\xc3\xc0\xf3\xc6\x38\xc7\x18\xe3\x1c\x63\x8c"
+                                                             "\x71\x8e\x1f\xe0\xf9\xdc\x43\x90\xe4\x1a\x07\x80"
+                                                             "\xc0\x30\x08\x00\xfb\xee\x63\x88\xcb\x21\xd7\x41"
+                                                             "\xa6\x83\x8e\x07\x1c\x04\x10\x08\x20\xff\x8e\x41"
+                                                             "\xe0\x70\x0e\x03\x81\x70\x8c\xf7\xc0\xf9\xcc\x43"
+                                                             "\x90\xe4\x1e\x07\x80\xc0\x30\x0c\x01\x0e\x83\x20"
+                                                             "\x70\x00\x7f\x46\x4e\x1c\x1c\x38\x39\x71\xff\x3b"
+                                                             "\x18\xc6\x31\x8c\xc3\x18\xc6\x31\x8c\x38\xff\xff"
+                                                             "\xff\xff\xf0\xe1\x8c\x63\x18\xc6\x19\x8c\x63\x18"
+                                                             "\xc6\xe0\x72\xff\x8e\xfd\x04\x92\x5f\xfe\x10\x10"
+                                                             "\x3e\x76\xf6\xd0\xd0\xd0\xf1\x72\x3c\x10\x10\x0e"
+                                                             "\x09\x84\xc6\x03\x01\xc1\xf8\x30\x18\x0c\x44\x3f"
+                                                             "\xe4\xf0\xdf\xbf\xd8\xe8\x3c\x1a\x0d\x8e\xff\xdf"
+                                                             "\x80\xfc\xe7\x08\xe2\x0e\x41\xd0\x1e\x03\x81\xfc"
+                                                             "\x0e\x07\xf0\x38\x07\x01\xf8\xff\x00\x3f\xc0\x3c"
+                                                             "\x46\xc6\xc2\xe0\xb0\xb8\xdc\x6e\x36\x1a\x0d\x05"
+                                                             "\xc5\xc2\xc4\x78\xed\xb0\x1f\x03\x0c\x60\x6c\x72"
+                                                             "\x98\xb9\x01\xb0\x1b\x01\x90\x3d\x8a\x47\x63\x0c"
+                                                             "\x1f\x80\x39\x33\xf3\xcd\xf0\x12\x4b\xf3\x62\x42"
+                                                             "\x40\xff\xff\x01\x01\x01\xe0\x7a\xda\xed\xae\x17"
+                                                             "\x80\xf8\x74\x63\x17\x00\x18\x18\xff\xff\x18\x18"
+                                                             "\x00\xff\xff\x79\x30\xc2\x35\x1f\x80\x7c\x18\xe0"
+                                                             "\x60\x78\x9e\x00\x23\x68\xf3\xc6\x38\xc7\x18\xe3"
+                                                             "\x1c\x63\x8c\x71\x8e\x7f\xec\x01\x80\x38\x06\x00"
+                                                             "\x3f\xbc\x9e\x5f\x27\x93\xc8\xe4\x0a\x05\x02\x81"
+                                                             "\x40\xe0\x71\xd8\xb8\x30\xdf\x00\x46\x3e\x2e\x22"
+                                                             "\x22\xf0\x39\x3c\xf3\x4c\xe0\x90\x90\xd9\xb4\x92"
+                                                             "\x00\x20\x46\x04\xe0\x86\x10\x61\x06\x22\x62\x26"
+                                                             "\x46\xf4\xe0\x96\x11\xf1\x07\x20\x60\x00\x43\x04"
+                                                             "\x38\x20\xc2\x06\x10\x31\x71\x94\x5e\xb2\x08\x90"
+                                                             "\x41\x04\x10\x21\x12\x1f\x30\x00\x30\x22\x41\x12"
+                                                             "\x10\x31\x03\x08\x06\x81\x34\x59\xc6\x72\x70\x25"
+                                                             "\x82\x3e\x10\x71\x03\x00\x18\x38\x60\x00\x81\x0c"
+                                                             "\x30\x61\xc3\x9b\x33\xc0\x08\x01\xc0\x0c\x00\x30"
+                                                             "\x00\x00\x20\x06\x00\x60\x07\x00\xf0\x0b\x01\x38"
+                                                             "\x13\x81\xf8\x21\xc2\x1c\x20\xcf\x3f\x00\x80\x18"
+                                                             "\x03\x00\x60\x00\x00\x20\x06\x00\x60\x07\x00\xf0"
+                                                             "\x0b\x01\x38\x13\x81\xf8\x21\xc2\x1c\x20\xcf\x3f"
+                                                             "\x06\x00\xf0\x18\x80\x00\x02\x00\x60\x06\x00\x70"
+                                                             "\x0f\x00\xb0\x13\x81\x38\x1f\x82\x1c\x21\xc2\x0c"
+                                                             "\xf3\xf0\x0e\x81\x38\x00\x00\x00\x02\x00\x60\x06"
+                                                             "\x00\x70\x0f\x00\xb0\x13\x81\x38\x1f\x82\x1c\x21"
+                                                             "\xc2\x0c\xf3\xf0\x1d\x80\x98\x00\x00\x20\x06\x00"
+                                                             "\x60\x07\x00\xf0\x0b\x01\x38\x13\x81\xf8\x21\xc2"
+                                                             "\x1c\x20\xcf\x3f\x06\x00\x90\x09\x00\x60\x02\x00"
+                                                             "\x60\x06\x00\x70\x0f\x00\xb0\x13\x81\x38\x1f\x82"
+                                                             "\x1c\x21\xc2\x0c\xf3\xf0\x03\xff\x01\x60\x80\xb0"
+                                                             "\x40\x98\x10\x4c\x40\x26\x60\x23\xf0\x11\x98\x1f"
+                                                             "\xc4\x08\x62\x48\x30\x24\x18\x3f\x3f\xf8\x0f\x86"
+                                                             "\x0d\xc0\xb0\x1e\x03\xc0\x38\x07\x00\xe0\x2c\x05"
+                                                             "\x80\x98\x30\xdc\x04\x00\xc0\x0c\x07\x00\x10\x0e"
+                                                             "\x01\x80\x18\x00\x3f\xf7\x0d\xc1\x70\x5c\x87\x21"
+                                                             "\xf8\x72\x1c\x87\x05\xc1\x70\x7f\xf0\x01\x00\xc0"
+                                                             "\x60\x30\x00\x3f\xf7\x0d\xc1\x70\x5c\x87\x21\xf8"
+                                                             "\x72\x1c\x87\x05\xc1\x70\x7f\xf0\x0c\x07\x83\x30"
+                                                             "\x00\xff\xdc\x37\x05\xc1\x72\x1c\x87\xe1\xc8\x72"
+                                                             "\x1c\x17\x05\xc1\xff\xc0\x33\x0c\xc0\x03\xff\x70"
+                                                             "\xdc\x17\x05\xc8\x72\x1f\x87\x21\xc8\x70\x5c\x17"
+                                                             "\x07\xff\x86\x18\x60\x7d\xce\x73\x9c\xe7\x39\xce"
+                                                             "\x77\xc0\x08\xcc\xc0\x7d\xce\x73\x9c\xe7\x39\xce"
+                                                             "\x77\xc0\x72\xa2\x0f\xb9\xce\x73\x9c\xe7\x39\xce"
+                                                             "\xf8\xde\xc1\xf7\x39\xce\x73\x9c\xe7\x39\xdf\xff"
+                                                             "\x83\x87\x1c\x1c\xe0\xe7\x03\xb8\x1f\xf8\xee\x07"
+                                                             "\x70\x3b\x83\x9c\x1c\xe1\xcf\xf8\x00\x06\x40\x2f"
+                                                             "\x00\x00\x00\x00\xfc\x3c\xf0\x42\xe1\x0b\xc4\x27"
+                                                             "\x90\x8e\x42\x1d\x08\x7c\x20\xf0\x81\xc2\x03\x08"
+                                                             "\x0c\xf8\x10\x08\x00\x60\x01\x80\x06\x00\xf8\x18"
+                                                             "\x31\xc1\xcc\x06\xe0\x3f\x01\xf8\x0f\xc0\x7e\x03"
+                                                             "\xb0\x19\xc1\xc6\x0c\x0f\x80\x00\x80\x06\x00\x60"
+                                                             "\x04\x00\xf8\x18\x31\xc1\xcc\x06\xe0\x3f\x01\xf8"
+                                                             "\x0f\xc0\x7e\x03\xb0\x19\xc1\xc6\x0c\x0f\x80\x07"
+                                                             "\x00\x28\x02\x20\x1f\x03\x06\x38\x39\x80\xdc\x07"
+                                                             "\xe0\x3f\x01\xf8\x0f\xc0\x76\x03\x38\x38\xc1\x81"
+                                                             "\xf0\x0e\x40\x9c\x00\x00\x1f\x03\x06\x38\x39\x80"
+                                                             "\xdc\x07\xe0\x3f\x01\xf8\x0f\xc0\x76\x03\x38\x38"
+                                                             "\xc1\x81\xf0\x1d\x80\x6c\x03\xe0\x60\xc7\x07\x30"
+                                                             "\x1b\x80\xfc\x07\xe0\x3f\x01\xf8\x0e\xc0\x67\x07"
+                                                             "\x18\x30\x3e\x00\xc3\x67\x3e\x1c\x3c\x76\xe3\x42"
+                                                             "\x0f\x89\x83\x9c\x1c\xc0\xee\x0b\xf0\x9f\x88\xfc"
+                                                             "\x87\xe8\x3b\x81\x9c\x1c\xe0\xc8\xf8\x00\x04\x00"
+                                                             "\x70\x01\x80\x02\x00\x00\x7e\x3c\xe0\x47\x02\x38"
+                                                             "\x11\xc0\x8e\x04\x70\x23\x81\x1c\x08\xe0\x47\x02"
+                                                             "\x38\x20\x7e\x00\x00\x40\x06\x00\x60\x06\x00\x00"
+                                                             "\x7e\x3c\xe0\x47\x02\x38\x11\xc0\x8e\x04\x70\x23"
+                                                             "\x81\x1c\x08\xe0\x47\x02\x38\x20\x7e\x00\x03\x00"
+                                                             "\x3c\x02\x30\x00\x0f\xc7\x9c\x08\xe0\x47\x02\x38"
+                                                             "\x11\xc0\x8e\x04\x70\x23\x81\x1c\x08\xe0\x47\x04"
+                                                             "\x0f\xc0\x0c\xc0\x66\x00\x01\xf8\xf3\x81\x1c\x08"
+                                                             "\xe0\x47\x02\x38\x11\xc0\x8e\x04\x70\x23\x81\x1c"
+                                                             "\x08\xe0\x81\xf8\x00\x80\x18\x01\x80\x60\x00\x0f"
+                                                             "\xcf\x38\x41\xc4\x1c\x80\xe8\x0f\x00\x60\x06\x00"
+                                                             "\x60\x06\x00\x60\x06\x01\xf8\xf8\x0e\x01\xfe\x38"
+                                                             "\xe7\x0e\xe1\xdc\x3b\x87\x71\xcf\xe1\xc0\x38\x0f"
+                                                             "\x80\x1f\x0c\x63\x1c\xc6\x31\x8d\x83\x18\xc7\x31"
+                                                             "\xcc\x73\x1c\xd7\xfb\x80\x20\x30\x0c\x01\x00\x03"
+                                                             "\xf3\x19\x8e\x1f\x33\xb1\xd8\xec\x73\xfc\x02\x03"
+                                                             "\x03\x03\x00\x03\xf3\x19\x8e\x1f\x33\xb1\xd8\xec"
+                                                             "\x73\xfc\x18\x1e\x19\x80\x07\xe6\x33\x1c\x3e\x67"
+                                                             "\x63\xb1\xd8\xe7\xf8\x32\x2f\x00\x00\x07\xe6\x33"
+                                                             "\x1c\x3e\x67\x63\xb1\xd8\xe7\xf8\x66\x33\x00\x0f"
+                                                             "\xcc\x66\x38\x7c\xce\xc7\x63\xb1\xcf\xf0\x18\x12"
+                                                             "\x09\x03\x00\x03\xf3\x19\x8e\x1f\x33\xb1\xd8\xec"
+                                                             "\x73\xfc\x7d\xe6\x39\x91\x86\x7f\xfe\x60\x63\x03"
+                                                             "\x1c\x39\x62\x71\xe0\x3c\x66\xc6\xc0\xc0\xc0\xe1"
+                                                             "\x62\x3c\x08\x1c\x04\x3c\x20\x30\x30\x0c\x00\x3c"
+                                                             "\x66\xc7\xff\xc0\xc0\xe1\x62\x3c\x02\x06\x0c\x18"
+                                                             "\x00\x3c\x66\xc7\xff\xc0\xc0\xe1\x62\x3c\x18\x3c"
+                                                             "\x66\x00\x3c\x66\xc7\xff\xc0\xc0\xe1\x62\x3c\x66"
+                                                             "\x66\x00\x3c\x66\xc7\xff\xc0\xc0\xe1\x62\x3c\x86"
+                                                             "\x18\x60\x78\xc6\x31\x8c\x63\x7c\x08\xc6\xc0\x78"
+                                                             "\xc6\x31\x8c\x63\x7c\x31\xe8\xc0\xf0\xc3\x0c\x30"
+                                                             "\xc3\x0c\xf8\xdf\x30\x3c\x30\xc3\x0c\x30\xc3\x3e"
+                                                             "\x02\x3e\x0f\x09\xc0\x61\xf9\x8d\x87\xc3\xe1\xf0"
+                                                             "\xd8\x66\x31\xe0\x1c\x82\xe0\x00\x00\x0f\x78\x73"
+                                                             "\x0c\x71\x8e\x31\xc6\x38\xc7\x18\xef\xbe\x20\x18"
+                                                             "\x0c\x01\x80\x01\xe1\x8d\x86\xc3\xe1\xf0\xf8\x66"
+                                                             "\x31\xe0\x02\x03\x03\x03\x00\x01\xe1\x8d\x86\xc3"
+                                                             "\xe1\xf0\xf8\x66\x31\xe0\x18\x1e\x18\x80\x03\xc3"
+                                                             "\x1b\x0d\x87\xc3\xe1\xf0\xcc\x63\xc0\x32\x2f\x00"
+                                                             "\x00\x03\xc3\x1b\x0d\x87\xc3\xe1\xf0\xcc\x63\xc0"
+                                                             "\x76\x33\x00\x07\x86\x36\x1b\x0f\x87\xc3\xe1\x98"
+                                                             "\xc7\x80\x18\x1c\x18\x00\xff\xff\x00\x18\x1c\x18"
+                                                             "\x3c\xb1\xb0\xd8\xfc\xbe\x9f\x8c\xc6\xbc\x00\x10"
+                                                             "\x03\x00\x30\x03\x00\x01\xe7\x8c\x71\x8e\x31\xc6"
+                                                             "\x38\xc7\x18\xe3\x1c\x3f\xc0\x01\x00\x60\x0c\x06"
+                                                             "\x00\x01\xe7\x8c\x71\x8e\x31\xc6\x38\xc7\x18\xe3"
+                                                             "\x1c\x3f\xc0\x0e\x01\x40\x44\x00\x0f\x3c\x63\x8c"
+                                                             "\x71\x8e\x31\xc6\x38\xc7\x18\xe1\xfe\x1b\x03\x60"
+                                                             "\x00\x79\xe3\x1c\x63\x8c\x71\x8e\x31\xc6\x38\xc7"
+                                                             "\x0f\xf0\x01\x00\xc0\x60\x30\x00\x3e\x73\x10\xe4"
+                                                             "\x39\x07\x81\xe0\x30\x0c\x03\x00\x43\xa0\xc8\x1c"
+                                                             "\x00\xf0\x0c\x03\x00\xc0\x37\x0e\x63\x0c\xc3\x30"
+                                                             "\xcc\x33\x0c\xc6\x3f\x0c\x03\x00\xc0\xf8\x00\x33"
+                                                             "\x0c\xc0\x03\xe7\x31\x0e\x43\x90\x78\x1e\x03\x00"
+                                                             "\xc0\x30\x04\x3a\x0c\x81\xc0\xf1\x8c\x63\x18\xc6"
+                                                             "\xf8\xf8\x0e\x01\xc8\x39\x07\xc0\xf0\x1c\x07\x80"
+                                                             "\xf0\x3e\x05\xc0\xb8\x3f\xfe\xf1\x8c\x73\x99\xd6"
+                                                             "\x31\x8c\x6f\x80\x0f\xff\xcc\x38\x37\x06\x05\x81"
+                                                             "\x81\xe0\x62\x38\x18\x8e\x07\xe3\x81\x88\xe0\x62"
+                                                             "\x18\x18\x17\x06\x04\xc3\x83\x0f\xff\xc0\x3c\xf1"
+                                                             "\x9c\x6c\x31\xf0\xff\xc3\x03\x0c\x0c\x30\x59\xe2"
+                                                             "\x3c\xf0\x66\x3c\x18\x00\x3e\x42\xc2\xc1\xf0\xfc"
+                                                             "\x7e\x1f\x07\x83\x81\xc2\x7c\xcd\xe3\x00\x7a\x2c"
+                                                             "\x7e\x7c\xf8\xe3\xf8\x0d\xc0\xc8\x00\x0f\xcf\x38"
+                                                             "\x41\xc4\x1c\x80\xe8\x0f\x00\x60\x06\x00\x60\x06"
+                                                             "\x00\x60\x06\x01\xf8\x11\x81\x40\x18\x00\x07\xfe"
+                                                             "\xc3\x90\x72\x1c\x07\x00\xe0\x38\x07\x01\xc0\x70"
+                                                             "\x4e\x0b\x83\xff\xe0\x62\x3c\x18\x00\x7f\x46\x4e"
+                                                             "\x1c\x1c\x38\x39\x71\xff\x01\xc0\x90\x6c\x18\x06"
+                                                             "\x01\x81\xf8\x38\x0e\x03\x80\xc0\x30\x0c\x03\x04"
+                                                             "\xc3\x20\x70\x00\x30\xac\x40\xc4\xa3\x00\x8c\x5c"
+                                                             "\xf0\xd6\xe0\x6c\xd6\x76\x70\x32\xcf\x60\xff\xff"
+                                                             "\xc0\xff\xff\xff\xc0\x2a\x7e\xc0\x7d\x92\x80\x7d"
+                                                             "\x92\x80\x45\x12\x26\x6e\xf9\x80\xcd\xdf\xb9\x14"
+                                                             "\x51\x00\xcd\xdb\xb9\x14\x51\x00\x18\x38\x18\x18"
+                                                             "\xd2\xff\x10\x10\x10\x18\x18\x18\x38\x38\x38\x18"
+                                                             "\x38\x18\x10\xd2\xff\x10\x10\x10\x10\xff\xd2\x10"
+                                                             "\x18\x38\x18\x11\xef\xff\xfd\xf3\x80\x61\x0d\xc7"
+                                                             "\x1d\x8e\x30\x70\x40\x64\x40\x32\x40\x19\x20\x04"
+                                                             "\xa0\x01\x90\x00\x10\x00\x0b\x8c\x0a\x69\x05\x34"
+                                                             "\xc4\x9a\x64\x4d\x36\x1c\x70\x12\xe6\x21\x86\x33"
+                                                             "\x68\x01\x80\x80\x80\x40\x40\x20\x20\x20\x10\x10"
+                                                             "\x08\x08\x0c\x00\xff\xc3\xc9\x71\x84\x39\xc2\x16"
+                                                             "\xe1\x0b\xb0\x84\x98\xe3\x5e\xff\xff\x1c\x78\xcb"
+                                                             "\x73\x3c\x9c\x70\xfb\xe1\xc7\x07\x1c\x1c\x70\x71"
+                                                             "\xc1\xc7\x07\x1c\x1c\x70\xfb\xe0\x1f\x06\x70\xc4"
+                                                             "\x18\x0f\xbc\xe3\x9c\x73\x8e\x71\xce\x39\xc7\x38"
+                                                             "\xef\xbe\x0f\xc6\x38\xc7\x18\xef\x9c\xe3\x9c\x73"
+                                                             "\x8e\x71\xce\x39\xc7\x38\xef\xbe\x1c\x7c\x19\x67"
+                                                             "\x0c\xb0\x0e\x38\x0f\xbe\xf3\x8e\x39\xc7\x1c\xe3"
+                                                             "\x8e\x71\xc7\x38\xe3\x9c\x71\xce\x38\xef\xbe\xf8"
+                                                             "\x1c\x3f\x19\x63\x8c\xb1\xce\x38\xef\xbe\x73\x8e"
+                                                             "\x39\xc7\x1c\xe3\x8e\x71\xc7\x38\xe3\x9c\x71\xce"
+                                                             "\x38\xef\xbe\xf8";
+
+constexpr Font bailleul_bold_12_pt = {
+    .size = 12,
+    .numCharacters = 232,
+    .boundingBoxWidth = 22,
+    .boundingBoxHeight = 22,
+    .boundingBoxXOffset = -3,
+    .boundingBoxYOffset = -4,
+    .ascent = 16,
+    .descent = 4,
+    .asciiIndex = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                   28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+                   53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+                   78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95},
+    .characters = bailleul_bold_12_pt_characters,
+    .bitmaps = bailleul_bold_12_pt_bitmaps,
+};
 
 // bailleul_bold
 //   - Copyright (c) 2019 Yomli  Copyright (c) 1850 Bailleul et Cie  Copyright (c) 1800 Justus Erich Walbaum"
 //   - Size: 16
 //   - Characters: 232
-uint8_t bailleul_bold_16_pt[7418] = "\x10\x00\xe8\x1d\x1b\xfc\xfa\x15\x05\x00\x00\x00\x1a\x09\x10\x08\x10\x00\x00\xff"
-                                    "\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\xff\x00\x20\x00\x0a\x06"
-                                    "\x00\x00\x00\x00\x00\x00\x21\x00\x12\x07\x00\x04\x10\x01\x00\x67\x77\x76\x66\x62"
-                                    "\x22\x07\xf7\x00\x22\x00\x10\x0b\x00\x06\x07\x02\x09\xcf\x3c\xf3\xcd\x14\x40\x00"
-                                    "\x23\x00\x20\x0c\x00\x0b\x10\x01\x00\x19\x83\x30\x66\x0c\xc1\x19\xff\xff\xf9\x98"
-                                    "\x33\x06\x63\xff\x7f\xe6\x30\xc4\x19\x83\x30\x00\x24\x00\x26\x0c\x00\x0b\x14\x01"
-                                    "\xfe\x04\x00\x80\xfc\x32\xcc\x4d\x88\xb9\x17\xe0\xfe\x0f\xf0\xff\x03\xe0\x5f\x09"
-                                    "\xe1\x36\x26\xe4\x8f\xe0\x10\x02\x00\x00\x25\x00\x2e\x16\x00\x12\x10\x02\x00\x3c"
-                                    "\x06\x19\x83\x0c\x60\x83\x1c\x40\xc7\x10\x31\x88\x06\x66\x00\xf1\x00\x00\x8f\x00"
-                                    "\x26\x60\x11\x8c\x0c\xe3\x02\x38\xc1\x86\x30\x41\x98\x20\x3c\x00\x26\x00\x2a\x12"
-                                    "\x00\x10\x10\x01\x00\x03\xc0\x0e\x60\x0c\x60\x0e\x40\x0f\x80\x0f\x3f\x0f\x8c\x17"
-                                    "\x88\x63\xc8\xe3\xc8\xe1\xf1\xe1\xf1\xe0\xf1\xf0\xf1\x78\xfe\x3f\x3c\x00\x27\x00"
-                                    "\x0d\x05\x00\x03\x07\x01\x09\xdf\x64\x90\x00\x28\x00\x1e\x0a\x00\x07\x16\x02\xfa"
-                                    "\x02\x08\x30\xc3\x0e\x1c\x70\xe1\xc3\x87\x0e\x1c\x18\x38\x70\x60\x60\x60\x60\x40"
-                                    "\x00\x29\x00\x20\x0a\x00\x08\x16\x00\xfa\x80\x60\x30\x18\x1c\x0c\x0e\x0e\x0f\x07"
-                                    "\x07\x07\x07\x0e\x0e\x0e\x0c\x1c\x18\x30\x60\x80\x00\x2A\x00\x11\x09\x00\x07\x07"
-                                    "\x01\x09\x39\xff\x5f\xf2\x8d\x9b\x00\x00\x2B\x00\x1a\x0d\x00\x0b\x0b\x01\x00\x0e"
-                                    "\x01\xc0\x38\x07\x0f\xff\xff\xc3\x80\x70\x0e\x01\xc0\x38\x00\x00\x2C\x00\x0e\x06"
-                                    "\x00\x04\x07\x01\xfc\x6f\xf1\x12\x40\x00\x2D\x00\x0c\x09\x00\x07\x02\x01\x04\xff"
-                                    "\xfc\x00\x2E\x00\x0c\x06\x00\x04\x03\x01\x00\x6f\x60\x00\x2F\x00\x1a\x09\x00\x08"
-                                    "\x10\x00\x00\x03\x03\x07\x06\x0e\x0c\x0c\x1c\x18\x18\x38\x30\x70\x60\x60\xe0\x00"
-                                    "\x30\x00\x1e\x0c\x00\x0a\x10\x01\x00\x1e\x0c\xc7\x19\x87\xe1\xf8\x7e\x1f\x87\xe1"
-                                    "\xf8\x7e\x1f\x87\x61\xdc\x63\x30\x78\x00\x31\x00\x18\x0c\x00\x07\x10\x03\x00\x08"
-                                    "\x30\xe3\xcb\x87\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7f\x00\x32\x00\x22\x0d\x00\x0c"
-                                    "\x10\x00\x00\x1f\x82\x1c\x40\xe7\x0e\x78\xe3\x0e\x00\xe0\x0c\x01\x80\x30\x04\x00"
-                                    "\x81\x10\x23\xfe\x7f\xcf\xfc\x00\x33\x00\x20\x0d\x00\x0b\x10\x01\x00\x3e\x0c\x71"
-                                    "\x8e\x31\xe0\x38\x07\x01\x81\xf0\x03\x80\x38\x07\x80\xfe\x1f\x83\xb0\xe1\xf0\x00"
-                                    "\x34\x00\x1e\x0c\x00\x0a\x10\x01\x00\x03\x00\xc0\x70\x3c\x1f\x05\xc2\x71\x9c\x47"
-                                    "\x21\xdf\xfc\x1d\x07\x41\xd0\x70\x1c\x00\x35\x00\x20\x0c\x00\x0a\x11\x01\x00\x00"
-                                    "\x8f\xe3\xf1\xf8\x40\x10\x04\x01\x78\x63\x90\xe0\x3c\x0f\x03\xe0\xf8\x39\x0c\x3e"
-                                    "\x00\x00\x36\x00\x1e\x0c\x00\x0a\x10\x01\x00\x0f\x0e\x63\x1d\xc7\x60\xb8\x0e\xf3"
-                                    "\xce\xf1\xf8\x7e\x1f\x87\x61\xdc\x73\x38\x7c\x00\x37\x00\x1e\x0c\x00\x0a\x10\x01"
-                                    "\x00\x7f\xdf\xf7\xfa\x02\x81\x00\x40\x30\x08\x06\x01\x80\xe0\x38\x1c\x07\x01\xc0"
-                                    "\xf0\x00\x38\x00\x1e\x0c\x00\x0a\x10\x01\x00\x1f\x08\x66\x0d\x83\xe0\xde\x67\xf0"
-                                    "\xfe\x2f\xd8\xfc\x1f\x03\xc0\xf8\x36\x18\x78\x00\x39\x00\x1e\x0c\x00\x0a\x10\x01"
-                                    "\x00\x1e\x1c\xc6\x1b\x87\xe1\xf8\x7e\x1f\x87\xe1\xdc\xf3\xdc\x07\x61\x98\xe6\x30"
-                                    "\xf0\x00\x3A\x00\x10\x06\x00\x04\x0b\x01\x00\x6f\x60\x00\x00\x6f\x60\x00\x3B\x00"
-                                    "\x12\x06\x00\x04\x0f\x01\xfc\x6f\xf6\x00\x00\x6f\xf1\x12\x40\x00\x3C\x00\x1a\x0d"
-                                    "\x00\x0b\x0b\x01\x00\x00\x60\x3c\x1f\x1f\x8f\x81\xc0\x3e\x00\xf8\x07\xc0\x3c\x00"
-                                    "\x80\x00\x3D\x00\x14\x0d\x00\x0b\x07\x01\x02\xff\xff\xfc\x00\x00\x00\x01\xff\xff"
-                                    "\xf8\x00\x3E\x00\x1a\x0d\x00\x0b\x0b\x01\x00\xc0\x1e\x01\xf8\x07\xc0\x3e\x01\xc0"
-                                    "\xf8\xfc\x7c\x1e\x03\x00\x00\x00\x3F\x00\x1a\x0b\x00\x08\x10\x02\x00\x7c\xc6\xc7"
-                                    "\xc7\x07\x07\x07\x0e\x18\x10\x20\x20\x00\x30\x78\x30\x00\x40\x00\x2a\x12\x00\x10"
-                                    "\x10\x01\x00\x07\xe0\x1f\xf8\x38\x1c\x70\x06\x61\xdb\xe3\x33\xc6\x33\xc6\x33\xc4"
-                                    "\x33\xcc\x62\xe6\xa4\xe7\x38\x70\x00\x38\x08\x1f\xf8\x07\xe0\x00\x41\x00\x2a\x10"
-                                    "\x00\x10\x10\x00\x00\x01\x80\x01\x80\x01\x80\x03\xc0\x03\xc0\x03\xc0\x05\xe0\x05"
-                                    "\xe0\x08\xf0\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10\x38\x20\x3c\xf8\xff\x00\x42\x00"
-                                    "\x26\x10\x00\x0e\x10\x01\x00\xff\xe0\xe1\xc3\x87\x8e\x1e\x38\x78\xe1\xc3\x86\x0f"
-                                    "\xf0\x38\x70\xe0\xe3\x83\xce\x0f\x38\x3c\xe0\xf3\x87\xbf\xf8\x00\x43\x00\x28\x11"
-                                    "\x00\x0f\x10\x01\x00\x07\xf0\x38\x38\xe0\x31\xc0\x27\x00\x4e\x00\x7c\x00\x78\x00"
-                                    "\xf0\x01\xe0\x01\xc0\x0b\x80\x13\x80\x67\x01\xc7\x07\x83\xf8\x00\x44\x00\x2c\x13"
-                                    "\x00\x11\x10\x01\x00\xff\xf0\x1c\x0e\x0e\x03\x87\x01\xe3\x80\x71\xc0\x3c\xe0\x1e"
-                                    "\x70\x0f\x38\x07\x9c\x03\xce\x01\xe7\x00\xe3\x80\xf1\xc0\x70\xe0\x71\xff\xe0\x00"
-                                    "\x45\x00\x26\x10\x00\x0e\x10\x01\x00\xff\xf8\xe0\x63\x80\x8e\x02\x38\x48\xe1\x03"
-                                    "\x8c\x0f\xf0\x38\xc0\xe1\x03\x84\x4e\x01\x38\x04\xe0\x33\x81\xff\xff\x00\x46\x00"
-                                    "\x26\x0f\x00\x0e\x10\x00\x00\xff\xfc\x70\x71\xc0\x47\x01\x1c\x04\x70\x81\xc2\x07"
-                                    "\x18\x1f\xe0\x71\x81\xc2\x07\x08\x1c\x00\x70\x01\xc0\x3f\xc0\x00\x47\x00\x2e\x13"
-                                    "\x00\x12\x10\x01\x00\x03\xf8\x03\x03\x81\x80\x60\xe0\x08\x70\x02\x1c\x00\x0f\x00"
-                                    "\x03\xc0\x00\xf0\x3f\xfc\x03\xc7\x00\xf1\xc0\x3c\x38\x0f\x0e\x03\xc1\xc1\xe0\x1f"
-                                    "\xc0\x00\x48\x00\x2c\x13\x00\x11\x10\x01\x00\xfe\x7f\x9c\x07\x0e\x03\x87\x01\xc3"
-                                    "\x80\xe1\xc0\x70\xe0\x38\x7f\xfc\x38\x0e\x1c\x07\x0e\x03\x87\x01\xc3\x80\xe1\xc0"
-                                    "\x70\xe0\x39\xfc\xff\x00\x49\x00\x18\x09\x00\x07\x10\x01\x00\xfe\x70\xe1\xc3\x87"
-                                    "\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7f\x00\x4A\x00\x20\x0b\x00\x0b\x10\x00\x00\x1f"
-                                    "\xe0\xf0\x1e\x03\xc0\x78\x0f\x01\xe0\x3c\x07\x80\xf0\x1e\x23\xce\x79\xce\x31\xc3"
-                                    "\xf0\x00\x4B\x00\x2c\x12\x00\x11\x10\x01\x00\xfe\x7e\x1c\x08\x0e\x08\x07\x08\x03"
-                                    "\x88\x01\xc4\x00\xe7\x00\x7f\x80\x39\xe0\x1c\xf0\x0e\x3c\x07\x0f\x03\x87\x81\xc1"
-                                    "\xe0\xe0\xf1\xfc\xff\x00\x4C\x00\x26\x10\x00\x0e\x10\x01\x00\xfe\x00\xe0\x03\x80"
-                                    "\x0e\x00\x38\x00\xe0\x03\x80\x0e\x00\x38\x00\xe0\x03\x80\x4e\x01\x38\x04\xe0\x33"
-                                    "\x81\xff\xff\x00\x4D\x00\x34\x16\x00\x15\x10\x00\x00\xfe\x01\xf8\xf0\x0f\x07\x80"
-                                    "\xb8\x5e\x05\xc2\xf0\x2e\x13\x82\x70\x9e\x13\x84\xf1\x1c\x23\xc8\xe1\x1e\x87\x08"
-                                    "\x74\x38\x43\xe1\xc2\x1e\x0e\x10\x70\x70\x83\x03\x9f\x88\xff\x00\x4E\x00\x2c\x12"
-                                    "\x00\x11\x10\x01\x00\xfc\x1f\x9f\x01\x0f\xc0\x85\xf0\x42\x78\x21\x3e\x10\x8f\x88"
-                                    "\x43\xe4\x20\xf2\x10\x3d\x08\x1f\x84\x07\xc2\x01\xe1\x00\x70\x80\x19\xf0\x0c\x00"
-                                    "\x4F\x00\x2c\x13\x00\x11\x10\x01\x00\x07\xf0\x0e\x0e\x0e\x03\x87\x01\xe7\x00\x73"
-                                    "\x80\x3b\xc0\x1f\xe0\x0f\xf0\x07\xf8\x03\xdc\x01\xce\x00\xe3\x80\xf1\xc0\x70\x70"
-                                    "\x70\x0f\xe0\x00\x50\x00\x26\x10\x00\x0e\x10\x01\x00\xff\xf0\xe0\xe3\x83\xce\x0f"
-                                    "\x38\x3c\xe0\xf3\x83\xce\x1e\x3f\xe0\xe0\x03\x80\x0e\x00\x38\x00\xe0\x03\x80\x3f"
-                                    "\xc0\x00\x51\x00\x37\x13\x00\x12\x14\x01\xfc\x07\xf0\x07\x07\x03\x80\xe0\xe0\x3c"
-                                    "\x70\x07\x1c\x01\xcf\x00\x7b\xc0\x1e\xf0\x07\xbc\x01\xe7\x00\x71\xe0\x1c\x38\x0e"
-                                    "\x06\x03\x80\xc1\x80\x0f\x80\x07\xf0\x43\x0e\x20\x81\xf8\x00\x3c\x00\x52\x00\x28"
-                                    "\x11\x00\x0f\x10\x01\x00\xff\xe0\x70\xe0\xe1\xe1\xc3\xc3\x87\x87\x0e\x0e\x18\x1f"
-                                    "\xe0\x38\x70\x70\x70\xe0\xe1\xc1\xc3\x83\x87\x07\x0e\x0f\x7f\x8f\x00\x53\x00\x20"
-                                    "\x0d\x00\x0b\x10\x01\x00\x1f\x0c\x39\x83\x70\x2e\x05\xf0\x1f\x83\xfc\x1f\xc0\xfc"
-                                    "\x07\xc0\x38\x07\x80\xb8\x31\xf8\x00\x54\x00\x28\x11\x00\x0f\x10\x01\x00\xff\xff"
-                                    "\x87\x0e\x0e\x1c\x1c\x18\x38\x20\x70\x00\xe0\x01\xc0\x03\x80\x07\x00\x0e\x00\x1c"
-                                    "\x00\x38\x00\x70\x00\xe0\x07\xf0\x00\x55\x00\x2c\x12\x00\x11\x10\x00\x00\xff\x0f"
-                                    "\x8e\x01\x07\x00\x83\x80\x41\xc0\x20\xe0\x10\x70\x08\x38\x04\x1c\x02\x0e\x01\x07"
-                                    "\x00\x83\x80\x41\xc0\x20\xe0\x10\x78\x10\x0f\xf0\x00\x56\x00\x28\x0f\x00\x0f\x10"
-                                    "\x00\x00\xff\x1e\x78\x10\xf0\x20\xf0\x41\xe1\x01\xc2\x03\xc4\x07\x90\x07\x20\x0f"
-                                    "\x40\x1f\x00\x1e\x00\x38\x00\x70\x00\x60\x00\x80\x00\x57\x00\x3c\x19\x00\x19\x10"
-                                    "\x00\x00\xff\x3f\xcf\x9e\x07\x81\x0f\x05\xc0\x83\x82\xf0\x81\xe1\x78\x40\xf1\x1c"
-                                    "\x20\x38\x8f\x20\x1e\x43\x90\x0f\x41\xc8\x03\xa0\xf8\x01\xf0\x3c\x00\xf0\x1e\x00"
-                                    "\x38\x0e\x00\x1c\x03\x00\x0c\x01\x80\x02\x00\x80\x00\x58\x00\x2a\x10\x00\x10\x10"
-                                    "\x00\x00\xff\x3e\x3c\x10\x1e\x10\x1f\x20\x0f\x40\x07\xc0\x07\x80\x03\xc0\x03\xc0"
-                                    "\x03\xe0\x04\xf0\x04\xf0\x08\x78\x10\x78\x10\x3c\xf8\xff\x00\x59\x00\x2a\x10\x00"
-                                    "\x10\x10\x00\x00\xff\x1f\x3c\x04\x1e\x08\x1e\x08\x0f\x10\x07\xa0\x07\xa0\x03\xc0"
-                                    "\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x0f\xf0\x00\x5A\x00\x28"
-                                    "\x0f\x00\x0f\x10\x00\x00\x3f\xfe\x60\x78\x81\xe1\x07\x84\x0f\x00\x3c\x00\xf0\x01"
-                                    "\xe0\x07\x80\x1e\x00\x3c\x00\xf0\x23\xc0\x47\x81\x9e\x07\x7f\xfe\x00\x5B\x00\x18"
-                                    "\x09\x00\x05\x15\x03\xfb\xff\x39\xce\x73\x9c\xe7\x39\xce\x73\x9c\xe7\x39\xcf\x80"
-                                    "\x00\x5C\x00\x1a\x09\x00\x08\x10\x00\x00\xe0\x60\x60\x70\x30\x38\x18\x18\x1c\x0c"
-                                    "\x0c\x0e\x06\x07\x03\x03\x00\x5D\x00\x18\x09\x00\x05\x15\x01\xfb\xf9\xce\x73\x9c"
-                                    "\xe7\x39\xce\x73\x9c\xe7\x39\xce\x7f\x80\x00\x5E\x00\x14\x0c\x00\x0a\x08\x01\x07"
-                                    "\x0c\x07\x81\xe0\xec\x33\x1c\x66\x1b\x83\x00\x5F\x00\x0c\x0b\x00\x0b\x01\x00\xfd"
-                                    "\xff\xe0\x00\x60\x00\x0d\x06\x00\x05\x04\xff\x0c\xc7\x1c\x30\x00\x61\x00\x1b\x0d"
-                                    "\x00\x0c\x0b\x01\x00\x3f\x86\x1c\x61\xc6\x1c\x0f\xc7\x1c\xe1\xce\x1c\xe1\xce\x3c"
-                                    "\x7d\xf0\x00\x62\x00\x24\x0e\x00\x0d\x10\x00\x00\xf8\x01\xc0\x0e\x00\x70\x03\x80"
-                                    "\x1d\xe0\xf1\x87\x0e\x38\x79\xc3\xce\x1e\x70\xf3\x87\x9c\x38\xf1\x87\x78\x00\x63"
-                                    "\x00\x18\x0c\x00\x0a\x0b\x01\x00\x1f\x0c\x77\x1f\x87\xe0\x38\x0e\x03\xc1\x70\x4c"
-                                    "\x21\xf0\x00\x64\x00\x24\x0e\x00\x0d\x10\x01\x00\x03\xe0\x07\x00\x38\x01\xc0\x0e"
-                                    "\x0f\x71\xc7\x8e\x1c\xe0\xe7\x07\x38\x39\xc1\xce\x0e\x38\x71\xc7\x87\xdf\x00\x65"
-                                    "\x00\x1a\x0d\x00\x0b\x0b\x01\x00\x1f\x06\x39\xc7\x70\xff\xff\xc0\x38\x07\x81\x70"
-                                    "\x46\x18\x7c\x00\x00\x66\x00\x1e\x08\x00\x0a\x10\x00\x00\x0f\x8e\x73\x9c\xe6\x38"
-                                    "\x3f\x83\x80\xe0\x38\x0e\x03\x80\xe0\x38\x0e\x03\x83\xf8\x00\x67\x00\x22\x0d\x00"
-                                    "\x0c\x10\x01\xfb\x1f\x73\x1b\x71\xb7\x1c\x71\x83\x38\x5e\x0c\x00\xff\x8f\xfc\x7f"
-                                    "\xe4\x0e\xc0\x6c\x06\xc0\xc3\xf0\x00\x68\x00\x26\x0f\x00\x0e\x10\x00\x00\xf8\x00"
-                                    "\xe0\x03\x80\x0e\x00\x38\x00\xef\x83\xc7\x0e\x1c\x38\x78\xe1\xe3\x87\x8e\x1e\x38"
-                                    "\x78\xe1\xe3\x87\xbf\xbf\x00\x69\x00\x18\x07\x00\x07\x10\x00\x00\x38\x70\xe0\x00"
-                                    "\x1f\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7f\x00\x6A\x00\x18\x07\x00\x05\x15\x00\xfb"
-                                    "\x39\xce\x00\x7c\xe7\x39\xce\x73\x9c\xe7\x39\xce\x6e\x00\x00\x6B\x00\x26\x0e\x00"
-                                    "\x0e\x10\x00\x00\xf8\x00\xe0\x03\x80\x0e\x00\x38\x00\xe7\xc3\x84\x0e\x20\x39\x00"
-                                    "\xe6\x03\xfc\x0e\x70\x39\xe0\xe3\xc3\x87\xbf\xbf\x00\x6C\x00\x18\x07\x00\x07\x10"
-                                    "\x00\x00\xf8\x70\xe1\xc3\x87\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7f\x00\x6D\x00\x29"
-                                    "\x16\x00\x16\x0b\x00\x00\xfb\xe3\xc0\xf1\xd1\x83\xc7\x87\x0e\x1e\x1c\x38\x78\x70"
-                                    "\xe1\xe1\xc3\x87\x87\x0e\x1e\x1c\x38\x78\x70\xe1\xe1\xcf\xef\xdf\xc0\x00\x6E\x00"
-                                    "\x1e\x0f\x00\x0e\x0b\x00\x00\xfb\xe0\xf1\xc3\x87\x0e\x1e\x38\x78\xe1\xe3\x87\x8e"
-                                    "\x1e\x38\x78\xe1\xef\xef\xc0\x00\x6F\x00\x1a\x0d\x00\x0b\x0b\x01\x00\x1f\x06\x39"
-                                    "\xc3\xf0\x7e\x0f\xc1\xf8\x3f\x07\x70\xe6\x38\x7c\x00\x00\x70\x00\x24\x0e\x00\x0d"
-                                    "\x10\x00\xfb\xfb\xe1\xe3\x8f\x0e\x70\x73\x83\x9c\x1c\xe0\xe7\x07\x38\x39\xe3\x8e"
-                                    "\xf8\x70\x03\x80\x1c\x00\xe0\x1f\xc0\x00\x71\x00\x24\x0e\x00\x0d\x10\x01\xfb\x1e"
-                                    "\xe3\x8f\x1c\x39\xc1\xce\x0e\x70\x73\x83\x9c\x1c\x70\xe3\x8f\x07\xb8\x01\xc0\x0e"
-                                    "\x00\x70\x03\x80\x3f\x00\x72\x00\x18\x0a\x00\x0a\x0b\x00\x00\xfb\xcf\x73\xdc\xe0"
-                                    "\x38\x0e\x03\x80\xe0\x38\x0e\x0f\xe0\x00\x73\x00\x15\x0a\x00\x08\x0b\x01\x00\x3e"
-                                    "\x42\xc2\xf0\xfc\x7f\x1f\x87\x83\xc2\x7c\x00\x74\x00\x18\x09\x00\x08\x0e\x00\x00"
-                                    "\x08\x38\x38\xfe\x38\x38\x38\x38\x38\x38\x38\x38\x38\x1f\x00\x75\x00\x1e\x0f\x00"
-                                    "\x0e\x0b\x00\x00\xf8\xf8\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xe3\x87\x8e\x1e\x38\x78"
-                                    "\x63\xe0\xf7\xc0\x00\x76\x00\x1c\x0d\x00\x0d\x0b\x00\x00\xfc\x79\xc1\x0f\x08\x38"
-                                    "\x81\xe4\x07\x40\x3a\x01\xe0\x07\x00\x30\x00\x80\x00\x77\x00\x26\x14\x00\x14\x0b"
-                                    "\x00\x00\xfe\xfc\xf3\x87\x84\x38\x78\x81\xcb\xc8\x1c\x9c\x81\xf1\xd0\x0f\x0f\x00"
-                                    "\xf0\xe0\x06\x0e\x00\x60\x60\x04\x04\x00\x00\x78\x00\x1c\x0d\x00\x0d\x0b\x00\x00"
-                                    "\xfe\xf0\xe2\x07\xa0\x1d\x00\xf0\x03\xc0\x1e\x01\x78\x09\xe0\x8f\x1e\xfe\x00\x79"
-                                    "\x00\x24\x0d\x00\x0d\x10\x00\xfb\xfe\x79\xc1\x0f\x08\x38\x81\xe4\x07\x40\x3a\x01"
-                                    "\xf0\x07\x00\x38\x00\x80\x04\x06\x20\x72\x01\x90\x0f\x00\x00\x7A\x00\x17\x0b\x00"
-                                    "\x09\x0b\x01\x00\xff\xe3\xe1\xd1\xc1\xe0\xe0\xf0\x71\x78\xf8\xff\xe0\x00\x7B\x00"
-                                    "\x1a\x09\x00\x06\x15\x01\xfb\x1c\xe3\x8e\x38\xe3\x8e\x38\xce\x1c\x30\xe3\x8e\x38"
-                                    "\xe3\x8e\x1c\x00\x7C\x00\x13\x05\x00\x03\x16\x01\xfb\xff\xff\xff\xff\xff\xff\xff"
-                                    "\xff\xc0\x00\x7D\x00\x1a\x09\x00\x06\x15\x02\xfb\xe1\xc7\x1c\x71\xc7\x1c\x70\xc1"
-                                    "\xce\x71\xc7\x1c\x71\xc7\x1c\xe0\x00\x7E\x00\x0f\x0c\x00\x0a\x04\x01\x04\x70\x7f"
-                                    "\x3c\xfe\x0e\x00\xA1\x00\x12\x07\x00\x04\x10\x01\xfb\x7f\x70\x22\x26\x66\x67\x77"
-                                    "\x76\x00\xA2\x00\x1e\x0c\x00\x0a\x10\x01\xfe\x04\x01\x00\x40\x7c\x35\xdd\x7e\x5f"
-                                    "\x90\xe4\x39\x0f\x45\xd1\x34\x87\xc0\x40\x10\x00\xA3\x00\x20\x0c\x00\x0b\x10\x00"
-                                    "\x00\x03\x81\x98\x23\x0c\x01\x80\x38\x07\x03\xfc\x1c\x01\x80\x30\x86\x10\x82\xd0"
-                                    "\xff\xf3\x3e\x00\xA4\x00\x1b\x0c\x00\x0c\x0b\x00\x02\x6f\x2f\xff\x38\xe7\x06\x60"
-                                    "\x66\x07\x60\x77\x06\x38\xef\xff\x6f\x20\x00\xA5\x00\x26\x0c\x00\x0e\x10\xff\x00"
-                                    "\xfe\x3c\xf0\x41\xc1\x07\x88\x0e\x20\x3d\x00\x74\x01\xe0\x1f\xf0\x1e\x00\x78\x07"
-                                    "\xfc\x07\x80\x1e\x00\x78\x07\xf8\x00\xA6\x00\x10\x05\x00\x03\x10\x01\xfe\xff\xfe"
-                                    "\x00\x00\x7f\xff\x00\xA7\x00\x25\x0c\x00\x0a\x15\x01\xfb\x1f\x0c\x66\x1d\x87\xa0"
-                                    "\x2c\x09\x83\x78\xcf\x19\xe7\x38\xe7\x1e\xc3\x90\x34\x05\x61\xf8\x5e\x19\x8c\x3e"
-                                    "\x00\x00\xA8\x00\x0d\x06\x00\x08\x03\xff\x0c\x66\xe7\x66\x00\xA9\x00\x2a\x12\x00"
-                                    "\x10\x10\x01\x00\x07\xe0\x1f\xf8\x38\x1c\x63\xce\xe6\x26\xcc\x23\xdc\x03\xdc\x03"
-                                    "\xdc\x03\xdc\x03\xcc\x13\xe6\x26\x63\xce\x38\x1c\x1f\xf8\x07\xe0\x00\xAA\x00\x11"
-                                    "\x08\x00\x08\x07\x00\x09\x3c\x66\x0e\x76\xe6\x66\x7f\x00\xAB\x00\x13\x09\x00\x09"
-                                    "\x08\x00\x01\x08\x88\x8d\xdd\xc6\x61\x98\x66\x11\x00\xAC\x00\x13\x0d\x00\x0b\x06"
-                                    "\x01\x03\xff\xff\xfc\x01\x80\x30\x06\x00\xc0\x00\xAD\x00\x0b\x08\x00\x04\x01\x02"
-                                    "\x04\xf0\x00\xAE\x00\x13\x0b\x00\x08\x09\x01\x07\x3c\x43\x99\x95\x99\x95\x9b\x43"
-                                    "\x3c\x00\xAF\x00\x0c\x06\x00\x06\x02\x00\x0d\xff\xf0\x00\xB0\x00\x10\x09\x00\x07"
-                                    "\x06\x01\x09\x38\x8a\x1c\x34\x47\x00\x00\xB1\x00\x1a\x0d\x00\x0b\x0b\x01\x00\x0e"
-                                    "\x01\xc0\x38\x7f\xff\xfe\x1c\x03\x80\x70\x00\x1f\xff\xff\x80\x00\xB2\x00\x14\x09"
-                                    "\x00\x08\x0a\x00\x0a\x3e\x47\x67\x63\x06\x04\x18\x21\x7e\xfe\x00\xB3\x00\x16\x09"
-                                    "\x00\x09\x0a\x00\x0a\x3e\x33\x81\xc0\xc3\xc0\x18\x0e\xc7\xc3\x3f\x00\x00\xB4\x00"
-                                    "\x0d\x06\x00\x05\x04\x02\x0c\x19\xdd\x80\x00\xB5\x00\x26\x0f\x00\x0e\x10\x00\xfb"
-                                    "\xf8\xf8\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xe3\x87\x8e\x1e\x38\x78\xe3\xe3\xf7\xcc"
-                                    "\x00\x30\x00\xe0\x03\x80\x0c\x00\x00\xB6\x00\x26\x0d\x00\x0b\x14\x01\xfc\x1f\xef"
-                                    "\xbb\xf7\x7e\xef\xdd\xfb\xbf\x73\xee\x3d\xc0\xb8\x17\x02\xe0\x5c\x0b\x81\x70\x2c"
-                                    "\x05\x8e\xb1\xac\x1e\x00\x00\xB7\x00\x0c\x06\x00\x04\x04\x01\x04\x6f\xf6\x00\xB8"
-                                    "\x00\x0e\x06\x00\x05\x05\x01\xfb\x23\x86\x3f\x00\x00\xB9\x00\x11\x08\x00\x05\x0a"
-                                    "\x02\x0a\x33\xbc\xe7\x39\xce\x77\xc0\x00\xBA\x00\x11\x09\x00\x08\x07\x00\x09\x1c"
-                                    "\x63\x63\xe3\x63\x63\x1c\x00\xBB\x00\x13\x09\x00\x09\x08\x00\x01\xc8\x33\x0c\xc7"
-                                    "\x73\xbb\x31\x11\x10\x00\xBC\x00\x2c\x12\x00\x10\x11\x01\x00\x00\x08\x10\x08\x70"
-                                    "\x10\xb0\x30\x30\x20\x30\x60\x30\x40\x30\x82\x30\x86\x31\x0e\xfb\x1e\x02\x2e\x04"
-                                    "\x4f\x04\x7f\x08\x0f\x18\x0e\x30\x00\x00\xBD\x00\x2c\x12\x00\x11\x10\x01\x00\x10"
-                                    "\x08\x18\x08\x1c\x0c\x16\x04\x03\x06\x01\x82\x00\xc2\x00\x61\x3c\x31\x33\x7d\x99"
-                                    "\x80\x80\xc0\x80\x40\x40\x40\x40\xc4\x60\x7c\x60\xfe\x00\xBE\x00\x2f\x12\x00\x11"
-                                    "\x11\x00\x00\x00\x04\x1c\x02\x19\x82\x08\xc3\x00\xc1\x01\xc1\x80\x18\x80\x0e\x86"
-                                    "\xc7\x43\x63\x43\x8e\x63\xc0\x22\xe0\x22\x78\x11\xfc\x10\x1e\x18\x0e\x18\x00\x00"
-                                    "\x00\xBF\x00\x1a\x0b\x00\x08\x10\x01\xfb\x1c\x1c\x1c\x00\x08\x08\x08\x30\x60\xe0"
-                                    "\xe0\xe0\xe7\xe7\xe3\x3c\x00\xC0\x00\x34\x10\x00\x10\x15\x00\x00\x06\x00\x07\x00"
-                                    "\x03\x00\x00\xc0\x00\x00\x01\x80\x01\x80\x01\x80\x03\xc0\x03\xc0\x03\xc0\x05\xe0"
-                                    "\x05\xe0\x08\xf0\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10\x38\x20\x3c\xf8\xff\x00\xC1"
-                                    "\x00\x34\x10\x00\x10\x15\x00\x00\x00\x30\x00\x60\x00\xc0\x03\x00\x00\x00\x01\x80"
-                                    "\x01\x80\x01\x80\x03\xc0\x03\xc0\x03\xc0\x05\xe0\x05\xe0\x08\xf0\x08\xf0\x0f\xf0"
-                                    "\x10\x78\x10\x78\x10\x38\x20\x3c\xf8\xff\x00\xC2\x00\x34\x10\x00\x10\x15\x00\x00"
-                                    "\x01\xc0\x03\xc0\x06\x60\x0c\x30\x00\x00\x01\x80\x01\x80\x01\x80\x03\xc0\x03\xc0"
-                                    "\x03\xc0\x05\xe0\x05\xe0\x08\xf0\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10\x38\x20\x3c"
-                                    "\xf8\xff\x00\xC3\x00\x34\x10\x00\x10\x15\x00\x00\x07\x10\x07\xf0\x08\xe0\x00\x00"
-                                    "\x00\x00\x01\x80\x01\x80\x01\x80\x03\xc0\x03\xc0\x03\xc0\x05\xe0\x05\xe0\x08\xf0"
-                                    "\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10\x38\x20\x3c\xf8\xff\x00\xC4\x00\x32\x10\x00"
-                                    "\x10\x14\x00\x00\x06\x60\x0e\x70\x06\x70\x00\x00\x01\x80\x01\x80\x01\x80\x03\xc0"
-                                    "\x03\xc0\x03\xc0\x05\xe0\x05\xe0\x08\xf0\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10\x38"
-                                    "\x20\x3c\xf8\xff\x00\xC5\x00\x34\x10\x00\x10\x15\x00\x00\x01\x80\x02\x40\x02\x60"
-                                    "\x02\x40\x01\x80\x01\x80\x01\x80\x01\x80\x03\xc0\x03\xc0\x03\xc0\x05\xe0\x05\xe0"
-                                    "\x08\xf0\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10\x38\x20\x3c\xf8\xff\x00\xC6\x00\x36"
-                                    "\x17\x00\x16\x10\x00\x00\x01\xff\xf8\x01\xe0\x60\x0b\x80\x80\x2e\x02\x01\x38\x48"
-                                    "\x04\xe1\x00\x23\x8c\x00\x8f\xf0\x04\x38\xc0\x1f\xe1\x00\x83\x84\x42\x0e\x01\x10"
-                                    "\x38\x04\x40\xe0\x32\x03\x81\xfe\x3f\xff\x00\xC7\x00\x32\x11\x00\x0f\x15\x01\xfb"
-                                    "\x07\xf0\x38\x38\xe0\x31\xc0\x27\x00\x4e\x00\x7c\x00\x78\x00\xf0\x01\xe0\x01\xc0"
-                                    "\x0b\x80\x17\x80\x67\x01\xc7\x07\x83\xf8\x00\x80\x01\xc0\x05\x80\x03\x00\x3e\x00"
-                                    "\x00\xC8\x00\x2f\x10\x00\x0e\x15\x01\x00\x1c\x00\x38\x00\x60\x00\x60\x00\x03\xff"
-                                    "\xe3\x81\x8e\x02\x38\x08\xe1\x23\x84\x0e\x30\x3f\xc0\xe3\x03\x84\x0e\x11\x38\x04"
-                                    "\xe0\x13\x80\xce\x07\xff\xfc\x00\xC9\x00\x2f\x10\x00\x0e\x15\x01\x00\x00\xe0\x03"
-                                    "\x00\x18\x01\x80\x00\x03\xff\xe3\x81\x8e\x02\x38\x08\xe1\x23\x84\x0e\x30\x3f\xc0"
-                                    "\xe3\x03\x84\x0e\x11\x38\x04\xe0\x13\x80\xce\x07\xff\xfc\x00\xCA\x00\x2f\x10\x00"
-                                    "\x0e\x15\x01\x00\x03\x00\x1e\x00\xcc\x06\x18\x00\x03\xff\xe3\x81\x8e\x02\x38\x08"
-                                    "\xe1\x23\x84\x0e\x30\x3f\xc0\xe3\x03\x84\x0e\x11\x38\x04\xe0\x13\x80\xce\x07\xff"
-                                    "\xfc\x00\xCB\x00\x2d\x10\x00\x0e\x14\x01\x00\x0c\xc0\x73\x80\xcc\x00\x00\xff\xf8"
-                                    "\xe0\x63\x80\x8e\x02\x38\x48\xe1\x03\x8c\x0f\xf0\x38\xc0\xe1\x03\x84\x4e\x01\x38"
-                                    "\x04\xe0\x33\x81\xff\xff\x00\xCC\x00\x1d\x09\x00\x07\x15\x01\x00\xc1\xc0\xc0\xc0"
-                                    "\x1f\xce\x1c\x38\x70\xe1\xc3\x87\x0e\x1c\x38\x70\xe1\xcf\xe0\x00\xCD\x00\x1d\x09"
-                                    "\x00\x07\x15\x01\x00\x06\x1c\x71\x80\x1f\xce\x1c\x38\x70\xe1\xc3\x87\x0e\x1c\x38"
-                                    "\x70\xe1\xcf\xe0\x00\xCE\x00\x1d\x09\x00\x07\x15\x01\x00\x38\xf9\xb6\x30\x1f\xce"
-                                    "\x1c\x38\x70\xe1\xc3\x87\x0e\x1c\x38\x70\xe1\xcf\xe0\x00\xCF\x00\x1c\x09\x00\x07"
-                                    "\x14\x01\x00\xc7\xdf\x18\x0f\xe7\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x1c\x38\x70\xe7"
-                                    "\xf0\x00\xD0\x00\x2c\x13\x00\x11\x10\x01\x00\xff\xf0\x1c\x0e\x0e\x03\x87\x01\xe3"
-                                    "\x80\x71\xc0\x3c\xe0\x1f\xff\x0f\x38\x07\x9c\x03\xce\x01\xe7\x00\xe3\x80\xf1\xc0"
-                                    "\x70\xe0\x71\xff\xe0\x00\xD1\x00\x37\x12\x00\x11\x15\x01\x00\x07\x10\x03\xf8\x02"
-                                    "\x38\x00\x00\x00\x00\x07\xe0\xfc\xf8\x08\x7e\x04\x2f\x82\x13\xc1\x09\xf0\x84\x7c"
-                                    "\x42\x1f\x21\x07\x90\x81\xe8\x40\xfc\x20\x3e\x10\x0f\x08\x03\x84\x00\xcf\x80\x60"
-                                    "\x00\xD2\x00\x35\x13\x00\x11\x14\x01\x00\x03\x00\x01\xc0\x00\x60\x00\x08\x00\x7f"
-                                    "\x00\xe0\xe0\xe0\x38\x70\x1e\x70\x07\x38\x03\xbc\x01\xfe\x00\xff\x00\x7f\x80\x3d"
-                                    "\xc0\x1c\xe0\x0e\x38\x0f\x1c\x07\x07\x07\x00\xfe\x00\x00\xD3\x00\x35\x13\x00\x11"
-                                    "\x14\x01\x00\x00\x18\x00\x1c\x00\x18\x00\x18\x00\x7f\x00\xe0\xe0\xe0\x38\x70\x1e"
-                                    "\x70\x07\x38\x03\xbc\x01\xfe\x00\xff\x00\x7f\x80\x3d\xc0\x1c\xe0\x0e\x38\x0f\x1c"
-                                    "\x07\x07\x07\x00\xfe\x00\x00\xD4\x00\x35\x13\x00\x11\x14\x01\x00\x01\xc0\x00\xf0"
-                                    "\x00\xd8\x00\xc6\x00\x7f\x00\xe0\xe0\xe0\x38\x70\x1e\x70\x07\x38\x03\xbc\x01\xfe"
-                                    "\x00\xff\x00\x7f\x80\x3d\xc0\x1c\xe0\x0e\x38\x0f\x1c\x07\x07\x07\x00\xfe\x00\x00"
-                                    "\xD5\x00\x35\x13\x00\x11\x14\x01\x00\x03\x88\x03\xf8\x01\x38\x00\x00\x00\x7f\x00"
-                                    "\xe0\xe0\xe0\x38\x70\x1e\x70\x07\x38\x03\xbc\x01\xfe\x00\xff\x00\x7f\x80\x3d\xc0"
-                                    "\x1c\xe0\x0e\x38\x0f\x1c\x07\x07\x07\x00\xfe\x00\x00\xD6\x00\x33\x13\x00\x11\x13"
-                                    "\x01\x00\x06\x30\x03\xb8\x01\x8c\x00\xfe\x01\xc1\xc1\xc0\x70\xe0\x3c\xe0\x0e\x70"
-                                    "\x07\x78\x03\xfc\x01\xfe\x00\xff\x00\x7b\x80\x39\xc0\x1c\x70\x1e\x38\x0e\x0e\x0e"
-                                    "\x01\xfc\x00\x00\xD7\x00\x1a\x0d\x00\x0b\x0b\x01\x00\x20\x5c\x1d\xc7\x1d\xc1\xf0"
-                                    "\x1c\x07\xc1\xdc\x71\xfc\x18\x81\x00\x00\xD8\x00\x2c\x13\x00\x11\x10\x01\x00\x07"
-                                    "\xf0\x8e\x0e\x8e\x03\x87\x01\xe7\x80\xf3\x80\xbb\xc0\x9f\xe0\x8f\xf0\x87\xf8\x83"
-                                    "\xdc\x81\xee\x80\xe3\x80\xf1\xc0\x71\x30\x71\x0f\xe0\x00\xD9\x00\x37\x12\x00\x11"
-                                    "\x15\x00\x00\x03\x00\x01\xc0\x00\x70\x00\x0c\x00\x00\x07\xf8\x7c\x70\x08\x38\x04"
-                                    "\x1c\x02\x0e\x01\x07\x00\x83\x80\x41\xc0\x20\xe0\x10\x70\x08\x38\x04\x1c\x02\x0e"
-                                    "\x01\x07\x00\x83\xc0\x80\x7f\x80\x00\xDA\x00\x37\x12\x00\x11\x15\x00\x00\x00\x18"
-                                    "\x00\x1c\x00\x18\x00\x18\x00\x00\x07\xf8\x7c\x70\x08\x38\x04\x1c\x02\x0e\x01\x07"
-                                    "\x00\x83\x80\x41\xc0\x20\xe0\x10\x70\x08\x38\x04\x1c\x02\x0e\x01\x07\x00\x83\xc0"
-                                    "\x80\x7f\x80\x00\xDB\x00\x37\x12\x00\x11\x15\x00\x00\x01\xc0\x00\xf0\x00\xc8\x00"
-                                    "\xc2\x00\x00\x07\xf8\x7c\x70\x08\x38\x04\x1c\x02\x0e\x01\x07\x00\x83\x80\x41\xc0"
-                                    "\x20\xe0\x10\x70\x08\x38\x04\x1c\x02\x0e\x01\x07\x00\x83\xc0\x80\x7f\x80\x00\xDC"
-                                    "\x00\x35\x12\x00\x11\x14\x00\x00\x03\x30\x03\x9c\x00\xce\x00\x00\x0f\xf0\xf8\xe0"
-                                    "\x10\x70\x08\x38\x04\x1c\x02\x0e\x01\x07\x00\x83\x80\x41\xc0\x20\xe0\x10\x70\x08"
-                                    "\x38\x04\x1c\x02\x0e\x01\x07\x81\x00\xff\x00\x00\xDD\x00\x34\x10\x00\x10\x15\x00"
-                                    "\x00\x00\x30\x00\x70\x00\xe0\x01\x80\x00\x00\xff\x1f\x3c\x04\x1e\x08\x1e\x08\x0f"
-                                    "\x10\x07\xa0\x07\xa0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03"
-                                    "\xc0\x0f\xf0\x00\xDE\x00\x26\x10\x00\x0e\x10\x01\x00\xfe\x00\xe0\x03\x80\x0f\xfc"
-                                    "\x38\x78\xe0\xf3\x83\xce\x0f\x38\x3c\xe0\xf3\x87\x8f\xf8\x38\x00\xe0\x03\x80\x3f"
-                                    "\x80\x00\xDF\x00\x24\x0e\x00\x0d\x10\x00\x00\x07\xe0\xe3\x86\x1c\x70\xe3\x87\x1c"
-                                    "\x30\xe6\x07\x0e\x38\x71\xc1\xce\x0e\x70\x73\x83\x9d\x1c\xe5\xdf\xbc\x00\xE0\x00"
-                                    "\x22\x0d\x00\x0c\x10\x01\x00\x30\x03\x80\x0c\x00\x60\x00\x03\xf8\x61\xc6\x1c\x61"
-                                    "\xc0\xfc\x71\xce\x1c\xe1\xce\x1c\xe3\xc7\xdf\x00\xE1\x00\x22\x0d\x00\x0c\x10\x01"
-                                    "\x00\x01\x80\x38\x07\x00\xc0\x00\x03\xf8\x61\xc6\x1c\x61\xc0\xfc\x71\xce\x1c\xe1"
-                                    "\xce\x1c\xe3\xc7\xdf\x00\xE2\x00\x22\x0d\x00\x0c\x10\x01\x00\x0e\x00\xf0\x1b\x03"
-                                    "\x18\x00\x03\xf8\x61\xc6\x1c\x61\xc0\xfc\x71\xce\x1c\xe1\xce\x1c\xe3\xc7\xdf\x00"
-                                    "\xE3\x00\x22\x0d\x00\x0c\x10\x01\x00\x1c\xc3\xf8\x27\x04\x00\x00\x03\xf8\x61\xc6"
-                                    "\x1c\x61\xc0\xfc\x71\xce\x1c\xe1\xce\x1c\xe3\xc7\xdf\x00\xE4\x00\x21\x0d\x00\x0c"
-                                    "\x0f\x01\x00\x31\x83\xb8\x31\x80\x00\x3f\x86\x1c\x61\xc6\x1c\x0f\xc7\x1c\xe1\xce"
-                                    "\x1c\xe1\xce\x3c\x7d\xf0\x00\xE5\x00\x24\x0d\x00\x0c\x11\x01\x00\x0e\x01\x90\x11"
-                                    "\x01\x90\x0e\x00\x00\x3f\x86\x1c\x61\xc6\x1c\x0f\xc7\x1c\xe1\xce\x1c\xe1\xce\x3c"
-                                    "\x7d\xf0\x00\xE6\x00\x22\x13\x00\x11\x0b\x01\x00\x3e\x3e\x30\xe1\x98\x70\xe0\x78"
-                                    "\x71\xdf\xfb\x8e\x03\x87\x01\xc3\x80\xe3\xc0\xf1\x70\x9f\x1f\x80\x00\xE7\x00\x1e"
-                                    "\x0c\x00\x0a\x10\x01\xfb\x1f\x0c\x77\x1f\x87\xe0\x38\x0e\x03\xc1\x70\x5c\x21\xf0"
-                                    "\x10\x07\x02\xc0\x30\x7c\x00\xE8\x00\x20\x0d\x00\x0b\x10\x01\x00\x30\x07\x00\x30"
-                                    "\x03\x80\x00\x3e\x0c\x73\x8e\xe1\xff\xff\x80\x70\x0f\x02\xe0\x8c\x30\xf8\x00\xE9"
-                                    "\x00\x20\x0d\x00\x0b\x10\x01\x00\x01\xc0\x30\x0c\x06\x00\x00\x3e\x0c\x73\x8e\xe1"
-                                    "\xff\xff\x80\x70\x0f\x02\xe0\x8c\x30\xf8\x00\xEA\x00\x20\x0d\x00\x0b\x10\x01\x00"
-                                    "\x0e\x03\xc0\x6c\x10\xc0\x00\x3e\x0c\x73\x8e\xe1\xff\xff\x80\x70\x0f\x02\xe0\x8c"
-                                    "\x30\xf8\x00\xEB\x00\x1f\x0d\x00\x0b\x0f\x01\x00\x31\x86\x70\xc6\x00\x01\xf0\x63"
-                                    "\x9c\x77\x0f\xff\xfc\x03\x80\x78\x17\x04\x61\x87\xc0\x00\xEC\x00\x18\x07\x00\x07"
-                                    "\x10\x00\x00\xc1\xc0\xc0\xc0\x1f\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7f\x00\xED\x00"
-                                    "\x18\x07\x00\x07\x10\x00\x00\x06\x1c\x71\x80\x1f\x0e\x1c\x38\x70\xe1\xc3\x87\x0e"
-                                    "\x7f\x00\xEE\x00\x18\x07\x00\x07\x10\x00\x00\x38\x79\xb6\x10\x1f\x0e\x1c\x38\x70"
-                                    "\xe1\xc3\x87\x0e\x7f\x00\xEF\x00\x18\x07\x00\x07\x0f\x00\x00\xc7\xcf\x18\x0f\x87"
-                                    "\x0e\x1c\x38\x70\xe1\xc3\x87\x3f\x80\x00\xF0\x00\x22\x0d\x00\x0b\x11\x01\x00\x00"
-                                    "\x8f\x70\x38\x1f\x86\x38\x03\x87\xf9\x8f\x70\xfc\x1f\x83\xf0\x7e\x0f\xc1\xdc\x31"
-                                    "\x8e\x1f\x00\x00\xF1\x00\x26\x0f\x00\x0e\x10\x00\x00\x06\x20\x3f\x81\x1c\x00\x00"
-                                    "\x00\x03\xef\x83\xc7\x0e\x1c\x38\x78\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xe3\x87\xbf"
-                                    "\xbf\x00\xF2\x00\x20\x0d\x00\x0b\x10\x01\x00\x30\x07\x00\x30\x03\x80\x00\x3e\x0c"
-                                    "\x73\x87\xe0\xfc\x1f\x83\xf0\x7e\x0e\xe1\xcc\x70\xf8\x00\xF3\x00\x20\x0d\x00\x0b"
-                                    "\x10\x01\x00\x01\xc0\x30\x0c\x06\x00\x00\x3e\x0c\x73\x87\xe0\xfc\x1f\x83\xf0\x7e"
-                                    "\x0e\xe1\xcc\x70\xf8\x00\xF4\x00\x20\x0d\x00\x0b\x10\x01\x00\x0e\x01\xe0\x64\x18"
-                                    "\x40\x00\x3e\x0c\x73\x87\xe0\xfc\x1f\x83\xf0\x7e\x0e\xe1\xcc\x70\xf8\x00\xF5\x00"
-                                    "\x20\x0d\x00\x0b\x10\x01\x00\x1c\x47\xf0\x9e\x00\x00\x00\x3e\x0c\x73\x87\xe0\xfc"
-                                    "\x1f\x83\xf0\x7e\x0e\xe1\xcc\x70\xf8\x00\xF6\x00\x1f\x0d\x00\x0b\x0f\x01\x00\x31"
-                                    "\x87\x30\xc6\x00\x01\xf0\x63\x9c\x3f\x07\xe0\xfc\x1f\x83\xf0\x77\x0e\x63\x87\xc0"
-                                    "\x00\xF7\x00\x1c\x0d\x00\x0b\x0d\x01\xff\x0e\x01\xc0\x38\x07\x00\x00\x00\x3f\xff"
-                                    "\xff\x00\x01\xc0\x38\x07\x00\xe0\x00\xF8\x00\x1b\x0d\x00\x0c\x0b\x01\x00\x1f\x13"
-                                    "\x1e\x70\xce\x1e\xe3\xee\x4e\xe8\xef\x0e\x70\xe7\x1c\x9f\x00\x00\xF9\x00\x26\x0f"
-                                    "\x00\x0e\x10\x00\x00\x0c\x00\x38\x00\x70\x00\x60\x00\x03\xe3\xe3\x87\x8e\x1e\x38"
-                                    "\x78\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xe1\x8f\x83\xdf\x00\xFA\x00\x26\x0f\x00\x0e"
-                                    "\x10\x00\x00\x00\x60\x03\x80\x18\x00\xc0\x00\x03\xe3\xe3\x87\x8e\x1e\x38\x78\xe1"
-                                    "\xe3\x87\x8e\x1e\x38\x78\xe1\xe1\x8f\x83\xdf\x00\xFB\x00\x26\x0f\x00\x0e\x10\x00"
-                                    "\x00\x03\x00\x1e\x00\xcc\x06\x18\x00\x03\xe3\xe3\x87\x8e\x1e\x38\x78\xe1\xe3\x87"
-                                    "\x8e\x1e\x38\x78\xe1\xe1\x8f\x83\xdf\x00\xFC\x00\x25\x0f\x00\x0e\x0f\x00\x00\x0c"
-                                    "\xc0\x73\x80\xce\x00\x00\xf8\xf8\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xe3\x87\x8e\x1e"
-                                    "\x38\x78\x63\xe0\xf7\xc0\x00\xFD\x00\x2d\x0d\x00\x0d\x15\x00\xfb\x00\xe0\x06\x00"
-                                    "\x60\x0c\x00\x00\x7f\x3c\xe0\x87\x84\x1c\x40\xf2\x03\xa0\x1d\x00\xf8\x03\x80\x1c"
-                                    "\x00\x40\x02\x03\x10\x39\x00\xc8\x07\x80\x00\x00\xFE\x00\x2d\x0e\x00\x0d\x15\x00"
-                                    "\xfb\xf8\x01\xc0\x0e\x00\x70\x03\x80\x1d\xf0\xf1\xc7\x87\x38\x39\xc1\xce\x0e\x70"
-                                    "\x73\x83\x9c\x1c\xf1\xc7\x7c\x38\x01\xc0\x0e\x00\x70\x0f\xe0\x00\x00\xFF\x00\x2b"
-                                    "\x0d\x00\x0d\x14\x00\xfb\x18\xc0\xce\x06\x30\x00\x0f\xe7\x9c\x10\xf0\x83\x88\x1e"
-                                    "\x40\x74\x03\xa0\x1f\x00\x70\x03\x80\x08\x00\x40\x62\x07\x20\x19\x00\xf0\x00\x01"
-                                    "\x31\x00\x14\x07\x00\x07\x0b\x00\x00\xf8\x70\xe1\xc3\x87\x0e\x1c\x38\x73\xf8\x01"
-                                    "\x41\x00\x26\x10\x00\x0e\x10\x01\x00\xfe\x00\xe0\x03\x80\x0e\x10\x39\x80\xec\x03"
-                                    "\xe0\x0f\x00\x38\x03\xe0\x0b\x80\x6e\x01\x38\x04\xe0\x33\x81\xff\xff\x01\x42\x00"
-                                    "\x18\x07\x00\x07\x10\x00\x00\xf8\x70\xe1\xc3\xa7\xce\x1c\x79\x70\xe1\xc3\x87\x0e"
-                                    "\x7f\x01\x52\x00\x3a\x1a\x00\x18\x10\x01\x00\x07\xff\xfe\x1c\x1e\x0e\x38\x1e\x06"
-                                    "\x38\x0e\x02\x70\x0e\x22\x70\x0e\x20\xf0\x0e\x20\xf0\x0f\xe0\xf0\x0e\x20\xf0\x0e"
-                                    "\x20\x70\x0e\x21\x70\x0e\x01\x38\x0e\x03\x38\x1e\x03\x1c\x1e\x07\x07\xff\xff\x01"
-                                    "\x53\x00\x23\x14\x00\x12\x0b\x01\x00\x1f\x1f\x0c\x7c\xe7\x0e\x1f\x83\x87\xe0\xff"
-                                    "\xf8\x38\x0e\x0e\x03\x83\x80\x70\xe0\x4c\x7c\x21\xf1\xf0\x01\x60\x00\x27\x0d\x00"
-                                    "\x0b\x15\x01\x00\x31\x83\x60\x3c\x07\x00\x00\x3e\x18\x73\x06\xe0\x5c\x0b\xe0\x3f"
-                                    "\x07\xf8\x3f\x81\xf8\x0f\x80\x70\x0f\x01\x70\x63\xf0\x01\x61\x00\x1a\x0a\x00\x08"
-                                    "\x10\x01\x00\xc3\x66\x3c\x18\x00\x3e\x42\xc2\xf0\xfc\x7f\x1f\x87\x83\xc2\x7c\x01"
-                                    "\x78\x00\x32\x10\x00\x10\x14\x00\x00\x06\x30\x07\x30\x07\x30\x00\x00\xff\x1f\x3c"
-                                    "\x04\x1e\x08\x1e\x08\x0f\x10\x07\xa0\x07\xa0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03"
-                                    "\xc0\x03\xc0\x03\xc0\x03\xc0\x0f\xf0\x01\x7D\x00\x32\x0f\x00\x0f\x15\x00\x00\x08"
-                                    "\x60\x0d\x80\x1e\x00\x1c\x00\x00\x07\xff\xcc\x0f\x10\x3c\x20\xf0\x81\xe0\x07\x80"
-                                    "\x1e\x00\x3c\x00\xf0\x03\xc0\x07\x80\x1e\x04\x78\x08\xf0\x33\xc0\xef\xff\xc0\x01"
-                                    "\x7E\x00\x1c\x0b\x00\x09\x10\x01\x00\x63\x1b\x0f\x83\x80\x07\xff\x1f\x0e\x8e\x0f"
-                                    "\x07\x07\x83\x8b\xc7\xc7\xff\x01\x92\x00\x2d\x0c\x00\x0d\x15\xff\xfb\x00\x70\x04"
-                                    "\xc0\x66\x03\x30\x38\x01\xc0\x0e\x00\x70\x1f\xe0\x38\x01\xc0\x0e\x00\x70\x03\x80"
-                                    "\x1c\x00\xe0\x07\x00\x30\x3b\x81\xd8\x07\x80\x00\x02\xC6\x00\x0e\x06\x00\x08\x04"
-                                    "\xff\x0c\x18\x3c\x66\xc3\x02\xC7\x00\x0e\x06\x00\x08\x04\xff\x0c\xc3\x66\x3c\x18"
-                                    "\x02\xD8\x00\x0d\x06\x00\x06\x04\x00\x0c\x86\x1f\xde\x02\xD9\x00\x0c\x06\x00\x03"
-                                    "\x03\x02\x0c\xdf\x00\x02\xDA\x00\x0d\x06\x00\x04\x05\x01\x0c\x69\x99\x60\x02\xDB"
-                                    "\x00\x0e\x06\x00\x05\x05\x00\xfb\x33\x31\x97\x00\x02\xDC\x00\x0d\x06\x00\x08\x03"
-                                    "\xff\x0d\x71\x7f\x8e\x02\xDD\x00\x0f\x06\x00\x0a\x04\x00\x0c\x19\xce\x66\x33\x30"
-                                    "\x20\x13\x00\x0d\x0b\x00\x0b\x02\x00\x04\xff\xff\xfc\x20\x14\x00\x0e\x16\x00\x10"
-                                    "\x02\x03\x04\xff\xff\xff\xff\x20\x18\x00\x0e\x05\x00\x04\x07\x00\x09\x12\x44\xf7"
-                                    "\x70\x20\x19\x00\x0e\x05\x00\x04\x07\x00\x09\x7f\x71\x12\x40\x20\x1A\x00\x0e\x05"
-                                    "\x00\x04\x07\x00\xfc\x7f\x71\x12\x40\x20\x1C\x00\x12\x0b\x00\x09\x07\x01\x09\x21"
-                                    "\x21\x21\x10\x8e\x77\xbf\x8c\x20\x1D\x00\x12\x0b\x00\x09\x07\x01\x09\xe7\x7b\xfd"
-                                    "\xe2\x12\x12\x1a\x10\x20\x1E\x00\x12\x0b\x00\x09\x07\x01\xfc\xe7\x7b\xfd\xe2\x12"
-                                    "\x13\x1a\x10\x20\x20\x00\x22\x0c\x00\x0a\x13\x01\xfd\x0c\x07\x80\xe0\x30\x0c\x39"
-                                    "\x7f\xff\x97\x04\x03\x00\xc0\x30\x0c\x03\x00\xe0\x78\x1e\x07\x80\xc0\x20\x21\x00"
-                                    "\x22\x0c\x00\x0a\x13\x01\xfd\x0c\x07\x80\xe0\x30\x0c\x39\x7f\xff\x97\x0c\x03\x00"
-                                    "\xc0\x30\xe5\xff\xfe\x5c\x30\x0c\x07\x80\xe0\x20\x22\x00\x11\x0b\x00\x07\x08\x02"
-                                    "\x04\x39\xff\xff\xff\xff\xff\x9c\x20\x26\x00\x11\x16\x00\x12\x03\x02\x00\xe0\xc1"
-                                    "\xf8\x78\x7e\x0c\x1c\x20\x30\x00\x36\x16\x00\x16\x10\x00\x00\x38\x18\x01\x90\x40"
-                                    "\x0c\x62\x00\x31\x98\x00\xc6\x40\x03\x1a\x00\x06\x48\x00\x0e\x40\x00\x03\x00\x00"
-                                    "\x09\xc1\xc0\x4c\xc9\x81\x73\x63\x09\x8d\x8c\x67\x36\x31\x0c\xd9\x8c\x1e\x3c\x20"
-                                    "\x39\x00\x0e\x06\x00\x04\x08\x01\x01\x13\x6c\xe6\x31\x20\x3A\x00\x0e\x06\x00\x04"
-                                    "\x08\x01\x01\x8c\x67\x76\x88\x20\x44\x00\x20\x04\x00\x0b\x10\xfc\x00\x00\x20\x08"
-                                    "\x01\x00\x40\x18\x02\x00\x80\x10\x04\x01\x80\x20\x0c\x01\x00\x40\x08\x06\x00\x21"
-                                    "\x22\x00\x23\x16\x00\x16\x09\x00\x07\xff\x78\x1e\x72\x60\xc1\xc1\xc3\x07\x07\x1c"
-                                    "\x1c\x1e\xb0\x70\x5a\xc1\xc1\x73\x07\x04\xcc\x3e\x3a\x7c\x22\x12\x00\x0d\x0d\x00"
-                                    "\x0b\x02\x01\x04\xff\xff\xfc\xFB\x00\x00\x2e\x0f\x00\x12\x10\x00\x00\x00\x1f\x03"
-                                    "\xce\x63\x9b\x9c\xe6\xe6\x38\x38\x3f\xbf\x83\x83\x80\xe0\xe0\x38\x38\x0e\x0e\x03"
-                                    "\x83\x80\xe0\xe0\x38\x38\x0e\x0e\x03\x83\x83\xfb\xf8\xFB\x01\x00\x26\x0e\x00\x0e"
-                                    "\x10\x00\x00\x07\xc0\x63\x83\x8e\x0e\x00\x38\x03\xfb\xc3\x87\x0e\x1c\x38\x70\xe1"
-                                    "\xc3\x87\x0e\x1c\x38\x70\xe1\xc3\x87\x3f\xbf\xFB\x02\x00\x26\x0e\x00\x0e\x10\x00"
-                                    "\x00\x07\xf0\x71\xc3\x87\x0e\x1c\x38\x73\xf9\xc3\x87\x0e\x1c\x38\x70\xe1\xc3\x87"
-                                    "\x0e\x1c\x38\x70\xe1\xc3\x87\x3f\xff\xFB\x03\x00\x36\x16\x00\x16\x10\x00\x00\x00"
-                                    "\x0f\xc0\x18\x63\x81\x9b\x8e\x0e\x6e\x00\x38\x38\x03\xfb\xff\xc3\x83\x87\x0e\x0e"
-                                    "\x1c\x38\x38\x70\xe0\xe1\xc3\x83\x87\x0e\x0e\x1c\x38\x38\x70\xe0\xe1\xc3\x83\x87"
-                                    "\x3f\xbf\xff\xFB\x04\x00\x36\x16\x00\x16\x10\x00\x00\x00\x07\xf0\x3c\x71\xc3\x9b"
-                                    "\x87\x0e\x6e\x1c\x38\x38\x73\xfb\xf9\xc3\x83\x87\x0e\x0e\x1c\x38\x38\x70\xe0\xe1"
-                                    "\xc3\x83\x87\x0e\x0e\x1c\x38\x38\x70\xe0\xe1\xc3\x83\x87\x3f\xbf\xff";
+static constexpr Character bailleul_bold_16_pt_characters[233] = {
+    {0x0000, 0, 9, 16, 8, 16, 0, 0},
+    {0x0020, 16, 6, 0, 0, 0, 0, 0},
+    {0x0021, 16, 7, 0, 4, 16, 1, 0},
+    {0x0022, 24, 11, 0, 6, 7, 2, 9},
+    {0x0023, 30, 12, 0, 11, 16, 1, 0},
+    {0x0024, 52, 12, 0, 11, 20, 1, -2},
+    {0x0025, 80, 22, 0, 18, 16, 2, 0},
+    {0x0026, 116, 18, 0, 16, 16, 1, 0},
+    {0x0027, 148, 5, 0, 3, 7, 1, 9},
+    {0x0028, 151, 10, 0, 7, 22, 2, -6},
+    {0x0029, 171, 10, 0, 8, 22, 0, -6},
+    {0x002A, 193, 9, 0, 7, 7, 1, 9},
+    {0x002B, 200, 13, 0, 11, 11, 1, 0},
+    {0x002C, 216, 6, 0, 4, 7, 1, -4},
+    {0x002D, 220, 9, 0, 7, 2, 1, 4},
+    {0x002E, 222, 6, 0, 4, 3, 1, 0},
+    {0x002F, 224, 9, 0, 8, 16, 0, 0},
+    {0x0030, 240, 12, 0, 10, 16, 1, 0},
+    {0x0031, 260, 12, 0, 7, 16, 3, 0},
+    {0x0032, 274, 13, 0, 12, 16, 0, 0},
+    {0x0033, 298, 13, 0, 11, 16, 1, 0},
+    {0x0034, 320, 12, 0, 10, 16, 1, 0},
+    {0x0035, 340, 12, 0, 10, 17, 1, 0},
+    {0x0036, 362, 12, 0, 10, 16, 1, 0},
+    {0x0037, 382, 12, 0, 10, 16, 1, 0},
+    {0x0038, 402, 12, 0, 10, 16, 1, 0},
+    {0x0039, 422, 12, 0, 10, 16, 1, 0},
+    {0x003A, 442, 6, 0, 4, 11, 1, 0},
+    {0x003B, 448, 6, 0, 4, 15, 1, -4},
+    {0x003C, 456, 13, 0, 11, 11, 1, 0},
+    {0x003D, 472, 13, 0, 11, 7, 1, 2},
+    {0x003E, 482, 13, 0, 11, 11, 1, 0},
+    {0x003F, 498, 11, 0, 8, 16, 2, 0},
+    {0x0040, 514, 18, 0, 16, 16, 1, 0},
+    {0x0041, 546, 16, 0, 16, 16, 0, 0},
+    {0x0042, 578, 16, 0, 14, 16, 1, 0},
+    {0x0043, 606, 17, 0, 15, 16, 1, 0},
+    {0x0044, 636, 19, 0, 17, 16, 1, 0},
+    {0x0045, 670, 16, 0, 14, 16, 1, 0},
+    {0x0046, 698, 15, 0, 14, 16, 0, 0},
+    {0x0047, 726, 19, 0, 18, 16, 1, 0},
+    {0x0048, 762, 19, 0, 17, 16, 1, 0},
+    {0x0049, 796, 9, 0, 7, 16, 1, 0},
+    {0x004A, 810, 11, 0, 11, 16, 0, 0},
+    {0x004B, 832, 18, 0, 17, 16, 1, 0},
+    {0x004C, 866, 16, 0, 14, 16, 1, 0},
+    {0x004D, 894, 22, 0, 21, 16, 0, 0},
+    {0x004E, 936, 18, 0, 17, 16, 1, 0},
+    {0x004F, 970, 19, 0, 17, 16, 1, 0},
+    {0x0050, 1004, 16, 0, 14, 16, 1, 0},
+    {0x0051, 1032, 19, 0, 18, 20, 1, -4},
+    {0x0052, 1077, 17, 0, 15, 16, 1, 0},
+    {0x0053, 1107, 13, 0, 11, 16, 1, 0},
+    {0x0054, 1129, 17, 0, 15, 16, 1, 0},
+    {0x0055, 1159, 18, 0, 17, 16, 0, 0},
+    {0x0056, 1193, 15, 0, 15, 16, 0, 0},
+    {0x0057, 1223, 25, 0, 25, 16, 0, 0},
+    {0x0058, 1273, 16, 0, 16, 16, 0, 0},
+    {0x0059, 1305, 16, 0, 16, 16, 0, 0},
+    {0x005A, 1337, 15, 0, 15, 16, 0, 0},
+    {0x005B, 1367, 9, 0, 5, 21, 3, -5},
+    {0x005C, 1381, 9, 0, 8, 16, 0, 0},
+    {0x005D, 1397, 9, 0, 5, 21, 1, -5},
+    {0x005E, 1411, 12, 0, 10, 8, 1, 7},
+    {0x005F, 1421, 11, 0, 11, 1, 0, -3},
+    {0x0060, 1423, 6, 0, 5, 4, -1, 12},
+    {0x0061, 1426, 13, 0, 12, 11, 1, 0},
+    {0x0062, 1443, 14, 0, 13, 16, 0, 0},
+    {0x0063, 1469, 12, 0, 10, 11, 1, 0},
+    {0x0064, 1483, 14, 0, 13, 16, 1, 0},
+    {0x0065, 1509, 13, 0, 11, 11, 1, 0},
+    {0x0066, 1525, 8, 0, 10, 16, 0, 0},
+    {0x0067, 1545, 13, 0, 12, 16, 1, -5},
+    {0x0068, 1569, 15, 0, 14, 16, 0, 0},
+    {0x0069, 1597, 7, 0, 7, 16, 0, 0},
+    {0x006A, 1611, 7, 0, 5, 21, 0, -5},
+    {0x006B, 1625, 14, 0, 14, 16, 0, 0},
+    {0x006C, 1653, 7, 0, 7, 16, 0, 0},
+    {0x006D, 1667, 22, 0, 22, 11, 0, 0},
+    {0x006E, 1698, 15, 0, 14, 11, 0, 0},
+    {0x006F, 1718, 13, 0, 11, 11, 1, 0},
+    {0x0070, 1734, 14, 0, 13, 16, 0, -5},
+    {0x0071, 1760, 14, 0, 13, 16, 1, -5},
+    {0x0072, 1786, 10, 0, 10, 11, 0, 0},
+    {0x0073, 1800, 10, 0, 8, 11, 1, 0},
+    {0x0074, 1811, 9, 0, 8, 14, 0, 0},
+    {0x0075, 1825, 15, 0, 14, 11, 0, 0},
+    {0x0076, 1845, 13, 0, 13, 11, 0, 0},
+    {0x0077, 1863, 20, 0, 20, 11, 0, 0},
+    {0x0078, 1891, 13, 0, 13, 11, 0, 0},
+    {0x0079, 1909, 13, 0, 13, 16, 0, -5},
+    {0x007A, 1935, 11, 0, 9, 11, 1, 0},
+    {0x007B, 1948, 9, 0, 6, 21, 1, -5},
+    {0x007C, 1964, 5, 0, 3, 22, 1, -5},
+    {0x007D, 1973, 9, 0, 6, 21, 2, -5},
+    {0x007E, 1989, 12, 0, 10, 4, 1, 4},
+    {0x00A1, 1994, 7, 0, 4, 16, 1, -5},
+    {0x00A2, 2002, 12, 0, 10, 16, 1, -2},
+    {0x00A3, 2022, 12, 0, 11, 16, 0, 0},
+    {0x00A4, 2044, 12, 0, 12, 11, 0, 2},
+    {0x00A5, 2061, 12, 0, 14, 16, -1, 0},
+    {0x00A6, 2089, 5, 0, 3, 16, 1, -2},
+    {0x00A7, 2095, 12, 0, 10, 21, 1, -5},
+    {0x00A8, 2122, 6, 0, 8, 3, -1, 12},
+    {0x00A9, 2125, 18, 0, 16, 16, 1, 0},
+    {0x00AA, 2157, 8, 0, 8, 7, 0, 9},
+    {0x00AB, 2164, 9, 0, 9, 8, 0, 1},
+    {0x00AC, 2173, 13, 0, 11, 6, 1, 3},
+    {0x00AD, 2182, 8, 0, 4, 1, 2, 4},
+    {0x00AE, 2183, 11, 0, 8, 9, 1, 7},
+    {0x00AF, 2192, 6, 0, 6, 2, 0, 13},
+    {0x00B0, 2194, 9, 0, 7, 6, 1, 9},
+    {0x00B1, 2200, 13, 0, 11, 11, 1, 0},
+    {0x00B2, 2216, 9, 0, 8, 10, 0, 10},
+    {0x00B3, 2226, 9, 0, 9, 10, 0, 10},
+    {0x00B4, 2238, 6, 0, 5, 4, 2, 12},
+    {0x00B5, 2241, 15, 0, 14, 16, 0, -5},
+    {0x00B6, 2269, 13, 0, 11, 20, 1, -4},
+    {0x00B7, 2297, 6, 0, 4, 4, 1, 4},
+    {0x00B8, 2299, 6, 0, 5, 5, 1, -5},
+    {0x00B9, 2303, 8, 0, 5, 10, 2, 10},
+    {0x00BA, 2310, 9, 0, 8, 7, 0, 9},
+    {0x00BB, 2317, 9, 0, 9, 8, 0, 1},
+    {0x00BC, 2326, 18, 0, 16, 17, 1, 0},
+    {0x00BD, 2360, 18, 0, 17, 16, 1, 0},
+    {0x00BE, 2394, 18, 0, 17, 17, 0, 0},
+    {0x00BF, 2431, 11, 0, 8, 16, 1, -5},
+    {0x00C0, 2447, 16, 0, 16, 21, 0, 0},
+    {0x00C1, 2489, 16, 0, 16, 21, 0, 0},
+    {0x00C2, 2531, 16, 0, 16, 21, 0, 0},
+    {0x00C3, 2573, 16, 0, 16, 21, 0, 0},
+    {0x00C4, 2615, 16, 0, 16, 20, 0, 0},
+    {0x00C5, 2655, 16, 0, 16, 21, 0, 0},
+    {0x00C6, 2697, 23, 0, 22, 16, 0, 0},
+    {0x00C7, 2741, 17, 0, 15, 21, 1, -5},
+    {0x00C8, 2781, 16, 0, 14, 21, 1, 0},
+    {0x00C9, 2818, 16, 0, 14, 21, 1, 0},
+    {0x00CA, 2855, 16, 0, 14, 21, 1, 0},
+    {0x00CB, 2892, 16, 0, 14, 20, 1, 0},
+    {0x00CC, 2927, 9, 0, 7, 21, 1, 0},
+    {0x00CD, 2946, 9, 0, 7, 21, 1, 0},
+    {0x00CE, 2965, 9, 0, 7, 21, 1, 0},
+    {0x00CF, 2984, 9, 0, 7, 20, 1, 0},
+    {0x00D0, 3002, 19, 0, 17, 16, 1, 0},
+    {0x00D1, 3036, 18, 0, 17, 21, 1, 0},
+    {0x00D2, 3081, 19, 0, 17, 20, 1, 0},
+    {0x00D3, 3124, 19, 0, 17, 20, 1, 0},
+    {0x00D4, 3167, 19, 0, 17, 20, 1, 0},
+    {0x00D5, 3210, 19, 0, 17, 20, 1, 0},
+    {0x00D6, 3253, 19, 0, 17, 19, 1, 0},
+    {0x00D7, 3294, 13, 0, 11, 11, 1, 0},
+    {0x00D8, 3310, 19, 0, 17, 16, 1, 0},
+    {0x00D9, 3344, 18, 0, 17, 21, 0, 0},
+    {0x00DA, 3389, 18, 0, 17, 21, 0, 0},
+    {0x00DB, 3434, 18, 0, 17, 21, 0, 0},
+    {0x00DC, 3479, 18, 0, 17, 20, 0, 0},
+    {0x00DD, 3522, 16, 0, 16, 21, 0, 0},
+    {0x00DE, 3564, 16, 0, 14, 16, 1, 0},
+    {0x00DF, 3592, 14, 0, 13, 16, 0, 0},
+    {0x00E0, 3618, 13, 0, 12, 16, 1, 0},
+    {0x00E1, 3642, 13, 0, 12, 16, 1, 0},
+    {0x00E2, 3666, 13, 0, 12, 16, 1, 0},
+    {0x00E3, 3690, 13, 0, 12, 16, 1, 0},
+    {0x00E4, 3714, 13, 0, 12, 15, 1, 0},
+    {0x00E5, 3737, 13, 0, 12, 17, 1, 0},
+    {0x00E6, 3763, 19, 0, 17, 11, 1, 0},
+    {0x00E7, 3787, 12, 0, 10, 16, 1, -5},
+    {0x00E8, 3807, 13, 0, 11, 16, 1, 0},
+    {0x00E9, 3829, 13, 0, 11, 16, 1, 0},
+    {0x00EA, 3851, 13, 0, 11, 16, 1, 0},
+    {0x00EB, 3873, 13, 0, 11, 15, 1, 0},
+    {0x00EC, 3894, 7, 0, 7, 16, 0, 0},
+    {0x00ED, 3908, 7, 0, 7, 16, 0, 0},
+    {0x00EE, 3922, 7, 0, 7, 16, 0, 0},
+    {0x00EF, 3936, 7, 0, 7, 15, 0, 0},
+    {0x00F0, 3950, 13, 0, 11, 17, 1, 0},
+    {0x00F1, 3974, 15, 0, 14, 16, 0, 0},
+    {0x00F2, 4002, 13, 0, 11, 16, 1, 0},
+    {0x00F3, 4024, 13, 0, 11, 16, 1, 0},
+    {0x00F4, 4046, 13, 0, 11, 16, 1, 0},
+    {0x00F5, 4068, 13, 0, 11, 16, 1, 0},
+    {0x00F6, 4090, 13, 0, 11, 15, 1, 0},
+    {0x00F7, 4111, 13, 0, 11, 13, 1, -1},
+    {0x00F8, 4129, 13, 0, 12, 11, 1, 0},
+    {0x00F9, 4146, 15, 0, 14, 16, 0, 0},
+    {0x00FA, 4174, 15, 0, 14, 16, 0, 0},
+    {0x00FB, 4202, 15, 0, 14, 16, 0, 0},
+    {0x00FC, 4230, 15, 0, 14, 15, 0, 0},
+    {0x00FD, 4257, 13, 0, 13, 21, 0, -5},
+    {0x00FE, 4292, 14, 0, 13, 21, 0, -5},
+    {0x00FF, 4327, 13, 0, 13, 20, 0, -5},
+    {0x0131, 4360, 7, 0, 7, 11, 0, 0},
+    {0x0141, 4370, 16, 0, 14, 16, 1, 0},
+    {0x0142, 4398, 7, 0, 7, 16, 0, 0},
+    {0x0152, 4412, 26, 0, 24, 16, 1, 0},
+    {0x0153, 4460, 20, 0, 18, 11, 1, 0},
+    {0x0160, 4485, 13, 0, 11, 21, 1, 0},
+    {0x0161, 4514, 10, 0, 8, 16, 1, 0},
+    {0x0178, 4530, 16, 0, 16, 20, 0, 0},
+    {0x017D, 4570, 15, 0, 15, 21, 0, 0},
+    {0x017E, 4610, 11, 0, 9, 16, 1, 0},
+    {0x0192, 4628, 12, 0, 13, 21, -1, -5},
+    {0x02C6, 4663, 6, 0, 8, 4, -1, 12},
+    {0x02C7, 4667, 6, 0, 8, 4, -1, 12},
+    {0x02D8, 4671, 6, 0, 6, 4, 0, 12},
+    {0x02D9, 4674, 6, 0, 3, 3, 2, 12},
+    {0x02DA, 4676, 6, 0, 4, 5, 1, 12},
+    {0x02DB, 4679, 6, 0, 5, 5, 0, -5},
+    {0x02DC, 4683, 6, 0, 8, 3, -1, 13},
+    {0x02DD, 4686, 6, 0, 10, 4, 0, 12},
+    {0x2013, 4691, 11, 0, 11, 2, 0, 4},
+    {0x2014, 4694, 22, 0, 16, 2, 3, 4},
+    {0x2018, 4698, 5, 0, 4, 7, 0, 9},
+    {0x2019, 4702, 5, 0, 4, 7, 0, 9},
+    {0x201A, 4706, 5, 0, 4, 7, 0, -4},
+    {0x201C, 4710, 11, 0, 9, 7, 1, 9},
+    {0x201D, 4718, 11, 0, 9, 7, 1, 9},
+    {0x201E, 4726, 11, 0, 9, 7, 1, -4},
+    {0x2020, 4734, 12, 0, 10, 19, 1, -3},
+    {0x2021, 4758, 12, 0, 10, 19, 1, -3},
+    {0x2022, 4782, 11, 0, 7, 8, 2, 4},
+    {0x2026, 4789, 22, 0, 18, 3, 2, 0},
+    {0x2030, 4796, 22, 0, 22, 16, 0, 0},
+    {0x2039, 4840, 6, 0, 4, 8, 1, 1},
+    {0x203A, 4844, 6, 0, 4, 8, 1, 1},
+    {0x2044, 4848, 4, 0, 11, 16, -4, 0},
+    {0x2122, 4870, 22, 0, 22, 9, 0, 7},
+    {0x2212, 4895, 13, 0, 11, 2, 1, 4},
+    {0xFB00, 4898, 15, 0, 18, 16, 0, 0},
+    {0xFB01, 4934, 14, 0, 14, 16, 0, 0},
+    {0xFB02, 4962, 14, 0, 14, 16, 0, 0},
+    {0xFB03, 4990, 22, 0, 22, 16, 0, 0},
+    {0xFB04, 5034, 22, 0, 22, 16, 0, 0},
+};
+
+static constexpr uint8_t bailleul_bold_16_pt_bitmaps[5079] = "\xff\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81"
+                                                             "\x81\x81\x81\xff\x67\x77\x76\x66\x62\x22\x07\xf7"
+                                                             "\xcf\x3c\xf3\xcd\x14\x40\x19\x83\x30\x66\x0c\xc1"
+                                                             "\x19\xff\xff\xf9\x98\x33\x06\x63\xff\x7f\xe6\x30"
+                                                             "\xc4\x19\x83\x30\x04\x00\x80\xfc\x32\xcc\x4d\x88"
+                                                             "\xb9\x17\xe0\xfe\x0f\xf0\xff\x03\xe0\x5f\x09\xe1"
+                                                             "\x36\x26\xe4\x8f\xe0\x10\x02\x00\x3c\x06\x19\x83"
+                                                             "\x0c\x60\x83\x1c\x40\xc7\x10\x31\x88\x06\x66\x00"
+                                                             "\xf1\x00\x00\x8f\x00\x26\x60\x11\x8c\x0c\xe3\x02"
+                                                             "\x38\xc1\x86\x30\x41\x98\x20\x3c\x03\xc0\x0e\x60"
+                                                             "\x0c\x60\x0e\x40\x0f\x80\x0f\x3f\x0f\x8c\x17\x88"
+                                                             "\x63\xc8\xe3\xc8\xe1\xf1\xe1\xf1\xe0\xf1\xf0\xf1"
+                                                             "\x78\xfe\x3f\x3c\xdf\x64\x90\x02\x08\x30\xc3\x0e"
+                                                             "\x1c\x70\xe1\xc3\x87\x0e\x1c\x18\x38\x70\x60\x60"
+                                                             "\x60\x60\x40\x80\x60\x30\x18\x1c\x0c\x0e\x0e\x0f"
+                                                             "\x07\x07\x07\x07\x0e\x0e\x0e\x0c\x1c\x18\x30\x60"
+                                                             "\x80\x39\xff\x5f\xf2\x8d\x9b\x00\x0e\x01\xc0\x38"
+                                                             "\x07\x0f\xff\xff\xc3\x80\x70\x0e\x01\xc0\x38\x00"
+                                                             "\x6f\xf1\x12\x40\xff\xfc\x6f\x60\x03\x03\x07\x06"
+                                                             "\x0e\x0c\x0c\x1c\x18\x18\x38\x30\x70\x60\x60\xe0"
+                                                             "\x1e\x0c\xc7\x19\x87\xe1\xf8\x7e\x1f\x87\xe1\xf8"
+                                                             "\x7e\x1f\x87\x61\xdc\x63\x30\x78\x08\x30\xe3\xcb"
+                                                             "\x87\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7f\x1f\x82"
+                                                             "\x1c\x40\xe7\x0e\x78\xe3\x0e\x00\xe0\x0c\x01\x80"
+                                                             "\x30\x04\x00\x81\x10\x23\xfe\x7f\xcf\xfc\x3e\x0c"
+                                                             "\x71\x8e\x31\xe0\x38\x07\x01\x81\xf0\x03\x80\x38"
+                                                             "\x07\x80\xfe\x1f\x83\xb0\xe1\xf0\x03\x00\xc0\x70"
+                                                             "\x3c\x1f\x05\xc2\x71\x9c\x47\x21\xdf\xfc\x1d\x07"
+                                                             "\x41\xd0\x70\x1c\x00\x8f\xe3\xf1\xf8\x40\x10\x04"
+                                                             "\x01\x78\x63\x90\xe0\x3c\x0f\x03\xe0\xf8\x39\x0c"
+                                                             "\x3e\x00\x0f\x0e\x63\x1d\xc7\x60\xb8\x0e\xf3\xce"
+                                                             "\xf1\xf8\x7e\x1f\x87\x61\xdc\x73\x38\x7c\x7f\xdf"
+                                                             "\xf7\xfa\x02\x81\x00\x40\x30\x08\x06\x01\x80\xe0"
+                                                             "\x38\x1c\x07\x01\xc0\xf0\x1f\x08\x66\x0d\x83\xe0"
+                                                             "\xde\x67\xf0\xfe\x2f\xd8\xfc\x1f\x03\xc0\xf8\x36"
+                                                             "\x18\x78\x1e\x1c\xc6\x1b\x87\xe1\xf8\x7e\x1f\x87"
+                                                             "\xe1\xdc\xf3\xdc\x07\x61\x98\xe6\x30\xf0\x6f\x60"
+                                                             "\x00\x00\x6f\x60\x6f\xf6\x00\x00\x6f\xf1\x12\x40"
+                                                             "\x00\x60\x3c\x1f\x1f\x8f\x81\xc0\x3e\x00\xf8\x07"
+                                                             "\xc0\x3c\x00\x80\xff\xff\xfc\x00\x00\x00\x01\xff"
+                                                             "\xff\xf8\xc0\x1e\x01\xf8\x07\xc0\x3e\x01\xc0\xf8"
+                                                             "\xfc\x7c\x1e\x03\x00\x00\x7c\xc6\xc7\xc7\x07\x07"
+                                                             "\x07\x0e\x18\x10\x20\x20\x00\x30\x78\x30\x07\xe0"
+                                                             "\x1f\xf8\x38\x1c\x70\x06\x61\xdb\xe3\x33\xc6\x33"
+                                                             "\xc6\x33\xc4\x33\xcc\x62\xe6\xa4\xe7\x38\x70\x00"
+                                                             "\x38\x08\x1f\xf8\x07\xe0\x01\x80\x01\x80\x01\x80"
+                                                             "\x03\xc0\x03\xc0\x03\xc0\x05\xe0\x05\xe0\x08\xf0"
+                                                             "\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10\x38\x20\x3c"
+                                                             "\xf8\xff\xff\xe0\xe1\xc3\x87\x8e\x1e\x38\x78\xe1"
+                                                             "\xc3\x86\x0f\xf0\x38\x70\xe0\xe3\x83\xce\x0f\x38"
+                                                             "\x3c\xe0\xf3\x87\xbf\xf8\x07\xf0\x38\x38\xe0\x31"
+                                                             "\xc0\x27\x00\x4e\x00\x7c\x00\x78\x00\xf0\x01\xe0"
+                                                             "\x01\xc0\x0b\x80\x13\x80\x67\x01\xc7\x07\x83\xf8"
+                                                             "\xff\xf0\x1c\x0e\x0e\x03\x87\x01\xe3\x80\x71\xc0"
+                                                             "\x3c\xe0\x1e\x70\x0f\x38\x07\x9c\x03\xce\x01\xe7"
+                                                             "\x00\xe3\x80\xf1\xc0\x70\xe0\x71\xff\xe0\xff\xf8"
+                                                             "\xe0\x63\x80\x8e\x02\x38\x48\xe1\x03\x8c\x0f\xf0"
+                                                             "\x38\xc0\xe1\x03\x84\x4e\x01\x38\x04\xe0\x33\x81"
+                                                             "\xff\xff\xff\xfc\x70\x71\xc0\x47\x01\x1c\x04\x70"
+                                                             "\x81\xc2\x07\x18\x1f\xe0\x71\x81\xc2\x07\x08\x1c"
+                                                             "\x00\x70\x01\xc0\x3f\xc0\x03\xf8\x03\x03\x81\x80"
+                                                             "\x60\xe0\x08\x70\x02\x1c\x00\x0f\x00\x03\xc0\x00"
+                                                             "\xf0\x3f\xfc\x03\xc7\x00\xf1\xc0\x3c\x38\x0f\x0e"
+                                                             "\x03\xc1\xc1\xe0\x1f\xc0\xfe\x7f\x9c\x07\x0e\x03"
+                                                             "\x87\x01\xc3\x80\xe1\xc0\x70\xe0\x38\x7f\xfc\x38"
+                                                             "\x0e\x1c\x07\x0e\x03\x87\x01\xc3\x80\xe1\xc0\x70"
+                                                             "\xe0\x39\xfc\xff\xfe\x70\xe1\xc3\x87\x0e\x1c\x38"
+                                                             "\x70\xe1\xc3\x87\x0e\x7f\x1f\xe0\xf0\x1e\x03\xc0"
+                                                             "\x78\x0f\x01\xe0\x3c\x07\x80\xf0\x1e\x23\xce\x79"
+                                                             "\xce\x31\xc3\xf0\xfe\x7e\x1c\x08\x0e\x08\x07\x08"
+                                                             "\x03\x88\x01\xc4\x00\xe7\x00\x7f\x80\x39\xe0\x1c"
+                                                             "\xf0\x0e\x3c\x07\x0f\x03\x87\x81\xc1\xe0\xe0\xf1"
+                                                             "\xfc\xff\xfe\x00\xe0\x03\x80\x0e\x00\x38\x00\xe0"
+                                                             "\x03\x80\x0e\x00\x38\x00\xe0\x03\x80\x4e\x01\x38"
+                                                             "\x04\xe0\x33\x81\xff\xff\xfe\x01\xf8\xf0\x0f\x07"
+                                                             "\x80\xb8\x5e\x05\xc2\xf0\x2e\x13\x82\x70\x9e\x13"
+                                                             "\x84\xf1\x1c\x23\xc8\xe1\x1e\x87\x08\x74\x38\x43"
+                                                             "\xe1\xc2\x1e\x0e\x10\x70\x70\x83\x03\x9f\x88\xff"
+                                                             "\xfc\x1f\x9f\x01\x0f\xc0\x85\xf0\x42\x78\x21\x3e"
+                                                             "\x10\x8f\x88\x43\xe4\x20\xf2\x10\x3d\x08\x1f\x84"
+                                                             "\x07\xc2\x01\xe1\x00\x70\x80\x19\xf0\x0c\x07\xf0"
+                                                             "\x0e\x0e\x0e\x03\x87\x01\xe7\x00\x73\x80\x3b\xc0"
+                                                             "\x1f\xe0\x0f\xf0\x07\xf8\x03\xdc\x01\xce\x00\xe3"
+                                                             "\x80\xf1\xc0\x70\x70\x70\x0f\xe0\xff\xf0\xe0\xe3"
+                                                             "\x83\xce\x0f\x38\x3c\xe0\xf3\x83\xce\x1e\x3f\xe0"
+                                                             "\xe0\x03\x80\x0e\x00\x38\x00\xe0\x03\x80\x3f\xc0"
+                                                             "\x07\xf0\x07\x07\x03\x80\xe0\xe0\x3c\x70\x07\x1c"
+                                                             "\x01\xcf\x00\x7b\xc0\x1e\xf0\x07\xbc\x01\xe7\x00"
+                                                             "\x71\xe0\x1c\x38\x0e\x06\x03\x80\xc1\x80\x0f\x80"
+                                                             "\x07\xf0\x43\x0e\x20\x81\xf8\x00\x3c\xff\xe0\x70"
+                                                             "\xe0\xe1\xe1\xc3\xc3\x87\x87\x0e\x0e\x18\x1f\xe0"
+                                                             "\x38\x70\x70\x70\xe0\xe1\xc1\xc3\x83\x87\x07\x0e"
+                                                             "\x0f\x7f\x8f\x1f\x0c\x39\x83\x70\x2e\x05\xf0\x1f"
+                                                             "\x83\xfc\x1f\xc0\xfc\x07\xc0\x38\x07\x80\xb8\x31"
+                                                             "\xf8\xff\xff\x87\x0e\x0e\x1c\x1c\x18\x38\x20\x70"
+                                                             "\x00\xe0\x01\xc0\x03\x80\x07\x00\x0e\x00\x1c\x00"
+                                                             "\x38\x00\x70\x00\xe0\x07\xf0\xff\x0f\x8e\x01\x07"
+                                                             "\x00\x83\x80\x41\xc0\x20\xe0\x10\x70\x08\x38\x04"
+                                                             "\x1c\x02\x0e\x01\x07\x00\x83\x80\x41\xc0\x20\xe0"
+                                                             "\x10\x78\x10\x0f\xf0\xff\x1e\x78\x10\xf0\x20\xf0"
+                                                             "\x41\xe1\x01\xc2\x03\xc4\x07\x90\x07\x20\x0f\x40"
+                                                             "\x1f\x00\x1e\x00\x38\x00\x70\x00\x60\x00\x80\xff"
+                                                             "\x3f\xcf\x9e\x07\x81\x0f\x05\xc0\x83\x82\xf0\x81"
+                                                             "\xe1\x78\x40\xf1\x1c\x20\x38\x8f\x20\x1e\x43\x90"
+                                                             "\x0f\x41\xc8\x03\xa0\xf8\x01\xf0\x3c\x00\xf0\x1e"
+                                                             "\x00\x38\x0e\x00\x1c\x03\x00\x0c\x01\x80\x02\x00"
+                                                             "\x80\xff\x3e\x3c\x10\x1e\x10\x1f\x20\x0f\x40\x07"
+                                                             "\xc0\x07\x80\x03\xc0\x03\xc0\x03\xe0\x04\xf0\x04"
+                                                             "\xf0\x08\x78\x10\x78\x10\x3c\xf8\xff\xff\x1f\x3c"
+                                                             "\x04\x1e\x08\x1e\x08\x0f\x10\x07\xa0\x07\xa0\x03"
+                                                             "\xc0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03"
+                                                             "\xc0\x03\xc0\x0f\xf0\x3f\xfe\x60\x78\x81\xe1\x07"
+                                                             "\x84\x0f\x00\x3c\x00\xf0\x01\xe0\x07\x80\x1e\x00"
+                                                             "\x3c\x00\xf0\x23\xc0\x47\x81\x9e\x07\x7f\xfe\xff"
+                                                             "\x39\xce\x73\x9c\xe7\x39\xce\x73\x9c\xe7\x39\xcf"
+                                                             "\x80\xe0\x60\x60\x70\x30\x38\x18\x18\x1c\x0c\x0c"
+                                                             "\x0e\x06\x07\x03\x03\xf9\xce\x73\x9c\xe7\x39\xce"
+                                                             "\x73\x9c\xe7\x39\xce\x7f\x80\x0c\x07\x81\xe0\xec"
+                                                             "\x33\x1c\x66\x1b\x83\xff\xe0\xc7\x1c\x30\x3f\x86"
+                                                             "\x1c\x61\xc6\x1c\x0f\xc7\x1c\xe1\xce\x1c\xe1\xce"
+                                                             "\x3c\x7d\xf0\xf8\x01\xc0\x0e\x00\x70\x03\x80\x1d"
+                                                             "\xe0\xf1\x87\x0e\x38\x79\xc3\xce\x1e\x70\xf3\x87"
+                                                             "\x9c\x38\xf1\x87\x78\x1f\x0c\x77\x1f\x87\xe0\x38"
+                                                             "\x0e\x03\xc1\x70\x4c\x21\xf0\x03\xe0\x07\x00\x38"
+                                                             "\x01\xc0\x0e\x0f\x71\xc7\x8e\x1c\xe0\xe7\x07\x38"
+                                                             "\x39\xc1\xce\x0e\x38\x71\xc7\x87\xdf\x1f\x06\x39"
+                                                             "\xc7\x70\xff\xff\xc0\x38\x07\x81\x70\x46\x18\x7c"
+                                                             "\x00\x0f\x8e\x73\x9c\xe6\x38\x3f\x83\x80\xe0\x38"
+                                                             "\x0e\x03\x80\xe0\x38\x0e\x03\x83\xf8\x1f\x73\x1b"
+                                                             "\x71\xb7\x1c\x71\x83\x38\x5e\x0c\x00\xff\x8f\xfc"
+                                                             "\x7f\xe4\x0e\xc0\x6c\x06\xc0\xc3\xf0\xf8\x00\xe0"
+                                                             "\x03\x80\x0e\x00\x38\x00\xef\x83\xc7\x0e\x1c\x38"
+                                                             "\x78\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xe3\x87\xbf"
+                                                             "\xbf\x38\x70\xe0\x00\x1f\x0e\x1c\x38\x70\xe1\xc3"
+                                                             "\x87\x0e\x7f\x39\xce\x00\x7c\xe7\x39\xce\x73\x9c"
+                                                             "\xe7\x39\xce\x6e\x00\xf8\x00\xe0\x03\x80\x0e\x00"
+                                                             "\x38\x00\xe7\xc3\x84\x0e\x20\x39\x00\xe6\x03\xfc"
+                                                             "\x0e\x70\x39\xe0\xe3\xc3\x87\xbf\xbf\xf8\x70\xe1"
+                                                             "\xc3\x87\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7f\xfb"
+                                                             "\xe3\xc0\xf1\xd1\x83\xc7\x87\x0e\x1e\x1c\x38\x78"
+                                                             "\x70\xe1\xe1\xc3\x87\x87\x0e\x1e\x1c\x38\x78\x70"
+                                                             "\xe1\xe1\xcf\xef\xdf\xc0\xfb\xe0\xf1\xc3\x87\x0e"
+                                                             "\x1e\x38\x78\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xef"
+                                                             "\xef\xc0\x1f\x06\x39\xc3\xf0\x7e\x0f\xc1\xf8\x3f"
+                                                             "\x07\x70\xe6\x38\x7c\x00\xfb\xe1\xe3\x8f\x0e\x70"
+                                                             "\x73\x83\x9c\x1c\xe0\xe7\x07\x38\x39\xe3\x8e\xf8"
+                                                             "\x70\x03\x80\x1c\x00\xe0\x1f\xc0\x1e\xe3\x8f\x1c"
+                                                             "\x39\xc1\xce\x0e\x70\x73\x83\x9c\x1c\x70\xe3\x8f"
+                                                             "\x07\xb8\x01\xc0\x0e\x00\x70\x03\x80\x3f\xfb\xcf"
+                                                             "\x73\xdc\xe0\x38\x0e\x03\x80\xe0\x38\x0e\x0f\xe0"
+                                                             "\x3e\x42\xc2\xf0\xfc\x7f\x1f\x87\x83\xc2\x7c\x08"
+                                                             "\x38\x38\xfe\x38\x38\x38\x38\x38\x38\x38\x38\x38"
+                                                             "\x1f\xf8\xf8\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xe3"
+                                                             "\x87\x8e\x1e\x38\x78\x63\xe0\xf7\xc0\xfc\x79\xc1"
+                                                             "\x0f\x08\x38\x81\xe4\x07\x40\x3a\x01\xe0\x07\x00"
+                                                             "\x30\x00\x80\xfe\xfc\xf3\x87\x84\x38\x78\x81\xcb"
+                                                             "\xc8\x1c\x9c\x81\xf1\xd0\x0f\x0f\x00\xf0\xe0\x06"
+                                                             "\x0e\x00\x60\x60\x04\x04\x00\xfe\xf0\xe2\x07\xa0"
+                                                             "\x1d\x00\xf0\x03\xc0\x1e\x01\x78\x09\xe0\x8f\x1e"
+                                                             "\xfe\xfe\x79\xc1\x0f\x08\x38\x81\xe4\x07\x40\x3a"
+                                                             "\x01\xf0\x07\x00\x38\x00\x80\x04\x06\x20\x72\x01"
+                                                             "\x90\x0f\x00\xff\xe3\xe1\xd1\xc1\xe0\xe0\xf0\x71"
+                                                             "\x78\xf8\xff\xe0\x1c\xe3\x8e\x38\xe3\x8e\x38\xce"
+                                                             "\x1c\x30\xe3\x8e\x38\xe3\x8e\x1c\xff\xff\xff\xff"
+                                                             "\xff\xff\xff\xff\xc0\xe1\xc7\x1c\x71\xc7\x1c\x70"
+                                                             "\xc1\xce\x71\xc7\x1c\x71\xc7\x1c\xe0\x70\x7f\x3c"
+                                                             "\xfe\x0e\x7f\x70\x22\x26\x66\x67\x77\x76\x04\x01"
+                                                             "\x00\x40\x7c\x35\xdd\x7e\x5f\x90\xe4\x39\x0f\x45"
+                                                             "\xd1\x34\x87\xc0\x40\x10\x03\x81\x98\x23\x0c\x01"
+                                                             "\x80\x38\x07\x03\xfc\x1c\x01\x80\x30\x86\x10\x82"
+                                                             "\xd0\xff\xf3\x3e\x6f\x2f\xff\x38\xe7\x06\x60\x66"
+                                                             "\x07\x60\x77\x06\x38\xef\xff\x6f\x20\xfe\x3c\xf0"
+                                                             "\x41\xc1\x07\x88\x0e\x20\x3d\x00\x74\x01\xe0\x1f"
+                                                             "\xf0\x1e\x00\x78\x07\xfc\x07\x80\x1e\x00\x78\x07"
+                                                             "\xf8\xff\xfe\x00\x00\x7f\xff\x1f\x0c\x66\x1d\x87"
+                                                             "\xa0\x2c\x09\x83\x78\xcf\x19\xe7\x38\xe7\x1e\xc3"
+                                                             "\x90\x34\x05\x61\xf8\x5e\x19\x8c\x3e\x00\x66\xe7"
+                                                             "\x66\x07\xe0\x1f\xf8\x38\x1c\x63\xce\xe6\x26\xcc"
+                                                             "\x23\xdc\x03\xdc\x03\xdc\x03\xdc\x03\xcc\x13\xe6"
+                                                             "\x26\x63\xce\x38\x1c\x1f\xf8\x07\xe0\x3c\x66\x0e"
+                                                             "\x76\xe6\x66\x7f\x08\x88\x8d\xdd\xc6\x61\x98\x66"
+                                                             "\x11\xff\xff\xfc\x01\x80\x30\x06\x00\xc0\xf0\x3c"
+                                                             "\x43\x99\x95\x99\x95\x9b\x43\x3c\xff\xf0\x38\x8a"
+                                                             "\x1c\x34\x47\x00\x0e\x01\xc0\x38\x7f\xff\xfe\x1c"
+                                                             "\x03\x80\x70\x00\x1f\xff\xff\x80\x3e\x47\x67\x63"
+                                                             "\x06\x04\x18\x21\x7e\xfe\x3e\x33\x81\xc0\xc3\xc0"
+                                                             "\x18\x0e\xc7\xc3\x3f\x00\x19\xdd\x80\xf8\xf8\xe1"
+                                                             "\xe3\x87\x8e\x1e\x38\x78\xe1\xe3\x87\x8e\x1e\x38"
+                                                             "\x78\xe3\xe3\xf7\xcc\x00\x30\x00\xe0\x03\x80\x0c"
+                                                             "\x00\x1f\xef\xbb\xf7\x7e\xef\xdd\xfb\xbf\x73\xee"
+                                                             "\x3d\xc0\xb8\x17\x02\xe0\x5c\x0b\x81\x70\x2c\x05"
+                                                             "\x8e\xb1\xac\x1e\x00\x6f\xf6\x23\x86\x3f\x00\x33"
+                                                             "\xbc\xe7\x39\xce\x77\xc0\x1c\x63\x63\xe3\x63\x63"
+                                                             "\x1c\xc8\x33\x0c\xc7\x73\xbb\x31\x11\x10\x00\x08"
+                                                             "\x10\x08\x70\x10\xb0\x30\x30\x20\x30\x60\x30\x40"
+                                                             "\x30\x82\x30\x86\x31\x0e\xfb\x1e\x02\x2e\x04\x4f"
+                                                             "\x04\x7f\x08\x0f\x18\x0e\x30\x00\x10\x08\x18\x08"
+                                                             "\x1c\x0c\x16\x04\x03\x06\x01\x82\x00\xc2\x00\x61"
+                                                             "\x3c\x31\x33\x7d\x99\x80\x80\xc0\x80\x40\x40\x40"
+                                                             "\x40\xc4\x60\x7c\x60\xfe\x00\x04\x1c\x02\x19\x82"
+                                                             "\x08\xc3\x00\xc1\x01\xc1\x80\x18\x80\x0e\x86\xc7"
+                                                             "\x43\x63\x43\x8e\x63\xc0\x22\xe0\x22\x78\x11\xfc"
+                                                             "\x10\x1e\x18\x0e\x18\x00\x00\x1c\x1c\x1c\x00\x08"
+                                                             "\x08\x08\x30\x60\xe0\xe0\xe0\xe7\xe7\xe3\x3c\x06"
+                                                             "\x00\x07\x00\x03\x00\x00\xc0\x00\x00\x01\x80\x01"
+                                                             "\x80\x01\x80\x03\xc0\x03\xc0\x03\xc0\x05\xe0\x05"
+                                                             "\xe0\x08\xf0\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10"
+                                                             "\x38\x20\x3c\xf8\xff\x00\x30\x00\x60\x00\xc0\x03"
+                                                             "\x00\x00\x00\x01\x80\x01\x80\x01\x80\x03\xc0\x03"
+                                                             "\xc0\x03\xc0\x05\xe0\x05\xe0\x08\xf0\x08\xf0\x0f"
+                                                             "\xf0\x10\x78\x10\x78\x10\x38\x20\x3c\xf8\xff\x01"
+                                                             "\xc0\x03\xc0\x06\x60\x0c\x30\x00\x00\x01\x80\x01"
+                                                             "\x80\x01\x80\x03\xc0\x03\xc0\x03\xc0\x05\xe0\x05"
+                                                             "\xe0\x08\xf0\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10"
+                                                             "\x38\x20\x3c\xf8\xff\x07\x10\x07\xf0\x08\xe0\x00"
+                                                             "\x00\x00\x00\x01\x80\x01\x80\x01\x80\x03\xc0\x03"
+                                                             "\xc0\x03\xc0\x05\xe0\x05\xe0\x08\xf0\x08\xf0\x0f"
+                                                             "\xf0\x10\x78\x10\x78\x10\x38\x20\x3c\xf8\xff\x06"
+                                                             "\x60\x0e\x70\x06\x70\x00\x00\x01\x80\x01\x80\x01"
+                                                             "\x80\x03\xc0\x03\xc0\x03\xc0\x05\xe0\x05\xe0\x08"
+                                                             "\xf0\x08\xf0\x0f\xf0\x10\x78\x10\x78\x10\x38\x20"
+                                                             "\x3c\xf8\xff\x01\x80\x02\x40\x02\x60\x02\x40\x01"
+                                                             "\x80\x01\x80\x01\x80\x01\x80\x03\xc0\x03\xc0\x03"
+                                                             "\xc0\x05\xe0\x05\xe0\x08\xf0\x08\xf0\x0f\xf0\x10"
+                                                             "\x78\x10\x78\x10\x38\x20\x3c\xf8\xff\x01\xff\xf8"
+                                                             "\x01\xe0\x60\x0b\x80\x80\x2e\x02\x01\x38\x48\x04"
+                                                             "\xe1\x00\x23\x8c\x00\x8f\xf0\x04\x38\xc0\x1f\xe1"
+                                                             "\x00\x83\x84\x42\x0e\x01\x10\x38\x04\x40\xe0\x32"
+                                                             "\x03\x81\xfe\x3f\xff\x07\xf0\x38\x38\xe0\x31\xc0"
+                                                             "\x27\x00\x4e\x00\x7c\x00\x78\x00\xf0\x01\xe0\x01"
+                                                             "\xc0\x0b\x80\x17\x80\x67\x01\xc7\x07\x83\xf8\x00"
+                                                             "\x80\x01\xc0\x05\x80\x03\x00\x3e\x00\x1c\x00\x38"
+                                                             "\x00\x60\x00\x60\x00\x03\xff\xe3\x81\x8e\x02\x38"
+                                                             "\x08\xe1\x23\x84\x0e\x30\x3f\xc0\xe3\x03\x84\x0e"
+                                                             "\x11\x38\x04\xe0\x13\x80\xce\x07\xff\xfc\x00\xe0"
+                                                             "\x03\x00\x18\x01\x80\x00\x03\xff\xe3\x81\x8e\x02"
+                                                             "\x38\x08\xe1\x23\x84\x0e\x30\x3f\xc0\xe3\x03\x84"
+                                                             "\x0e\x11\x38\x04\xe0\x13\x80\xce\x07\xff\xfc\x03"
+                                                             "\x00\x1e\x00\xcc\x06\x18\x00\x03\xff\xe3\x81\x8e"
+                                                             "\x02\x38\x08\xe1\x23\x84\x0e\x30\x3f\xc0\xe3\x03"
+                                                             "\x84\x0e\x11\x38\x04\xe0\x13\x80\xce\x07\xff\xfc"
+                                                             "\x0c\xc0\x73\x80\xcc\x00\x00\xff\xf8\xe0\x63\x80"
+                                                             "\x8e\x02\x38\x48\xe1\x03\x8c\x0f\xf0\x38\xc0\xe1"
+                                                             "\x03\x84\x4e\x01\x38\x04\xe0\x33\x81\xff\xff\xc1"
+                                                             "\xc0\xc0\xc0\x1f\xce\x1c\x38\x70\xe1\xc3\x87\x0e"
+                                                             "\x1c\x38\x70\xe1\xcf\xe0\x06\x1c\x71\x80\x1f\xce"
+                                                             "\x1c\x38\x70\xe1\xc3\x87\x0e\x1c\x38\x70\xe1\xcf"
+                                                             "\xe0\x38\xf9\xb6\x30\x1f\xce\x1c\x38\x70\xe1\xc3"
+                                                             "\x87\x0e\x1c\x38\x70\xe1\xcf\xe0\xc7\xdf\x18\x0f"
+                                                             "\xe7\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x1c\x38\x70"
+                                                             "\xe7\xf0\xff\xf0\x1c\x0e\x0e\x03\x87\x01\xe3\x80"
+                                                             "\x71\xc0\x3c\xe0\x1f\xff\x0f\x38\x07\x9c\x03\xce"
+                                                             "\x01\xe7\x00\xe3\x80\xf1\xc0\x70\xe0\x71\xff\xe0"
+                                                             "\x07\x10\x03\xf8\x02\x38\x00\x00\x00\x00\x07\xe0"
+                                                             "\xfc\xf8\x08\x7e\x04\x2f\x82\x13\xc1\x09\xf0\x84"
+                                                             "\x7c\x42\x1f\x21\x07\x90\x81\xe8\x40\xfc\x20\x3e"
+                                                             "\x10\x0f\x08\x03\x84\x00\xcf\x80\x60\x03\x00\x01"
+                                                             "\xc0\x00\x60\x00\x08\x00\x7f\x00\xe0\xe0\xe0\x38"
+                                                             "\x70\x1e\x70\x07\x38\x03\xbc\x01\xfe\x00\xff\x00"
+                                                             "\x7f\x80\x3d\xc0\x1c\xe0\x0e\x38\x0f\x1c\x07\x07"
+                                                             "\x07\x00\xfe\x00\x00\x18\x00\x1c\x00\x18\x00\x18"
+                                                             "\x00\x7f\x00\xe0\xe0\xe0\x38\x70\x1e\x70\x07\x38"
+                                                             "\x03\xbc\x01\xfe\x00\xff\x00\x7f\x80\x3d\xc0\x1c"
+                                                             "\xe0\x0e\x38\x0f\x1c\x07\x07\x07\x00\xfe\x00\x01"
+                                                             "\xc0\x00\xf0\x00\xd8\x00\xc6\x00\x7f\x00\xe0\xe0"
+                                                             "\xe0\x38\x70\x1e\x70\x07\x38\x03\xbc\x01\xfe\x00"
+                                                             "\xff\x00\x7f\x80\x3d\xc0\x1c\xe0\x0e\x38\x0f\x1c"
+                                                             "\x07\x07\x07\x00\xfe\x00\x03\x88\x03\xf8\x01\x38"
+                                                             "\x00\x00\x00\x7f\x00\xe0\xe0\xe0\x38\x70\x1e\x70"
+                                                             "\x07\x38\x03\xbc\x01\xfe\x00\xff\x00\x7f\x80\x3d"
+                                                             "\xc0\x1c\xe0\x0e\x38\x0f\x1c\x07\x07\x07\x00\xfe"
+                                                             "\x00\x06\x30\x03\xb8\x01\x8c\x00\xfe\x01\xc1\xc1"
+                                                             "\xc0\x70\xe0\x3c\xe0\x0e\x70\x07\x78\x03\xfc\x01"
+                                                             "\xfe\x00\xff\x00\x7b\x80\x39\xc0\x1c\x70\x1e\x38"
+                                                             "\x0e\x0e\x0e\x01\xfc\x00\x20\x5c\x1d\xc7\x1d\xc1"
+                                                             "\xf0\x1c\x07\xc1\xdc\x71\xfc\x18\x81\x00\x07\xf0"
+                                                             "\x8e\x0e\x8e\x03\x87\x01\xe7\x80\xf3\x80\xbb\xc0"
+                                                             "\x9f\xe0\x8f\xf0\x87\xf8\x83\xdc\x81\xee\x80\xe3"
+                                                             "\x80\xf1\xc0\x71\x30\x71\x0f\xe0\x03\x00\x01\xc0"
+                                                             "\x00\x70\x00\x0c\x00\x00\x07\xf8\x7c\x70\x08\x38"
+                                                             "\x04\x1c\x02\x0e\x01\x07\x00\x83\x80\x41\xc0\x20"
+                                                             "\xe0\x10\x70\x08\x38\x04\x1c\x02\x0e\x01\x07\x00"
+                                                             "\x83\xc0\x80\x7f\x80\x00\x18\x00\x1c\x00\x18\x00"
+                                                             "\x18\x00\x00\x07\xf8\x7c\x70\x08\x38\x04\x1c\x02"
+                                                             "\x0e\x01\x07\x00\x83\x80\x41\xc0\x20\xe0\x10\x70"
+                                                             "\x08\x38\x04\x1c\x02\x0e\x01\x07\x00\x83\xc0\x80"
+                                                             "\x7f\x80\x01\xc0\x00\xf0\x00\xc8\x00\xc2\x00\x00"
+                                                             "\x07\xf8\x7c\x70\x08\x38\x04\x1c\x02\x0e\x01\x07"
+                                                             "\x00\x83\x80\x41\xc0\x20\xe0\x10\x70\x08\x38\x04"
+                                                             "\x1c\x02\x0e\x01\x07\x00\x83\xc0\x80\x7f\x80\x03"
+                                                             "\x30\x03\x9c\x00\xce\x00\x00\x0f\xf0\xf8\xe0\x10"
+                                                             "\x70\x08\x38\x04\x1c\x02\x0e\x01\x07\x00\x83\x80"
+                                                             "\x41\xc0\x20\xe0\x10\x70\x08\x38\x04\x1c\x02\x0e"
+                                                             "\x01\x07\x81\x00\xff\x00\x00\x30\x00\x70\x00\xe0"
+                                                             "\x01\x80\x00\x00\xff\x1f\x3c\x04\x1e\x08\x1e\x08"
+                                                             "\x0f\x10\x07\xa0\x07\xa0\x03\xc0\x03\xc0\x03\xc0"
+                                                             "\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x0f\xf0"
+                                                             "\xfe\x00\xe0\x03\x80\x0f\xfc\x38\x78\xe0\xf3\x83"
+                                                             "\xce\x0f\x38\x3c\xe0\xf3\x87\x8f\xf8\x38\x00\xe0"
+                                                             "\x03\x80\x3f\x80\x07\xe0\xe3\x86\x1c\x70\xe3\x87"
+                                                             "\x1c\x30\xe6\x07\x0e\x38\x71\xc1\xce\x0e\x70\x73"
+                                                             "\x83\x9d\x1c\xe5\xdf\xbc\x30\x03\x80\x0c\x00\x60"
+                                                             "\x00\x03\xf8\x61\xc6\x1c\x61\xc0\xfc\x71\xce\x1c"
+                                                             "\xe1\xce\x1c\xe3\xc7\xdf\x01\x80\x38\x07\x00\xc0"
+                                                             "\x00\x03\xf8\x61\xc6\x1c\x61\xc0\xfc\x71\xce\x1c"
+                                                             "\xe1\xce\x1c\xe3\xc7\xdf\x0e\x00\xf0\x1b\x03\x18"
+                                                             "\x00\x03\xf8\x61\xc6\x1c\x61\xc0\xfc\x71\xce\x1c"
+                                                             "\xe1\xce\x1c\xe3\xc7\xdf\x1c\xc3\xf8\x27\x04\x00"
+                                                             "\x00\x03\xf8\x61\xc6\x1c\x61\xc0\xfc\x71\xce\x1c"
+                                                             "\xe1\xce\x1c\xe3\xc7\xdf\x31\x83\xb8\x31\x80\x00"
+                                                             "\x3f\x86\x1c\x61\xc6\x1c\x0f\xc7\x1c\xe1\xce\x1c"
+                                                             "\xe1\xce\x3c\x7d\xf0\x0e\x01\x90\x11\x01\x90\x0e"
+                                                             "\x00\x00\x3f\x86\x1c\x61\xc6\x1c\x0f\xc7\x1c\xe1"
+                                                             "\xce\x1c\xe1\xce\x3c\x7d\xf0\x3e\x3e\x30\xe1\x98"
+                                                             "\x70\xe0\x78\x71\xdf\xfb\x8e\x03\x87\x01\xc3\x80"
+                                                             "\xe3\xc0\xf1\x70\x9f\x1f\x80\x1f\x0c\x77\x1f\x87"
+                                                             "\xe0\x38\x0e\x03\xc1\x70\x5c\x21\xf0\x10\x07\x02"
+                                                             "\xc0\x30\x7c\x30\x07\x00\x30\x03\x80\x00\x3e\x0c"
+                                                             "\x73\x8e\xe1\xff\xff\x80\x70\x0f\x02\xe0\x8c\x30"
+                                                             "\xf8\x01\xc0\x30\x0c\x06\x00\x00\x3e\x0c\x73\x8e"
+                                                             "\xe1\xff\xff\x80\x70\x0f\x02\xe0\x8c\x30\xf8\x0e"
+                                                             "\x03\xc0\x6c\x10\xc0\x00\x3e\x0c\x73\x8e\xe1\xff"
+                                                             "\xff\x80\x70\x0f\x02\xe0\x8c\x30\xf8\x31\x86\x70"
+                                                             "\xc6\x00\x01\xf0\x63\x9c\x77\x0f\xff\xfc\x03\x80"
+                                                             "\x78\x17\x04\x61\x87\xc0\xc1\xc0\xc0\xc0\x1f\x0e"
+                                                             "\x1c\x38\x70\xe1\xc3\x87\x0e\x7f\x06\x1c\x71\x80"
+                                                             "\x1f\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7f\x38\x79"
+                                                             "\xb6\x10\x1f\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x7f"
+                                                             "\xc7\xcf\x18\x0f\x87\x0e\x1c\x38\x70\xe1\xc3\x87"
+                                                             "\x3f\x80\x00\x8f\x70\x38\x1f\x86\x38\x03\x87\xf9"
+                                                             "\x8f\x70\xfc\x1f\x83\xf0\x7e\x0f\xc1\xdc\x31\x8e"
+                                                             "\x1f\x00\x06\x20\x3f\x81\x1c\x00\x00\x00\x03\xef"
+                                                             "\x83\xc7\x0e\x1c\x38\x78\xe1\xe3\x87\x8e\x1e\x38"
+                                                             "\x78\xe1\xe3\x87\xbf\xbf\x30\x07\x00\x30\x03\x80"
+                                                             "\x00\x3e\x0c\x73\x87\xe0\xfc\x1f\x83\xf0\x7e\x0e"
+                                                             "\xe1\xcc\x70\xf8\x01\xc0\x30\x0c\x06\x00\x00\x3e"
+                                                             "\x0c\x73\x87\xe0\xfc\x1f\x83\xf0\x7e\x0e\xe1\xcc"
+                                                             "\x70\xf8\x0e\x01\xe0\x64\x18\x40\x00\x3e\x0c\x73"
+                                                             "\x87\xe0\xfc\x1f\x83\xf0\x7e\x0e\xe1\xcc\x70\xf8"
+                                                             "\x1c\x47\xf0\x9e\x00\x00\x00\x3e\x0c\x73\x87\xe0"
+                                                             "\xfc\x1f\x83\xf0\x7e\x0e\xe1\xcc\x70\xf8\x31\x87"
+                                                             "\x30\xc6\x00\x01\xf0\x63\x9c\x3f\x07\xe0\xfc\x1f"
+                                                             "\x83\xf0\x77\x0e\x63\x87\xc0\x0e\x01\xc0\x38\x07"
+                                                             "\x00\x00\x00\x3f\xff\xff\x00\x01\xc0\x38\x07\x00"
+                                                             "\xe0\x1f\x13\x1e\x70\xce\x1e\xe3\xee\x4e\xe8\xef"
+                                                             "\x0e\x70\xe7\x1c\x9f\x00\x0c\x00\x38\x00\x70\x00"
+                                                             "\x60\x00\x03\xe3\xe3\x87\x8e\x1e\x38\x78\xe1\xe3"
+                                                             "\x87\x8e\x1e\x38\x78\xe1\xe1\x8f\x83\xdf\x00\x60"
+                                                             "\x03\x80\x18\x00\xc0\x00\x03\xe3\xe3\x87\x8e\x1e"
+                                                             "\x38\x78\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xe1\x8f"
+                                                             "\x83\xdf\x03\x00\x1e\x00\xcc\x06\x18\x00\x03\xe3"
+                                                             "\xe3\x87\x8e\x1e\x38\x78\xe1\xe3\x87\x8e\x1e\x38"
+                                                             "\x78\xe1\xe1\x8f\x83\xdf\x0c\xc0\x73\x80\xce\x00"
+                                                             "\x00\xf8\xf8\xe1\xe3\x87\x8e\x1e\x38\x78\xe1\xe3"
+                                                             "\x87\x8e\x1e\x38\x78\x63\xe0\xf7\xc0\x00\xe0\x06"
+                                                             "\x00\x60\x0c\x00\x00\x7f\x3c\xe0\x87\x84\x1c\x40"
+                                                             "\xf2\x03\xa0\x1d\x00\xf8\x03\x80\x1c\x00\x40\x02"
+                                                             "\x03\x10\x39\x00\xc8\x07\x80\x00\xf8\x01\xc0\x0e"
+                                                             "\x00\x70\x03\x80\x1d\xf0\xf1\xc7\x87\x38\x39\xc1"
+                                                             "\xce\x0e\x70\x73\x83\x9c\x1c\xf1\xc7\x7c\x38\x01"
+                                                             "\xc0\x0e\x00\x70\x0f\xe0\x00\x18\xc0\xce\x06\x30"
+                                                             "\x00\x0f\xe7\x9c\x10\xf0\x83\x88\x1e\x40\x74\x03"
+                                                             "\xa0\x1f\x00\x70\x03\x80\x08\x00\x40\x62\x07\x20"
+                                                             "\x19\x00\xf0\x00\xf8\x70\xe1\xc3\x87\x0e\x1c\x38"
+                                                             "\x73\xf8\xfe\x00\xe0\x03\x80\x0e\x10\x39\x80\xec"
+                                                             "\x03\xe0\x0f\x00\x38\x03\xe0\x0b\x80\x6e\x01\x38"
+                                                             "\x04\xe0\x33\x81\xff\xff\xf8\x70\xe1\xc3\xa7\xce"
+                                                             "\x1c\x79\x70\xe1\xc3\x87\x0e\x7f\x07\xff\xfe\x1c"
+                                                             "\x1e\x0e\x38\x1e\x06\x38\x0e\x02\x70\x0e\x22\x70"
+                                                             "\x0e\x20\xf0\x0e\x20\xf0\x0f\xe0\xf0\x0e\x20\xf0"
+                                                             "\x0e\x20\x70\x0e\x21\x70\x0e\x01\x38\x0e\x03\x38"
+                                                             "\x1e\x03\x1c\x1e\x07\x07\xff\xff\x1f\x1f\x0c\x7c"
+                                                             "\xe7\x0e\x1f\x83\x87\xe0\xff\xf8\x38\x0e\x0e\x03"
+                                                             "\x83\x80\x70\xe0\x4c\x7c\x21\xf1\xf0\x31\x83\x60"
+                                                             "\x3c\x07\x00\x00\x3e\x18\x73\x06\xe0\x5c\x0b\xe0"
+                                                             "\x3f\x07\xf8\x3f\x81\xf8\x0f\x80\x70\x0f\x01\x70"
+                                                             "\x63\xf0\xc3\x66\x3c\x18\x00\x3e\x42\xc2\xf0\xfc"
+                                                             "\x7f\x1f\x87\x83\xc2\x7c\x06\x30\x07\x30\x07\x30"
+                                                             "\x00\x00\xff\x1f\x3c\x04\x1e\x08\x1e\x08\x0f\x10"
+                                                             "\x07\xa0\x07\xa0\x03\xc0\x03\xc0\x03\xc0\x03\xc0"
+                                                             "\x03\xc0\x03\xc0\x03\xc0\x03\xc0\x0f\xf0\x08\x60"
+                                                             "\x0d\x80\x1e\x00\x1c\x00\x00\x07\xff\xcc\x0f\x10"
+                                                             "\x3c\x20\xf0\x81\xe0\x07\x80\x1e\x00\x3c\x00\xf0"
+                                                             "\x03\xc0\x07\x80\x1e\x04\x78\x08\xf0\x33\xc0\xef"
+                                                             "\xff\xc0\x63\x1b\x0f\x83\x80\x07\xff\x1f\x0e\x8e"
+                                                             "\x0f\x07\x07\x83\x8b\xc7\xc7\xff\x00\x70\x04\xc0"
+                                                             "\x66\x03\x30\x38\x01\xc0\x0e\x00\x70\x1f\xe0\x38"
+                                                             "\x01\xc0\x0e\x00\x70\x03\x80\x1c\x00\xe0\x07\x00"
+                                                             "\x30\x3b\x81\xd8\x07\x80\x00\x18\x3c\x66\xc3\xc3"
+                                                             "\x66\x3c\x18\x86\x1f\xde\xdf\x00\x69\x99\x60\x33"
+                                                             "\x31\x97\x00\x71\x7f\x8e\x19\xce\x66\x33\x30\xff"
+                                                             "\xff\xfc\xff\xff\xff\xff\x12\x44\xf7\x70\x7f\x71"
+                                                             "\x12\x40\x7f\x71\x12\x40\x21\x21\x21\x10\x8e\x77"
+                                                             "\xbf\x8c\xe7\x7b\xfd\xe2\x12\x12\x1a\x10\xe7\x7b"
+                                                             "\xfd\xe2\x12\x13\x1a\x10\x0c\x07\x80\xe0\x30\x0c"
+                                                             "\x39\x7f\xff\x97\x04\x03\x00\xc0\x30\x0c\x03\x00"
+                                                             "\xe0\x78\x1e\x07\x80\xc0\x0c\x07\x80\xe0\x30\x0c"
+                                                             "\x39\x7f\xff\x97\x0c\x03\x00\xc0\x30\xe5\xff\xfe"
+                                                             "\x5c\x30\x0c\x07\x80\xe0\x39\xff\xff\xff\xff\xff"
+                                                             "\x9c\xe0\xc1\xf8\x78\x7e\x0c\x1c\x38\x18\x01\x90"
+                                                             "\x40\x0c\x62\x00\x31\x98\x00\xc6\x40\x03\x1a\x00"
+                                                             "\x06\x48\x00\x0e\x40\x00\x03\x00\x00\x09\xc1\xc0"
+                                                             "\x4c\xc9\x81\x73\x63\x09\x8d\x8c\x67\x36\x31\x0c"
+                                                             "\xd9\x8c\x1e\x3c\x13\x6c\xe6\x31\x8c\x67\x76\x88"
+                                                             "\x00\x20\x08\x01\x00\x40\x18\x02\x00\x80\x10\x04"
+                                                             "\x01\x80\x20\x0c\x01\x00\x40\x08\x06\x00\xff\x78"
+                                                             "\x1e\x72\x60\xc1\xc1\xc3\x07\x07\x1c\x1c\x1e\xb0"
+                                                             "\x70\x5a\xc1\xc1\x73\x07\x04\xcc\x3e\x3a\x7c\xff"
+                                                             "\xff\xfc\x00\x1f\x03\xce\x63\x9b\x9c\xe6\xe6\x38"
+                                                             "\x38\x3f\xbf\x83\x83\x80\xe0\xe0\x38\x38\x0e\x0e"
+                                                             "\x03\x83\x80\xe0\xe0\x38\x38\x0e\x0e\x03\x83\x83"
+                                                             "\xfb\xf8\x07\xc0\x63\x83\x8e\x0e\x00\x38\x03\xfb"
+                                                             "\xc3\x87\x0e\x1c\x38\x70\xe1\xc3\x87\x0e\x1c\x38"
+                                                             "\x70\xe1\xc3\x87\x3f\xbf\x07\xf0\x71\xc3\x87\x0e"
+                                                             "\x1c\x38\x73\xf9\xc3\x87\x0e\x1c\x38\x70\xe1\xc3"
+                                                             "\x87\x0e\x1c\x38\x70\xe1\xc3\x87\x3f\xff\x00\x0f"
+                                                             "\xc0\x18\x63\x81\x9b\x8e\x0e\x6e\x00\x38\x38\x03"
+                                                             "\xfb\xff\xc3\x83\x87\x0e\x0e\x1c\x38\x38\x70\xe0"
+                                                             "\xe1\xc3\x83\x87\x0e\x0e\x1c\x38\x38\x70\xe0\xe1"
+                                                             "\xc3\x83\x87\x3f\xbf\xff\x00\x07\xf0\x3c\x71\xc3"
+                                                             "\x9b\x87\x0e\x6e\x1c\x38\x38\x73\xfb\xf9\xc3\x83"
+                                                             "\x87\x0e\x0e\x1c\x38\x38\x70\xe0\xe1\xc3\x83\x87"
+                                                             "\x0e\x0e\x1c\x38\x38\x70\xe0\xe1\xc3\x83\x87\x3f"
+                                                             "\xbf\xff";
+
+constexpr Font bailleul_bold_16_pt = {
+    .size = 16,
+    .numCharacters = 232,
+    .boundingBoxWidth = 29,
+    .boundingBoxHeight = 27,
+    .boundingBoxXOffset = -4,
+    .boundingBoxYOffset = -6,
+    .ascent = 21,
+    .descent = 5,
+    .asciiIndex = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                   28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+                   53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+                   78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95},
+    .characters = bailleul_bold_16_pt_characters,
+    .bitmaps = bailleul_bold_16_pt_bitmaps,
+};
 
 // intel_one_mono
 //   - (C) 2023 Intel Corporation"
 //   - Size: 8
 //   - Characters: 622
-uint8_t intel_one_mono_8_pt[9558] = "\x08\x02\x6e\x0a\x10\xfe\xfc\x0b\x03\x00\x00\x00\x0e\x05\x08\x04\x08\x00\x00\xf9"
-                                    "\x99\x99\x9f\x00\x20\x00\x0a\x07\x00\x00\x00\x00\x00\x00\x21\x00\x0c\x07\x00\x02"
-                                    "\x08\x02\x00\x55\x43\x00\x22\x00\x0c\x07\x00\x04\x03\x01\x05\xdd\x50\x00\x23\x00"
-                                    "\x10\x07\x00\x06\x07\x00\x00\x24\xa7\xca\xfd\x25\x00\x00\x24\x00\x11\x07\x00\x05"
-                                    "\x0b\x01\xfe\x21\x1f\x4a\x38\xa5\xf1\x08\x00\x25\x00\x10\x07\x00\x06\x07\x00\x00"
-                                    "\x66\x69\x1b\x35\x54\xc0\x00\x26\x00\x0f\x07\x00\x05\x07\x01\x00\x72\x10\xd9\x4b"
-                                    "\xa0\x00\x27\x00\x0b\x07\x00\x01\x03\x03\x05\xe0\x00\x28\x00\x11\x07\x00\x05\x0b"
-                                    "\x01\xfe\x19\x10\x88\x42\x08\x41\x06\x00\x29\x00\x10\x07\x00\x04\x0b\x01\xfe\x86"
-                                    "\x21\x11\x11\x26\x80\x00\x2A\x00\x0e\x07\x00\x05\x05\x01\x02\x25\x5c\xa9\x00\x00"
-                                    "\x2B\x00\x0e\x07\x00\x05\x05\x01\x01\x21\x3e\x42\x00\x00\x2C\x00\x0b\x07\x00\x02"
-                                    "\x03\x02\xfe\x78\x00\x2D\x00\x0b\x07\x00\x04\x01\x01\x03\xf0\x00\x2E\x00\x0b\x07"
-                                    "\x00\x02\x02\x02\x00\x70\x00\x2F\x00\x10\x07\x00\x05\x09\x01\xff\x08\x44\x42\x21"
-                                    "\x10\x80\x00\x30\x00\x0f\x07\x00\x05\x07\x01\x00\x74\x67\x5c\xc5\xc0\x00\x31\x00"
-                                    "\x0f\x07\x00\x05\x07\x01\x00\x27\x08\x42\x13\xe0\x00\x32\x00\x0f\x07\x00\x05\x07"
-                                    "\x01\x00\x74\x42\x22\x23\xe0\x00\x33\x00\x0f\x07\x00\x05\x07\x01\x00\xf8\x88\xe0"
-                                    "\x87\xc0\x00\x34\x00\x0f\x07\x00\x05\x07\x01\x00\x31\x95\x2f\x88\x40\x00\x35\x00"
-                                    "\x0f\x07\x00\x05\x07\x01\x00\xf4\x3c\x10\x8f\x80\x00\x36\x00\x0f\x07\x00\x05\x07"
-                                    "\x01\x00\x33\x31\xe8\xc5\xc0\x00\x37\x00\x0f\x07\x00\x05\x07\x01\x00\xf8\x44\x22"
-                                    "\x31\x00\x00\x38\x00\x0f\x07\x00\x05\x07\x01\x00\x74\x62\xe8\xc5\xc0\x00\x39\x00"
-                                    "\x0f\x07\x00\x05\x07\x01\x00\x74\x63\xf1\x19\x80\x00\x3A\x00\x0c\x07\x00\x02\x05"
-                                    "\x02\x00\xd1\xc0\x00\x3B\x00\x0c\x07\x00\x02\x07\x02\xfe\x50\x78\x00\x3C\x00\x0e"
-                                    "\x07\x00\x05\x05\x01\x01\x1b\x20\xc1\x80\x00\x3D\x00\x0c\x07\x00\x05\x03\x01\x02"
-                                    "\xf8\x3e\x00\x3E\x00\x0e\x07\x00\x05\x05\x01\x01\x83\x82\xe8\x00\x00\x3F\x00\x0f"
-                                    "\x07\x00\x05\x08\x01\x00\xf0\x42\x64\x00\x0c\x00\x40\x00\x10\x07\x00\x05\x09\x01"
-                                    "\xff\x74\x6f\x9c\xe6\xf0\x70\x00\x41\x00\x0f\x07\x00\x05\x07\x01\x00\x22\x94\xaf"
-                                    "\x46\x20\x00\x42\x00\x0f\x07\x00\x05\x07\x01\x00\xf4\x63\xe8\xc7\xe0\x00\x43\x00"
-                                    "\x0f\x07\x00\x05\x07\x01\x00\x74\x61\x08\x45\xc0\x00\x44\x00\x0f\x07\x00\x05\x07"
-                                    "\x01\x00\xf4\xe3\x18\xcf\x80\x00\x45\x00\x0f\x07\x00\x05\x07\x01\x00\xfc\x21\xe8"
-                                    "\x43\xe0\x00\x46\x00\x0f\x07\x00\x05\x07\x01\x00\xfc\x21\xe8\x42\x00\x00\x47\x00"
-                                    "\x0f\x07\x00\x05\x07\x01\x00\x7c\x21\x78\xc5\xe0\x00\x48\x00\x0f\x07\x00\x05\x07"
-                                    "\x01\x00\x8c\x63\xf8\xc6\x20\x00\x49\x00\x0d\x07\x00\x03\x07\x02\x00\xe9\x24\xb8"
-                                    "\x00\x4A\x00\x0f\x07\x00\x05\x07\x01\x00\x08\x42\x10\xc5\xc0\x00\x4B\x00\x0f\x07"
-                                    "\x00\x05\x07\x01\x00\x8c\xa9\x8a\x4a\x20\x00\x4C\x00\x0f\x07\x00\x05\x07\x01\x00"
-                                    "\x84\x21\x08\x43\xe0\x00\x4D\x00\x0f\x07\x00\x05\x07\x01\x00\x8e\xf7\x5a\xc6\x20"
-                                    "\x00\x4E\x00\x0f\x07\x00\x05\x07\x01\x00\x8e\x73\x5a\xce\x60\x00\x4F\x00\x0f\x07"
-                                    "\x00\x05\x07\x01\x00\x74\x63\x18\xc5\xc0\x00\x50\x00\x0f\x07\x00\x05\x07\x01\x00"
-                                    "\xf4\x63\x1f\x42\x00\x00\x51\x00\x11\x07\x00\x06\x09\x01\xfe\x72\x28\xa2\xaa\x67"
-                                    "\x02\x04\x00\x52\x00\x0f\x07\x00\x05\x07\x01\x00\xf4\x63\xea\x4a\x20\x00\x53\x00"
-                                    "\x0f\x07\x00\x05\x07\x01\x00\x7c\x20\xe0\x87\xc0\x00\x54\x00\x0f\x07\x00\x05\x07"
-                                    "\x01\x00\xf9\x08\x42\x10\x80\x00\x55\x00\x0f\x07\x00\x05\x07\x01\x00\x8c\x63\x18"
-                                    "\xc5\xc0\x00\x56\x00\x0f\x07\x00\x05\x07\x01\x00\x8c\x62\xa5\x28\x80\x00\x57\x00"
-                                    "\x0f\x07\x00\x05\x07\x01\x00\x8d\x6b\x5d\xeb\x40\x00\x58\x00\x0f\x07\x00\x05\x07"
-                                    "\x01\x00\x8a\x98\x45\x4a\x20\x00\x59\x00\x0f\x07\x00\x05\x07\x01\x00\x8c\x94\x42"
-                                    "\x10\x80\x00\x5A\x00\x0f\x07\x00\x05\x07\x01\x00\xf8\x8c\x44\x43\xe0\x00\x5B\x00"
-                                    "\x0f\x07\x00\x04\x0a\x02\xff\xf8\x88\x88\x88\x8f\x00\x5C\x00\x10\x07\x00\x05\x09"
-                                    "\x01\xff\x84\x10\x82\x10\x42\x08\x00\x5D\x00\x0f\x07\x00\x04\x0a\x01\xff\xf1\x11"
-                                    "\x11\x11\x1f\x00\x5E\x00\x0d\x07\x00\x05\x04\x01\x03\x22\xa5\x10\x00\x5F\x00\x0b"
-                                    "\x07\x00\x05\x01\x01\xfe\xf8\x00\x60\x00\x0b\x07\x00\x02\x02\x02\x06\x90\x00\x61"
-                                    "\x00\x0e\x07\x00\x05\x05\x01\x00\xf0\xbd\x2e\x80\x00\x62\x00\x0f\x07\x00\x05\x08"
-                                    "\x01\x00\x84\x21\xe8\xc6\x3e\x00\x63\x00\x0e\x07\x00\x05\x05\x01\x00\x74\x21\x07"
-                                    "\x80\x00\x64\x00\x0f\x07\x00\x05\x08\x01\x00\x08\x42\xf8\xc6\x2f\x00\x65\x00\x0e"
-                                    "\x07\x00\x05\x05\x01\x00\x74\x7f\x07\x00\x00\x66\x00\x0f\x07\x00\x05\x08\x01\x00"
-                                    "\x39\x09\xf2\x10\x84\x00\x67\x00\x0f\x07\x00\x05\x08\x01\xfd\x7c\x63\x1f\x84\x3e"
-                                    "\x00\x68\x00\x0f\x07\x00\x05\x08\x01\x00\x84\x21\x6c\xc6\x31\x00\x69\x00\x0f\x07"
-                                    "\x00\x05\x08\x01\x00\x20\x01\xc2\x10\x9f\x00\x6A\x00\x10\x07\x00\x04\x0b\x01\xfd"
-                                    "\x30\x0f\x11\x11\x11\xe0\x00\x6B\x00\x0f\x07\x00\x05\x08\x01\x00\x84\x21\x2a\x62"
-                                    "\x93\x00\x6C\x00\x0f\x07\x00\x05\x08\x01\x00\xe1\x08\x42\x10\x87\x00\x6D\x00\x0e"
-                                    "\x07\x00\x05\x05\x01\x00\xfd\x6b\x5a\x80\x00\x6E\x00\x0e\x07\x00\x05\x05\x01\x00"
-                                    "\xb6\x63\x18\x80\x00\x6F\x00\x0e\x07\x00\x05\x05\x01\x00\x74\x63\x17\x00\x00\x70"
-                                    "\x00\x0f\x07\x00\x05\x08\x01\xfd\xf4\x63\x1f\x42\x10\x00\x71\x00\x0f\x07\x00\x05"
-                                    "\x08\x01\xfd\x7c\x63\x3e\x84\x21\x00\x72\x00\x0e\x07\x00\x05\x05\x01\x00\xdb\x10"
-                                    "\x8e\x00\x00\x73\x00\x0e\x07\x00\x05\x05\x01\x00\x74\x1c\x1f\x00\x00\x74\x00\x0f"
-                                    "\x07\x00\x05\x07\x01\x00\x42\x3e\x84\x20\xe0\x00\x75\x00\x0e\x07\x00\x05\x05\x01"
-                                    "\x00\x8c\x63\x3e\x80\x00\x76\x00\x0e\x07\x00\x05\x05\x01\x00\x8c\x54\xa2\x00\x00"
-                                    "\x77\x00\x0e\x07\x00\x05\x05\x01\x00\x8d\x6b\xbd\x00\x00\x78\x00\x0e\x07\x00\x05"
-                                    "\x05\x01\x00\x92\x88\xa8\x80\x00\x79\x00\x0f\x07\x00\x05\x08\x01\xfd\x8c\x54\xa6"
-                                    "\x10\x98\x00\x7A\x00\x0e\x07\x00\x05\x05\x01\x00\xf8\x88\x8f\x80\x00\x7B\x00\x11"
-                                    "\x07\x00\x05\x0b\x01\xfe\x3a\x08\x66\x41\x86\x22\x0e\x00\x7C\x00\x0c\x07\x00\x01"
-                                    "\x09\x03\xff\xff\x80\x00\x7D\x00\x11\x07\x00\x05\x0b\x01\xfe\xe0\x88\x87\x05\xc8"
-                                    "\x20\xb8\x00\x7E\x00\x0c\x07\x00\x05\x02\x01\x02\xcd\xc0\x00\xA0\x00\x0a\x07\x00"
-                                    "\x00\x00\x00\x00\x00\xA1\x00\x0b\x07\x00\x01\x08\x03\x00\x9f\x00\xA2\x00\x0f\x07"
-                                    "\x00\x04\x09\x01\xfe\x22\x7a\xaa\x72\x20\x00\xA3\x00\x0f\x07\x00\x05\x07\x01\x00"
-                                    "\x74\x51\xf4\x43\xe0\x00\xA5\x00\x0f\x07\x00\x05\x07\x01\x00\x8c\x95\xf2\x7c\x80"
-                                    "\x00\xA7\x00\x11\x07\x00\x05\x0a\x01\xfd\x7c\x10\xe8\xc7\x46\x0f\x80\x00\xA8\x00"
-                                    "\x0b\x07\x00\x04\x01\x01\x06\xd0\x00\xA9\x00\x10\x07\x00\x05\x09\x01\xff\x74\x6b"
-                                    "\x9c\xe7\xb1\x70\x00\xAA\x00\x0e\x07\x00\x05\x06\x01\x02\x73\xa5\xf0\x7c\x00\xAB"
-                                    "\x00\x0e\x07\x00\x05\x05\x01\x00\x4e\xa9\xa4\x80\x00\xAE\x00\x0e\x07\x00\x05\x06"
-                                    "\x01\x02\x77\xfb\xd8\xb8\x00\xAF\x00\x0b\x07\x00\x03\x01\x02\x06\xe0\x00\xB0\x00"
-                                    "\x0d\x07\x00\x05\x04\x01\x04\x74\x62\xe0\x00\xB1\x00\x0f\x07\x00\x05\x07\x01\x00"
-                                    "\x21\x3e\x42\x03\xe0\x00\xB2\x00\x0c\x07\x00\x03\x04\x02\x04\xe5\x70\x00\xB3\x00"
-                                    "\x0c\x07\x00\x03\x04\x02\x04\xe8\xf0\x00\xB4\x00\x0b\x07\x00\x03\x02\x02\x06\x38"
-                                    "\x00\xB5\x00\x0f\x07\x00\x05\x08\x01\xfd\x8c\x63\x3e\xc2\x10\x00\xB6\x00\x0f\x07"
-                                    "\x00\x05\x07\x01\x00\xff\x7a\xd0\x84\x20\x00\xB7\x00\x0b\x07\x00\x02\x02\x02\x03"
-                                    "\x70\x00\xB8\x00\x0c\x07\x00\x03\x03\x02\xfd\x47\x80\x00\xB9\x00\x0c\x07\x00\x03"
-                                    "\x04\x02\x04\x49\x70\x00\xBA\x00\x0d\x07\x00\x04\x06\x01\x02\x79\x97\x0f\x00\xBB"
-                                    "\x00\x0e\x07\x00\x05\x05\x01\x00\xa6\x92\xaa\x00\x00\xBC\x00\x13\x07\x00\x07\x0a"
-                                    "\x00\xfd\x40\x81\x0f\x21\x84\x12\x4a\x3c\x08\x00\xBD\x00\x13\x07\x00\x07\x0a\x00"
-                                    "\xfd\x40\x81\x0f\x21\x84\x17\x42\x08\x38\x00\xBE\x00\x13\x07\x00\x07\x0a\x00\xfd"
-                                    "\xe0\xc0\x4f\x21\x84\x12\x4a\x3c\x08\x00\xBF\x00\x0f\x07\x00\x05\x08\x01\x00\x30"
-                                    "\x00\x26\x42\x3e\x00\xC0\x00\x11\x07\x00\x05\x0a\x01\x00\xc1\x00\x45\x29\x5e\x8c"
-                                    "\x40\x00\xC1\x00\x11\x07\x00\x05\x0a\x01\x00\x13\x00\x45\x29\x5e\x8c\x40\x00\xC2"
-                                    "\x00\x11\x07\x00\x05\x0a\x01\x00\x64\x80\x45\x29\x5e\x8c\x40\x00\xC3\x00\x11\x07"
-                                    "\x00\x05\x0a\x01\x00\x4d\x80\x45\x29\x5e\x8c\x40\x00\xC4\x00\x10\x07\x00\x05\x09"
-                                    "\x01\x00\xd0\x08\xa5\x2b\xd1\x88\x00\xC5\x00\x10\x07\x00\x05\x09\x01\x00\x22\x88"
-                                    "\xa5\x2b\xd1\x88\x00\xC6\x00\x10\x07\x00\x06\x07\x00\x00\x3c\xc5\x17\x72\x49\xc0"
-                                    "\x00\xC7\x00\x11\x07\x00\x05\x0a\x01\xfd\x74\x61\x08\x45\xc4\x13\x80\x00\xC8\x00"
-                                    "\x11\x07\x00\x05\x0a\x01\x00\x41\x81\xf8\x43\xd0\x87\xc0\x00\xC9\x00\x11\x07\x00"
-                                    "\x05\x0a\x01\x00\x11\x01\xf8\x43\xd0\x87\xc0\x00\xCA\x00\x11\x07\x00\x05\x0a\x01"
-                                    "\x00\x32\x41\xf8\x43\xd0\x87\xc0\x00\xCB\x00\x10\x07\x00\x05\x09\x01\x00\x58\x3f"
-                                    "\x08\x7a\x10\xf8\x00\xCC\x00\x0e\x07\x00\x03\x0a\x02\x00\x88\x74\x92\x5c\x00\xCD"
-                                    "\x00\x0e\x07\x00\x03\x0a\x02\x00\x38\x74\x92\x5c\x00\xCE\x00\x0f\x07\x00\x04\x0a"
-                                    "\x01\x00\x69\x07\x22\x22\x27\x00\xCF\x00\x0f\x07\x00\x04\x09\x01\x00\xd0\x72\x22"
-                                    "\x22\x70\x00\xD0\x00\x10\x07\x00\x06\x07\x00\x00\x79\x14\x7d\x45\x37\x00\x00\xD1"
-                                    "\x00\x11\x07\x00\x05\x0a\x01\x00\x4d\x81\x1c\xe6\xb5\x9c\xc0\x00\xD2\x00\x11\x07"
-                                    "\x00\x05\x0a\x01\x00\x41\x00\xe8\xc6\x31\x8b\x80\x00\xD3\x00\x11\x07\x00\x05\x0a"
-                                    "\x01\x00\x13\x00\xe8\xc6\x31\x8b\x80\x00\xD4\x00\x11\x07\x00\x05\x0a\x01\x00\x64"
-                                    "\x80\xe8\xc6\x31\x8b\x80\x00\xD5\x00\x11\x07\x00\x05\x0a\x01\x00\x4d\x80\xe8\xc6"
-                                    "\x31\x8b\x80\x00\xD6\x00\x10\x07\x00\x05\x09\x01\x00\xd0\x1d\x18\xc6\x31\x70\x00"
-                                    "\xD7\x00\x0e\x07\x00\x05\x05\x01\x01\x8a\x88\xa8\x80\x00\xD8\x00\x10\x07\x00\x05"
-                                    "\x09\x01\xff\x0b\xe7\x3a\xe6\x3e\x80\x00\xD9\x00\x11\x07\x00\x05\x0a\x01\x00\x41"
-                                    "\x01\x18\xc6\x31\x8b\x80\x00\xDA\x00\x11\x07\x00\x05\x0a\x01\x00\x13\x01\x18\xc6"
-                                    "\x31\x8b\x80\x00\xDB\x00\x11\x07\x00\x05\x0a\x01\x00\x64\x81\x18\xc6\x31\x8b\x80"
-                                    "\x00\xDC\x00\x10\x07\x00\x05\x09\x01\x00\xd0\x23\x18\xc6\x31\x70\x00\xDD\x00\x11"
-                                    "\x07\x00\x05\x0a\x01\x00\x13\x01\x19\x28\x84\x21\x00\x00\xDE\x00\x0f\x07\x00\x05"
-                                    "\x07\x01\x00\x84\x3f\x1f\xc2\x00\x00\xDF\x00\x0f\x07\x00\x05\x08\x01\x00\x74\x63"
-                                    "\x29\x46\x33\x00\xE0\x00\x0f\x07\x00\x05\x08\x01\x00\x41\x01\xe1\x7a\x5d\x00\xE1"
-                                    "\x00\x0f\x07\x00\x05\x08\x01\x00\x13\x01\xe1\x7a\x5d\x00\xE2\x00\x0f\x07\x00\x05"
-                                    "\x08\x01\x00\x64\x81\xe1\x7a\x5d\x00\xE3\x00\x0f\x07\x00\x05\x08\x01\x00\x4d\x81"
-                                    "\xe1\x7a\x5d\x00\xE4\x00\x0f\x07\x00\x05\x07\x01\x00\xd0\x3c\x2f\x4b\xa0\x00\xE5"
-                                    "\x00\x10\x07\x00\x05\x09\x01\x00\x72\x9c\x0f\x0b\xd2\xe8\x00\xE6\x00\x0e\x07\x00"
-                                    "\x06\x05\x00\x00\x6c\x57\xe4\xec\x00\xE7\x00\x0f\x07\x00\x05\x08\x01\xfd\x74\x21"
-                                    "\x07\x90\x4e\x00\xE8\x00\x0f\x07\x00\x05\x08\x01\x00\x41\x00\xe8\xfe\x0e\x00\xE9"
-                                    "\x00\x0f\x07\x00\x05\x08\x01\x00\x11\x00\xe8\xfe\x0e\x00\xEA\x00\x0f\x07\x00\x05"
-                                    "\x08\x01\x00\x22\x80\xe8\xfe\x0e\x00\xEB\x00\x0f\x07\x00\x05\x07\x01\x00\x50\x1d"
-                                    "\x1f\xc1\xc0\x00\xEC\x00\x0f\x07\x00\x05\x08\x01\x00\x41\x01\xc2\x10\x9f\x00\xED"
-                                    "\x00\x0f\x07\x00\x05\x08\x01\x00\x11\x01\xc2\x10\x9f\x00\xEE\x00\x0f\x07\x00\x05"
-                                    "\x08\x01\x00\x22\x81\xc2\x10\x9f\x00\xEF\x00\x0f\x07\x00\x05\x07\x01\x00\x50\x38"
-                                    "\x42\x13\xe0\x00\xF0\x00\x0f\x07\x00\x05\x08\x01\x00\x71\x82\xf8\xc6\x2e\x00\xF1"
-                                    "\x00\x0f\x07\x00\x05\x08\x01\x00\x4d\x81\x6c\xc6\x31\x00\xF2\x00\x0f\x07\x00\x05"
-                                    "\x08\x01\x00\x41\x00\xe8\xc6\x2e\x00\xF3\x00\x0f\x07\x00\x05\x08\x01\x00\x13\x00"
-                                    "\xe8\xc6\x2e\x00\xF4\x00\x0f\x07\x00\x05\x08\x01\x00\x64\x80\xe8\xc6\x2e\x00\xF5"
-                                    "\x00\x0f\x07\x00\x05\x08\x01\x00\x4d\x80\xe8\xc6\x2e\x00\xF6\x00\x0f\x07\x00\x05"
-                                    "\x07\x01\x00\xd0\x1d\x18\xc5\xc0\x00\xF7\x00\x0e\x07\x00\x05\x05\x01\x01\x20\x3e"
-                                    "\x02\x00\x00\xF8\x00\x0f\x07\x00\x05\x07\x01\xff\x0b\xa7\x5c\xfa\x00\x00\xF9\x00"
-                                    "\x0f\x07\x00\x05\x08\x01\x00\x41\x01\x18\xc6\x7d\x00\xFA\x00\x0f\x07\x00\x05\x08"
-                                    "\x01\x00\x11\x01\x18\xc6\x7d\x00\xFB\x00\x0f\x07\x00\x05\x08\x01\x00\x26\x81\x18"
-                                    "\xc6\x7d\x00\xFC\x00\x0f\x07\x00\x05\x07\x01\x00\xd0\x23\x18\xcf\xa0\x00\xFD\x00"
-                                    "\x11\x07\x00\x05\x0b\x01\xfd\x11\x01\x18\xa9\x4c\x21\x30\x00\xFE\x00\x11\x07\x00"
-                                    "\x05\x0b\x01\xfd\x84\x21\xe8\xc6\x3e\x84\x20\x00\xFF\x00\x11\x07\x00\x05\x0a\x01"
-                                    "\xfd\x50\x23\x15\x29\x84\x26\x00\x01\x00\x00\x10\x07\x00\x05\x09\x01\x00\x70\x08"
-                                    "\xa5\x2b\xd1\x88\x01\x01\x00\x0f\x07\x00\x05\x07\x01\x00\x70\x3c\x2f\x4b\xa0\x01"
-                                    "\x02\x00\x11\x07\x00\x05\x0a\x01\x00\x93\x80\x45\x29\x5e\x8c\x40\x01\x03\x00\x0f"
-                                    "\x07\x00\x05\x08\x01\x00\x93\x81\xe1\x7a\x5d\x01\x04\x00\x12\x07\x00\x06\x0a\x01"
-                                    "\xfd\x21\x45\x14\xf2\x28\x82\x10\x30\x01\x05\x00\x0f\x07\x00\x05\x08\x01\xfd\xf0"
-                                    "\xbd\x2e\x88\x43\x01\x06\x00\x11\x07\x00\x05\x0a\x01\x00\x19\x00\xe8\xc2\x10\x8b"
-                                    "\x80\x01\x07\x00\x0f\x07\x00\x05\x08\x01\x00\x11\x00\xe8\x42\x0f\x01\x08\x00\x11"
-                                    "\x07\x00\x05\x0a\x01\x00\x32\x40\xe8\xc2\x10\x8b\x80\x01\x09\x00\x0f\x07\x00\x05"
-                                    "\x08\x01\x00\x22\xc0\xe8\x42\x0f\x01\x0A\x00\x10\x07\x00\x05\x09\x01\x00\x20\x1d"
-                                    "\x18\x42\x11\x70\x01\x0B\x00\x0f\x07\x00\x05\x07\x01\x00\x20\x1d\x08\x41\xe0\x01"
-                                    "\x0C\x00\x11\x07\x00\x05\x0a\x01\x00\x49\x80\xe8\xc2\x10\x8b\x80\x01\x0D\x00\x0f"
-                                    "\x07\x00\x05\x08\x01\x00\x59\x00\xe8\x42\x0f\x01\x0E\x00\x11\x07\x00\x05\x0a\x01"
-                                    "\x00\x93\x01\xe9\xc6\x31\x9f\x00\x01\x0F\x00\x12\x07\x00\x07\x09\x01\x00\x02\x14"
-                                    "\x20\x47\x91\x22\x44\x78\x01\x10\x00\x10\x07\x00\x06\x07\x00\x00\x79\x14\x7d\x45"
-                                    "\x37\x00\x01\x11\x00\x0f\x07\x00\x05\x08\x01\x00\x09\xc2\xf8\xc6\x7d\x01\x12\x00"
-                                    "\x10\x07\x00\x05\x09\x01\x00\x70\x3f\x08\x7a\x10\xf8\x01\x13\x00\x0f\x07\x00\x05"
-                                    "\x07\x01\x00\x70\x1d\x1f\xc1\xc0\x01\x14\x00\x11\x07\x00\x05\x0a\x01\x00\x4b\x81"
-                                    "\xf8\x43\xd0\x87\xc0\x01\x15\x00\x0f\x07\x00\x05\x08\x01\x00\x8b\x80\xe8\xfe\x0e"
-                                    "\x01\x16\x00\x10\x07\x00\x05\x09\x01\x00\x20\x3f\x08\x7a\x10\xf8\x01\x17\x00\x0f"
-                                    "\x07\x00\x05\x07\x01\x00\x20\x1d\x1f\xc1\xc0\x01\x18\x00\x11\x07\x00\x05\x0a\x01"
-                                    "\xfd\xfc\x21\xe8\x43\xe2\x10\xc0\x01\x19\x00\x0f\x07\x00\x05\x08\x01\xfd\x74\x7f"
-                                    "\x07\x08\x86\x01\x1A\x00\x11\x07\x00\x05\x0a\x01\x00\x49\x81\xf8\x43\xd0\x87\xc0"
-                                    "\x01\x1B\x00\x0f\x07\x00\x05\x08\x01\x00\x51\x00\xe8\xfe\x0e\x01\x1C\x00\x11\x07"
-                                    "\x00\x05\x0a\x01\x00\x32\x40\xf8\x42\xf1\x8b\xc0\x01\x1D\x00\x11\x07\x00\x05\x0b"
-                                    "\x01\xfd\x64\x80\xf8\xc6\x3f\x08\x7c\x01\x1E\x00\x11\x07\x00\x05\x0a\x01\x00\x4b"
-                                    "\x80\xf8\x42\xf1\x8b\xc0\x01\x1F\x00\x11\x07\x00\x05\x0b\x01\xfd\x93\x80\xf8\xc6"
-                                    "\x3f\x08\x7c\x01\x20\x00\x10\x07\x00\x05\x09\x01\x00\x30\x1f\x08\x5e\x31\x78\x01"
-                                    "\x21\x00\x11\x07\x00\x05\x0a\x01\xfd\x20\x1f\x18\xc7\xe1\x0f\x80\x01\x22\x00\x11"
-                                    "\x07\x00\x05\x0b\x01\xfc\x7c\x21\x78\xc5\xe0\x30\x88\x01\x23\x00\x12\x07\x00\x05"
-                                    "\x0c\x01\xfd\x22\x0c\x07\xc6\x31\xf8\x43\xe0\x01\x24\x00\x11\x07\x00\x05\x0a\x01"
-                                    "\x00\x64\x81\x18\xc7\xf1\x8c\x40\x01\x25\x00\x13\x07\x00\x06\x0b\x00\x00\x42\x80"
-                                    "\x10\x41\x05\x99\x45\x14\x40\x01\x26\x00\x10\x07\x00\x06\x07\x00\x00\x47\xf4\x5f"
-                                    "\x45\x14\x40\x01\x27\x00\x10\x07\x00\x06\x08\x00\x00\x43\xc4\x16\x65\x14\x51\x01"
-                                    "\x28\x00\x11\x07\x00\x05\x0a\x01\x00\x4d\x80\xe2\x10\x84\x23\x80\x01\x29\x00\x0f"
-                                    "\x07\x00\x05\x08\x01\x00\x4d\x81\xc2\x10\x9f\x01\x2A\x00\x0e\x07\x00\x03\x09\x02"
-                                    "\x00\xe3\xa4\x92\xe0\x01\x2B\x00\x0f\x07\x00\x05\x07\x01\x00\x70\x38\x42\x13\xe0"
-                                    "\x01\x2C\x00\x0f\x07\x00\x04\x0a\x01\x00\x97\x07\x22\x22\x27\x01\x2D\x00\x0f\x07"
-                                    "\x00\x05\x08\x01\x00\x8b\x81\xc2\x10\x9f\x01\x2E\x00\x0e\x07\x00\x03\x0a\x02\xfd"
-                                    "\xe9\x24\xba\x98\x01\x2F\x00\x11\x07\x00\x05\x0b\x01\xfd\x20\x01\xc2\x10\x9f\x22"
-                                    "\x18\x01\x30\x00\x0e\x07\x00\x03\x09\x02\x00\x43\xa4\x92\xe0\x01\x31\x00\x0e\x07"
-                                    "\x00\x05\x05\x01\x00\xe1\x08\x4f\x80\x01\x34\x00\x12\x07\x00\x06\x0a\x01\x00\x18"
-                                    "\x90\x02\x08\x20\x82\x89\xc0\x01\x35\x00\x11\x07\x00\x05\x0b\x01\xfd\x32\x41\xe1"
-                                    "\x08\x42\x10\xb8\x01\x36\x00\x11\x07\x00\x05\x0b\x01\xfc\x8c\xa9\x8a\x4a\x20\x60"
-                                    "\x88\x01\x37\x00\x12\x07\x00\x05\x0c\x01\xfc\x84\x21\x2a\x62\x93\x03\x04\xc0\x01"
-                                    "\x39\x00\x11\x07\x00\x05\x0a\x01\x00\x44\x01\x08\x42\x10\x87\xc0\x01\x3A\x00\x11"
-                                    "\x07\x00\x05\x0b\x01\x00\x32\x01\xc2\x10\x84\x21\x0e\x01\x3B\x00\x11\x07\x00\x05"
-                                    "\x0b\x01\xfc\x84\x21\x08\x43\xe0\x60\x88\x01\x3C\x00\x12\x07\x00\x05\x0c\x01\xfc"
-                                    "\xe1\x08\x42\x10\x87\x03\x04\xc0\x01\x3D\x00\x0f\x07\x00\x05\x07\x01\x00\x94\xa1"
-                                    "\x08\x43\xe0\x01\x3E\x00\x10\x07\x00\x05\x09\x01\x00\x0f\x48\x42\x10\x84\x38\x01"
-                                    "\x3F\x00\x0f\x07\x00\x05\x07\x01\x00\x84\x27\x38\x43\xe0\x01\x40\x00\x10\x07\x00"
-                                    "\x06\x08\x01\x00\xe0\x82\x09\x24\x82\x0e\x01\x41\x00\x10\x07\x00\x06\x07\x00\x00"
-                                    "\x41\x05\x18\xc1\x07\xc0\x01\x42\x00\x0f\x07\x00\x05\x08\x01\x00\xe1\x08\x6e\x10"
-                                    "\x87\x01\x43\x00\x11\x07\x00\x05\x0a\x01\x00\x13\x01\x1c\xe6\xb5\x9c\xc0\x01\x44"
-                                    "\x00\x0f\x07\x00\x05\x08\x01\x00\x13\x01\x6c\xc6\x31\x01\x45\x00\x11\x07\x00\x05"
-                                    "\x0b\x01\xfc\x8e\x73\x5a\xce\x60\x60\x98\x01\x46\x00\x10\x07\x00\x05\x09\x01\xfc"
-                                    "\xb6\x63\x18\x81\x82\x60\x01\x47\x00\x11\x07\x00\x05\x0a\x01\x00\xd1\x01\x1c\xe6"
-                                    "\xb5\x9c\xc0\x01\x48\x00\x0f\x07\x00\x05\x08\x01\x00\x93\x01\x6c\xc6\x31\x01\x4A"
-                                    "\x00\x11\x07\x00\x05\x0a\x01\xfd\x8e\x73\x5a\xce\x61\x0b\x80\x01\x4B\x00\x0f\x07"
-                                    "\x00\x05\x08\x01\xfd\xb6\x63\x18\x84\x2e\x01\x4C\x00\x10\x07\x00\x05\x09\x01\x00"
-                                    "\x70\x1d\x18\xc6\x31\x70\x01\x4D\x00\x0f\x07\x00\x05\x07\x01\x00\x70\x1d\x18\xc5"
-                                    "\xc0\x01\x4E\x00\x11\x07\x00\x05\x0a\x01\x00\x93\x80\xe8\xc6\x31\x8b\x80\x01\x4F"
-                                    "\x00\x0f\x07\x00\x05\x08\x01\x00\x93\x80\xe8\xc6\x2e\x01\x50\x00\x11\x07\x00\x05"
-                                    "\x0a\x01\x00\x6a\x80\xe8\xc6\x31\x8b\x80\x01\x51\x00\x0f\x07\x00\x05\x08\x01\x00"
-                                    "\x4c\x80\xe8\xc6\x2e\x01\x52\x00\x10\x07\x00\x06\x07\x00\x00\x3d\x49\x27\x91\x47"
-                                    "\xc0\x01\x53\x00\x0e\x07\x00\x06\x05\x00\x00\x6e\x59\xe4\x6c\x01\x54\x00\x11\x07"
-                                    "\x00\x05\x0a\x01\x00\x11\x01\xe8\xc7\xd4\x94\x40\x01\x55\x00\x0f\x07\x00\x05\x08"
-                                    "\x01\x00\x13\x01\xb6\x21\x1c\x01\x56\x00\x11\x07\x00\x05\x0b\x01\xfc\xf4\x63\xea"
-                                    "\x4a\x20\x60\x98\x01\x57\x00\x10\x07\x00\x05\x09\x01\xfc\xdb\x10\x8e\x03\x04\xc0"
-                                    "\x01\x58\x00\x11\x07\x00\x05\x0a\x01\x00\x59\x01\xe8\xc7\xd4\x94\x40\x01\x59\x00"
-                                    "\x0f\x07\x00\x05\x08\x01\x00\x93\x01\xb6\x21\x1c\x01\x5A\x00\x11\x07\x00\x05\x0a"
-                                    "\x01\x00\x11\x00\xf8\x41\xc1\x0f\x80\x01\x5B\x00\x0f\x07\x00\x05\x08\x01\x00\x11"
-                                    "\x00\xe8\x38\x3e\x01\x5C\x00\x11\x07\x00\x05\x0a\x01\x00\x26\x80\xf8\x41\xc1\x0f"
-                                    "\x80\x01\x5D\x00\x0f\x07\x00\x05\x08\x01\x00\x22\x80\xe8\x38\x3e\x01\x5E\x00\x11"
-                                    "\x07\x00\x05\x0a\x01\xfd\x7c\x20\xe0\x87\xc4\x13\x80\x01\x5F\x00\x0f\x07\x00\x05"
-                                    "\x08\x01\xfd\x74\x1c\x1f\x10\x4e\x01\x60\x00\x11\x07\x00\x05\x0a\x01\x00\xd1\x00"
-                                    "\xf8\x41\xc1\x0f\x80\x01\x61\x00\x0f\x07\x00\x05\x08\x01\x00\x51\x00\xe8\x38\x3e"
-                                    "\x01\x62\x00\x11\x07\x00\x05\x0a\x01\xfd\xf9\x08\x42\x10\x84\x13\x80\x01\x63\x00"
-                                    "\x11\x07\x00\x05\x0a\x01\xfd\x42\x3e\x84\x20\xe4\x13\x80\x01\x64\x00\x11\x07\x00"
-                                    "\x05\x0a\x01\x00\x93\x01\xf2\x10\x84\x21\x00\x01\x65\x00\x0f\x07\x00\x05\x08\x01"
-                                    "\x00\x0a\x91\xf4\x21\x07\x01\x66\x00\x0f\x07\x00\x05\x07\x01\x00\xf9\x09\xe2\x10"
-                                    "\x80\x01\x67\x00\x0f\x07\x00\x05\x07\x01\x00\x42\x3e\x8f\x20\xe0\x01\x68\x00\x11"
-                                    "\x07\x00\x05\x0a\x01\x00\x4d\x81\x18\xc6\x31\x8b\x80\x01\x69\x00\x0f\x07\x00\x05"
-                                    "\x08\x01\x00\x4d\x81\x18\xc6\x7d\x01\x6A\x00\x10\x07\x00\x05\x09\x01\x00\x70\x23"
-                                    "\x18\xc6\x31\x70\x01\x6B\x00\x0f\x07\x00\x05\x07\x01\x00\x70\x23\x18\xcf\xa0\x01"
-                                    "\x6C\x00\x11\x07\x00\x05\x0a\x01\x00\x93\x81\x18\xc6\x31\x8b\x80\x01\x6D\x00\x0f"
-                                    "\x07\x00\x05\x08\x01\x00\x93\x81\x18\xc6\x7d\x01\x6E\x00\x11\x07\x00\x05\x0b\x01"
-                                    "\x00\x72\x9c\x08\xc6\x31\x8c\x5c\x01\x6F\x00\x10\x07\x00\x05\x09\x01\x00\x72\x9c"
-                                    "\x08\xc6\x33\xe8\x01\x70\x00\x11\x07\x00\x05\x0a\x01\x00\x6a\x81\x18\xc6\x31\x8b"
-                                    "\x80\x01\x71\x00\x0f\x07\x00\x05\x08\x01\x00\x4a\x81\x18\xc6\x7d\x01\x72\x00\x10"
-                                    "\x07\x00\x05\x09\x01\xfe\x8c\x63\x18\xc5\xc4\x60\x01\x73\x00\x0f\x07\x00\x05\x08"
-                                    "\x01\xfd\x8c\x63\x3e\x88\x43\x01\x74\x00\x11\x07\x00\x05\x0a\x01\x00\x64\x81\x1a"
-                                    "\xd6\xbb\xd6\x80\x01\x75\x00\x0f\x07\x00\x05\x08\x01\x00\x64\x81\x1a\xd7\x7a\x01"
-                                    "\x76\x00\x11\x07\x00\x05\x0a\x01\x00\x64\x81\x19\x28\x84\x21\x00\x01\x77\x00\x11"
-                                    "\x07\x00\x05\x0b\x01\xfd\x26\x81\x18\xa9\x4c\x21\x30\x01\x78\x00\x10\x07\x00\x05"
-                                    "\x09\x01\x00\xd0\x23\x25\x10\x84\x20\x01\x79\x00\x11\x07\x00\x05\x0a\x01\x00\x13"
-                                    "\x01\xf1\x18\x88\x87\xc0\x01\x7A\x00\x0f\x07\x00\x05\x08\x01\x00\x11\x01\xf1\x11"
-                                    "\x1f\x01\x7B\x00\x10\x07\x00\x05\x09\x01\x00\x20\x3e\x23\x11\x10\xf8\x01\x7C\x00"
-                                    "\x0f\x07\x00\x05\x07\x01\x00\x20\x3e\x22\x23\xe0\x01\x7D\x00\x11\x07\x00\x05\x0a"
-                                    "\x01\x00\xd1\x01\xf1\x18\x88\x87\xc0\x01\x7E\x00\x0f\x07\x00\x05\x08\x01\x00\x51"
-                                    "\x01\xf1\x11\x1f\x01\x8F\x00\x0f\x07\x00\x05\x07\x01\x00\x70\x43\xf8\xc5\xc0\x01"
-                                    "\xA0\x00\x10\x07\x00\x06\x08\x01\x00\x05\xe8\xa2\x8a\x28\x9c\x01\xA1\x00\x0e\x07"
-                                    "\x00\x05\x06\x01\x00\x0b\xe3\x18\xb8\x01\xAF\x00\x10\x07\x00\x06\x08\x01\x00\x06"
-                                    "\x38\xa2\x8a\x28\x9c\x01\xB0\x00\x0f\x07\x00\x06\x06\x01\x00\x06\x28\xa2\x9b\xa0"
-                                    "\x01\xCD\x00\x11\x07\x00\x05\x0a\x01\x00\x93\x00\x45\x29\x5e\x8c\x40\x01\xCE\x00"
-                                    "\x0f\x07\x00\x05\x08\x01\x00\x93\x01\xe1\x7a\x5d\x01\xCF\x00\x0f\x07\x00\x04\x0a"
-                                    "\x01\x00\x96\x07\x22\x22\x27\x01\xD0\x00\x0f\x07\x00\x05\x08\x01\x00\x51\x01\xc2"
-                                    "\x10\x9f\x01\xD1\x00\x11\x07\x00\x05\x0a\x01\x00\x93\x00\xe8\xc6\x31\x8b\x80\x01"
-                                    "\xD2\x00\x0f\x07\x00\x05\x08\x01\x00\x93\x00\xe8\xc6\x2e\x01\xD3\x00\x11\x07\x00"
-                                    "\x05\x0a\x01\x00\x93\x01\x18\xc6\x31\x8b\x80\x01\xD4\x00\x0f\x07\x00\x05\x08\x01"
-                                    "\x00\xd1\x01\x18\xc6\x7d\x01\xD5\x00\x11\x07\x00\x05\x0b\x01\x00\x70\x34\x08\xc6"
-                                    "\x31\x8c\x5c\x01\xD6\x00\x10\x07\x00\x05\x09\x01\x00\x70\x14\x08\xc6\x33\xe8\x01"
-                                    "\xD7\x00\x11\x07\x00\x05\x0b\x01\x00\x19\x34\x08\xc6\x31\x8c\x5c\x01\xD8\x00\x11"
-                                    "\x07\x00\x05\x0a\x01\x00\x13\x00\xa0\x46\x31\x9f\x40\x01\xD9\x00\x12\x07\x00\x05"
-                                    "\x0c\x01\x00\x51\x01\xa0\x46\x31\x8c\x62\xe0\x01\xDA\x00\x11\x07\x00\x05\x0a\x01"
-                                    "\x00\x51\x00\xa0\x46\x31\x9f\x40\x01\xDB\x00\x11\x07\x00\x05\x0b\x01\x00\xc1\x34"
-                                    "\x08\xc6\x31\x8c\x5c\x01\xDC\x00\x11\x07\x00\x05\x0a\x01\x00\x41\x00\xa0\x46\x31"
-                                    "\x9f\x40\x01\xE6\x00\x11\x07\x00\x05\x0a\x01\x00\x49\x80\xf8\x42\xf1\x8b\xc0\x01"
-                                    "\xE7\x00\x11\x07\x00\x05\x0b\x01\xfd\x93\x00\xf8\xc6\x3f\x08\x7c\x01\xEA\x00\x10"
-                                    "\x07\x00\x05\x09\x01\xfe\x74\x63\x18\xc5\xc8\x60\x01\xEB\x00\x0f\x07\x00\x05\x07"
-                                    "\x01\xfe\x74\x63\x17\x21\x80\x01\xF0\x00\x11\x07\x00\x05\x0b\x01\xfd\x49\x81\xe1"
-                                    "\x08\x42\x10\xb8\x01\xF8\x00\x11\x07\x00\x05\x0a\x01\x00\x41\x01\x1c\xe6\xb5\x9c"
-                                    "\xc0\x01\xF9\x00\x0f\x07\x00\x05\x08\x01\x00\x41\x01\x6c\xc6\x31\x02\x18\x00\x11"
-                                    "\x07\x00\x05\x0b\x01\xfc\x7c\x20\xe0\x87\xc0\x60\x98\x02\x19\x00\x10\x07\x00\x05"
-                                    "\x09\x01\xfc\x74\x1c\x1f\x01\x82\x60\x02\x1A\x00\x11\x07\x00\x05\x0b\x01\xfc\xf9"
-                                    "\x08\x42\x10\x80\x60\x98\x02\x1B\x00\x11\x07\x00\x05\x0b\x01\xfc\x42\x3e\x84\x20"
-                                    "\xe0\x60\x88\x02\x26\x00\x10\x07\x00\x05\x09\x01\x00\x20\x08\xa5\x2b\xd1\x88\x02"
-                                    "\x27\x00\x0f\x07\x00\x05\x07\x01\x00\x20\x3c\x2f\x4b\xa0\x02\x2E\x00\x10\x07\x00"
-                                    "\x05\x09\x01\x00\x20\x1d\x18\xc6\x31\x70\x02\x2F\x00\x0f\x07\x00\x05\x07\x01\x00"
-                                    "\x20\x1d\x18\xc5\xc0\x02\x32\x00\x10\x07\x00\x05\x09\x01\x00\x70\x23\x25\x10\x84"
-                                    "\x20\x02\x33\x00\x11\x07\x00\x05\x0a\x01\xfd\x70\x23\x15\x29\x84\x26\x00\x02\x37"
-                                    "\x00\x0e\x07\x00\x04\x08\x01\xfd\xf1\x11\x11\x1e\x02\x59\x00\x0e\x07\x00\x05\x05"
-                                    "\x01\x00\x70\x7f\x17\x00\x02\xB9\x00\x0b\x07\x00\x01\x03\x03\x05\xe0\x02\xBA\x00"
-                                    "\x0c\x07\x00\x04\x03\x01\x05\xdd\x50\x02\xBB\x00\x0c\x07\x00\x03\x03\x02\x05\x6b"
-                                    "\x00\x02\xBC\x00\x0c\x07\x00\x03\x03\x02\x05\x6a\x00\x02\xBE\x00\x0c\x07\x00\x03"
-                                    "\x04\x02\x04\xc4\xe0\x02\xBF\x00\x0c\x07\x00\x03\x04\x02\x04\xf2\x70\x02\xC6\x00"
-                                    "\x0b\x07\x00\x04\x02\x01\x06\x69\x02\xC7\x00\x0b\x07\x00\x04\x02\x01\x06\x96\x02"
-                                    "\xC8\x00\x0b\x07\x00\x01\x04\x03\x04\xf0\x02\xCC\x00\x0b\x07\x00\x01\x04\x03\xfe"
-                                    "\xf0\x02\xCD\x00\x0b\x07\x00\x03\x01\x02\xfe\xe0\x02\xD8\x00\x0b\x07\x00\x04\x02"
-                                    "\x01\x06\x97\x02\xD9\x00\x0b\x07\x00\x01\x01\x03\x06\x80\x02\xDA\x00\x0c\x07\x00"
-                                    "\x03\x03\x02\x06\xf7\x80\x02\xDB\x00\x0b\x07\x00\x02\x03\x02\xfd\x6c\x02\xDC\x00"
-                                    "\x0c\x07\x00\x05\x02\x01\x06\x4d\x80\x02\xDD\x00\x0c\x07\x00\x05\x02\x01\x06\x4c"
-                                    "\x80\x03\x00\x00\x0b\x00\x00\x03\x02\xfe\x06\xc4\x03\x01\x00\x0b\x00\x00\x03\x02"
-                                    "\xff\x06\x70\x03\x02\x00\x0b\x00\x00\x04\x02\xfe\x06\x69\x03\x03\x00\x0b\x00\x00"
-                                    "\x04\x02\xfe\x06\xdb\x03\x04\x00\x0b\x00\x00\x04\x01\xfe\x06\xf0\x03\x06\x00\x0b"
-                                    "\x00\x00\x04\x02\xfe\x06\x96\x03\x07\x00\x0b\x00\x00\x02\x01\xff\x06\xc0\x03\x08"
-                                    "\x00\x0b\x00\x00\x04\x01\xfe\x06\x90\x03\x09\x00\x0b\x00\x00\x02\x03\xff\x06\xdc"
-                                    "\x03\x0A\x00\x0c\x00\x00\x04\x03\xfe\x06\x69\x60\x03\x0B\x00\x0b\x00\x00\x04\x02"
-                                    "\xfe\x06\x59\x03\x0C\x00\x0b\x00\x00\x04\x02\xfe\x06\x96\x03\x12\x00\x0b\x00\x00"
-                                    "\x02\x03\xff\x06\xec\x03\x15\x00\x0b\x00\x00\x01\x02\x00\x06\xc0\x03\x23\x00\x0b"
-                                    "\x00\x00\x02\x01\xff\xfe\xc0\x03\x24\x00\x0b\x00\x00\x04\x01\xfe\xfe\x90\x03\x26"
-                                    "\x00\x0b\x00\x00\x02\x03\xff\xfc\xdc\x03\x27\x00\x0c\x00\x00\x03\x03\xff\xfd\x8f"
-                                    "\x00\x03\x28\x00\x0b\x00\x00\x02\x03\xff\xfd\xac\x03\x2D\x00\x0b\x00\x00\x04\x02"
-                                    "\xfe\xfd\x69\x03\x2E\x00\x0b\x00\x00\x04\x02\xfe\xfd\x96\x03\x31\x00\x0b\x00\x00"
-                                    "\x04\x01\xfe\xfe\xf0\x0E\x3F\x00\x11\x07\x00\x05\x0b\x01\xfe\x21\x3f\x5a\xfa\xb5"
-                                    "\xf9\x08\x1E\x06\x00\x10\x07\x00\x05\x09\x01\xfe\xf4\x63\xe8\xc7\xe0\x70\x1E\x07"
-                                    "\x00\x11\x07\x00\x05\x0a\x01\xfe\x84\x21\xe8\xc6\x3e\x03\x80\x1E\x0C\x00\x10\x07"
-                                    "\x00\x05\x09\x01\xfe\xf4\xe3\x18\xcf\x80\x60\x1E\x0D\x00\x11\x07\x00\x05\x0a\x01"
-                                    "\xfe\x08\x42\xf8\xc6\x2f\x01\x00\x1E\x0E\x00\x10\x07\x00\x05\x09\x01\xfe\xf4\xe3"
-                                    "\x18\xcf\x80\xf0\x1E\x0F\x00\x11\x07\x00\x05\x0a\x01\xfe\x08\x42\xf8\xc6\x2f\x03"
-                                    "\x80\x1E\x12\x00\x11\x07\x00\x05\x0a\x01\xfd\xf4\xe3\x18\xcf\x80\x64\x80\x1E\x13"
-                                    "\x00\x11\x07\x00\x05\x0b\x01\xfd\x08\x42\xf8\xc6\x2f\x01\x34\x1E\x20\x00\x10\x07"
-                                    "\x00\x05\x09\x01\x00\x78\x1f\x08\x5e\x31\x78\x1E\x21\x00\x11\x07\x00\x05\x0a\x01"
-                                    "\xfd\x70\x1f\x18\xc7\xe1\x0f\x80\x1E\x24\x00\x10\x07\x00\x05\x09\x01\xfe\x8c\x63"
-                                    "\xf8\xc6\x20\x20\x1E\x25\x00\x11\x07\x00\x05\x0a\x01\xfe\x84\x21\x6c\xc6\x31\x01"
-                                    "\x00\x1E\x28\x00\x12\x07\x00\x06\x0a\x00\xfd\x45\x14\x5f\x45\x14\x50\x23\x80\x1E"
-                                    "\x29\x00\x13\x07\x00\x06\x0b\x00\xfd\x41\x04\x16\x65\x14\x51\x40\x8e\x00\x1E\x2A"
-                                    "\x00\x11\x07\x00\x05\x0a\x01\xfd\x8c\x63\xf8\xc6\x20\x93\x80\x1E\x2B\x00\x11\x07"
-                                    "\x00\x05\x0b\x01\xfd\x84\x21\x6c\xc6\x31\x04\x5c\x1E\x32\x00\x10\x07\x00\x05\x09"
-                                    "\x01\xfe\x8c\xa9\x8a\x4a\x20\x20\x1E\x33\x00\x11\x07\x00\x05\x0a\x01\xfe\x84\x21"
-                                    "\x2a\x62\x93\x01\x00\x1E\x34\x00\x10\x07\x00\x05\x09\x01\xfe\x8c\xa9\x8a\x4a\x20"
-                                    "\x70\x1E\x35\x00\x11\x07\x00\x05\x0a\x01\xfe\x84\x21\x2a\x62\x93\x03\x80\x1E\x36"
-                                    "\x00\x10\x07\x00\x05\x09\x01\xfe\x84\x21\x08\x43\xe0\x20\x1E\x37\x00\x11\x07\x00"
-                                    "\x05\x0a\x01\xfe\xe1\x08\x42\x10\x87\x01\x00\x1E\x38\x00\x13\x07\x00\x06\x0b\x00"
-                                    "\xfe\xe0\x04\x10\x41\x04\x10\x7c\x01\x00\x1E\x39\x00\x12\x07\x00\x05\x0c\x01\xfe"
-                                    "\xf0\x38\x42\x10\x84\x21\xc0\x40\x1E\x3A\x00\x10\x07\x00\x05\x09\x01\xfe\x84\x21"
-                                    "\x08\x43\xe0\x70\x1E\x3B\x00\x11\x07\x00\x05\x0a\x01\xfe\xe1\x08\x42\x10\x87\x07"
-                                    "\x80\x1E\x3C\x00\x11\x07\x00\x05\x0a\x01\xfd\x84\x21\x08\x43\xe0\x32\x40\x1E\x3D"
-                                    "\x00\x11\x07\x00\x05\x0b\x01\xfd\xe1\x08\x42\x10\x87\x03\x24\x1E\x3E\x00\x11\x07"
-                                    "\x00\x05\x0a\x01\x00\x13\x01\x1d\xee\xb5\x8c\x40\x1E\x3F\x00\x0f\x07\x00\x05\x08"
-                                    "\x01\x00\x11\x01\xfa\xd6\xb5\x1E\x40\x00\x10\x07\x00\x05\x09\x01\x00\x20\x23\xbd"
-                                    "\xd6\xb1\x88\x1E\x41\x00\x0f\x07\x00\x05\x07\x01\x00\x20\x3f\x5a\xd6\xa0\x1E\x42"
-                                    "\x00\x10\x07\x00\x05\x09\x01\xfe\x8e\xf7\x5a\xc6\x20\x20\x1E\x43\x00\x0f\x07\x00"
-                                    "\x05\x07\x01\xfe\xfd\x6b\x5a\x80\x80\x1E\x44\x00\x10\x07\x00\x05\x09\x01\x00\x20"
-                                    "\x23\x9c\xd6\xb3\x98\x1E\x45\x00\x0f\x07\x00\x05\x07\x01\x00\x20\x2d\x98\xc6\x20"
-                                    "\x1E\x46\x00\x10\x07\x00\x05\x09\x01\xfe\x8e\x73\x5a\xce\x60\x20\x1E\x47\x00\x0f"
-                                    "\x07\x00\x05\x07\x01\xfe\xb6\x63\x18\x80\x80\x1E\x48\x00\x10\x07\x00\x05\x09\x01"
-                                    "\xfe\x8e\x73\x5a\xce\x60\x70\x1E\x49\x00\x0f\x07\x00\x05\x07\x01\xfe\xb6\x63\x18"
-                                    "\x81\xc0\x1E\x4A\x00\x11\x07\x00\x05\x0a\x01\xfd\x8e\x73\x5a\xce\x60\x26\x80\x1E"
-                                    "\x4B\x00\x0f\x07\x00\x05\x08\x01\xfd\xb6\x63\x18\x80\x9a\x1E\x58\x00\x10\x07\x00"
-                                    "\x05\x09\x01\x00\x20\x3d\x18\xfa\x92\x88\x1E\x59\x00\x0f\x07\x00\x05\x07\x01\x00"
-                                    "\x20\x36\xc4\x23\x80\x1E\x5A\x00\x10\x07\x00\x05\x09\x01\xfe\xf4\x63\xea\x4a\x20"
-                                    "\x20\x1E\x5B\x00\x0f\x07\x00\x05\x07\x01\xfe\xdb\x10\x8e\x01\x00\x1E\x5C\x00\x11"
-                                    "\x07\x00\x05\x0b\x01\xfe\x70\x3d\x18\xfa\x92\x88\x08\x1E\x5D\x00\x10\x07\x00\x05"
-                                    "\x09\x01\xfe\xf0\x36\xc4\x23\x80\x40\x1E\x5E\x00\x10\x07\x00\x05\x09\x01\xfe\xf4"
-                                    "\x63\xea\x4a\x20\x70\x1E\x5F\x00\x0f\x07\x00\x05\x07\x01\xfe\xdb\x10\x8e\x03\x80"
-                                    "\x1E\x62\x00\x10\x07\x00\x05\x09\x01\xfe\x7c\x20\xe0\x87\xc0\x20\x1E\x63\x00\x0f"
-                                    "\x07\x00\x05\x07\x01\xfe\x74\x1c\x1f\x00\x80\x1E\x6C\x00\x10\x07\x00\x05\x09\x01"
-                                    "\xfe\xf9\x08\x42\x10\x80\x20\x1E\x6D\x00\x10\x07\x00\x05\x09\x01\xfe\x42\x3e\x84"
-                                    "\x20\xe0\x20\x1E\x6E\x00\x10\x07\x00\x05\x09\x01\xfe\xf9\x08\x42\x10\x80\x70\x1E"
-                                    "\x6F\x00\x10\x07\x00\x05\x09\x01\xfe\x42\x3e\x84\x20\xe0\x70\x1E\x70\x00\x11\x07"
-                                    "\x00\x05\x0a\x01\xfd\xf9\x08\x42\x10\x80\x64\x80\x1E\x71\x00\x11\x07\x00\x05\x0a"
-                                    "\x01\xfd\x42\x3e\x84\x20\xe0\x22\xc0\x1E\x7E\x00\x10\x07\x00\x05\x09\x01\xfe\x8c"
-                                    "\x62\xa5\x28\x80\x20\x1E\x7F\x00\x0f\x07\x00\x05\x07\x01\xfe\x8c\x54\xa2\x00\x80"
-                                    "\x1E\x80\x00\x11\x07\x00\x05\x0a\x01\x00\x41\x01\x1a\xd6\xbb\xd6\x80\x1E\x81\x00"
-                                    "\x0f\x07\x00\x05\x08\x01\x00\x41\x01\x1a\xd7\x7a\x1E\x82\x00\x11\x07\x00\x05\x0a"
-                                    "\x01\x00\x13\x01\x1a\xd6\xbb\xd6\x80\x1E\x83\x00\x0f\x07\x00\x05\x08\x01\x00\x13"
-                                    "\x01\x1a\xd7\x7a\x1E\x84\x00\x10\x07\x00\x05\x09\x01\x00\xd0\x23\x5a\xd7\x7a\xd0"
-                                    "\x1E\x85\x00\x0f\x07\x00\x05\x07\x01\x00\xd0\x23\x5a\xef\x40\x1E\x8C\x00\x10\x07"
-                                    "\x00\x05\x09\x01\x00\xd0\x22\xa6\x11\x52\x88\x1E\x8D\x00\x0f\x07\x00\x05\x07\x01"
-                                    "\x00\xd0\x24\xa2\x2a\x20\x1E\x8E\x00\x10\x07\x00\x05\x09\x01\x00\x20\x23\x25\x10"
-                                    "\x84\x20\x1E\x8F\x00\x11\x07\x00\x05\x0a\x01\xfd\x20\x23\x15\x29\x84\x26\x00\x1E"
-                                    "\x90\x00\x11\x07\x00\x05\x0a\x01\x00\x26\x81\xf1\x18\x88\x87\xc0\x1E\x91\x00\x0f"
-                                    "\x07\x00\x05\x08\x01\x00\x22\x81\xf1\x11\x1f\x1E\x92\x00\x10\x07\x00\x05\x09\x01"
-                                    "\xfe\xf8\x8c\x44\x43\xe0\x20\x1E\x93\x00\x0f\x07\x00\x05\x07\x01\xfe\xf8\x88\x8f"
-                                    "\x80\x80\x1E\x94\x00\x10\x07\x00\x05\x09\x01\xfe\xf8\x8c\x44\x43\xe0\x70\x1E\x95"
-                                    "\x00\x0f\x07\x00\x05\x07\x01\xfe\xf8\x88\x8f\x81\xc0\x1E\x96\x00\x11\x07\x00\x05"
-                                    "\x0a\x01\xfe\x84\x21\x6c\xc6\x31\x03\x80\x1E\x9E\x00\x0f\x07\x00\x05\x07\x01\x00"
-                                    "\x74\x65\x28\xc6\x60\x1E\xA0\x00\x10\x07\x00\x05\x09\x01\xfe\x22\x94\xaf\x46\x20"
-                                    "\x20\x1E\xA1\x00\x0f\x07\x00\x05\x07\x01\xfe\xf0\xbd\x2e\x80\x80\x1E\xA2\x00\x11"
-                                    "\x07\x00\x05\x0b\x01\x00\x60\x98\x02\x29\x4a\xf4\x62\x1E\xA3\x00\x10\x07\x00\x05"
-                                    "\x09\x01\x00\x60\x98\x0f\x0b\xd2\xe8\x1E\xA4\x00\x12\x07\x00\x05\x0c\x01\x00\x08"
-                                    "\x99\x20\x11\x4a\x57\xa3\x10\x1E\xA5\x00\x11\x07\x00\x05\x0a\x01\x00\x08\x99\x20"
-                                    "\x78\x5e\x97\x40\x1E\xA6\x00\x12\x07\x00\x05\x0c\x01\x00\x10\x59\x20\x11\x4a\x57"
-                                    "\xa3\x10\x1E\xA7\x00\x11\x07\x00\x05\x0a\x01\x00\x10\x59\x20\x78\x5e\x97\x40\x1E"
-                                    "\xA8\x00\x12\x07\x00\x05\x0c\x01\x00\x18\x59\x20\x11\x4a\x57\xa3\x10\x1E\xA9\x00"
-                                    "\x11\x07\x00\x05\x0a\x01\x00\x18\x59\x20\x78\x5e\x97\x40\x1E\xAA\x00\x12\x07\x00"
-                                    "\x05\x0c\x01\x00\x6c\x99\x20\x11\x4a\x57\xa3\x10\x1E\xAB\x00\x11\x07\x00\x05\x0a"
-                                    "\x01\x00\x4d\x99\x20\x78\x5e\x97\x40\x1E\xAC\x00\x12\x07\x00\x05\x0c\x01\xfe\x64"
-                                    "\x80\x45\x29\x5e\x8c\x40\x40\x1E\xAD\x00\x11\x07\x00\x05\x0a\x01\xfe\x64\x81\xe1"
-                                    "\x7a\x5d\x01\x00\x1E\xAE\x00\x12\x07\x00\x05\x0c\x01\x00\x11\x20\xe0\x11\x4a\x57"
-                                    "\xa3\x10\x1E\xAF\x00\x11\x07\x00\x05\x0a\x01\x00\x11\x24\xe0\x78\x5e\x97\x40\x1E"
-                                    "\xB0\x00\x12\x07\x00\x05\x0c\x01\x00\xc1\x24\xe0\x11\x4a\x57\xa3\x10\x1E\xB1\x00"
-                                    "\x11\x07\x00\x05\x0a\x01\x00\xc1\x24\xe0\x78\x5e\x97\x40\x1E\xB2\x00\x12\x07\x00"
-                                    "\x05\x0c\x01\x00\x61\x20\xe0\x11\x4a\x57\xa3\x10\x1E\xB3\x00\x11\x07\x00\x05\x0a"
-                                    "\x01\x00\x71\x24\xe0\x78\x5e\x97\x40\x1E\xB4\x00\x12\x07\x00\x05\x0c\x01\x00\x55"
-                                    "\xa4\xe0\x11\x4a\x57\xa3\x10\x1E\xB5\x00\x11\x07\x00\x05\x0b\x01\x00\x4d\x81\x27"
-                                    "\x03\xc2\xf4\xba\x1E\xB6\x00\x12\x07\x00\x05\x0c\x01\xfe\x93\x80\x45\x29\x5e\x8c"
-                                    "\x40\x40\x1E\xB7\x00\x11\x07\x00\x05\x0a\x01\xfe\x93\x81\xe1\x7a\x5d\x01\x00\x1E"
-                                    "\xB8\x00\x10\x07\x00\x05\x09\x01\xfe\xfc\x21\xe8\x43\xe0\x20\x1E\xB9\x00\x0f\x07"
-                                    "\x00\x05\x07\x01\xfe\x74\x7f\x07\x00\x80\x1E\xBA\x00\x11\x07\x00\x05\x0b\x01\x00"
-                                    "\x30\x88\x0f\xc2\x1e\x84\x3e\x1E\xBB\x00\x10\x07\x00\x05\x09\x01\x00\x60\x98\x07"
-                                    "\x47\xf0\x70\x1E\xBC\x00\x11\x07\x00\x05\x0a\x01\x00\x6c\x81\xf8\x43\xd0\x87\xc0"
-                                    "\x1E\xBD\x00\x0f\x07\x00\x05\x08\x01\x00\x4d\x80\xe8\xfe\x0e\x1E\xBE\x00\x13\x07"
-                                    "\x00\x06\x0c\x01\x00\x04\x23\x12\x03\xe8\x20\xf2\x08\x3e\x1E\xBF\x00\x12\x07\x00"
-                                    "\x06\x0a\x01\x00\x04\x22\x14\x01\xc8\xbe\x81\xc0\x1E\xC0\x00\x12\x07\x00\x05\x0c"
-                                    "\x01\x00\x10\x4c\x90\x7e\x10\xf4\x21\xf0\x1E\xC1\x00\x11\x07\x00\x05\x0a\x01\x00"
-                                    "\x10\x48\xa0\x3a\x3f\x83\x80\x1E\xC2\x00\x12\x07\x00\x05\x0c\x01\x00\x18\x4c\x90"
-                                    "\x7e\x10\xf4\x21\xf0\x1E\xC3\x00\x12\x07\x00\x06\x0a\x01\x00\x1c\x22\x14\x01\xc8"
-                                    "\xbe\x81\xc0\x1E\xC4\x00\x12\x07\x00\x05\x0c\x01\x00\x6a\x8c\x90\x7e\x10\xf4\x21"
-                                    "\xf0\x1E\xC5\x00\x11\x07\x00\x05\x0a\x01\x00\x6c\x88\xa0\x3a\x3f\x83\x80\x1E\xC6"
-                                    "\x00\x12\x07\x00\x05\x0c\x01\xfe\x32\x41\xf8\x43\xd0\x87\xc0\x40\x1E\xC7\x00\x11"
-                                    "\x07\x00\x05\x0a\x01\xfe\x22\x80\xe8\xfe\x0e\x01\x00\x1E\xC8\x00\x0f\x07\x00\x03"
-                                    "\x0b\x02\x00\xc5\x0e\x92\x4b\x80\x1E\xC9\x00\x10\x07\x00\x05\x09\x01\x00\x60\x98"
-                                    "\x0e\x10\x84\xf8\x1E\xCA\x00\x0e\x07\x00\x03\x09\x02\xfe\xe9\x24\xb8\x40\x1E\xCB"
-                                    "\x00\x11\x07\x00\x05\x0a\x01\xfe\x20\x01\xc2\x10\x9f\x01\x00\x1E\xCC\x00\x10\x07"
-                                    "\x00\x05\x09\x01\xfe\x74\x63\x18\xc5\xc0\x20\x1E\xCD\x00\x0f\x07\x00\x05\x07\x01"
-                                    "\xfe\x74\x63\x17\x00\x80\x1E\xCE\x00\x11\x07\x00\x05\x0b\x01\x00\x60\x88\x07\x46"
-                                    "\x31\x8c\x5c\x1E\xCF\x00\x10\x07\x00\x05\x09\x01\x00\x60\x98\x07\x46\x31\x70\x1E"
-                                    "\xD0\x00\x12\x07\x00\x05\x0c\x01\x00\x08\x49\xa0\x3a\x31\x8c\x62\xe0\x1E\xD1\x00"
-                                    "\x11\x07\x00\x05\x0a\x01\x00\x08\x99\x20\x3a\x31\x8b\x80\x1E\xD2\x00\x12\x07\x00"
-                                    "\x05\x0c\x01\x00\x10\x49\xa0\x3a\x31\x8c\x62\xe0\x1E\xD3\x00\x11\x07\x00\x05\x0a"
-                                    "\x01\x00\x10\x59\x20\x3a\x31\x8b\x80\x1E\xD4\x00\x12\x07\x00\x05\x0c\x01\x00\x18"
-                                    "\x49\xa0\x3a\x31\x8c\x62\xe0\x1E\xD5\x00\x11\x07\x00\x05\x0a\x01\x00\x18\x59\x20"
-                                    "\x3a\x31\x8b\x80\x1E\xD6\x00\x12\x07\x00\x05\x0c\x01\x00\x6c\x89\xa0\x3a\x31\x8c"
-                                    "\x62\xe0\x1E\xD7\x00\x11\x07\x00\x05\x0a\x01\x00\x4d\x99\x20\x3a\x31\x8b\x80\x1E"
-                                    "\xD8\x00\x12\x07\x00\x05\x0c\x01\xfe\x64\x80\xe8\xc6\x31\x8b\x80\x40\x1E\xD9\x00"
-                                    "\x11\x07\x00\x05\x0a\x01\xfe\x64\x80\xe8\xc6\x2e\x01\x00\x1E\xDA\x00\x12\x07\x00"
-                                    "\x06\x0a\x01\x00\x11\x80\x5e\x8a\x28\xa2\x89\xc0\x1E\xDB\x00\x0f\x07\x00\x05\x08"
-                                    "\x01\x00\x13\x02\xf8\xc6\x2e\x1E\xDC\x00\x12\x07\x00\x06\x0a\x01\x00\x40\x80\x5e"
-                                    "\x8a\x28\xa2\x89\xc0\x1E\xDD\x00\x0f\x07\x00\x05\x08\x01\x00\x41\x02\xf8\xc6\x2e"
-                                    "\x1E\xDE\x00\x13\x07\x00\x06\x0b\x01\x00\x60\x42\x01\x7a\x28\xa2\x8a\x27\x00\x1E"
-                                    "\xDF\x00\x10\x07\x00\x05\x09\x01\x00\x60\x98\x17\xc6\x31\x70\x1E\xE0\x00\x12\x07"
-                                    "\x00\x06\x0a\x01\x00\x4a\xc0\x5e\x8a\x28\xa2\x89\xc0\x1E\xE1\x00\x0f\x07\x00\x05"
-                                    "\x08\x01\x00\x4d\x82\xf8\xc6\x2e\x1E\xE2\x00\x12\x07\x00\x06\x0a\x01\xfe\x05\xe8"
-                                    "\xa2\x8a\x28\x9c\x00\x80\x1E\xE3\x00\x0f\x07\x00\x05\x08\x01\xfe\x0b\xe3\x18\xb8"
-                                    "\x04\x1E\xE4\x00\x10\x07\x00\x05\x09\x01\xfe\x8c\x63\x18\xc5\xc0\x20\x1E\xE5\x00"
-                                    "\x0f\x07\x00\x05\x07\x01\xfe\x8c\x63\x3e\x80\x80\x1E\xE6\x00\x11\x07\x00\x05\x0b"
-                                    "\x01\x00\x60\x88\x08\xc6\x31\x8c\x5c\x1E\xE7\x00\x10\x07\x00\x05\x09\x01\x00\x60"
-                                    "\x98\x08\xc6\x33\xe8\x1E\xE8\x00\x12\x07\x00\x06\x0a\x01\x00\x11\x80\x63\x8a\x28"
-                                    "\xa2\x89\xc0\x1E\xE9\x00\x10\x07\x00\x06\x08\x01\x00\x10\x80\x62\x8a\x29\xba\x1E"
-                                    "\xEA\x00\x12\x07\x00\x06\x0a\x01\x00\x40\x80\x63\x8a\x28\xa2\x89\xc0\x1E\xEB\x00"
-                                    "\x10\x07\x00\x06\x08\x01\x00\x40\x80\x62\x8a\x29\xba\x1E\xEC\x00\x13\x07\x00\x06"
-                                    "\x0b\x01\x00\x60\x42\x01\x8e\x28\xa2\x8a\x27\x00\x1E\xED\x00\x11\x07\x00\x06\x09"
-                                    "\x01\x00\x60\x46\x01\x8a\x28\xa6\xe8\x1E\xEE\x00\x12\x07\x00\x06\x0a\x01\x00\x4a"
-                                    "\xc0\x63\x8a\x28\xa2\x89\xc0\x1E\xEF\x00\x10\x07\x00\x06\x08\x01\x00\x4a\xc0\x62"
-                                    "\x8a\x29\xba\x1E\xF0\x00\x12\x07\x00\x06\x0a\x01\xfe\x06\x38\xa2\x8a\x28\x9c\x00"
-                                    "\x80\x1E\xF1\x00\x10\x07\x00\x06\x08\x01\xfe\x06\x28\xa2\x9b\xa0\x08\x1E\xF2\x00"
-                                    "\x11\x07\x00\x05\x0a\x01\x00\x41\x01\x19\x28\x84\x21\x00\x1E\xF3\x00\x11\x07\x00"
-                                    "\x05\x0b\x01\xfd\x41\x01\x18\xa9\x4c\x21\x30\x1E\xF4\x00\x10\x07\x00\x05\x09\x01"
-                                    "\xfe\x8c\x94\x42\x10\x80\x20\x1E\xF5\x00\x0f\x07\x00\x05\x08\x01\xfd\x8c\x54\xa6"
-                                    "\x10\xb8\x1E\xF6\x00\x11\x07\x00\x05\x0b\x01\x00\x60\x88\x08\xc9\x44\x21\x08\x1E"
-                                    "\xF7\x00\x12\x07\x00\x05\x0c\x01\xfd\x60\x98\x08\xc5\x4a\x61\x09\x80\x1E\xF8\x00"
-                                    "\x11\x07\x00\x05\x0a\x01\x00\x4d\x81\x19\x28\x84\x21\x00\x1E\xF9\x00\x11\x07\x00"
-                                    "\x05\x0b\x01\xfd\x4d\x81\x18\xa9\x4c\x21\x30\x20\x11\x00\x0b\x07\x00\x04\x01\x01"
-                                    "\x03\xf0\x20\x13\x00\x0b\x07\x00\x05\x01\x01\x03\xf8\x20\x14\x00\x0b\x07\x00\x05"
-                                    "\x01\x01\x03\xf8\x20\x15\x00\x0b\x07\x00\x05\x01\x01\x03\xf8\x20\x18\x00\x0c\x07"
-                                    "\x00\x03\x03\x02\x05\x6b\x00\x20\x19\x00\x0c\x07\x00\x03\x03\x02\x05\x6a\x00\x20"
-                                    "\x1A\x00\x0c\x07\x00\x03\x03\x02\xff\x6a\x00\x20\x1C\x00\x0c\x07\x00\x05\x03\x01"
-                                    "\x05\x4e\xa4\x20\x1D\x00\x0c\x07\x00\x05\x03\x01\x05\x4e\xe4\x20\x1E\x00\x0c\x07"
-                                    "\x00\x05\x03\x01\xff\x4e\xe4\x20\x20\x00\x0f\x07\x00\x05\x08\x01\x00\x21\x3e\x42"
-                                    "\x10\x84\x20\x21\x00\x0f\x07\x00\x05\x08\x01\x00\x21\x3e\x42\x7c\x84\x20\x22\x00"
-                                    "\x0c\x07\x00\x03\x03\x02\x02\xdf\x80\x20\x25\x00\x0c\x07\x00\x05\x02\x01\x00\x9c"
-                                    "\xc0\x20\x26\x00\x0c\x07\x00\x06\x02\x00\x00\x57\x50\x20\x39\x00\x0c\x07\x00\x03"
-                                    "\x05\x02\x00\x2a\x22\x20\x3A\x00\x0c\x07\x00\x03\x05\x02\x00\x88\xa8\x20\x44\x00"
-                                    "\x10\x07\x00\x06\x07\x00\x00\x04\x10\x84\x21\x08\x00\x20\x70\x00\x0c\x07\x00\x03"
-                                    "\x04\x02\x04\xfe\xf0\x20\x74\x00\x0c\x07\x00\x03\x04\x02\x04\x57\x90\x20\x75\x00"
-                                    "\x0c\x07\x00\x03\x04\x02\x04\xf8\xe0\x20\x76\x00\x0c\x07\x00\x03\x04\x02\x04\x5a"
-                                    "\xf0\x20\x77\x00\x0c\x07\x00\x03\x04\x02\x04\xe5\x40\x20\x78\x00\x0c\x07\x00\x03"
-                                    "\x04\x02\x04\xfe\xf0\x20\x79\x00\x0c\x07\x00\x03\x04\x02\x04\xf7\xa0\x20\x80\x00"
-                                    "\x0c\x07\x00\x03\x04\x02\xfd\xfe\xf0\x20\x81\x00\x0c\x07\x00\x03\x04\x02\xfd\x49"
-                                    "\x70\x20\x82\x00\x0c\x07\x00\x03\x04\x02\xfd\xe5\x70\x20\x83\x00\x0c\x07\x00\x03"
-                                    "\x04\x02\xfd\xe8\xf0\x20\x84\x00\x0c\x07\x00\x03\x04\x02\xfd\x57\x90\x20\x85\x00"
-                                    "\x0c\x07\x00\x03\x04\x02\xfd\xf8\xe0\x20\x86\x00\x0c\x07\x00\x03\x04\x02\xfd\x5a"
-                                    "\xf0\x20\x87\x00\x0c\x07\x00\x03\x04\x02\xfd\xe5\x40\x20\x88\x00\x0c\x07\x00\x03"
-                                    "\x04\x02\xfd\xfe\xf0\x20\x89\x00\x0c\x07\x00\x03\x04\x02\xfd\xf7\xa0\x20\xA6\x00"
-                                    "\x11\x07\x00\x07\x07\x00\x00\x64\xcb\x7a\xaf\x69\x93\x00\x20\xA9\x00\x11\x07\x00"
-                                    "\x07\x07\x00\x00\x44\x89\x57\x76\xcd\x9a\x00\x20\xAB\x00\x11\x07\x00\x06\x09\x01"
-                                    "\xfe\x3c\x27\xa2\x8a\x6e\x80\xf8\x20\xAC\x00\x0f\x07\x00\x05\x07\x01\x00\x3a\x3d"
-                                    "\x0f\x21\xe0\x20\xB1\x00\x11\x07\x00\x07\x07\x00\x00\x78\x93\xfa\x27\x88\x10\x00"
-                                    "\x20\xB9\x00\x0f\x07\x00\x05\x07\x01\x00\xf8\xbe\x2e\x30\x40\x20\xBA\x00\x10\x07"
-                                    "\x00\x06\x07\x00\x00\x41\x46\x34\x65\x17\x80\x20\xBD\x00\x10\x07\x00\x06\x07\x00"
-                                    "\x00\x7d\x14\x7f\x43\xe4\x00\x21\x17\x00\x10\x07\x00\x05\x09\x01\xff\x74\x7f\xbf"
-                                    "\xe7\x31\x70\x21\x20\x00\x0d\x07\x00\x06\x04\x00\x04\x77\x73\x7d\x21\x22\x00\x0d"
-                                    "\x07\x00\x06\x03\x00\x05\xf5\x75\x40\x21\x53\x00\x13\x07\x00\x07\x0a\x00\xfd\x40"
-                                    "\x81\x0f\x21\x84\x17\x46\x02\x18\x21\x54\x00\x13\x07\x00\x07\x0a\x00\xfd\x60\x41"
-                                    "\x0f\x21\x84\x17\x46\x02\x18\x21\x55\x00\x13\x07\x00\x07\x0a\x00\xfd\x40\x81\x0f"
-                                    "\x21\x84\x13\x4e\x02\x38\x21\x56\x00\x13\x07\x00\x07\x0a\x00\xfd\x60\x41\x0f\x21"
-                                    "\x84\x13\x4e\x02\x38\x21\x57\x00\x13\x07\x00\x07\x0a\x00\xfd\xe0\xc0\x4f\x21\x84"
-                                    "\x13\x4e\x02\x38\x21\x58\x00\x13\x07\x00\x07\x0a\x00\xfd\x20\xc3\xc9\x21\x84\x13"
-                                    "\x4e\x02\x38\x21\x59\x00\x13\x07\x00\x07\x0a\x00\xfd\x40\x81\x0f\x21\x84\x12\x4c"
-                                    "\x14\x38\x21\x5A\x00\x13\x07\x00\x07\x0a\x00\xfd\xe1\xc0\x4f\x21\x84\x12\x4c\x14"
-                                    "\x38\x21\x5B\x00\x13\x07\x00\x07\x0a\x00\xfd\x40\x81\x0f\x21\x84\x17\x4e\x14\x38"
-                                    "\x21\x5C\x00\x13\x07\x00\x07\x0a\x00\xfd\xe0\xc0\x4f\x21\x84\x17\x4e\x14\x38\x21"
-                                    "\x5D\x00\x13\x07\x00\x07\x0a\x00\xfd\xe1\xc0\x4f\x21\x84\x17\x4e\x14\x38\x21\x5E"
-                                    "\x00\x13\x07\x00\x07\x0a\x00\xfd\xf0\x40\x8a\x21\x84\x17\x4e\x14\x38\x22\x12\x00"
-                                    "\x0b\x07\x00\x05\x01\x01\x03\xf8\x22\x48\x00\x0e\x07\x00\x05\x05\x01\x01\xcd\xc1"
-                                    "\x9b\x80\x22\x60\x00\x0e\x07\x00\x05\x05\x01\x01\x17\xc9\xf4\x00\x22\x64\x00\x0f"
-                                    "\x07\x00\x05\x07\x01\x00\x1b\x20\xc1\x83\xe0\x22\x65\x00\x0f\x07\x00\x05\x07\x01"
-                                    "\x00\x83\x82\xe8\x03\xe0\xA7\x88\x00\x0b\x07\x00\x04\x02\x01\xfd\x69";
+static constexpr Character intel_one_mono_8_pt_characters[623] = {
+    {0x0000, 0, 5, 8, 4, 8, 0, 0},
+    {0x0020, 4, 7, 0, 0, 0, 0, 0},
+    {0x0021, 4, 7, 0, 2, 8, 2, 0},
+    {0x0022, 6, 7, 0, 4, 3, 1, 5},
+    {0x0023, 8, 7, 0, 6, 7, 0, 0},
+    {0x0024, 14, 7, 0, 5, 11, 1, -2},
+    {0x0025, 21, 7, 0, 6, 7, 0, 0},
+    {0x0026, 27, 7, 0, 5, 7, 1, 0},
+    {0x0027, 32, 7, 0, 1, 3, 3, 5},
+    {0x0028, 33, 7, 0, 5, 11, 1, -2},
+    {0x0029, 40, 7, 0, 4, 11, 1, -2},
+    {0x002A, 46, 7, 0, 5, 5, 1, 2},
+    {0x002B, 50, 7, 0, 5, 5, 1, 1},
+    {0x002C, 54, 7, 0, 2, 3, 2, -2},
+    {0x002D, 55, 7, 0, 4, 1, 1, 3},
+    {0x002E, 56, 7, 0, 2, 2, 2, 0},
+    {0x002F, 57, 7, 0, 5, 9, 1, -1},
+    {0x0030, 63, 7, 0, 5, 7, 1, 0},
+    {0x0031, 68, 7, 0, 5, 7, 1, 0},
+    {0x0032, 73, 7, 0, 5, 7, 1, 0},
+    {0x0033, 78, 7, 0, 5, 7, 1, 0},
+    {0x0034, 83, 7, 0, 5, 7, 1, 0},
+    {0x0035, 88, 7, 0, 5, 7, 1, 0},
+    {0x0036, 93, 7, 0, 5, 7, 1, 0},
+    {0x0037, 98, 7, 0, 5, 7, 1, 0},
+    {0x0038, 103, 7, 0, 5, 7, 1, 0},
+    {0x0039, 108, 7, 0, 5, 7, 1, 0},
+    {0x003A, 113, 7, 0, 2, 5, 2, 0},
+    {0x003B, 115, 7, 0, 2, 7, 2, -2},
+    {0x003C, 117, 7, 0, 5, 5, 1, 1},
+    {0x003D, 121, 7, 0, 5, 3, 1, 2},
+    {0x003E, 123, 7, 0, 5, 5, 1, 1},
+    {0x003F, 127, 7, 0, 5, 8, 1, 0},
+    {0x0040, 132, 7, 0, 5, 9, 1, -1},
+    {0x0041, 138, 7, 0, 5, 7, 1, 0},
+    {0x0042, 143, 7, 0, 5, 7, 1, 0},
+    {0x0043, 148, 7, 0, 5, 7, 1, 0},
+    {0x0044, 153, 7, 0, 5, 7, 1, 0},
+    {0x0045, 158, 7, 0, 5, 7, 1, 0},
+    {0x0046, 163, 7, 0, 5, 7, 1, 0},
+    {0x0047, 168, 7, 0, 5, 7, 1, 0},
+    {0x0048, 173, 7, 0, 5, 7, 1, 0},
+    {0x0049, 178, 7, 0, 3, 7, 2, 0},
+    {0x004A, 181, 7, 0, 5, 7, 1, 0},
+    {0x004B, 186, 7, 0, 5, 7, 1, 0},
+    {0x004C, 191, 7, 0, 5, 7, 1, 0},
+    {0x004D, 196, 7, 0, 5, 7, 1, 0},
+    {0x004E, 201, 7, 0, 5, 7, 1, 0},
+    {0x004F, 206, 7, 0, 5, 7, 1, 0},
+    {0x0050, 211, 7, 0, 5, 7, 1, 0},
+    {0x0051, 216, 7, 0, 6, 9, 1, -2},
+    {0x0052, 223, 7, 0, 5, 7, 1, 0},
+    {0x0053, 228, 7, 0, 5, 7, 1, 0},
+    {0x0054, 233, 7, 0, 5, 7, 1, 0},
+    {0x0055, 238, 7, 0, 5, 7, 1, 0},
+    {0x0056, 243, 7, 0, 5, 7, 1, 0},
+    {0x0057, 248, 7, 0, 5, 7, 1, 0},
+    {0x0058, 253, 7, 0, 5, 7, 1, 0},
+    {0x0059, 258, 7, 0, 5, 7, 1, 0},
+    {0x005A, 263, 7, 0, 5, 7, 1, 0},
+    {0x005B, 268, 7, 0, 4, 10, 2, -1},
+    {0x005C, 273, 7, 0, 5, 9, 1, -1},
+    {0x005D, 279, 7, 0, 4, 10, 1, -1},
+    {0x005E, 284, 7, 0, 5, 4, 1, 3},
+    {0x005F, 287, 7, 0, 5, 1, 1, -2},
+    {0x0060, 288, 7, 0, 2, 2, 2, 6},
+    {0x0061, 289, 7, 0, 5, 5, 1, 0},
+    {0x0062, 293, 7, 0, 5, 8, 1, 0},
+    {0x0063, 298, 7, 0, 5, 5, 1, 0},
+    {0x0064, 302, 7, 0, 5, 8, 1, 0},
+    {0x0065, 307, 7, 0, 5, 5, 1, 0},
+    {0x0066, 311, 7, 0, 5, 8, 1, 0},
+    {0x0067, 316, 7, 0, 5, 8, 1, -3},
+    {0x0068, 321, 7, 0, 5, 8, 1, 0},
+    {0x0069, 326, 7, 0, 5, 8, 1, 0},
+    {0x006A, 331, 7, 0, 4, 11, 1, -3},
+    {0x006B, 337, 7, 0, 5, 8, 1, 0},
+    {0x006C, 342, 7, 0, 5, 8, 1, 0},
+    {0x006D, 347, 7, 0, 5, 5, 1, 0},
+    {0x006E, 351, 7, 0, 5, 5, 1, 0},
+    {0x006F, 355, 7, 0, 5, 5, 1, 0},
+    {0x0070, 359, 7, 0, 5, 8, 1, -3},
+    {0x0071, 364, 7, 0, 5, 8, 1, -3},
+    {0x0072, 369, 7, 0, 5, 5, 1, 0},
+    {0x0073, 373, 7, 0, 5, 5, 1, 0},
+    {0x0074, 377, 7, 0, 5, 7, 1, 0},
+    {0x0075, 382, 7, 0, 5, 5, 1, 0},
+    {0x0076, 386, 7, 0, 5, 5, 1, 0},
+    {0x0077, 390, 7, 0, 5, 5, 1, 0},
+    {0x0078, 394, 7, 0, 5, 5, 1, 0},
+    {0x0079, 398, 7, 0, 5, 8, 1, -3},
+    {0x007A, 403, 7, 0, 5, 5, 1, 0},
+    {0x007B, 407, 7, 0, 5, 11, 1, -2},
+    {0x007C, 414, 7, 0, 1, 9, 3, -1},
+    {0x007D, 416, 7, 0, 5, 11, 1, -2},
+    {0x007E, 423, 7, 0, 5, 2, 1, 2},
+    {0x00A0, 425, 7, 0, 0, 0, 0, 0},
+    {0x00A1, 425, 7, 0, 1, 8, 3, 0},
+    {0x00A2, 426, 7, 0, 4, 9, 1, -2},
+    {0x00A3, 431, 7, 0, 5, 7, 1, 0},
+    {0x00A5, 436, 7, 0, 5, 7, 1, 0},
+    {0x00A7, 441, 7, 0, 5, 10, 1, -3},
+    {0x00A8, 448, 7, 0, 4, 1, 1, 6},
+    {0x00A9, 449, 7, 0, 5, 9, 1, -1},
+    {0x00AA, 455, 7, 0, 5, 6, 1, 2},
+    {0x00AB, 459, 7, 0, 5, 5, 1, 0},
+    {0x00AE, 463, 7, 0, 5, 6, 1, 2},
+    {0x00AF, 467, 7, 0, 3, 1, 2, 6},
+    {0x00B0, 468, 7, 0, 5, 4, 1, 4},
+    {0x00B1, 471, 7, 0, 5, 7, 1, 0},
+    {0x00B2, 476, 7, 0, 3, 4, 2, 4},
+    {0x00B3, 478, 7, 0, 3, 4, 2, 4},
+    {0x00B4, 480, 7, 0, 3, 2, 2, 6},
+    {0x00B5, 481, 7, 0, 5, 8, 1, -3},
+    {0x00B6, 486, 7, 0, 5, 7, 1, 0},
+    {0x00B7, 491, 7, 0, 2, 2, 2, 3},
+    {0x00B8, 492, 7, 0, 3, 3, 2, -3},
+    {0x00B9, 494, 7, 0, 3, 4, 2, 4},
+    {0x00BA, 496, 7, 0, 4, 6, 1, 2},
+    {0x00BB, 499, 7, 0, 5, 5, 1, 0},
+    {0x00BC, 503, 7, 0, 7, 10, 0, -3},
+    {0x00BD, 512, 7, 0, 7, 10, 0, -3},
+    {0x00BE, 521, 7, 0, 7, 10, 0, -3},
+    {0x00BF, 530, 7, 0, 5, 8, 1, 0},
+    {0x00C0, 535, 7, 0, 5, 10, 1, 0},
+    {0x00C1, 542, 7, 0, 5, 10, 1, 0},
+    {0x00C2, 549, 7, 0, 5, 10, 1, 0},
+    {0x00C3, 556, 7, 0, 5, 10, 1, 0},
+    {0x00C4, 563, 7, 0, 5, 9, 1, 0},
+    {0x00C5, 569, 7, 0, 5, 9, 1, 0},
+    {0x00C6, 575, 7, 0, 6, 7, 0, 0},
+    {0x00C7, 581, 7, 0, 5, 10, 1, -3},
+    {0x00C8, 588, 7, 0, 5, 10, 1, 0},
+    {0x00C9, 595, 7, 0, 5, 10, 1, 0},
+    {0x00CA, 602, 7, 0, 5, 10, 1, 0},
+    {0x00CB, 609, 7, 0, 5, 9, 1, 0},
+    {0x00CC, 615, 7, 0, 3, 10, 2, 0},
+    {0x00CD, 619, 7, 0, 3, 10, 2, 0},
+    {0x00CE, 623, 7, 0, 4, 10, 1, 0},
+    {0x00CF, 628, 7, 0, 4, 9, 1, 0},
+    {0x00D0, 633, 7, 0, 6, 7, 0, 0},
+    {0x00D1, 639, 7, 0, 5, 10, 1, 0},
+    {0x00D2, 646, 7, 0, 5, 10, 1, 0},
+    {0x00D3, 653, 7, 0, 5, 10, 1, 0},
+    {0x00D4, 660, 7, 0, 5, 10, 1, 0},
+    {0x00D5, 667, 7, 0, 5, 10, 1, 0},
+    {0x00D6, 674, 7, 0, 5, 9, 1, 0},
+    {0x00D7, 680, 7, 0, 5, 5, 1, 1},
+    {0x00D8, 684, 7, 0, 5, 9, 1, -1},
+    {0x00D9, 690, 7, 0, 5, 10, 1, 0},
+    {0x00DA, 697, 7, 0, 5, 10, 1, 0},
+    {0x00DB, 704, 7, 0, 5, 10, 1, 0},
+    {0x00DC, 711, 7, 0, 5, 9, 1, 0},
+    {0x00DD, 717, 7, 0, 5, 10, 1, 0},
+    {0x00DE, 724, 7, 0, 5, 7, 1, 0},
+    {0x00DF, 729, 7, 0, 5, 8, 1, 0},
+    {0x00E0, 734, 7, 0, 5, 8, 1, 0},
+    {0x00E1, 739, 7, 0, 5, 8, 1, 0},
+    {0x00E2, 744, 7, 0, 5, 8, 1, 0},
+    {0x00E3, 749, 7, 0, 5, 8, 1, 0},
+    {0x00E4, 754, 7, 0, 5, 7, 1, 0},
+    {0x00E5, 759, 7, 0, 5, 9, 1, 0},
+    {0x00E6, 765, 7, 0, 6, 5, 0, 0},
+    {0x00E7, 769, 7, 0, 5, 8, 1, -3},
+    {0x00E8, 774, 7, 0, 5, 8, 1, 0},
+    {0x00E9, 779, 7, 0, 5, 8, 1, 0},
+    {0x00EA, 784, 7, 0, 5, 8, 1, 0},
+    {0x00EB, 789, 7, 0, 5, 7, 1, 0},
+    {0x00EC, 794, 7, 0, 5, 8, 1, 0},
+    {0x00ED, 799, 7, 0, 5, 8, 1, 0},
+    {0x00EE, 804, 7, 0, 5, 8, 1, 0},
+    {0x00EF, 809, 7, 0, 5, 7, 1, 0},
+    {0x00F0, 814, 7, 0, 5, 8, 1, 0},
+    {0x00F1, 819, 7, 0, 5, 8, 1, 0},
+    {0x00F2, 824, 7, 0, 5, 8, 1, 0},
+    {0x00F3, 829, 7, 0, 5, 8, 1, 0},
+    {0x00F4, 834, 7, 0, 5, 8, 1, 0},
+    {0x00F5, 839, 7, 0, 5, 8, 1, 0},
+    {0x00F6, 844, 7, 0, 5, 7, 1, 0},
+    {0x00F7, 849, 7, 0, 5, 5, 1, 1},
+    {0x00F8, 853, 7, 0, 5, 7, 1, -1},
+    {0x00F9, 858, 7, 0, 5, 8, 1, 0},
+    {0x00FA, 863, 7, 0, 5, 8, 1, 0},
+    {0x00FB, 868, 7, 0, 5, 8, 1, 0},
+    {0x00FC, 873, 7, 0, 5, 7, 1, 0},
+    {0x00FD, 878, 7, 0, 5, 11, 1, -3},
+    {0x00FE, 885, 7, 0, 5, 11, 1, -3},
+    {0x00FF, 892, 7, 0, 5, 10, 1, -3},
+    {0x0100, 899, 7, 0, 5, 9, 1, 0},
+    {0x0101, 905, 7, 0, 5, 7, 1, 0},
+    {0x0102, 910, 7, 0, 5, 10, 1, 0},
+    {0x0103, 917, 7, 0, 5, 8, 1, 0},
+    {0x0104, 922, 7, 0, 6, 10, 1, -3},
+    {0x0105, 930, 7, 0, 5, 8, 1, -3},
+    {0x0106, 935, 7, 0, 5, 10, 1, 0},
+    {0x0107, 942, 7, 0, 5, 8, 1, 0},
+    {0x0108, 947, 7, 0, 5, 10, 1, 0},
+    {0x0109, 954, 7, 0, 5, 8, 1, 0},
+    {0x010A, 959, 7, 0, 5, 9, 1, 0},
+    {0x010B, 965, 7, 0, 5, 7, 1, 0},
+    {0x010C, 970, 7, 0, 5, 10, 1, 0},
+    {0x010D, 977, 7, 0, 5, 8, 1, 0},
+    {0x010E, 982, 7, 0, 5, 10, 1, 0},
+    {0x010F, 989, 7, 0, 7, 9, 1, 0},
+    {0x0110, 997, 7, 0, 6, 7, 0, 0},
+    {0x0111, 1003, 7, 0, 5, 8, 1, 0},
+    {0x0112, 1008, 7, 0, 5, 9, 1, 0},
+    {0x0113, 1014, 7, 0, 5, 7, 1, 0},
+    {0x0114, 1019, 7, 0, 5, 10, 1, 0},
+    {0x0115, 1026, 7, 0, 5, 8, 1, 0},
+    {0x0116, 1031, 7, 0, 5, 9, 1, 0},
+    {0x0117, 1037, 7, 0, 5, 7, 1, 0},
+    {0x0118, 1042, 7, 0, 5, 10, 1, -3},
+    {0x0119, 1049, 7, 0, 5, 8, 1, -3},
+    {0x011A, 1054, 7, 0, 5, 10, 1, 0},
+    {0x011B, 1061, 7, 0, 5, 8, 1, 0},
+    {0x011C, 1066, 7, 0, 5, 10, 1, 0},
+    {0x011D, 1073, 7, 0, 5, 11, 1, -3},
+    {0x011E, 1080, 7, 0, 5, 10, 1, 0},
+    {0x011F, 1087, 7, 0, 5, 11, 1, -3},
+    {0x0120, 1094, 7, 0, 5, 9, 1, 0},
+    {0x0121, 1100, 7, 0, 5, 10, 1, -3},
+    {0x0122, 1107, 7, 0, 5, 11, 1, -4},
+    {0x0123, 1114, 7, 0, 5, 12, 1, -3},
+    {0x0124, 1122, 7, 0, 5, 10, 1, 0},
+    {0x0125, 1129, 7, 0, 6, 11, 0, 0},
+    {0x0126, 1138, 7, 0, 6, 7, 0, 0},
+    {0x0127, 1144, 7, 0, 6, 8, 0, 0},
+    {0x0128, 1150, 7, 0, 5, 10, 1, 0},
+    {0x0129, 1157, 7, 0, 5, 8, 1, 0},
+    {0x012A, 1162, 7, 0, 3, 9, 2, 0},
+    {0x012B, 1166, 7, 0, 5, 7, 1, 0},
+    {0x012C, 1171, 7, 0, 4, 10, 1, 0},
+    {0x012D, 1176, 7, 0, 5, 8, 1, 0},
+    {0x012E, 1181, 7, 0, 3, 10, 2, -3},
+    {0x012F, 1185, 7, 0, 5, 11, 1, -3},
+    {0x0130, 1192, 7, 0, 3, 9, 2, 0},
+    {0x0131, 1196, 7, 0, 5, 5, 1, 0},
+    {0x0134, 1200, 7, 0, 6, 10, 1, 0},
+    {0x0135, 1208, 7, 0, 5, 11, 1, -3},
+    {0x0136, 1215, 7, 0, 5, 11, 1, -4},
+    {0x0137, 1222, 7, 0, 5, 12, 1, -4},
+    {0x0139, 1230, 7, 0, 5, 10, 1, 0},
+    {0x013A, 1237, 7, 0, 5, 11, 1, 0},
+    {0x013B, 1244, 7, 0, 5, 11, 1, -4},
+    {0x013C, 1251, 7, 0, 5, 12, 1, -4},
+    {0x013D, 1259, 7, 0, 5, 7, 1, 0},
+    {0x013E, 1264, 7, 0, 5, 9, 1, 0},
+    {0x013F, 1270, 7, 0, 5, 7, 1, 0},
+    {0x0140, 1275, 7, 0, 6, 8, 1, 0},
+    {0x0141, 1281, 7, 0, 6, 7, 0, 0},
+    {0x0142, 1287, 7, 0, 5, 8, 1, 0},
+    {0x0143, 1292, 7, 0, 5, 10, 1, 0},
+    {0x0144, 1299, 7, 0, 5, 8, 1, 0},
+    {0x0145, 1304, 7, 0, 5, 11, 1, -4},
+    {0x0146, 1311, 7, 0, 5, 9, 1, -4},
+    {0x0147, 1317, 7, 0, 5, 10, 1, 0},
+    {0x0148, 1324, 7, 0, 5, 8, 1, 0},
+    {0x014A, 1329, 7, 0, 5, 10, 1, -3},
+    {0x014B, 1336, 7, 0, 5, 8, 1, -3},
+    {0x014C, 1341, 7, 0, 5, 9, 1, 0},
+    {0x014D, 1347, 7, 0, 5, 7, 1, 0},
+    {0x014E, 1352, 7, 0, 5, 10, 1, 0},
+    {0x014F, 1359, 7, 0, 5, 8, 1, 0},
+    {0x0150, 1364, 7, 0, 5, 10, 1, 0},
+    {0x0151, 1371, 7, 0, 5, 8, 1, 0},
+    {0x0152, 1376, 7, 0, 6, 7, 0, 0},
+    {0x0153, 1382, 7, 0, 6, 5, 0, 0},
+    {0x0154, 1386, 7, 0, 5, 10, 1, 0},
+    {0x0155, 1393, 7, 0, 5, 8, 1, 0},
+    {0x0156, 1398, 7, 0, 5, 11, 1, -4},
+    {0x0157, 1405, 7, 0, 5, 9, 1, -4},
+    {0x0158, 1411, 7, 0, 5, 10, 1, 0},
+    {0x0159, 1418, 7, 0, 5, 8, 1, 0},
+    {0x015A, 1423, 7, 0, 5, 10, 1, 0},
+    {0x015B, 1430, 7, 0, 5, 8, 1, 0},
+    {0x015C, 1435, 7, 0, 5, 10, 1, 0},
+    {0x015D, 1442, 7, 0, 5, 8, 1, 0},
+    {0x015E, 1447, 7, 0, 5, 10, 1, -3},
+    {0x015F, 1454, 7, 0, 5, 8, 1, -3},
+    {0x0160, 1459, 7, 0, 5, 10, 1, 0},
+    {0x0161, 1466, 7, 0, 5, 8, 1, 0},
+    {0x0162, 1471, 7, 0, 5, 10, 1, -3},
+    {0x0163, 1478, 7, 0, 5, 10, 1, -3},
+    {0x0164, 1485, 7, 0, 5, 10, 1, 0},
+    {0x0165, 1492, 7, 0, 5, 8, 1, 0},
+    {0x0166, 1497, 7, 0, 5, 7, 1, 0},
+    {0x0167, 1502, 7, 0, 5, 7, 1, 0},
+    {0x0168, 1507, 7, 0, 5, 10, 1, 0},
+    {0x0169, 1514, 7, 0, 5, 8, 1, 0},
+    {0x016A, 1519, 7, 0, 5, 9, 1, 0},
+    {0x016B, 1525, 7, 0, 5, 7, 1, 0},
+    {0x016C, 1530, 7, 0, 5, 10, 1, 0},
+    {0x016D, 1537, 7, 0, 5, 8, 1, 0},
+    {0x016E, 1542, 7, 0, 5, 11, 1, 0},
+    {0x016F, 1549, 7, 0, 5, 9, 1, 0},
+    {0x0170, 1555, 7, 0, 5, 10, 1, 0},
+    {0x0171, 1562, 7, 0, 5, 8, 1, 0},
+    {0x0172, 1567, 7, 0, 5, 9, 1, -2},
+    {0x0173, 1573, 7, 0, 5, 8, 1, -3},
+    {0x0174, 1578, 7, 0, 5, 10, 1, 0},
+    {0x0175, 1585, 7, 0, 5, 8, 1, 0},
+    {0x0176, 1590, 7, 0, 5, 10, 1, 0},
+    {0x0177, 1597, 7, 0, 5, 11, 1, -3},
+    {0x0178, 1604, 7, 0, 5, 9, 1, 0},
+    {0x0179, 1610, 7, 0, 5, 10, 1, 0},
+    {0x017A, 1617, 7, 0, 5, 8, 1, 0},
+    {0x017B, 1622, 7, 0, 5, 9, 1, 0},
+    {0x017C, 1628, 7, 0, 5, 7, 1, 0},
+    {0x017D, 1633, 7, 0, 5, 10, 1, 0},
+    {0x017E, 1640, 7, 0, 5, 8, 1, 0},
+    {0x018F, 1645, 7, 0, 5, 7, 1, 0},
+    {0x01A0, 1650, 7, 0, 6, 8, 1, 0},
+    {0x01A1, 1656, 7, 0, 5, 6, 1, 0},
+    {0x01AF, 1660, 7, 0, 6, 8, 1, 0},
+    {0x01B0, 1666, 7, 0, 6, 6, 1, 0},
+    {0x01CD, 1671, 7, 0, 5, 10, 1, 0},
+    {0x01CE, 1678, 7, 0, 5, 8, 1, 0},
+    {0x01CF, 1683, 7, 0, 4, 10, 1, 0},
+    {0x01D0, 1688, 7, 0, 5, 8, 1, 0},
+    {0x01D1, 1693, 7, 0, 5, 10, 1, 0},
+    {0x01D2, 1700, 7, 0, 5, 8, 1, 0},
+    {0x01D3, 1705, 7, 0, 5, 10, 1, 0},
+    {0x01D4, 1712, 7, 0, 5, 8, 1, 0},
+    {0x01D5, 1717, 7, 0, 5, 11, 1, 0},
+    {0x01D6, 1724, 7, 0, 5, 9, 1, 0},
+    {0x01D7, 1730, 7, 0, 5, 11, 1, 0},
+    {0x01D8, 1737, 7, 0, 5, 10, 1, 0},
+    {0x01D9, 1744, 7, 0, 5, 12, 1, 0},
+    {0x01DA, 1752, 7, 0, 5, 10, 1, 0},
+    {0x01DB, 1759, 7, 0, 5, 11, 1, 0},
+    {0x01DC, 1766, 7, 0, 5, 10, 1, 0},
+    {0x01E6, 1773, 7, 0, 5, 10, 1, 0},
+    {0x01E7, 1780, 7, 0, 5, 11, 1, -3},
+    {0x01EA, 1787, 7, 0, 5, 9, 1, -2},
+    {0x01EB, 1793, 7, 0, 5, 7, 1, -2},
+    {0x01F0, 1798, 7, 0, 5, 11, 1, -3},
+    {0x01F8, 1805, 7, 0, 5, 10, 1, 0},
+    {0x01F9, 1812, 7, 0, 5, 8, 1, 0},
+    {0x0218, 1817, 7, 0, 5, 11, 1, -4},
+    {0x0219, 1824, 7, 0, 5, 9, 1, -4},
+    {0x021A, 1830, 7, 0, 5, 11, 1, -4},
+    {0x021B, 1837, 7, 0, 5, 11, 1, -4},
+    {0x0226, 1844, 7, 0, 5, 9, 1, 0},
+    {0x0227, 1850, 7, 0, 5, 7, 1, 0},
+    {0x022E, 1855, 7, 0, 5, 9, 1, 0},
+    {0x022F, 1861, 7, 0, 5, 7, 1, 0},
+    {0x0232, 1866, 7, 0, 5, 9, 1, 0},
+    {0x0233, 1872, 7, 0, 5, 10, 1, -3},
+    {0x0237, 1879, 7, 0, 4, 8, 1, -3},
+    {0x0259, 1883, 7, 0, 5, 5, 1, 0},
+    {0x02B9, 1887, 7, 0, 1, 3, 3, 5},
+    {0x02BA, 1888, 7, 0, 4, 3, 1, 5},
+    {0x02BB, 1890, 7, 0, 3, 3, 2, 5},
+    {0x02BC, 1892, 7, 0, 3, 3, 2, 5},
+    {0x02BE, 1894, 7, 0, 3, 4, 2, 4},
+    {0x02BF, 1896, 7, 0, 3, 4, 2, 4},
+    {0x02C6, 1898, 7, 0, 4, 2, 1, 6},
+    {0x02C7, 1899, 7, 0, 4, 2, 1, 6},
+    {0x02C8, 1900, 7, 0, 1, 4, 3, 4},
+    {0x02CC, 1901, 7, 0, 1, 4, 3, -2},
+    {0x02CD, 1902, 7, 0, 3, 1, 2, -2},
+    {0x02D8, 1903, 7, 0, 4, 2, 1, 6},
+    {0x02D9, 1904, 7, 0, 1, 1, 3, 6},
+    {0x02DA, 1905, 7, 0, 3, 3, 2, 6},
+    {0x02DB, 1907, 7, 0, 2, 3, 2, -3},
+    {0x02DC, 1908, 7, 0, 5, 2, 1, 6},
+    {0x02DD, 1910, 7, 0, 5, 2, 1, 6},
+    {0x0300, 1912, 0, 0, 3, 2, -2, 6},
+    {0x0301, 1913, 0, 0, 3, 2, -1, 6},
+    {0x0302, 1914, 0, 0, 4, 2, -2, 6},
+    {0x0303, 1915, 0, 0, 4, 2, -2, 6},
+    {0x0304, 1916, 0, 0, 4, 1, -2, 6},
+    {0x0306, 1917, 0, 0, 4, 2, -2, 6},
+    {0x0307, 1918, 0, 0, 2, 1, -1, 6},
+    {0x0308, 1919, 0, 0, 4, 1, -2, 6},
+    {0x0309, 1920, 0, 0, 2, 3, -1, 6},
+    {0x030A, 1921, 0, 0, 4, 3, -2, 6},
+    {0x030B, 1923, 0, 0, 4, 2, -2, 6},
+    {0x030C, 1924, 0, 0, 4, 2, -2, 6},
+    {0x0312, 1925, 0, 0, 2, 3, -1, 6},
+    {0x0315, 1926, 0, 0, 1, 2, 0, 6},
+    {0x0323, 1927, 0, 0, 2, 1, -1, -2},
+    {0x0324, 1928, 0, 0, 4, 1, -2, -2},
+    {0x0326, 1929, 0, 0, 2, 3, -1, -4},
+    {0x0327, 1930, 0, 0, 3, 3, -1, -3},
+    {0x0328, 1932, 0, 0, 2, 3, -1, -3},
+    {0x032D, 1933, 0, 0, 4, 2, -2, -3},
+    {0x032E, 1934, 0, 0, 4, 2, -2, -3},
+    {0x0331, 1935, 0, 0, 4, 1, -2, -2},
+    {0x0E3F, 1936, 7, 0, 5, 11, 1, -2},
+    {0x1E06, 1943, 7, 0, 5, 9, 1, -2},
+    {0x1E07, 1949, 7, 0, 5, 10, 1, -2},
+    {0x1E0C, 1956, 7, 0, 5, 9, 1, -2},
+    {0x1E0D, 1962, 7, 0, 5, 10, 1, -2},
+    {0x1E0E, 1969, 7, 0, 5, 9, 1, -2},
+    {0x1E0F, 1975, 7, 0, 5, 10, 1, -2},
+    {0x1E12, 1982, 7, 0, 5, 10, 1, -3},
+    {0x1E13, 1989, 7, 0, 5, 11, 1, -3},
+    {0x1E20, 1996, 7, 0, 5, 9, 1, 0},
+    {0x1E21, 2002, 7, 0, 5, 10, 1, -3},
+    {0x1E24, 2009, 7, 0, 5, 9, 1, -2},
+    {0x1E25, 2015, 7, 0, 5, 10, 1, -2},
+    {0x1E28, 2022, 7, 0, 6, 10, 0, -3},
+    {0x1E29, 2030, 7, 0, 6, 11, 0, -3},
+    {0x1E2A, 2039, 7, 0, 5, 10, 1, -3},
+    {0x1E2B, 2046, 7, 0, 5, 11, 1, -3},
+    {0x1E32, 2053, 7, 0, 5, 9, 1, -2},
+    {0x1E33, 2059, 7, 0, 5, 10, 1, -2},
+    {0x1E34, 2066, 7, 0, 5, 9, 1, -2},
+    {0x1E35, 2072, 7, 0, 5, 10, 1, -2},
+    {0x1E36, 2079, 7, 0, 5, 9, 1, -2},
+    {0x1E37, 2085, 7, 0, 5, 10, 1, -2},
+    {0x1E38, 2092, 7, 0, 6, 11, 0, -2},
+    {0x1E39, 2101, 7, 0, 5, 12, 1, -2},
+    {0x1E3A, 2109, 7, 0, 5, 9, 1, -2},
+    {0x1E3B, 2115, 7, 0, 5, 10, 1, -2},
+    {0x1E3C, 2122, 7, 0, 5, 10, 1, -3},
+    {0x1E3D, 2129, 7, 0, 5, 11, 1, -3},
+    {0x1E3E, 2136, 7, 0, 5, 10, 1, 0},
+    {0x1E3F, 2143, 7, 0, 5, 8, 1, 0},
+    {0x1E40, 2148, 7, 0, 5, 9, 1, 0},
+    {0x1E41, 2154, 7, 0, 5, 7, 1, 0},
+    {0x1E42, 2159, 7, 0, 5, 9, 1, -2},
+    {0x1E43, 2165, 7, 0, 5, 7, 1, -2},
+    {0x1E44, 2170, 7, 0, 5, 9, 1, 0},
+    {0x1E45, 2176, 7, 0, 5, 7, 1, 0},
+    {0x1E46, 2181, 7, 0, 5, 9, 1, -2},
+    {0x1E47, 2187, 7, 0, 5, 7, 1, -2},
+    {0x1E48, 2192, 7, 0, 5, 9, 1, -2},
+    {0x1E49, 2198, 7, 0, 5, 7, 1, -2},
+    {0x1E4A, 2203, 7, 0, 5, 10, 1, -3},
+    {0x1E4B, 2210, 7, 0, 5, 8, 1, -3},
+    {0x1E58, 2215, 7, 0, 5, 9, 1, 0},
+    {0x1E59, 2221, 7, 0, 5, 7, 1, 0},
+    {0x1E5A, 2226, 7, 0, 5, 9, 1, -2},
+    {0x1E5B, 2232, 7, 0, 5, 7, 1, -2},
+    {0x1E5C, 2237, 7, 0, 5, 11, 1, -2},
+    {0x1E5D, 2244, 7, 0, 5, 9, 1, -2},
+    {0x1E5E, 2250, 7, 0, 5, 9, 1, -2},
+    {0x1E5F, 2256, 7, 0, 5, 7, 1, -2},
+    {0x1E62, 2261, 7, 0, 5, 9, 1, -2},
+    {0x1E63, 2267, 7, 0, 5, 7, 1, -2},
+    {0x1E6C, 2272, 7, 0, 5, 9, 1, -2},
+    {0x1E6D, 2278, 7, 0, 5, 9, 1, -2},
+    {0x1E6E, 2284, 7, 0, 5, 9, 1, -2},
+    {0x1E6F, 2290, 7, 0, 5, 9, 1, -2},
+    {0x1E70, 2296, 7, 0, 5, 10, 1, -3},
+    {0x1E71, 2303, 7, 0, 5, 10, 1, -3},
+    {0x1E7E, 2310, 7, 0, 5, 9, 1, -2},
+    {0x1E7F, 2316, 7, 0, 5, 7, 1, -2},
+    {0x1E80, 2321, 7, 0, 5, 10, 1, 0},
+    {0x1E81, 2328, 7, 0, 5, 8, 1, 0},
+    {0x1E82, 2333, 7, 0, 5, 10, 1, 0},
+    {0x1E83, 2340, 7, 0, 5, 8, 1, 0},
+    {0x1E84, 2345, 7, 0, 5, 9, 1, 0},
+    {0x1E85, 2351, 7, 0, 5, 7, 1, 0},
+    {0x1E8C, 2356, 7, 0, 5, 9, 1, 0},
+    {0x1E8D, 2362, 7, 0, 5, 7, 1, 0},
+    {0x1E8E, 2367, 7, 0, 5, 9, 1, 0},
+    {0x1E8F, 2373, 7, 0, 5, 10, 1, -3},
+    {0x1E90, 2380, 7, 0, 5, 10, 1, 0},
+    {0x1E91, 2387, 7, 0, 5, 8, 1, 0},
+    {0x1E92, 2392, 7, 0, 5, 9, 1, -2},
+    {0x1E93, 2398, 7, 0, 5, 7, 1, -2},
+    {0x1E94, 2403, 7, 0, 5, 9, 1, -2},
+    {0x1E95, 2409, 7, 0, 5, 7, 1, -2},
+    {0x1E96, 2414, 7, 0, 5, 10, 1, -2},
+    {0x1E9E, 2421, 7, 0, 5, 7, 1, 0},
+    {0x1EA0, 2426, 7, 0, 5, 9, 1, -2},
+    {0x1EA1, 2432, 7, 0, 5, 7, 1, -2},
+    {0x1EA2, 2437, 7, 0, 5, 11, 1, 0},
+    {0x1EA3, 2444, 7, 0, 5, 9, 1, 0},
+    {0x1EA4, 2450, 7, 0, 5, 12, 1, 0},
+    {0x1EA5, 2458, 7, 0, 5, 10, 1, 0},
+    {0x1EA6, 2465, 7, 0, 5, 12, 1, 0},
+    {0x1EA7, 2473, 7, 0, 5, 10, 1, 0},
+    {0x1EA8, 2480, 7, 0, 5, 12, 1, 0},
+    {0x1EA9, 2488, 7, 0, 5, 10, 1, 0},
+    {0x1EAA, 2495, 7, 0, 5, 12, 1, 0},
+    {0x1EAB, 2503, 7, 0, 5, 10, 1, 0},
+    {0x1EAC, 2510, 7, 0, 5, 12, 1, -2},
+    {0x1EAD, 2518, 7, 0, 5, 10, 1, -2},
+    {0x1EAE, 2525, 7, 0, 5, 12, 1, 0},
+    {0x1EAF, 2533, 7, 0, 5, 10, 1, 0},
+    {0x1EB0, 2540, 7, 0, 5, 12, 1, 0},
+    {0x1EB1, 2548, 7, 0, 5, 10, 1, 0},
+    {0x1EB2, 2555, 7, 0, 5, 12, 1, 0},
+    {0x1EB3, 2563, 7, 0, 5, 10, 1, 0},
+    {0x1EB4, 2570, 7, 0, 5, 12, 1, 0},
+    {0x1EB5, 2578, 7, 0, 5, 11, 1, 0},
+    {0x1EB6, 2585, 7, 0, 5, 12, 1, -2},
+    {0x1EB7, 2593, 7, 0, 5, 10, 1, -2},
+    {0x1EB8, 2600, 7, 0, 5, 9, 1, -2},
+    {0x1EB9, 2606, 7, 0, 5, 7, 1, -2},
+    {0x1EBA, 2611, 7, 0, 5, 11, 1, 0},
+    {0x1EBB, 2618, 7, 0, 5, 9, 1, 0},
+    {0x1EBC, 2624, 7, 0, 5, 10, 1, 0},
+    {0x1EBD, 2631, 7, 0, 5, 8, 1, 0},
+    {0x1EBE, 2636, 7, 0, 6, 12, 1, 0},
+    {0x1EBF, 2645, 7, 0, 6, 10, 1, 0},
+    {0x1EC0, 2653, 7, 0, 5, 12, 1, 0},
+    {0x1EC1, 2661, 7, 0, 5, 10, 1, 0},
+    {0x1EC2, 2668, 7, 0, 5, 12, 1, 0},
+    {0x1EC3, 2676, 7, 0, 6, 10, 1, 0},
+    {0x1EC4, 2684, 7, 0, 5, 12, 1, 0},
+    {0x1EC5, 2692, 7, 0, 5, 10, 1, 0},
+    {0x1EC6, 2699, 7, 0, 5, 12, 1, -2},
+    {0x1EC7, 2707, 7, 0, 5, 10, 1, -2},
+    {0x1EC8, 2714, 7, 0, 3, 11, 2, 0},
+    {0x1EC9, 2719, 7, 0, 5, 9, 1, 0},
+    {0x1ECA, 2725, 7, 0, 3, 9, 2, -2},
+    {0x1ECB, 2729, 7, 0, 5, 10, 1, -2},
+    {0x1ECC, 2736, 7, 0, 5, 9, 1, -2},
+    {0x1ECD, 2742, 7, 0, 5, 7, 1, -2},
+    {0x1ECE, 2747, 7, 0, 5, 11, 1, 0},
+    {0x1ECF, 2754, 7, 0, 5, 9, 1, 0},
+    {0x1ED0, 2760, 7, 0, 5, 12, 1, 0},
+    {0x1ED1, 2768, 7, 0, 5, 10, 1, 0},
+    {0x1ED2, 2775, 7, 0, 5, 12, 1, 0},
+    {0x1ED3, 2783, 7, 0, 5, 10, 1, 0},
+    {0x1ED4, 2790, 7, 0, 5, 12, 1, 0},
+    {0x1ED5, 2798, 7, 0, 5, 10, 1, 0},
+    {0x1ED6, 2805, 7, 0, 5, 12, 1, 0},
+    {0x1ED7, 2813, 7, 0, 5, 10, 1, 0},
+    {0x1ED8, 2820, 7, 0, 5, 12, 1, -2},
+    {0x1ED9, 2828, 7, 0, 5, 10, 1, -2},
+    {0x1EDA, 2835, 7, 0, 6, 10, 1, 0},
+    {0x1EDB, 2843, 7, 0, 5, 8, 1, 0},
+    {0x1EDC, 2848, 7, 0, 6, 10, 1, 0},
+    {0x1EDD, 2856, 7, 0, 5, 8, 1, 0},
+    {0x1EDE, 2861, 7, 0, 6, 11, 1, 0},
+    {0x1EDF, 2870, 7, 0, 5, 9, 1, 0},
+    {0x1EE0, 2876, 7, 0, 6, 10, 1, 0},
+    {0x1EE1, 2884, 7, 0, 5, 8, 1, 0},
+    {0x1EE2, 2889, 7, 0, 6, 10, 1, -2},
+    {0x1EE3, 2897, 7, 0, 5, 8, 1, -2},
+    {0x1EE4, 2902, 7, 0, 5, 9, 1, -2},
+    {0x1EE5, 2908, 7, 0, 5, 7, 1, -2},
+    {0x1EE6, 2913, 7, 0, 5, 11, 1, 0},
+    {0x1EE7, 2920, 7, 0, 5, 9, 1, 0},
+    {0x1EE8, 2926, 7, 0, 6, 10, 1, 0},
+    {0x1EE9, 2934, 7, 0, 6, 8, 1, 0},
+    {0x1EEA, 2940, 7, 0, 6, 10, 1, 0},
+    {0x1EEB, 2948, 7, 0, 6, 8, 1, 0},
+    {0x1EEC, 2954, 7, 0, 6, 11, 1, 0},
+    {0x1EED, 2963, 7, 0, 6, 9, 1, 0},
+    {0x1EEE, 2970, 7, 0, 6, 10, 1, 0},
+    {0x1EEF, 2978, 7, 0, 6, 8, 1, 0},
+    {0x1EF0, 2984, 7, 0, 6, 10, 1, -2},
+    {0x1EF1, 2992, 7, 0, 6, 8, 1, -2},
+    {0x1EF2, 2998, 7, 0, 5, 10, 1, 0},
+    {0x1EF3, 3005, 7, 0, 5, 11, 1, -3},
+    {0x1EF4, 3012, 7, 0, 5, 9, 1, -2},
+    {0x1EF5, 3018, 7, 0, 5, 8, 1, -3},
+    {0x1EF6, 3023, 7, 0, 5, 11, 1, 0},
+    {0x1EF7, 3030, 7, 0, 5, 12, 1, -3},
+    {0x1EF8, 3038, 7, 0, 5, 10, 1, 0},
+    {0x1EF9, 3045, 7, 0, 5, 11, 1, -3},
+    {0x2011, 3052, 7, 0, 4, 1, 1, 3},
+    {0x2013, 3053, 7, 0, 5, 1, 1, 3},
+    {0x2014, 3054, 7, 0, 5, 1, 1, 3},
+    {0x2015, 3055, 7, 0, 5, 1, 1, 3},
+    {0x2018, 3056, 7, 0, 3, 3, 2, 5},
+    {0x2019, 3058, 7, 0, 3, 3, 2, 5},
+    {0x201A, 3060, 7, 0, 3, 3, 2, -1},
+    {0x201C, 3062, 7, 0, 5, 3, 1, 5},
+    {0x201D, 3064, 7, 0, 5, 3, 1, 5},
+    {0x201E, 3066, 7, 0, 5, 3, 1, -1},
+    {0x2020, 3068, 7, 0, 5, 8, 1, 0},
+    {0x2021, 3073, 7, 0, 5, 8, 1, 0},
+    {0x2022, 3078, 7, 0, 3, 3, 2, 2},
+    {0x2025, 3080, 7, 0, 5, 2, 1, 0},
+    {0x2026, 3082, 7, 0, 6, 2, 0, 0},
+    {0x2039, 3084, 7, 0, 3, 5, 2, 0},
+    {0x203A, 3086, 7, 0, 3, 5, 2, 0},
+    {0x2044, 3088, 7, 0, 6, 7, 0, 0},
+    {0x2070, 3094, 7, 0, 3, 4, 2, 4},
+    {0x2074, 3096, 7, 0, 3, 4, 2, 4},
+    {0x2075, 3098, 7, 0, 3, 4, 2, 4},
+    {0x2076, 3100, 7, 0, 3, 4, 2, 4},
+    {0x2077, 3102, 7, 0, 3, 4, 2, 4},
+    {0x2078, 3104, 7, 0, 3, 4, 2, 4},
+    {0x2079, 3106, 7, 0, 3, 4, 2, 4},
+    {0x2080, 3108, 7, 0, 3, 4, 2, -3},
+    {0x2081, 3110, 7, 0, 3, 4, 2, -3},
+    {0x2082, 3112, 7, 0, 3, 4, 2, -3},
+    {0x2083, 3114, 7, 0, 3, 4, 2, -3},
+    {0x2084, 3116, 7, 0, 3, 4, 2, -3},
+    {0x2085, 3118, 7, 0, 3, 4, 2, -3},
+    {0x2086, 3120, 7, 0, 3, 4, 2, -3},
+    {0x2087, 3122, 7, 0, 3, 4, 2, -3},
+    {0x2088, 3124, 7, 0, 3, 4, 2, -3},
+    {0x2089, 3126, 7, 0, 3, 4, 2, -3},
+    {0x20A6, 3128, 7, 0, 7, 7, 0, 0},
+    {0x20A9, 3135, 7, 0, 7, 7, 0, 0},
+    {0x20AB, 3142, 7, 0, 6, 9, 1, -2},
+    {0x20AC, 3149, 7, 0, 5, 7, 1, 0},
+    {0x20B1, 3154, 7, 0, 7, 7, 0, 0},
+    {0x20B9, 3161, 7, 0, 5, 7, 1, 0},
+    {0x20BA, 3166, 7, 0, 6, 7, 0, 0},
+    {0x20BD, 3172, 7, 0, 6, 7, 0, 0},
+    {0x2117, 3178, 7, 0, 5, 9, 1, -1},
+    {0x2120, 3184, 7, 0, 6, 4, 0, 4},
+    {0x2122, 3187, 7, 0, 6, 3, 0, 5},
+    {0x2153, 3190, 7, 0, 7, 10, 0, -3},
+    {0x2154, 3199, 7, 0, 7, 10, 0, -3},
+    {0x2155, 3208, 7, 0, 7, 10, 0, -3},
+    {0x2156, 3217, 7, 0, 7, 10, 0, -3},
+    {0x2157, 3226, 7, 0, 7, 10, 0, -3},
+    {0x2158, 3235, 7, 0, 7, 10, 0, -3},
+    {0x2159, 3244, 7, 0, 7, 10, 0, -3},
+    {0x215A, 3253, 7, 0, 7, 10, 0, -3},
+    {0x215B, 3262, 7, 0, 7, 10, 0, -3},
+    {0x215C, 3271, 7, 0, 7, 10, 0, -3},
+    {0x215D, 3280, 7, 0, 7, 10, 0, -3},
+    {0x215E, 3289, 7, 0, 7, 10, 0, -3},
+    {0x2212, 3298, 7, 0, 5, 1, 1, 3},
+    {0x2248, 3299, 7, 0, 5, 5, 1, 1},
+    {0x2260, 3303, 7, 0, 5, 5, 1, 1},
+    {0x2264, 3307, 7, 0, 5, 7, 1, 0},
+    {0x2265, 3312, 7, 0, 5, 7, 1, 0},
+    {0xA788, 3317, 7, 0, 4, 2, 1, -3},
+};
+
+static constexpr uint8_t intel_one_mono_8_pt_bitmaps[3319] = "\xf9\x99\x99\x9f\x55\x43\xdd\x50\x24\xa7\xca\xfd"
+                                                             "\x25\x00\x21\x1f\x4a\x38\xa5\xf1\x08\x66\x69\x1b"
+                                                             "\x35\x54\xc0\x72\x10\xd9\x4b\xa0\xe0\x19\x10\x88"
+                                                             "\x42\x08\x41\x06\x86\x21\x11\x11\x26\x80\x25\x5c"
+                                                             "\xa9\x00\x21\x3e\x42\x00\x78\xf0\x70\x08\x44\x42"
+                                                             "\x21\x10\x80\x74\x67\x5c\xc5\xc0\x27\x08\x42\x13"
+                                                             "\xe0\x74\x42\x22\x23\xe0\xf8\x88\xe0\x87\xc0\x31"
+                                                             "\x95\x2f\x88\x40\xf4\x3c\x10\x8f\x80\x33\x31\xe8"
+                                                             "\xc5\xc0\xf8\x44\x22\x31\x00\x74\x62\xe8\xc5\xc0"
+                                                             "\x74\x63\xf1\x19\x80\xd1\xc0\x50\x78\x1b\x20\xc1"
+                                                             "\x80\xf8\x3e\x83\x82\xe8\x00\xf0\x42\x64\x00\x0c"
+                                                             "\x74\x6f\x9c\xe6\xf0\x70\x22\x94\xaf\x46\x20\xf4"
+                                                             "\x63\xe8\xc7\xe0\x74\x61\x08\x45\xc0\xf4\xe3\x18"
+                                                             "\xcf\x80\xfc\x21\xe8\x43\xe0\xfc\x21\xe8\x42\x00"
+                                                             "\x7c\x21\x78\xc5\xe0\x8c\x63\xf8\xc6\x20\xe9\x24"
+                                                             "\xb8\x08\x42\x10\xc5\xc0\x8c\xa9\x8a\x4a\x20\x84"
+                                                             "\x21\x08\x43\xe0\x8e\xf7\x5a\xc6\x20\x8e\x73\x5a"
+                                                             "\xce\x60\x74\x63\x18\xc5\xc0\xf4\x63\x1f\x42\x00"
+                                                             "\x72\x28\xa2\xaa\x67\x02\x04\xf4\x63\xea\x4a\x20"
+                                                             "\x7c\x20\xe0\x87\xc0\xf9\x08\x42\x10\x80\x8c\x63"
+                                                             "\x18\xc5\xc0\x8c\x62\xa5\x28\x80\x8d\x6b\x5d\xeb"
+                                                             "\x40\x8a\x98\x45\x4a\x20\x8c\x94\x42\x10\x80\xf8"
+                                                             "\x8c\x44\x43\xe0\xf8\x88\x88\x88\x8f\x84\x10\x82"
+                                                             "\x10\x42\x08\xf1\x11\x11\x11\x1f\x22\xa5\x10\xf8"
+                                                             "\x90\xf0\xbd\x2e\x80\x84\x21\xe8\xc6\x3e\x74\x21"
+                                                             "\x07\x80\x08\x42\xf8\xc6\x2f\x74\x7f\x07\x00\x39"
+                                                             "\x09\xf2\x10\x84\x7c\x63\x1f\x84\x3e\x84\x21\x6c"
+                                                             "\xc6\x31\x20\x01\xc2\x10\x9f\x30\x0f\x11\x11\x11"
+                                                             "\xe0\x84\x21\x2a\x62\x93\xe1\x08\x42\x10\x87\xfd"
+                                                             "\x6b\x5a\x80\xb6\x63\x18\x80\x74\x63\x17\x00\xf4"
+                                                             "\x63\x1f\x42\x10\x7c\x63\x3e\x84\x21\xdb\x10\x8e"
+                                                             "\x00\x74\x1c\x1f\x00\x42\x3e\x84\x20\xe0\x8c\x63"
+                                                             "\x3e\x80\x8c\x54\xa2\x00\x8d\x6b\xbd\x00\x92\x88"
+                                                             "\xa8\x80\x8c\x54\xa6\x10\x98\xf8\x88\x8f\x80\x3a"
+                                                             "\x08\x66\x41\x86\x22\x0e\xff\x80\xe0\x88\x87\x05"
+                                                             "\xc8\x20\xb8\xcd\xc0\x9f\x22\x7a\xaa\x72\x20\x74"
+                                                             "\x51\xf4\x43\xe0\x8c\x95\xf2\x7c\x80\x7c\x10\xe8"
+                                                             "\xc7\x46\x0f\x80\xd0\x74\x6b\x9c\xe7\xb1\x70\x73"
+                                                             "\xa5\xf0\x7c\x4e\xa9\xa4\x80\x77\xfb\xd8\xb8\xe0"
+                                                             "\x74\x62\xe0\x21\x3e\x42\x03\xe0\xe5\x70\xe8\xf0"
+                                                             "\x38\x8c\x63\x3e\xc2\x10\xff\x7a\xd0\x84\x20\x70"
+                                                             "\x47\x80\x49\x70\x79\x97\x0f\xa6\x92\xaa\x00\x40"
+                                                             "\x81\x0f\x21\x84\x12\x4a\x3c\x08\x40\x81\x0f\x21"
+                                                             "\x84\x17\x42\x08\x38\xe0\xc0\x4f\x21\x84\x12\x4a"
+                                                             "\x3c\x08\x30\x00\x26\x42\x3e\xc1\x00\x45\x29\x5e"
+                                                             "\x8c\x40\x13\x00\x45\x29\x5e\x8c\x40\x64\x80\x45"
+                                                             "\x29\x5e\x8c\x40\x4d\x80\x45\x29\x5e\x8c\x40\xd0"
+                                                             "\x08\xa5\x2b\xd1\x88\x22\x88\xa5\x2b\xd1\x88\x3c"
+                                                             "\xc5\x17\x72\x49\xc0\x74\x61\x08\x45\xc4\x13\x80"
+                                                             "\x41\x81\xf8\x43\xd0\x87\xc0\x11\x01\xf8\x43\xd0"
+                                                             "\x87\xc0\x32\x41\xf8\x43\xd0\x87\xc0\x58\x3f\x08"
+                                                             "\x7a\x10\xf8\x88\x74\x92\x5c\x38\x74\x92\x5c\x69"
+                                                             "\x07\x22\x22\x27\xd0\x72\x22\x22\x70\x79\x14\x7d"
+                                                             "\x45\x37\x00\x4d\x81\x1c\xe6\xb5\x9c\xc0\x41\x00"
+                                                             "\xe8\xc6\x31\x8b\x80\x13\x00\xe8\xc6\x31\x8b\x80"
+                                                             "\x64\x80\xe8\xc6\x31\x8b\x80\x4d\x80\xe8\xc6\x31"
+                                                             "\x8b\x80\xd0\x1d\x18\xc6\x31\x70\x8a\x88\xa8\x80"
+                                                             "\x0b\xe7\x3a\xe6\x3e\x80\x41\x01\x18\xc6\x31\x8b"
+                                                             "\x80\x13\x01\x18\xc6\x31\x8b\x80\x64\x81\x18\xc6"
+                                                             "\x31\x8b\x80\xd0\x23\x18\xc6\x31\x70\x13\x01\x19"
+                                                             "\x28\x84\x21\x00\x84\x3f\x1f\xc2\x00\x74\x63\x29"
+                                                             "\x46\x33\x41\x01\xe1\x7a\x5d\x13\x01\xe1\x7a\x5d"
+                                                             "\x64\x81\xe1\x7a\x5d\x4d\x81\xe1\x7a\x5d\xd0\x3c"
+                                                             "\x2f\x4b\xa0\x72\x9c\x0f\x0b\xd2\xe8\x6c\x57\xe4"
+                                                             "\xec\x74\x21\x07\x90\x4e\x41\x00\xe8\xfe\x0e\x11"
+                                                             "\x00\xe8\xfe\x0e\x22\x80\xe8\xfe\x0e\x50\x1d\x1f"
+                                                             "\xc1\xc0\x41\x01\xc2\x10\x9f\x11\x01\xc2\x10\x9f"
+                                                             "\x22\x81\xc2\x10\x9f\x50\x38\x42\x13\xe0\x71\x82"
+                                                             "\xf8\xc6\x2e\x4d\x81\x6c\xc6\x31\x41\x00\xe8\xc6"
+                                                             "\x2e\x13\x00\xe8\xc6\x2e\x64\x80\xe8\xc6\x2e\x4d"
+                                                             "\x80\xe8\xc6\x2e\xd0\x1d\x18\xc5\xc0\x20\x3e\x02"
+                                                             "\x00\x0b\xa7\x5c\xfa\x00\x41\x01\x18\xc6\x7d\x11"
+                                                             "\x01\x18\xc6\x7d\x26\x81\x18\xc6\x7d\xd0\x23\x18"
+                                                             "\xcf\xa0\x11\x01\x18\xa9\x4c\x21\x30\x84\x21\xe8"
+                                                             "\xc6\x3e\x84\x20\x50\x23\x15\x29\x84\x26\x00\x70"
+                                                             "\x08\xa5\x2b\xd1\x88\x70\x3c\x2f\x4b\xa0\x93\x80"
+                                                             "\x45\x29\x5e\x8c\x40\x93\x81\xe1\x7a\x5d\x21\x45"
+                                                             "\x14\xf2\x28\x82\x10\x30\xf0\xbd\x2e\x88\x43\x19"
+                                                             "\x00\xe8\xc2\x10\x8b\x80\x11\x00\xe8\x42\x0f\x32"
+                                                             "\x40\xe8\xc2\x10\x8b\x80\x22\xc0\xe8\x42\x0f\x20"
+                                                             "\x1d\x18\x42\x11\x70\x20\x1d\x08\x41\xe0\x49\x80"
+                                                             "\xe8\xc2\x10\x8b\x80\x59\x00\xe8\x42\x0f\x93\x01"
+                                                             "\xe9\xc6\x31\x9f\x00\x02\x14\x20\x47\x91\x22\x44"
+                                                             "\x78\x79\x14\x7d\x45\x37\x00\x09\xc2\xf8\xc6\x7d"
+                                                             "\x70\x3f\x08\x7a\x10\xf8\x70\x1d\x1f\xc1\xc0\x4b"
+                                                             "\x81\xf8\x43\xd0\x87\xc0\x8b\x80\xe8\xfe\x0e\x20"
+                                                             "\x3f\x08\x7a\x10\xf8\x20\x1d\x1f\xc1\xc0\xfc\x21"
+                                                             "\xe8\x43\xe2\x10\xc0\x74\x7f\x07\x08\x86\x49\x81"
+                                                             "\xf8\x43\xd0\x87\xc0\x51\x00\xe8\xfe\x0e\x32\x40"
+                                                             "\xf8\x42\xf1\x8b\xc0\x64\x80\xf8\xc6\x3f\x08\x7c"
+                                                             "\x4b\x80\xf8\x42\xf1\x8b\xc0\x93\x80\xf8\xc6\x3f"
+                                                             "\x08\x7c\x30\x1f\x08\x5e\x31\x78\x20\x1f\x18\xc7"
+                                                             "\xe1\x0f\x80\x7c\x21\x78\xc5\xe0\x30\x88\x22\x0c"
+                                                             "\x07\xc6\x31\xf8\x43\xe0\x64\x81\x18\xc7\xf1\x8c"
+                                                             "\x40\x42\x80\x10\x41\x05\x99\x45\x14\x40\x47\xf4"
+                                                             "\x5f\x45\x14\x40\x43\xc4\x16\x65\x14\x51\x4d\x80"
+                                                             "\xe2\x10\x84\x23\x80\x4d\x81\xc2\x10\x9f\xe3\xa4"
+                                                             "\x92\xe0\x70\x38\x42\x13\xe0\x97\x07\x22\x22\x27"
+                                                             "\x8b\x81\xc2\x10\x9f\xe9\x24\xba\x98\x20\x01\xc2"
+                                                             "\x10\x9f\x22\x18\x43\xa4\x92\xe0\xe1\x08\x4f\x80"
+                                                             "\x18\x90\x02\x08\x20\x82\x89\xc0\x32\x41\xe1\x08"
+                                                             "\x42\x10\xb8\x8c\xa9\x8a\x4a\x20\x60\x88\x84\x21"
+                                                             "\x2a\x62\x93\x03\x04\xc0\x44\x01\x08\x42\x10\x87"
+                                                             "\xc0\x32\x01\xc2\x10\x84\x21\x0e\x84\x21\x08\x43"
+                                                             "\xe0\x60\x88\xe1\x08\x42\x10\x87\x03\x04\xc0\x94"
+                                                             "\xa1\x08\x43\xe0\x0f\x48\x42\x10\x84\x38\x84\x27"
+                                                             "\x38\x43\xe0\xe0\x82\x09\x24\x82\x0e\x41\x05\x18"
+                                                             "\xc1\x07\xc0\xe1\x08\x6e\x10\x87\x13\x01\x1c\xe6"
+                                                             "\xb5\x9c\xc0\x13\x01\x6c\xc6\x31\x8e\x73\x5a\xce"
+                                                             "\x60\x60\x98\xb6\x63\x18\x81\x82\x60\xd1\x01\x1c"
+                                                             "\xe6\xb5\x9c\xc0\x93\x01\x6c\xc6\x31\x8e\x73\x5a"
+                                                             "\xce\x61\x0b\x80\xb6\x63\x18\x84\x2e\x70\x1d\x18"
+                                                             "\xc6\x31\x70\x70\x1d\x18\xc5\xc0\x93\x80\xe8\xc6"
+                                                             "\x31\x8b\x80\x93\x80\xe8\xc6\x2e\x6a\x80\xe8\xc6"
+                                                             "\x31\x8b\x80\x4c\x80\xe8\xc6\x2e\x3d\x49\x27\x91"
+                                                             "\x47\xc0\x6e\x59\xe4\x6c\x11\x01\xe8\xc7\xd4\x94"
+                                                             "\x40\x13\x01\xb6\x21\x1c\xf4\x63\xea\x4a\x20\x60"
+                                                             "\x98\xdb\x10\x8e\x03\x04\xc0\x59\x01\xe8\xc7\xd4"
+                                                             "\x94\x40\x93\x01\xb6\x21\x1c\x11\x00\xf8\x41\xc1"
+                                                             "\x0f\x80\x11\x00\xe8\x38\x3e\x26\x80\xf8\x41\xc1"
+                                                             "\x0f\x80\x22\x80\xe8\x38\x3e\x7c\x20\xe0\x87\xc4"
+                                                             "\x13\x80\x74\x1c\x1f\x10\x4e\xd1\x00\xf8\x41\xc1"
+                                                             "\x0f\x80\x51\x00\xe8\x38\x3e\xf9\x08\x42\x10\x84"
+                                                             "\x13\x80\x42\x3e\x84\x20\xe4\x13\x80\x93\x01\xf2"
+                                                             "\x10\x84\x21\x00\x0a\x91\xf4\x21\x07\xf9\x09\xe2"
+                                                             "\x10\x80\x42\x3e\x8f\x20\xe0\x4d\x81\x18\xc6\x31"
+                                                             "\x8b\x80\x4d\x81\x18\xc6\x7d\x70\x23\x18\xc6\x31"
+                                                             "\x70\x70\x23\x18\xcf\xa0\x93\x81\x18\xc6\x31\x8b"
+                                                             "\x80\x93\x81\x18\xc6\x7d\x72\x9c\x08\xc6\x31\x8c"
+                                                             "\x5c\x72\x9c\x08\xc6\x33\xe8\x6a\x81\x18\xc6\x31"
+                                                             "\x8b\x80\x4a\x81\x18\xc6\x7d\x8c\x63\x18\xc5\xc4"
+                                                             "\x60\x8c\x63\x3e\x88\x43\x64\x81\x1a\xd6\xbb\xd6"
+                                                             "\x80\x64\x81\x1a\xd7\x7a\x64\x81\x19\x28\x84\x21"
+                                                             "\x00\x26\x81\x18\xa9\x4c\x21\x30\xd0\x23\x25\x10"
+                                                             "\x84\x20\x13\x01\xf1\x18\x88\x87\xc0\x11\x01\xf1"
+                                                             "\x11\x1f\x20\x3e\x23\x11\x10\xf8\x20\x3e\x22\x23"
+                                                             "\xe0\xd1\x01\xf1\x18\x88\x87\xc0\x51\x01\xf1\x11"
+                                                             "\x1f\x70\x43\xf8\xc5\xc0\x05\xe8\xa2\x8a\x28\x9c"
+                                                             "\x0b\xe3\x18\xb8\x06\x38\xa2\x8a\x28\x9c\x06\x28"
+                                                             "\xa2\x9b\xa0\x93\x00\x45\x29\x5e\x8c\x40\x93\x01"
+                                                             "\xe1\x7a\x5d\x96\x07\x22\x22\x27\x51\x01\xc2\x10"
+                                                             "\x9f\x93\x00\xe8\xc6\x31\x8b\x80\x93\x00\xe8\xc6"
+                                                             "\x2e\x93\x01\x18\xc6\x31\x8b\x80\xd1\x01\x18\xc6"
+                                                             "\x7d\x70\x34\x08\xc6\x31\x8c\x5c\x70\x14\x08\xc6"
+                                                             "\x33\xe8\x19\x34\x08\xc6\x31\x8c\x5c\x13\x00\xa0"
+                                                             "\x46\x31\x9f\x40\x51\x01\xa0\x46\x31\x8c\x62\xe0"
+                                                             "\x51\x00\xa0\x46\x31\x9f\x40\xc1\x34\x08\xc6\x31"
+                                                             "\x8c\x5c\x41\x00\xa0\x46\x31\x9f\x40\x49\x80\xf8"
+                                                             "\x42\xf1\x8b\xc0\x93\x00\xf8\xc6\x3f\x08\x7c\x74"
+                                                             "\x63\x18\xc5\xc8\x60\x74\x63\x17\x21\x80\x49\x81"
+                                                             "\xe1\x08\x42\x10\xb8\x41\x01\x1c\xe6\xb5\x9c\xc0"
+                                                             "\x41\x01\x6c\xc6\x31\x7c\x20\xe0\x87\xc0\x60\x98"
+                                                             "\x74\x1c\x1f\x01\x82\x60\xf9\x08\x42\x10\x80\x60"
+                                                             "\x98\x42\x3e\x84\x20\xe0\x60\x88\x20\x08\xa5\x2b"
+                                                             "\xd1\x88\x20\x3c\x2f\x4b\xa0\x20\x1d\x18\xc6\x31"
+                                                             "\x70\x20\x1d\x18\xc5\xc0\x70\x23\x25\x10\x84\x20"
+                                                             "\x70\x23\x15\x29\x84\x26\x00\xf1\x11\x11\x1e\x70"
+                                                             "\x7f\x17\x00\xe0\xdd\x50\x6b\x00\x6a\x00\xc4\xe0"
+                                                             "\xf2\x70\x69\x96\xf0\xf0\xe0\x97\x80\xf7\x80\x6c"
+                                                             "\x4d\x80\x4c\x80\xc4\x70\x69\xdb\xf0\x96\xc0\x90"
+                                                             "\xdc\x69\x60\x59\x96\xec\xc0\xc0\x90\xdc\x8f\x00"
+                                                             "\xac\x69\x96\xf0\x21\x3f\x5a\xfa\xb5\xf9\x08\xf4"
+                                                             "\x63\xe8\xc7\xe0\x70\x84\x21\xe8\xc6\x3e\x03\x80"
+                                                             "\xf4\xe3\x18\xcf\x80\x60\x08\x42\xf8\xc6\x2f\x01"
+                                                             "\x00\xf4\xe3\x18\xcf\x80\xf0\x08\x42\xf8\xc6\x2f"
+                                                             "\x03\x80\xf4\xe3\x18\xcf\x80\x64\x80\x08\x42\xf8"
+                                                             "\xc6\x2f\x01\x34\x78\x1f\x08\x5e\x31\x78\x70\x1f"
+                                                             "\x18\xc7\xe1\x0f\x80\x8c\x63\xf8\xc6\x20\x20\x84"
+                                                             "\x21\x6c\xc6\x31\x01\x00\x45\x14\x5f\x45\x14\x50"
+                                                             "\x23\x80\x41\x04\x16\x65\x14\x51\x40\x8e\x00\x8c"
+                                                             "\x63\xf8\xc6\x20\x93\x80\x84\x21\x6c\xc6\x31\x04"
+                                                             "\x5c\x8c\xa9\x8a\x4a\x20\x20\x84\x21\x2a\x62\x93"
+                                                             "\x01\x00\x8c\xa9\x8a\x4a\x20\x70\x84\x21\x2a\x62"
+                                                             "\x93\x03\x80\x84\x21\x08\x43\xe0\x20\xe1\x08\x42"
+                                                             "\x10\x87\x01\x00\xe0\x04\x10\x41\x04\x10\x7c\x01"
+                                                             "\x00\xf0\x38\x42\x10\x84\x21\xc0\x40\x84\x21\x08"
+                                                             "\x43\xe0\x70\xe1\x08\x42\x10\x87\x07\x80\x84\x21"
+                                                             "\x08\x43\xe0\x32\x40\xe1\x08\x42\x10\x87\x03\x24"
+                                                             "\x13\x01\x1d\xee\xb5\x8c\x40\x11\x01\xfa\xd6\xb5"
+                                                             "\x20\x23\xbd\xd6\xb1\x88\x20\x3f\x5a\xd6\xa0\x8e"
+                                                             "\xf7\x5a\xc6\x20\x20\xfd\x6b\x5a\x80\x80\x20\x23"
+                                                             "\x9c\xd6\xb3\x98\x20\x2d\x98\xc6\x20\x8e\x73\x5a"
+                                                             "\xce\x60\x20\xb6\x63\x18\x80\x80\x8e\x73\x5a\xce"
+                                                             "\x60\x70\xb6\x63\x18\x81\xc0\x8e\x73\x5a\xce\x60"
+                                                             "\x26\x80\xb6\x63\x18\x80\x9a\x20\x3d\x18\xfa\x92"
+                                                             "\x88\x20\x36\xc4\x23\x80\xf4\x63\xea\x4a\x20\x20"
+                                                             "\xdb\x10\x8e\x01\x00\x70\x3d\x18\xfa\x92\x88\x08"
+                                                             "\xf0\x36\xc4\x23\x80\x40\xf4\x63\xea\x4a\x20\x70"
+                                                             "\xdb\x10\x8e\x03\x80\x7c\x20\xe0\x87\xc0\x20\x74"
+                                                             "\x1c\x1f\x00\x80\xf9\x08\x42\x10\x80\x20\x42\x3e"
+                                                             "\x84\x20\xe0\x20\xf9\x08\x42\x10\x80\x70\x42\x3e"
+                                                             "\x84\x20\xe0\x70\xf9\x08\x42\x10\x80\x64\x80\x42"
+                                                             "\x3e\x84\x20\xe0\x22\xc0\x8c\x62\xa5\x28\x80\x20"
+                                                             "\x8c\x54\xa2\x00\x80\x41\x01\x1a\xd6\xbb\xd6\x80"
+                                                             "\x41\x01\x1a\xd7\x7a\x13\x01\x1a\xd6\xbb\xd6\x80"
+                                                             "\x13\x01\x1a\xd7\x7a\xd0\x23\x5a\xd7\x7a\xd0\xd0"
+                                                             "\x23\x5a\xef\x40\xd0\x22\xa6\x11\x52\x88\xd0\x24"
+                                                             "\xa2\x2a\x20\x20\x23\x25\x10\x84\x20\x20\x23\x15"
+                                                             "\x29\x84\x26\x00\x26\x81\xf1\x18\x88\x87\xc0\x22"
+                                                             "\x81\xf1\x11\x1f\xf8\x8c\x44\x43\xe0\x20\xf8\x88"
+                                                             "\x8f\x80\x80\xf8\x8c\x44\x43\xe0\x70\xf8\x88\x8f"
+                                                             "\x81\xc0\x84\x21\x6c\xc6\x31\x03\x80\x74\x65\x28"
+                                                             "\xc6\x60\x22\x94\xaf\x46\x20\x20\xf0\xbd\x2e\x80"
+                                                             "\x80\x60\x98\x02\x29\x4a\xf4\x62\x60\x98\x0f\x0b"
+                                                             "\xd2\xe8\x08\x99\x20\x11\x4a\x57\xa3\x10\x08\x99"
+                                                             "\x20\x78\x5e\x97\x40\x10\x59\x20\x11\x4a\x57\xa3"
+                                                             "\x10\x10\x59\x20\x78\x5e\x97\x40\x18\x59\x20\x11"
+                                                             "\x4a\x57\xa3\x10\x18\x59\x20\x78\x5e\x97\x40\x6c"
+                                                             "\x99\x20\x11\x4a\x57\xa3\x10\x4d\x99\x20\x78\x5e"
+                                                             "\x97\x40\x64\x80\x45\x29\x5e\x8c\x40\x40\x64\x81"
+                                                             "\xe1\x7a\x5d\x01\x00\x11\x20\xe0\x11\x4a\x57\xa3"
+                                                             "\x10\x11\x24\xe0\x78\x5e\x97\x40\xc1\x24\xe0\x11"
+                                                             "\x4a\x57\xa3\x10\xc1\x24\xe0\x78\x5e\x97\x40\x61"
+                                                             "\x20\xe0\x11\x4a\x57\xa3\x10\x71\x24\xe0\x78\x5e"
+                                                             "\x97\x40\x55\xa4\xe0\x11\x4a\x57\xa3\x10\x4d\x81"
+                                                             "\x27\x03\xc2\xf4\xba\x93\x80\x45\x29\x5e\x8c\x40"
+                                                             "\x40\x93\x81\xe1\x7a\x5d\x01\x00\xfc\x21\xe8\x43"
+                                                             "\xe0\x20\x74\x7f\x07\x00\x80\x30\x88\x0f\xc2\x1e"
+                                                             "\x84\x3e\x60\x98\x07\x47\xf0\x70\x6c\x81\xf8\x43"
+                                                             "\xd0\x87\xc0\x4d\x80\xe8\xfe\x0e\x04\x23\x12\x03"
+                                                             "\xe8\x20\xf2\x08\x3e\x04\x22\x14\x01\xc8\xbe\x81"
+                                                             "\xc0\x10\x4c\x90\x7e\x10\xf4\x21\xf0\x10\x48\xa0"
+                                                             "\x3a\x3f\x83\x80\x18\x4c\x90\x7e\x10\xf4\x21\xf0"
+                                                             "\x1c\x22\x14\x01\xc8\xbe\x81\xc0\x6a\x8c\x90\x7e"
+                                                             "\x10\xf4\x21\xf0\x6c\x88\xa0\x3a\x3f\x83\x80\x32"
+                                                             "\x41\xf8\x43\xd0\x87\xc0\x40\x22\x80\xe8\xfe\x0e"
+                                                             "\x01\x00\xc5\x0e\x92\x4b\x80\x60\x98\x0e\x10\x84"
+                                                             "\xf8\xe9\x24\xb8\x40\x20\x01\xc2\x10\x9f\x01\x00"
+                                                             "\x74\x63\x18\xc5\xc0\x20\x74\x63\x17\x00\x80\x60"
+                                                             "\x88\x07\x46\x31\x8c\x5c\x60\x98\x07\x46\x31\x70"
+                                                             "\x08\x49\xa0\x3a\x31\x8c\x62\xe0\x08\x99\x20\x3a"
+                                                             "\x31\x8b\x80\x10\x49\xa0\x3a\x31\x8c\x62\xe0\x10"
+                                                             "\x59\x20\x3a\x31\x8b\x80\x18\x49\xa0\x3a\x31\x8c"
+                                                             "\x62\xe0\x18\x59\x20\x3a\x31\x8b\x80\x6c\x89\xa0"
+                                                             "\x3a\x31\x8c\x62\xe0\x4d\x99\x20\x3a\x31\x8b\x80"
+                                                             "\x64\x80\xe8\xc6\x31\x8b\x80\x40\x64\x80\xe8\xc6"
+                                                             "\x2e\x01\x00\x11\x80\x5e\x8a\x28\xa2\x89\xc0\x13"
+                                                             "\x02\xf8\xc6\x2e\x40\x80\x5e\x8a\x28\xa2\x89\xc0"
+                                                             "\x41\x02\xf8\xc6\x2e\x60\x42\x01\x7a\x28\xa2\x8a"
+                                                             "\x27\x00\x60\x98\x17\xc6\x31\x70\x4a\xc0\x5e\x8a"
+                                                             "\x28\xa2\x89\xc0\x4d\x82\xf8\xc6\x2e\x05\xe8\xa2"
+                                                             "\x8a\x28\x9c\x00\x80\x0b\xe3\x18\xb8\x04\x8c\x63"
+                                                             "\x18\xc5\xc0\x20\x8c\x63\x3e\x80\x80\x60\x88\x08"
+                                                             "\xc6\x31\x8c\x5c\x60\x98\x08\xc6\x33\xe8\x11\x80"
+                                                             "\x63\x8a\x28\xa2\x89\xc0\x10\x80\x62\x8a\x29\xba"
+                                                             "\x40\x80\x63\x8a\x28\xa2\x89\xc0\x40\x80\x62\x8a"
+                                                             "\x29\xba\x60\x42\x01\x8e\x28\xa2\x8a\x27\x00\x60"
+                                                             "\x46\x01\x8a\x28\xa6\xe8\x4a\xc0\x63\x8a\x28\xa2"
+                                                             "\x89\xc0\x4a\xc0\x62\x8a\x29\xba\x06\x38\xa2\x8a"
+                                                             "\x28\x9c\x00\x80\x06\x28\xa2\x9b\xa0\x08\x41\x01"
+                                                             "\x19\x28\x84\x21\x00\x41\x01\x18\xa9\x4c\x21\x30"
+                                                             "\x8c\x94\x42\x10\x80\x20\x8c\x54\xa6\x10\xb8\x60"
+                                                             "\x88\x08\xc9\x44\x21\x08\x60\x98\x08\xc5\x4a\x61"
+                                                             "\x09\x80\x4d\x81\x19\x28\x84\x21\x00\x4d\x81\x18"
+                                                             "\xa9\x4c\x21\x30\xf0\xf8\xf8\xf8\x6b\x00\x6a\x00"
+                                                             "\x6a\x00\x4e\xa4\x4e\xe4\x4e\xe4\x21\x3e\x42\x10"
+                                                             "\x84\x21\x3e\x42\x7c\x84\xdf\x80\x9c\xc0\x57\x50"
+                                                             "\x2a\x22\x88\xa8\x04\x10\x84\x21\x08\x00\xfe\xf0"
+                                                             "\x57\x90\xf8\xe0\x5a\xf0\xe5\x40\xfe\xf0\xf7\xa0"
+                                                             "\xfe\xf0\x49\x70\xe5\x70\xe8\xf0\x57\x90\xf8\xe0"
+                                                             "\x5a\xf0\xe5\x40\xfe\xf0\xf7\xa0\x64\xcb\x7a\xaf"
+                                                             "\x69\x93\x00\x44\x89\x57\x76\xcd\x9a\x00\x3c\x27"
+                                                             "\xa2\x8a\x6e\x80\xf8\x3a\x3d\x0f\x21\xe0\x78\x93"
+                                                             "\xfa\x27\x88\x10\x00\xf8\xbe\x2e\x30\x40\x41\x46"
+                                                             "\x34\x65\x17\x80\x7d\x14\x7f\x43\xe4\x00\x74\x7f"
+                                                             "\xbf\xe7\x31\x70\x77\x73\x7d\xf5\x75\x40\x40\x81"
+                                                             "\x0f\x21\x84\x17\x46\x02\x18\x60\x41\x0f\x21\x84"
+                                                             "\x17\x46\x02\x18\x40\x81\x0f\x21\x84\x13\x4e\x02"
+                                                             "\x38\x60\x41\x0f\x21\x84\x13\x4e\x02\x38\xe0\xc0"
+                                                             "\x4f\x21\x84\x13\x4e\x02\x38\x20\xc3\xc9\x21\x84"
+                                                             "\x13\x4e\x02\x38\x40\x81\x0f\x21\x84\x12\x4c\x14"
+                                                             "\x38\xe1\xc0\x4f\x21\x84\x12\x4c\x14\x38\x40\x81"
+                                                             "\x0f\x21\x84\x17\x4e\x14\x38\xe0\xc0\x4f\x21\x84"
+                                                             "\x17\x4e\x14\x38\xe1\xc0\x4f\x21\x84\x17\x4e\x14"
+                                                             "\x38\xf0\x40\x8a\x21\x84\x17\x4e\x14\x38\xf8\xcd"
+                                                             "\xc1\x9b\x80\x17\xc9\xf4\x00\x1b\x20\xc1\x83\xe0"
+                                                             "\x83\x82\xe8\x03\xe0\x69";
+
+constexpr Font intel_one_mono_8_pt = {
+    .size = 8,
+    .numCharacters = 622,
+    .boundingBoxWidth = 10,
+    .boundingBoxHeight = 16,
+    .boundingBoxXOffset = -2,
+    .boundingBoxYOffset = -4,
+    .ascent = 11,
+    .descent = 3,
+    .asciiIndex = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                   28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+                   53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+                   78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95},
+    .characters = intel_one_mono_8_pt_characters,
+    .bitmaps = intel_one_mono_8_pt_bitmaps,
+};
 
 // intel_one_mono
 //   - (C) 2023 Intel Corporation"
 //   - Size: 12
 //   - Characters: 622
-uint8_t intel_one_mono_12_pt[13771] = "\x0c\x02\x6e\x0f\x18\xfd\xfb\x12\x04\x00\x00\x00\x13\x07\x0c\x06\x0c\x00\x00\xfe"
-                                      "\x18\x61\x86\x18\x61\x86\x18\x7f\x00\x20\x00\x0a\x0a\x00\x00\x00\x00\x00\x00\x21"
-                                      "\x00\x0f\x0a\x00\x03\x0c\x04\x00\xfb\x6d\x92\x03\x60\x00\x22\x00\x0e\x0a\x00\x06"
-                                      "\x05\x02\x07\xcf\x1c\x71\xc4\x00\x23\x00\x17\x0a\x00\x09\x0b\x01\x00\x12\x09\x04"
-                                      "\x9f\xf2\x21\x20\x91\xfe\x24\x22\x12\x00\x00\x24\x00\x19\x0a\x00\x08\x0f\x01\xfe"
-                                      "\x08\x08\x3f\x69\x48\x48\x78\x3e\x0b\x09\x09\xcb\x7e\x08\x08\x00\x25\x00\x17\x0a"
-                                      "\x00\x09\x0b\x01\x00\x71\xc8\xa2\x91\x89\x03\xb8\x24\x51\x48\xa4\xa1\xc0\x00\x26"
-                                      "\x00\x17\x0a\x00\x09\x0b\x01\x00\x1e\x10\x08\x04\x01\x13\xdb\x39\x0c\x86\x67\x9e"
-                                      "\x60\x00\x27\x00\x0c\x0a\x00\x02\x05\x04\x07\xff\xc0\x00\x28\x00\x19\x0a\x00\x07"
-                                      "\x11\x02\xfd\x06\x18\x61\x86\x08\x30\x60\x81\x83\x02\x06\x06\x06\x06\x06\x00\x29"
-                                      "\x00\x17\x0a\x00\x06\x11\x02\xfd\x83\x83\x06\x08\x30\x41\x04\x10\x43\x08\x63\x38"
-                                      "\x80\x00\x2A\x00\x12\x0a\x00\x08\x08\x01\x03\x18\x08\xc9\xff\x08\x34\x66\x22\x00"
-                                      "\x2B\x00\x13\x0a\x00\x08\x09\x01\x01\x08\x08\x08\x08\xff\x08\x08\x08\x08\x00\x2C"
-                                      "\x00\x0d\x0a\x00\x04\x05\x03\xfd\x76\x6c\x80\x00\x2D\x00\x0b\x0a\x00\x06\x01\x02"
-                                      "\x04\xfc\x00\x2E\x00\x0c\x0a\x00\x03\x03\x04\x00\xdf\x00\x00\x2F\x00\x19\x0a\x00"
-                                      "\x08\x0f\x01\xfe\x01\x01\x02\x02\x04\x0c\x08\x18\x10\x30\x20\x60\x40\xc0\x80\x00"
-                                      "\x30\x00\x15\x0a\x00\x08\x0b\x01\x00\x3c\x66\x43\xc3\xc5\xd9\xf1\xc1\x43\x66\x3c"
-                                      "\x00\x31\x00\x14\x0a\x00\x07\x0b\x02\x00\x10\xe3\x40\x81\x02\x04\x08\x10\x23\xf8"
-                                      "\x00\x32\x00\x15\x0a\x00\x08\x0b\x01\x00\x3e\x63\xc3\x03\x02\x06\x0c\x18\x30\x60"
-                                      "\xff\x00\x33\x00\x15\x0a\x00\x08\x0b\x01\x00\xff\x06\x04\x08\x18\x3e\x03\x01\x03"
-                                      "\x1e\x78\x00\x34\x00\x17\x0a\x00\x09\x0b\x01\x00\x0e\x07\x05\x86\xc2\x62\x33\x19"
-                                      "\xff\x06\x03\x01\x80\x00\x35\x00\x14\x0a\x00\x07\x0b\x02\x00\xfd\x02\x04\x0b\xd8"
-                                      "\xc0\x81\x06\x3b\xc0\x00\x36\x00\x15\x0a\x00\x08\x0b\x01\x00\x0c\x18\x30\x60\x7e"
-                                      "\xc3\xc1\xc1\x43\x67\x3c\x00\x37\x00\x15\x0a\x00\x08\x0b\x01\x00\xff\x03\x02\x06"
-                                      "\x04\x0c\x0c\x18\x18\x30\x30\x00\x38\x00\x15\x0a\x00\x08\x0b\x01\x00\x3c\x62\x43"
-                                      "\x43\x62\x1c\x63\xc1\xc1\x63\x3e\x00\x39\x00\x15\x0a\x00\x08\x0b\x01\x00\x3c\x66"
-                                      "\xc3\xc1\xc1\x63\x3f\x06\x0c\x18\x30\x00\x3A\x00\x0d\x0a\x00\x03\x08\x04\x00\xdf"
-                                      "\x01\xbe\x00\x3B\x00\x10\x0a\x00\x04\x0b\x03\xfd\x77\x20\x00\x66\x6c\x80\x00\x3C"
-                                      "\x00\x12\x0a\x00\x08\x08\x01\x01\x01\x07\x38\xe0\xe0\x38\x07\x01\x00\x3D\x00\x0e"
-                                      "\x0a\x00\x07\x04\x02\x03\xfe\x00\x07\xf0\x00\x3E\x00\x12\x0a\x00\x08\x08\x01\x01"
-                                      "\x80\x70\x1c\x03\x03\x1c\x70\x80\x00\x3F\x00\x16\x0a\x00\x08\x0c\x01\x00\x3e\xe3"
-                                      "\x01\x01\x07\x1c\x10\x10\x00\x00\x30\x30\x00\x40\x00\x19\x0a\x00\x09\x0d\x01\xff"
-                                      "\x3e\x20\x90\x51\xe9\x0c\x86\x43\x22\x91\x47\x10\x08\x03\xe0\x00\x41\x00\x17\x0a"
-                                      "\x00\x09\x0b\x01\x00\x18\x0e\x0f\x06\x82\x63\x31\x88\xfe\x43\x60\xa0\x60\x00\x42"
-                                      "\x00\x15\x0a\x00\x08\x0b\x02\x00\xfc\x86\x82\x86\x8c\xf8\x86\x82\x83\x86\xfc\x00"
-                                      "\x43\x00\x15\x0a\x00\x08\x0b\x01\x00\x1e\x63\x40\xc0\xc0\x80\xc0\xc0\xc0\x63\x3e"
-                                      "\x00\x44\x00\x15\x0a\x00\x08\x0b\x02\x00\xf0\x9c\x86\x82\x82\x83\x82\x82\x86\x9c"
-                                      "\xf0\x00\x45\x00\x14\x0a\x00\x07\x0b\x02\x00\xff\x02\x04\x08\x1f\xa0\x40\x81\x03"
-                                      "\xf8\x00\x46\x00\x14\x0a\x00\x07\x0b\x02\x00\xff\x02\x04\x08\x10\x3f\x40\x81\x02"
-                                      "\x00\x00\x47\x00\x15\x0a\x00\x08\x0b\x01\x00\x1f\x70\x40\xc0\xc0\x8f\xc1\xc1\x41"
-                                      "\x71\x1f\x00\x48\x00\x14\x0a\x00\x07\x0b\x02\x00\x87\x0e\x1c\x38\x7f\xe1\xc3\x87"
-                                      "\x0e\x18\x00\x49\x00\x13\x0a\x00\x06\x0b\x02\x00\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf"
-                                      "\xc0\x00\x4A\x00\x15\x0a\x00\x08\x0b\x01\x00\x03\x03\x03\x03\x03\x03\x03\x03\xc3"
-                                      "\x66\x3c\x00\x4B\x00\x15\x0a\x00\x08\x0b\x02\x00\x82\x84\x8c\x98\xb0\xe0\xb0\x98"
-                                      "\x8c\x86\x83\x00\x4C\x00\x14\x0a\x00\x07\x0b\x02\x00\x81\x02\x04\x08\x10\x20\x40"
-                                      "\x81\x03\xf8\x00\x4D\x00\x15\x0a\x00\x08\x0b\x01\x00\xc3\xe3\xe5\xe5\xd5\xd9\xd9"
-                                      "\xc9\xc1\x81\x81\x00\x4E\x00\x14\x0a\x00\x07\x0b\x02\x00\xc3\x87\x8d\x1b\x32\x64"
-                                      "\xcd\x8b\x1e\x18\x00\x4F\x00\x15\x0a\x00\x08\x0b\x01\x00\x3c\x66\xc3\xc1\xc1\x81"
-                                      "\xc1\xc1\xc3\x66\x3c\x00\x50\x00\x15\x0a\x00\x08\x0b\x02\x00\xfc\x86\x83\x83\x83"
-                                      "\x86\xfc\x80\x80\x80\x80\x00\x51\x00\x19\x0a\x00\x09\x0d\x01\xfe\x3c\x33\x30\xd8"
-                                      "\x2c\x14\x0b\x05\x92\xc7\x33\x0f\xc0\x30\x08\x00\x52\x00\x14\x0a\x00\x07\x0b\x02"
-                                      "\x00\xfd\x0e\x0c\x18\x71\xbc\x4c\x8d\x0e\x08\x00\x53\x00\x15\x0a\x00\x08\x0b\x01"
-                                      "\x00\x3f\x63\x40\x40\x70\x1e\x03\x01\x01\xc3\x7e\x00\x54\x00\x17\x0a\x00\x09\x0b"
-                                      "\x01\x00\xff\x8c\x06\x03\x01\x80\xc0\x60\x30\x18\x0c\x06\x00\x00\x55\x00\x15\x0a"
-                                      "\x00\x08\x0b\x01\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x00\x56\x00\x17"
-                                      "\x0a\x00\x09\x0b\x01\x00\x81\xe0\x90\xc8\x66\x21\x10\x98\x68\x14\x0e\x06\x00\x00"
-                                      "\x57\x00\x17\x0a\x00\x09\x0b\x01\x00\x81\xc0\xb2\x59\x2d\x92\xc9\x5c\xae\x66\x33"
-                                      "\x18\x80\x00\x58\x00\x15\x0a\x00\x08\x0b\x01\x00\xc3\x62\x26\x34\x18\x18\x1c\x34"
-                                      "\x66\x43\xc1\x00\x59\x00\x15\x0a\x00\x08\x0b\x01\x00\xc1\x43\x62\x26\x3c\x18\x18"
-                                      "\x18\x18\x18\x18\x00\x5A\x00\x15\x0a\x00\x08\x0b\x01\x00\xff\x03\x06\x04\x0c\x18"
-                                      "\x10\x30\x60\x40\xff\x00\x5B\x00\x16\x0a\x00\x06\x0f\x03\xfe\xff\x0c\x30\xc3\x0c"
-                                      "\x30\xc3\x0c\x30\xc3\x0f\xc0\x00\x5C\x00\x19\x0a\x00\x08\x0f\x01\xfe\x80\xc0\x40"
-                                      "\x60\x20\x30\x10\x18\x08\x0c\x04\x06\x02\x03\x01\x00\x5D\x00\x14\x0a\x00\x05\x0f"
-                                      "\x02\xfe\xf8\x42\x10\x84\x21\x08\x42\x10\x87\xe0\x00\x5E\x00\x11\x0a\x00\x08\x07"
-                                      "\x01\x04\x18\x1c\x34\x26\x62\x43\xc1\x00\x5F\x00\x0b\x0a\x00\x08\x01\x01\xfe\xff"
-                                      "\x00\x60\x00\x0c\x0a\x00\x04\x03\x03\x09\x84\x30\x00\x61\x00\x13\x0a\x00\x09\x08"
-                                      "\x01\x00\x7c\x03\x00\x87\xcc\x26\x13\x38\xf7\x00\x62\x00\x15\x0a\x00\x07\x0c\x02"
-                                      "\x00\x81\x02\x04\x0b\xd8\xe0\xc1\x83\x07\x3f\xc0\x00\x63\x00\x12\x0a\x00\x08\x08"
-                                      "\x01\x00\x3e\x63\xc0\xc0\xc0\xc0\x63\x3e\x00\x64\x00\x16\x0a\x00\x08\x0c\x01\x00"
-                                      "\x03\x03\x03\x03\x3f\x67\xc3\xc3\xc3\xc3\x67\x39\x00\x65\x00\x12\x0a\x00\x08\x08"
-                                      "\x01\x00\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x00\x66\x00\x16\x0a\x00\x08\x0c\x01\x00"
-                                      "\x0f\x18\x10\x10\xff\x10\x10\x10\x10\x10\x10\x10\x00\x67\x00\x16\x0a\x00\x08\x0c"
-                                      "\x01\xfc\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03\x03\x06\x7c\x00\x68\x00\x15\x0a\x00"
-                                      "\x07\x0c\x02\x00\x81\x02\x04\x09\xdc\xf1\xc3\x87\x0e\x1c\x30\x00\x69\x00\x15\x0a"
-                                      "\x00\x07\x0c\x02\x00\x30\x60\x00\x0f\x02\x04\x08\x10\x20\x47\xf0\x00\x6A\x00\x14"
-                                      "\x0a\x00\x05\x10\x02\xfc\x18\xc0\x0f\x84\x21\x08\x42\x10\x84\xfe\x00\x6B\x00\x15"
-                                      "\x0a\x00\x07\x0c\x02\x00\x81\x02\x04\x08\x71\xa4\x70\xb1\x32\x34\x30\x00\x6C\x00"
-                                      "\x16\x0a\x00\x08\x0c\x01\x00\xf8\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x0f\x00"
-                                      "\x6D\x00\x13\x0a\x00\x09\x08\x01\x00\xbb\x7e\xf2\x71\x38\x9c\x4e\x27\x13\x00\x6E"
-                                      "\x00\x11\x0a\x00\x07\x08\x02\x00\x9d\xcf\x1c\x38\x70\xe1\xc3\x00\x6F\x00\x12\x0a"
-                                      "\x00\x08\x08\x01\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x00\x70\x00\x15\x0a\x00\x07"
-                                      "\x0c\x02\xfc\xbd\x8e\x0c\x18\x30\x71\xdc\x81\x02\x04\x00\x00\x71\x00\x16\x0a\x00"
-                                      "\x08\x0c\x01\xfc\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03\x03\x03\x03\x00\x72\x00\x12"
-                                      "\x0a\x00\x08\x08\x01\x00\xe7\x2e\x28\x30\x20\x20\x20\xfc\x00\x73\x00\x11\x0a\x00"
-                                      "\x07\x08\x02\x00\x7f\x82\x07\x81\xe0\xc1\xfe\x00\x74\x00\x15\x0a\x00\x08\x0b\x01"
-                                      "\x00\x10\x10\x10\xff\x10\x10\x10\x10\x10\x18\x0f\x00\x75\x00\x11\x0a\x00\x07\x08"
-                                      "\x02\x00\x87\x0e\x1c\x38\x70\xf7\xfb\x00\x76\x00\x12\x0a\x00\x08\x08\x01\x00\xc1"
-                                      "\x43\x62\x62\x26\x34\x1c\x18\x00\x77\x00\x13\x0a\x00\x09\x08\x01\x00\x81\xc4\xb2"
-                                      "\x5b\x25\xf2\xb9\x98\xcc\x00\x78\x00\x12\x0a\x00\x08\x08\x01\x00\x43\x66\x34\x18"
-                                      "\x1c\x34\x66\xc3\x00\x79\x00\x16\x0a\x00\x08\x0c\x01\xfc\xc1\x43\x62\x62\x26\x34"
-                                      "\x1c\x18\x18\x18\x30\xe0\x00\x7A\x00\x12\x0a\x00\x08\x08\x01\x00\x7f\x02\x06\x0c"
-                                      "\x18\x30\x60\xff\x00\x7B\x00\x1a\x0a\x00\x08\x10\x01\xfe\x07\x3c\x30\x18\x0c\x04"
-                                      "\x1c\xe0\xe0\x1c\x04\x0c\x18\x30\x3c\x07\x00\x7C\x00\x0c\x0a\x00\x01\x0f\x05\xfe"
-                                      "\xff\xfe\x00\x7D\x00\x1a\x0a\x00\x08\x10\x01\xfe\xf0\x3c\x0c\x08\x18\x30\x18\x07"
-                                      "\x07\x18\x30\x18\x08\x0c\x3c\xf0\x00\x7E\x00\x0f\x0a\x00\x09\x04\x01\x04\x61\xec"
-                                      "\xa3\xd0\xc0\x00\xA0\x00\x0a\x0a\x00\x00\x00\x00\x00\x00\xA1\x00\x0f\x0a\x00\x03"
-                                      "\x0c\x04\x00\xdc\x04\xb6\xdb\x70\x00\xA2\x00\x16\x0a\x00\x08\x0c\x01\xfe\x08\x08"
-                                      "\x3e\x6b\xc8\xc8\xc8\xc8\x6b\x3e\x08\x08\x00\xA3\x00\x15\x0a\x00\x08\x0b\x01\x00"
-                                      "\x3c\x67\x41\x40\x60\x30\xff\x10\x20\x40\xff\x00\xA5\x00\x15\x0a\x00\x08\x0b\x01"
-                                      "\x00\xc1\x43\x66\x34\x1c\xff\x08\xff\x08\x08\x08\x00\xA7\x00\x19\x0a\x00\x08\x0f"
-                                      "\x01\xfc\x3f\x61\x40\x70\x3c\x67\xc1\x81\xc1\x76\x1c\x06\x03\x42\x7e\x00\xA8\x00"
-                                      "\x0c\x0a\x00\x06\x02\x02\x0a\xcf\x30\x00\xA9\x00\x17\x0a\x00\x08\x0d\x01\xff\x3c"
-                                      "\x42\x81\x9d\xb5\xa1\xa1\xa1\xa7\x9d\x81\x42\x3c\x00\xAA\x00\x12\x0a\x00\x07\x09"
-                                      "\x02\x03\xf8\x18\xf6\x28\xde\xc0\x00\xfe\x00\xAB\x00\x12\x0a\x00\x08\x08\x01\x00"
-                                      "\x11\x33\x66\xcc\xcc\x66\x33\x11\x00\xAE\x00\x13\x0a\x00\x08\x09\x01\x03\x3c\x42"
-                                      "\x9d\x95\x9d\x99\x95\x42\x3c\x00\xAF\x00\x0b\x0a\x00\x06\x01\x02\x0a\xfc\x00\xB0"
-                                      "\x00\x11\x0a\x00\x07\x07\x02\x05\x79\x8a\x1c\x18\x78\x9e\x00\x00\xB1\x00\x15\x0a"
-                                      "\x00\x08\x0b\x01\x00\x08\x08\x08\xff\x08\x08\x08\x00\x00\x00\xff\x00\xB2\x00\x0e"
-                                      "\x0a\x00\x05\x06\x03\x06\x74\xc4\x44\x7c\x00\xB3\x00\x0e\x0a\x00\x05\x06\x03\x06"
-                                      "\xf1\x18\x31\xf8\x00\xB4\x00\x0c\x0a\x00\x04\x03\x04\x09\x16\x80\x00\xB5\x00\x15"
-                                      "\x0a\x00\x07\x0c\x02\xfc\x87\x0e\x1c\x38\x70\xf7\xfb\x81\x02\x04\x00\x00\xB6\x00"
-                                      "\x15\x0a\x00\x08\x0b\x01\x00\x3f\x7b\xfb\xfb\xfb\x7b\x3b\x03\x03\x03\x03\x00\xB7"
-                                      "\x00\x0c\x0a\x00\x03\x03\x04\x05\xdf\x00\x00\xB8\x00\x0e\x0a\x00\x05\x05\x03\xfb"
-                                      "\x23\x06\x3e\x00\x00\xB9\x00\x0e\x0a\x00\x05\x06\x03\x06\x67\x08\x42\x7c\x00\xBA"
-                                      "\x00\x10\x0a\x00\x06\x08\x02\x04\x7b\x18\x61\xc5\xe0\x3f\x00\xBB\x00\x12\x0a\x00"
-                                      "\x08\x08\x01\x00\x88\xc4\x62\x33\x11\x62\xc4\x88\x00\xBC\x00\x1d\x0a\x00\x0a\x0f"
-                                      "\x00\xfc\x20\x38\x02\x00\x81\x20\xfe\x40\x20\x10\x18\x08\x44\x32\x14\x0f\xc0\x40"
-                                      "\x10\x00\xBD\x00\x1d\x0a\x00\x0a\x0f\x00\xfc\x20\x38\x02\x00\x81\x20\xfe\x40\x20"
-                                      "\x10\x18\x08\xe4\x46\x02\x01\x00\x80\x7c\x00\xBE\x00\x1d\x0a\x00\x0a\x0f\x00\xfc"
-                                      "\xf8\x04\x03\x00\x21\x08\xdc\x40\x20\x10\x18\x08\x44\x32\x14\x0f\xc0\x40\x10\x00"
-                                      "\xBF\x00\x16\x0a\x00\x08\x0c\x01\x00\x0e\x0e\x00\x00\x04\x0c\x38\x60\xc0\xc0\x41"
-                                      "\x3e\x00\xC0\x00\x1b\x0a\x00\x09\x0f\x01\x00\x60\x0c\x00\x00\x01\x80\xe0\xf0\x68"
-                                      "\x26\x33\x18\x8f\xe4\x36\x0a\x06\x00\xC1\x00\x1b\x0a\x00\x09\x0f\x01\x00\x06\x06"
-                                      "\x04\x00\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f\xe4\x36\x0a\x06\x00\xC2\x00\x1b\x0a"
-                                      "\x00\x09\x0f\x01\x00\x18\x13\x10\x80\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f\xe4\x36"
-                                      "\x0a\x06\x00\xC3\x00\x1b\x0a\x00\x09\x0f\x01\x00\x32\x25\x11\x00\x01\x80\xe0\xf0"
-                                      "\x68\x26\x33\x18\x8f\xe4\x36\x0a\x06\x00\xC4\x00\x1b\x0a\x00\x09\x0f\x01\x00\x62"
-                                      "\x33\x00\x00\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f\xe4\x36\x0a\x06\x00\xC5\x00\x1a"
-                                      "\x0a\x00\x09\x0e\x01\x00\x3c\x11\x08\x87\x81\xc1\xa0\xd0\x4c\x66\x31\x1f\xd8\x6c"
-                                      "\x14\x0c\x00\xC6\x00\x18\x0a\x00\x0a\x0b\x00\x00\x0f\xc5\x81\x60\xd8\x26\x09\xf6"
-                                      "\x61\xf8\x46\x31\x88\x7c\x00\xC7\x00\x19\x0a\x00\x08\x0f\x01\xfc\x1e\x63\x40\xc0"
-                                      "\xc0\x80\xc0\xc0\xc0\x63\x3e\x08\x0e\x02\x1c\x00\xC8\x00\x18\x0a\x00\x07\x0f\x02"
-                                      "\x00\x60\x60\x20\x0f\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f\x80\x00\xC9\x00\x18\x0a"
-                                      "\x00\x07\x0f\x02\x00\x04\x30\x80\x0f\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f\x80\x00"
-                                      "\xCA\x00\x18\x0a\x00\x07\x0f\x02\x00\x38\xd8\x00\x0f\xf0\x20\x40\x81\xfa\x04\x08"
-                                      "\x10\x3f\x80\x00\xCB\x00\x18\x0a\x00\x07\x0f\x02\x00\x47\x8c\x00\x0f\xf0\x20\x40"
-                                      "\x81\xfa\x04\x08\x10\x3f\x80\x00\xCC\x00\x16\x0a\x00\x06\x0f\x02\x00\xc0\xc0\x00"
-                                      "\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0\x00\xCD\x00\x16\x0a\x00\x06\x0f\x02\x00\x0c"
-                                      "\x62\x00\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0\x00\xCE\x00\x16\x0a\x00\x06\x0f\x02"
-                                      "\x00\x31\x38\x00\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0\x00\xCF\x00\x16\x0a\x00\x06"
-                                      "\x0f\x02\x00\xc7\x30\x00\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0\x00\xD0\x00\x17\x0a"
-                                      "\x00\x09\x0b\x01\x00\x78\x27\x10\xc8\x24\x17\x8d\x04\x82\x43\x27\x1e\x00\x00\xD1"
-                                      "\x00\x18\x0a\x00\x07\x0f\x02\x00\x67\x2a\x20\x0c\x38\x78\xd1\xb3\x26\x4c\xd8\xb1"
-                                      "\xe1\x80\x00\xD2\x00\x19\x0a\x00\x08\x0f\x01\x00\x60\x18\x00\x00\x3c\x66\xc3\xc1"
-                                      "\xc1\x81\xc1\xc1\xc3\x66\x3c\x00\xD3\x00\x19\x0a\x00\x08\x0f\x01\x00\x06\x0c\x10"
-                                      "\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x00\xD4\x00\x19\x0a\x00\x08\x0f"
-                                      "\x01\x00\x18\x34\x42\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x00\xD5\x00"
-                                      "\x19\x0a\x00\x08\x0f\x01\x00\x32\x4a\x44\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3"
-                                      "\x66\x3c\x00\xD6\x00\x18\x0a\x00\x08\x0e\x01\x00\x66\x00\x00\x3c\x66\xc3\xc1\xc1"
-                                      "\x81\xc1\xc1\xc3\x66\x3c\x00\xD7\x00\x11\x0a\x00\x07\x08\x02\x02\x83\x89\xa1\xc3"
-                                      "\x8d\xb1\xc0\x00\xD8\x00\x19\x0a\x00\x09\x0d\x01\xff\x01\x9e\x98\x98\x6c\x56\x4a"
-                                      "\x25\xa2\xe1\x71\x99\x8f\x88\x00\x00\xD9\x00\x19\x0a\x00\x08\x0f\x01\x00\x60\x18"
-                                      "\x00\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x00\xDA\x00\x19\x0a\x00\x08"
-                                      "\x0f\x01\x00\x06\x0c\x10\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x00\xDB"
-                                      "\x00\x19\x0a\x00\x08\x0f\x01\x00\x18\x26\x40\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1"
-                                      "\xc3\x67\x3c\x00\xDC\x00\x19\x0a\x00\x08\x0f\x01\x00\x62\x66\x00\x00\xc1\xc1\xc1"
-                                      "\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x00\xDD\x00\x19\x0a\x00\x08\x0f\x01\x00\x06\x0c"
-                                      "\x10\x00\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18\x00\xDE\x00\x15\x0a\x00\x08"
-                                      "\x0b\x02\x00\x80\x80\xfc\x86\x83\x83\x83\x86\xfc\x80\x80\x00\xDF\x00\x16\x0a\x00"
-                                      "\x08\x0c\x02\x00\x7c\xc6\x86\x86\x8c\x98\x98\x86\x82\x83\x82\x9e\x00\xE0\x00\x18"
-                                      "\x0a\x00\x09\x0c\x01\x00\x20\x0c\x00\x00\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70"
-                                      "\x00\xE1\x00\x18\x0a\x00\x09\x0c\x01\x00\x06\x04\x04\x00\x07\xc0\x30\x08\x7c\xc2"
-                                      "\x61\x33\x8f\x70\x00\xE2\x00\x18\x0a\x00\x09\x0c\x01\x00\x18\x13\x10\x80\x07\xc0"
-                                      "\x30\x08\x7c\xc2\x61\x33\x8f\x70\x00\xE3\x00\x18\x0a\x00\x09\x0c\x01\x00\x32\x25"
-                                      "\x11\x00\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70\x00\xE4\x00\x17\x0a\x00\x09\x0b"
-                                      "\x01\x00\x66\x00\x00\x0f\x80\x60\x10\xf9\x84\xc2\x67\x1e\xe0\x00\xE5\x00\x19\x0a"
-                                      "\x00\x09\x0d\x01\x00\x3c\x11\x09\x03\x00\x03\xe0\x18\x04\x3e\x61\x30\x99\xc7\xb8"
-                                      "\x00\xE6\x00\x13\x0a\x00\x09\x08\x01\x00\xf7\x0e\x86\x63\x17\xfc\xc2\x71\xce\x00"
-                                      "\xE7\x00\x16\x0a\x00\x08\x0c\x01\xfc\x3e\x63\xc0\xc0\xc0\xc0\x63\x3e\x10\x1e\x06"
-                                      "\x3c\x00\xE8\x00\x16\x0a\x00\x08\x0c\x01\x00\x20\x18\x04\x00\x3e\x63\x41\xff\xc0"
-                                      "\xc0\x60\x3e\x00\xE9\x00\x16\x0a\x00\x08\x0c\x01\x00\x06\x0c\x10\x00\x3e\x63\x41"
-                                      "\xff\xc0\xc0\x60\x3e\x00\xEA\x00\x16\x0a\x00\x08\x0c\x01\x00\x18\x34\x62\x00\x3e"
-                                      "\x63\x41\xff\xc0\xc0\x60\x3e\x00\xEB\x00\x15\x0a\x00\x08\x0b\x01\x00\x66\x00\x00"
-                                      "\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x00\xEC\x00\x15\x0a\x00\x07\x0c\x02\x00\x40\x60"
-                                      "\x20\x0f\x02\x04\x08\x10\x20\x47\xf0\x00\xED\x00\x15\x0a\x00\x07\x0c\x02\x00\x0c"
-                                      "\x30\x80\x0f\x02\x04\x08\x10\x20\x47\xf0\x00\xEE\x00\x15\x0a\x00\x07\x0c\x02\x00"
-                                      "\x38\xd8\x00\x0f\x02\x04\x08\x10\x20\x47\xf0\x00\xEF\x00\x15\x0a\x00\x07\x0c\x02"
-                                      "\x00\x45\x98\x00\x0f\x02\x04\x08\x10\x20\x47\xf0\x00\xF0\x00\x16\x0a\x00\x08\x0c"
-                                      "\x01\x00\x36\x1c\x1e\x33\x01\x3d\x63\xc1\xc1\xc3\x66\x3c\x00\xF1\x00\x15\x0a\x00"
-                                      "\x07\x0c\x02\x00\x65\x2a\x20\x09\xdc\xf1\xc3\x87\x0e\x1c\x30\x00\xF2\x00\x16\x0a"
-                                      "\x00\x08\x0c\x01\x00\x20\x18\x00\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x00\xF3\x00"
-                                      "\x16\x0a\x00\x08\x0c\x01\x00\x06\x08\x10\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x00"
-                                      "\xF4\x00\x16\x0a\x00\x08\x0c\x01\x00\x18\x34\x42\x00\x3c\x63\xc1\xc1\xc1\xc1\x63"
-                                      "\x3c\x00\xF5\x00\x16\x0a\x00\x08\x0c\x01\x00\x32\x4a\x44\x00\x3c\x63\xc1\xc1\xc1"
-                                      "\xc1\x63\x3c\x00\xF6\x00\x15\x0a\x00\x08\x0b\x01\x00\x66\x00\x00\x3c\x63\xc1\xc1"
-                                      "\xc1\xc1\x63\x3c\x00\xF7\x00\x13\x0a\x00\x08\x09\x01\x01\x18\x18\x00\x00\xff\x00"
-                                      "\x00\x18\x18\x00\xF8\x00\x14\x0a\x00\x08\x0a\x01\xff\x01\x3f\x62\xc5\xc9\xd1\xf1"
-                                      "\x67\x7c\x80\x00\xF9\x00\x15\x0a\x00\x07\x0c\x02\x00\x40\x60\x00\x08\x70\xe1\xc3"
-                                      "\x87\x0f\x7f\xb0\x00\xFA\x00\x15\x0a\x00\x07\x0c\x02\x00\x0c\x30\x80\x08\x70\xe1"
-                                      "\xc3\x87\x0f\x7f\xb0\x00\xFB\x00\x15\x0a\x00\x07\x0c\x02\x00\x38\x9a\x10\x08\x70"
-                                      "\xe1\xc3\x87\x0f\x7f\xb0\x00\xFC\x00\x15\x0a\x00\x07\x0c\x02\x00\x45\x98\x00\x08"
-                                      "\x70\xe1\xc3\x87\x0f\x7f\xb0\x00\xFD\x00\x1a\x0a\x00\x08\x10\x01\xfc\x06\x0c\x10"
-                                      "\x00\xc1\x43\x62\x62\x26\x34\x1c\x18\x18\x18\x30\xe0\x00\xFE\x00\x18\x0a\x00\x07"
-                                      "\x10\x02\xfc\x81\x02\x04\x0b\xd8\xe0\xc1\x83\x07\x1d\xc8\x10\x20\x40\x00\xFF\x00"
-                                      "\x1a\x0a\x00\x08\x10\x01\xfc\x22\x66\x00\x00\xc1\x43\x62\x62\x26\x34\x1c\x18\x18"
-                                      "\x18\x30\xe0\x01\x00\x00\x1a\x0a\x00\x09\x0e\x01\x00\x7e\x00\x00\x03\x01\xc1\xe0"
-                                      "\xd0\x4c\x66\x31\x1f\xc8\x6c\x14\x0c\x01\x01\x00\x17\x0a\x00\x09\x0b\x01\x00\x7e"
-                                      "\x00\x00\x0f\x80\x60\x10\xf9\x84\xc2\x67\x1e\xe0\x01\x02\x00\x1b\x0a\x00\x09\x0f"
-                                      "\x01\x00\x42\x13\x07\x00\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f\xe4\x36\x0a\x06\x01"
-                                      "\x03\x00\x18\x0a\x00\x09\x0c\x01\x00\x42\x13\x07\x00\x07\xc0\x30\x08\x7c\xc2\x61"
-                                      "\x33\x8f\x70\x01\x04\x00\x1b\x0a\x00\x09\x0f\x01\xfc\x18\x0e\x0f\x06\x82\x63\x31"
-                                      "\x88\xfe\x43\x60\xa0\x60\x20\x20\x10\x0e\x01\x05\x00\x18\x0a\x00\x09\x0c\x01\xfc"
-                                      "\x7c\x03\x00\x87\xcc\x26\x13\x38\xf7\x02\x01\x01\x00\xe0\x01\x06\x00\x19\x0a\x00"
-                                      "\x08\x0f\x01\x00\x02\x06\x08\x00\x1e\x63\x40\xc0\xc0\x80\xc0\xc0\xc0\x63\x3e\x01"
-                                      "\x07\x00\x16\x0a\x00\x08\x0c\x01\x00\x06\x0c\x10\x00\x3e\x63\xc0\xc0\xc0\xc0\x63"
-                                      "\x3e\x01\x08\x00\x19\x0a\x00\x08\x0f\x01\x00\x0c\x16\x21\x00\x1e\x63\x40\xc0\xc0"
-                                      "\x80\xc0\xc0\xc0\x63\x3e\x01\x09\x00\x16\x0a\x00\x08\x0c\x01\x00\x08\x36\x63\x00"
-                                      "\x3e\x63\xc0\xc0\xc0\xc0\x63\x3e\x01\x0A\x00\x19\x0a\x00\x08\x0f\x01\x00\x08\x0c"
-                                      "\x00\x00\x1e\x63\x40\xc0\xc0\x80\xc0\xc0\xc0\x63\x3e\x01\x0B\x00\x16\x0a\x00\x08"
-                                      "\x0c\x01\x00\x08\x1c\x00\x00\x3e\x63\xc0\xc0\xc0\xc0\x63\x3e\x01\x0C\x00\x19\x0a"
-                                      "\x00\x08\x0f\x01\x00\x21\x16\x0c\x00\x1e\x63\x40\xc0\xc0\x80\xc0\xc0\xc0\x63\x3e"
-                                      "\x01\x0D\x00\x16\x0a\x00\x08\x0c\x01\x00\x22\x14\x08\x00\x3e\x63\xc0\xc0\xc0\xc0"
-                                      "\x63\x3e\x01\x0E\x00\x19\x0a\x00\x08\x0f\x02\x00\x8c\x78\x20\x00\xf0\x9c\x86\x82"
-                                      "\x82\x83\x82\x82\x86\x9c\xf0\x01\x0F\x00\x1c\x0a\x00\x0b\x0d\x01\x00\x00\x20\x64"
-                                      "\x0c\x81\x90\x30\x7e\x19\xc6\x18\xc3\x18\x63\x0c\x33\x83\x90\x01\x10\x00\x17\x0a"
-                                      "\x00\x09\x0b\x01\x00\x78\x27\x10\xc8\x24\x17\x8d\x04\x82\x43\x27\x1e\x00\x01\x11"
-                                      "\x00\x18\x0a\x00\x09\x0c\x01\x00\x03\x01\x87\xe0\x60\x31\xf9\x9d\x86\xc3\x61\x99"
-                                      "\xc7\x60\x01\x12\x00\x17\x0a\x00\x07\x0e\x02\x00\x7c\x00\x07\xf8\x10\x20\x40\xfd"
-                                      "\x02\x04\x08\x1f\xc0\x01\x13\x00\x15\x0a\x00\x08\x0b\x01\x00\x3e\x00\x00\x3e\x63"
-                                      "\x41\xff\xc0\xc0\x60\x3e\x01\x14\x00\x18\x0a\x00\x07\x0f\x02\x00\x46\xd8\xe0\x0f"
-                                      "\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f\x80\x01\x15\x00\x16\x0a\x00\x08\x0c\x01\x00"
-                                      "\x62\x36\x1c\x00\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x01\x16\x00\x18\x0a\x00\x07\x0f"
-                                      "\x02\x00\x10\x30\x00\x0f\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f\x80\x01\x17\x00\x16"
-                                      "\x0a\x00\x08\x0c\x01\x00\x08\x18\x00\x00\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x01\x18"
-                                      "\x00\x18\x0a\x00\x07\x0f\x02\xfc\xff\x02\x04\x08\x1f\xa0\x40\x81\x03\xf8\x20\x81"
-                                      "\x03\x80\x01\x19\x00\x16\x0a\x00\x08\x0c\x01\xfc\x3c\x62\x43\xc1\xff\xc0\x60\x3e"
-                                      "\x04\x08\x08\x0e\x01\x1A\x00\x18\x0a\x00\x07\x0f\x02\x00\xc6\x50\x40\x0f\xf0\x20"
-                                      "\x40\x81\xfa\x04\x08\x10\x3f\x80\x01\x1B\x00\x16\x0a\x00\x08\x0c\x01\x00\x62\x14"
-                                      "\x08\x00\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x01\x1C\x00\x19\x0a\x00\x08\x0f\x01\x00"
-                                      "\x0c\x32\x21\x00\x1f\x70\x40\xc0\xc0\x8f\xc1\xc1\x41\x71\x1f\x01\x1D\x00\x1a\x0a"
-                                      "\x00\x08\x10\x01\xfc\x18\x34\x42\x00\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03\x03\x06"
-                                      "\x7c\x01\x1E\x00\x19\x0a\x00\x08\x0f\x01\x00\x21\x32\x0c\x00\x1f\x70\x40\xc0\xc0"
-                                      "\x8f\xc1\xc1\x41\x71\x1f\x01\x1F\x00\x1a\x0a\x00\x08\x10\x01\xfc\x42\x26\x1c\x00"
-                                      "\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03\x03\x06\x7c\x01\x20\x00\x19\x0a\x00\x08\x0f"
-                                      "\x01\x00\x08\x0c\x00\x00\x1f\x70\x40\xc0\xc0\x8f\xc1\xc1\x41\x71\x1f\x01\x21\x00"
-                                      "\x1a\x0a\x00\x08\x10\x01\xfc\x08\x18\x00\x00\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03"
-                                      "\x03\x06\x7c\x01\x22\x00\x1a\x0a\x00\x08\x10\x01\xfb\x1f\x70\x40\xc0\xc0\x8f\xc1"
-                                      "\xc1\x41\x71\x1f\x00\x1c\x06\x06\x1c\x01\x23\x00\x1b\x0a\x00\x08\x11\x01\xfc\x1c"
-                                      "\x30\x30\x0c\x00\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03\x03\x06\x7c\x01\x24\x00\x18"
-                                      "\x0a\x00\x07\x0f\x02\x00\x30\x9a\x00\x08\x70\xe1\xc3\x87\xfe\x1c\x38\x70\xe1\x80"
-                                      "\x01\x25\x00\x1e\x0a\x00\x0a\x10\xff\x00\x30\x1a\x08\x40\x00\x10\x04\x01\x00\x40"
-                                      "\x13\x87\x31\x8c\x43\x10\xc4\x31\x0c\x43\x01\x26\x00\x17\x0a\x00\x09\x0b\x01\x00"
-                                      "\x43\x21\xbf\xe8\x64\x33\xf9\x0c\x86\x43\x21\x90\xc0\x01\x27\x00\x18\x0a\x00\x09"
-                                      "\x0c\x00\x00\x20\x10\x3f\x04\x02\x01\x38\xa6\x63\x21\x90\xc8\x64\x30\x01\x28\x00"
-                                      "\x16\x0a\x00\x06\x0f\x02\x00\x66\x58\x80\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0\x01"
-                                      "\x29\x00\x15\x0a\x00\x07\x0c\x02\x00\x63\x3a\x20\x0f\x02\x04\x08\x10\x20\x47\xf0"
-                                      "\x01\x2A\x00\x15\x0a\x00\x06\x0e\x02\x00\xfc\x00\x3f\x30\xc3\x0c\x30\xc3\x0c\x33"
-                                      "\xf0\x01\x2B\x00\x14\x0a\x00\x07\x0b\x02\x00\x7c\x00\x07\x81\x02\x04\x08\x10\x23"
-                                      "\xf8\x01\x2C\x00\x16\x0a\x00\x06\x0f\x02\x00\x85\x33\x80\xfc\xc3\x0c\x30\xc3\x0c"
-                                      "\x30\xcf\xc0\x01\x2D\x00\x15\x0a\x00\x07\x0c\x02\x00\xc4\xd8\xe0\x0f\x02\x04\x08"
-                                      "\x10\x20\x47\xf0\x01\x2E\x00\x16\x0a\x00\x06\x0f\x02\xfc\xfc\xc3\x0c\x30\xc3\x0c"
-                                      "\x30\xcf\xc8\x21\x83\x80\x01\x2F\x00\x18\x0a\x00\x07\x10\x02\xfc\x30\x60\x00\x0f"
-                                      "\x02\x04\x08\x10\x20\x47\xf1\x04\x08\x1c\x01\x30\x00\x16\x0a\x00\x06\x0f\x02\x00"
-                                      "\x30\xc0\x00\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0\x01\x31\x00\x11\x0a\x00\x07\x08"
-                                      "\x02\x00\xf0\x20\x40\x81\x02\x04\x7f\x01\x34\x00\x1d\x0a\x00\x0a\x0f\x01\x00\x03"
-                                      "\x01\x20\x84\x00\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c\xc3\x19\x83\xc0\x01\x35"
-                                      "\x00\x18\x0a\x00\x07\x10\x02\xfc\x1c\x6c\x00\x0f\x81\x02\x04\x08\x10\x20\x40\x81"
-                                      "\x0e\x78\x01\x36\x00\x1a\x0a\x00\x08\x10\x02\xfb\x82\x84\x8c\x98\xb0\xe0\xb0\x98"
-                                      "\x8c\x86\x83\x00\x30\x08\x08\x30\x01\x37\x00\x19\x0a\x00\x07\x11\x02\xfb\x81\x02"
-                                      "\x04\x08\x71\xa4\x70\xb1\x32\x34\x30\x0e\x06\x0c\x70\x01\x39\x00\x19\x0a\x00\x08"
-                                      "\x0f\x01\x00\x10\x60\x80\x00\x40\x40\x40\x40\x40\x40\x40\x40\x40\x40\x7f\x01\x3A"
-                                      "\x00\x1a\x0a\x00\x08\x10\x01\x01\x0c\x10\x00\x00\xf8\x18\x18\x18\x18\x18\x18\x18"
-                                      "\x18\x18\x18\x0f\x01\x3B\x00\x18\x0a\x00\x07\x10\x02\xfb\x81\x02\x04\x08\x10\x20"
-                                      "\x40\x81\x03\xf8\x03\x01\x02\x18\x01\x3C\x00\x1b\x0a\x00\x08\x11\x01\xfb\xf8\x18"
-                                      "\x18\x18\x18\x18\x18\x18\x18\x18\x18\x0f\x00\x38\x0c\x0c\x38\x01\x3D\x00\x14\x0a"
-                                      "\x00\x07\x0b\x02\x00\x89\x12\x24\x48\x10\x20\x40\x81\x03\xf8\x01\x3E\x00\x17\x0a"
-                                      "\x00\x08\x0d\x01\x00\x01\xf9\x19\x19\x18\x18\x18\x18\x18\x18\x18\x18\x0f\x01\x3F"
-                                      "\x00\x14\x0a\x00\x07\x0b\x02\x00\x81\x02\x04\x38\x70\xe0\x40\x81\x03\xf8\x01\x40"
-                                      "\x00\x1b\x0a\x00\x0b\x0c\x01\x00\xf8\x03\x00\x60\x0c\x01\x8c\x31\xc6\x30\xc0\x18"
-                                      "\x03\x00\x60\x07\x80\x01\x41\x00\x15\x0a\x00\x08\x0b\x01\x00\x60\x60\x60\x6c\x78"
-                                      "\x60\xe0\x60\x60\x60\x7f\x01\x42\x00\x16\x0a\x00\x08\x0c\x01\x00\xf8\x18\x18\x18"
-                                      "\x1e\x18\x78\x18\x18\x18\x18\x0f\x01\x43\x00\x18\x0a\x00\x07\x0f\x02\x00\x0c\x30"
-                                      "\x80\x0c\x38\x78\xd1\xb3\x26\x4c\xd8\xb1\xe1\x80\x01\x44\x00\x15\x0a\x00\x07\x0c"
-                                      "\x02\x00\x0c\x20\x80\x09\xdc\xf1\xc3\x87\x0e\x1c\x30\x01\x45\x00\x18\x0a\x00\x07"
-                                      "\x10\x02\xfb\xc3\x87\x8d\x1b\x32\x64\xcd\x8b\x1e\x18\x07\x03\x02\x38\x01\x46\x00"
-                                      "\x16\x0a\x00\x07\x0d\x02\xfb\x9d\xcf\x1c\x38\x70\xe1\xc3\x00\x60\x20\x43\x00\x01"
-                                      "\x47\x00\x18\x0a\x00\x07\x0f\x02\x00\xc4\xf0\x40\x0c\x38\x78\xd1\xb3\x26\x4c\xd8"
-                                      "\xb1\xe1\x80\x01\x48\x00\x15\x0a\x00\x07\x0c\x02\x00\xc4\xf0\x40\x09\xdc\xf1\xc3"
-                                      "\x87\x0e\x1c\x30\x01\x4A\x00\x18\x0a\x00\x07\x0f\x02\xfc\xc3\x87\x8d\x1b\x32\x66"
-                                      "\xc5\x8b\x1e\x18\x30\x20\xcf\x00\x01\x4B\x00\x15\x0a\x00\x07\x0c\x02\xfc\x9d\xcf"
-                                      "\x1c\x38\x70\xe1\xc3\x06\x0c\x39\xe0\x01\x4C\x00\x18\x0a\x00\x08\x0e\x01\x00\x7e"
-                                      "\x00\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x01\x4D\x00\x15\x0a\x00\x08"
-                                      "\x0b\x01\x00\x7e\x00\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x01\x4E\x00\x19\x0a\x00"
-                                      "\x08\x0f\x01\x00\x42\x26\x1c\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x01"
-                                      "\x4F\x00\x16\x0a\x00\x08\x0c\x01\x00\x42\x26\x1c\x00\x3c\x63\xc1\xc1\xc1\xc1\x63"
-                                      "\x3c\x01\x50\x00\x1b\x0a\x00\x09\x0f\x01\x00\x11\x91\x80\x80\x03\xc3\x33\x0d\x82"
-                                      "\xc1\x40\xb0\x58\x2c\x33\x30\xf0\x01\x51\x00\x16\x0a\x00\x08\x0c\x01\x00\x13\x22"
-                                      "\x00\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x01\x52\x00\x18\x0a\x00\x0a\x0b\x00\x00"
-                                      "\x1f\xcd\x86\x61\x18\xc6\x31\xfc\x61\x18\x46\x19\x81\xfc\x01\x53\x00\x14\x0a\x00"
-                                      "\x0a\x08\x00\x00\x3b\x9a\xb4\xc7\x1f\xc4\x13\x06\xe0\xee\x01\x54\x00\x18\x0a\x00"
-                                      "\x07\x0f\x02\x00\x04\x30\x80\x0f\xd0\xe0\xc1\x87\x1b\xc4\xc8\xd0\xe0\x80\x01\x55"
-                                      "\x00\x16\x0a\x00\x08\x0c\x01\x00\x06\x08\x10\x00\xe7\x2e\x28\x30\x20\x20\x20\xfc"
-                                      "\x01\x56\x00\x18\x0a\x00\x07\x10\x02\xfb\xfd\x0e\x0c\x18\x71\xbc\x4c\x8d\x0e\x08"
-                                      "\x03\x01\x02\x18\x01\x57\x00\x17\x0a\x00\x08\x0d\x01\xfb\xe7\x2e\x28\x30\x20\x20"
-                                      "\x20\xfc\x00\x70\x18\x18\x60\x01\x58\x00\x18\x0a\x00\x07\x0f\x02\x00\xc6\x50\x40"
-                                      "\x0f\xd0\xe0\xc1\x87\x1b\xc4\xc8\xd0\xe0\x80\x01\x59\x00\x16\x0a\x00\x08\x0c\x01"
-                                      "\x00\x62\x3c\x18\x00\xe7\x2e\x28\x30\x20\x20\x20\xfc\x01\x5A\x00\x19\x0a\x00\x08"
-                                      "\x0f\x01\x00\x06\x0c\x10\x00\x3f\x63\x40\x40\x70\x1e\x03\x01\x01\xc3\x7e\x01\x5B"
-                                      "\x00\x15\x0a\x00\x07\x0c\x02\x00\x0c\x30\x80\x07\xf8\x20\x78\x1e\x0c\x1f\xe0\x01"
-                                      "\x5C\x00\x19\x0a\x00\x08\x0f\x01\x00\x18\x36\x42\x00\x3f\x63\x40\x40\x70\x1e\x03"
-                                      "\x01\x01\xc3\x7e\x01\x5D\x00\x15\x0a\x00\x07\x0c\x02\x00\x10\xdb\x18\x07\xf8\x20"
-                                      "\x78\x1e\x0c\x1f\xe0\x01\x5E\x00\x19\x0a\x00\x08\x0f\x01\xfc\x3f\x63\x40\x40\x70"
-                                      "\x1e\x03\x01\x01\xc3\x7e\x10\x1e\x06\x3c\x01\x5F\x00\x15\x0a\x00\x07\x0c\x02\xfc"
-                                      "\x7f\x82\x07\x81\xe0\xc1\xfe\x20\x78\x33\x80\x01\x60\x00\x19\x0a\x00\x08\x0f\x01"
-                                      "\x00\x62\x34\x08\x00\x3f\x63\x40\x40\x70\x1e\x03\x01\x01\xc3\x7e\x01\x61\x00\x15"
-                                      "\x0a\x00\x07\x0c\x02\x00\x44\x50\x40\x07\xf8\x20\x78\x1e\x0c\x1f\xe0\x01\x62\x00"
-                                      "\x1c\x0a\x00\x09\x10\x01\xfb\xff\x8c\x06\x03\x01\x80\xc0\x60\x30\x18\x0c\x06\x01"
-                                      "\x01\xc0\x10\x18\x70\x01\x63\x00\x19\x0a\x00\x08\x0f\x01\xfc\x10\x10\x10\xff\x10"
-                                      "\x10\x10\x10\x10\x18\x0f\x08\x0e\x02\x1c\x01\x64\x00\x1b\x0a\x00\x09\x0f\x01\x00"
-                                      "\x62\x1e\x02\x00\x0f\xf8\xc0\x60\x30\x18\x0c\x06\x03\x01\x80\xc0\x60\x01\x65\x00"
-                                      "\x18\x0a\x00\x08\x0e\x01\x00\x02\x02\x02\x12\x10\x10\xff\x10\x10\x10\x10\x10\x18"
-                                      "\x0f\x01\x66\x00\x17\x0a\x00\x09\x0b\x01\x00\xff\x8c\x06\x03\x01\x83\xf0\x60\x30"
-                                      "\x18\x0c\x06\x00\x01\x67\x00\x15\x0a\x00\x08\x0b\x01\x00\x10\x10\x10\xff\x10\x10"
-                                      "\x7e\x10\x10\x18\x0f\x01\x68\x00\x19\x0a\x00\x08\x0f\x01\x00\x32\x4a\x44\x00\xc1"
-                                      "\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x01\x69\x00\x15\x0a\x00\x07\x0c\x02\x00"
-                                      "\x67\x2a\x20\x08\x70\xe1\xc3\x87\x0f\x7f\xb0\x01\x6A\x00\x18\x0a\x00\x08\x0e\x01"
-                                      "\x00\x7e\x00\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x01\x6B\x00\x14\x0a"
-                                      "\x00\x07\x0b\x02\x00\xfc\x00\x04\x38\x70\xe1\xc3\x87\xbf\xd8\x01\x6C\x00\x19\x0a"
-                                      "\x00\x08\x0f\x01\x00\x42\x26\x1c\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c"
-                                      "\x01\x6D\x00\x15\x0a\x00\x07\x0c\x02\x00\x84\x98\xe0\x08\x70\xe1\xc3\x87\x0f\x7f"
-                                      "\xb0\x01\x6E\x00\x1a\x0a\x00\x08\x10\x01\x00\x3c\x22\x26\x1c\x00\xc1\xc1\xc1\xc1"
-                                      "\xc1\xc1\xc1\xc1\xc3\x67\x3c\x01\x6F\x00\x16\x0a\x00\x07\x0d\x02\x00\x78\x89\x31"
-                                      "\xc0\x10\xe1\xc3\x87\x0e\x1e\xff\x60\x01\x70\x00\x1b\x0a\x00\x09\x0f\x01\x00\x11"
-                                      "\x91\x80\x80\x0c\x16\x0b\x05\x82\xc1\x60\xb0\x58\x2c\x33\x38\xf0\x01\x71\x00\x15"
-                                      "\x0a\x00\x07\x0c\x02\x00\x26\x88\x00\x08\x70\xe1\xc3\x87\x0f\x7f\xb0\x01\x72\x00"
-                                      "\x19\x0a\x00\x08\x0f\x01\xfc\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x08\x10"
-                                      "\x10\x1c\x01\x73\x00\x16\x0a\x00\x08\x0c\x02\xfc\x86\x86\x86\x86\x86\x86\xde\xf6"
-                                      "\x04\x04\x0c\x07\x01\x74\x00\x1b\x0a\x00\x09\x0f\x01\x00\x18\x13\x10\x00\x08\x1c"
-                                      "\x0b\x25\x92\xd9\x2c\x95\xca\xe6\x63\x31\x88\x01\x75\x00\x18\x0a\x00\x09\x0c\x01"
-                                      "\x00\x18\x13\x10\x80\x08\x1c\x4b\x25\xb2\x5f\x2b\x99\x8c\xc0\x01\x76\x00\x19\x0a"
-                                      "\x00\x08\x0f\x01\x00\x18\x26\x40\x00\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18"
-                                      "\x01\x77\x00\x1a\x0a\x00\x08\x10\x01\xfc\x1c\x26\x40\x00\xc1\x43\x62\x62\x26\x34"
-                                      "\x1c\x18\x18\x18\x30\xe0\x01\x78\x00\x19\x0a\x00\x08\x0f\x01\x00\x62\x66\x00\x00"
-                                      "\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18\x01\x79\x00\x19\x0a\x00\x08\x0f\x01"
-                                      "\x00\x06\x0c\x10\x00\xff\x03\x06\x04\x0c\x18\x10\x30\x60\x40\xff\x01\x7A\x00\x16"
-                                      "\x0a\x00\x08\x0c\x01\x00\x06\x0c\x10\x00\x7f\x02\x06\x0c\x18\x30\x60\xff\x01\x7B"
-                                      "\x00\x19\x0a\x00\x08\x0f\x01\x00\x18\x18\x00\x00\xff\x03\x06\x04\x0c\x18\x10\x30"
-                                      "\x60\x40\xff\x01\x7C\x00\x16\x0a\x00\x08\x0c\x01\x00\x08\x18\x00\x00\x7f\x02\x06"
-                                      "\x0c\x18\x30\x60\xff\x01\x7D\x00\x19\x0a\x00\x08\x0f\x01\x00\x62\x3c\x08\x00\xff"
-                                      "\x03\x06\x04\x0c\x18\x10\x30\x60\x40\xff\x01\x7E\x00\x16\x0a\x00\x08\x0c\x01\x00"
-                                      "\x62\x14\x08\x00\x7f\x02\x06\x0c\x18\x30\x60\xff\x01\x8F\x00\x15\x0a\x00\x08\x0b"
-                                      "\x01\x00\x7c\x06\x03\x01\x01\xff\xc1\xc1\xc3\x66\x3c\x01\xA0\x00\x19\x0a\x00\x09"
-                                      "\x0d\x01\x00\x00\x80\x4f\xec\xcc\x36\x0b\x05\x02\xc1\x60\xb0\xcc\xc3\xc0\x01\xA1"
-                                      "\x00\x16\x0a\x00\x09\x0a\x01\x00\x00\x80\xcf\xcc\x4c\x16\x0b\x05\x82\x63\x1e\x00"
-                                      "\x01\xAF\x00\x1b\x0a\x00\x0a\x0d\x01\x00\x00\x40\x1c\x1f\x04\xc1\x30\x4c\x13\x04"
-                                      "\xc1\x30\x4c\x31\x9c\x3c\x00\x01\xB0\x00\x16\x0a\x00\x09\x0a\x02\x00\x01\x80\xe1"
-                                      "\xd0\xc8\x64\x32\x19\x0c\xde\x7b\x00\x01\xCD\x00\x1b\x0a\x00\x09\x0f\x01\x00\x62"
-                                      "\x1e\x02\x00\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f\xe4\x36\x0a\x06\x01\xCE\x00\x18"
-                                      "\x0a\x00\x09\x0c\x01\x00\x62\x1e\x02\x00\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70"
-                                      "\x01\xCF\x00\x16\x0a\x00\x06\x0f\x02\x00\xc5\xe1\x00\xfc\xc3\x0c\x30\xc3\x0c\x30"
-                                      "\xcf\xc0\x01\xD0\x00\x15\x0a\x00\x07\x0c\x02\x00\xc4\x50\x40\x0f\x02\x04\x08\x10"
-                                      "\x20\x47\xf0\x01\xD1\x00\x19\x0a\x00\x08\x0f\x01\x00\x62\x3c\x08\x00\x3c\x66\xc3"
-                                      "\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x01\xD2\x00\x16\x0a\x00\x08\x0c\x01\x00\x62\x3c"
-                                      "\x08\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x01\xD3\x00\x19\x0a\x00\x08\x0f\x01\x00"
-                                      "\x62\x3c\x08\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x01\xD4\x00\x15\x0a"
-                                      "\x00\x07\x0c\x02\x00\xc4\xd0\x40\x08\x70\xe1\xc3\x87\x0f\x7f\xb0\x01\xD5\x00\x1c"
-                                      "\x0a\x00\x08\x12\x01\x00\x7e\x00\x00\x62\x66\x00\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1"
-                                      "\xc1\xc3\x67\x3c\x01\xD6\x00\x17\x0a\x00\x07\x0e\x02\x00\x7c\xf8\x06\x60\x00\x21"
-                                      "\xc3\x87\x0e\x1c\x3d\xfe\xc0\x01\xD7\x00\x1c\x0a\x00\x08\x12\x01\x01\x06\x18\x00"
-                                      "\x62\x66\x00\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x01\xD8\x00\x18\x0a"
-                                      "\x00\x07\x10\x02\x00\x04\x38\xc0\x00\x19\x80\x00\x87\x0e\x1c\x38\x70\xf7\xfb\x01"
-                                      "\xD9\x00\x1d\x0a\x00\x08\x13\x01\x00\x40\x26\x1c\x00\x62\x66\x00\x00\xc1\xc1\xc1"
-                                      "\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x01\xDA\x00\x18\x0a\x00\x07\x0f\x02\x01\x4c\x70"
-                                      "\x40\x0c\xc0\x00\x43\x87\x0e\x1c\x38\x7b\xfd\x80\x01\xDB\x00\x1d\x0a\x00\x08\x13"
-                                      "\x01\x00\x40\x70\x18\x00\x62\x66\x00\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67"
-                                      "\x3c\x01\xDC\x00\x18\x0a\x00\x07\x0f\x02\x01\x60\x30\x00\x0c\xc0\x00\x43\x87\x0e"
-                                      "\x1c\x38\x7b\xfd\x80\x01\xE6\x00\x19\x0a\x00\x08\x0f\x01\x00\x23\x1e\x0c\x00\x1f"
-                                      "\x70\x40\xc0\xc0\x8f\xc1\xc1\x41\x71\x1f\x01\xE7\x00\x1a\x0a\x00\x08\x10\x01\xfc"
-                                      "\x62\x3c\x08\x00\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03\x03\x06\x7c\x01\xEA\x00\x19"
-                                      "\x0a\x00\x08\x0f\x01\xfc\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x10\x10\x10"
-                                      "\x1c\x01\xEB\x00\x16\x0a\x00\x08\x0c\x01\xfc\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x10"
-                                      "\x10\x10\x1c\x01\xF0\x00\x18\x0a\x00\x07\x10\x02\xfc\x62\x28\x20\x0f\x81\x02\x04"
-                                      "\x08\x10\x20\x40\x81\x0e\x78\x01\xF8\x00\x18\x0a\x00\x07\x0f\x02\x00\xc0\x60\x00"
-                                      "\x0c\x38\x78\xd1\xb3\x26\x4c\xd8\xb1\xe1\x80\x01\xF9\x00\x15\x0a\x00\x07\x0c\x02"
-                                      "\x00\x40\x60\x00\x09\xdc\xf1\xc3\x87\x0e\x1c\x30\x02\x18\x00\x1a\x0a\x00\x08\x10"
-                                      "\x01\xfb\x3f\x63\x40\x40\x70\x1e\x03\x01\x01\xc3\x7e\x00\x38\x0c\x0c\x38\x02\x19"
-                                      "\x00\x16\x0a\x00\x07\x0d\x02\xfb\x7f\x82\x07\x81\xe0\xc1\xfe\x00\xe0\x60\xc7\x00"
-                                      "\x02\x1A\x00\x1c\x0a\x00\x09\x10\x01\xfb\xff\x8c\x06\x03\x01\x80\xc0\x60\x30\x18"
-                                      "\x0c\x06\x00\x03\x80\x60\x10\x70\x02\x1B\x00\x1a\x0a\x00\x08\x10\x01\xfb\x10\x10"
-                                      "\x10\xff\x10\x10\x10\x10\x10\x18\x0f\x00\x18\x04\x04\x18\x02\x26\x00\x1b\x0a\x00"
-                                      "\x09\x0f\x01\x00\x18\x0c\x00\x00\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f\xe4\x36\x0a"
-                                      "\x06\x02\x27\x00\x18\x0a\x00\x09\x0c\x01\x00\x08\x0c\x00\x00\x07\xc0\x30\x08\x7c"
-                                      "\xc2\x61\x33\x8f\x70\x02\x2E\x00\x19\x0a\x00\x08\x0f\x01\x00\x08\x18\x00\x00\x3c"
-                                      "\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x02\x2F\x00\x16\x0a\x00\x08\x0c\x01\x00"
-                                      "\x08\x18\x00\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x02\x32\x00\x18\x0a\x00\x08\x0e"
-                                      "\x01\x00\x7e\x00\x00\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18\x02\x33\x00\x19"
-                                      "\x0a\x00\x08\x0f\x01\xfc\x7e\x00\x00\xc1\x43\x62\x62\x26\x34\x1c\x18\x18\x18\x30"
-                                      "\xe0\x02\x37\x00\x12\x0a\x00\x05\x0c\x02\xfc\xf8\x42\x10\x84\x21\x08\x4f\xe0\x02"
-                                      "\x59\x00\x12\x0a\x00\x08\x08\x01\x00\x3c\x03\x01\xff\xc1\x43\x66\x3c\x02\xB9\x00"
-                                      "\x0c\x0a\x00\x02\x05\x04\x07\xff\xc0\x02\xBA\x00\x0e\x0a\x00\x06\x05\x02\x07\xcf"
-                                      "\x1c\x71\xc4\x02\xBB\x00\x0d\x0a\x00\x04\x05\x03\x07\x13\x66\xe0\x02\xBC\x00\x0d"
-                                      "\x0a\x00\x04\x05\x03\x07\x33\x66\xc0\x02\xBE\x00\x0e\x0a\x00\x04\x07\x03\x05\xe3"
-                                      "\x11\x13\xc0\x02\xBF\x00\x0e\x0a\x00\x04\x07\x03\x05\x7c\x88\x8c\x70\x02\xC6\x00"
-                                      "\x0d\x0a\x00\x06\x03\x02\x09\x31\xa8\x40\x02\xC7\x00\x0d\x0a\x00\x06\x03\x02\x09"
-                                      "\x85\xa3\x00\x02\xC8\x00\x0c\x0a\x00\x02\x07\x04\x05\xff\xfc\x02\xCC\x00\x0c\x0a"
-                                      "\x00\x02\x07\x04\xfc\xff\xfc\x02\xCD\x00\x0b\x0a\x00\x06\x01\x02\xfd\xfc\x02\xD8"
-                                      "\x00\x0d\x0a\x00\x06\x03\x02\x09\x85\x37\x80\x02\xD9\x00\x0b\x0a\x00\x02\x02\x04"
-                                      "\x0a\xf0\x02\xDA\x00\x0d\x0a\x00\x05\x04\x03\x09\x74\x63\xe0\x02\xDB\x00\x0c\x0a"
-                                      "\x00\x04\x04\x03\xfc\x24\xc7\x02\xDC\x00\x0d\x0a\x00\x07\x03\x02\x09\x67\x6a\x70"
-                                      "\x02\xDD\x00\x0d\x0a\x00\x07\x03\x02\x09\x22\x8a\x20\x03\x00\x00\x0c\x00\x00\x03"
-                                      "\x03\xfe\x09\x98\x80\x03\x01\x00\x0c\x00\x00\x03\x03\xff\x09\x2e\x00\x03\x02\x00"
-                                      "\x0d\x00\x00\x06\x03\xfd\x09\x31\x28\x40\x03\x03\x00\x0d\x00\x00\x06\x03\xfd\x09"
-                                      "\x66\xd9\x80\x03\x04\x00\x0b\x00\x00\x06\x01\xfd\x0a\xfc\x03\x06\x00\x0d\x00\x00"
-                                      "\x06\x03\xfd\x09\x87\x37\x80\x03\x07\x00\x0b\x00\x00\x02\x02\xff\x0a\xf0\x03\x08"
-                                      "\x00\x0c\x00\x00\x06\x02\xfd\x0a\xcf\x30\x03\x09\x00\x0c\x00\x00\x04\x04\xfe\x09"
-                                      "\xe3\x3e\x03\x0A\x00\x0c\x00\x00\x04\x04\xfe\x09\xf9\x9f\x03\x0B\x00\x0d\x00\x00"
-                                      "\x07\x03\xfd\x09\x66\x8a\x20\x03\x0C\x00\x0d\x00\x00\x06\x03\xfd\x09\x85\x23\x00"
-                                      "\x03\x12\x00\x0c\x00\x00\x04\x04\xfe\x09\x7c\xc7\x03\x15\x00\x0b\x00\x00\x01\x04"
-                                      "\x00\x08\xf0\x03\x23\x00\x0b\x00\x00\x02\x02\xff\xfc\xf0\x03\x24\x00\x0c\x00\x00"
-                                      "\x06\x02\xfd\xfc\xcf\x30\x03\x26\x00\x0c\x00\x00\x04\x04\xfe\xfb\xe3\x3e\x03\x27"
-                                      "\x00\x0e\x00\x00\x05\x05\xfe\xfb\x43\x06\x3e\x00\x03\x28\x00\x0c\x00\x00\x03\x04"
-                                      "\xfe\xfc\x4a\x70\x03\x2D\x00\x0d\x00\x00\x06\x03\xfd\xfc\x31\x28\x40\x03\x2E\x00"
-                                      "\x0d\x00\x00\x06\x03\xfd\xfc\x87\x37\x80\x03\x31\x00\x0b\x00\x00\x06\x01\xfd\xfd"
-                                      "\xfc\x0E\x3F\x00\x19\x0a\x00\x08\x0f\x02\xfe\x10\x10\xfc\x96\x92\x92\x96\xf8\x96"
-                                      "\x92\x93\x96\xfc\x10\x10\x1E\x06\x00\x18\x0a\x00\x08\x0e\x02\xfd\xfc\x86\x82\x86"
-                                      "\x8c\xf8\x86\x82\x83\x86\xfc\x00\x00\xfc\x1E\x07\x00\x18\x0a\x00\x07\x0f\x02\xfd"
-                                      "\x81\x02\x04\x0b\xd8\xe0\xc1\x83\x07\x3f\xc0\x00\x3f\x00\x1E\x0C\x00\x19\x0a\x00"
-                                      "\x08\x0f\x02\xfc\xf0\x9c\x86\x82\x82\x83\x82\x82\x86\x9c\xf0\x00\x00\x30\x30\x1E"
-                                      "\x0D\x00\x1a\x0a\x00\x08\x10\x01\xfc\x03\x03\x03\x03\x3f\x67\xc3\xc3\xc3\xc3\x67"
-                                      "\x39\x00\x00\x18\x18\x1E\x0E\x00\x18\x0a\x00\x08\x0e\x02\xfd\xf0\x9c\x86\x82\x82"
-                                      "\x83\x82\x82\x86\x9c\xf0\x00\x00\xfc\x1E\x0F\x00\x19\x0a\x00\x08\x0f\x01\xfd\x03"
-                                      "\x03\x03\x03\x3f\x67\xc3\xc3\xc3\xc3\x67\x39\x00\x00\x7e\x1E\x12\x00\x19\x0a\x00"
-                                      "\x08\x0f\x02\xfc\xf0\x9c\x86\x82\x82\x83\x82\x82\x86\x9c\xf0\x00\x30\x58\x84\x1E"
-                                      "\x13\x00\x1a\x0a\x00\x08\x10\x01\xfc\x03\x03\x03\x03\x3f\x67\xc3\xc3\xc3\xc3\x67"
-                                      "\x39\x00\x18\x34\x42\x1E\x20\x00\x18\x0a\x00\x08\x0e\x01\x00\x3f\x00\x00\x1f\x70"
-                                      "\x40\xc0\xc0\x8f\xc1\xc1\x41\x71\x1f\x1E\x21\x00\x19\x0a\x00\x08\x0f\x01\xfc\x7e"
-                                      "\x00\x00\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03\x03\x06\x7c\x1E\x24\x00\x18\x0a\x00"
-                                      "\x07\x0f\x02\xfc\x87\x0e\x1c\x38\x7f\xe1\xc3\x87\x0e\x18\x00\x06\x0c\x00\x1E\x25"
-                                      "\x00\x18\x0a\x00\x07\x10\x02\xfc\x81\x02\x04\x09\xdc\xf1\xc3\x87\x0e\x1c\x30\x00"
-                                      "\x0c\x18\x1E\x28\x00\x1a\x0a\x00\x08\x10\x01\xfb\x43\x43\x43\x43\x43\x7f\x43\x43"
-                                      "\x43\x43\x43\x40\xe0\x10\x30\xc0\x1E\x29\x00\x1b\x0a\x00\x08\x11\x01\xfb\x40\x40"
-                                      "\x40\x40\x4e\x73\x63\x43\x43\x43\x43\x43\x40\xe0\x10\x30\xc0\x1E\x2A\x00\x18\x0a"
-                                      "\x00\x07\x0f\x02\xfc\x87\x0e\x1c\x38\x7f\xe1\xc3\x87\x0e\x18\x08\x49\x9e\x00\x1E"
-                                      "\x2B\x00\x18\x0a\x00\x07\x10\x02\xfc\x81\x02\x04\x09\xdc\xf1\xc3\x87\x0e\x1c\x30"
-                                      "\x10\x91\x1c\x1E\x32\x00\x19\x0a\x00\x08\x0f\x02\xfc\x82\x84\x8c\x98\xb0\xe0\xb0"
-                                      "\x98\x8c\x86\x83\x00\x00\x10\x30\x1E\x33\x00\x18\x0a\x00\x07\x10\x02\xfc\x81\x02"
-                                      "\x04\x08\x71\xa4\x70\xb1\x32\x34\x30\x00\x0c\x18\x1E\x34\x00\x18\x0a\x00\x08\x0e"
-                                      "\x02\xfd\x82\x84\x8c\x98\xb0\xe0\xb0\x98\x8c\x86\x83\x00\x00\x7c\x1E\x35\x00\x18"
-                                      "\x0a\x00\x07\x0f\x02\xfd\x81\x02\x04\x08\x71\xa4\x70\xb1\x32\x34\x30\x00\x3f\x00"
-                                      "\x1E\x36\x00\x18\x0a\x00\x07\x0f\x02\xfc\x81\x02\x04\x08\x10\x20\x40\x81\x03\xf8"
-                                      "\x00\x03\x06\x00\x1E\x37\x00\x1a\x0a\x00\x08\x10\x01\xfc\xf8\x18\x18\x18\x18\x18"
-                                      "\x18\x18\x18\x18\x18\x0f\x00\x00\x18\x18\x1E\x38\x00\x1f\x0a\x00\x09\x12\x00\xfc"
-                                      "\xf8\x00\x00\x04\x02\x01\x00\x80\x40\x20\x10\x08\x04\x02\x01\xfc\x00\x00\x06\x03"
-                                      "\x00\x1E\x39\x00\x1d\x0a\x00\x08\x13\x01\xfc\x7e\x00\x00\xf8\x18\x18\x18\x18\x18"
-                                      "\x18\x18\x18\x18\x18\x0f\x00\x00\x18\x18\x1E\x3A\x00\x17\x0a\x00\x07\x0e\x02\xfd"
-                                      "\x81\x02\x04\x08\x10\x20\x40\x81\x03\xf8\x00\x0f\x80\x1E\x3B\x00\x19\x0a\x00\x08"
-                                      "\x0f\x01\xfd\xf8\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x0f\x00\x00\x7e\x1E\x3C"
-                                      "\x00\x18\x0a\x00\x07\x0f\x02\xfc\x81\x02\x04\x08\x10\x20\x40\x81\x03\xf8\x01\x85"
-                                      "\x90\x80\x1E\x3D\x00\x1a\x0a\x00\x08\x10\x01\xfc\xf8\x18\x18\x18\x18\x18\x18\x18"
-                                      "\x18\x18\x18\x0f\x00\x18\x34\x42\x1E\x3E\x00\x19\x0a\x00\x08\x0f\x01\x00\x06\x0c"
-                                      "\x10\x00\xc3\xe3\xe5\xe5\xd5\xd9\xd9\xc9\xc1\x81\x81\x1E\x3F\x00\x18\x0a\x00\x09"
-                                      "\x0c\x01\x00\x06\x04\x04\x00\x0b\xb7\xef\x27\x13\x89\xc4\xe2\x71\x30\x1E\x40\x00"
-                                      "\x19\x0a\x00\x08\x0f\x01\x00\x08\x18\x00\x00\xc3\xe3\xe5\xe5\xd5\xd9\xd9\xc9\xc1"
-                                      "\x81\x81\x1E\x41\x00\x18\x0a\x00\x09\x0c\x01\x00\x08\x0c\x00\x00\x0b\xb7\xef\x27"
-                                      "\x13\x89\xc4\xe2\x71\x30\x1E\x42\x00\x19\x0a\x00\x08\x0f\x01\xfc\xc3\xe3\xe5\xe5"
-                                      "\xd5\xd9\xd9\xc9\xc1\x81\x81\x00\x00\x18\x18\x1E\x43\x00\x18\x0a\x00\x09\x0c\x01"
-                                      "\xfc\xbb\x7e\xf2\x71\x38\x9c\x4e\x27\x13\x00\x00\x06\x03\x00\x1E\x44\x00\x18\x0a"
-                                      "\x00\x07\x0f\x02\x00\x10\x60\x00\x0c\x38\x78\xd1\xb3\x26\x4c\xd8\xb1\xe1\x80\x1E"
-                                      "\x45\x00\x15\x0a\x00\x07\x0c\x02\x00\x10\x60\x00\x09\xdc\xf1\xc3\x87\x0e\x1c\x30"
-                                      "\x1E\x46\x00\x18\x0a\x00\x07\x0f\x02\xfc\xc3\x87\x8d\x1b\x32\x64\xcd\x8b\x1e\x18"
-                                      "\x00\x06\x0c\x00\x1E\x47\x00\x15\x0a\x00\x07\x0c\x02\xfc\x9d\xcf\x1c\x38\x70\xe1"
-                                      "\xc3\x00\x00\xc1\x80\x1E\x48\x00\x17\x0a\x00\x07\x0e\x02\xfd\xc3\x87\x8d\x1b\x32"
-                                      "\x64\xcd\x8b\x1e\x18\x00\x1f\x80\x1E\x49\x00\x14\x0a\x00\x07\x0b\x02\xfd\x9d\xcf"
-                                      "\x1c\x38\x70\xe1\xc3\x00\x03\xf0\x1E\x4A\x00\x18\x0a\x00\x07\x0f\x02\xfc\xc3\x87"
-                                      "\x8d\x1b\x32\x64\xcd\x8b\x1e\x18\x03\x0d\x21\x00\x1E\x4B\x00\x15\x0a\x00\x07\x0c"
-                                      "\x02\xfc\x9d\xcf\x1c\x38\x70\xe1\xc3\x00\x61\xa4\x20\x1E\x58\x00\x18\x0a\x00\x07"
-                                      "\x0f\x02\x00\x10\x70\x00\x0f\xd0\xe0\xc1\x87\x1b\xc4\xc8\xd0\xe0\x80\x1E\x59\x00"
-                                      "\x16\x0a\x00\x08\x0c\x01\x00\x18\x18\x00\x00\xe7\x2e\x28\x30\x20\x20\x20\xfc\x1E"
-                                      "\x5A\x00\x18\x0a\x00\x07\x0f\x02\xfc\xfd\x0e\x0c\x18\x71\xbc\x4c\x8d\x0e\x08\x00"
-                                      "\x06\x0c\x00\x1E\x5B\x00\x16\x0a\x00\x08\x0c\x01\xfc\xe7\x2e\x28\x30\x20\x20\x20"
-                                      "\xfc\x00\x00\x30\x30\x1E\x5C\x00\x1a\x0a\x00\x07\x12\x02\xfc\x7c\x00\x07\xe8\x70"
-                                      "\x60\xc3\x8d\xe2\x64\x68\x70\x40\x00\x30\x60\x1E\x5D\x00\x19\x0a\x00\x08\x0f\x01"
-                                      "\xfc\x7e\x00\x00\xe7\x2e\x28\x30\x20\x20\x20\xfc\x00\x00\x30\x30\x1E\x5E\x00\x17"
-                                      "\x0a\x00\x07\x0e\x02\xfd\xfd\x0e\x0c\x18\x71\xbc\x4c\x8d\x0e\x08\x00\x0f\x80\x1E"
-                                      "\x5F\x00\x15\x0a\x00\x08\x0b\x01\xfd\xe7\x2e\x28\x30\x20\x20\x20\xfc\x00\x00\xfc"
-                                      "\x1E\x62\x00\x19\x0a\x00\x08\x0f\x01\xfc\x3f\x63\x40\x40\x70\x1e\x03\x01\x01\xc3"
-                                      "\x7e\x00\x00\x18\x18\x1E\x63\x00\x15\x0a\x00\x07\x0c\x02\xfc\x7f\x82\x07\x81\xe0"
-                                      "\xc1\xfe\x00\x00\xc1\x80\x1E\x6C\x00\x1b\x0a\x00\x09\x0f\x01\xfc\xff\x8c\x06\x03"
-                                      "\x01\x80\xc0\x60\x30\x18\x0c\x06\x00\x00\x00\xc0\x60\x1E\x6D\x00\x19\x0a\x00\x08"
-                                      "\x0f\x01\xfc\x10\x10\x10\xff\x10\x10\x10\x10\x10\x18\x0f\x00\x00\x0c\x0c\x1E\x6E"
-                                      "\x00\x1a\x0a\x00\x09\x0e\x01\xfd\xff\x8c\x06\x03\x01\x80\xc0\x60\x30\x18\x0c\x06"
-                                      "\x00\x00\x03\xf0\x1E\x6F\x00\x18\x0a\x00\x08\x0e\x01\xfd\x10\x10\x10\xff\x10\x10"
-                                      "\x10\x10\x10\x18\x0f\x00\x00\x3e\x1E\x70\x00\x1b\x0a\x00\x09\x0f\x01\xfc\xff\x8c"
-                                      "\x06\x03\x01\x80\xc0\x60\x30\x18\x0c\x06\x00\x01\x81\xa1\x08\x1E\x71\x00\x19\x0a"
-                                      "\x00\x08\x0f\x01\xfc\x10\x10\x10\xff\x10\x10\x10\x10\x10\x18\x0f\x00\x0c\x16\x23"
-                                      "\x1E\x7E\x00\x1b\x0a\x00\x09\x0f\x01\xfc\x81\xe0\x90\xc8\x66\x21\x10\x98\x68\x14"
-                                      "\x0e\x06\x00\x00\x00\xc0\x60\x1E\x7F\x00\x16\x0a\x00\x08\x0c\x01\xfc\xc1\x43\x62"
-                                      "\x62\x26\x34\x1c\x18\x00\x00\x18\x18\x1E\x80\x00\x1b\x0a\x00\x09\x0f\x01\x00\x60"
-                                      "\x0c\x00\x00\x08\x1c\x0b\x25\x92\xd9\x2c\x95\xca\xe6\x63\x31\x88\x1E\x81\x00\x18"
-                                      "\x0a\x00\x09\x0c\x01\x00\x20\x0c\x00\x00\x08\x1c\x4b\x25\xb2\x5f\x2b\x99\x8c\xc0"
-                                      "\x1E\x82\x00\x1b\x0a\x00\x09\x0f\x01\x00\x06\x06\x04\x00\x08\x1c\x0b\x25\x92\xd9"
-                                      "\x2c\x95\xca\xe6\x63\x31\x88\x1E\x83\x00\x18\x0a\x00\x09\x0c\x01\x00\x06\x04\x04"
-                                      "\x00\x08\x1c\x4b\x25\xb2\x5f\x2b\x99\x8c\xc0\x1E\x84\x00\x1b\x0a\x00\x09\x0f\x01"
-                                      "\x00\x62\x33\x00\x00\x08\x1c\x0b\x25\x92\xd9\x2c\x95\xca\xe6\x63\x31\x88\x1E\x85"
-                                      "\x00\x18\x0a\x00\x09\x0c\x01\x00\x22\x33\x00\x00\x08\x1c\x4b\x25\xb2\x5f\x2b\x99"
-                                      "\x8c\xc0\x1E\x8C\x00\x19\x0a\x00\x08\x0f\x01\x00\x62\x66\x00\x00\xc3\x62\x26\x34"
-                                      "\x18\x18\x1c\x34\x66\x43\xc1\x1E\x8D\x00\x16\x0a\x00\x08\x0c\x01\x00\x22\x66\x00"
-                                      "\x00\x43\x66\x34\x18\x1c\x34\x66\xc3\x1E\x8E\x00\x19\x0a\x00\x08\x0f\x01\x00\x08"
-                                      "\x18\x00\x00\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18\x1E\x8F\x00\x1a\x0a\x00"
-                                      "\x08\x10\x01\xfc\x08\x18\x00\x00\xc1\x43\x62\x62\x26\x34\x1c\x18\x18\x18\x30\xe0"
-                                      "\x1E\x90\x00\x19\x0a\x00\x08\x0f\x01\x00\x1c\x26\x40\x00\xff\x03\x06\x04\x0c\x18"
-                                      "\x10\x30\x60\x40\xff\x1E\x91\x00\x16\x0a\x00\x08\x0c\x01\x00\x1c\x26\x00\x00\x7f"
-                                      "\x02\x06\x0c\x18\x30\x60\xff\x1E\x92\x00\x19\x0a\x00\x08\x0f\x01\xfc\xff\x03\x06"
-                                      "\x04\x0c\x18\x10\x30\x60\x40\xff\x00\x00\x18\x18\x1E\x93\x00\x16\x0a\x00\x08\x0c"
-                                      "\x01\xfc\x7f\x02\x06\x0c\x18\x30\x60\xff\x00\x00\x18\x18\x1E\x94\x00\x18\x0a\x00"
-                                      "\x08\x0e\x01\xfd\xff\x03\x06\x04\x0c\x18\x10\x30\x60\x40\xff\x00\x00\x7e\x1E\x95"
-                                      "\x00\x15\x0a\x00\x08\x0b\x01\xfd\x7f\x02\x06\x0c\x18\x30\x60\xff\x00\x00\x3e\x1E"
-                                      "\x96\x00\x18\x0a\x00\x07\x0f\x02\xfd\x81\x02\x04\x09\xdc\xf1\xc3\x87\x0e\x1c\x30"
-                                      "\x00\x3f\x00\x1E\x9E\x00\x17\x0a\x00\x09\x0b\x01\x00\x3c\x31\x90\xc8\x4c\x46\x23"
-                                      "\x0d\x82\xc1\xe0\xf3\xc0\x1E\xA0\x00\x1b\x0a\x00\x09\x0f\x01\xfc\x18\x0e\x0f\x06"
-                                      "\x82\x63\x31\x88\xfe\x43\x60\xa0\x60\x00\x00\xc0\x60\x1E\xA1\x00\x18\x0a\x00\x09"
-                                      "\x0c\x01\xfc\x7c\x03\x00\x87\xcc\x26\x13\x38\xf7\x00\x00\x06\x03\x00\x1E\xA2\x00"
-                                      "\x1b\x0a\x00\x09\x0f\x01\x00\x1c\x02\x06\x00\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f"
-                                      "\xe4\x36\x0a\x06\x1E\xA3\x00\x19\x0a\x00\x09\x0d\x01\x00\x38\x02\x03\x02\x00\x03"
-                                      "\xe0\x18\x04\x3e\x61\x30\x99\xc7\xb8\x1E\xA4\x00\x1e\x0a\x00\x09\x11\x01\x00\x01"
-                                      "\x81\x06\x04\xc4\x20\x00\x60\x38\x3c\x1a\x09\x8c\xc6\x23\xf9\x0d\x82\x81\x80\x1E"
-                                      "\xA5\x00\x1b\x0a\x00\x09\x0f\x01\x00\x01\x81\x80\x83\x02\x62\x10\x00\xf8\x06\x01"
-                                      "\x0f\x98\x4c\x26\x71\xee\x1E\xA6\x00\x1f\x0a\x00\x09\x12\x01\x00\x04\x01\x80\x43"
-                                      "\x02\x62\x10\x00\x30\x1c\x1e\x0d\x04\xc6\x63\x11\xfc\x86\xc1\x40\xc0\x1E\xA7\x00"
-                                      "\x1b\x0a\x00\x09\x0f\x01\x00\x04\x01\x00\x43\x02\x62\x10\x00\xf8\x06\x01\x0f\x98"
-                                      "\x4c\x26\x71\xee\x1E\xA8\x00\x1f\x0a\x00\x09\x12\x01\x00\x07\x80\x40\xc3\x02\x62"
-                                      "\x10\x00\x30\x1c\x1e\x0d\x04\xc6\x63\x11\xfc\x86\xc1\x40\xc0\x1E\xA9\x00\x1b\x0a"
-                                      "\x00\x09\x0f\x01\x00\x07\x80\x40\xc3\x02\x62\x10\x00\xf8\x06\x01\x0f\x98\x4c\x26"
-                                      "\x71\xee\x1E\xAA\x00\x20\x0a\x00\x09\x13\x01\x00\x32\x15\x01\x00\x01\x81\x31\x08"
-                                      "\x00\x18\x0e\x0f\x06\x82\x63\x31\x88\xfe\x43\x60\xa0\x60\x1E\xAB\x00\x1b\x0a\x00"
-                                      "\x09\x0f\x01\x00\x32\x35\x11\x03\x02\x62\x10\x00\xf8\x06\x01\x0f\x98\x4c\x26\x71"
-                                      "\xee\x1E\xAC\x00\x20\x0a\x00\x09\x13\x01\xfc\x18\x13\x10\x80\x01\x80\xe0\xf0\x68"
-                                      "\x26\x33\x18\x8f\xe4\x36\x0a\x06\x00\x00\x0c\x06\x00\x1E\xAD\x00\x1c\x0a\x00\x09"
-                                      "\x10\x01\xfc\x18\x13\x10\x80\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70\x00\x00\x60"
-                                      "\x30\x1E\xAE\x00\x1f\x0a\x00\x09\x12\x01\x00\x02\x06\x04\x08\x42\x60\xe0\x00\x30"
-                                      "\x1c\x1e\x0d\x04\xc6\x63\x11\xfc\x86\xc1\x40\xc0\x1E\xAF\x00\x1b\x0a\x00\x09\x0f"
-                                      "\x01\x00\x02\x06\x04\x08\x42\x60\xe0\x00\xf8\x06\x01\x0f\x98\x4c\x26\x71\xee\x1E"
-                                      "\xB0\x00\x1f\x0a\x00\x09\x12\x01\x00\x60\x1c\x02\x08\x42\x60\xe0\x00\x30\x1c\x1e"
-                                      "\x0d\x04\xc6\x63\x11\xfc\x86\xc1\x40\xc0\x1E\xB1\x00\x1b\x0a\x00\x09\x0f\x01\x00"
-                                      "\x60\x1c\x02\x08\x42\x60\xe0\x00\xf8\x06\x01\x0f\x98\x4c\x26\x71\xee\x1E\xB2\x00"
-                                      "\x1f\x0a\x00\x09\x12\x01\x00\x3c\x02\x06\x08\x42\x60\xe0\x00\x30\x1c\x1e\x0d\x04"
-                                      "\xc6\x63\x11\xfc\x86\xc1\x40\xc0\x1E\xB3\x00\x1b\x0a\x00\x09\x0f\x01\x00\x1c\x02"
-                                      "\x06\x08\x42\x60\xe0\x00\xf8\x06\x01\x0f\x98\x4c\x26\x71\xee\x1E\xB4\x00\x20\x0a"
-                                      "\x00\x09\x13\x01\x00\x32\x25\x11\x00\x04\x21\x30\x70\x00\x18\x0e\x0f\x06\x82\x63"
-                                      "\x31\x88\xfe\x43\x60\xa0\x60\x1E\xB5\x00\x1c\x0a\x00\x09\x10\x01\x00\x32\x25\x11"
-                                      "\x00\x04\x21\x30\x70\x00\x7c\x03\x00\x87\xcc\x26\x13\x38\xf7\x1E\xB6\x00\x20\x0a"
-                                      "\x00\x09\x13\x01\xfc\x42\x13\x07\x00\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f\xe4\x36"
-                                      "\x0a\x06\x00\x00\x0c\x06\x00\x1E\xB7\x00\x1c\x0a\x00\x09\x10\x01\xfc\x42\x13\x07"
-                                      "\x00\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70\x00\x00\x60\x30\x1E\xB8\x00\x18\x0a"
-                                      "\x00\x07\x0f\x02\xfc\xff\x02\x04\x08\x1f\xa0\x40\x81\x03\xf8\x00\x03\x06\x00\x1E"
-                                      "\xB9\x00\x16\x0a\x00\x08\x0c\x01\xfc\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x00\x00\x08"
-                                      "\x18\x1E\xBA\x00\x18\x0a\x00\x07\x0f\x02\x00\x3c\x18\xc0\x0f\xf0\x20\x40\x81\xfa"
-                                      "\x04\x08\x10\x3f\x80\x1E\xBB\x00\x17\x0a\x00\x08\x0d\x01\x00\x3c\x04\x0c\x10\x00"
-                                      "\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x1E\xBC\x00\x18\x0a\x00\x07\x0f\x02\x00\x62\xba"
-                                      "\x30\x0f\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f\x80\x1E\xBD\x00\x16\x0a\x00\x08\x0c"
-                                      "\x01\x00\x31\x4e\x44\x00\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x1E\xBE\x00\x1b\x0a\x00"
-                                      "\x08\x11\x02\x00\x03\x00\x38\x6c\x00\x00\xfe\x80\x80\x80\x80\xfc\x80\x80\x80\x80"
-                                      "\xfe\x1E\xBF\x00\x1b\x0a\x00\x09\x0f\x01\x00\x00\x80\xc0\x83\x03\x63\x10\x00\x7c"
-                                      "\x63\x20\xbf\xd8\x0c\x03\x00\xf8\x1E\xC0\x00\x1a\x0a\x00\x07\x12\x02\x00\x0c\x0c"
-                                      "\x01\xc6\xc0\x00\x7f\x81\x02\x04\x0f\xd0\x20\x40\x81\xfc\x1E\xC1\x00\x19\x0a\x00"
-                                      "\x08\x0f\x01\x00\x04\x02\x01\x18\x36\x62\x00\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x1E"
-                                      "\xC2\x00\x1c\x0a\x00\x08\x12\x02\x00\x0f\x01\x06\x38\x6c\x00\x00\xfe\x80\x80\x80"
-                                      "\x80\xfc\x80\x80\x80\x80\xfe\x1E\xC3\x00\x1b\x0a\x00\x09\x0f\x01\x00\x03\x80\x40"
-                                      "\xc3\x03\x63\x10\x00\x7c\x63\x20\xbf\xd8\x0c\x03\x00\xf8\x1E\xC4\x00\x1b\x0a\x00"
-                                      "\x07\x13\x02\x00\x32\xbd\x10\x03\x8d\x80\x00\xff\x02\x04\x08\x1f\xa0\x40\x81\x03"
-                                      "\xf8\x1E\xC5\x00\x19\x0a\x00\x08\x0f\x01\x00\x31\x2a\x46\x18\x36\x62\x00\x3e\x63"
-                                      "\x41\xff\xc0\xc0\x60\x3e\x1E\xC6\x00\x1b\x0a\x00\x07\x13\x02\xfc\x38\xd8\x00\x0f"
-                                      "\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f\x80\x00\x30\x60\x1E\xC7\x00\x1a\x0a\x00\x08"
-                                      "\x10\x01\xfc\x18\x34\x62\x00\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x00\x00\x08\x18\x1E"
-                                      "\xC8\x00\x16\x0a\x00\x06\x0f\x02\x00\x38\x33\x00\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf"
-                                      "\xc0\x1E\xC9\x00\x16\x0a\x00\x07\x0d\x02\x00\x78\x10\x61\x00\x1e\x04\x08\x10\x20"
-                                      "\x40\x8f\xe0\x1E\xCA\x00\x16\x0a\x00\x06\x0f\x02\xfc\xfc\xc3\x0c\x30\xc3\x0c\x30"
-                                      "\xcf\xc0\x00\xc3\x00\x1E\xCB\x00\x18\x0a\x00\x07\x10\x02\xfc\x30\x60\x00\x0f\x02"
-                                      "\x04\x08\x10\x20\x47\xf0\x00\x04\x08\x1E\xCC\x00\x19\x0a\x00\x08\x0f\x01\xfc\x3c"
-                                      "\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x00\x00\x18\x18\x1E\xCD\x00\x16\x0a\x00"
-                                      "\x08\x0c\x01\xfc\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x00\x00\x18\x18\x1E\xCE\x00\x19"
-                                      "\x0a\x00\x08\x0f\x01\x00\x1c\x06\x18\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66"
-                                      "\x3c\x1E\xCF\x00\x17\x0a\x00\x08\x0d\x01\x00\x38\x04\x0c\x10\x00\x3c\x63\xc1\xc1"
-                                      "\xc1\xc1\x63\x3c\x1E\xD0\x00\x1e\x0a\x00\x09\x11\x01\x00\x01\x81\x06\x06\x84\x20"
-                                      "\x00\xf0\xcc\xc3\x60\xb0\x50\x2c\x16\x0b\x0c\xcc\x3c\x00\x1E\xD1\x00\x1b\x0a\x00"
-                                      "\x09\x0f\x01\x00\x00\x80\x80\x83\x03\x42\x10\x00\x78\x63\x60\xb0\x58\x2c\x13\x18"
-                                      "\xf0\x1E\xD2\x00\x1c\x0a\x00\x08\x12\x01\x00\x04\x07\x01\x18\x34\x42\x00\x3c\x66"
-                                      "\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x1E\xD3\x00\x19\x0a\x00\x08\x0f\x01\x00\x04"
-                                      "\x06\x01\x18\x34\x42\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x1E\xD4\x00\x1f\x0a\x00"
-                                      "\x09\x12\x01\x00\x07\x00\x40\xc3\x03\x42\x10\x00\x78\x66\x61\xb0\x58\x28\x16\x0b"
-                                      "\x05\x86\x66\x1e\x00\x1E\xD5\x00\x1b\x0a\x00\x09\x0f\x01\x00\x03\x00\x40\xc3\x03"
-                                      "\x42\x10\x00\x78\x63\x60\xb0\x58\x2c\x13\x18\xf0\x1E\xD6\x00\x1d\x0a\x00\x08\x13"
-                                      "\x01\x00\x31\x2a\x46\x00\x18\x34\x42\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66"
-                                      "\x3c\x1E\xD7\x00\x19\x0a\x00\x08\x0f\x01\x00\x32\x2a\x44\x18\x34\x42\x00\x3c\x63"
-                                      "\xc1\xc1\xc1\xc1\x63\x3c\x1E\xD8\x00\x1d\x0a\x00\x08\x13\x01\xfc\x18\x34\x42\x00"
-                                      "\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x00\x00\x18\x18\x1E\xD9\x00\x1a\x0a"
-                                      "\x00\x08\x10\x01\xfc\x18\x34\x42\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x00\x00\x18"
-                                      "\x18\x1E\xDA\x00\x1b\x0a\x00\x09\x0f\x01\x01\x06\x0c\x00\x20\x13\xfb\x33\x0d\x82"
-                                      "\xc1\x40\xb0\x58\x2c\x33\x30\xf0\x1E\xDB\x00\x18\x0a\x00\x09\x0c\x01\x01\x06\x0c"
-                                      "\x00\x20\x33\xf3\x13\x05\x82\xc1\x60\x98\xc7\x80\x1E\xDC\x00\x1b\x0a\x00\x09\x0f"
-                                      "\x01\x01\x70\x0c\x00\x20\x13\xfb\x33\x0d\x82\xc1\x40\xb0\x58\x2c\x33\x30\xf0\x1E"
-                                      "\xDD\x00\x18\x0a\x00\x09\x0c\x01\x01\x30\x0c\x00\x20\x33\xf3\x13\x05\x82\xc1\x60"
-                                      "\x98\xc7\x80\x1E\xDE\x00\x1c\x0a\x00\x09\x10\x01\x00\x10\x06\x03\x02\x10\x09\xfd"
-                                      "\x99\x86\xc1\x60\xa0\x58\x2c\x16\x19\x98\x78\x1E\xDF\x00\x19\x0a\x00\x09\x0d\x01"
-                                      "\x01\x1c\x02\x07\x00\x10\x19\xf9\x89\x82\xc1\x60\xb0\x4c\x63\xc0\x1E\xE0\x00\x1b"
-                                      "\x0a\x00\x09\x0f\x01\x01\x32\x27\x00\x20\x13\xfb\x33\x0d\x82\xc1\x40\xb0\x58\x2c"
-                                      "\x33\x30\xf0\x1E\xE1\x00\x18\x0a\x00\x09\x0c\x01\x01\x32\x27\x00\x20\x33\xf3\x13"
-                                      "\x05\x82\xc1\x60\x98\xc7\x80\x1E\xE2\x00\x1e\x0a\x00\x09\x11\x01\xfc\x00\x80\x4f"
-                                      "\xec\xcc\x36\x0b\x05\x02\xc1\x60\xb0\xcc\xc3\xc0\x00\x00\x30\x18\x00\x1E\xE3\x00"
-                                      "\x1a\x0a\x00\x09\x0e\x01\xfc\x00\x80\xcf\xcc\x4c\x16\x0b\x05\x82\x63\x1e\x00\x00"
-                                      "\x01\x80\xc0\x1E\xE4\x00\x19\x0a\x00\x08\x0f\x01\xfc\xc1\xc1\xc1\xc1\xc1\xc1\xc1"
-                                      "\xc1\xc3\x67\x3c\x00\x00\x18\x18\x1E\xE5\x00\x15\x0a\x00\x07\x0c\x02\xfc\x87\x0e"
-                                      "\x1c\x38\x70\xf7\xfb\x00\x00\xc1\x80\x1E\xE6\x00\x19\x0a\x00\x08\x0f\x01\x00\x1c"
-                                      "\x06\x18\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x1E\xE7\x00\x16\x0a\x00"
-                                      "\x07\x0d\x02\x00\x70\x10\x61\x00\x10\xe1\xc3\x87\x0e\x1e\xff\x60\x1E\xE8\x00\x1d"
-                                      "\x0a\x00\x0a\x0f\x01\x00\x06\x03\x01\x04\x01\xc1\xf0\x4c\x13\x04\xc1\x30\x4c\x13"
-                                      "\x04\xc3\x19\xc3\xc0\x1E\xE9\x00\x18\x0a\x00\x09\x0c\x02\x00\x0c\x0c\x08\x60\x38"
-                                      "\x74\x32\x19\x0c\x86\x43\x37\x9e\xc0\x1E\xEA\x00\x1d\x0a\x00\x0a\x0f\x01\x00\x60"
-                                      "\x06\x00\x04\x01\xc1\xf0\x4c\x13\x04\xc1\x30\x4c\x13\x04\xc3\x19\xc3\xc0\x1E\xEB"
-                                      "\x00\x18\x0a\x00\x09\x0c\x02\x00\x40\x18\x00\x60\x38\x74\x32\x19\x0c\x86\x43\x37"
-                                      "\x9e\xc0\x1E\xEC\x00\x1d\x0a\x00\x0a\x0f\x01\x00\x1c\x01\x81\x84\x01\xc1\xf0\x4c"
-                                      "\x13\x04\xc1\x30\x4c\x13\x04\xc3\x19\xc3\xc0\x1E\xED\x00\x19\x0a\x00\x09\x0d\x02"
-                                      "\x00\x70\x04\x06\x04\x30\x1c\x3a\x19\x0c\x86\x43\x21\x9b\xcf\x60\x1E\xEE\x00\x1d"
-                                      "\x0a\x00\x0a\x0f\x01\x00\x32\x12\x84\x44\x01\xc1\xf0\x4c\x13\x04\xc1\x30\x4c\x13"
-                                      "\x04\xc3\x19\xc3\xc0\x1E\xEF\x00\x18\x0a\x00\x09\x0c\x02\x00\x66\x4a\x22\x60\x38"
-                                      "\x74\x32\x19\x0c\x86\x43\x37\x9e\xc0\x1E\xF0\x00\x20\x0a\x00\x0a\x11\x01\xfc\x00"
-                                      "\x40\x1c\x1f\x04\xc1\x30\x4c\x13\x04\xc1\x30\x4c\x31\x9c\x3c\x00\x00\x00\x60\x18"
-                                      "\x00\x1E\xF1\x00\x1a\x0a\x00\x09\x0e\x02\xfc\x01\x80\xe1\xd0\xc8\x64\x32\x19\x0c"
-                                      "\xde\x7b\x00\x00\x03\x01\x80\x1E\xF2\x00\x19\x0a\x00\x08\x0f\x01\x00\x60\x18\x00"
-                                      "\x00\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18\x1E\xF3\x00\x1a\x0a\x00\x08\x10"
-                                      "\x01\xfc\x20\x18\x00\x00\xc1\x43\x62\x62\x26\x34\x1c\x18\x18\x18\x30\xe0\x1E\xF4"
-                                      "\x00\x19\x0a\x00\x08\x0f\x01\xfc\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18\x00"
-                                      "\x00\x18\x18\x1E\xF5\x00\x16\x0a\x00\x08\x0c\x01\xfc\xc1\x43\x62\x62\x26\x34\x1c"
-                                      "\x18\x18\x18\x33\xe3\x1E\xF6\x00\x19\x0a\x00\x08\x0f\x01\x00\x1c\x06\x18\x00\xc1"
-                                      "\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18\x1E\xF7\x00\x1b\x0a\x00\x08\x11\x01\xfc"
-                                      "\x38\x04\x0c\x10\x00\xc1\x43\x62\x62\x26\x34\x1c\x18\x18\x18\x30\xe0\x1E\xF8\x00"
-                                      "\x19\x0a\x00\x08\x0f\x01\x00\x32\x4a\x44\x00\xc1\x43\x62\x26\x3c\x18\x18\x18\x18"
-                                      "\x18\x18\x1E\xF9\x00\x1a\x0a\x00\x08\x10\x01\xfc\x33\x4a\x44\x00\xc1\x43\x62\x62"
-                                      "\x26\x34\x1c\x18\x18\x18\x30\xe0\x20\x11\x00\x0b\x0a\x00\x06\x01\x02\x04\xfc\x20"
-                                      "\x13\x00\x0b\x0a\x00\x08\x01\x01\x04\xff\x20\x14\x00\x0c\x0a\x00\x09\x01\x01\x04"
-                                      "\xff\x80\x20\x15\x00\x0c\x0a\x00\x09\x01\x01\x04\xff\x80\x20\x18\x00\x0d\x0a\x00"
-                                      "\x04\x05\x03\x07\x13\x66\xe0\x20\x19\x00\x0d\x0a\x00\x04\x05\x03\x07\x33\x66\xc0"
-                                      "\x20\x1A\x00\x0d\x0a\x00\x04\x05\x03\xfd\x33\x66\xc0\x20\x1C\x00\x0f\x0a\x00\x08"
-                                      "\x05\x01\x07\x31\x23\x66\x66\xc6\x20\x1D\x00\x0f\x0a\x00\x08\x05\x01\x07\x33\x33"
-                                      "\x63\x66\xcc\x20\x1E\x00\x0f\x0a\x00\x08\x05\x01\xfd\x33\x33\x63\x66\xcc\x20\x20"
-                                      "\x00\x16\x0a\x00\x08\x0c\x01\x00\x18\x18\x08\x08\xff\x08\x08\x08\x08\x18\x18\x18"
-                                      "\x20\x21\x00\x16\x0a\x00\x08\x0c\x01\x00\x18\x08\x08\xff\x08\x08\x08\x08\x7f\x08"
-                                      "\x08\x18\x20\x22\x00\x0d\x0a\x00\x05\x04\x03\x03\xf7\xfc\xe0\x20\x25\x00\x0d\x0a"
-                                      "\x00\x08\x03\x01\x00\x43\xe3\x63\x20\x26\x00\x0e\x0a\x00\x09\x03\x01\x00\x89\x6c"
-                                      "\xf6\x60\x20\x39\x00\x0f\x0a\x00\x05\x08\x03\x00\x09\x99\x8c\x30\xc1\x20\x3A\x00"
-                                      "\x0f\x0a\x00\x05\x08\x03\x00\x86\x1c\x31\xbb\x10\x20\x44\x00\x18\x0a\x00\x0a\x0b"
-                                      "\x00\x00\x00\x40\x20\x10\x08\x06\x01\x00\x80\x40\x20\x18\x0c\x00\x20\x70\x00\x0e"
-                                      "\x0a\x00\x05\x06\x03\x06\x74\xef\x99\xb8\x20\x74\x00\x0e\x0a\x00\x05\x06\x03\x06"
-                                      "\x32\xa5\xf1\x08\x20\x75\x00\x0e\x0a\x00\x05\x06\x03\x06\xf4\x3c\x11\xf0\x20\x76"
-                                      "\x00\x0e\x0a\x00\x05\x06\x03\x06\x22\x3d\x19\xb8\x20\x77\x00\x0e\x0a\x00\x05\x06"
-                                      "\x03\x06\xf8\x84\x46\x20\x20\x78\x00\x0e\x0a\x00\x05\x06\x03\x06\xf4\xfd\x28\xf8"
-                                      "\x20\x79\x00\x0e\x0a\x00\x05\x06\x03\x06\x74\xe3\xe3\x30\x20\x80\x00\x0e\x0a\x00"
-                                      "\x05\x06\x03\xfc\x74\xef\x99\xb8\x20\x81\x00\x0e\x0a\x00\x05\x06\x03\xfc\x67\x08"
-                                      "\x42\x7c\x20\x82\x00\x0e\x0a\x00\x05\x06\x03\xfc\x74\xc4\x44\x7c\x20\x83\x00\x0e"
-                                      "\x0a\x00\x05\x06\x03\xfc\xf1\x18\x31\xf8\x20\x84\x00\x0e\x0a\x00\x05\x06\x03\xfc"
-                                      "\x32\xa5\xf1\x08\x20\x85\x00\x0e\x0a\x00\x05\x06\x03\xfc\xf4\x3c\x11\xf0\x20\x86"
-                                      "\x00\x0e\x0a\x00\x05\x06\x03\xfc\x22\x3d\x19\xb8\x20\x87\x00\x0e\x0a\x00\x05\x06"
-                                      "\x03\xfc\xf8\x84\x46\x20\x20\x88\x00\x0e\x0a\x00\x05\x06\x03\xfc\xf4\xfd\x28\xf8"
-                                      "\x20\x89\x00\x0e\x0a\x00\x05\x06\x03\xfc\x74\xe3\xe3\x30\x20\xA6\x00\x18\x0a\x00"
-                                      "\x0a\x0b\x00\x00\x31\x8e\x62\x9b\xbf\x2d\x89\x6f\xdc\x9e\x23\x88\xe2\x38\x20\xA9"
-                                      "\x00\x18\x0a\x00\x0a\x0b\x00\x00\x40\x90\x24\x09\x32\x2c\xbe\xf2\xa8\xaa\x32\x8c"
-                                      "\xa3\x10\x20\xAB\x00\x19\x0a\x00\x09\x0d\x01\xfe\x03\x01\x87\xe0\x63\xf3\x3b\x0d"
-                                      "\x86\xc3\x33\x8e\xc0\x0f\xf0\x20\xAC\x00\x17\x0a\x00\x09\x0b\x01\x00\x1f\x18\x98"
-                                      "\x1f\x86\x03\x03\xf0\xc0\x20\x18\xc7\xc0\x20\xB1\x00\x18\x0a\x00\x0a\x0b\x00\x00"
-                                      "\x3e\x08\xc2\x1b\xff\x21\x88\xc3\xe0\x80\x20\x08\x02\x00\x20\xB9\x00\x15\x0a\x00"
-                                      "\x08\x0b\x01\x00\xff\x06\x06\xff\x06\x04\xf8\x60\x38\x0c\x06\x20\xBA\x00\x18\x0a"
-                                      "\x00\x0a\x0b\x00\x00\x30\x0c\x03\x60\xe0\x72\x2f\x03\x0d\xc3\xb1\x8c\xc3\xe0\x20"
-                                      "\xBD\x00\x17\x0a\x00\x09\x0b\x01\x00\x7f\x30\xd8\x6c\x16\x1f\xf9\x80\xc0\xfe\x30"
-                                      "\x18\x00\x21\x17\x00\x17\x0a\x00\x08\x0d\x01\xff\x3c\x42\x81\x9d\x95\x95\x95\x9d"
-                                      "\x91\x91\x81\x42\x3c\x21\x20\x00\x10\x0a\x00\x09\x05\x01\x07\xed\x46\x9a\xa5\x1e"
-                                      "\x88\x21\x22\x00\x10\x0a\x00\x09\x05\x01\x07\xfd\x26\x92\xa9\x14\x88\x21\x53\x00"
-                                      "\x1d\x0a\x00\x0a\x0f\x00\xfc\x20\x38\x02\x00\x81\x20\xfe\x40\x20\x10\x18\x09\xf4"
-                                      "\x0a\x06\x00\x40\x10\x38\x21\x54\x00\x1d\x0a\x00\x0a\x0f\x00\xfc\x78\x22\x00\x80"
-                                      "\xc1\x60\xfe\x40\x20\x10\x18\x09\xf4\x0a\x06\x00\x40\x10\x38\x21\x55\x00\x1d\x0a"
-                                      "\x00\x0a\x0f\x00\xfc\x20\x38\x02\x00\x81\x20\xfe\x40\x20\x10\x18\x08\xf4\x42\x1e"
-                                      "\x00\x40\x30\x78\x21\x56\x00\x1d\x0a\x00\x0a\x0f\x00\xfc\x78\x22\x00\x80\xc1\x60"
-                                      "\xfe\x40\x20\x10\x18\x08\xf4\x42\x1e\x00\x40\x30\x78\x21\x57\x00\x1d\x0a\x00\x0a"
-                                      "\x0f\x00\xfc\xf8\x04\x03\x00\x21\x08\xdc\x40\x20\x10\x18\x08\xf4\x42\x1e\x00\x40"
-                                      "\x30\x78\x21\x58\x00\x1d\x0a\x00\x0a\x0f\x00\xfc\x10\x0c\x05\x03\xf1\x10\xc4\x40"
-                                      "\x20\x10\x18\x08\xf4\x42\x1e\x00\x40\x30\x78\x21\x59\x00\x1d\x0a\x00\x0a\x0f\x00"
-                                      "\xfc\x20\x38\x02\x00\x81\x20\xfe\x40\x20\x10\x18\x08\x44\x22\x1e\x0c\x81\x20\x78"
-                                      "\x21\x5A\x00\x1d\x0a\x00\x0a\x0f\x00\xfc\x78\x10\x07\x80\x21\x08\xfc\x40\x20\x10"
-                                      "\x18\x08\x44\x22\x1e\x0c\x81\x20\x78\x21\x5B\x00\x1d\x0a\x00\x0a\x0f\x00\xfc\x20"
-                                      "\x38\x02\x00\x81\x20\xfe\x40\x20\x10\x18\x08\xe4\x46\x0e\x04\xc1\x10\x78\x21\x5C"
-                                      "\x00\x1d\x0a\x00\x0a\x0f\x00\xfc\xf8\x04\x03\x00\x21\x08\xdc\x40\x20\x10\x18\x08"
-                                      "\xe4\x46\x0e\x04\xc1\x10\x78\x21\x5D\x00\x1d\x0a\x00\x0a\x0f\x00\xfc\x78\x10\x07"
-                                      "\x80\x21\x08\xfc\x40\x20\x10\x18\x08\xe4\x46\x0e\x04\xc1\x10\x78\x21\x5E\x00\x1d"
-                                      "\x0a\x00\x0a\x0f\x00\xfc\x7c\x02\x00\x80\x41\x30\xc8\x40\x20\x10\x18\x08\xe4\x46"
-                                      "\x0e\x04\xc1\x10\x78\x22\x12\x00\x0b\x0a\x00\x08\x01\x01\x05\xff\x22\x48\x00\x15"
-                                      "\x0a\x00\x09\x09\x01\x01\x61\xac\xa3\x50\xc0\x03\x0d\x65\x1a\x86\x00\x22\x60\x00"
-                                      "\x13\x0a\x00\x07\x0a\x02\x01\x04\x08\x27\xf1\x04\x3f\xa0\x41\x80\x22\x64\x00\x15"
-                                      "\x0a\x00\x08\x0b\x01\x00\x01\x06\x38\xe0\xe0\x38\x06\x01\x00\x00\xff\x22\x65\x00"
-                                      "\x14\x0a\x00\x07\x0b\x02\x00\x81\xc0\xe0\x70\xe7\x38\x40\x00\x03\xf8\xA7\x88\x00"
-                                      "\x0d\x0a\x00\x06\x03\x02\xfc\x31\xa8\x40";
+static constexpr Character intel_one_mono_12_pt_characters[623] = {
+    {0x0000, 0, 7, 12, 6, 12, 0, 0},
+    {0x0020, 9, 10, 0, 0, 0, 0, 0},
+    {0x0021, 9, 10, 0, 3, 12, 4, 0},
+    {0x0022, 14, 10, 0, 6, 5, 2, 7},
+    {0x0023, 18, 10, 0, 9, 11, 1, 0},
+    {0x0024, 31, 10, 0, 8, 15, 1, -2},
+    {0x0025, 46, 10, 0, 9, 11, 1, 0},
+    {0x0026, 59, 10, 0, 9, 11, 1, 0},
+    {0x0027, 72, 10, 0, 2, 5, 4, 7},
+    {0x0028, 74, 10, 0, 7, 17, 2, -3},
+    {0x0029, 89, 10, 0, 6, 17, 2, -3},
+    {0x002A, 102, 10, 0, 8, 8, 1, 3},
+    {0x002B, 110, 10, 0, 8, 9, 1, 1},
+    {0x002C, 119, 10, 0, 4, 5, 3, -3},
+    {0x002D, 122, 10, 0, 6, 1, 2, 4},
+    {0x002E, 123, 10, 0, 3, 3, 4, 0},
+    {0x002F, 125, 10, 0, 8, 15, 1, -2},
+    {0x0030, 140, 10, 0, 8, 11, 1, 0},
+    {0x0031, 151, 10, 0, 7, 11, 2, 0},
+    {0x0032, 161, 10, 0, 8, 11, 1, 0},
+    {0x0033, 172, 10, 0, 8, 11, 1, 0},
+    {0x0034, 183, 10, 0, 9, 11, 1, 0},
+    {0x0035, 196, 10, 0, 7, 11, 2, 0},
+    {0x0036, 206, 10, 0, 8, 11, 1, 0},
+    {0x0037, 217, 10, 0, 8, 11, 1, 0},
+    {0x0038, 228, 10, 0, 8, 11, 1, 0},
+    {0x0039, 239, 10, 0, 8, 11, 1, 0},
+    {0x003A, 250, 10, 0, 3, 8, 4, 0},
+    {0x003B, 253, 10, 0, 4, 11, 3, -3},
+    {0x003C, 259, 10, 0, 8, 8, 1, 1},
+    {0x003D, 267, 10, 0, 7, 4, 2, 3},
+    {0x003E, 271, 10, 0, 8, 8, 1, 1},
+    {0x003F, 279, 10, 0, 8, 12, 1, 0},
+    {0x0040, 291, 10, 0, 9, 13, 1, -1},
+    {0x0041, 306, 10, 0, 9, 11, 1, 0},
+    {0x0042, 319, 10, 0, 8, 11, 2, 0},
+    {0x0043, 330, 10, 0, 8, 11, 1, 0},
+    {0x0044, 341, 10, 0, 8, 11, 2, 0},
+    {0x0045, 352, 10, 0, 7, 11, 2, 0},
+    {0x0046, 362, 10, 0, 7, 11, 2, 0},
+    {0x0047, 372, 10, 0, 8, 11, 1, 0},
+    {0x0048, 383, 10, 0, 7, 11, 2, 0},
+    {0x0049, 393, 10, 0, 6, 11, 2, 0},
+    {0x004A, 402, 10, 0, 8, 11, 1, 0},
+    {0x004B, 413, 10, 0, 8, 11, 2, 0},
+    {0x004C, 424, 10, 0, 7, 11, 2, 0},
+    {0x004D, 434, 10, 0, 8, 11, 1, 0},
+    {0x004E, 445, 10, 0, 7, 11, 2, 0},
+    {0x004F, 455, 10, 0, 8, 11, 1, 0},
+    {0x0050, 466, 10, 0, 8, 11, 2, 0},
+    {0x0051, 477, 10, 0, 9, 13, 1, -2},
+    {0x0052, 492, 10, 0, 7, 11, 2, 0},
+    {0x0053, 502, 10, 0, 8, 11, 1, 0},
+    {0x0054, 513, 10, 0, 9, 11, 1, 0},
+    {0x0055, 526, 10, 0, 8, 11, 1, 0},
+    {0x0056, 537, 10, 0, 9, 11, 1, 0},
+    {0x0057, 550, 10, 0, 9, 11, 1, 0},
+    {0x0058, 563, 10, 0, 8, 11, 1, 0},
+    {0x0059, 574, 10, 0, 8, 11, 1, 0},
+    {0x005A, 585, 10, 0, 8, 11, 1, 0},
+    {0x005B, 596, 10, 0, 6, 15, 3, -2},
+    {0x005C, 608, 10, 0, 8, 15, 1, -2},
+    {0x005D, 623, 10, 0, 5, 15, 2, -2},
+    {0x005E, 633, 10, 0, 8, 7, 1, 4},
+    {0x005F, 640, 10, 0, 8, 1, 1, -2},
+    {0x0060, 641, 10, 0, 4, 3, 3, 9},
+    {0x0061, 643, 10, 0, 9, 8, 1, 0},
+    {0x0062, 652, 10, 0, 7, 12, 2, 0},
+    {0x0063, 663, 10, 0, 8, 8, 1, 0},
+    {0x0064, 671, 10, 0, 8, 12, 1, 0},
+    {0x0065, 683, 10, 0, 8, 8, 1, 0},
+    {0x0066, 691, 10, 0, 8, 12, 1, 0},
+    {0x0067, 703, 10, 0, 8, 12, 1, -4},
+    {0x0068, 715, 10, 0, 7, 12, 2, 0},
+    {0x0069, 726, 10, 0, 7, 12, 2, 0},
+    {0x006A, 737, 10, 0, 5, 16, 2, -4},
+    {0x006B, 747, 10, 0, 7, 12, 2, 0},
+    {0x006C, 758, 10, 0, 8, 12, 1, 0},
+    {0x006D, 770, 10, 0, 9, 8, 1, 0},
+    {0x006E, 779, 10, 0, 7, 8, 2, 0},
+    {0x006F, 786, 10, 0, 8, 8, 1, 0},
+    {0x0070, 794, 10, 0, 7, 12, 2, -4},
+    {0x0071, 805, 10, 0, 8, 12, 1, -4},
+    {0x0072, 817, 10, 0, 8, 8, 1, 0},
+    {0x0073, 825, 10, 0, 7, 8, 2, 0},
+    {0x0074, 832, 10, 0, 8, 11, 1, 0},
+    {0x0075, 843, 10, 0, 7, 8, 2, 0},
+    {0x0076, 850, 10, 0, 8, 8, 1, 0},
+    {0x0077, 858, 10, 0, 9, 8, 1, 0},
+    {0x0078, 867, 10, 0, 8, 8, 1, 0},
+    {0x0079, 875, 10, 0, 8, 12, 1, -4},
+    {0x007A, 887, 10, 0, 8, 8, 1, 0},
+    {0x007B, 895, 10, 0, 8, 16, 1, -2},
+    {0x007C, 911, 10, 0, 1, 15, 5, -2},
+    {0x007D, 913, 10, 0, 8, 16, 1, -2},
+    {0x007E, 929, 10, 0, 9, 4, 1, 4},
+    {0x00A0, 934, 10, 0, 0, 0, 0, 0},
+    {0x00A1, 934, 10, 0, 3, 12, 4, 0},
+    {0x00A2, 939, 10, 0, 8, 12, 1, -2},
+    {0x00A3, 951, 10, 0, 8, 11, 1, 0},
+    {0x00A5, 962, 10, 0, 8, 11, 1, 0},
+    {0x00A7, 973, 10, 0, 8, 15, 1, -4},
+    {0x00A8, 988, 10, 0, 6, 2, 2, 10},
+    {0x00A9, 990, 10, 0, 8, 13, 1, -1},
+    {0x00AA, 1003, 10, 0, 7, 9, 2, 3},
+    {0x00AB, 1011, 10, 0, 8, 8, 1, 0},
+    {0x00AE, 1019, 10, 0, 8, 9, 1, 3},
+    {0x00AF, 1028, 10, 0, 6, 1, 2, 10},
+    {0x00B0, 1029, 10, 0, 7, 7, 2, 5},
+    {0x00B1, 1036, 10, 0, 8, 11, 1, 0},
+    {0x00B2, 1047, 10, 0, 5, 6, 3, 6},
+    {0x00B3, 1051, 10, 0, 5, 6, 3, 6},
+    {0x00B4, 1055, 10, 0, 4, 3, 4, 9},
+    {0x00B5, 1057, 10, 0, 7, 12, 2, -4},
+    {0x00B6, 1068, 10, 0, 8, 11, 1, 0},
+    {0x00B7, 1079, 10, 0, 3, 3, 4, 5},
+    {0x00B8, 1081, 10, 0, 5, 5, 3, -5},
+    {0x00B9, 1085, 10, 0, 5, 6, 3, 6},
+    {0x00BA, 1089, 10, 0, 6, 8, 2, 4},
+    {0x00BB, 1095, 10, 0, 8, 8, 1, 0},
+    {0x00BC, 1103, 10, 0, 10, 15, 0, -4},
+    {0x00BD, 1122, 10, 0, 10, 15, 0, -4},
+    {0x00BE, 1141, 10, 0, 10, 15, 0, -4},
+    {0x00BF, 1160, 10, 0, 8, 12, 1, 0},
+    {0x00C0, 1172, 10, 0, 9, 15, 1, 0},
+    {0x00C1, 1189, 10, 0, 9, 15, 1, 0},
+    {0x00C2, 1206, 10, 0, 9, 15, 1, 0},
+    {0x00C3, 1223, 10, 0, 9, 15, 1, 0},
+    {0x00C4, 1240, 10, 0, 9, 15, 1, 0},
+    {0x00C5, 1257, 10, 0, 9, 14, 1, 0},
+    {0x00C6, 1273, 10, 0, 10, 11, 0, 0},
+    {0x00C7, 1287, 10, 0, 8, 15, 1, -4},
+    {0x00C8, 1302, 10, 0, 7, 15, 2, 0},
+    {0x00C9, 1316, 10, 0, 7, 15, 2, 0},
+    {0x00CA, 1330, 10, 0, 7, 15, 2, 0},
+    {0x00CB, 1344, 10, 0, 7, 15, 2, 0},
+    {0x00CC, 1358, 10, 0, 6, 15, 2, 0},
+    {0x00CD, 1370, 10, 0, 6, 15, 2, 0},
+    {0x00CE, 1382, 10, 0, 6, 15, 2, 0},
+    {0x00CF, 1394, 10, 0, 6, 15, 2, 0},
+    {0x00D0, 1406, 10, 0, 9, 11, 1, 0},
+    {0x00D1, 1419, 10, 0, 7, 15, 2, 0},
+    {0x00D2, 1433, 10, 0, 8, 15, 1, 0},
+    {0x00D3, 1448, 10, 0, 8, 15, 1, 0},
+    {0x00D4, 1463, 10, 0, 8, 15, 1, 0},
+    {0x00D5, 1478, 10, 0, 8, 15, 1, 0},
+    {0x00D6, 1493, 10, 0, 8, 14, 1, 0},
+    {0x00D7, 1507, 10, 0, 7, 8, 2, 2},
+    {0x00D8, 1514, 10, 0, 9, 13, 1, -1},
+    {0x00D9, 1529, 10, 0, 8, 15, 1, 0},
+    {0x00DA, 1544, 10, 0, 8, 15, 1, 0},
+    {0x00DB, 1559, 10, 0, 8, 15, 1, 0},
+    {0x00DC, 1574, 10, 0, 8, 15, 1, 0},
+    {0x00DD, 1589, 10, 0, 8, 15, 1, 0},
+    {0x00DE, 1604, 10, 0, 8, 11, 2, 0},
+    {0x00DF, 1615, 10, 0, 8, 12, 2, 0},
+    {0x00E0, 1627, 10, 0, 9, 12, 1, 0},
+    {0x00E1, 1641, 10, 0, 9, 12, 1, 0},
+    {0x00E2, 1655, 10, 0, 9, 12, 1, 0},
+    {0x00E3, 1669, 10, 0, 9, 12, 1, 0},
+    {0x00E4, 1683, 10, 0, 9, 11, 1, 0},
+    {0x00E5, 1696, 10, 0, 9, 13, 1, 0},
+    {0x00E6, 1711, 10, 0, 9, 8, 1, 0},
+    {0x00E7, 1720, 10, 0, 8, 12, 1, -4},
+    {0x00E8, 1732, 10, 0, 8, 12, 1, 0},
+    {0x00E9, 1744, 10, 0, 8, 12, 1, 0},
+    {0x00EA, 1756, 10, 0, 8, 12, 1, 0},
+    {0x00EB, 1768, 10, 0, 8, 11, 1, 0},
+    {0x00EC, 1779, 10, 0, 7, 12, 2, 0},
+    {0x00ED, 1790, 10, 0, 7, 12, 2, 0},
+    {0x00EE, 1801, 10, 0, 7, 12, 2, 0},
+    {0x00EF, 1812, 10, 0, 7, 12, 2, 0},
+    {0x00F0, 1823, 10, 0, 8, 12, 1, 0},
+    {0x00F1, 1835, 10, 0, 7, 12, 2, 0},
+    {0x00F2, 1846, 10, 0, 8, 12, 1, 0},
+    {0x00F3, 1858, 10, 0, 8, 12, 1, 0},
+    {0x00F4, 1870, 10, 0, 8, 12, 1, 0},
+    {0x00F5, 1882, 10, 0, 8, 12, 1, 0},
+    {0x00F6, 1894, 10, 0, 8, 11, 1, 0},
+    {0x00F7, 1905, 10, 0, 8, 9, 1, 1},
+    {0x00F8, 1914, 10, 0, 8, 10, 1, -1},
+    {0x00F9, 1924, 10, 0, 7, 12, 2, 0},
+    {0x00FA, 1935, 10, 0, 7, 12, 2, 0},
+    {0x00FB, 1946, 10, 0, 7, 12, 2, 0},
+    {0x00FC, 1957, 10, 0, 7, 12, 2, 0},
+    {0x00FD, 1968, 10, 0, 8, 16, 1, -4},
+    {0x00FE, 1984, 10, 0, 7, 16, 2, -4},
+    {0x00FF, 1998, 10, 0, 8, 16, 1, -4},
+    {0x0100, 2014, 10, 0, 9, 14, 1, 0},
+    {0x0101, 2030, 10, 0, 9, 11, 1, 0},
+    {0x0102, 2043, 10, 0, 9, 15, 1, 0},
+    {0x0103, 2060, 10, 0, 9, 12, 1, 0},
+    {0x0104, 2074, 10, 0, 9, 15, 1, -4},
+    {0x0105, 2091, 10, 0, 9, 12, 1, -4},
+    {0x0106, 2105, 10, 0, 8, 15, 1, 0},
+    {0x0107, 2120, 10, 0, 8, 12, 1, 0},
+    {0x0108, 2132, 10, 0, 8, 15, 1, 0},
+    {0x0109, 2147, 10, 0, 8, 12, 1, 0},
+    {0x010A, 2159, 10, 0, 8, 15, 1, 0},
+    {0x010B, 2174, 10, 0, 8, 12, 1, 0},
+    {0x010C, 2186, 10, 0, 8, 15, 1, 0},
+    {0x010D, 2201, 10, 0, 8, 12, 1, 0},
+    {0x010E, 2213, 10, 0, 8, 15, 2, 0},
+    {0x010F, 2228, 10, 0, 11, 13, 1, 0},
+    {0x0110, 2246, 10, 0, 9, 11, 1, 0},
+    {0x0111, 2259, 10, 0, 9, 12, 1, 0},
+    {0x0112, 2273, 10, 0, 7, 14, 2, 0},
+    {0x0113, 2286, 10, 0, 8, 11, 1, 0},
+    {0x0114, 2297, 10, 0, 7, 15, 2, 0},
+    {0x0115, 2311, 10, 0, 8, 12, 1, 0},
+    {0x0116, 2323, 10, 0, 7, 15, 2, 0},
+    {0x0117, 2337, 10, 0, 8, 12, 1, 0},
+    {0x0118, 2349, 10, 0, 7, 15, 2, -4},
+    {0x0119, 2363, 10, 0, 8, 12, 1, -4},
+    {0x011A, 2375, 10, 0, 7, 15, 2, 0},
+    {0x011B, 2389, 10, 0, 8, 12, 1, 0},
+    {0x011C, 2401, 10, 0, 8, 15, 1, 0},
+    {0x011D, 2416, 10, 0, 8, 16, 1, -4},
+    {0x011E, 2432, 10, 0, 8, 15, 1, 0},
+    {0x011F, 2447, 10, 0, 8, 16, 1, -4},
+    {0x0120, 2463, 10, 0, 8, 15, 1, 0},
+    {0x0121, 2478, 10, 0, 8, 16, 1, -4},
+    {0x0122, 2494, 10, 0, 8, 16, 1, -5},
+    {0x0123, 2510, 10, 0, 8, 17, 1, -4},
+    {0x0124, 2527, 10, 0, 7, 15, 2, 0},
+    {0x0125, 2541, 10, 0, 10, 16, -1, 0},
+    {0x0126, 2561, 10, 0, 9, 11, 1, 0},
+    {0x0127, 2574, 10, 0, 9, 12, 0, 0},
+    {0x0128, 2588, 10, 0, 6, 15, 2, 0},
+    {0x0129, 2600, 10, 0, 7, 12, 2, 0},
+    {0x012A, 2611, 10, 0, 6, 14, 2, 0},
+    {0x012B, 2622, 10, 0, 7, 11, 2, 0},
+    {0x012C, 2632, 10, 0, 6, 15, 2, 0},
+    {0x012D, 2644, 10, 0, 7, 12, 2, 0},
+    {0x012E, 2655, 10, 0, 6, 15, 2, -4},
+    {0x012F, 2667, 10, 0, 7, 16, 2, -4},
+    {0x0130, 2681, 10, 0, 6, 15, 2, 0},
+    {0x0131, 2693, 10, 0, 7, 8, 2, 0},
+    {0x0134, 2700, 10, 0, 10, 15, 1, 0},
+    {0x0135, 2719, 10, 0, 7, 16, 2, -4},
+    {0x0136, 2733, 10, 0, 8, 16, 2, -5},
+    {0x0137, 2749, 10, 0, 7, 17, 2, -5},
+    {0x0139, 2764, 10, 0, 8, 15, 1, 0},
+    {0x013A, 2779, 10, 0, 8, 16, 1, 1},
+    {0x013B, 2795, 10, 0, 7, 16, 2, -5},
+    {0x013C, 2809, 10, 0, 8, 17, 1, -5},
+    {0x013D, 2826, 10, 0, 7, 11, 2, 0},
+    {0x013E, 2836, 10, 0, 8, 13, 1, 0},
+    {0x013F, 2849, 10, 0, 7, 11, 2, 0},
+    {0x0140, 2859, 10, 0, 11, 12, 1, 0},
+    {0x0141, 2876, 10, 0, 8, 11, 1, 0},
+    {0x0142, 2887, 10, 0, 8, 12, 1, 0},
+    {0x0143, 2899, 10, 0, 7, 15, 2, 0},
+    {0x0144, 2913, 10, 0, 7, 12, 2, 0},
+    {0x0145, 2924, 10, 0, 7, 16, 2, -5},
+    {0x0146, 2938, 10, 0, 7, 13, 2, -5},
+    {0x0147, 2950, 10, 0, 7, 15, 2, 0},
+    {0x0148, 2964, 10, 0, 7, 12, 2, 0},
+    {0x014A, 2975, 10, 0, 7, 15, 2, -4},
+    {0x014B, 2989, 10, 0, 7, 12, 2, -4},
+    {0x014C, 3000, 10, 0, 8, 14, 1, 0},
+    {0x014D, 3014, 10, 0, 8, 11, 1, 0},
+    {0x014E, 3025, 10, 0, 8, 15, 1, 0},
+    {0x014F, 3040, 10, 0, 8, 12, 1, 0},
+    {0x0150, 3052, 10, 0, 9, 15, 1, 0},
+    {0x0151, 3069, 10, 0, 8, 12, 1, 0},
+    {0x0152, 3081, 10, 0, 10, 11, 0, 0},
+    {0x0153, 3095, 10, 0, 10, 8, 0, 0},
+    {0x0154, 3105, 10, 0, 7, 15, 2, 0},
+    {0x0155, 3119, 10, 0, 8, 12, 1, 0},
+    {0x0156, 3131, 10, 0, 7, 16, 2, -5},
+    {0x0157, 3145, 10, 0, 8, 13, 1, -5},
+    {0x0158, 3158, 10, 0, 7, 15, 2, 0},
+    {0x0159, 3172, 10, 0, 8, 12, 1, 0},
+    {0x015A, 3184, 10, 0, 8, 15, 1, 0},
+    {0x015B, 3199, 10, 0, 7, 12, 2, 0},
+    {0x015C, 3210, 10, 0, 8, 15, 1, 0},
+    {0x015D, 3225, 10, 0, 7, 12, 2, 0},
+    {0x015E, 3236, 10, 0, 8, 15, 1, -4},
+    {0x015F, 3251, 10, 0, 7, 12, 2, -4},
+    {0x0160, 3262, 10, 0, 8, 15, 1, 0},
+    {0x0161, 3277, 10, 0, 7, 12, 2, 0},
+    {0x0162, 3288, 10, 0, 9, 16, 1, -5},
+    {0x0163, 3306, 10, 0, 8, 15, 1, -4},
+    {0x0164, 3321, 10, 0, 9, 15, 1, 0},
+    {0x0165, 3338, 10, 0, 8, 14, 1, 0},
+    {0x0166, 3352, 10, 0, 9, 11, 1, 0},
+    {0x0167, 3365, 10, 0, 8, 11, 1, 0},
+    {0x0168, 3376, 10, 0, 8, 15, 1, 0},
+    {0x0169, 3391, 10, 0, 7, 12, 2, 0},
+    {0x016A, 3402, 10, 0, 8, 14, 1, 0},
+    {0x016B, 3416, 10, 0, 7, 11, 2, 0},
+    {0x016C, 3426, 10, 0, 8, 15, 1, 0},
+    {0x016D, 3441, 10, 0, 7, 12, 2, 0},
+    {0x016E, 3452, 10, 0, 8, 16, 1, 0},
+    {0x016F, 3468, 10, 0, 7, 13, 2, 0},
+    {0x0170, 3480, 10, 0, 9, 15, 1, 0},
+    {0x0171, 3497, 10, 0, 7, 12, 2, 0},
+    {0x0172, 3508, 10, 0, 8, 15, 1, -4},
+    {0x0173, 3523, 10, 0, 8, 12, 2, -4},
+    {0x0174, 3535, 10, 0, 9, 15, 1, 0},
+    {0x0175, 3552, 10, 0, 9, 12, 1, 0},
+    {0x0176, 3566, 10, 0, 8, 15, 1, 0},
+    {0x0177, 3581, 10, 0, 8, 16, 1, -4},
+    {0x0178, 3597, 10, 0, 8, 15, 1, 0},
+    {0x0179, 3612, 10, 0, 8, 15, 1, 0},
+    {0x017A, 3627, 10, 0, 8, 12, 1, 0},
+    {0x017B, 3639, 10, 0, 8, 15, 1, 0},
+    {0x017C, 3654, 10, 0, 8, 12, 1, 0},
+    {0x017D, 3666, 10, 0, 8, 15, 1, 0},
+    {0x017E, 3681, 10, 0, 8, 12, 1, 0},
+    {0x018F, 3693, 10, 0, 8, 11, 1, 0},
+    {0x01A0, 3704, 10, 0, 9, 13, 1, 0},
+    {0x01A1, 3719, 10, 0, 9, 10, 1, 0},
+    {0x01AF, 3731, 10, 0, 10, 13, 1, 0},
+    {0x01B0, 3748, 10, 0, 9, 10, 2, 0},
+    {0x01CD, 3760, 10, 0, 9, 15, 1, 0},
+    {0x01CE, 3777, 10, 0, 9, 12, 1, 0},
+    {0x01CF, 3791, 10, 0, 6, 15, 2, 0},
+    {0x01D0, 3803, 10, 0, 7, 12, 2, 0},
+    {0x01D1, 3814, 10, 0, 8, 15, 1, 0},
+    {0x01D2, 3829, 10, 0, 8, 12, 1, 0},
+    {0x01D3, 3841, 10, 0, 8, 15, 1, 0},
+    {0x01D4, 3856, 10, 0, 7, 12, 2, 0},
+    {0x01D5, 3867, 10, 0, 8, 18, 1, 0},
+    {0x01D6, 3885, 10, 0, 7, 14, 2, 0},
+    {0x01D7, 3898, 10, 0, 8, 18, 1, 1},
+    {0x01D8, 3916, 10, 0, 7, 16, 2, 0},
+    {0x01D9, 3930, 10, 0, 8, 19, 1, 0},
+    {0x01DA, 3949, 10, 0, 7, 15, 2, 1},
+    {0x01DB, 3963, 10, 0, 8, 19, 1, 0},
+    {0x01DC, 3982, 10, 0, 7, 15, 2, 1},
+    {0x01E6, 3996, 10, 0, 8, 15, 1, 0},
+    {0x01E7, 4011, 10, 0, 8, 16, 1, -4},
+    {0x01EA, 4027, 10, 0, 8, 15, 1, -4},
+    {0x01EB, 4042, 10, 0, 8, 12, 1, -4},
+    {0x01F0, 4054, 10, 0, 7, 16, 2, -4},
+    {0x01F8, 4068, 10, 0, 7, 15, 2, 0},
+    {0x01F9, 4082, 10, 0, 7, 12, 2, 0},
+    {0x0218, 4093, 10, 0, 8, 16, 1, -5},
+    {0x0219, 4109, 10, 0, 7, 13, 2, -5},
+    {0x021A, 4121, 10, 0, 9, 16, 1, -5},
+    {0x021B, 4139, 10, 0, 8, 16, 1, -5},
+    {0x0226, 4155, 10, 0, 9, 15, 1, 0},
+    {0x0227, 4172, 10, 0, 9, 12, 1, 0},
+    {0x022E, 4186, 10, 0, 8, 15, 1, 0},
+    {0x022F, 4201, 10, 0, 8, 12, 1, 0},
+    {0x0232, 4213, 10, 0, 8, 14, 1, 0},
+    {0x0233, 4227, 10, 0, 8, 15, 1, -4},
+    {0x0237, 4242, 10, 0, 5, 12, 2, -4},
+    {0x0259, 4250, 10, 0, 8, 8, 1, 0},
+    {0x02B9, 4258, 10, 0, 2, 5, 4, 7},
+    {0x02BA, 4260, 10, 0, 6, 5, 2, 7},
+    {0x02BB, 4264, 10, 0, 4, 5, 3, 7},
+    {0x02BC, 4267, 10, 0, 4, 5, 3, 7},
+    {0x02BE, 4270, 10, 0, 4, 7, 3, 5},
+    {0x02BF, 4274, 10, 0, 4, 7, 3, 5},
+    {0x02C6, 4278, 10, 0, 6, 3, 2, 9},
+    {0x02C7, 4281, 10, 0, 6, 3, 2, 9},
+    {0x02C8, 4284, 10, 0, 2, 7, 4, 5},
+    {0x02CC, 4286, 10, 0, 2, 7, 4, -4},
+    {0x02CD, 4288, 10, 0, 6, 1, 2, -3},
+    {0x02D8, 4289, 10, 0, 6, 3, 2, 9},
+    {0x02D9, 4292, 10, 0, 2, 2, 4, 10},
+    {0x02DA, 4293, 10, 0, 5, 4, 3, 9},
+    {0x02DB, 4296, 10, 0, 4, 4, 3, -4},
+    {0x02DC, 4298, 10, 0, 7, 3, 2, 9},
+    {0x02DD, 4301, 10, 0, 7, 3, 2, 9},
+    {0x0300, 4304, 0, 0, 3, 3, -2, 9},
+    {0x0301, 4306, 0, 0, 3, 3, -1, 9},
+    {0x0302, 4308, 0, 0, 6, 3, -3, 9},
+    {0x0303, 4311, 0, 0, 6, 3, -3, 9},
+    {0x0304, 4314, 0, 0, 6, 1, -3, 10},
+    {0x0306, 4315, 0, 0, 6, 3, -3, 9},
+    {0x0307, 4318, 0, 0, 2, 2, -1, 10},
+    {0x0308, 4319, 0, 0, 6, 2, -3, 10},
+    {0x0309, 4321, 0, 0, 4, 4, -2, 9},
+    {0x030A, 4323, 0, 0, 4, 4, -2, 9},
+    {0x030B, 4325, 0, 0, 7, 3, -3, 9},
+    {0x030C, 4328, 0, 0, 6, 3, -3, 9},
+    {0x0312, 4331, 0, 0, 4, 4, -2, 9},
+    {0x0315, 4333, 0, 0, 1, 4, 0, 8},
+    {0x0323, 4334, 0, 0, 2, 2, -1, -4},
+    {0x0324, 4335, 0, 0, 6, 2, -3, -4},
+    {0x0326, 4337, 0, 0, 4, 4, -2, -5},
+    {0x0327, 4339, 0, 0, 5, 5, -2, -5},
+    {0x0328, 4343, 0, 0, 3, 4, -2, -4},
+    {0x032D, 4345, 0, 0, 6, 3, -3, -4},
+    {0x032E, 4348, 0, 0, 6, 3, -3, -4},
+    {0x0331, 4351, 0, 0, 6, 1, -3, -3},
+    {0x0E3F, 4352, 10, 0, 8, 15, 2, -2},
+    {0x1E06, 4367, 10, 0, 8, 14, 2, -3},
+    {0x1E07, 4381, 10, 0, 7, 15, 2, -3},
+    {0x1E0C, 4395, 10, 0, 8, 15, 2, -4},
+    {0x1E0D, 4410, 10, 0, 8, 16, 1, -4},
+    {0x1E0E, 4426, 10, 0, 8, 14, 2, -3},
+    {0x1E0F, 4440, 10, 0, 8, 15, 1, -3},
+    {0x1E12, 4455, 10, 0, 8, 15, 2, -4},
+    {0x1E13, 4470, 10, 0, 8, 16, 1, -4},
+    {0x1E20, 4486, 10, 0, 8, 14, 1, 0},
+    {0x1E21, 4500, 10, 0, 8, 15, 1, -4},
+    {0x1E24, 4515, 10, 0, 7, 15, 2, -4},
+    {0x1E25, 4529, 10, 0, 7, 16, 2, -4},
+    {0x1E28, 4543, 10, 0, 8, 16, 1, -5},
+    {0x1E29, 4559, 10, 0, 8, 17, 1, -5},
+    {0x1E2A, 4576, 10, 0, 7, 15, 2, -4},
+    {0x1E2B, 4590, 10, 0, 7, 16, 2, -4},
+    {0x1E32, 4604, 10, 0, 8, 15, 2, -4},
+    {0x1E33, 4619, 10, 0, 7, 16, 2, -4},
+    {0x1E34, 4633, 10, 0, 8, 14, 2, -3},
+    {0x1E35, 4647, 10, 0, 7, 15, 2, -3},
+    {0x1E36, 4661, 10, 0, 7, 15, 2, -4},
+    {0x1E37, 4675, 10, 0, 8, 16, 1, -4},
+    {0x1E38, 4691, 10, 0, 9, 18, 0, -4},
+    {0x1E39, 4712, 10, 0, 8, 19, 1, -4},
+    {0x1E3A, 4731, 10, 0, 7, 14, 2, -3},
+    {0x1E3B, 4744, 10, 0, 8, 15, 1, -3},
+    {0x1E3C, 4759, 10, 0, 7, 15, 2, -4},
+    {0x1E3D, 4773, 10, 0, 8, 16, 1, -4},
+    {0x1E3E, 4789, 10, 0, 8, 15, 1, 0},
+    {0x1E3F, 4804, 10, 0, 9, 12, 1, 0},
+    {0x1E40, 4818, 10, 0, 8, 15, 1, 0},
+    {0x1E41, 4833, 10, 0, 9, 12, 1, 0},
+    {0x1E42, 4847, 10, 0, 8, 15, 1, -4},
+    {0x1E43, 4862, 10, 0, 9, 12, 1, -4},
+    {0x1E44, 4876, 10, 0, 7, 15, 2, 0},
+    {0x1E45, 4890, 10, 0, 7, 12, 2, 0},
+    {0x1E46, 4901, 10, 0, 7, 15, 2, -4},
+    {0x1E47, 4915, 10, 0, 7, 12, 2, -4},
+    {0x1E48, 4926, 10, 0, 7, 14, 2, -3},
+    {0x1E49, 4939, 10, 0, 7, 11, 2, -3},
+    {0x1E4A, 4949, 10, 0, 7, 15, 2, -4},
+    {0x1E4B, 4963, 10, 0, 7, 12, 2, -4},
+    {0x1E58, 4974, 10, 0, 7, 15, 2, 0},
+    {0x1E59, 4988, 10, 0, 8, 12, 1, 0},
+    {0x1E5A, 5000, 10, 0, 7, 15, 2, -4},
+    {0x1E5B, 5014, 10, 0, 8, 12, 1, -4},
+    {0x1E5C, 5026, 10, 0, 7, 18, 2, -4},
+    {0x1E5D, 5042, 10, 0, 8, 15, 1, -4},
+    {0x1E5E, 5057, 10, 0, 7, 14, 2, -3},
+    {0x1E5F, 5070, 10, 0, 8, 11, 1, -3},
+    {0x1E62, 5081, 10, 0, 8, 15, 1, -4},
+    {0x1E63, 5096, 10, 0, 7, 12, 2, -4},
+    {0x1E6C, 5107, 10, 0, 9, 15, 1, -4},
+    {0x1E6D, 5124, 10, 0, 8, 15, 1, -4},
+    {0x1E6E, 5139, 10, 0, 9, 14, 1, -3},
+    {0x1E6F, 5155, 10, 0, 8, 14, 1, -3},
+    {0x1E70, 5169, 10, 0, 9, 15, 1, -4},
+    {0x1E71, 5186, 10, 0, 8, 15, 1, -4},
+    {0x1E7E, 5201, 10, 0, 9, 15, 1, -4},
+    {0x1E7F, 5218, 10, 0, 8, 12, 1, -4},
+    {0x1E80, 5230, 10, 0, 9, 15, 1, 0},
+    {0x1E81, 5247, 10, 0, 9, 12, 1, 0},
+    {0x1E82, 5261, 10, 0, 9, 15, 1, 0},
+    {0x1E83, 5278, 10, 0, 9, 12, 1, 0},
+    {0x1E84, 5292, 10, 0, 9, 15, 1, 0},
+    {0x1E85, 5309, 10, 0, 9, 12, 1, 0},
+    {0x1E8C, 5323, 10, 0, 8, 15, 1, 0},
+    {0x1E8D, 5338, 10, 0, 8, 12, 1, 0},
+    {0x1E8E, 5350, 10, 0, 8, 15, 1, 0},
+    {0x1E8F, 5365, 10, 0, 8, 16, 1, -4},
+    {0x1E90, 5381, 10, 0, 8, 15, 1, 0},
+    {0x1E91, 5396, 10, 0, 8, 12, 1, 0},
+    {0x1E92, 5408, 10, 0, 8, 15, 1, -4},
+    {0x1E93, 5423, 10, 0, 8, 12, 1, -4},
+    {0x1E94, 5435, 10, 0, 8, 14, 1, -3},
+    {0x1E95, 5449, 10, 0, 8, 11, 1, -3},
+    {0x1E96, 5460, 10, 0, 7, 15, 2, -3},
+    {0x1E9E, 5474, 10, 0, 9, 11, 1, 0},
+    {0x1EA0, 5487, 10, 0, 9, 15, 1, -4},
+    {0x1EA1, 5504, 10, 0, 9, 12, 1, -4},
+    {0x1EA2, 5518, 10, 0, 9, 15, 1, 0},
+    {0x1EA3, 5535, 10, 0, 9, 13, 1, 0},
+    {0x1EA4, 5550, 10, 0, 9, 17, 1, 0},
+    {0x1EA5, 5570, 10, 0, 9, 15, 1, 0},
+    {0x1EA6, 5587, 10, 0, 9, 18, 1, 0},
+    {0x1EA7, 5608, 10, 0, 9, 15, 1, 0},
+    {0x1EA8, 5625, 10, 0, 9, 18, 1, 0},
+    {0x1EA9, 5646, 10, 0, 9, 15, 1, 0},
+    {0x1EAA, 5663, 10, 0, 9, 19, 1, 0},
+    {0x1EAB, 5685, 10, 0, 9, 15, 1, 0},
+    {0x1EAC, 5702, 10, 0, 9, 19, 1, -4},
+    {0x1EAD, 5724, 10, 0, 9, 16, 1, -4},
+    {0x1EAE, 5742, 10, 0, 9, 18, 1, 0},
+    {0x1EAF, 5763, 10, 0, 9, 15, 1, 0},
+    {0x1EB0, 5780, 10, 0, 9, 18, 1, 0},
+    {0x1EB1, 5801, 10, 0, 9, 15, 1, 0},
+    {0x1EB2, 5818, 10, 0, 9, 18, 1, 0},
+    {0x1EB3, 5839, 10, 0, 9, 15, 1, 0},
+    {0x1EB4, 5856, 10, 0, 9, 19, 1, 0},
+    {0x1EB5, 5878, 10, 0, 9, 16, 1, 0},
+    {0x1EB6, 5896, 10, 0, 9, 19, 1, -4},
+    {0x1EB7, 5918, 10, 0, 9, 16, 1, -4},
+    {0x1EB8, 5936, 10, 0, 7, 15, 2, -4},
+    {0x1EB9, 5950, 10, 0, 8, 12, 1, -4},
+    {0x1EBA, 5962, 10, 0, 7, 15, 2, 0},
+    {0x1EBB, 5976, 10, 0, 8, 13, 1, 0},
+    {0x1EBC, 5989, 10, 0, 7, 15, 2, 0},
+    {0x1EBD, 6003, 10, 0, 8, 12, 1, 0},
+    {0x1EBE, 6015, 10, 0, 8, 17, 2, 0},
+    {0x1EBF, 6032, 10, 0, 9, 15, 1, 0},
+    {0x1EC0, 6049, 10, 0, 7, 18, 2, 0},
+    {0x1EC1, 6065, 10, 0, 8, 15, 1, 0},
+    {0x1EC2, 6080, 10, 0, 8, 18, 2, 0},
+    {0x1EC3, 6098, 10, 0, 9, 15, 1, 0},
+    {0x1EC4, 6115, 10, 0, 7, 19, 2, 0},
+    {0x1EC5, 6132, 10, 0, 8, 15, 1, 0},
+    {0x1EC6, 6147, 10, 0, 7, 19, 2, -4},
+    {0x1EC7, 6164, 10, 0, 8, 16, 1, -4},
+    {0x1EC8, 6180, 10, 0, 6, 15, 2, 0},
+    {0x1EC9, 6192, 10, 0, 7, 13, 2, 0},
+    {0x1ECA, 6204, 10, 0, 6, 15, 2, -4},
+    {0x1ECB, 6216, 10, 0, 7, 16, 2, -4},
+    {0x1ECC, 6230, 10, 0, 8, 15, 1, -4},
+    {0x1ECD, 6245, 10, 0, 8, 12, 1, -4},
+    {0x1ECE, 6257, 10, 0, 8, 15, 1, 0},
+    {0x1ECF, 6272, 10, 0, 8, 13, 1, 0},
+    {0x1ED0, 6285, 10, 0, 9, 17, 1, 0},
+    {0x1ED1, 6305, 10, 0, 9, 15, 1, 0},
+    {0x1ED2, 6322, 10, 0, 8, 18, 1, 0},
+    {0x1ED3, 6340, 10, 0, 8, 15, 1, 0},
+    {0x1ED4, 6355, 10, 0, 9, 18, 1, 0},
+    {0x1ED5, 6376, 10, 0, 9, 15, 1, 0},
+    {0x1ED6, 6393, 10, 0, 8, 19, 1, 0},
+    {0x1ED7, 6412, 10, 0, 8, 15, 1, 0},
+    {0x1ED8, 6427, 10, 0, 8, 19, 1, -4},
+    {0x1ED9, 6446, 10, 0, 8, 16, 1, -4},
+    {0x1EDA, 6462, 10, 0, 9, 15, 1, 1},
+    {0x1EDB, 6479, 10, 0, 9, 12, 1, 1},
+    {0x1EDC, 6493, 10, 0, 9, 15, 1, 1},
+    {0x1EDD, 6510, 10, 0, 9, 12, 1, 1},
+    {0x1EDE, 6524, 10, 0, 9, 16, 1, 0},
+    {0x1EDF, 6542, 10, 0, 9, 13, 1, 1},
+    {0x1EE0, 6557, 10, 0, 9, 15, 1, 1},
+    {0x1EE1, 6574, 10, 0, 9, 12, 1, 1},
+    {0x1EE2, 6588, 10, 0, 9, 17, 1, -4},
+    {0x1EE3, 6608, 10, 0, 9, 14, 1, -4},
+    {0x1EE4, 6624, 10, 0, 8, 15, 1, -4},
+    {0x1EE5, 6639, 10, 0, 7, 12, 2, -4},
+    {0x1EE6, 6650, 10, 0, 8, 15, 1, 0},
+    {0x1EE7, 6665, 10, 0, 7, 13, 2, 0},
+    {0x1EE8, 6677, 10, 0, 10, 15, 1, 0},
+    {0x1EE9, 6696, 10, 0, 9, 12, 2, 0},
+    {0x1EEA, 6710, 10, 0, 10, 15, 1, 0},
+    {0x1EEB, 6729, 10, 0, 9, 12, 2, 0},
+    {0x1EEC, 6743, 10, 0, 10, 15, 1, 0},
+    {0x1EED, 6762, 10, 0, 9, 13, 2, 0},
+    {0x1EEE, 6777, 10, 0, 10, 15, 1, 0},
+    {0x1EEF, 6796, 10, 0, 9, 12, 2, 0},
+    {0x1EF0, 6810, 10, 0, 10, 17, 1, -4},
+    {0x1EF1, 6832, 10, 0, 9, 14, 2, -4},
+    {0x1EF2, 6848, 10, 0, 8, 15, 1, 0},
+    {0x1EF3, 6863, 10, 0, 8, 16, 1, -4},
+    {0x1EF4, 6879, 10, 0, 8, 15, 1, -4},
+    {0x1EF5, 6894, 10, 0, 8, 12, 1, -4},
+    {0x1EF6, 6906, 10, 0, 8, 15, 1, 0},
+    {0x1EF7, 6921, 10, 0, 8, 17, 1, -4},
+    {0x1EF8, 6938, 10, 0, 8, 15, 1, 0},
+    {0x1EF9, 6953, 10, 0, 8, 16, 1, -4},
+    {0x2011, 6969, 10, 0, 6, 1, 2, 4},
+    {0x2013, 6970, 10, 0, 8, 1, 1, 4},
+    {0x2014, 6971, 10, 0, 9, 1, 1, 4},
+    {0x2015, 6973, 10, 0, 9, 1, 1, 4},
+    {0x2018, 6975, 10, 0, 4, 5, 3, 7},
+    {0x2019, 6978, 10, 0, 4, 5, 3, 7},
+    {0x201A, 6981, 10, 0, 4, 5, 3, -3},
+    {0x201C, 6984, 10, 0, 8, 5, 1, 7},
+    {0x201D, 6989, 10, 0, 8, 5, 1, 7},
+    {0x201E, 6994, 10, 0, 8, 5, 1, -3},
+    {0x2020, 6999, 10, 0, 8, 12, 1, 0},
+    {0x2021, 7011, 10, 0, 8, 12, 1, 0},
+    {0x2022, 7023, 10, 0, 5, 4, 3, 3},
+    {0x2025, 7026, 10, 0, 8, 3, 1, 0},
+    {0x2026, 7029, 10, 0, 9, 3, 1, 0},
+    {0x2039, 7033, 10, 0, 5, 8, 3, 0},
+    {0x203A, 7038, 10, 0, 5, 8, 3, 0},
+    {0x2044, 7043, 10, 0, 10, 11, 0, 0},
+    {0x2070, 7057, 10, 0, 5, 6, 3, 6},
+    {0x2074, 7061, 10, 0, 5, 6, 3, 6},
+    {0x2075, 7065, 10, 0, 5, 6, 3, 6},
+    {0x2076, 7069, 10, 0, 5, 6, 3, 6},
+    {0x2077, 7073, 10, 0, 5, 6, 3, 6},
+    {0x2078, 7077, 10, 0, 5, 6, 3, 6},
+    {0x2079, 7081, 10, 0, 5, 6, 3, 6},
+    {0x2080, 7085, 10, 0, 5, 6, 3, -4},
+    {0x2081, 7089, 10, 0, 5, 6, 3, -4},
+    {0x2082, 7093, 10, 0, 5, 6, 3, -4},
+    {0x2083, 7097, 10, 0, 5, 6, 3, -4},
+    {0x2084, 7101, 10, 0, 5, 6, 3, -4},
+    {0x2085, 7105, 10, 0, 5, 6, 3, -4},
+    {0x2086, 7109, 10, 0, 5, 6, 3, -4},
+    {0x2087, 7113, 10, 0, 5, 6, 3, -4},
+    {0x2088, 7117, 10, 0, 5, 6, 3, -4},
+    {0x2089, 7121, 10, 0, 5, 6, 3, -4},
+    {0x20A6, 7125, 10, 0, 10, 11, 0, 0},
+    {0x20A9, 7139, 10, 0, 10, 11, 0, 0},
+    {0x20AB, 7153, 10, 0, 9, 13, 1, -2},
+    {0x20AC, 7168, 10, 0, 9, 11, 1, 0},
+    {0x20B1, 7181, 10, 0, 10, 11, 0, 0},
+    {0x20B9, 7195, 10, 0, 8, 11, 1, 0},
+    {0x20BA, 7206, 10, 0, 10, 11, 0, 0},
+    {0x20BD, 7220, 10, 0, 9, 11, 1, 0},
+    {0x2117, 7233, 10, 0, 8, 13, 1, -1},
+    {0x2120, 7246, 10, 0, 9, 5, 1, 7},
+    {0x2122, 7252, 10, 0, 9, 5, 1, 7},
+    {0x2153, 7258, 10, 0, 10, 15, 0, -4},
+    {0x2154, 7277, 10, 0, 10, 15, 0, -4},
+    {0x2155, 7296, 10, 0, 10, 15, 0, -4},
+    {0x2156, 7315, 10, 0, 10, 15, 0, -4},
+    {0x2157, 7334, 10, 0, 10, 15, 0, -4},
+    {0x2158, 7353, 10, 0, 10, 15, 0, -4},
+    {0x2159, 7372, 10, 0, 10, 15, 0, -4},
+    {0x215A, 7391, 10, 0, 10, 15, 0, -4},
+    {0x215B, 7410, 10, 0, 10, 15, 0, -4},
+    {0x215C, 7429, 10, 0, 10, 15, 0, -4},
+    {0x215D, 7448, 10, 0, 10, 15, 0, -4},
+    {0x215E, 7467, 10, 0, 10, 15, 0, -4},
+    {0x2212, 7486, 10, 0, 8, 1, 1, 5},
+    {0x2248, 7487, 10, 0, 9, 9, 1, 1},
+    {0x2260, 7498, 10, 0, 7, 10, 2, 1},
+    {0x2264, 7507, 10, 0, 8, 11, 1, 0},
+    {0x2265, 7518, 10, 0, 7, 11, 2, 0},
+    {0xA788, 7528, 10, 0, 6, 3, 2, -4},
+};
+
+static constexpr uint8_t intel_one_mono_12_pt_bitmaps[7532] = "\xfe\x18\x61\x86\x18\x61\x86\x18\x7f\xfb\x6d\x92"
+                                                              "\x03\x60\xcf\x1c\x71\xc4\x12\x09\x04\x9f\xf2\x21"
+                                                              "\x20\x91\xfe\x24\x22\x12\x00\x08\x08\x3f\x69\x48"
+                                                              "\x48\x78\x3e\x0b\x09\x09\xcb\x7e\x08\x08\x71\xc8"
+                                                              "\xa2\x91\x89\x03\xb8\x24\x51\x48\xa4\xa1\xc0\x1e"
+                                                              "\x10\x08\x04\x01\x13\xdb\x39\x0c\x86\x67\x9e\x60"
+                                                              "\xff\xc0\x06\x18\x61\x86\x08\x30\x60\x81\x83\x02"
+                                                              "\x06\x06\x06\x06\x06\x83\x83\x06\x08\x30\x41\x04"
+                                                              "\x10\x43\x08\x63\x38\x80\x18\x08\xc9\xff\x08\x34"
+                                                              "\x66\x22\x08\x08\x08\x08\xff\x08\x08\x08\x08\x76"
+                                                              "\x6c\x80\xfc\xdf\x00\x01\x01\x02\x02\x04\x0c\x08"
+                                                              "\x18\x10\x30\x20\x60\x40\xc0\x80\x3c\x66\x43\xc3"
+                                                              "\xc5\xd9\xf1\xc1\x43\x66\x3c\x10\xe3\x40\x81\x02"
+                                                              "\x04\x08\x10\x23\xf8\x3e\x63\xc3\x03\x02\x06\x0c"
+                                                              "\x18\x30\x60\xff\xff\x06\x04\x08\x18\x3e\x03\x01"
+                                                              "\x03\x1e\x78\x0e\x07\x05\x86\xc2\x62\x33\x19\xff"
+                                                              "\x06\x03\x01\x80\xfd\x02\x04\x0b\xd8\xc0\x81\x06"
+                                                              "\x3b\xc0\x0c\x18\x30\x60\x7e\xc3\xc1\xc1\x43\x67"
+                                                              "\x3c\xff\x03\x02\x06\x04\x0c\x0c\x18\x18\x30\x30"
+                                                              "\x3c\x62\x43\x43\x62\x1c\x63\xc1\xc1\x63\x3e\x3c"
+                                                              "\x66\xc3\xc1\xc1\x63\x3f\x06\x0c\x18\x30\xdf\x01"
+                                                              "\xbe\x77\x20\x00\x66\x6c\x80\x01\x07\x38\xe0\xe0"
+                                                              "\x38\x07\x01\xfe\x00\x07\xf0\x80\x70\x1c\x03\x03"
+                                                              "\x1c\x70\x80\x3e\xe3\x01\x01\x07\x1c\x10\x10\x00"
+                                                              "\x00\x30\x30\x3e\x20\x90\x51\xe9\x0c\x86\x43\x22"
+                                                              "\x91\x47\x10\x08\x03\xe0\x18\x0e\x0f\x06\x82\x63"
+                                                              "\x31\x88\xfe\x43\x60\xa0\x60\xfc\x86\x82\x86\x8c"
+                                                              "\xf8\x86\x82\x83\x86\xfc\x1e\x63\x40\xc0\xc0\x80"
+                                                              "\xc0\xc0\xc0\x63\x3e\xf0\x9c\x86\x82\x82\x83\x82"
+                                                              "\x82\x86\x9c\xf0\xff\x02\x04\x08\x1f\xa0\x40\x81"
+                                                              "\x03\xf8\xff\x02\x04\x08\x10\x3f\x40\x81\x02\x00"
+                                                              "\x1f\x70\x40\xc0\xc0\x8f\xc1\xc1\x41\x71\x1f\x87"
+                                                              "\x0e\x1c\x38\x7f\xe1\xc3\x87\x0e\x18\xfc\xc3\x0c"
+                                                              "\x30\xc3\x0c\x30\xcf\xc0\x03\x03\x03\x03\x03\x03"
+                                                              "\x03\x03\xc3\x66\x3c\x82\x84\x8c\x98\xb0\xe0\xb0"
+                                                              "\x98\x8c\x86\x83\x81\x02\x04\x08\x10\x20\x40\x81"
+                                                              "\x03\xf8\xc3\xe3\xe5\xe5\xd5\xd9\xd9\xc9\xc1\x81"
+                                                              "\x81\xc3\x87\x8d\x1b\x32\x64\xcd\x8b\x1e\x18\x3c"
+                                                              "\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\xfc\x86"
+                                                              "\x83\x83\x83\x86\xfc\x80\x80\x80\x80\x3c\x33\x30"
+                                                              "\xd8\x2c\x14\x0b\x05\x92\xc7\x33\x0f\xc0\x30\x08"
+                                                              "\xfd\x0e\x0c\x18\x71\xbc\x4c\x8d\x0e\x08\x3f\x63"
+                                                              "\x40\x40\x70\x1e\x03\x01\x01\xc3\x7e\xff\x8c\x06"
+                                                              "\x03\x01\x80\xc0\x60\x30\x18\x0c\x06\x00\xc1\xc1"
+                                                              "\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x81\xe0\x90"
+                                                              "\xc8\x66\x21\x10\x98\x68\x14\x0e\x06\x00\x81\xc0"
+                                                              "\xb2\x59\x2d\x92\xc9\x5c\xae\x66\x33\x18\x80\xc3"
+                                                              "\x62\x26\x34\x18\x18\x1c\x34\x66\x43\xc1\xc1\x43"
+                                                              "\x62\x26\x3c\x18\x18\x18\x18\x18\x18\xff\x03\x06"
+                                                              "\x04\x0c\x18\x10\x30\x60\x40\xff\xff\x0c\x30\xc3"
+                                                              "\x0c\x30\xc3\x0c\x30\xc3\x0f\xc0\x80\xc0\x40\x60"
+                                                              "\x20\x30\x10\x18\x08\x0c\x04\x06\x02\x03\x01\xf8"
+                                                              "\x42\x10\x84\x21\x08\x42\x10\x87\xe0\x18\x1c\x34"
+                                                              "\x26\x62\x43\xc1\xff\x84\x30\x7c\x03\x00\x87\xcc"
+                                                              "\x26\x13\x38\xf7\x81\x02\x04\x0b\xd8\xe0\xc1\x83"
+                                                              "\x07\x3f\xc0\x3e\x63\xc0\xc0\xc0\xc0\x63\x3e\x03"
+                                                              "\x03\x03\x03\x3f\x67\xc3\xc3\xc3\xc3\x67\x39\x3e"
+                                                              "\x63\x41\xff\xc0\xc0\x60\x3e\x0f\x18\x10\x10\xff"
+                                                              "\x10\x10\x10\x10\x10\x10\x10\x3d\x63\xc3\xc3\xc3"
+                                                              "\xc3\x67\x3b\x03\x03\x06\x7c\x81\x02\x04\x09\xdc"
+                                                              "\xf1\xc3\x87\x0e\x1c\x30\x30\x60\x00\x0f\x02\x04"
+                                                              "\x08\x10\x20\x47\xf0\x18\xc0\x0f\x84\x21\x08\x42"
+                                                              "\x10\x84\xfe\x81\x02\x04\x08\x71\xa4\x70\xb1\x32"
+                                                              "\x34\x30\xf8\x18\x18\x18\x18\x18\x18\x18\x18\x18"
+                                                              "\x18\x0f\xbb\x7e\xf2\x71\x38\x9c\x4e\x27\x13\x9d"
+                                                              "\xcf\x1c\x38\x70\xe1\xc3\x3c\x63\xc1\xc1\xc1\xc1"
+                                                              "\x63\x3c\xbd\x8e\x0c\x18\x30\x71\xdc\x81\x02\x04"
+                                                              "\x00\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03\x03\x03"
+                                                              "\x03\xe7\x2e\x28\x30\x20\x20\x20\xfc\x7f\x82\x07"
+                                                              "\x81\xe0\xc1\xfe\x10\x10\x10\xff\x10\x10\x10\x10"
+                                                              "\x10\x18\x0f\x87\x0e\x1c\x38\x70\xf7\xfb\xc1\x43"
+                                                              "\x62\x62\x26\x34\x1c\x18\x81\xc4\xb2\x5b\x25\xf2"
+                                                              "\xb9\x98\xcc\x43\x66\x34\x18\x1c\x34\x66\xc3\xc1"
+                                                              "\x43\x62\x62\x26\x34\x1c\x18\x18\x18\x30\xe0\x7f"
+                                                              "\x02\x06\x0c\x18\x30\x60\xff\x07\x3c\x30\x18\x0c"
+                                                              "\x04\x1c\xe0\xe0\x1c\x04\x0c\x18\x30\x3c\x07\xff"
+                                                              "\xfe\xf0\x3c\x0c\x08\x18\x30\x18\x07\x07\x18\x30"
+                                                              "\x18\x08\x0c\x3c\xf0\x61\xec\xa3\xd0\xc0\xdc\x04"
+                                                              "\xb6\xdb\x70\x08\x08\x3e\x6b\xc8\xc8\xc8\xc8\x6b"
+                                                              "\x3e\x08\x08\x3c\x67\x41\x40\x60\x30\xff\x10\x20"
+                                                              "\x40\xff\xc1\x43\x66\x34\x1c\xff\x08\xff\x08\x08"
+                                                              "\x08\x3f\x61\x40\x70\x3c\x67\xc1\x81\xc1\x76\x1c"
+                                                              "\x06\x03\x42\x7e\xcf\x30\x3c\x42\x81\x9d\xb5\xa1"
+                                                              "\xa1\xa1\xa7\x9d\x81\x42\x3c\xf8\x18\xf6\x28\xde"
+                                                              "\xc0\x00\xfe\x11\x33\x66\xcc\xcc\x66\x33\x11\x3c"
+                                                              "\x42\x9d\x95\x9d\x99\x95\x42\x3c\xfc\x79\x8a\x1c"
+                                                              "\x18\x78\x9e\x00\x08\x08\x08\xff\x08\x08\x08\x00"
+                                                              "\x00\x00\xff\x74\xc4\x44\x7c\xf1\x18\x31\xf8\x16"
+                                                              "\x80\x87\x0e\x1c\x38\x70\xf7\xfb\x81\x02\x04\x00"
+                                                              "\x3f\x7b\xfb\xfb\xfb\x7b\x3b\x03\x03\x03\x03\xdf"
+                                                              "\x00\x23\x06\x3e\x00\x67\x08\x42\x7c\x7b\x18\x61"
+                                                              "\xc5\xe0\x3f\x88\xc4\x62\x33\x11\x62\xc4\x88\x20"
+                                                              "\x38\x02\x00\x81\x20\xfe\x40\x20\x10\x18\x08\x44"
+                                                              "\x32\x14\x0f\xc0\x40\x10\x20\x38\x02\x00\x81\x20"
+                                                              "\xfe\x40\x20\x10\x18\x08\xe4\x46\x02\x01\x00\x80"
+                                                              "\x7c\xf8\x04\x03\x00\x21\x08\xdc\x40\x20\x10\x18"
+                                                              "\x08\x44\x32\x14\x0f\xc0\x40\x10\x0e\x0e\x00\x00"
+                                                              "\x04\x0c\x38\x60\xc0\xc0\x41\x3e\x60\x0c\x00\x00"
+                                                              "\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f\xe4\x36\x0a"
+                                                              "\x06\x06\x06\x04\x00\x01\x80\xe0\xf0\x68\x26\x33"
+                                                              "\x18\x8f\xe4\x36\x0a\x06\x18\x13\x10\x80\x01\x80"
+                                                              "\xe0\xf0\x68\x26\x33\x18\x8f\xe4\x36\x0a\x06\x32"
+                                                              "\x25\x11\x00\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f"
+                                                              "\xe4\x36\x0a\x06\x62\x33\x00\x00\x01\x80\xe0\xf0"
+                                                              "\x68\x26\x33\x18\x8f\xe4\x36\x0a\x06\x3c\x11\x08"
+                                                              "\x87\x81\xc1\xa0\xd0\x4c\x66\x31\x1f\xd8\x6c\x14"
+                                                              "\x0c\x0f\xc5\x81\x60\xd8\x26\x09\xf6\x61\xf8\x46"
+                                                              "\x31\x88\x7c\x1e\x63\x40\xc0\xc0\x80\xc0\xc0\xc0"
+                                                              "\x63\x3e\x08\x0e\x02\x1c\x60\x60\x20\x0f\xf0\x20"
+                                                              "\x40\x81\xfa\x04\x08\x10\x3f\x80\x04\x30\x80\x0f"
+                                                              "\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f\x80\x38\xd8"
+                                                              "\x00\x0f\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f\x80"
+                                                              "\x47\x8c\x00\x0f\xf0\x20\x40\x81\xfa\x04\x08\x10"
+                                                              "\x3f\x80\xc0\xc0\x00\xfc\xc3\x0c\x30\xc3\x0c\x30"
+                                                              "\xcf\xc0\x0c\x62\x00\xfc\xc3\x0c\x30\xc3\x0c\x30"
+                                                              "\xcf\xc0\x31\x38\x00\xfc\xc3\x0c\x30\xc3\x0c\x30"
+                                                              "\xcf\xc0\xc7\x30\x00\xfc\xc3\x0c\x30\xc3\x0c\x30"
+                                                              "\xcf\xc0\x78\x27\x10\xc8\x24\x17\x8d\x04\x82\x43"
+                                                              "\x27\x1e\x00\x67\x2a\x20\x0c\x38\x78\xd1\xb3\x26"
+                                                              "\x4c\xd8\xb1\xe1\x80\x60\x18\x00\x00\x3c\x66\xc3"
+                                                              "\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x06\x0c\x10\x00"
+                                                              "\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x18"
+                                                              "\x34\x42\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3"
+                                                              "\x66\x3c\x32\x4a\x44\x00\x3c\x66\xc3\xc1\xc1\x81"
+                                                              "\xc1\xc1\xc3\x66\x3c\x66\x00\x00\x3c\x66\xc3\xc1"
+                                                              "\xc1\x81\xc1\xc1\xc3\x66\x3c\x83\x89\xa1\xc3\x8d"
+                                                              "\xb1\xc0\x01\x9e\x98\x98\x6c\x56\x4a\x25\xa2\xe1"
+                                                              "\x71\x99\x8f\x88\x00\x60\x18\x00\x00\xc1\xc1\xc1"
+                                                              "\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x06\x0c\x10\x00"
+                                                              "\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x18"
+                                                              "\x26\x40\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3"
+                                                              "\x67\x3c\x62\x66\x00\x00\xc1\xc1\xc1\xc1\xc1\xc1"
+                                                              "\xc1\xc1\xc3\x67\x3c\x06\x0c\x10\x00\xc1\x43\x62"
+                                                              "\x26\x3c\x18\x18\x18\x18\x18\x18\x80\x80\xfc\x86"
+                                                              "\x83\x83\x83\x86\xfc\x80\x80\x7c\xc6\x86\x86\x8c"
+                                                              "\x98\x98\x86\x82\x83\x82\x9e\x20\x0c\x00\x00\x07"
+                                                              "\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70\x06\x04\x04"
+                                                              "\x00\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70\x18"
+                                                              "\x13\x10\x80\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f"
+                                                              "\x70\x32\x25\x11\x00\x07\xc0\x30\x08\x7c\xc2\x61"
+                                                              "\x33\x8f\x70\x66\x00\x00\x0f\x80\x60\x10\xf9\x84"
+                                                              "\xc2\x67\x1e\xe0\x3c\x11\x09\x03\x00\x03\xe0\x18"
+                                                              "\x04\x3e\x61\x30\x99\xc7\xb8\xf7\x0e\x86\x63\x17"
+                                                              "\xfc\xc2\x71\xce\x3e\x63\xc0\xc0\xc0\xc0\x63\x3e"
+                                                              "\x10\x1e\x06\x3c\x20\x18\x04\x00\x3e\x63\x41\xff"
+                                                              "\xc0\xc0\x60\x3e\x06\x0c\x10\x00\x3e\x63\x41\xff"
+                                                              "\xc0\xc0\x60\x3e\x18\x34\x62\x00\x3e\x63\x41\xff"
+                                                              "\xc0\xc0\x60\x3e\x66\x00\x00\x3e\x63\x41\xff\xc0"
+                                                              "\xc0\x60\x3e\x40\x60\x20\x0f\x02\x04\x08\x10\x20"
+                                                              "\x47\xf0\x0c\x30\x80\x0f\x02\x04\x08\x10\x20\x47"
+                                                              "\xf0\x38\xd8\x00\x0f\x02\x04\x08\x10\x20\x47\xf0"
+                                                              "\x45\x98\x00\x0f\x02\x04\x08\x10\x20\x47\xf0\x36"
+                                                              "\x1c\x1e\x33\x01\x3d\x63\xc1\xc1\xc3\x66\x3c\x65"
+                                                              "\x2a\x20\x09\xdc\xf1\xc3\x87\x0e\x1c\x30\x20\x18"
+                                                              "\x00\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x06\x08"
+                                                              "\x10\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x18\x34"
+                                                              "\x42\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x32\x4a"
+                                                              "\x44\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x66\x00"
+                                                              "\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x18\x18\x00"
+                                                              "\x00\xff\x00\x00\x18\x18\x01\x3f\x62\xc5\xc9\xd1"
+                                                              "\xf1\x67\x7c\x80\x40\x60\x00\x08\x70\xe1\xc3\x87"
+                                                              "\x0f\x7f\xb0\x0c\x30\x80\x08\x70\xe1\xc3\x87\x0f"
+                                                              "\x7f\xb0\x38\x9a\x10\x08\x70\xe1\xc3\x87\x0f\x7f"
+                                                              "\xb0\x45\x98\x00\x08\x70\xe1\xc3\x87\x0f\x7f\xb0"
+                                                              "\x06\x0c\x10\x00\xc1\x43\x62\x62\x26\x34\x1c\x18"
+                                                              "\x18\x18\x30\xe0\x81\x02\x04\x0b\xd8\xe0\xc1\x83"
+                                                              "\x07\x1d\xc8\x10\x20\x40\x22\x66\x00\x00\xc1\x43"
+                                                              "\x62\x62\x26\x34\x1c\x18\x18\x18\x30\xe0\x7e\x00"
+                                                              "\x00\x03\x01\xc1\xe0\xd0\x4c\x66\x31\x1f\xc8\x6c"
+                                                              "\x14\x0c\x7e\x00\x00\x0f\x80\x60\x10\xf9\x84\xc2"
+                                                              "\x67\x1e\xe0\x42\x13\x07\x00\x01\x80\xe0\xf0\x68"
+                                                              "\x26\x33\x18\x8f\xe4\x36\x0a\x06\x42\x13\x07\x00"
+                                                              "\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70\x18\x0e"
+                                                              "\x0f\x06\x82\x63\x31\x88\xfe\x43\x60\xa0\x60\x20"
+                                                              "\x20\x10\x0e\x7c\x03\x00\x87\xcc\x26\x13\x38\xf7"
+                                                              "\x02\x01\x01\x00\xe0\x02\x06\x08\x00\x1e\x63\x40"
+                                                              "\xc0\xc0\x80\xc0\xc0\xc0\x63\x3e\x06\x0c\x10\x00"
+                                                              "\x3e\x63\xc0\xc0\xc0\xc0\x63\x3e\x0c\x16\x21\x00"
+                                                              "\x1e\x63\x40\xc0\xc0\x80\xc0\xc0\xc0\x63\x3e\x08"
+                                                              "\x36\x63\x00\x3e\x63\xc0\xc0\xc0\xc0\x63\x3e\x08"
+                                                              "\x0c\x00\x00\x1e\x63\x40\xc0\xc0\x80\xc0\xc0\xc0"
+                                                              "\x63\x3e\x08\x1c\x00\x00\x3e\x63\xc0\xc0\xc0\xc0"
+                                                              "\x63\x3e\x21\x16\x0c\x00\x1e\x63\x40\xc0\xc0\x80"
+                                                              "\xc0\xc0\xc0\x63\x3e\x22\x14\x08\x00\x3e\x63\xc0"
+                                                              "\xc0\xc0\xc0\x63\x3e\x8c\x78\x20\x00\xf0\x9c\x86"
+                                                              "\x82\x82\x83\x82\x82\x86\x9c\xf0\x00\x20\x64\x0c"
+                                                              "\x81\x90\x30\x7e\x19\xc6\x18\xc3\x18\x63\x0c\x33"
+                                                              "\x83\x90\x78\x27\x10\xc8\x24\x17\x8d\x04\x82\x43"
+                                                              "\x27\x1e\x00\x03\x01\x87\xe0\x60\x31\xf9\x9d\x86"
+                                                              "\xc3\x61\x99\xc7\x60\x7c\x00\x07\xf8\x10\x20\x40"
+                                                              "\xfd\x02\x04\x08\x1f\xc0\x3e\x00\x00\x3e\x63\x41"
+                                                              "\xff\xc0\xc0\x60\x3e\x46\xd8\xe0\x0f\xf0\x20\x40"
+                                                              "\x81\xfa\x04\x08\x10\x3f\x80\x62\x36\x1c\x00\x3e"
+                                                              "\x63\x41\xff\xc0\xc0\x60\x3e\x10\x30\x00\x0f\xf0"
+                                                              "\x20\x40\x81\xfa\x04\x08\x10\x3f\x80\x08\x18\x00"
+                                                              "\x00\x3e\x63\x41\xff\xc0\xc0\x60\x3e\xff\x02\x04"
+                                                              "\x08\x1f\xa0\x40\x81\x03\xf8\x20\x81\x03\x80\x3c"
+                                                              "\x62\x43\xc1\xff\xc0\x60\x3e\x04\x08\x08\x0e\xc6"
+                                                              "\x50\x40\x0f\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f"
+                                                              "\x80\x62\x14\x08\x00\x3e\x63\x41\xff\xc0\xc0\x60"
+                                                              "\x3e\x0c\x32\x21\x00\x1f\x70\x40\xc0\xc0\x8f\xc1"
+                                                              "\xc1\x41\x71\x1f\x18\x34\x42\x00\x3d\x63\xc3\xc3"
+                                                              "\xc3\xc3\x67\x3b\x03\x03\x06\x7c\x21\x32\x0c\x00"
+                                                              "\x1f\x70\x40\xc0\xc0\x8f\xc1\xc1\x41\x71\x1f\x42"
+                                                              "\x26\x1c\x00\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03"
+                                                              "\x03\x06\x7c\x08\x0c\x00\x00\x1f\x70\x40\xc0\xc0"
+                                                              "\x8f\xc1\xc1\x41\x71\x1f\x08\x18\x00\x00\x3d\x63"
+                                                              "\xc3\xc3\xc3\xc3\x67\x3b\x03\x03\x06\x7c\x1f\x70"
+                                                              "\x40\xc0\xc0\x8f\xc1\xc1\x41\x71\x1f\x00\x1c\x06"
+                                                              "\x06\x1c\x1c\x30\x30\x0c\x00\x3d\x63\xc3\xc3\xc3"
+                                                              "\xc3\x67\x3b\x03\x03\x06\x7c\x30\x9a\x00\x08\x70"
+                                                              "\xe1\xc3\x87\xfe\x1c\x38\x70\xe1\x80\x30\x1a\x08"
+                                                              "\x40\x00\x10\x04\x01\x00\x40\x13\x87\x31\x8c\x43"
+                                                              "\x10\xc4\x31\x0c\x43\x43\x21\xbf\xe8\x64\x33\xf9"
+                                                              "\x0c\x86\x43\x21\x90\xc0\x20\x10\x3f\x04\x02\x01"
+                                                              "\x38\xa6\x63\x21\x90\xc8\x64\x30\x66\x58\x80\xfc"
+                                                              "\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0\x63\x3a\x20\x0f"
+                                                              "\x02\x04\x08\x10\x20\x47\xf0\xfc\x00\x3f\x30\xc3"
+                                                              "\x0c\x30\xc3\x0c\x33\xf0\x7c\x00\x07\x81\x02\x04"
+                                                              "\x08\x10\x23\xf8\x85\x33\x80\xfc\xc3\x0c\x30\xc3"
+                                                              "\x0c\x30\xcf\xc0\xc4\xd8\xe0\x0f\x02\x04\x08\x10"
+                                                              "\x20\x47\xf0\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc8"
+                                                              "\x21\x83\x80\x30\x60\x00\x0f\x02\x04\x08\x10\x20"
+                                                              "\x47\xf1\x04\x08\x1c\x30\xc0\x00\xfc\xc3\x0c\x30"
+                                                              "\xc3\x0c\x30\xcf\xc0\xf0\x20\x40\x81\x02\x04\x7f"
+                                                              "\x03\x01\x20\x84\x00\x03\x00\xc0\x30\x0c\x03\x00"
+                                                              "\xc0\x30\x0c\xc3\x19\x83\xc0\x1c\x6c\x00\x0f\x81"
+                                                              "\x02\x04\x08\x10\x20\x40\x81\x0e\x78\x82\x84\x8c"
+                                                              "\x98\xb0\xe0\xb0\x98\x8c\x86\x83\x00\x30\x08\x08"
+                                                              "\x30\x81\x02\x04\x08\x71\xa4\x70\xb1\x32\x34\x30"
+                                                              "\x0e\x06\x0c\x70\x10\x60\x80\x00\x40\x40\x40\x40"
+                                                              "\x40\x40\x40\x40\x40\x40\x7f\x0c\x10\x00\x00\xf8"
+                                                              "\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x0f\x81"
+                                                              "\x02\x04\x08\x10\x20\x40\x81\x03\xf8\x03\x01\x02"
+                                                              "\x18\xf8\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18"
+                                                              "\x0f\x00\x38\x0c\x0c\x38\x89\x12\x24\x48\x10\x20"
+                                                              "\x40\x81\x03\xf8\x01\xf9\x19\x19\x18\x18\x18\x18"
+                                                              "\x18\x18\x18\x18\x0f\x81\x02\x04\x38\x70\xe0\x40"
+                                                              "\x81\x03\xf8\xf8\x03\x00\x60\x0c\x01\x8c\x31\xc6"
+                                                              "\x30\xc0\x18\x03\x00\x60\x07\x80\x60\x60\x60\x6c"
+                                                              "\x78\x60\xe0\x60\x60\x60\x7f\xf8\x18\x18\x18\x1e"
+                                                              "\x18\x78\x18\x18\x18\x18\x0f\x0c\x30\x80\x0c\x38"
+                                                              "\x78\xd1\xb3\x26\x4c\xd8\xb1\xe1\x80\x0c\x20\x80"
+                                                              "\x09\xdc\xf1\xc3\x87\x0e\x1c\x30\xc3\x87\x8d\x1b"
+                                                              "\x32\x64\xcd\x8b\x1e\x18\x07\x03\x02\x38\x9d\xcf"
+                                                              "\x1c\x38\x70\xe1\xc3\x00\x60\x20\x43\x00\xc4\xf0"
+                                                              "\x40\x0c\x38\x78\xd1\xb3\x26\x4c\xd8\xb1\xe1\x80"
+                                                              "\xc4\xf0\x40\x09\xdc\xf1\xc3\x87\x0e\x1c\x30\xc3"
+                                                              "\x87\x8d\x1b\x32\x66\xc5\x8b\x1e\x18\x30\x20\xcf"
+                                                              "\x00\x9d\xcf\x1c\x38\x70\xe1\xc3\x06\x0c\x39\xe0"
+                                                              "\x7e\x00\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3"
+                                                              "\x66\x3c\x7e\x00\x00\x3c\x63\xc1\xc1\xc1\xc1\x63"
+                                                              "\x3c\x42\x26\x1c\x00\x3c\x66\xc3\xc1\xc1\x81\xc1"
+                                                              "\xc1\xc3\x66\x3c\x42\x26\x1c\x00\x3c\x63\xc1\xc1"
+                                                              "\xc1\xc1\x63\x3c\x11\x91\x80\x80\x03\xc3\x33\x0d"
+                                                              "\x82\xc1\x40\xb0\x58\x2c\x33\x30\xf0\x13\x22\x00"
+                                                              "\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x1f\xcd\x86"
+                                                              "\x61\x18\xc6\x31\xfc\x61\x18\x46\x19\x81\xfc\x3b"
+                                                              "\x9a\xb4\xc7\x1f\xc4\x13\x06\xe0\xee\x04\x30\x80"
+                                                              "\x0f\xd0\xe0\xc1\x87\x1b\xc4\xc8\xd0\xe0\x80\x06"
+                                                              "\x08\x10\x00\xe7\x2e\x28\x30\x20\x20\x20\xfc\xfd"
+                                                              "\x0e\x0c\x18\x71\xbc\x4c\x8d\x0e\x08\x03\x01\x02"
+                                                              "\x18\xe7\x2e\x28\x30\x20\x20\x20\xfc\x00\x70\x18"
+                                                              "\x18\x60\xc6\x50\x40\x0f\xd0\xe0\xc1\x87\x1b\xc4"
+                                                              "\xc8\xd0\xe0\x80\x62\x3c\x18\x00\xe7\x2e\x28\x30"
+                                                              "\x20\x20\x20\xfc\x06\x0c\x10\x00\x3f\x63\x40\x40"
+                                                              "\x70\x1e\x03\x01\x01\xc3\x7e\x0c\x30\x80\x07\xf8"
+                                                              "\x20\x78\x1e\x0c\x1f\xe0\x18\x36\x42\x00\x3f\x63"
+                                                              "\x40\x40\x70\x1e\x03\x01\x01\xc3\x7e\x10\xdb\x18"
+                                                              "\x07\xf8\x20\x78\x1e\x0c\x1f\xe0\x3f\x63\x40\x40"
+                                                              "\x70\x1e\x03\x01\x01\xc3\x7e\x10\x1e\x06\x3c\x7f"
+                                                              "\x82\x07\x81\xe0\xc1\xfe\x20\x78\x33\x80\x62\x34"
+                                                              "\x08\x00\x3f\x63\x40\x40\x70\x1e\x03\x01\x01\xc3"
+                                                              "\x7e\x44\x50\x40\x07\xf8\x20\x78\x1e\x0c\x1f\xe0"
+                                                              "\xff\x8c\x06\x03\x01\x80\xc0\x60\x30\x18\x0c\x06"
+                                                              "\x01\x01\xc0\x10\x18\x70\x10\x10\x10\xff\x10\x10"
+                                                              "\x10\x10\x10\x18\x0f\x08\x0e\x02\x1c\x62\x1e\x02"
+                                                              "\x00\x0f\xf8\xc0\x60\x30\x18\x0c\x06\x03\x01\x80"
+                                                              "\xc0\x60\x02\x02\x02\x12\x10\x10\xff\x10\x10\x10"
+                                                              "\x10\x10\x18\x0f\xff\x8c\x06\x03\x01\x83\xf0\x60"
+                                                              "\x30\x18\x0c\x06\x00\x10\x10\x10\xff\x10\x10\x7e"
+                                                              "\x10\x10\x18\x0f\x32\x4a\x44\x00\xc1\xc1\xc1\xc1"
+                                                              "\xc1\xc1\xc1\xc1\xc3\x67\x3c\x67\x2a\x20\x08\x70"
+                                                              "\xe1\xc3\x87\x0f\x7f\xb0\x7e\x00\x00\xc1\xc1\xc1"
+                                                              "\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\xfc\x00\x04\x38"
+                                                              "\x70\xe1\xc3\x87\xbf\xd8\x42\x26\x1c\x00\xc1\xc1"
+                                                              "\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x84\x98\xe0"
+                                                              "\x08\x70\xe1\xc3\x87\x0f\x7f\xb0\x3c\x22\x26\x1c"
+                                                              "\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c"
+                                                              "\x78\x89\x31\xc0\x10\xe1\xc3\x87\x0e\x1e\xff\x60"
+                                                              "\x11\x91\x80\x80\x0c\x16\x0b\x05\x82\xc1\x60\xb0"
+                                                              "\x58\x2c\x33\x38\xf0\x26\x88\x00\x08\x70\xe1\xc3"
+                                                              "\x87\x0f\x7f\xb0\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1"
+                                                              "\xc3\x67\x3c\x08\x10\x10\x1c\x86\x86\x86\x86\x86"
+                                                              "\x86\xde\xf6\x04\x04\x0c\x07\x18\x13\x10\x00\x08"
+                                                              "\x1c\x0b\x25\x92\xd9\x2c\x95\xca\xe6\x63\x31\x88"
+                                                              "\x18\x13\x10\x80\x08\x1c\x4b\x25\xb2\x5f\x2b\x99"
+                                                              "\x8c\xc0\x18\x26\x40\x00\xc1\x43\x62\x26\x3c\x18"
+                                                              "\x18\x18\x18\x18\x18\x1c\x26\x40\x00\xc1\x43\x62"
+                                                              "\x62\x26\x34\x1c\x18\x18\x18\x30\xe0\x62\x66\x00"
+                                                              "\x00\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18"
+                                                              "\x06\x0c\x10\x00\xff\x03\x06\x04\x0c\x18\x10\x30"
+                                                              "\x60\x40\xff\x06\x0c\x10\x00\x7f\x02\x06\x0c\x18"
+                                                              "\x30\x60\xff\x18\x18\x00\x00\xff\x03\x06\x04\x0c"
+                                                              "\x18\x10\x30\x60\x40\xff\x08\x18\x00\x00\x7f\x02"
+                                                              "\x06\x0c\x18\x30\x60\xff\x62\x3c\x08\x00\xff\x03"
+                                                              "\x06\x04\x0c\x18\x10\x30\x60\x40\xff\x62\x14\x08"
+                                                              "\x00\x7f\x02\x06\x0c\x18\x30\x60\xff\x7c\x06\x03"
+                                                              "\x01\x01\xff\xc1\xc1\xc3\x66\x3c\x00\x80\x4f\xec"
+                                                              "\xcc\x36\x0b\x05\x02\xc1\x60\xb0\xcc\xc3\xc0\x00"
+                                                              "\x80\xcf\xcc\x4c\x16\x0b\x05\x82\x63\x1e\x00\x00"
+                                                              "\x40\x1c\x1f\x04\xc1\x30\x4c\x13\x04\xc1\x30\x4c"
+                                                              "\x31\x9c\x3c\x00\x01\x80\xe1\xd0\xc8\x64\x32\x19"
+                                                              "\x0c\xde\x7b\x00\x62\x1e\x02\x00\x01\x80\xe0\xf0"
+                                                              "\x68\x26\x33\x18\x8f\xe4\x36\x0a\x06\x62\x1e\x02"
+                                                              "\x00\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70\xc5"
+                                                              "\xe1\x00\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0\xc4"
+                                                              "\x50\x40\x0f\x02\x04\x08\x10\x20\x47\xf0\x62\x3c"
+                                                              "\x08\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66"
+                                                              "\x3c\x62\x3c\x08\x00\x3c\x63\xc1\xc1\xc1\xc1\x63"
+                                                              "\x3c\x62\x3c\x08\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1"
+                                                              "\xc1\xc3\x67\x3c\xc4\xd0\x40\x08\x70\xe1\xc3\x87"
+                                                              "\x0f\x7f\xb0\x7e\x00\x00\x62\x66\x00\x00\xc1\xc1"
+                                                              "\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x7c\xf8\x06"
+                                                              "\x60\x00\x21\xc3\x87\x0e\x1c\x3d\xfe\xc0\x06\x18"
+                                                              "\x00\x62\x66\x00\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1"
+                                                              "\xc1\xc3\x67\x3c\x04\x38\xc0\x00\x19\x80\x00\x87"
+                                                              "\x0e\x1c\x38\x70\xf7\xfb\x40\x26\x1c\x00\x62\x66"
+                                                              "\x00\x00\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67"
+                                                              "\x3c\x4c\x70\x40\x0c\xc0\x00\x43\x87\x0e\x1c\x38"
+                                                              "\x7b\xfd\x80\x40\x70\x18\x00\x62\x66\x00\x00\xc1"
+                                                              "\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x60\x30"
+                                                              "\x00\x0c\xc0\x00\x43\x87\x0e\x1c\x38\x7b\xfd\x80"
+                                                              "\x23\x1e\x0c\x00\x1f\x70\x40\xc0\xc0\x8f\xc1\xc1"
+                                                              "\x41\x71\x1f\x62\x3c\x08\x00\x3d\x63\xc3\xc3\xc3"
+                                                              "\xc3\x67\x3b\x03\x03\x06\x7c\x3c\x66\xc3\xc1\xc1"
+                                                              "\x81\xc1\xc1\xc3\x66\x3c\x10\x10\x10\x1c\x3c\x63"
+                                                              "\xc1\xc1\xc1\xc1\x63\x3c\x10\x10\x10\x1c\x62\x28"
+                                                              "\x20\x0f\x81\x02\x04\x08\x10\x20\x40\x81\x0e\x78"
+                                                              "\xc0\x60\x00\x0c\x38\x78\xd1\xb3\x26\x4c\xd8\xb1"
+                                                              "\xe1\x80\x40\x60\x00\x09\xdc\xf1\xc3\x87\x0e\x1c"
+                                                              "\x30\x3f\x63\x40\x40\x70\x1e\x03\x01\x01\xc3\x7e"
+                                                              "\x00\x38\x0c\x0c\x38\x7f\x82\x07\x81\xe0\xc1\xfe"
+                                                              "\x00\xe0\x60\xc7\x00\xff\x8c\x06\x03\x01\x80\xc0"
+                                                              "\x60\x30\x18\x0c\x06\x00\x03\x80\x60\x10\x70\x10"
+                                                              "\x10\x10\xff\x10\x10\x10\x10\x10\x18\x0f\x00\x18"
+                                                              "\x04\x04\x18\x18\x0c\x00\x00\x01\x80\xe0\xf0\x68"
+                                                              "\x26\x33\x18\x8f\xe4\x36\x0a\x06\x08\x0c\x00\x00"
+                                                              "\x07\xc0\x30\x08\x7c\xc2\x61\x33\x8f\x70\x08\x18"
+                                                              "\x00\x00\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66"
+                                                              "\x3c\x08\x18\x00\x00\x3c\x63\xc1\xc1\xc1\xc1\x63"
+                                                              "\x3c\x7e\x00\x00\xc1\x43\x62\x26\x3c\x18\x18\x18"
+                                                              "\x18\x18\x18\x7e\x00\x00\xc1\x43\x62\x62\x26\x34"
+                                                              "\x1c\x18\x18\x18\x30\xe0\xf8\x42\x10\x84\x21\x08"
+                                                              "\x4f\xe0\x3c\x03\x01\xff\xc1\x43\x66\x3c\xff\xc0"
+                                                              "\xcf\x1c\x71\xc4\x13\x66\xe0\x33\x66\xc0\xe3\x11"
+                                                              "\x13\xc0\x7c\x88\x8c\x70\x31\xa8\x40\x85\xa3\x00"
+                                                              "\xff\xfc\xff\xfc\xfc\x85\x37\x80\xf0\x74\x63\xe0"
+                                                              "\x24\xc7\x67\x6a\x70\x22\x8a\x20\x98\x80\x2e\x00"
+                                                              "\x31\x28\x40\x66\xd9\x80\xfc\x87\x37\x80\xf0\xcf"
+                                                              "\x30\xe3\x3e\xf9\x9f\x66\x8a\x20\x85\x23\x00\x7c"
+                                                              "\xc7\xf0\xf0\xcf\x30\xe3\x3e\x43\x06\x3e\x00\x4a"
+                                                              "\x70\x31\x28\x40\x87\x37\x80\xfc\x10\x10\xfc\x96"
+                                                              "\x92\x92\x96\xf8\x96\x92\x93\x96\xfc\x10\x10\xfc"
+                                                              "\x86\x82\x86\x8c\xf8\x86\x82\x83\x86\xfc\x00\x00"
+                                                              "\xfc\x81\x02\x04\x0b\xd8\xe0\xc1\x83\x07\x3f\xc0"
+                                                              "\x00\x3f\x00\xf0\x9c\x86\x82\x82\x83\x82\x82\x86"
+                                                              "\x9c\xf0\x00\x00\x30\x30\x03\x03\x03\x03\x3f\x67"
+                                                              "\xc3\xc3\xc3\xc3\x67\x39\x00\x00\x18\x18\xf0\x9c"
+                                                              "\x86\x82\x82\x83\x82\x82\x86\x9c\xf0\x00\x00\xfc"
+                                                              "\x03\x03\x03\x03\x3f\x67\xc3\xc3\xc3\xc3\x67\x39"
+                                                              "\x00\x00\x7e\xf0\x9c\x86\x82\x82\x83\x82\x82\x86"
+                                                              "\x9c\xf0\x00\x30\x58\x84\x03\x03\x03\x03\x3f\x67"
+                                                              "\xc3\xc3\xc3\xc3\x67\x39\x00\x18\x34\x42\x3f\x00"
+                                                              "\x00\x1f\x70\x40\xc0\xc0\x8f\xc1\xc1\x41\x71\x1f"
+                                                              "\x7e\x00\x00\x3d\x63\xc3\xc3\xc3\xc3\x67\x3b\x03"
+                                                              "\x03\x06\x7c\x87\x0e\x1c\x38\x7f\xe1\xc3\x87\x0e"
+                                                              "\x18\x00\x06\x0c\x00\x81\x02\x04\x09\xdc\xf1\xc3"
+                                                              "\x87\x0e\x1c\x30\x00\x0c\x18\x43\x43\x43\x43\x43"
+                                                              "\x7f\x43\x43\x43\x43\x43\x40\xe0\x10\x30\xc0\x40"
+                                                              "\x40\x40\x40\x4e\x73\x63\x43\x43\x43\x43\x43\x40"
+                                                              "\xe0\x10\x30\xc0\x87\x0e\x1c\x38\x7f\xe1\xc3\x87"
+                                                              "\x0e\x18\x08\x49\x9e\x00\x81\x02\x04\x09\xdc\xf1"
+                                                              "\xc3\x87\x0e\x1c\x30\x10\x91\x1c\x82\x84\x8c\x98"
+                                                              "\xb0\xe0\xb0\x98\x8c\x86\x83\x00\x00\x10\x30\x81"
+                                                              "\x02\x04\x08\x71\xa4\x70\xb1\x32\x34\x30\x00\x0c"
+                                                              "\x18\x82\x84\x8c\x98\xb0\xe0\xb0\x98\x8c\x86\x83"
+                                                              "\x00\x00\x7c\x81\x02\x04\x08\x71\xa4\x70\xb1\x32"
+                                                              "\x34\x30\x00\x3f\x00\x81\x02\x04\x08\x10\x20\x40"
+                                                              "\x81\x03\xf8\x00\x03\x06\x00\xf8\x18\x18\x18\x18"
+                                                              "\x18\x18\x18\x18\x18\x18\x0f\x00\x00\x18\x18\xf8"
+                                                              "\x00\x00\x04\x02\x01\x00\x80\x40\x20\x10\x08\x04"
+                                                              "\x02\x01\xfc\x00\x00\x06\x03\x00\x7e\x00\x00\xf8"
+                                                              "\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x0f\x00"
+                                                              "\x00\x18\x18\x81\x02\x04\x08\x10\x20\x40\x81\x03"
+                                                              "\xf8\x00\x0f\x80\xf8\x18\x18\x18\x18\x18\x18\x18"
+                                                              "\x18\x18\x18\x0f\x00\x00\x7e\x81\x02\x04\x08\x10"
+                                                              "\x20\x40\x81\x03\xf8\x01\x85\x90\x80\xf8\x18\x18"
+                                                              "\x18\x18\x18\x18\x18\x18\x18\x18\x0f\x00\x18\x34"
+                                                              "\x42\x06\x0c\x10\x00\xc3\xe3\xe5\xe5\xd5\xd9\xd9"
+                                                              "\xc9\xc1\x81\x81\x06\x04\x04\x00\x0b\xb7\xef\x27"
+                                                              "\x13\x89\xc4\xe2\x71\x30\x08\x18\x00\x00\xc3\xe3"
+                                                              "\xe5\xe5\xd5\xd9\xd9\xc9\xc1\x81\x81\x08\x0c\x00"
+                                                              "\x00\x0b\xb7\xef\x27\x13\x89\xc4\xe2\x71\x30\xc3"
+                                                              "\xe3\xe5\xe5\xd5\xd9\xd9\xc9\xc1\x81\x81\x00\x00"
+                                                              "\x18\x18\xbb\x7e\xf2\x71\x38\x9c\x4e\x27\x13\x00"
+                                                              "\x00\x06\x03\x00\x10\x60\x00\x0c\x38\x78\xd1\xb3"
+                                                              "\x26\x4c\xd8\xb1\xe1\x80\x10\x60\x00\x09\xdc\xf1"
+                                                              "\xc3\x87\x0e\x1c\x30\xc3\x87\x8d\x1b\x32\x64\xcd"
+                                                              "\x8b\x1e\x18\x00\x06\x0c\x00\x9d\xcf\x1c\x38\x70"
+                                                              "\xe1\xc3\x00\x00\xc1\x80\xc3\x87\x8d\x1b\x32\x64"
+                                                              "\xcd\x8b\x1e\x18\x00\x1f\x80\x9d\xcf\x1c\x38\x70"
+                                                              "\xe1\xc3\x00\x03\xf0\xc3\x87\x8d\x1b\x32\x64\xcd"
+                                                              "\x8b\x1e\x18\x03\x0d\x21\x00\x9d\xcf\x1c\x38\x70"
+                                                              "\xe1\xc3\x00\x61\xa4\x20\x10\x70\x00\x0f\xd0\xe0"
+                                                              "\xc1\x87\x1b\xc4\xc8\xd0\xe0\x80\x18\x18\x00\x00"
+                                                              "\xe7\x2e\x28\x30\x20\x20\x20\xfc\xfd\x0e\x0c\x18"
+                                                              "\x71\xbc\x4c\x8d\x0e\x08\x00\x06\x0c\x00\xe7\x2e"
+                                                              "\x28\x30\x20\x20\x20\xfc\x00\x00\x30\x30\x7c\x00"
+                                                              "\x07\xe8\x70\x60\xc3\x8d\xe2\x64\x68\x70\x40\x00"
+                                                              "\x30\x60\x7e\x00\x00\xe7\x2e\x28\x30\x20\x20\x20"
+                                                              "\xfc\x00\x00\x30\x30\xfd\x0e\x0c\x18\x71\xbc\x4c"
+                                                              "\x8d\x0e\x08\x00\x0f\x80\xe7\x2e\x28\x30\x20\x20"
+                                                              "\x20\xfc\x00\x00\xfc\x3f\x63\x40\x40\x70\x1e\x03"
+                                                              "\x01\x01\xc3\x7e\x00\x00\x18\x18\x7f\x82\x07\x81"
+                                                              "\xe0\xc1\xfe\x00\x00\xc1\x80\xff\x8c\x06\x03\x01"
+                                                              "\x80\xc0\x60\x30\x18\x0c\x06\x00\x00\x00\xc0\x60"
+                                                              "\x10\x10\x10\xff\x10\x10\x10\x10\x10\x18\x0f\x00"
+                                                              "\x00\x0c\x0c\xff\x8c\x06\x03\x01\x80\xc0\x60\x30"
+                                                              "\x18\x0c\x06\x00\x00\x03\xf0\x10\x10\x10\xff\x10"
+                                                              "\x10\x10\x10\x10\x18\x0f\x00\x00\x3e\xff\x8c\x06"
+                                                              "\x03\x01\x80\xc0\x60\x30\x18\x0c\x06\x00\x01\x81"
+                                                              "\xa1\x08\x10\x10\x10\xff\x10\x10\x10\x10\x10\x18"
+                                                              "\x0f\x00\x0c\x16\x23\x81\xe0\x90\xc8\x66\x21\x10"
+                                                              "\x98\x68\x14\x0e\x06\x00\x00\x00\xc0\x60\xc1\x43"
+                                                              "\x62\x62\x26\x34\x1c\x18\x00\x00\x18\x18\x60\x0c"
+                                                              "\x00\x00\x08\x1c\x0b\x25\x92\xd9\x2c\x95\xca\xe6"
+                                                              "\x63\x31\x88\x20\x0c\x00\x00\x08\x1c\x4b\x25\xb2"
+                                                              "\x5f\x2b\x99\x8c\xc0\x06\x06\x04\x00\x08\x1c\x0b"
+                                                              "\x25\x92\xd9\x2c\x95\xca\xe6\x63\x31\x88\x06\x04"
+                                                              "\x04\x00\x08\x1c\x4b\x25\xb2\x5f\x2b\x99\x8c\xc0"
+                                                              "\x62\x33\x00\x00\x08\x1c\x0b\x25\x92\xd9\x2c\x95"
+                                                              "\xca\xe6\x63\x31\x88\x22\x33\x00\x00\x08\x1c\x4b"
+                                                              "\x25\xb2\x5f\x2b\x99\x8c\xc0\x62\x66\x00\x00\xc3"
+                                                              "\x62\x26\x34\x18\x18\x1c\x34\x66\x43\xc1\x22\x66"
+                                                              "\x00\x00\x43\x66\x34\x18\x1c\x34\x66\xc3\x08\x18"
+                                                              "\x00\x00\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18"
+                                                              "\x18\x08\x18\x00\x00\xc1\x43\x62\x62\x26\x34\x1c"
+                                                              "\x18\x18\x18\x30\xe0\x1c\x26\x40\x00\xff\x03\x06"
+                                                              "\x04\x0c\x18\x10\x30\x60\x40\xff\x1c\x26\x00\x00"
+                                                              "\x7f\x02\x06\x0c\x18\x30\x60\xff\xff\x03\x06\x04"
+                                                              "\x0c\x18\x10\x30\x60\x40\xff\x00\x00\x18\x18\x7f"
+                                                              "\x02\x06\x0c\x18\x30\x60\xff\x00\x00\x18\x18\xff"
+                                                              "\x03\x06\x04\x0c\x18\x10\x30\x60\x40\xff\x00\x00"
+                                                              "\x7e\x7f\x02\x06\x0c\x18\x30\x60\xff\x00\x00\x3e"
+                                                              "\x81\x02\x04\x09\xdc\xf1\xc3\x87\x0e\x1c\x30\x00"
+                                                              "\x3f\x00\x3c\x31\x90\xc8\x4c\x46\x23\x0d\x82\xc1"
+                                                              "\xe0\xf3\xc0\x18\x0e\x0f\x06\x82\x63\x31\x88\xfe"
+                                                              "\x43\x60\xa0\x60\x00\x00\xc0\x60\x7c\x03\x00\x87"
+                                                              "\xcc\x26\x13\x38\xf7\x00\x00\x06\x03\x00\x1c\x02"
+                                                              "\x06\x00\x01\x80\xe0\xf0\x68\x26\x33\x18\x8f\xe4"
+                                                              "\x36\x0a\x06\x38\x02\x03\x02\x00\x03\xe0\x18\x04"
+                                                              "\x3e\x61\x30\x99\xc7\xb8\x01\x81\x06\x04\xc4\x20"
+                                                              "\x00\x60\x38\x3c\x1a\x09\x8c\xc6\x23\xf9\x0d\x82"
+                                                              "\x81\x80\x01\x81\x80\x83\x02\x62\x10\x00\xf8\x06"
+                                                              "\x01\x0f\x98\x4c\x26\x71\xee\x04\x01\x80\x43\x02"
+                                                              "\x62\x10\x00\x30\x1c\x1e\x0d\x04\xc6\x63\x11\xfc"
+                                                              "\x86\xc1\x40\xc0\x04\x01\x00\x43\x02\x62\x10\x00"
+                                                              "\xf8\x06\x01\x0f\x98\x4c\x26\x71\xee\x07\x80\x40"
+                                                              "\xc3\x02\x62\x10\x00\x30\x1c\x1e\x0d\x04\xc6\x63"
+                                                              "\x11\xfc\x86\xc1\x40\xc0\x07\x80\x40\xc3\x02\x62"
+                                                              "\x10\x00\xf8\x06\x01\x0f\x98\x4c\x26\x71\xee\x32"
+                                                              "\x15\x01\x00\x01\x81\x31\x08\x00\x18\x0e\x0f\x06"
+                                                              "\x82\x63\x31\x88\xfe\x43\x60\xa0\x60\x32\x35\x11"
+                                                              "\x03\x02\x62\x10\x00\xf8\x06\x01\x0f\x98\x4c\x26"
+                                                              "\x71\xee\x18\x13\x10\x80\x01\x80\xe0\xf0\x68\x26"
+                                                              "\x33\x18\x8f\xe4\x36\x0a\x06\x00\x00\x0c\x06\x00"
+                                                              "\x18\x13\x10\x80\x07\xc0\x30\x08\x7c\xc2\x61\x33"
+                                                              "\x8f\x70\x00\x00\x60\x30\x02\x06\x04\x08\x42\x60"
+                                                              "\xe0\x00\x30\x1c\x1e\x0d\x04\xc6\x63\x11\xfc\x86"
+                                                              "\xc1\x40\xc0\x02\x06\x04\x08\x42\x60\xe0\x00\xf8"
+                                                              "\x06\x01\x0f\x98\x4c\x26\x71\xee\x60\x1c\x02\x08"
+                                                              "\x42\x60\xe0\x00\x30\x1c\x1e\x0d\x04\xc6\x63\x11"
+                                                              "\xfc\x86\xc1\x40\xc0\x60\x1c\x02\x08\x42\x60\xe0"
+                                                              "\x00\xf8\x06\x01\x0f\x98\x4c\x26\x71\xee\x3c\x02"
+                                                              "\x06\x08\x42\x60\xe0\x00\x30\x1c\x1e\x0d\x04\xc6"
+                                                              "\x63\x11\xfc\x86\xc1\x40\xc0\x1c\x02\x06\x08\x42"
+                                                              "\x60\xe0\x00\xf8\x06\x01\x0f\x98\x4c\x26\x71\xee"
+                                                              "\x32\x25\x11\x00\x04\x21\x30\x70\x00\x18\x0e\x0f"
+                                                              "\x06\x82\x63\x31\x88\xfe\x43\x60\xa0\x60\x32\x25"
+                                                              "\x11\x00\x04\x21\x30\x70\x00\x7c\x03\x00\x87\xcc"
+                                                              "\x26\x13\x38\xf7\x42\x13\x07\x00\x01\x80\xe0\xf0"
+                                                              "\x68\x26\x33\x18\x8f\xe4\x36\x0a\x06\x00\x00\x0c"
+                                                              "\x06\x00\x42\x13\x07\x00\x07\xc0\x30\x08\x7c\xc2"
+                                                              "\x61\x33\x8f\x70\x00\x00\x60\x30\xff\x02\x04\x08"
+                                                              "\x1f\xa0\x40\x81\x03\xf8\x00\x03\x06\x00\x3e\x63"
+                                                              "\x41\xff\xc0\xc0\x60\x3e\x00\x00\x08\x18\x3c\x18"
+                                                              "\xc0\x0f\xf0\x20\x40\x81\xfa\x04\x08\x10\x3f\x80"
+                                                              "\x3c\x04\x0c\x10\x00\x3e\x63\x41\xff\xc0\xc0\x60"
+                                                              "\x3e\x62\xba\x30\x0f\xf0\x20\x40\x81\xfa\x04\x08"
+                                                              "\x10\x3f\x80\x31\x4e\x44\x00\x3e\x63\x41\xff\xc0"
+                                                              "\xc0\x60\x3e\x03\x00\x38\x6c\x00\x00\xfe\x80\x80"
+                                                              "\x80\x80\xfc\x80\x80\x80\x80\xfe\x00\x80\xc0\x83"
+                                                              "\x03\x63\x10\x00\x7c\x63\x20\xbf\xd8\x0c\x03\x00"
+                                                              "\xf8\x0c\x0c\x01\xc6\xc0\x00\x7f\x81\x02\x04\x0f"
+                                                              "\xd0\x20\x40\x81\xfc\x04\x02\x01\x18\x36\x62\x00"
+                                                              "\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x0f\x01\x06\x38"
+                                                              "\x6c\x00\x00\xfe\x80\x80\x80\x80\xfc\x80\x80\x80"
+                                                              "\x80\xfe\x03\x80\x40\xc3\x03\x63\x10\x00\x7c\x63"
+                                                              "\x20\xbf\xd8\x0c\x03\x00\xf8\x32\xbd\x10\x03\x8d"
+                                                              "\x80\x00\xff\x02\x04\x08\x1f\xa0\x40\x81\x03\xf8"
+                                                              "\x31\x2a\x46\x18\x36\x62\x00\x3e\x63\x41\xff\xc0"
+                                                              "\xc0\x60\x3e\x38\xd8\x00\x0f\xf0\x20\x40\x81\xfa"
+                                                              "\x04\x08\x10\x3f\x80\x00\x30\x60\x18\x34\x62\x00"
+                                                              "\x3e\x63\x41\xff\xc0\xc0\x60\x3e\x00\x00\x08\x18"
+                                                              "\x38\x33\x00\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0"
+                                                              "\x78\x10\x61\x00\x1e\x04\x08\x10\x20\x40\x8f\xe0"
+                                                              "\xfc\xc3\x0c\x30\xc3\x0c\x30\xcf\xc0\x00\xc3\x00"
+                                                              "\x30\x60\x00\x0f\x02\x04\x08\x10\x20\x47\xf0\x00"
+                                                              "\x04\x08\x3c\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66"
+                                                              "\x3c\x00\x00\x18\x18\x3c\x63\xc1\xc1\xc1\xc1\x63"
+                                                              "\x3c\x00\x00\x18\x18\x1c\x06\x18\x00\x3c\x66\xc3"
+                                                              "\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x38\x04\x0c\x10"
+                                                              "\x00\x3c\x63\xc1\xc1\xc1\xc1\x63\x3c\x01\x81\x06"
+                                                              "\x06\x84\x20\x00\xf0\xcc\xc3\x60\xb0\x50\x2c\x16"
+                                                              "\x0b\x0c\xcc\x3c\x00\x00\x80\x80\x83\x03\x42\x10"
+                                                              "\x00\x78\x63\x60\xb0\x58\x2c\x13\x18\xf0\x04\x07"
+                                                              "\x01\x18\x34\x42\x00\x3c\x66\xc3\xc1\xc1\x81\xc1"
+                                                              "\xc1\xc3\x66\x3c\x04\x06\x01\x18\x34\x42\x00\x3c"
+                                                              "\x63\xc1\xc1\xc1\xc1\x63\x3c\x07\x00\x40\xc3\x03"
+                                                              "\x42\x10\x00\x78\x66\x61\xb0\x58\x28\x16\x0b\x05"
+                                                              "\x86\x66\x1e\x00\x03\x00\x40\xc3\x03\x42\x10\x00"
+                                                              "\x78\x63\x60\xb0\x58\x2c\x13\x18\xf0\x31\x2a\x46"
+                                                              "\x00\x18\x34\x42\x00\x3c\x66\xc3\xc1\xc1\x81\xc1"
+                                                              "\xc1\xc3\x66\x3c\x32\x2a\x44\x18\x34\x42\x00\x3c"
+                                                              "\x63\xc1\xc1\xc1\xc1\x63\x3c\x18\x34\x42\x00\x3c"
+                                                              "\x66\xc3\xc1\xc1\x81\xc1\xc1\xc3\x66\x3c\x00\x00"
+                                                              "\x18\x18\x18\x34\x42\x00\x3c\x63\xc1\xc1\xc1\xc1"
+                                                              "\x63\x3c\x00\x00\x18\x18\x06\x0c\x00\x20\x13\xfb"
+                                                              "\x33\x0d\x82\xc1\x40\xb0\x58\x2c\x33\x30\xf0\x06"
+                                                              "\x0c\x00\x20\x33\xf3\x13\x05\x82\xc1\x60\x98\xc7"
+                                                              "\x80\x70\x0c\x00\x20\x13\xfb\x33\x0d\x82\xc1\x40"
+                                                              "\xb0\x58\x2c\x33\x30\xf0\x30\x0c\x00\x20\x33\xf3"
+                                                              "\x13\x05\x82\xc1\x60\x98\xc7\x80\x10\x06\x03\x02"
+                                                              "\x10\x09\xfd\x99\x86\xc1\x60\xa0\x58\x2c\x16\x19"
+                                                              "\x98\x78\x1c\x02\x07\x00\x10\x19\xf9\x89\x82\xc1"
+                                                              "\x60\xb0\x4c\x63\xc0\x32\x27\x00\x20\x13\xfb\x33"
+                                                              "\x0d\x82\xc1\x40\xb0\x58\x2c\x33\x30\xf0\x32\x27"
+                                                              "\x00\x20\x33\xf3\x13\x05\x82\xc1\x60\x98\xc7\x80"
+                                                              "\x00\x80\x4f\xec\xcc\x36\x0b\x05\x02\xc1\x60\xb0"
+                                                              "\xcc\xc3\xc0\x00\x00\x30\x18\x00\x00\x80\xcf\xcc"
+                                                              "\x4c\x16\x0b\x05\x82\x63\x1e\x00\x00\x01\x80\xc0"
+                                                              "\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc1\xc3\x67\x3c\x00"
+                                                              "\x00\x18\x18\x87\x0e\x1c\x38\x70\xf7\xfb\x00\x00"
+                                                              "\xc1\x80\x1c\x06\x18\x00\xc1\xc1\xc1\xc1\xc1\xc1"
+                                                              "\xc1\xc1\xc3\x67\x3c\x70\x10\x61\x00\x10\xe1\xc3"
+                                                              "\x87\x0e\x1e\xff\x60\x06\x03\x01\x04\x01\xc1\xf0"
+                                                              "\x4c\x13\x04\xc1\x30\x4c\x13\x04\xc3\x19\xc3\xc0"
+                                                              "\x0c\x0c\x08\x60\x38\x74\x32\x19\x0c\x86\x43\x37"
+                                                              "\x9e\xc0\x60\x06\x00\x04\x01\xc1\xf0\x4c\x13\x04"
+                                                              "\xc1\x30\x4c\x13\x04\xc3\x19\xc3\xc0\x40\x18\x00"
+                                                              "\x60\x38\x74\x32\x19\x0c\x86\x43\x37\x9e\xc0\x1c"
+                                                              "\x01\x81\x84\x01\xc1\xf0\x4c\x13\x04\xc1\x30\x4c"
+                                                              "\x13\x04\xc3\x19\xc3\xc0\x70\x04\x06\x04\x30\x1c"
+                                                              "\x3a\x19\x0c\x86\x43\x21\x9b\xcf\x60\x32\x12\x84"
+                                                              "\x44\x01\xc1\xf0\x4c\x13\x04\xc1\x30\x4c\x13\x04"
+                                                              "\xc3\x19\xc3\xc0\x66\x4a\x22\x60\x38\x74\x32\x19"
+                                                              "\x0c\x86\x43\x37\x9e\xc0\x00\x40\x1c\x1f\x04\xc1"
+                                                              "\x30\x4c\x13\x04\xc1\x30\x4c\x31\x9c\x3c\x00\x00"
+                                                              "\x00\x60\x18\x00\x01\x80\xe1\xd0\xc8\x64\x32\x19"
+                                                              "\x0c\xde\x7b\x00\x00\x03\x01\x80\x60\x18\x00\x00"
+                                                              "\xc1\x43\x62\x26\x3c\x18\x18\x18\x18\x18\x18\x20"
+                                                              "\x18\x00\x00\xc1\x43\x62\x62\x26\x34\x1c\x18\x18"
+                                                              "\x18\x30\xe0\xc1\x43\x62\x26\x3c\x18\x18\x18\x18"
+                                                              "\x18\x18\x00\x00\x18\x18\xc1\x43\x62\x62\x26\x34"
+                                                              "\x1c\x18\x18\x18\x33\xe3\x1c\x06\x18\x00\xc1\x43"
+                                                              "\x62\x26\x3c\x18\x18\x18\x18\x18\x18\x38\x04\x0c"
+                                                              "\x10\x00\xc1\x43\x62\x62\x26\x34\x1c\x18\x18\x18"
+                                                              "\x30\xe0\x32\x4a\x44\x00\xc1\x43\x62\x26\x3c\x18"
+                                                              "\x18\x18\x18\x18\x18\x33\x4a\x44\x00\xc1\x43\x62"
+                                                              "\x62\x26\x34\x1c\x18\x18\x18\x30\xe0\xfc\xff\xff"
+                                                              "\x80\xff\x80\x13\x66\xe0\x33\x66\xc0\x33\x66\xc0"
+                                                              "\x31\x23\x66\x66\xc6\x33\x33\x63\x66\xcc\x33\x33"
+                                                              "\x63\x66\xcc\x18\x18\x08\x08\xff\x08\x08\x08\x08"
+                                                              "\x18\x18\x18\x18\x08\x08\xff\x08\x08\x08\x08\x7f"
+                                                              "\x08\x08\x18\xf7\xfc\xe0\x43\xe3\x63\x89\x6c\xf6"
+                                                              "\x60\x09\x99\x8c\x30\xc1\x86\x1c\x31\xbb\x10\x00"
+                                                              "\x40\x20\x10\x08\x06\x01\x00\x80\x40\x20\x18\x0c"
+                                                              "\x00\x74\xef\x99\xb8\x32\xa5\xf1\x08\xf4\x3c\x11"
+                                                              "\xf0\x22\x3d\x19\xb8\xf8\x84\x46\x20\xf4\xfd\x28"
+                                                              "\xf8\x74\xe3\xe3\x30\x74\xef\x99\xb8\x67\x08\x42"
+                                                              "\x7c\x74\xc4\x44\x7c\xf1\x18\x31\xf8\x32\xa5\xf1"
+                                                              "\x08\xf4\x3c\x11\xf0\x22\x3d\x19\xb8\xf8\x84\x46"
+                                                              "\x20\xf4\xfd\x28\xf8\x74\xe3\xe3\x30\x31\x8e\x62"
+                                                              "\x9b\xbf\x2d\x89\x6f\xdc\x9e\x23\x88\xe2\x38\x40"
+                                                              "\x90\x24\x09\x32\x2c\xbe\xf2\xa8\xaa\x32\x8c\xa3"
+                                                              "\x10\x03\x01\x87\xe0\x63\xf3\x3b\x0d\x86\xc3\x33"
+                                                              "\x8e\xc0\x0f\xf0\x1f\x18\x98\x1f\x86\x03\x03\xf0"
+                                                              "\xc0\x20\x18\xc7\xc0\x3e\x08\xc2\x1b\xff\x21\x88"
+                                                              "\xc3\xe0\x80\x20\x08\x02\x00\xff\x06\x06\xff\x06"
+                                                              "\x04\xf8\x60\x38\x0c\x06\x30\x0c\x03\x60\xe0\x72"
+                                                              "\x2f\x03\x0d\xc3\xb1\x8c\xc3\xe0\x7f\x30\xd8\x6c"
+                                                              "\x16\x1f\xf9\x80\xc0\xfe\x30\x18\x00\x3c\x42\x81"
+                                                              "\x9d\x95\x95\x95\x9d\x91\x91\x81\x42\x3c\xed\x46"
+                                                              "\x9a\xa5\x1e\x88\xfd\x26\x92\xa9\x14\x88\x20\x38"
+                                                              "\x02\x00\x81\x20\xfe\x40\x20\x10\x18\x09\xf4\x0a"
+                                                              "\x06\x00\x40\x10\x38\x78\x22\x00\x80\xc1\x60\xfe"
+                                                              "\x40\x20\x10\x18\x09\xf4\x0a\x06\x00\x40\x10\x38"
+                                                              "\x20\x38\x02\x00\x81\x20\xfe\x40\x20\x10\x18\x08"
+                                                              "\xf4\x42\x1e\x00\x40\x30\x78\x78\x22\x00\x80\xc1"
+                                                              "\x60\xfe\x40\x20\x10\x18\x08\xf4\x42\x1e\x00\x40"
+                                                              "\x30\x78\xf8\x04\x03\x00\x21\x08\xdc\x40\x20\x10"
+                                                              "\x18\x08\xf4\x42\x1e\x00\x40\x30\x78\x10\x0c\x05"
+                                                              "\x03\xf1\x10\xc4\x40\x20\x10\x18\x08\xf4\x42\x1e"
+                                                              "\x00\x40\x30\x78\x20\x38\x02\x00\x81\x20\xfe\x40"
+                                                              "\x20\x10\x18\x08\x44\x22\x1e\x0c\x81\x20\x78\x78"
+                                                              "\x10\x07\x80\x21\x08\xfc\x40\x20\x10\x18\x08\x44"
+                                                              "\x22\x1e\x0c\x81\x20\x78\x20\x38\x02\x00\x81\x20"
+                                                              "\xfe\x40\x20\x10\x18\x08\xe4\x46\x0e\x04\xc1\x10"
+                                                              "\x78\xf8\x04\x03\x00\x21\x08\xdc\x40\x20\x10\x18"
+                                                              "\x08\xe4\x46\x0e\x04\xc1\x10\x78\x78\x10\x07\x80"
+                                                              "\x21\x08\xfc\x40\x20\x10\x18\x08\xe4\x46\x0e\x04"
+                                                              "\xc1\x10\x78\x7c\x02\x00\x80\x41\x30\xc8\x40\x20"
+                                                              "\x10\x18\x08\xe4\x46\x0e\x04\xc1\x10\x78\xff\x61"
+                                                              "\xac\xa3\x50\xc0\x03\x0d\x65\x1a\x86\x00\x04\x08"
+                                                              "\x27\xf1\x04\x3f\xa0\x41\x80\x01\x06\x38\xe0\xe0"
+                                                              "\x38\x06\x01\x00\x00\xff\x81\xc0\xe0\x70\xe7\x38"
+                                                              "\x40\x00\x03\xf8\x31\xa8\x40";
+
+constexpr Font intel_one_mono_12_pt = {
+    .size = 12,
+    .numCharacters = 622,
+    .boundingBoxWidth = 15,
+    .boundingBoxHeight = 24,
+    .boundingBoxXOffset = -3,
+    .boundingBoxYOffset = -5,
+    .ascent = 18,
+    .descent = 4,
+    .asciiIndex = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                   28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+                   53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+                   78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95},
+    .characters = intel_one_mono_12_pt_characters,
+    .bitmaps = intel_one_mono_12_pt_bitmaps,
+};
 
 // intel_one_mono
 //   - (C) 2023 Intel Corporation"
 //   - Size: 16
 //   - Characters: 622
-uint8_t intel_one_mono_16_pt[19232] = "\x10\x02\x6e\x14\x20\xfc\xf9\x17\x06\x00\x00\x00\x1a\x09\x10\x08\x10\x00\x00\xff"
-                                      "\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\xff\x00\x20\x00\x0a\x0e"
-                                      "\x00\x00\x00\x00\x00\x00\x21\x00\x12\x0e\x00\x04\x10\x05\x00\xfe\xee\xe6\x66\x64"
-                                      "\x00\x0e\xee\x00\x22\x00\x11\x0e\x00\x08\x07\x03\x09\xc7\xc7\xc7\xc3\xc3\xc3\xc3"
-                                      "\x00\x23\x00\x21\x0e\x00\x0c\x0f\x01\x00\x0c\xc0\x8c\x08\xc0\x88\x7f\xf7\xff\x18"
-                                      "\x81\x18\x11\x01\x10\xff\xef\xfe\x33\x02\x20\x22\x00\x00\x24\x00\x25\x0e\x00\x0a"
-                                      "\x15\x02\xfd\x0c\x03\x00\xc0\xfe\x7f\xb3\x0c\xc3\x30\xec\x1f\x01\xf0\x2e\x09\xc2"
-                                      "\x30\x8c\x27\xff\x9f\xc0\xc0\x30\x0c\x00\x00\x25\x00\x21\x0e\x00\x0c\x0f\x01\x00"
-                                      "\x78\x34\xc6\xc4\x48\x4c\x84\x8c\x50\xcc\x07\x9c\x02\x61\x62\x16\x32\x63\x66\x24"
-                                      "\x26\xc1\xc0\x00\x26\x00\x21\x0e\x00\x0c\x0f\x01\x00\x0f\x81\xf8\x30\x03\x00\x18"
-                                      "\x01\x84\x0c\x63\xe4\x66\xcc\x38\xc1\x8c\x1c\xc3\xc7\xe6\x3c\x70\x00\x27\x00\x0d"
-                                      "\x0e\x00\x03\x07\x05\x09\xfd\xb6\xd8\x00\x28\x00\x1f\x0e\x00\x08\x15\x03\xfd\x01"
-                                      "\x07\x0e\x18\x30\x60\x60\xc0\xc0\xc0\x80\xc0\xc0\xc0\xe0\x60\x30\x18\x0e\x07\x01"
-                                      "\x00\x29\x00\x22\x0e\x00\x09\x15\x02\xfd\x40\x70\x0e\x03\x80\xe0\x30\x0c\x06\x01"
-                                      "\x80\xc0\x60\x30\x18\x18\x0c\x0c\x0e\x0e\x0e\x1c\x04\x00\x00\x2A\x00\x18\x0e\x00"
-                                      "\x0b\x0a\x01\x04\x06\x00\xc0\x18\x32\x7f\xfe\x08\x02\xc0\xcc\x71\xc4\x10\x00\x2B"
-                                      "\x00\x18\x0e\x00\x0a\x0b\x02\x01\x0c\x03\x00\xc0\x30\xff\xff\xf0\xc0\x30\x0c\x03"
-                                      "\x00\xc0\x00\x2C\x00\x0f\x0e\x00\x06\x06\x03\xfd\x1c\xe3\x8c\x73\x80\x00\x2D\x00"
-                                      "\x0c\x0e\x00\x08\x02\x03\x05\xff\xff\x00\x2E\x00\x0c\x0e\x00\x04\x04\x05\x00\x4f"
-                                      "\xfe\x00\x2F\x00\x25\x0e\x00\x0b\x13\x01\xfe\x00\x60\x0c\x03\x00\x60\x18\x03\x00"
-                                      "\xc0\x18\x06\x00\xc0\x30\x06\x01\x80\x30\x0c\x01\x80\x60\x0c\x03\x00\x00\x00\x30"
-                                      "\x00\x1f\x0e\x00\x0b\x0f\x01\x00\x0f\x07\xf0\xc3\x30\x26\x06\x83\xd0\xde\x33\xdc"
-                                      "\x6e\x0d\x81\xb0\x27\x0c\x7f\x07\xc0\x00\x31\x00\x1d\x0e\x00\x0a\x0f\x02\x00\x04"
-                                      "\x07\x07\xc3\xb0\x8c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x1f\xf7\xfc\x00\x32"
-                                      "\x00\x1d\x0e\x00\x0a\x0f\x02\x00\x1f\x1f\xee\x1a\x03\x00\xc0\x60\x18\x0c\x06\x03"
-                                      "\x01\x80\xc0\x60\x3f\xff\xfc\x00\x33\x00\x1d\x0e\x00\x0a\x0f\x02\x00\xff\xbf\xe0"
-                                      "\x30\x18\x0c\x07\x01\x80\xfc\x01\x80\x30\x0c\x07\x03\xbf\xcf\x80\x00\x34\x00\x21"
-                                      "\x0e\x00\x0c\x0f\x01\x00\x03\x80\x78\x07\x80\xd8\x19\x81\x98\x31\x82\x18\x61\x8c"
-                                      "\x1f\xff\xf0\x18\x01\x80\x18\x01\x80\x00\x35\x00\x1d\x0e\x00\x0a\x0f\x02\x00\x7f"
-                                      "\x9f\xe4\x01\x00\x40\x37\xcf\xfb\x06\x00\xc0\x30\x0c\x06\x03\x9f\xcf\xc0\x00\x36"
-                                      "\x00\x1d\x0e\x00\x0a\x0f\x02\x00\x07\x03\x81\x80\xc0\x60\x1f\x8f\x7b\x06\xc0\xf0"
-                                      "\x3c\x0f\x03\xe1\x9f\xc3\xe0\x00\x37\x00\x1f\x0e\x00\x0b\x0f\x01\x00\xff\xff\xfc"
-                                      "\x03\x00\x60\x18\x03\x00\xc0\x18\x07\x00\xc0\x18\x06\x00\xc0\x30\x06\x00\x00\x38"
-                                      "\x00\x1d\x0e\x00\x0a\x0f\x02\x00\x3e\x1f\xec\x1b\x06\xc1\x90\x67\x70\xf8\x61\xb0"
-                                      "\x3c\x0f\x03\xc1\xdf\xe3\xe0\x00\x39\x00\x1d\x0e\x00\x0a\x0f\x02\x00\x3e\x1f\xce"
-                                      "\x1b\x03\xc0\xf0\x3c\x0f\x03\x73\x8f\xe0\x30\x18\x0e\x07\x03\x80\x00\x3A\x00\x0f"
-                                      "\x0e\x00\x04\x0a\x05\x00\xef\xf0\x00\x0f\xfe\x00\x3B\x00\x14\x0e\x00\x06\x0d\x03"
-                                      "\xfd\x18\xf3\xc0\x00\x00\x0e\x38\xe3\x18\xc0\x00\x3C\x00\x1a\x0e\x00\x0b\x0b\x01"
-                                      "\x02\x00\x20\x3c\x1e\x0f\x07\x01\x80\x1e\x00\xf0\x07\x80\x3c\x00\x80\x00\x3D\x00"
-                                      "\x12\x0e\x00\x09\x07\x02\x04\xff\xff\xc0\x00\x00\x07\xff\xfe\x00\x3E\x00\x18\x0e"
-                                      "\x00\x0a\x0b\x02\x02\x80\x38\x07\x80\x3c\x03\xc0\x30\x3c\x3c\x78\x38\x08\x00\x00"
-                                      "\x3F\x00\x1e\x0e\x00\x0a\x10\x02\x00\x3f\x3f\xe8\x0c\x03\x00\xc0\xe0\xf0\x70\x10"
-                                      "\x04\x00\x00\x00\x00\x0e\x03\x80\xe0\x00\x40\x00\x23\x0e\x00\x0b\x12\x01\xfe\x0f"
-                                      "\x86\x18\x81\xa0\x14\x02\x8f\xf3\x0c\x61\x88\x31\x06\x20\xe6\x34\x7c\x80\x10\x01"
-                                      "\x00\x30\x01\xf8\x00\x41\x00\x1f\x0e\x00\x0b\x0f\x01\x00\x0e\x01\xc0\x3c\x0d\x81"
-                                      "\xb0\x33\x04\x61\x8c\x30\xc7\xf9\xff\x30\x36\x07\x80\xf0\x18\x00\x42\x00\x1d\x0e"
-                                      "\x00\x0a\x0f\x02\x00\xff\x31\xec\x1f\x03\xc0\xf0\x6c\x73\xf8\xc1\xb0\x3c\x0f\x03"
-                                      "\xc0\xf0\xff\xf0\x00\x43\x00\x1f\x0e\x00\x0b\x0f\x01\x00\x0f\x83\xfc\xc1\xb0\x06"
-                                      "\x01\x80\x30\x06\x00\xc0\x18\x01\x80\x30\x07\x06\x7f\xc3\xe0\x00\x44\x00\x1d\x0e"
-                                      "\x00\x0a\x0f\x02\x00\xfc\x3f\xcc\x3b\x07\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x06"
-                                      "\xc3\xbf\x8f\x80\x00\x45\x00\x1d\x0e\x00\x0a\x0f\x02\x00\xff\xff\xfc\x03\x00\xc0"
-                                      "\x30\x0f\xfb\xfe\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x00\x46\x00\x1d\x0e\x00\x0a"
-                                      "\x0f\x02\x00\xff\xff\xfc\x03\x00\xc0\x30\x0c\x03\xfe\xff\xb0\x0c\x03\x00\xc0\x30"
-                                      "\x0c\x00\x00\x47\x00\x1f\x0e\x00\x0b\x0f\x01\x00\x07\xc3\xf8\xc0\x30\x06\x01\x80"
-                                      "\x30\x06\x1f\xc3\xf8\x0d\x81\xb0\x37\x06\x7f\xc3\xf8\x00\x48\x00\x1b\x0e\x00\x09"
-                                      "\x0f\x02\x00\xc0\xe0\x70\x38\x1c\x0e\x07\xff\xff\xc0\xe0\x70\x38\x1c\x0e\x07\x02"
-                                      "\x00\x49\x00\x19\x0e\x00\x08\x0f\x03\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18"
-                                      "\x18\x18\x18\x18\xff\x00\x4A\x00\x1d\x0e\x00\x0a\x0f\x01\x00\x00\xc0\x30\x0c\x03"
-                                      "\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0f\x03\x70\xcf\xf0\xf0\x00\x4B\x00\x1f\x0e\x00"
-                                      "\x0b\x0f\x02\x00\xc0\xd8\x33\x0e\x63\x8c\xe1\x98\x36\x07\x80\xd8\x19\x83\x18\x63"
-                                      "\x8c\x39\x83\xb0\x38\x00\x4C\x00\x1d\x0e\x00\x0a\x0f\x02\x00\xc0\x30\x0c\x03\x00"
-                                      "\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x00\x4D\x00\x1f\x0e\x00"
-                                      "\x0b\x0f\x01\x00\x60\xee\x1d\xc3\xb8\xf5\x96\x92\xd2\xda\x73\x46\x68\x8d\x11\xe0"
-                                      "\x3c\x07\x80\xf0\x18\x00\x4E\x00\x1d\x0e\x00\x0a\x0f\x02\x00\xe0\xf8\x3f\x0f\xc3"
-                                      "\xd0\xf6\x3d\x8f\x33\xcc\xf1\xbc\x6f\x0f\xc3\xf0\x7c\x1c\x00\x4F\x00\x1f\x0e\x00"
-                                      "\x0b\x0f\x01\x00\x1f\x07\xf1\xc3\x30\x36\x07\x80\xf0\x1e\x03\xc0\x78\x0d\x81\xb0"
-                                      "\x37\x0c\x7f\x07\xc0\x00\x50\x00\x1f\x0e\x00\x0b\x0f\x02\x00\xff\x1f\xf3\x03\x60"
-                                      "\x6c\x07\x80\xb0\x36\x06\xff\x9f\xe3\x00\x60\x0c\x01\x80\x30\x00\x00\x51\x00\x25"
-                                      "\x0e\x00\x0c\x12\x01\xfd\x1f\x03\xf8\x70\xc6\x06\x60\x6c\x06\xc0\x6c\x06\xc0\x6c"
-                                      "\x26\x66\x66\x36\x71\xc3\xf8\x1f\xc0\x06\x00\x30\x03\x00\x52\x00\x1d\x0e\x00\x0a"
-                                      "\x0f\x02\x00\xff\x3f\xec\x1f\x03\xc0\xf0\x3c\x1b\x7c\xf8\x33\x0c\x63\x0c\xc3\xb0"
-                                      "\x7c\x0c\x00\x53\x00\x1d\x0e\x00\x0a\x0f\x02\x00\x3f\x9f\xec\x03\x00\xc0\x38\x07"
-                                      "\x80\x7c\x03\x80\x70\x0c\x03\x81\xff\xe7\xf0\x00\x54\x00\x1f\x0e\x00\x0b\x0f\x01"
-                                      "\x00\xff\xff\xfc\x18\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c"
-                                      "\x01\x80\x00\x55\x00\x1d\x0e\x00\x0a\x0f\x02\x00\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c"
-                                      "\x0f\x03\xc0\xf0\x3c\x0f\x03\xe1\x9f\xe3\xe0\x00\x56\x00\x1f\x0e\x00\x0b\x0f\x01"
-                                      "\x00\xc0\x38\x0d\x81\xb0\x36\x0c\x61\x8c\x31\x8c\x11\x83\x30\x64\x05\x80\xf0\x1c"
-                                      "\x03\x80\x00\x57\x00\x1f\x0e\x00\x0b\x0f\x01\x00\xc0\x38\x07\x01\xe2\x34\x46\x8c"
-                                      "\xd9\x9b\x73\x6a\x4d\x69\xa5\x1c\xe3\x1c\x63\x8c\x70\x00\x58\x00\x1f\x0e\x00\x0b"
-                                      "\x0f\x01\x00\x60\x6c\x18\xc3\x18\xc1\xb0\x1e\x03\x80\x30\x0f\x03\x60\x66\x18\xc3"
-                                      "\x0c\xc1\xf0\x18\x00\x59\x00\x1f\x0e\x00\x0b\x0f\x01\x00\xc0\x6c\x0d\x83\x18\x63"
-                                      "\x98\x36\x03\xc0\x70\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x00\x5A\x00\x1f\x0e"
-                                      "\x00\x0b\x0f\x01\x00\x7f\xef\xfc\x03\x00\xc0\x38\x06\x01\x80\x70\x0c\x03\x00\x60"
-                                      "\x18\x06\x00\xff\xff\xf8\x00\x5B\x00\x1e\x0e\x00\x08\x14\x04\xfd\xff\xff\xc0\xc0"
-                                      "\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xff\xff\x00\x5C\x00\x25"
-                                      "\x0e\x00\x0b\x13\x01\xfe\xc0\x0c\x01\x80\x18\x03\x00\x30\x06\x00\x60\x0c\x00\xc0"
-                                      "\x18\x01\x80\x30\x03\x00\x60\x06\x00\xc0\x0c\x01\x80\x00\x5D\x00\x1c\x0e\x00\x07"
-                                      "\x14\x02\xfd\xff\xfc\x18\x30\x60\xc1\x83\x06\x0c\x18\x30\x60\xc1\x83\x06\x0f\xff"
-                                      "\xf0\x00\x5E\x00\x15\x0e\x00\x0b\x08\x01\x07\x0e\x01\xe0\x6c\x0c\xc3\x18\x41\x98"
-                                      "\x1e\x03\x00\x5F\x00\x0d\x0e\x00\x0a\x02\x02\xfd\xff\xff\xf0\x00\x60\x00\x0c\x0e"
-                                      "\x00\x04\x04\x04\x0c\x8c\x71\x00\x61\x00\x19\x0e\x00\x0c\x0a\x01\x00\x7f\x03\xf8"
-                                      "\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f\xe3\xc7\x00\x62\x00\x1e\x0e\x00\x0a\x10"
-                                      "\x02\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c\xf3\xfe\xe1\xf0\x3c\x0f\x03\xc0\xf0\x7f"
-                                      "\xfa\xf8\x00\x63\x00\x17\x0e\x00\x0a\x0a\x02\x00\x1f\x1f\xfe\x0b\x00\xc0\x30\x0c"
-                                      "\x03\x82\x7f\xcf\xc0\x00\x64\x00\x1e\x0e\x00\x0a\x10\x01\x00\x00\x40\x10\x04\x01"
-                                      "\x00\x40\x11\xf4\xff\x60\xd8\x1c\x07\x01\xc0\x58\x37\xf4\x79\x00\x65\x00\x17\x0e"
-                                      "\x00\x0a\x0a\x02\x00\x1e\x1f\xee\x1b\x03\xc0\xff\xfc\x03\x00\x7e\x0f\xc0\x00\x66"
-                                      "\x00\x1e\x0e\x00\x0a\x10\x02\x00\x07\xc3\xe1\x80\x60\x18\x06\x0f\xfb\xfe\x18\x06"
-                                      "\x01\x80\x60\x18\x06\x01\x80\x60\x00\x67\x00\x1d\x0e\x00\x0a\x0f\x01\xfb\x1f\x4f"
-                                      "\xf6\x05\x81\xc0\x70\x1c\x05\x83\x7f\x47\x90\x04\x03\x00\xcf\xe3\xf0\x00\x68\x00"
-                                      "\x1c\x0e\x00\x09\x10\x02\x00\xc0\x60\x30\x18\x0c\x06\x03\x3d\xbf\xf1\xf0\x70\x38"
-                                      "\x1c\x0e\x07\x03\x81\x00\x69\x00\x1c\x0e\x00\x09\x10\x03\x00\x18\x1c\x06\x00\x00"
-                                      "\x00\x03\xe1\xf0\x18\x0c\x06\x03\x01\x80\xc3\xff\xff\x00\x6A\x00\x1f\x0e\x00\x08"
-                                      "\x15\x02\xfb\x06\x0f\x06\x00\x00\x00\x7e\x7e\x06\x06\x06\x06\x06\x06\x06\x06\x06"
-                                      "\x06\x06\xfe\xf8\x00\x6B\x00\x1e\x0e\x00\x0a\x10\x02\x00\xc0\x30\x0c\x03\x00\xc0"
-                                      "\x30\x0c\x1f\x0c\xc6\x37\x0f\x83\x60\xcc\x31\x8c\x3b\x07\x00\x6C\x00\x20\x0e\x00"
-                                      "\x0b\x10\x01\x00\xfc\x1f\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x30\x06"
-                                      "\x00\xc0\x1c\x01\xf8\x1f\x00\x6D\x00\x18\x0e\x00\x0b\x0a\x01\x00\xcc\xfb\xff\x9c"
-                                      "\xe3\x1c\x63\x8c\x71\x8e\x31\xc6\x38\xc4\x00\x6E\x00\x16\x0e\x00\x09\x0a\x02\x00"
-                                      "\xcf\x6f\xfc\x7c\x1c\x0e\x07\x03\x81\xc0\xe0\x40\x00\x6F\x00\x18\x0e\x00\x0b\x0a"
-                                      "\x01\x00\x1f\x07\xf9\x83\x30\x3c\x07\x80\xd8\x1b\x06\x3f\xc3\xe0\x00\x70\x00\x1d"
-                                      "\x0e\x00\x0a\x0f\x02\xfb\xcf\x3f\xee\x1f\x03\xc0\xf0\x3c\x0f\x07\xff\xb7\x8c\x03"
-                                      "\x00\xc0\x30\x0c\x00\x00\x71\x00\x1d\x0e\x00\x0a\x0f\x01\xfb\x1f\x4f\xf6\x05\x81"
-                                      "\xc0\x70\x1c\x05\x83\x7f\x47\x90\x04\x01\x00\x40\x10\x04\x00\x72\x00\x18\x0e\x00"
-                                      "\x0b\x0a\x01\x00\x79\xef\x7c\x78\x0e\x01\x80\x30\x06\x00\xc0\xff\x1f\xe0\x00\x73"
-                                      "\x00\x16\x0e\x00\x09\x0a\x02\x00\x3f\xbf\xf0\x1c\x07\xe0\x7c\x06\x01\xff\xff\x80"
-                                      "\x00\x74\x00\x1e\x0e\x00\x0b\x0e\x01\x00\x0c\x01\x80\x30\x06\x0f\xfd\xff\x83\x00"
-                                      "\x60\x0c\x01\x80\x30\x06\x00\xfe\x0f\xc0\x00\x75\x00\x16\x0e\x00\x09\x0a\x02\x00"
-                                      "\xc0\xe0\x70\x38\x1c\x0e\x07\x07\x87\xfe\xbc\x40\x00\x76\x00\x18\x0e\x00\x0b\x0a"
-                                      "\x01\x00\xe0\x6c\x0d\x83\x18\x63\x18\x33\x06\x40\x58\x0f\x01\xc0\x00\x77\x00\x18"
-                                      "\x0e\x00\x0b\x0a\x01\x00\xc0\x38\x8f\x11\xa3\x36\xe6\xd4\x9a\xd1\xce\x31\xc6\x38"
-                                      "\x00\x78\x00\x17\x0e\x00\x0a\x0a\x02\x00\xc1\x98\xe3\x30\x78\x1c\x07\x03\x61\x8c"
-                                      "\x61\xb0\x70\x00\x79\x00\x1f\x0e\x00\x0b\x0f\x01\xfb\xe0\x6c\x0d\x83\x18\x63\x18"
-                                      "\x33\x06\x40\x78\x0f\x01\xc0\x18\x06\x00\xc1\xf0\x3c\x00\x00\x7A\x00\x17\x0e\x00"
-                                      "\x0a\x0a\x02\x00\xff\xff\xe0\x30\x18\x0c\x06\x03\x01\x80\xff\xff\xf0\x00\x7B\x00"
-                                      "\x25\x0e\x00\x0a\x15\x02\xfd\x03\xc7\xf3\x80\xe0\x18\x03\x00\x60\x18\x0e\x3e\x08"
-                                      "\x03\xe0\x1e\x01\x80\x60\x30\x18\x0e\x03\x80\x7f\x03\xc0\x00\x7C\x00\x0f\x0e\x00"
-                                      "\x02\x13\x06\xfe\xff\xff\xff\xff\xfc\x00\x7D\x00\x27\x0e\x00\x0b\x15\x01\xfd\x70"
-                                      "\x1f\xe0\x0c\x01\x80\x60\x1c\x07\x00\xc0\x0e\x00\x78\x01\x81\xe0\xe0\x30\x07\x00"
-                                      "\x70\x06\x00\x60\x0c\x7f\x87\x00\x00\x7E\x00\x12\x0e\x00\x0c\x05\x01\x05\x30\x37"
-                                      "\xc2\x4e\x6c\x3c\xc1\xc0\x00\xA0\x00\x0a\x0e\x00\x00\x00\x00\x00\x00\xA1\x00\x12"
-                                      "\x0e\x00\x04\x10\x05\x00\xef\x60\x00\x46\x66\x6e\xee\xef\x00\xA2\x00\x20\x0e\x00"
-                                      "\x0a\x11\x02\xfd\x04\x01\x00\x40\x7c\x7f\xf9\x2c\x43\x10\x84\x31\x0c\x43\x92\x7f"
-                                      "\xcf\xc0\x40\x10\x04\x00\x00\xA3\x00\x1d\x0e\x00\x0a\x0f\x02\x00\x3e\x1f\xec\x1f"
-                                      "\x02\xc0\x18\x03\x00\x60\xff\x86\x03\x00\xc0\x60\x3f\xff\xfc\x00\xA5\x00\x1f\x0e"
-                                      "\x00\x0b\x0f\x01\x00\xc0\x6c\x0d\x83\x18\x61\x18\x32\x03\xc0\x70\x7f\xe0\xc0\x18"
-                                      "\x3f\xf0\x60\x0c\x01\x80\x00\xA7\x00\x26\x0e\x00\x0b\x14\x01\xfb\x1f\xc7\xf9\x80"
-                                      "\x30\x03\x80\x3c\x03\xe1\x8e\x60\x78\x0f\x01\xf0\x37\x9c\x3e\x01\xe0\x0e\x00\xc0"
-                                      "\x19\xff\x3f\x80\x00\xA8\x00\x0c\x0e\x00\x08\x02\x03\x0c\xc7\xc6\x00\xA9\x00\x23"
-                                      "\x0e\x00\x0b\x12\x01\xfe\x1f\x06\x11\x81\x20\x34\x63\x92\x66\x0c\x81\x90\x32\x06"
-                                      "\x40\xcc\x1c\x92\x9c\x50\x1b\x02\x30\x83\xe0\x00\xAA\x00\x17\x0e\x00\x09\x0b\x02"
-                                      "\x05\x7e\x21\x80\xc7\xe6\x36\x1b\x1c\xf3\x00\x00\x1f\xe0\x00\xAB\x00\x1a\x0e\x00"
-                                      "\x0b\x0b\x01\x00\x04\x21\x8c\x63\x18\xc6\x31\x84\x18\xc1\x8c\x18\xc1\x8c\x10\x80"
-                                      "\x00\xAE\x00\x1a\x0e\x00\x0b\x0b\x01\x05\x1f\x04\x19\x01\x27\x94\x93\x1c\x52\x8a"
-                                      "\x49\x40\x44\x18\x7c\x00\x00\xAF\x00\x0b\x0e\x00\x07\x01\x03\x0d\xfe\x00\xB0\x00"
-                                      "\x15\x0e\x00\x09\x09\x02\x07\x1e\x39\x90\x78\x1c\x0e\x05\x06\xe6\x1e\x00\x00\xB1"
-                                      "\x00\x1c\x0e\x00\x0a\x0e\x02\x00\x0c\x03\x00\xc0\x30\xff\xff\xf0\xc0\x30\x0c\x03"
-                                      "\x00\x00\x00\xff\xff\xf0\x00\xB2\x00\x10\x0e\x00\x06\x08\x04\x07\x7b\x30\xc2\x11"
-                                      "\x8c\x3f\x00\xB3\x00\x10\x0e\x00\x06\x08\x04\x07\xfc\x63\x1e\x0c\x11\xfc\x00\xB4"
-                                      "\x00\x0d\x0e\x00\x05\x04\x05\x0c\x09\xd9\x00\x00\xB5\x00\x1b\x0e\x00\x09\x0f\x02"
-                                      "\xfb\xc0\xe0\x70\x38\x1c\x0e\x07\x07\x87\xfe\xfc\x70\x18\x0c\x06\x03\x00\x00\xB6"
-                                      "\x00\x1b\x0e\x00\x09\x0f\x02\x00\x3f\xfc\x7e\x3f\x1f\x8f\xc5\xe2\x71\x00\x80\x40"
-                                      "\x20\x10\x08\x04\x02\x00\xB7\x00\x0c\x0e\x00\x04\x04\x05\x06\x4f\xfe\x00\xB8\x00"
-                                      "\x0f\x0e\x00\x06\x06\x04\xfa\x20\x87\xc1\x1f\xc0\x00\xB9\x00\x10\x0e\x00\x06\x08"
-                                      "\x04\x07\x33\xcb\x0c\x30\xc3\x3f\x00\xBA\x00\x15\x0e\x00\x08\x0b\x03\x05\x3c\xe6"
-                                      "\x83\x83\x83\x83\xe6\x3c\x00\x00\xff\x00\xBB\x00\x18\x0e\x00\x0a\x0b\x02\x00\x84"
-                                      "\x21\x8c\x31\x8e\x39\xc6\x33\x8d\x86\xc3\x21\x88\x40\x00\xBC\x00\x29\x0e\x00\x0d"
-                                      "\x13\x00\xfb\x30\x07\x80\x24\x00\x20\x11\x01\x88\x18\x41\x9f\x90\x01\x00\x10\x03"
-                                      "\x00\x30\xc3\x0a\x70\x91\x04\x80\x44\x07\xf0\x01\x00\x08\x00\xBD\x00\x29\x0e\x00"
-                                      "\x0d\x13\x00\xfb\x30\x07\x80\x24\x00\x20\x11\x01\x88\x18\x41\x9f\x90\x01\x00\x10"
-                                      "\x03\x00\x31\xe3\x39\x70\x09\x00\xc0\x0c\x00\xc0\x0c\x00\xfe\x00\xBE\x00\x29\x0e"
-                                      "\x00\x0d\x13\x00\xfb\xfc\x00\x60\x06\x00\x78\x10\x61\x83\x18\x39\x8f\x10\x01\x00"
-                                      "\x10\x03\x00\x30\xc3\x0a\x70\x91\x04\x80\x44\x07\xf0\x01\x00\x08\x00\xBF\x00\x1e"
-                                      "\x0e\x00\x0a\x10\x02\x00\x07\x03\xc0\x60\x00\x00\x00\x00\x60\x18\x0e\x0e\x0e\x03"
-                                      "\x00\xc0\x30\x7f\xfc\xf8\x00\xC0\x00\x27\x0e\x00\x0b\x15\x01\x00\x20\x07\x00\x30"
-                                      "\x01\x00\x00\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc"
-                                      "\x0d\x81\xe0\x3c\x06\x00\xC1\x00\x27\x0e\x00\x0b\x15\x01\x00\x00\x80\x38\x1c\x06"
-                                      "\x00\x00\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc\x0d"
-                                      "\x81\xe0\x3c\x06\x00\xC2\x00\x27\x0e\x00\x0b\x15\x01\x00\x04\x01\xc0\x6e\x18\x60"
-                                      "\x00\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81"
-                                      "\xe0\x3c\x06\x00\xC3\x00\x27\x0e\x00\x0b\x15\x01\x00\x18\x47\x98\x9a\x31\xc0\x00"
-                                      "\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81\xe0"
-                                      "\x3c\x06\x00\xC4\x00\x26\x0e\x00\x0b\x14\x01\x00\x20\x8e\x38\xc7\x00\x00\x00\x1c"
-                                      "\x03\x80\x78\x1b\x03\x60\x66\x08\xc3\x18\x61\x8f\xf3\xfe\x60\x6c\x0f\x01\xe0\x30"
-                                      "\x00\xC5\x00\x23\x0e\x00\x0b\x12\x01\x00\x1f\x02\x30\xc2\x08\xc1\xf0\x1e\x02\xc0"
-                                      "\xd8\x19\x82\x30\xc6\x18\x43\xfc\xff\x98\x13\x03\xc0\x78\x0c\x00\xC6\x00\x23\x0e"
-                                      "\x00\x0d\x0f\x00\x00\x07\xf8\x7f\xc3\x40\x12\x01\x90\x0c\x80\x47\xc6\x3e\x31\x01"
-                                      "\x88\x1f\xc0\xc2\x06\x10\x60\xff\x07\xe0\x00\xC7\x00\x27\x0e\x00\x0b\x15\x01\xfa"
-                                      "\x0f\x83\xfc\xc1\xb0\x06\x01\x80\x30\x06\x00\xc0\x18\x01\x80\x30\x07\x06\x7f\xc3"
-                                      "\xe0\x30\x07\x00\x38\x03\x01\xc0\xe0\x00\xC8\x00\x25\x0e\x00\x0a\x15\x02\x00\x20"
-                                      "\x1c\x01\xc0\x18\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff\xbf\xec\x03\x00\xc0"
-                                      "\x30\x0c\x03\xff\xff\xc0\x00\xC9\x00\x23\x0e\x00\x0a\x14\x02\x01\x03\x81\x80\x80"
-                                      "\x00\x00\x3f\xff\xff\x00\xc0\x30\x0c\x03\xfe\xff\xb0\x0c\x03\x00\xc0\x30\x0f\xff"
-                                      "\xff\x00\xCA\x00\x25\x0e\x00\x0a\x15\x02\x00\x04\x07\x83\x31\x82\x00\x00\x0f\xff"
-                                      "\xff\xc0\x30\x0c\x03\x00\xff\xbf\xec\x03\x00\xc0\x30\x0c\x03\xff\xff\xc0\x00\xCB"
-                                      "\x00\x23\x0e\x00\x0a\x14\x02\x00\x20\x9c\x66\x18\x00\x00\x3f\xff\xff\x00\xc0\x30"
-                                      "\x0c\x03\xfe\xff\xb0\x0c\x03\x00\xc0\x30\x0f\xff\xff\x00\xCC\x00\x1e\x0e\x00\x08"
-                                      "\x14\x03\x01\xe0\x30\x08\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18"
-                                      "\x18\x18\xff\x00\xCD\x00\x1f\x0e\x00\x08\x15\x03\x00\x02\x07\x1c\x30\x00\x00\xff"
-                                      "\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\xff\x00\xCE\x00\x1f\x0e\x00"
-                                      "\x08\x15\x03\x00\x10\x3c\x66\x83\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18"
-                                      "\x18\x18\x18\x18\xff\x00\xCF\x00\x1e\x0e\x00\x08\x14\x03\x00\x82\xc7\xc7\x00\x00"
-                                      "\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\xff\x00\xD0\x00\x1f\x0e"
-                                      "\x00\x0b\x0f\x01\x00\x7e\x0f\xf1\x87\x30\x76\x06\xc0\xd8\x1f\xe3\x60\x6c\x0d\x81"
-                                      "\xb0\x66\x1c\xfe\x1f\x00\x00\xD1\x00\x25\x0e\x00\x0a\x15\x02\x00\x30\x9e\x24\xd1"
-                                      "\x1c\x00\x00\x0e\x0f\x83\xf0\xfc\x3d\x0f\x63\xd8\xf3\x3c\xcf\x1b\xc6\xf0\xfc\x3f"
-                                      "\x07\xc1\xc0\x00\xD2\x00\x26\x0e\x00\x0b\x14\x01\x01\x30\x03\x80\x1c\x00\x00\x00"
-                                      "\x3e\x0f\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f"
-                                      "\x80\x00\xD3\x00\x26\x0e\x00\x0b\x14\x01\x01\x01\x80\x60\x30\x00\x00\x00\x3e\x0f"
-                                      "\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x00"
-                                      "\xD4\x00\x26\x0e\x00\x0b\x14\x01\x00\x0e\x03\x60\xc6\x10\x00\x00\x3e\x0f\xe3\x86"
-                                      "\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x00\xD5\x00"
-                                      "\x26\x0e\x00\x0b\x14\x01\x01\x3c\x44\xd8\x8e\x10\x00\x00\x3e\x0f\xe3\x86\x60\x6c"
-                                      "\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x00\xD6\x00\x26\x0e"
-                                      "\x00\x0b\x14\x01\x00\x20\x86\x38\xc3\x00\x00\x00\x3e\x0f\xe3\x86\x60\x6c\x0f\x01"
-                                      "\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x00\xD7\x00\x16\x0e\x00\x09"
-                                      "\x0a\x02\x02\x40\xf0\xdc\xc6\xc1\xc0\xe0\xd8\xc6\xc1\xc0\x40\x00\xD8\x00\x22\x0e"
-                                      "\x00\x0b\x11\x01\xff\x00\x23\xec\xff\x38\x66\x1e\xc2\xf0\xde\x13\xc4\x78\x8f\x21"
-                                      "\xac\x37\x06\xc1\x9f\xe2\x78\xc0\x00\x00\xD9\x00\x23\x0e\x00\x0a\x14\x02\x01\x60"
-                                      "\x0e\x00\xe0\x00\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0"
-                                      "\xf8\x67\xf8\xf8\x00\xDA\x00\x23\x0e\x00\x0a\x14\x02\x01\x03\x01\x81\x80\x00\x00"
-                                      "\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x00"
-                                      "\xDB\x00\x25\x0e\x00\x0a\x15\x02\x00\x08\x07\x83\x31\x06\x00\x00\x0c\x0f\x03\xc0"
-                                      "\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3e\x19\xfe\x3e\x00\x00\xDC\x00\x23"
-                                      "\x0e\x00\x0a\x14\x02\x00\x41\x18\xe6\x38\x00\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f"
-                                      "\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x00\xDD\x00\x26\x0e\x00\x0b\x14\x01"
-                                      "\x01\x01\x80\x60\x30\x00\x00\x01\x80\xd8\x1b\x06\x30\xc7\x30\x6c\x07\x80\xe0\x0c"
-                                      "\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x00\xDE\x00\x1f\x0e\x00\x0b\x0f\x02\x00\xc0"
-                                      "\x18\x03\x00\x7f\x8f\xfd\x81\xb0\x36\x03\xc0\xd8\x1b\xfe\x7f\x8c\x01\x80\x30\x00"
-                                      "\x00\xDF\x00\x1e\x0e\x00\x0a\x10\x02\x00\x1f\x1f\xe6\x1b\x02\xc1\xb0\x6c\x33\x18"
-                                      "\xc6\x30\xec\x1f\x03\xc0\xf0\x3c\x7f\x1e\x00\xE0\x00\x21\x0e\x00\x0c\x0f\x01\x01"
-                                      "\x38\x00\xc0\x07\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7"
-                                      "\xfe\x3c\x70\x00\xE1\x00\x21\x0e\x00\x0c\x0f\x01\x01\x01\x80\x70\x0c\x00\x80\x00"
-                                      "\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x00\xE2\x00\x24"
-                                      "\x0e\x00\x0c\x11\x01\x00\x04\x00\xe0\x1f\x01\x18\x20\xc0\x00\x00\x07\xf0\x3f\x80"
-                                      "\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x00\xE3\x00\x21\x0e\x00\x0c\x0f"
-                                      "\x01\x01\x3c\x42\x68\x63\x82\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c"
-                                      "\xc1\xc7\xfe\x3c\x70\x00\xE4\x00\x1f\x0e\x00\x0c\x0e\x01\x00\x31\xc3\x18\x00\x00"
-                                      "\x00\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f\xe3\xc7\x00\xE5\x00\x22"
-                                      "\x0e\x00\x0c\x10\x01\x01\x1f\x01\x18\x11\x81\xf0\x00\x00\x00\x7f\x03\xf8\x00\xc0"
-                                      "\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f\xe3\xc7\x00\xE6\x00\x19\x0e\x00\x0c\x0a\x01\x00"
-                                      "\x79\xc7\xf6\x06\x30\x63\x3e\x3e\x7f\xc6\x0c\x60\xdf\x87\x1c\x00\xE7\x00\x1e\x0e"
-                                      "\x00\x0a\x10\x02\xfa\x1f\x1f\xfe\x0b\x00\xc0\x30\x0c\x03\x82\x7f\xcf\xc0\x80\x38"
-                                      "\x03\x00\x40\x70\xf0\x00\xE8\x00\x1d\x0e\x00\x0a\x0f\x02\x01\x30\x06\x00\x60\x00"
-                                      "\x00\x07\x87\xfb\x86\xc0\xf0\x3f\xff\x00\xc0\x1f\x83\xf0\x00\xE9\x00\x1d\x0e\x00"
-                                      "\x0a\x0f\x02\x01\x03\x01\x81\x80\x00\x00\x07\x87\xfb\x86\xc0\xf0\x3f\xff\x00\xc0"
-                                      "\x1f\x83\xf0\x00\xEA\x00\x1e\x0e\x00\x0a\x10\x02\x00\x0c\x07\x83\x31\x86\x00\x00"
-                                      "\x01\xe1\xfe\xe1\xb0\x3c\x0f\xff\xc0\x30\x07\xe0\xfc\x00\xEB\x00\x1c\x0e\x00\x0a"
-                                      "\x0e\x02\x00\x73\x9c\xe0\x00\x00\x1e\x1f\xee\x1b\x03\xc0\xff\xfc\x03\x00\x7e\x0f"
-                                      "\xc0\x00\xEC\x00\x1c\x0e\x00\x09\x10\x03\x00\x40\x30\x0e\x01\x80\x00\x03\xe1\xf0"
-                                      "\x18\x0c\x06\x03\x01\x80\xc3\xff\xff\x00\xED\x00\x1c\x0e\x00\x09\x10\x03\x00\x02"
-                                      "\x03\x07\x06\x00\x00\x03\xe1\xf0\x18\x0c\x06\x03\x01\x80\xc3\xff\xff\x00\xEE\x00"
-                                      "\x1e\x0e\x00\x09\x11\x03\x00\x18\x1e\x0f\x0c\xc8\x10\x00\x01\xf0\xf8\x0c\x06\x03"
-                                      "\x01\x80\xc0\x61\xff\xff\x80\x00\xEF\x00\x1a\x0e\x00\x09\x0e\x03\x00\xe7\x73\x80"
-                                      "\x00\x0f\x87\xc0\x60\x30\x18\x0c\x06\x03\x0f\xff\xfc\x00\xF0\x00\x20\x0e\x00\x0b"
-                                      "\x10\x01\x01\x19\x83\xe0\x1c\x02\xc0\x8c\x01\xc0\x18\xfb\x3b\xec\x0f\x01\xe0\x36"
-                                      "\x04\xc1\x8f\xe0\xf8\x00\xF1\x00\x1b\x0e\x00\x09\x0f\x02\x01\x78\xa6\xd1\xc8\x00"
-                                      "\x06\x7b\x7f\xe3\xe0\xe0\x70\x38\x1c\x0e\x07\x02\x00\xF2\x00\x1f\x0e\x00\x0b\x0f"
-                                      "\x01\x01\x38\x01\x80\x1c\x00\x00\x00\x3e\x0f\xf3\x06\x60\x78\x0f\x01\xb0\x36\x0c"
-                                      "\x7f\x87\xc0\x00\xF3\x00\x1f\x0e\x00\x0b\x0f\x01\x01\x01\x80\xe0\x30\x00\x00\x00"
-                                      "\x3e\x0f\xf3\x06\x60\x78\x0f\x01\xb0\x36\x0c\x7f\x87\xc0\x00\xF4\x00\x20\x0e\x00"
-                                      "\x0b\x10\x01\x00\x06\x01\xe0\x66\x18\x62\x00\x00\x07\xc1\xfe\x60\xcc\x0f\x01\xe0"
-                                      "\x36\x06\xc1\x8f\xf0\xf8\x00\xF5\x00\x1f\x0e\x00\x0b\x0f\x01\x01\x3c\x44\xd8\x8e"
-                                      "\x10\x00\x00\x3e\x0f\xf3\x06\x60\x78\x0f\x01\xb0\x36\x0c\x7f\x87\xc0\x00\xF6\x00"
-                                      "\x1e\x0e\x00\x0b\x0e\x01\x00\x31\xc6\x30\x00\x00\x01\xf0\x7f\x98\x33\x03\xc0\x78"
-                                      "\x0d\x81\xb0\x63\xfc\x3e\x00\x00\xF7\x00\x19\x0e\x00\x0a\x0c\x02\x01\x0c\x07\x01"
-                                      "\xc0\x00\x00\x3f\xff\xfc\x00\x00\x03\x01\xc0\x30\x00\xF8\x00\x1b\x0e\x00\x0b\x0c"
-                                      "\x01\xff\x00\x63\xe8\xff\x30\xe6\x37\x8c\xf1\x1b\x43\x78\xc7\xf9\xfc\x60\x00\x00"
-                                      "\xF9\x00\x1b\x0e\x00\x09\x0f\x02\x01\x70\x0c\x03\x80\x00\x06\x07\x03\x81\xc0\xe0"
-                                      "\x70\x38\x3c\x3f\xf5\xe2\x00\xFA\x00\x1b\x0e\x00\x09\x0f\x02\x01\x03\x03\x06\x00"
-                                      "\x00\x06\x07\x03\x81\xc0\xe0\x70\x38\x3c\x3f\xf5\xe2\x00\xFB\x00\x1e\x0e\x00\x09"
-                                      "\x11\x02\x00\x0c\x0e\x0d\x84\x64\x18\x00\x01\x81\xc0\xe0\x70\x38\x1c\x0e\x0f\x0f"
-                                      "\xfd\x78\x80\x00\xFC\x00\x1a\x0e\x00\x09\x0e\x02\x00\x73\xb1\xc0\x00\x0c\x0e\x07"
-                                      "\x03\x81\xc0\xe0\x70\x78\x7f\xeb\xc4\x00\xFD\x00\x26\x0e\x00\x0b\x14\x01\xfc\x01"
-                                      "\x80\x60\x30\x00\x00\x01\xc0\xd8\x1b\x06\x30\xc6\x30\x66\x0c\x80\xf0\x1e\x03\x80"
-                                      "\x30\x0c\x01\x83\xe0\x78\x00\x00\xFE\x00\x25\x0e\x00\x0a\x15\x02\xfb\xc0\x30\x0c"
-                                      "\x03\x00\xc0\x30\x0c\xf3\xfe\xe1\xf0\x3c\x0f\x03\xc0\xf0\x7f\xfb\x78\xc0\x30\x0c"
-                                      "\x03\x00\xc0\x00\x00\xFF\x00\x25\x0e\x00\x0b\x13\x01\xfb\x39\xc6\x38\x00\x00\x0e"
-                                      "\x06\xc0\xd8\x31\x86\x31\x83\x30\x64\x07\x80\xf0\x1c\x01\x80\x60\x0c\x1f\x03\xc0"
-                                      "\x00\x01\x00\x00\x23\x0e\x00\x0b\x12\x01\x00\x3f\x80\x00\x00\x07\x00\xe0\x1e\x06"
-                                      "\xc0\xd8\x19\x82\x30\xc6\x18\x63\xfc\xff\x98\x1b\x03\xc0\x78\x0c\x01\x01\x00\x1f"
-                                      "\x0e\x00\x0c\x0e\x01\x00\x3f\x83\xf8\x00\x00\x00\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7"
-                                      "\x0c\x40\xcc\x1c\x7f\xe3\xc7\x01\x02\x00\x27\x0e\x00\x0b\x15\x01\x00\x20\x84\x10"
-                                      "\xc6\x0f\x80\x00\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1\x18\x63\x0c\x31\xfe\x7f"
-                                      "\xcc\x0d\x81\xe0\x3c\x06\x01\x03\x00\x21\x0e\x00\x0c\x0f\x01\x01\x20\xc3\x18\x1f"
-                                      "\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x01"
-                                      "\x04\x00\x28\x0e\x00\x0c\x14\x01\xfb\x0e\x00\xe0\x0f\x01\xb0\x1b\x01\x98\x11\x83"
-                                      "\x18\x30\xc3\xfc\x7f\xc6\x06\x60\x6c\x06\xc0\x60\x02\x00\x40\x0c\x00\xc0\x07\x01"
-                                      "\x05\x00\x21\x0e\x00\x0c\x0f\x01\xfb\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc"
-                                      "\x1c\x7f\xe3\xc7\x00\x80\x08\x01\x80\x18\x00\xe0\x01\x06\x00\x26\x0e\x00\x0b\x14"
-                                      "\x01\x01\x00\xc0\x70\x18\x00\x00\x00\x1f\x07\xf9\x83\x60\x0c\x03\x00\x60\x0c\x01"
-                                      "\x80\x30\x03\x00\x60\x0e\x0c\xff\x87\xc0\x01\x07\x00\x1d\x0e\x00\x0a\x0f\x02\x01"
-                                      "\x03\x81\x81\xc0\x00\x00\x07\xc7\xff\x82\xc0\x30\x0c\x03\x00\xe0\x9f\xf3\xf0\x01"
-                                      "\x08\x00\x26\x0e\x00\x0b\x14\x01\x00\x07\x01\xb0\x63\x00\x00\x00\x1f\x07\xf9\x83"
-                                      "\x60\x0c\x03\x00\x60\x0c\x01\x80\x30\x03\x00\x60\x0e\x0c\xff\x87\xc0\x01\x09\x00"
-                                      "\x1e\x0e\x00\x0a\x10\x02\x00\x0c\x07\x83\x31\x86\x00\x80\x01\xf1\xff\xe0\xb0\x0c"
-                                      "\x03\x00\xc0\x38\x27\xfc\xfc\x01\x0A\x00\x25\x0e\x00\x0b\x13\x01\x00\x07\x00\xe0"
-                                      "\x00\x00\x00\xf8\x3f\xcc\x1b\x00\x60\x18\x03\x00\x60\x0c\x01\x80\x18\x03\x00\x70"
-                                      "\x67\xfc\x3e\x00\x01\x0B\x00\x1d\x0e\x00\x0a\x0f\x02\x00\x04\x03\x80\xc0\x00\x00"
-                                      "\x07\xc7\xff\x82\xc0\x30\x0c\x03\x00\xe0\x9f\xf3\xf0\x01\x0C\x00\x26\x0e\x00\x0b"
-                                      "\x14\x01\x01\x30\x61\xb0\x1c\x01\x00\x00\x1f\x07\xf9\x83\x60\x0c\x03\x00\x60\x0c"
-                                      "\x01\x80\x30\x03\x00\x60\x0e\x0c\xff\x87\xc0\x01\x0D\x00\x1e\x0e\x00\x0a\x10\x02"
-                                      "\x01\x61\x8c\xc1\xe0\x38\x04\x00\x01\xf1\xff\xe0\xb0\x0c\x03\x00\xc0\x38\x27\xfc"
-                                      "\xfc\x01\x0E\x00\x25\x0e\x00\x0a\x15\x02\x00\x81\x30\xc3\xe0\x60\x00\x00\x0f\xc3"
-                                      "\xfc\xc3\xb0\x7c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x6c\x3b\xf8\xf8\x00\x01\x0F"
-                                      "\x00\x2c\x0e\x00\x0f\x12\x01\x00\x00\x06\x00\x0c\x01\x18\x02\x20\x04\x40\x08\x00"
-                                      "\x10\x00\x20\x1f\x40\x7f\x81\x83\x03\x02\x0c\x04\x18\x08\x30\x10\x30\x60\x7f\x40"
-                                      "\x3c\x80\x01\x10\x00\x1f\x0e\x00\x0b\x0f\x01\x00\x7e\x0f\xf1\x87\x30\x76\x06\xc0"
-                                      "\xd8\x1f\xe3\x60\x6c\x0d\x81\xb0\x66\x1c\xfe\x1f\x00\x01\x11\x00\x22\x0e\x00\x0c"
-                                      "\x10\x01\x00\x00\xc0\x0c\x00\xc0\xff\x00\xc0\x0c\x1e\xc3\xfc\x60\xc4\x0c\xc0\xcc"
-                                      "\x0c\xc0\xc6\x1c\x7f\xc1\xec\x01\x12\x00\x22\x0e\x00\x0a\x13\x02\x00\x3f\x8f\xe0"
-                                      "\x00\x00\xff\xff\xfc\x03\x00\xc0\x30\x0f\xfb\xfe\xc0\x30\x0c\x03\x00\xc0\x3f\xff"
-                                      "\xfc\x01\x13\x00\x1c\x0e\x00\x0a\x0e\x02\x00\x7f\x9f\xe0\x00\x00\x1e\x1f\xee\x1b"
-                                      "\x03\xc0\xff\xfc\x03\x00\x7e\x0f\xc0\x01\x14\x00\x25\x0e\x00\x0a\x15\x02\x00\x00"
-                                      "\x98\x23\x18\x7c\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff\xbf\xec\x03\x00\xc0"
-                                      "\x30\x0c\x03\xff\xff\xc0\x01\x15\x00\x1d\x0e\x00\x0a\x0f\x02\x01\x61\x88\x43\xf0"
-                                      "\x00\x00\x07\x87\xfb\x86\xc0\xf0\x3f\xff\x00\xc0\x1f\x83\xf0\x01\x16\x00\x23\x0e"
-                                      "\x00\x0a\x14\x02\x00\x0c\x03\x80\xc0\x00\x00\x3f\xff\xff\x00\xc0\x30\x0c\x03\xfe"
-                                      "\xff\xb0\x0c\x03\x00\xc0\x30\x0f\xff\xff\x01\x17\x00\x1d\x0e\x00\x0a\x0f\x02\x00"
-                                      "\x0c\x03\x00\xc0\x00\x00\x07\x87\xfb\x86\xc0\xf0\x3f\xff\x00\xc0\x1f\x83\xf0\x01"
-                                      "\x18\x00\x23\x0e\x00\x0a\x14\x02\xfb\xff\xff\xfc\x03\x00\xc0\x30\x0f\xfb\xfe\xc0"
-                                      "\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x04\x03\x00\x80\x30\x0f\x01\x19\x00\x1d\x0e\x00"
-                                      "\x0a\x0f\x02\xfb\x1e\x1f\xee\x1b\x03\xc0\xff\xfc\x03\x00\x7e\x0f\xc0\x20\x18\x04"
-                                      "\x01\x80\x78\x01\x1A\x00\x25\x0e\x00\x0a\x15\x02\x00\x00\x8c\x61\xb0\x38\x00\x00"
-                                      "\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff\xbf\xec\x03\x00\xc0\x30\x0c\x03\xff\xff\xc0"
-                                      "\x01\x1B\x00\x1e\x0e\x00\x0a\x10\x02\x01\x61\x8c\xc1\xe0\x30\x00\x00\x01\xe1\xfe"
-                                      "\xe1\xb0\x3c\x0f\xff\xc0\x30\x07\xe0\xfc\x01\x1C\x00\x27\x0e\x00\x0b\x15\x01\x00"
-                                      "\x02\x00\xe0\x36\x0c\x30\x00\x00\x01\xf0\xfe\x30\x0c\x01\x80\x60\x0c\x01\x87\xf0"
-                                      "\xfe\x03\x60\x6c\x0d\xc1\x9f\xf0\xfe\x01\x1D\x00\x26\x0e\x00\x0a\x16\x01\xfb\x04"
-                                      "\x03\x81\xf0\x46\x20\xc0\x00\x00\x7d\x3f\xd8\x16\x07\x01\xc0\x70\x16\x0d\xfd\x1e"
-                                      "\x40\x10\x0c\x03\x3f\x8f\xc0\x01\x1E\x00\x26\x0e\x00\x0b\x14\x01\x01\x10\x43\x18"
-                                      "\x3e\x00\x00\x00\x0f\x87\xf1\x80\x60\x0c\x03\x00\x60\x0c\x3f\x87\xf0\x1b\x03\x60"
-                                      "\x6e\x0c\xff\x87\xf0\x01\x1F\x00\x23\x0e\x00\x0a\x14\x01\xfc\x20\xcc\x61\xf0\x00"
-                                      "\x00\x07\xd3\xfd\x81\x60\x70\x1c\x07\x01\x60\xdf\xd1\xe4\x01\x00\xc0\x33\xf8\xfc"
-                                      "\x01\x20\x00\x26\x0e\x00\x0b\x14\x01\x00\x02\x00\xe0\x1c\x00\x00\x00\x0f\x87\xf1"
-                                      "\x80\x60\x0c\x03\x00\x60\x0c\x3f\x87\xf0\x1b\x03\x60\x6e\x0c\xff\x87\xf0\x01\x21"
-                                      "\x00\x23\x0e\x00\x0a\x14\x01\xfb\x04\x03\x80\x60\x00\x00\x07\xd3\xfd\x81\x60\x70"
-                                      "\x1c\x07\x01\x60\xdf\xd1\xe4\x01\x00\xc0\x33\xf8\xfc\x01\x22\x00\x29\x0e\x00\x0b"
-                                      "\x16\x01\xf9\x07\xc3\xf8\xc0\x30\x06\x01\x80\x30\x06\x1f\xc3\xf8\x0d\x81\xb0\x37"
-                                      "\x06\x7f\xc3\xf8\x00\x00\x00\xc0\x0e\x00\x40\x18\x0c\x00\x01\x23\x00\x25\x0e\x00"
-                                      "\x0a\x15\x01\xfc\x0f\x06\x01\x80\x3c\x00\x00\x01\xf4\xff\x60\x58\x1c\x07\x01\xc0"
-                                      "\x58\x37\xf4\x79\x00\x40\x30\x0c\xfe\x3f\x00\x01\x24\x00\x22\x0e\x00\x09\x15\x02"
-                                      "\x00\x08\x0f\x0c\xc8\x30\x00\x03\x03\x81\xc0\xe0\x70\x38\x1f\xff\xff\x03\x81\xc0"
-                                      "\xe0\x70\x38\x1c\x08\x01\x25\x00\x2b\x0e\x00\x0c\x16\xff\x00\x18\x03\xc0\x66\x04"
-                                      "\x30\x81\x00\x00\x18\x01\x80\x18\x01\x80\x18\x01\x80\x19\xe1\xbf\x1e\x31\xc1\x18"
-                                      "\x11\x81\x18\x11\x81\x18\x11\x81\x01\x26\x00\x21\x0e\x00\x0c\x0f\x01\x00\x60\xc6"
-                                      "\x0c\x60\xcf\xff\x60\xc6\x0c\x60\xc7\xfc\x7f\xc6\x0c\x60\xc6\x0c\x60\xc6\x0c\x60"
-                                      "\xc0\x01\x27\x00\x1e\x0e\x00\x0a\x10\x01\x00\x60\x18\x06\x03\xf8\x60\x18\x06\x39"
-                                      "\xbf\x78\xdc\x16\x05\x81\x60\x58\x16\x05\x81\x01\x28\x00\x22\x0e\x00\x09\x15\x02"
-                                      "\x00\x30\xbc\xd3\x58\xe0\x00\x01\xfe\x18\x0c\x06\x03\x01\x80\xc0\x60\x30\x18\x0c"
-                                      "\x06\x03\x01\x87\xf8\x01\x29\x00\x1c\x0e\x00\x09\x10\x03\x00\x61\x38\xb6\xd1\xc0"
-                                      "\x00\x03\xe1\xf0\x18\x0c\x06\x03\x01\x80\xc3\xff\xff\x01\x2A\x00\x1d\x0e\x00\x08"
-                                      "\x13\x03\x00\xfe\xfe\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18"
-                                      "\x18\xff\x01\x2B\x00\x1a\x0e\x00\x09\x0e\x03\x00\xff\x7f\x80\x00\x0f\x87\xc0\x60"
-                                      "\x30\x18\x0c\x06\x03\x0f\xff\xfc\x01\x2C\x00\x1f\x0e\x00\x08\x15\x03\x00\x80\x83"
-                                      "\xc6\x7c\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\xff\x01"
-                                      "\x2D\x00\x1c\x0e\x00\x09\x10\x03\x00\x81\x61\x99\x87\x80\x00\x03\xe1\xf0\x18\x0c"
-                                      "\x06\x03\x01\x80\xc3\xff\xff\x01\x2E\x00\x1e\x0e\x00\x08\x14\x03\xfb\xff\x18\x18"
-                                      "\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\xff\x10\x20\x20\x60\x3c\x01\x2F\x00"
-                                      "\x22\x0e\x00\x09\x15\x03\xfb\x18\x1c\x06\x00\x00\x00\x03\xe1\xf0\x18\x0c\x06\x03"
-                                      "\x01\x80\xc3\xff\xff\x10\x18\x08\x06\x03\xc0\x01\x30\x00\x1e\x0e\x00\x08\x14\x03"
-                                      "\x00\x18\x38\x18\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18"
-                                      "\xff\x01\x31\x00\x16\x0e\x00\x09\x0a\x03\x00\xf8\x7c\x06\x03\x01\x80\xc0\x60\x30"
-                                      "\xff\xff\xc0\x01\x34\x00\x2d\x0e\x00\x0d\x15\x01\x00\x00\x40\x07\x00\x6c\x0c\x30"
-                                      "\x00\x00\x00\x03\x00\x18\x00\xc0\x06\x00\x30\x01\x80\x0c\x00\x60\x03\x00\x18\x00"
-                                      "\xc6\x06\x1c\x30\x7f\x80\xf0\x00\x01\x35\x00\x26\x0e\x00\x0a\x16\x02\xfb\x02\x01"
-                                      "\xc0\xd8\x63\x30\x40\x00\x01\xf8\x7e\x01\x80\x60\x18\x06\x01\x80\x60\x18\x06\x01"
-                                      "\x80\x60\x18\xfe\x3e\x00\x01\x36\x00\x29\x0e\x00\x0b\x16\x02\xf9\xc0\xd8\x33\x0e"
-                                      "\x63\x8c\xe1\x98\x36\x07\x80\xd8\x19\x83\x18\x63\x8c\x39\x83\xb0\x38\x00\x00\x03"
-                                      "\x80\x38\x01\x00\x60\x30\x00\x01\x37\x00\x27\x0e\x00\x0a\x17\x02\xf9\xc0\x30\x0c"
-                                      "\x03\x00\xc0\x30\x0c\x1f\x0c\xc6\x37\x0f\x83\x60\xcc\x31\x8c\x3b\x07\x00\x00\x01"
-                                      "\x80\x38\x06\x01\x83\x80\x01\x39\x00\x23\x0e\x00\x0a\x14\x02\x01\x38\x18\x08\x00"
-                                      "\x00\x00\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0f\xff"
-                                      "\xff\x01\x3A\x00\x29\x0e\x00\x0b\x16\x01\x00\x01\x00\x70\x38\x0c\x00\x00\x00\x3f"
-                                      "\x07\xe0\x0c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x30\x07\x00\x7e"
-                                      "\x07\xc0\x01\x3B\x00\x26\x0e\x00\x0a\x16\x02\xf9\xc0\x30\x0c\x03\x00\xc0\x30\x0c"
-                                      "\x03\x00\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x00\x00\x07\x00\x60\x0c\x06\x07\x00"
-                                      "\x01\x3C\x00\x2a\x0e\x00\x0b\x17\x01\xf9\xfc\x1f\x80\x30\x06\x00\xc0\x18\x03\x00"
-                                      "\x60\x0c\x01\x80\x30\x06\x00\xc0\x1c\x01\xf8\x1f\x00\x00\x00\x30\x03\x80\x30\x06"
-                                      "\x07\x00\x01\x3D\x00\x1d\x0e\x00\x0a\x0f\x02\x00\xc2\x30\x8c\x23\x08\xc2\x30\x0c"
-                                      "\x03\x00\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x01\x3E\x00\x23\x0e\x00\x0b\x12\x01"
-                                      "\x00\x00\x20\x07\xf0\xfe\x10\xc2\x18\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x18"
-                                      "\x03\x00\x70\x07\xe0\x7c\x01\x3F\x00\x1d\x0e\x00\x0a\x0f\x02\x00\xc0\x30\x0c\x03"
-                                      "\x00\xc0\x30\x2c\x1f\x0f\xc1\xb0\x0c\x03\x00\xc0\x3f\xff\xfc\x01\x40\x00\x26\x0e"
-                                      "\x00\x0e\x10\x01\x00\xfc\x03\xf0\x00\xc0\x03\x00\x0c\x00\x30\x00\xc0\x83\x07\x0c"
-                                      "\x1c\x30\x70\xc0\x03\x00\x0c\x00\x38\x00\x7e\x00\xf8\x01\x41\x00\x1f\x0e\x00\x0b"
-                                      "\x0f\x01\x00\x30\x06\x00\xc0\x18\x03\x30\x6c\x0f\x01\x80\x70\x16\x00\xc0\x18\x03"
-                                      "\x00\x7f\xcf\xf8\x01\x42\x00\x20\x0e\x00\x0b\x10\x01\x00\xfc\x1f\x80\x30\x06\x00"
-                                      "\xc0\x19\x83\xe0\x70\x3c\x0d\x80\x30\x06\x00\xc0\x1c\x01\xf8\x1f\x01\x43\x00\x23"
-                                      "\x0e\x00\x0a\x14\x02\x01\x03\x81\x81\xc0\x00\x00\x38\x3e\x0f\xc3\xf0\xf4\x3d\x8f"
-                                      "\x63\xcc\xf3\x3c\x6f\x1b\xc3\xf0\xfc\x1f\x07\x01\x44\x00\x1b\x0e\x00\x09\x0f\x02"
-                                      "\x01\x03\x07\x06\x00\x00\x06\x7b\x7f\xe3\xe0\xe0\x70\x38\x1c\x0e\x07\x02\x01\x45"
-                                      "\x00\x26\x0e\x00\x0a\x16\x02\xf9\xe0\xf8\x3f\x0f\xc3\xd0\xf6\x3d\x8f\x33\xcc\xf1"
-                                      "\xbc\x6f\x0f\xc3\xf0\x7c\x1c\x00\x00\x06\x00\xe0\x18\x06\x06\x00\x01\x46\x00\x1e"
-                                      "\x0e\x00\x09\x11\x02\xf9\xcf\x6f\xfc\x7c\x1c\x0e\x07\x03\x81\xc0\xe0\x40\x00\x01"
-                                      "\x80\x70\x08\x0c\x18\x00\x01\x47\x00\x23\x0e\x00\x0a\x14\x02\x01\x61\x8c\xc1\xc0"
-                                      "\x20\x00\x38\x3e\x0f\xc3\xf0\xf4\x3d\x8f\x63\xcc\xf3\x3c\x6f\x1b\xc3\xf0\xfc\x1f"
-                                      "\x07\x01\x48\x00\x1c\x0e\x00\x09\x10\x02\x01\x41\x99\x87\x83\x80\x80\x03\x3d\xbf"
-                                      "\xf1\xf0\x70\x38\x1c\x0e\x07\x03\x81\x01\x4A\x00\x25\x0e\x00\x0a\x15\x02\xfa\xe0"
-                                      "\xf8\x3f\x0f\xc3\xd0\xf6\x3c\x8f\x33\xcc\xf1\xbc\x6f\x0f\xc3\xf0\x7c\x1c\x03\x00"
-                                      "\xc0\x20\x18\x7c\x1c\x00\x01\x4B\x00\x1b\x0e\x00\x09\x0f\x02\xfb\xcf\x6f\xfc\x7c"
-                                      "\x1c\x0e\x07\x03\x81\xc0\xe0\x40\x20\x10\x18\xfc\x78\x01\x4C\x00\x25\x0e\x00\x0b"
-                                      "\x13\x01\x00\x3f\x87\xf0\x00\x00\x01\xf0\x7f\x1c\x33\x03\x60\x78\x0f\x01\xe0\x3c"
-                                      "\x07\x80\xd8\x1b\x03\x70\xc7\xf0\x7c\x00\x01\x4D\x00\x1e\x0e\x00\x0b\x0e\x01\x00"
-                                      "\x3f\x87\xf0\x00\x00\x01\xf0\x7f\x98\x33\x03\xc0\x78\x0d\x81\xb0\x63\xfc\x3e\x00"
-                                      "\x01\x4E\x00\x26\x0e\x00\x0b\x14\x01\x01\x20\xc6\x30\x7c\x00\x00\x00\x3e\x0f\xe3"
-                                      "\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x01\x4F"
-                                      "\x00\x1f\x0e\x00\x0b\x0f\x01\x01\x20\xc6\x30\x7c\x00\x00\x00\x3e\x0f\xf3\x06\x60"
-                                      "\x78\x0f\x01\xb0\x36\x0c\x7f\x87\xc0\x01\x50\x00\x26\x0e\x00\x0b\x14\x01\x01\x0c"
-                                      "\x63\x18\xc2\x00\x00\x00\x3e\x0f\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b"
-                                      "\x03\x60\x6e\x18\xfe\x0f\x80\x01\x51\x00\x1f\x0e\x00\x0b\x0f\x01\x01\x08\x63\x18"
-                                      "\xc6\x00\x00\x00\x3e\x0f\xf3\x06\x60\x78\x0f\x01\xb0\x36\x0c\x7f\x87\xc0\x01\x52"
-                                      "\x00\x21\x0e\x00\x0c\x0f\x01\x00\x1f\xf3\xff\x62\x0c\x20\xc2\x0c\x20\xc3\xe8\x3e"
-                                      "\x82\x0c\x20\xc2\x0c\x20\x62\x07\xff\x1f\xf0\x01\x53\x00\x19\x0e\x00\x0c\x0a\x01"
-                                      "\x00\x39\xc7\xf6\xc6\x3c\x63\x86\x38\x7f\xc6\x0c\x60\xff\x87\x9c\x01\x54\x00\x23"
-                                      "\x0e\x00\x0a\x14\x02\x01\x03\x83\x81\x80\x00\x00\x3f\xcf\xfb\x07\xc0\xf0\x3c\x0f"
-                                      "\x06\xdf\x3e\x0c\xc3\x18\xc3\x30\xec\x1f\x03\x01\x55\x00\x20\x0e\x00\x0b\x10\x01"
-                                      "\x00\x00\x80\x70\x18\x06\x00\x00\x00\x1e\x7b\xdf\x1e\x03\x80\x60\x0c\x01\x80\x30"
-                                      "\x3f\xc7\xf8\x01\x56\x00\x26\x0e\x00\x0a\x16\x02\xf9\xff\x3f\xec\x1f\x03\xc0\xf0"
-                                      "\x3c\x1b\x7c\xf8\x33\x0c\x63\x0c\xc3\xb0\x7c\x0c\x00\x00\x07\x00\xe0\x08\x06\x06"
-                                      "\x00\x01\x57\x00\x22\x0e\x00\x0b\x11\x01\xf9\x79\xef\x7c\x78\x0e\x01\x80\x30\x06"
-                                      "\x00\xc0\xff\x1f\xe0\x00\x00\x03\x80\x38\x01\x00\x60\x30\x00\x01\x58\x00\x25\x0e"
-                                      "\x00\x0a\x15\x02\x00\x00\x98\x61\xf0\x30\x00\x00\x0f\xf3\xfe\xc1\xf0\x3c\x0f\x03"
-                                      "\xc1\xb7\xcf\x83\x30\xc6\x30\xcc\x3b\x07\xc0\xc0\x01\x59\x00\x22\x0e\x00\x0b\x11"
-                                      "\x01\x00\x20\x06\x10\x66\x07\x80\xe0\x00\x00\x03\xcf\x7b\xe3\xc0\x70\x0c\x01\x80"
-                                      "\x30\x06\x07\xf8\xff\x00\x01\x5A\x00\x23\x0e\x00\x0a\x14\x02\x01\x03\x81\x81\xc0"
-                                      "\x00\x00\x0f\xe7\xfb\x00\xc0\x30\x0e\x01\xe0\x1f\x00\xe0\x1c\x03\x00\xe0\x7f\xf9"
-                                      "\xfc\x01\x5B\x00\x1b\x0e\x00\x09\x0f\x02\x01\x03\x83\x07\x00\x00\x01\xfd\xff\x80"
-                                      "\xe0\x3f\x03\xe0\x30\x0f\xff\xfc\x01\x5C\x00\x23\x0e\x00\x0a\x14\x02\x01\x1e\x0c"
-                                      "\xc6\x18\x00\x00\x0f\xe7\xfb\x00\xc0\x30\x0e\x01\xe0\x1f\x00\xe0\x1c\x03\x00\xe0"
-                                      "\x7f\xf9\xfc\x01\x5D\x00\x1e\x0e\x00\x09\x11\x02\x00\x04\x06\x07\x86\x66\x18\x00"
-                                      "\x00\x7f\x7f\xe0\x38\x0f\xc0\xf8\x0c\x03\xff\xff\x00\x01\x5E\x00\x25\x0e\x00\x0a"
-                                      "\x15\x02\xfa\x3f\x9f\xec\x03\x00\xc0\x38\x07\x80\x7c\x03\x80\x70\x0c\x03\x81\xff"
-                                      "\xe7\xf0\x20\x0e\x00\xc0\x10\x1c\x3c\x00\x01\x5F\x00\x1c\x0e\x00\x09\x10\x02\xfa"
-                                      "\x3f\xbf\xf0\x1c\x07\xe0\x7c\x06\x01\xff\xff\x82\x01\x80\x30\x18\x3c\x78\x01\x60"
-                                      "\x00\x23\x0e\x00\x0a\x14\x02\x01\x61\x8c\xc1\xe0\x00\x00\x0f\xe7\xfb\x00\xc0\x30"
-                                      "\x0e\x01\xe0\x1f\x00\xe0\x1c\x03\x00\xe0\x7f\xf9\xfc\x01\x61\x00\x1c\x0e\x00\x09"
-                                      "\x10\x02\x01\x61\x99\x87\x81\x80\x40\x00\xfe\xff\xc0\x70\x1f\x81\xf0\x18\x07\xff"
-                                      "\xfe\x01\x62\x00\x27\x0e\x00\x0b\x15\x01\xfa\xff\xff\xfc\x18\x03\x00\x60\x0c\x01"
-                                      "\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x20\x06\x00\x70\x02\x01\xc1\xe0"
-                                      "\x01\x63\x00\x26\x0e\x00\x0b\x14\x01\xfa\x0c\x01\x80\x30\x06\x0f\xfd\xff\x83\x00"
-                                      "\x60\x0c\x01\x80\x30\x06\x00\xfe\x0f\xc1\x00\x38\x01\x80\x10\x0e\x07\x00\x01\x64"
-                                      "\x00\x27\x0e\x00\x0b\x15\x01\x00\x20\x06\x30\x6c\x07\x00\x00\x00\x3f\xff\xff\x06"
-                                      "\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x01\x65\x00"
-                                      "\x22\x0e\x00\x0b\x11\x01\x00\x00\xc0\x18\x03\x06\x60\xc8\x18\x03\x07\xfe\xff\xc1"
-                                      "\x80\x30\x06\x00\xc0\x18\x03\x00\x7f\x07\xe0\x01\x66\x00\x1f\x0e\x00\x0b\x0f\x01"
-                                      "\x00\xff\xff\xfc\x18\x03\x00\x60\x0c\x01\x81\xfe\x06\x00\xc0\x18\x03\x00\x60\x0c"
-                                      "\x01\x80\x01\x67\x00\x1e\x0e\x00\x0b\x0e\x01\x00\x0c\x01\x80\x30\x06\x0f\xfd\xff"
-                                      "\x83\x00\x60\x7f\x81\x80\x30\x06\x00\xfe\x0f\xc0\x01\x68\x00\x25\x0e\x00\x0a\x15"
-                                      "\x02\x00\x30\x9e\x64\xd3\x1c\x00\x00\x0c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c"
-                                      "\x0f\x03\xc0\xf0\x3e\x19\xfe\x3e\x00\x01\x69\x00\x1c\x0e\x00\x09\x10\x02\x00\x30"
-                                      "\xbc\x53\x48\xe0\x00\x03\x03\x81\xc0\xe0\x70\x38\x1c\x1e\x1f\xfa\xf1\x01\x6A\x00"
-                                      "\x22\x0e\x00\x0a\x13\x02\x00\x7f\x1f\xc0\x00\x00\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c"
-                                      "\x0f\x03\xc0\xf0\x3c\x0f\x03\xe1\x9f\xe3\xe0\x01\x6B\x00\x1a\x0e\x00\x09\x0e\x02"
-                                      "\x00\x7f\xbf\xc0\x00\x0c\x0e\x07\x03\x81\xc0\xe0\x70\x78\x7f\xeb\xc4\x01\x6C\x00"
-                                      "\x23\x0e\x00\x0a\x14\x02\x01\x41\x98\xc3\xe0\x00\x00\x30\x3c\x0f\x03\xc0\xf0\x3c"
-                                      "\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x01\x6D\x00\x1c\x0e\x00\x09\x10"
-                                      "\x02\x00\x40\x30\xcc\xc7\xc0\x00\x03\x03\x81\xc0\xe0\x70\x38\x1c\x1e\x1f\xfa\xf1"
-                                      "\x01\x6E\x00\x25\x0e\x00\x0a\x15\x02\x01\x3f\x18\x46\x10\xfc\x00\x00\x0c\x0f\x03"
-                                      "\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3e\x19\xfe\x3e\x00\x01\x6F\x00"
-                                      "\x1c\x0e\x00\x09\x10\x02\x01\x3e\x10\x88\x47\xc0\x00\x03\x03\x81\xc0\xe0\x70\x38"
-                                      "\x1c\x1e\x1f\xfa\xf1\x01\x70\x00\x23\x0e\x00\x0a\x14\x02\x01\x18\xcc\x66\x10\x00"
-                                      "\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8"
-                                      "\x01\x71\x00\x1c\x0e\x00\x09\x10\x02\x00\x10\x98\xcc\x6c\x60\x00\x03\x03\x81\xc0"
-                                      "\xe0\x70\x38\x1c\x1e\x1f\xfa\xf1\x01\x72\x00\x23\x0e\x00\x0a\x14\x02\xfb\xc0\xf0"
-                                      "\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xe1\x9f\xe3\xe0\x20\x18\x04"
-                                      "\x01\x80\x78\x01\x73\x00\x1d\x0e\x00\x0a\x0f\x02\xfb\xc0\xb0\x2c\x0b\x02\xc0\xb0"
-                                      "\x2c\x1b\x0e\xfe\x9e\x20\x08\x04\x03\x00\xc0\x1c\x01\x74\x00\x27\x0e\x00\x0b\x15"
-                                      "\x01\x00\x04\x01\xe0\x66\x10\x60\x00\x00\x30\x0e\x01\xc0\x78\x8d\x11\xa3\x36\x66"
-                                      "\xdc\xda\x93\x5a\x69\x47\x38\xc7\x18\xe3\x1c\x01\x75\x00\x22\x0e\x00\x0b\x11\x01"
-                                      "\x00\x04\x01\xc0\x6c\x18\xc2\x0c\x00\x00\x06\x01\xc4\x78\x8d\x19\xb7\x36\xa4\xd6"
-                                      "\x8e\x71\x8e\x31\xc0\x01\x76\x00\x27\x0e\x00\x0b\x15\x01\x00\x04\x01\xe0\x66\x10"
-                                      "\x60\x00\x00\x30\x1b\x03\x60\xc6\x18\xe6\x0d\x80\xf0\x1c\x01\x80\x30\x06\x00\xc0"
-                                      "\x18\x03\x00\x60\x01\x77\x00\x29\x0e\x00\x0b\x16\x01\xfb\x06\x01\xc0\x6c\x08\xc2"
-                                      "\x0c\x00\x00\x07\x03\x60\x6c\x18\xc3\x18\xc1\x98\x32\x03\xc0\x78\x0e\x00\xc0\x30"
-                                      "\x06\x0f\x81\xe0\x00\x01\x78\x00\x26\x0e\x00\x0b\x14\x01\x00\x20\x86\x38\xc7\x00"
-                                      "\x00\x01\x80\xd8\x1b\x06\x30\xc7\x30\x6c\x07\x80\xe0\x0c\x01\x80\x30\x06\x00\xc0"
-                                      "\x18\x03\x00\x01\x79\x00\x27\x0e\x00\x0b\x15\x01\x00\x00\x80\x38\x1c\x06\x00\x00"
-                                      "\x00\x1f\xfb\xff\x00\xc0\x30\x0e\x01\x80\x60\x1c\x03\x00\xc0\x18\x06\x01\x80\x3f"
-                                      "\xff\xfe\x01\x7A\x00\x1e\x0e\x00\x0a\x10\x02\x00\x01\x00\xc0\xe0\x60\x00\x00\x0f"
-                                      "\xff\xfe\x03\x01\x80\xc0\x60\x30\x18\x0f\xff\xff\x01\x7B\x00\x26\x0e\x00\x0b\x14"
-                                      "\x01\x00\x06\x01\xc0\x18\x00\x00\x00\xff\xdf\xf8\x06\x01\x80\x70\x0c\x03\x00\xe0"
-                                      "\x18\x06\x00\xc0\x30\x0c\x01\xff\xff\xf0\x01\x7C\x00\x1d\x0e\x00\x0a\x0f\x02\x00"
-                                      "\x0c\x03\x00\xc0\x00\x00\x3f\xff\xf8\x0c\x06\x03\x01\x80\xc0\x60\x3f\xff\xfc\x01"
-                                      "\x7D\x00\x27\x0e\x00\x0b\x15\x01\x00\x20\x06\x38\x6c\x07\x00\x00\x00\x1f\xfb\xff"
-                                      "\x00\xc0\x30\x0e\x01\x80\x60\x1c\x03\x00\xc0\x18\x06\x01\x80\x3f\xff\xfe\x01\x7E"
-                                      "\x00\x20\x0e\x00\x0a\x11\x02\x00\x40\x18\x63\x30\x78\x0c\x00\x00\x03\xff\xff\x80"
-                                      "\xc0\x60\x30\x18\x0c\x06\x03\xff\xff\xc0\x01\x8F\x00\x1f\x0e\x00\x0b\x0f\x01\x00"
-                                      "\x3f\x07\xf0\x03\x00\x30\x06\x00\xff\xff\xff\xc0\x78\x0d\x81\xb0\x36\x0c\x7f\x07"
-                                      "\xc0\x01\xA0\x00\x24\x0e\x00\x0c\x11\x01\x00\x00\x10\x03\x1f\xf3\xf8\x70\xc6\x06"
-                                      "\x60\x6c\x06\xc0\x6c\x06\xc0\x6c\x06\x60\x66\x06\x70\xc3\xf8\x1f\x00\x01\xA1\x00"
-                                      "\x1c\x0e\x00\x0c\x0c\x01\x00\x00\x30\x03\x1f\xe3\xf8\x60\xc6\x06\xc0\x6c\x06\x60"
-                                      "\x66\x0c\x3f\xc1\xf0\x01\xAF\x00\x26\x0e\x00\x0d\x11\x02\x00\x00\x18\x00\xf0\x3d"
-                                      "\x81\x8c\x0c\x60\x63\x03\x18\x18\xc0\xc6\x06\x30\x31\x81\x8c\x0c\x60\x63\x86\x0f"
-                                      "\xf0\x3e\x00\x01\xB0\x00\x1c\x0e\x00\x0c\x0c\x02\x00\x00\x30\x03\xc0\xec\x08\xc0"
-                                      "\x8c\x08\xc0\x8c\x08\xc1\x8c\x38\xfe\x87\x88\x01\xCD\x00\x27\x0e\x00\x0b\x15\x01"
-                                      "\x00\x20\x06\x30\x6c\x07\x00\x00\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1\x18\x63"
-                                      "\x0c\x31\xfe\x7f\xcc\x0d\x81\xe0\x3c\x06\x01\xCE\x00\x22\x0e\x00\x0c\x10\x01\x01"
-                                      "\x20\xc1\x18\x1f\x00\xe0\x04\x00\x00\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc"
-                                      "\x1c\x7f\xe3\xc7\x01\xCF\x00\x1f\x0e\x00\x08\x15\x03\x00\x80\xc6\x6c\x38\x00\x00"
-                                      "\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\xff\x01\xD0\x00\x1c\x0e"
-                                      "\x00\x09\x10\x03\x01\xc3\x33\x0f\x03\x00\x00\x03\xe1\xf0\x18\x0c\x06\x03\x01\x80"
-                                      "\xc3\xff\xff\x01\xD1\x00\x26\x0e\x00\x0b\x14\x01\x01\x30\xc3\x70\x38\x02\x00\x00"
-                                      "\x3e\x0f\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f"
-                                      "\x80\x01\xD2\x00\x20\x0e\x00\x0b\x10\x01\x01\x20\xc3\x30\x3c\x07\x00\x40\x00\x07"
-                                      "\xc1\xfe\x60\xcc\x0f\x01\xe0\x36\x06\xc1\x8f\xf0\xf8\x01\xD3\x00\x23\x0e\x00\x0a"
-                                      "\x14\x02\x01\x61\x8d\xc1\xc0\x20\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0"
-                                      "\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x01\xD4\x00\x1c\x0e\x00\x09\x10\x02\x01\x61\x99"
-                                      "\x87\x83\x80\x80\x03\x03\x81\xc0\xe0\x70\x38\x1c\x1e\x1f\xfa\xf1\x01\xD5\x00\x27"
-                                      "\x0e\x00\x0a\x17\x02\x00\x7f\x1f\xc0\x00\x00\x63\x98\x60\x00\x00\xc0\xf0\x3c\x0f"
-                                      "\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xe1\x9f\xe3\xe0\x01\xD6\x00\x1f\x0e"
-                                      "\x00\x09\x12\x02\x00\x7f\x3f\x80\x00\x06\x3b\x1c\x00\x00\xc0\xe0\x70\x38\x1c\x0e"
-                                      "\x07\x07\x87\xfe\xbc\x40\x01\xD7\x00\x28\x0e\x00\x0a\x18\x02\x00\x01\x81\xc1\xc0"
-                                      "\x00\x00\x18\xe6\x18\x00\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f"
-                                      "\x03\xc0\xf8\x67\xf8\xf8\x01\xD8\x00\x21\x0e\x00\x09\x14\x02\x00\x01\x03\x83\x03"
-                                      "\x00\x00\x01\x8e\xc7\x00\x00\x30\x38\x1c\x0e\x07\x03\x81\xc1\xe1\xff\xaf\x10\x01"
-                                      "\xD9\x00\x28\x0e\x00\x0a\x18\x02\x00\x61\x8d\xc1\xc0\x20\x00\x18\xe6\x18\x00\x00"
-                                      "\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x01"
-                                      "\xDA\x00\x20\x0e\x00\x09\x13\x02\x00\x61\x99\x87\x81\x80\x03\x1d\x8e\x00\x00\x60"
-                                      "\x70\x38\x1c\x0e\x07\x03\x83\xc3\xff\x5e\x20\x01\xDB\x00\x28\x0e\x00\x0a\x18\x02"
-                                      "\x00\x60\x0e\x00\xc0\x00\x00\x18\xe6\x18\x00\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f"
-                                      "\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x01\xDC\x00\x21\x0e\x00\x09\x14\x02"
-                                      "\x00\x60\x38\x07\x00\x80\x00\x01\x8e\xc7\x00\x00\x30\x38\x1c\x0e\x07\x03\x81\xc1"
-                                      "\xe1\xff\xaf\x10\x01\xE6\x00\x26\x0e\x00\x0b\x14\x01\x01\x18\x61\xb0\x1c\x01\x00"
-                                      "\x00\x0f\x87\xf1\x80\x60\x0c\x03\x00\x60\x0c\x3f\x87\xf0\x1b\x03\x60\x6e\x0c\xff"
-                                      "\x87\xf0\x01\xE7\x00\x25\x0e\x00\x0a\x15\x01\xfc\x20\xc4\x61\xf0\x38\x04\x00\x01"
-                                      "\xf4\xff\x60\x58\x1c\x07\x01\xc0\x58\x37\xf4\x79\x00\x40\x30\x0c\xfe\x3f\x00\x01"
-                                      "\xEA\x00\x26\x0e\x00\x0b\x14\x01\xfb\x1f\x07\xf1\xc3\x30\x36\x07\x80\xf0\x1e\x03"
-                                      "\xc0\x78\x0d\x81\xb0\x37\x0c\x7f\x07\xc0\x20\x08\x01\x00\x30\x07\x80\x01\xEB\x00"
-                                      "\x1f\x0e\x00\x0b\x0f\x01\xfb\x1f\x07\xf9\x83\x30\x3c\x07\x80\xd8\x1b\x06\x3f\xc3"
-                                      "\xe0\x10\x04\x00\x80\x18\x03\xc0\x01\xF0\x00\x26\x0e\x00\x0a\x16\x02\xfb\x00\x44"
-                                      "\x31\x98\x3c\x06\x00\x00\x01\xf8\x7e\x01\x80\x60\x18\x06\x01\x80\x60\x18\x06\x01"
-                                      "\x80\x60\x18\xfe\x3e\x00\x01\xF8\x00\x23\x0e\x00\x0a\x14\x02\x01\x60\x0e\x00\xe0"
-                                      "\x00\x00\x38\x3e\x0f\xc3\xf0\xf4\x3d\x8f\x63\xcc\xf3\x3c\x6f\x1b\xc3\xf0\xfc\x1f"
-                                      "\x07\x01\xF9\x00\x1b\x0e\x00\x09\x0f\x02\x01\x70\x0c\x03\x80\x00\x06\x7b\x7f\xe3"
-                                      "\xe0\xe0\x70\x38\x1c\x0e\x07\x02\x02\x18\x00\x26\x0e\x00\x0a\x16\x02\xf9\x3f\x9f"
-                                      "\xec\x03\x00\xc0\x38\x07\x80\x7c\x03\x80\x70\x0c\x03\x81\xff\xe7\xf0\x00\x00\x06"
-                                      "\x00\xe0\x18\x06\x0e\x00\x02\x19\x00\x1e\x0e\x00\x09\x11\x02\xf9\x3f\xbf\xf0\x1c"
-                                      "\x07\xe0\x7c\x06\x01\xff\xff\x80\x00\x03\x80\x70\x18\x1c\x38\x00\x02\x1A\x00\x29"
-                                      "\x0e\x00\x0b\x16\x01\xf9\xff\xff\xfc\x18\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0"
-                                      "\x18\x03\x00\x60\x0c\x01\x80\x00\x00\x01\x80\x1c\x01\x80\x30\x38\x00\x02\x1B\x00"
-                                      "\x27\x0e\x00\x0b\x15\x01\xf9\x0c\x01\x80\x30\x06\x0f\xfd\xff\x83\x00\x60\x0c\x01"
-                                      "\x80\x30\x06\x00\xfe\x0f\xc0\x00\x00\x0e\x00\x60\x06\x01\x80\xe0\x02\x26\x00\x26"
-                                      "\x0e\x00\x0b\x14\x01\x00\x06\x01\xc0\x18\x00\x00\x00\x1c\x03\x80\x78\x1b\x03\x60"
-                                      "\x66\x08\xc3\x18\x61\x8f\xf3\xfe\x60\x6c\x0f\x01\xe0\x30\x02\x27\x00\x21\x0e\x00"
-                                      "\x0c\x0f\x01\x00\x04\x00\xe0\x06\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70"
-                                      "\xc4\x0c\xc1\xc7\xfe\x3c\x70\x02\x2E\x00\x26\x0e\x00\x0b\x14\x01\x00\x06\x01\xc0"
-                                      "\x18\x00\x00\x00\x3e\x0f\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60"
-                                      "\x6e\x18\xfe\x0f\x80\x02\x2F\x00\x1f\x0e\x00\x0b\x0f\x01\x00\x04\x01\xc0\x18\x00"
-                                      "\x00\x00\x3e\x0f\xf3\x06\x60\x78\x0f\x01\xb0\x36\x0c\x7f\x87\xc0\x02\x32\x00\x25"
-                                      "\x0e\x00\x0b\x13\x01\x00\x3f\x87\xf0\x00\x00\x0c\x06\xc0\xd8\x31\x86\x39\x83\x60"
-                                      "\x3c\x07\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x18\x00\x02\x33\x00\x25\x0e\x00\x0b"
-                                      "\x13\x01\xfb\x3f\xc7\xf8\x00\x00\x0e\x06\xc0\xd8\x31\x86\x31\x83\x30\x64\x07\x80"
-                                      "\xf0\x1c\x01\x80\x60\x0c\x1f\x03\xc0\x00\x02\x37\x00\x18\x0e\x00\x07\x0f\x02\xfb"
-                                      "\x7e\xfc\x18\x30\x60\xc1\x83\x06\x0c\x18\x30\x7f\xfe\x00\x02\x59\x00\x17\x0e\x00"
-                                      "\x0a\x0a\x02\x00\x3e\x0f\xe0\x18\x03\x00\xff\xfc\x0f\x06\x7f\x0f\x80\x02\xB9\x00"
-                                      "\x0d\x0e\x00\x03\x07\x05\x09\xfd\xb6\xd8\x02\xBA\x00\x11\x0e\x00\x08\x07\x03\x09"
-                                      "\xc7\xc7\xc7\xc3\xc3\xc3\xc3\x02\xBB\x00\x0e\x0e\x00\x05\x06\x04\x0a\x19\xdc\xe6"
-                                      "\x70\x02\xBC\x00\x0e\x0e\x00\x05\x06\x04\x0a\x39\xce\xe6\x60\x02\xBE\x00\x10\x0e"
-                                      "\x00\x05\x09\x04\x07\xe7\x86\x30\x8c\x7e\xe0\x02\xBF\x00\x11\x0e\x00\x06\x09\x03"
-                                      "\x07\x1c\xf6\x30\xc3\x06\x0f\x1c\x02\xC6\x00\x0f\x0e\x00\x07\x05\x03\x0c\x18\x79"
-                                      "\xb6\x18\x20\x02\xC7\x00\x0f\x0e\x00\x07\x05\x03\x0c\x83\x85\xb1\xe1\x80\x02\xC8"
-                                      "\x00\x0d\x0e\x00\x02\x09\x06\x07\xff\xff\xc0\x02\xCC\x00\x0d\x0e\x00\x02\x09\x06"
-                                      "\xfb\xff\xff\xc0\x02\xCD\x00\x0b\x0e\x00\x07\x01\x03\xfc\xfe\x02\xD8\x00\x0e\x0e"
-                                      "\x00\x08\x04\x03\x0c\x83\xc2\x6e\x3c\x02\xD9\x00\x0c\x0e\x00\x03\x03\x05\x0c\x5d"
-                                      "\x80\x02\xDA\x00\x0e\x0e\x00\x06\x05\x04\x0c\x7a\x38\x63\x78\x02\xDB\x00\x0e\x0e"
-                                      "\x00\x05\x05\x04\xfb\x22\x11\x87\x80\x02\xDC\x00\x0f\x0e\x00\x09\x04\x02\x0c\x30"
-                                      "\xbc\xd3\xd8\xe0\x02\xDD\x00\x0e\x0e\x00\x08\x04\x03\x0c\x21\x63\x42\x84\x03\x00"
-                                      "\x00\x0d\x00\x00\x05\x04\xfd\x0c\x87\x0c\x30\x03\x01\x00\x0d\x00\x00\x05\x04\xfe"
-                                      "\x0c\x09\xd9\x80\x03\x02\x00\x0f\x00\x00\x08\x05\xfc\x0c\x18\x3c\x66\xc3\x81\x03"
-                                      "\x03\x00\x0e\x00\x00\x08\x04\xfc\x0c\x61\xf1\x9f\x86\x03\x04\x00\x0b\x00\x00\x08"
-                                      "\x01\xfc\x0d\xff\x03\x06\x00\x0e\x00\x00\x08\x04\xfc\x0c\x81\xc3\x66\x3c\x03\x07"
-                                      "\x00\x0b\x00\x00\x02\x03\xff\x0c\xfc\x03\x08\x00\x0c\x00\x00\x08\x02\xfc\x0c\xe7"
-                                      "\xe7\x03\x09\x00\x0d\x00\x00\x04\x05\xfe\x0c\xe7\x13\xc0\x03\x0A\x00\x0e\x00\x00"
-                                      "\x06\x05\xfd\x0c\x7b\x38\x73\x78\x03\x0B\x00\x0e\x00\x00\x08\x04\xfc\x0c\x21\x63"
-                                      "\x42\xc6\x03\x0C\x00\x0f\x00\x00\x08\x05\xfc\x0c\x81\xc3\x66\x3c\x18\x03\x12\x00"
-                                      "\x0d\x00\x00\x04\x05\xfe\x0c\x3c\x8e\x70\x03\x15\x00\x0c\x00\x00\x02\x05\x00\x0b"
-                                      "\xfe\x80\x03\x23\x00\x0b\x00\x00\x02\x03\xff\xfb\xfc\x03\x24\x00\x0c\x00\x00\x08"
-                                      "\x02\xfc\xfc\xe3\xe7\x03\x26\x00\x0d\x00\x00\x04\x05\xfe\xf9\xe7\x13\xc0\x03\x27"
-                                      "\x00\x0e\x00\x00\x05\x06\xfe\xfa\x62\x1e\x13\xf0\x03\x28\x00\x0d\x00\x00\x04\x05"
-                                      "\xfe\xfb\x44\x8c\xf0\x03\x2D\x00\x0f\x00\x00\x08\x05\xfc\xf9\x18\x3c\x66\xc3\x81"
-                                      "\x03\x2E\x00\x0e\x00\x00\x08\x04\xfc\xfa\x81\xc3\x66\x3c\x03\x31\x00\x0b\x00\x00"
-                                      "\x08\x01\xfc\xfc\xff\x0E\x3F\x00\x25\x0e\x00\x0a\x15\x02\xfd\x0c\x03\x00\xc3\xfc"
-                                      "\xcb\xf2\x3c\x8f\x23\xc8\xf3\xcf\xe3\x26\xc8\xf2\x3c\x8f\x23\xcb\xff\xc0\xc0\x30"
-                                      "\x0c\x00\x1E\x06\x00\x22\x0e\x00\x0a\x13\x02\xfc\xff\x31\xec\x1f\x03\xc0\xf0\x6c"
-                                      "\x73\xf8\xc1\xb0\x3c\x0f\x03\xc0\xf0\xff\xf0\x00\x00\x00\x07\xf0\x1E\x07\x00\x23"
-                                      "\x0e\x00\x0a\x14\x02\xfc\xc0\x30\x0c\x03\x00\xc0\x30\x0c\xf3\xfe\xe1\xf0\x3c\x0f"
-                                      "\x03\xc0\xf0\x7f\xfa\xf8\x00\x00\x00\x01\xfc\x1E\x0C\x00\x23\x0e\x00\x0a\x14\x02"
-                                      "\xfb\xfc\x3f\xcc\x3b\x07\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x06\xc3\xbf\x8f\x80"
-                                      "\x00\x00\x06\x01\x80\x60\x1E\x0D\x00\x25\x0e\x00\x0a\x15\x01\xfb\x00\x40\x10\x04"
-                                      "\x01\x00\x40\x11\xf4\xff\x60\xd8\x1c\x07\x01\xc0\x58\x37\xf4\x79\x00\x00\x00\x60"
-                                      "\x18\x04\x00\x1E\x0E\x00\x22\x0e\x00\x0a\x13\x02\xfc\xfc\x3f\xcc\x3b\x07\xc0\xf0"
-                                      "\x3c\x0f\x03\xc0\xf0\x3c\x0f\x06\xc3\xbf\x8f\x80\x00\x00\x00\x0f\xf0\x1E\x0F\x00"
-                                      "\x23\x0e\x00\x0a\x14\x01\xfc\x00\x40\x10\x04\x01\x00\x40\x11\xf4\xff\x60\xd8\x1c"
-                                      "\x07\x01\xc0\x58\x37\xf4\x79\x00\x00\x00\x00\xff\x1E\x12\x00\x26\x0e\x00\x0a\x16"
-                                      "\x02\xf9\xfc\x3f\xcc\x3b\x07\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x06\xc3\xbf\x8f"
-                                      "\x80\x00\x00\x06\x03\xc1\x98\x43\x20\x40\x1E\x13\x00\x27\x0e\x00\x0a\x17\x01\xf9"
-                                      "\x00\x40\x10\x04\x01\x00\x40\x11\xf4\xff\x60\xd8\x1c\x07\x01\xc0\x58\x37\xf4\x79"
-                                      "\x00\x00\x00\x60\x3c\x19\x8c\x22\x04\x1E\x20\x00\x25\x0e\x00\x0b\x13\x01\x00\x1f"
-                                      "\xc3\xf8\x00\x00\x00\x7c\x3f\x8c\x03\x00\x60\x18\x03\x00\x61\xfc\x3f\x80\xd8\x1b"
-                                      "\x03\x70\x67\xfc\x3f\x80\x1E\x21\x00\x22\x0e\x00\x0a\x13\x01\xfb\x3f\x8f\xe0\x00"
-                                      "\x00\x1f\x4f\xf6\x05\x81\xc0\x70\x1c\x05\x83\x7f\x47\x90\x04\x03\x00\xcf\xe3\xf0"
-                                      "\x1E\x24\x00\x21\x0e\x00\x09\x14\x02\xfb\xc0\xe0\x70\x38\x1c\x0e\x07\xff\xff\xc0"
-                                      "\xe0\x70\x38\x1c\x0e\x07\x02\x00\x00\x06\x07\x01\x00\x1E\x25\x00\x22\x0e\x00\x09"
-                                      "\x15\x02\xfb\xc0\x60\x30\x18\x0c\x06\x03\x3d\xbf\xf1\xf0\x70\x38\x1c\x0e\x07\x03"
-                                      "\x81\x00\x00\x03\x01\x80\x80\x1E\x28\x00\x25\x0e\x00\x0a\x15\x01\xfa\x60\x58\x16"
-                                      "\x05\x81\x60\x58\x17\xfd\xff\x60\x58\x16\x05\x81\x60\x58\x16\x05\x00\x60\x0e\x00"
-                                      "\x80\xe0\xe0\x00\x1E\x29\x00\x26\x0e\x00\x0a\x16\x01\xfa\x60\x18\x06\x01\x80\x60"
-                                      "\x18\x06\x79\xbf\x78\xdc\x16\x05\x81\x60\x58\x16\x05\x81\x40\x18\x03\x80\x20\x38"
-                                      "\x38\x00\x1E\x2A\x00\x22\x0e\x00\x09\x15\x02\xfa\xc0\xe0\x70\x38\x1c\x0e\x07\xff"
-                                      "\xff\xc0\xe0\x70\x38\x1c\x0e\x07\x02\x00\x00\x20\xd8\x46\x61\xe0\x1E\x2B\x00\x23"
-                                      "\x0e\x00\x09\x16\x02\xfa\xc0\x60\x30\x18\x0c\x06\x03\x3d\xbf\xf1\xf0\x70\x38\x1c"
-                                      "\x0e\x07\x03\x81\x00\x00\x10\x2c\x33\x30\xf0\x1E\x32\x00\x26\x0e\x00\x0b\x14\x02"
-                                      "\xfb\xc0\xd8\x33\x0e\x63\x8c\xe1\x98\x36\x07\x80\xd8\x19\x83\x18\x63\x8c\x39\x83"
-                                      "\xb0\x38\x00\x00\x01\x80\x30\x06\x00\x1E\x33\x00\x25\x0e\x00\x0a\x15\x02\xfb\xc0"
-                                      "\x30\x0c\x03\x00\xc0\x30\x0c\x1f\x0c\xc6\x37\x0f\x83\x60\xcc\x31\x8c\x3b\x07\x00"
-                                      "\x00\x00\xc0\x70\x08\x00\x1E\x34\x00\x25\x0e\x00\x0b\x13\x02\xfc\xc0\xd8\x33\x0e"
-                                      "\x63\x8c\xe1\x98\x36\x07\x80\xd8\x19\x83\x18\x63\x8c\x39\x83\xb0\x38\x00\x00\x00"
-                                      "\x01\xfe\x00\x1E\x35\x00\x23\x0e\x00\x0a\x14\x02\xfc\xc0\x30\x0c\x03\x00\xc0\x30"
-                                      "\x0c\x1f\x0c\xc6\x37\x0f\x83\x60\xcc\x31\x8c\x3b\x07\x00\x00\x00\x01\xfc\x1E\x36"
-                                      "\x00\x23\x0e\x00\x0a\x14\x02\xfb\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30"
-                                      "\x0c\x03\x00\xc0\x3f\xff\xfc\x00\x00\x03\x00\xe0\x10\x1E\x37\x00\x27\x0e\x00\x0b"
-                                      "\x15\x01\xfb\xfc\x1f\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x30\x06\x00"
-                                      "\xc0\x1c\x01\xf8\x1f\x00\x00\x00\x18\x07\x00\x40\x1E\x38\x00\x2e\x0e\x00\x0c\x18"
-                                      "\x00\xfb\xfe\x0f\xe0\x00\x00\x00\x30\x03\x00\x30\x03\x00\x30\x03\x00\x30\x03\x00"
-                                      "\x30\x03\x00\x30\x03\x00\x30\x03\xff\x3f\xf0\x00\x00\x00\x30\x03\x80\x10\x1E\x39"
-                                      "\x00\x2d\x0e\x00\x0b\x19\x01\xfb\x7f\x80\x00\x00\x00\x0f\xc1\xf8\x03\x00\x60\x0c"
-                                      "\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\xc0\x1f\x81\xf0\x00\x00\x01\x80"
-                                      "\x70\x04\x00\x1E\x3A\x00\x22\x0e\x00\x0a\x13\x02\xfc\xc0\x30\x0c\x03\x00\xc0\x30"
-                                      "\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x00\x00\x00\x03\xf8\x1E\x3B\x00"
-                                      "\x26\x0e\x00\x0b\x14\x01\xfc\xfc\x1f\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01"
-                                      "\x80\x30\x06\x00\xc0\x1c\x01\xf8\x1f\x00\x00\x00\x00\x1f\xc0\x1E\x3C\x00\x26\x0e"
-                                      "\x00\x0a\x16\x02\xf9\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00"
-                                      "\xc0\x3f\xff\xfc\x00\x00\x03\x01\xe0\x6c\x31\x88\x20\x1E\x3D\x00\x2a\x0e\x00\x0b"
-                                      "\x17\x01\xf9\xfc\x1f\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x30\x06\x00"
-                                      "\xc0\x1c\x01\xf8\x1f\x00\x00\x00\x18\x07\x01\xb0\x63\x08\x20\x1E\x3E\x00\x26\x0e"
-                                      "\x00\x0b\x14\x01\x01\x01\x80\x60\x30\x00\x00\x00\xc1\xdc\x3b\x87\x71\xeb\x2d\x25"
-                                      "\xa5\xb4\xe6\x8c\xd1\x1a\x23\xc0\x78\x0f\x01\xe0\x30\x1E\x3F\x00\x1f\x0e\x00\x0b"
-                                      "\x0f\x01\x01\x01\x80\xe0\x30\x00\x00\x01\x99\xf7\xff\x39\xc6\x38\xc7\x18\xe3\x1c"
-                                      "\x63\x8c\x71\x88\x1E\x40\x00\x26\x0e\x00\x0b\x14\x01\x00\x06\x01\xc0\x18\x00\x00"
-                                      "\x00\xc1\xdc\x3b\x87\x71\xeb\x2d\x25\xa5\xb4\xe6\x8c\xd1\x1a\x23\xc0\x78\x0f\x01"
-                                      "\xe0\x30\x1E\x41\x00\x1f\x0e\x00\x0b\x0f\x01\x00\x04\x01\xc0\x18\x00\x00\x01\x99"
-                                      "\xf7\xff\x39\xc6\x38\xc7\x18\xe3\x1c\x63\x8c\x71\x88\x1E\x42\x00\x26\x0e\x00\x0b"
-                                      "\x14\x01\xfb\x60\xee\x1d\xc3\xb8\xf5\x96\x92\xd2\xda\x73\x46\x68\x8d\x11\xe0\x3c"
-                                      "\x07\x80\xf0\x18\x00\x00\x00\xc0\x38\x02\x00\x1E\x43\x00\x1f\x0e\x00\x0b\x0f\x01"
-                                      "\xfb\xcc\xfb\xff\x9c\xe3\x1c\x63\x8c\x71\x8e\x31\xc6\x38\xc4\x00\x00\x00\x60\x1c"
-                                      "\x01\x00\x1E\x44\x00\x23\x0e\x00\x0a\x14\x02\x00\x0c\x07\x00\xc0\x00\x00\x38\x3e"
-                                      "\x0f\xc3\xf0\xf4\x3d\x8f\x63\xcc\xf3\x3c\x6f\x1b\xc3\xf0\xfc\x1f\x07\x1E\x45\x00"
-                                      "\x1b\x0e\x00\x09\x0f\x02\x00\x08\x0e\x03\x00\x00\x06\x7b\x7f\xe3\xe0\xe0\x70\x38"
-                                      "\x1c\x0e\x07\x02\x1E\x46\x00\x23\x0e\x00\x0a\x14\x02\xfb\xe0\xf8\x3f\x0f\xc3\xd0"
-                                      "\xf6\x3d\x8f\x33\xcc\xf1\xbc\x6f\x0f\xc3\xf0\x7c\x1c\x00\x00\x03\x01\xc0\x20\x1E"
-                                      "\x47\x00\x1b\x0e\x00\x09\x0f\x02\xfb\xcf\x6f\xfc\x7c\x1c\x0e\x07\x03\x81\xc0\xe0"
-                                      "\x40\x00\x00\xc0\x60\x20\x1E\x48\x00\x22\x0e\x00\x0a\x13\x02\xfc\xe0\xf8\x3f\x0f"
-                                      "\xc3\xd0\xf6\x3d\x8f\x33\xcc\xf1\xbc\x6f\x0f\xc3\xf0\x7c\x1c\x00\x00\x00\x07\xf0"
-                                      "\x1E\x49\x00\x1a\x0e\x00\x09\x0e\x02\xfc\xcf\x6f\xfc\x7c\x1c\x0e\x07\x03\x81\xc0"
-                                      "\xe0\x40\x00\x00\x03\xfc\x1E\x4A\x00\x26\x0e\x00\x0a\x16\x02\xf9\xe0\xf8\x3f\x0f"
-                                      "\xc3\xd0\xf6\x3d\x8f\x33\xcc\xf1\xbc\x6f\x0f\xc3\xf0\x7c\x1c\x00\x00\x03\x01\xe0"
-                                      "\xc8\x61\x10\x20\x1E\x4B\x00\x1e\x0e\x00\x09\x11\x02\xf9\xcf\x6f\xfc\x7c\x1c\x0e"
-                                      "\x07\x03\x81\xc0\xe0\x40\x00\x00\xc0\xf0\xcc\xc2\x40\x80\x1E\x58\x00\x23\x0e\x00"
-                                      "\x0a\x14\x02\x00\x0c\x03\x80\xc0\x00\x00\x3f\xcf\xfb\x07\xc0\xf0\x3c\x0f\x06\xdf"
-                                      "\x3e\x0c\xc3\x18\xc3\x30\xec\x1f\x03\x1E\x59\x00\x1f\x0e\x00\x0b\x0f\x01\x00\x04"
-                                      "\x01\xc0\x38\x00\x00\x00\xf3\xde\xf8\xf0\x1c\x03\x00\x60\x0c\x01\x81\xfe\x3f\xc0"
-                                      "\x1E\x5A\x00\x23\x0e\x00\x0a\x14\x02\xfb\xff\x3f\xec\x1f\x03\xc0\xf0\x3c\x1b\x7c"
-                                      "\xf8\x33\x0c\x63\x0c\xc3\xb0\x7c\x0c\x00\x00\x03\x00\xc0\x30\x1E\x5B\x00\x1f\x0e"
-                                      "\x00\x0b\x0f\x01\xfb\x79\xef\x7c\x78\x0e\x01\x80\x30\x06\x00\xc0\xff\x1f\xe0\x00"
-                                      "\x00\x01\x80\x30\x06\x00\x1E\x5C\x00\x27\x0e\x00\x0a\x17\x02\xfb\x7f\x80\x00\x03"
-                                      "\xfc\xff\xb0\x7c\x0f\x03\xc0\xf0\x6d\xf3\xe0\xcc\x31\x8c\x33\x0e\xc1\xf0\x30\x00"
-                                      "\x00\x0c\x03\x00\xc0\x1E\x5D\x00\x25\x0e\x00\x0b\x13\x01\xfb\x3f\x87\xf0\x00\x00"
-                                      "\x07\x9e\xf7\xc7\x80\xe0\x18\x03\x00\x60\x0c\x0f\xf1\xfe\x00\x00\x00\x18\x03\x00"
-                                      "\x60\x00\x1E\x5E\x00\x22\x0e\x00\x0a\x13\x02\xfc\xff\x3f\xec\x1f\x03\xc0\xf0\x3c"
-                                      "\x1b\x7c\xf8\x33\x0c\x63\x0c\xc3\xb0\x7c\x0c\x00\x00\x00\x07\xf8\x1E\x5F\x00\x1e"
-                                      "\x0e\x00\x0b\x0e\x01\xfc\x79\xef\x7c\x78\x0e\x01\x80\x30\x06\x00\xc0\xff\x1f\xe0"
-                                      "\x00\x00\x00\x01\xfe\x00\x1E\x62\x00\x23\x0e\x00\x0a\x14\x02\xfb\x3f\x9f\xec\x03"
-                                      "\x00\xc0\x38\x07\x80\x7c\x03\x80\x70\x0c\x03\x81\xff\xe7\xf0\x00\x00\x03\x01\xc0"
-                                      "\x20\x1E\x63\x00\x1b\x0e\x00\x09\x0f\x02\xfb\x3f\xbf\xf0\x1c\x07\xe0\x7c\x06\x01"
-                                      "\xff\xff\x80\x00\x01\xc0\xe0\x20\x1E\x6C\x00\x26\x0e\x00\x0b\x14\x01\xfb\xff\xff"
-                                      "\xfc\x18\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x00"
-                                      "\x00\x00\xc0\x38\x02\x00\x1E\x6D\x00\x25\x0e\x00\x0b\x13\x01\xfb\x0c\x01\x80\x30"
-                                      "\x06\x0f\xfd\xff\x83\x00\x60\x0c\x01\x80\x30\x06\x00\xfe\x0f\xc0\x00\x00\x06\x00"
-                                      "\xe0\x08\x00\x1E\x6E\x00\x25\x0e\x00\x0b\x13\x01\xfc\xff\xff\xfc\x18\x03\x00\x60"
-                                      "\x0c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x00\x00\x00\x00\xfe\x00"
-                                      "\x1E\x6F\x00\x23\x0e\x00\x0b\x12\x01\xfc\x0c\x01\x80\x30\x06\x0f\xfd\xff\x83\x00"
-                                      "\x60\x0c\x01\x80\x30\x06\x00\xfe\x0f\xc0\x00\x00\x00\x03\xf8\x1E\x70\x00\x29\x0e"
-                                      "\x00\x0b\x16\x01\xf9\xff\xff\xfc\x18\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x18"
-                                      "\x03\x00\x60\x0c\x01\x80\x00\x00\x00\xc0\x3c\x0d\x83\x08\x41\x00\x1E\x71\x00\x27"
-                                      "\x0e\x00\x0b\x15\x01\xf9\x0c\x01\x80\x30\x06\x0f\xfd\xff\x83\x00\x60\x0c\x01\x80"
-                                      "\x30\x06\x00\xfe\x0f\xc0\x00\x00\x06\x01\xe0\x26\x08\x62\x04\x1E\x7E\x00\x26\x0e"
-                                      "\x00\x0b\x14\x01\xfb\xc0\x38\x0d\x81\xb0\x36\x0c\x61\x8c\x31\x8c\x11\x83\x30\x64"
-                                      "\x05\x80\xf0\x1c\x03\x80\x00\x00\x00\xc0\x38\x02\x00\x1E\x7F\x00\x1f\x0e\x00\x0b"
-                                      "\x0f\x01\xfb\xe0\x6c\x0d\x83\x18\x63\x18\x33\x06\x40\x58\x0f\x01\xc0\x00\x00\x00"
-                                      "\x60\x1c\x01\x00\x1E\x80\x00\x26\x0e\x00\x0b\x14\x01\x01\x30\x03\x80\x1c\x00\x00"
-                                      "\x01\x80\x70\x0e\x03\xc4\x68\x8d\x19\xb3\x36\xe6\xd4\x9a\xd3\x4a\x39\xc6\x38\xc7"
-                                      "\x18\xe0\x1E\x81\x00\x1f\x0e\x00\x0b\x0f\x01\x01\x38\x01\x80\x1c\x00\x00\x01\x80"
-                                      "\x71\x1e\x23\x46\x6d\xcd\xa9\x35\xa3\x9c\x63\x8c\x70\x1E\x82\x00\x26\x0e\x00\x0b"
-                                      "\x14\x01\x01\x01\x80\x60\x30\x00\x00\x01\x80\x70\x0e\x03\xc4\x68\x8d\x19\xb3\x36"
-                                      "\xe6\xd4\x9a\xd3\x4a\x39\xc6\x38\xc7\x18\xe0\x1E\x83\x00\x1f\x0e\x00\x0b\x0f\x01"
-                                      "\x01\x01\x80\xe0\x30\x04\x00\x01\x80\x71\x1e\x23\x46\x6d\xcd\xa9\x35\xa3\x9c\x63"
-                                      "\x8c\x70\x1E\x84\x00\x26\x0e\x00\x0b\x14\x01\x00\x20\x86\x38\xc7\x00\x00\x01\x80"
-                                      "\x70\x0e\x03\xc4\x68\x8d\x19\xb3\x36\xe6\xd4\x9a\xd3\x4a\x39\xc6\x38\xc7\x18\xe0"
-                                      "\x1E\x85\x00\x1e\x0e\x00\x0b\x0e\x01\x00\x31\xc6\x30\x00\x00\x0c\x03\x88\xf1\x1a"
-                                      "\x33\x6e\x6d\x49\xad\x1c\xe3\x1c\x63\x80\x1E\x8C\x00\x26\x0e\x00\x0b\x14\x01\x00"
-                                      "\x20\x86\x38\xc7\x00\x00\x00\xc0\xd8\x31\x86\x31\x83\x60\x3c\x07\x00\x60\x1e\x06"
-                                      "\xc0\xcc\x31\x86\x19\x83\xe0\x30\x1E\x8D\x00\x1c\x0e\x00\x0a\x0e\x02\x00\x63\x98"
-                                      "\xc0\x00\x00\xc1\x98\xe3\x30\x78\x1c\x07\x03\x61\x8c\x61\xb0\x70\x1E\x8E\x00\x26"
-                                      "\x0e\x00\x0b\x14\x01\x00\x06\x01\xc0\x18\x00\x00\x01\x80\xd8\x1b\x06\x30\xc7\x30"
-                                      "\x6c\x07\x80\xe0\x0c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x1E\x8F\x00\x26\x0e\x00"
-                                      "\x0b\x14\x01\xfb\x04\x00\xc0\x18\x00\x00\x01\xc0\xd8\x1b\x06\x30\xc6\x30\x66\x0c"
-                                      "\x80\xf0\x1e\x03\x80\x30\x0c\x01\x83\xe0\x78\x00\x1E\x90\x00\x27\x0e\x00\x0b\x15"
-                                      "\x01\x00\x06\x01\xe0\x66\x10\x60\x00\x00\x1f\xfb\xff\x00\xc0\x30\x0e\x01\x80\x60"
-                                      "\x1c\x03\x00\xc0\x18\x06\x01\x80\x3f\xff\xfe\x1E\x91\x00\x20\x0e\x00\x0a\x11\x02"
-                                      "\x00\x0c\x07\x83\x60\x8c\x41\x80\x00\x03\xff\xff\x80\xc0\x60\x30\x18\x0c\x06\x03"
-                                      "\xff\xff\xc0\x1E\x92\x00\x26\x0e\x00\x0b\x14\x01\xfb\x7f\xef\xfc\x03\x00\xc0\x38"
-                                      "\x06\x01\x80\x70\x0c\x03\x00\x60\x18\x06\x00\xff\xff\xf8\x00\x00\x00\xc0\x38\x02"
-                                      "\x00\x1E\x93\x00\x1d\x0e\x00\x0a\x0f\x02\xfb\xff\xff\xe0\x30\x18\x0c\x06\x03\x01"
-                                      "\x80\xff\xff\xf0\x00\x00\x0c\x03\x00\xc0\x1E\x94\x00\x25\x0e\x00\x0b\x13\x01\xfc"
-                                      "\x7f\xef\xfc\x03\x00\xc0\x38\x06\x01\x80\x70\x0c\x03\x00\x60\x18\x06\x00\xff\xff"
-                                      "\xf8\x00\x00\x00\x00\xfe\x00\x1E\x95\x00\x1c\x0e\x00\x0a\x0e\x02\xfc\xff\xff\xe0"
-                                      "\x30\x18\x0c\x06\x03\x01\x80\xff\xff\xf0\x00\x00\x00\x1f\xe0\x1E\x96\x00\x21\x0e"
-                                      "\x00\x09\x14\x02\xfc\xc0\x60\x30\x18\x0c\x06\x03\x3d\xbf\xf1\xf0\x70\x38\x1c\x0e"
-                                      "\x07\x03\x81\x00\x00\x00\x0f\xf0\x1E\x9E\x00\x1f\x0e\x00\x0b\x0f\x02\x00\x3e\x0f"
-                                      "\xf1\x83\x60\xcc\x19\x86\x30\x86\x38\xc3\x98\x1b\x03\x60\x3c\x05\x8f\xb1\xe0\x1E"
-                                      "\xA0\x00\x26\x0e\x00\x0b\x14\x01\xfb\x0e\x01\xc0\x3c\x0d\x81\xb0\x33\x04\x61\x8c"
-                                      "\x30\xc7\xf9\xff\x30\x36\x07\x80\xf0\x18\x00\x00\x00\xc0\x38\x02\x00\x1E\xA1\x00"
-                                      "\x21\x0e\x00\x0c\x0f\x01\xfb\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f"
-                                      "\xe3\xc7\x00\x00\x00\x0e\x00\xe0\x04\x00\x1E\xA2\x00\x27\x0e\x00\x0b\x15\x01\x00"
-                                      "\x0c\x00\xf0\x06\x07\x80\x00\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1\x18\x63\x0c"
-                                      "\x31\xfe\x7f\xcc\x0d\x81\xe0\x3c\x06\x1E\xA3\x00\x22\x0e\x00\x0c\x10\x01\x01\x1e"
-                                      "\x00\x30\x03\x00\xe0\x00\x00\x00\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c"
-                                      "\x7f\xe3\xc7\x1E\xA4\x00\x2d\x0e\x00\x0c\x17\x01\x01\x00\x70\x0c\x04\x00\xe0\x1b"
-                                      "\x83\x0c\x00\x00\x00\x0e\x00\xe0\x0f\x01\xb0\x1b\x01\x98\x11\x83\x18\x30\xc3\xfc"
-                                      "\x7f\xc6\x06\x60\x6c\x06\xc0\x60\x1E\xA5\x00\x25\x0e\x00\x0c\x12\x01\x01\x00\x30"
-                                      "\x0c\x04\x00\xe0\x1b\x03\x0c\x00\x00\x00\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40"
-                                      "\xcc\x1c\x7f\xe3\xc7\x1E\xA6\x00\x2a\x0e\x00\x0b\x17\x01\x01\x01\x80\x1c\x10\x07"
-                                      "\x01\xb8\x61\x80\x00\x00\x0e\x01\xc0\x3c\x0d\x81\xb0\x33\x04\x61\x8c\x30\xc7\xf9"
-                                      "\xff\x30\x36\x07\x80\xf0\x18\x1E\xA7\x00\x25\x0e\x00\x0c\x12\x01\x01\x01\x80\x1c"
-                                      "\x04\x60\xe0\x1b\x03\x0c\x00\x00\x00\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc"
-                                      "\x1c\x7f\xe3\xc7\x1E\xA8\x00\x2e\x0e\x00\x0c\x18\x01\x01\x01\xe0\x03\x00\xe0\x40"
-                                      "\x0e\x01\xb8\x30\xc0\x00\x00\x00\xe0\x0e\x00\xf0\x1b\x01\xb0\x19\x81\x18\x31\x83"
-                                      "\x0c\x3f\xc7\xfc\x60\x66\x06\xc0\x6c\x06\x1E\xA9\x00\x27\x0e\x00\x0c\x13\x01\x01"
-                                      "\x01\xf0\x01\x00\xe0\x40\x0e\x01\xb0\x30\xc0\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3"
-                                      "\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x1E\xAA\x00\x2d\x0e\x00\x0b\x19\x01\x00\x00"
-                                      "\x43\x98\xce\x00\x00\x40\x1c\x06\xe1\x86\x00\x00\x00\x38\x07\x00\xf0\x36\x06\xc0"
-                                      "\xcc\x11\x86\x30\xc3\x1f\xe7\xfc\xc0\xd8\x1e\x03\xc0\x60\x1E\xAB\x00\x27\x0e\x00"
-                                      "\x0c\x13\x01\x01\x1c\xc3\x78\x20\x00\x40\x0e\x01\xb0\x30\xc0\x00\x00\x07\xf0\x3f"
-                                      "\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x1E\xAC\x00\x2e\x0e\x00\x0b"
-                                      "\x1a\x01\xfb\x04\x01\xc0\x6e\x18\x60\x00\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1"
-                                      "\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81\xe0\x3c\x06\x00\x00\x00\x30\x0e\x00\x80\x1E"
-                                      "\xAD\x00\x2b\x0e\x00\x0c\x16\x01\xfb\x04\x00\xe0\x1f\x01\x18\x20\xc0\x00\x00\x07"
-                                      "\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x00\x00\x00\xe0\x0e"
-                                      "\x00\x40\x1E\xAE\x00\x2b\x0e\x00\x0b\x18\x01\x01\x01\xc0\xe0\x30\x10\x42\x0c\x63"
-                                      "\x07\xc0\x00\x00\x01\xc0\x38\x07\x81\xb0\x36\x06\x60\x8c\x31\x86\x18\xff\x3f\xe6"
-                                      "\x06\xc0\xf0\x1e\x03\x1E\xAF\x00\x27\x0e\x00\x0c\x13\x01\x01\x00\xc0\x38\x0e\x00"
-                                      "\x00\x20\xc3\x18\x1f\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1"
-                                      "\xc7\xfe\x3c\x70\x1E\xB0\x00\x2d\x0e\x00\x0b\x19\x01\x00\x20\x06\x00\x70\x03\x02"
-                                      "\x0c\x41\x0c\x60\xf8\x00\x00\x00\x38\x07\x00\xf0\x36\x06\xc0\xcc\x11\x86\x30\xc3"
-                                      "\x1f\xe7\xfc\xc0\xd8\x1e\x03\xc0\x60\x1E\xB1\x00\x27\x0e\x00\x0c\x13\x01\x01\x30"
-                                      "\x01\xc0\x06\x00\x00\x20\xc3\x18\x1f\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc"
-                                      "\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x1E\xB2\x00\x2d\x0e\x00\x0b\x19\x01\x00\x0c\x01"
-                                      "\xe0\x04\x07\x82\x08\x41\x8c\x60\xf8\x00\x00\x00\x38\x07\x00\xf0\x36\x06\xc0\xcc"
-                                      "\x11\x86\x30\xc3\x1f\xe7\xfc\xc0\xd8\x1e\x03\xc0\x60\x1E\xB3\x00\x27\x0e\x00\x0c"
-                                      "\x13\x01\x01\x0f\x00\x18\x07\x00\x00\x20\xc3\x18\x1f\x00\x00\x00\x07\xf0\x3f\x80"
-                                      "\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x1E\xB4\x00\x2d\x0e\x00\x0b\x19"
-                                      "\x01\x00\x18\xc7\xd0\x8e\x00\x02\x0c\x41\x0c\x60\xf8\x00\x00\x00\x38\x07\x00\xf0"
-                                      "\x36\x06\xc0\xcc\x11\x86\x30\xc3\x1f\xe7\xfc\xc0\xd8\x1e\x03\xc0\x60\x1E\xB5\x00"
-                                      "\x27\x0e\x00\x0c\x13\x01\x01\x1c\xc3\x78\x00\x00\x00\x20\xc3\x18\x1f\x00\x00\x00"
-                                      "\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x1E\xB6\x00\x2e"
-                                      "\x0e\x00\x0b\x1a\x01\xfb\x20\x84\x10\xc6\x0f\x80\x00\x00\x03\x80\x70\x0f\x03\x60"
-                                      "\x6c\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81\xe0\x3c\x06\x00\x00\x00\x30\x0e"
-                                      "\x00\x80\x1E\xB7\x00\x28\x0e\x00\x0c\x14\x01\xfc\x20\xc3\x18\x1f\x00\x00\x00\x07"
-                                      "\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x00\x00\x00\xe0\x0e"
-                                      "\x00\x40\x1E\xB8\x00\x23\x0e\x00\x0a\x14\x02\xfb\xff\xff\xfc\x03\x00\xc0\x30\x0f"
-                                      "\xfb\xfe\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x00\x00\x03\x00\xe0\x10\x1E\xB9\x00"
-                                      "\x1d\x0e\x00\x0a\x0f\x02\xfb\x1e\x1f\xee\x1b\x03\xc0\xff\xfc\x03\x00\x7e\x0f\xc0"
-                                      "\x00\x00\x0c\x03\x00\xc0\x1E\xBA\x00\x25\x0e\x00\x0a\x15\x02\x00\x0c\x03\xc0\x10"
-                                      "\x78\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff\xbf\xec\x03\x00\xc0\x30\x0c\x03"
-                                      "\xff\xff\xc0\x1E\xBB\x00\x1e\x0e\x00\x0a\x10\x02\x01\x3e\x01\x80\x20\x70\x00\x00"
-                                      "\x01\xe1\xfe\xe1\xb0\x3c\x0f\xff\xc0\x30\x07\xe0\xfc\x1E\xBC\x00\x25\x0e\x00\x0a"
-                                      "\x15\x02\x00\x10\x8e\x26\x59\x0c\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff\xbf"
-                                      "\xec\x03\x00\xc0\x30\x0c\x03\xff\xff\xc0\x1E\xBD\x00\x1d\x0e\x00\x0a\x0f\x02\x01"
-                                      "\x38\x9b\x64\x70\x00\x00\x07\x87\xfb\x86\xc0\xf0\x3f\xff\x00\xc0\x1f\x83\xf0\x1E"
-                                      "\xBE\x00\x2b\x0e\x00\x0b\x18\x02\x00\x00\x20\x0c\x06\x02\x01\xe0\x66\x18\x20\x00"
-                                      "\x00\x1f\xfb\xff\x60\x0c\x01\x80\x30\x07\xfc\xff\x98\x03\x00\x60\x0c\x01\x80\x3f"
-                                      "\xf7\xfe\x1E\xBF\x00\x23\x0e\x00\x0b\x12\x02\x00\x00\x60\x18\x00\x06\x01\xe0\xc3"
-                                      "\x10\x20\x00\x1e\x0f\xf3\x86\x60\x6c\x0d\xff\xb0\x06\x00\x7e\x07\xe0\x1E\xC0\x00"
-                                      "\x27\x0e\x00\x0a\x17\x02\x01\x03\x80\x30\x40\x78\x33\x18\x20\x00\x00\xff\xff\xfc"
-                                      "\x03\x00\xc0\x30\x0f\xfb\xfe\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x1E\xC1\x00\x21"
-                                      "\x0e\x00\x0a\x12\x02\x00\x03\x00\xe0\x0c\x30\x1e\x18\x64\x08\x00\x1e\x1f\xee\x1b"
-                                      "\x03\xc0\xff\xfc\x03\x00\x7e\x0f\xc0\x1E\xC2\x00\x2d\x0e\x00\x0b\x19\x02\x00\x01"
-                                      "\x80\x3c\x00\x80\xf0\x40\x3c\x0c\xc3\x04\x00\x00\x03\xff\x7f\xec\x01\x80\x30\x06"
-                                      "\x00\xff\x9f\xf3\x00\x60\x0c\x01\x80\x30\x07\xfe\xff\xc0\x1E\xC3\x00\x25\x0e\x00"
-                                      "\x0b\x13\x02\x00\x01\xe0\x04\x01\x80\xc0\xc0\x3c\x18\x62\x04\x00\x03\xc1\xfe\x70"
-                                      "\xcc\x0d\x81\xbf\xf6\x00\xc0\x0f\xc0\xfc\x00\x1E\xC4\x00\x2a\x0e\x00\x0a\x19\x02"
-                                      "\x00\x18\xcf\x22\x38\x00\x04\x07\x83\x31\x82\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03"
-                                      "\x00\xff\xbf\xec\x03\x00\xc0\x30\x0c\x03\xff\xff\xc0\x1E\xC5\x00\x22\x0e\x00\x0a"
-                                      "\x13\x02\x00\x38\x9b\xc4\x30\x00\x0c\x07\x86\x19\x02\x00\x07\x87\xfb\x86\xc0\xf0"
-                                      "\x3f\xff\x00\xc0\x1f\x83\xf0\x1E\xC6\x00\x2b\x0e\x00\x0a\x1a\x02\xfb\x04\x07\x83"
-                                      "\x31\x82\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff\xbf\xec\x03\x00\xc0\x30\x0c"
-                                      "\x03\xff\xff\xc0\x00\x00\x30\x0e\x01\x00\x1E\xC7\x00\x25\x0e\x00\x0a\x15\x02\xfb"
-                                      "\x0c\x07\x83\x31\x86\x00\x00\x01\xe1\xfe\xe1\xb0\x3c\x0f\xff\xc0\x30\x07\xe0\xfc"
-                                      "\x00\x00\x00\xc0\x30\x0c\x00\x1E\xC8\x00\x1f\x0e\x00\x08\x15\x03\x00\x30\x1e\x06"
-                                      "\x3c\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\xff\x1E\xC9"
-                                      "\x00\x1e\x0e\x00\x09\x11\x03\x00\x30\x1e\x01\x01\x83\x80\x00\x01\xf0\xf8\x0c\x06"
-                                      "\x03\x01\x80\xc0\x61\xff\xff\x80\x1E\xCA\x00\x1e\x0e\x00\x08\x14\x03\xfb\xff\x18"
-                                      "\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\xff\x00\x00\x18\x38\x10\x1E\xCB"
-                                      "\x00\x22\x0e\x00\x09\x15\x03\xfb\x18\x1c\x06\x00\x00\x00\x03\xe1\xf0\x18\x0c\x06"
-                                      "\x03\x01\x80\xc3\xff\xff\x00\x00\x06\x03\x01\x80\x1E\xCC\x00\x26\x0e\x00\x0b\x14"
-                                      "\x01\xfb\x1f\x07\xf1\xc3\x30\x36\x07\x80\xf0\x1e\x03\xc0\x78\x0d\x81\xb0\x37\x0c"
-                                      "\x7f\x07\xc0\x00\x00\x00\xc0\x38\x02\x00\x1E\xCD\x00\x1f\x0e\x00\x0b\x0f\x01\xfb"
-                                      "\x1f\x07\xf9\x83\x30\x3c\x07\x80\xd8\x1b\x06\x3f\xc3\xe0\x00\x00\x00\x60\x1c\x01"
-                                      "\x00\x1E\xCE\x00\x26\x0e\x00\x0b\x14\x01\x01\x0f\x00\x30\x3c\x00\x00\x00\x3e\x0f"
-                                      "\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x1E"
-                                      "\xCF\x00\x20\x0e\x00\x0b\x10\x01\x01\x1e\x00\x60\x0c\x07\x00\x00\x00\x07\xc1\xfe"
-                                      "\x60\xcc\x0f\x01\xe0\x36\x06\xc1\x8f\xf0\xf8\x1E\xD0\x00\x2d\x0e\x00\x0c\x17\x01"
-                                      "\x00\x00\x30\x0e\x00\x80\xe0\x1f\x03\x1c\x20\x00\x00\x1f\x03\xf8\x70\xc6\x06\x60"
-                                      "\x6c\x06\xc0\x6c\x06\xc0\x6c\x06\x60\x66\x06\x70\xc3\xf8\x1f\x00\x1E\xD1\x00\x25"
-                                      "\x0e\x00\x0c\x12\x01\x00\x00\x30\x0e\x00\x80\xe0\x1b\x03\x18\x20\x00\x00\x1f\x03"
-                                      "\xfc\x60\xc6\x06\xc0\x6c\x06\x60\x66\x0c\x3f\xc1\xf0\x1E\xD2\x00\x2a\x0e\x00\x0b"
-                                      "\x17\x01\x00\x01\x80\x18\x00\x07\x01\xf0\x63\x88\x00\x00\x1f\x07\xf1\xc3\x30\x36"
-                                      "\x07\x80\xf0\x1e\x03\xc0\x78\x0d\x81\xb0\x37\x0c\x7f\x07\xc0\x1E\xD3\x00\x23\x0e"
-                                      "\x00\x0b\x12\x01\x00\x01\x00\x30\x03\x07\x01\xb0\x63\x08\x00\x00\x1f\x07\xf9\x83"
-                                      "\x30\x3c\x07\x80\xd8\x1b\x06\x3f\xc3\xe0\x1E\xD4\x00\x2e\x0e\x00\x0c\x18\x01\x00"
-                                      "\x01\xe0\x03\x00\x70\x0c\x0e\x01\xf0\x31\xc2\x00\x00\x01\xf0\x3f\x87\x0c\x60\x66"
-                                      "\x06\xc0\x6c\x06\xc0\x6c\x06\xc0\x66\x06\x60\x67\x0c\x3f\x81\xf0\x1E\xD5\x00\x27"
-                                      "\x0e\x00\x0c\x13\x01\x00\x01\xe0\x03\x00\x70\x0c\x0e\x01\xb0\x31\x82\x00\x00\x01"
-                                      "\xf0\x3f\xc6\x0c\x60\x6c\x06\xc0\x66\x06\x60\xc3\xfc\x1f\x00\x1E\xD6\x00\x2b\x0e"
-                                      "\x00\x0b\x18\x01\x00\x1c\x46\xf8\x06\x00\x00\xe0\x3e\x0c\x71\x00\x00\x03\xe0\xfe"
-                                      "\x38\x66\x06\xc0\xf0\x1e\x03\xc0\x78\x0f\x01\xb0\x36\x06\xe1\x8f\xe0\xf8\x1E\xD7"
-                                      "\x00\x25\x0e\x00\x0b\x13\x01\x00\x1c\xc6\xf0\x84\x00\x00\xe0\x36\x0c\x61\x00\x00"
-                                      "\x03\xe0\xff\x30\x66\x07\x80\xf0\x1b\x03\x60\xc7\xf8\x7c\x00\x1E\xD8\x00\x2d\x0e"
-                                      "\x00\x0b\x19\x01\xfb\x0e\x03\x60\xc6\x10\x00\x00\x3e\x0f\xe3\x86\x60\x6c\x0f\x01"
-                                      "\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x00\x00\x01\x80\x70\x04\x00"
-                                      "\x1E\xD9\x00\x27\x0e\x00\x0b\x15\x01\xfb\x06\x01\xe0\x66\x18\x62\x00\x00\x07\xc1"
-                                      "\xfe\x60\xcc\x0f\x01\xe0\x36\x06\xc1\x8f\xf0\xf8\x00\x00\x00\x18\x07\x00\x40\x1E"
-                                      "\xDA\x00\x2a\x0e\x00\x0c\x15\x01\x00\x00\x80\x1c\x07\x00\xc0\x00\x10\x03\x1f\xf3"
-                                      "\xf8\x70\xc6\x06\x60\x6c\x06\xc0\x6c\x06\xc0\x6c\x06\x60\x66\x06\x70\xc3\xf8\x1f"
-                                      "\x00\x1E\xDB\x00\x22\x0e\x00\x0c\x10\x01\x00\x00\x80\x18\x06\x00\xc0\x00\x30\x03"
-                                      "\x1f\xe3\xf8\x60\xc6\x06\xc0\x6c\x06\x60\x66\x0c\x3f\xc1\xf0\x1E\xDC\x00\x28\x0e"
-                                      "\x00\x0c\x14\x01\x01\x38\x00\xc0\x02\x00\x01\x00\x31\xff\x3f\x87\x0c\x60\x66\x06"
-                                      "\xc0\x6c\x06\xc0\x6c\x06\xc0\x66\x06\x60\x67\x0c\x3f\x81\xf0\x1E\xDD\x00\x21\x0e"
-                                      "\x00\x0c\x0f\x01\x01\x38\x00\xc0\x03\x00\x03\x00\x31\xfe\x3f\x86\x0c\x60\x6c\x06"
-                                      "\xc0\x66\x06\x60\xc3\xfc\x1f\x00\x1E\xDE\x00\x2a\x0e\x00\x0c\x15\x01\x00\x0c\x00"
-                                      "\x78\x01\x80\xf0\x00\x10\x03\x1f\xf3\xf8\x70\xc6\x06\x60\x6c\x06\xc0\x6c\x06\xc0"
-                                      "\x6c\x06\x60\x66\x06\x70\xc3\xf8\x1f\x00\x1E\xDF\x00\x24\x0e\x00\x0c\x11\x01\x00"
-                                      "\x08\x00\xf0\x03\x00\x30\x1e\x00\x03\x00\x31\xfe\x3f\x86\x0c\x60\x6c\x06\xc0\x66"
-                                      "\x06\x60\xc3\xfc\x1f\x00\x1E\xE0\x00\x2a\x0e\x00\x0c\x15\x01\x00\x18\x43\xcc\x26"
-                                      "\x86\x38\x00\x10\x03\x1f\xf3\xf8\x70\xc6\x06\x60\x6c\x06\xc0\x6c\x06\xc0\x6c\x06"
-                                      "\x60\x66\x06\x70\xc3\xf8\x1f\x00\x1E\xE1\x00\x22\x0e\x00\x0c\x10\x01\x00\x18\x43"
-                                      "\xcc\x26\x86\x38\x00\x30\x03\x1f\xe3\xf8\x60\xc6\x06\xc0\x6c\x06\x60\x66\x0c\x3f"
-                                      "\xc1\xf0\x1E\xE2\x00\x2b\x0e\x00\x0c\x16\x01\xfb\x00\x10\x03\x1f\xf3\xf8\x70\xc6"
-                                      "\x06\x60\x6c\x06\xc0\x6c\x06\xc0\x6c\x06\x60\x66\x06\x70\xc3\xf8\x1f\x00\x00\x00"
-                                      "\x00\x60\x0e\x00\x40\x1E\xE3\x00\x24\x0e\x00\x0c\x11\x01\xfb\x00\x30\x03\x1f\xe3"
-                                      "\xf8\x60\xc6\x06\xc0\x6c\x06\x60\x66\x0c\x3f\xc1\xf0\x00\x00\x00\x06\x00\xe0\x04"
-                                      "\x00\x1E\xE4\x00\x23\x0e\x00\x0a\x14\x02\xfb\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f"
-                                      "\x03\xc0\xf0\x3c\x0f\x03\xe1\x9f\xe3\xe0\x00\x00\x03\x01\xc0\x20\x1E\xE5\x00\x1b"
-                                      "\x0e\x00\x09\x0f\x02\xfb\xc0\xe0\x70\x38\x1c\x0e\x07\x07\x87\xfe\xbc\x40\x00\x00"
-                                      "\xc0\xe0\x20\x1E\xE6\x00\x23\x0e\x00\x0a\x14\x02\x01\x1e\x00\xc1\xe0\x00\x00\x30"
-                                      "\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x1E\xE7"
-                                      "\x00\x1c\x0e\x00\x09\x10\x02\x01\x3c\x03\x01\x83\x80\x00\x03\x03\x81\xc0\xe0\x70"
-                                      "\x38\x1c\x1e\x1f\xfa\xf1\x1E\xE8\x00\x2b\x0e\x00\x0d\x14\x02\x01\x03\x00\x30\x06"
-                                      "\x00\x00\x30\x01\xe0\x7b\x03\x18\x18\xc0\xc6\x06\x30\x31\x81\x8c\x0c\x60\x63\x03"
-                                      "\x18\x18\xc0\xc7\x0c\x1f\xe0\x7c\x00\x1E\xE9\x00\x21\x0e\x00\x0c\x0f\x02\x01\x03"
-                                      "\x00\x60\x18\x00\x03\x00\x3c\x0e\xc0\x8c\x08\xc0\x8c\x08\xc0\x8c\x18\xc3\x8f\xe8"
-                                      "\x78\x80\x1E\xEA\x00\x2b\x0e\x00\x0d\x14\x02\x01\x60\x01\xc0\x03\x80\x00\x30\x01"
-                                      "\xe0\x7b\x03\x18\x18\xc0\xc6\x06\x30\x31\x81\x8c\x0c\x60\x63\x03\x18\x18\xc0\xc7"
-                                      "\x0c\x1f\xe0\x7c\x00\x1E\xEB\x00\x21\x0e\x00\x0c\x0f\x02\x01\x70\x01\x80\x0e\x00"
-                                      "\x03\x00\x3c\x0e\xc0\x8c\x08\xc0\x8c\x08\xc0\x8c\x18\xc3\x8f\xe8\x78\x80\x1E\xEC"
-                                      "\x00\x2b\x0e\x00\x0d\x14\x02\x01\x1e\x00\x18\x07\x80\x00\x30\x01\xe0\x7b\x03\x18"
-                                      "\x18\xc0\xc6\x06\x30\x31\x81\x8c\x0c\x60\x63\x03\x18\x18\xc0\xc7\x0c\x1f\xe0\x7c"
-                                      "\x00\x1E\xED\x00\x22\x0e\x00\x0c\x10\x02\x01\x3c\x00\x60\x06\x01\xc0\x00\x30\x03"
-                                      "\xc0\xec\x08\xc0\x8c\x08\xc0\x8c\x08\xc1\x8c\x38\xfe\x87\x88\x1E\xEE\x00\x2d\x0e"
-                                      "\x00\x0d\x15\x02\x00\x30\x83\xcc\x13\x41\x8e\x00\x01\x80\x0f\x03\xd8\x18\xc0\xc6"
-                                      "\x06\x30\x31\x81\x8c\x0c\x60\x63\x03\x18\x18\xc0\xc6\x06\x38\x60\xff\x03\xe0\x00"
-                                      "\x1E\xEF\x00\x22\x0e\x00\x0c\x10\x02\x00\x30\x87\x88\x4d\x04\x70\x00\x30\x03\xc0"
-                                      "\xec\x08\xc0\x8c\x08\xc0\x8c\x08\xc1\x8c\x38\xfe\x87\x88\x1E\xF0\x00\x2e\x0e\x00"
-                                      "\x0d\x16\x02\xfb\x00\x18\x00\xf0\x3d\x81\x8c\x0c\x60\x63\x03\x18\x18\xc0\xc6\x06"
-                                      "\x30\x31\x81\x8c\x0c\x60\x63\x86\x0f\xf0\x3e\x00\x00\x00\x00\x18\x01\xc0\x04\x00"
-                                      "\x1E\xF1\x00\x24\x0e\x00\x0c\x11\x02\xfb\x00\x30\x03\xc0\xec\x08\xc0\x8c\x08\xc0"
-                                      "\x8c\x08\xc1\x8c\x38\xfe\x87\x88\x00\x00\x00\x0c\x01\xc0\x08\x00\x1E\xF2\x00\x26"
-                                      "\x0e\x00\x0b\x14\x01\x01\x30\x03\x80\x1c\x00\x00\x01\x80\xd8\x1b\x06\x30\xc7\x30"
-                                      "\x6c\x07\x80\xe0\x0c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x1E\xF3\x00\x26\x0e\x00"
-                                      "\x0b\x14\x01\xfc\x38\x01\x80\x1c\x00\x00\x01\xc0\xd8\x1b\x06\x30\xc6\x30\x66\x0c"
-                                      "\x80\xf0\x1e\x03\x80\x30\x0c\x01\x83\xe0\x78\x00\x1E\xF4\x00\x26\x0e\x00\x0b\x14"
-                                      "\x01\xfb\xc0\x6c\x0d\x83\x18\x63\x98\x36\x03\xc0\x70\x06\x00\xc0\x18\x03\x00\x60"
-                                      "\x0c\x01\x80\x00\x00\x00\xc0\x38\x02\x00\x1E\xF5\x00\x1f\x0e\x00\x0b\x0f\x01\xfb"
-                                      "\xe0\x6c\x0d\x83\x18\x63\x18\x33\x06\x40\x78\x0f\x01\xc0\x18\x06\x00\xcf\xf1\xfc"
-                                      "\x10\x1E\xF6\x00\x26\x0e\x00\x0b\x14\x01\x01\x0f\x00\x30\x3c\x00\x00\x01\x80\xd8"
-                                      "\x1b\x06\x30\xc7\x30\x6c\x07\x80\xe0\x0c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x1E"
-                                      "\xF7\x00\x29\x0e\x00\x0b\x16\x01\xfb\x0c\x01\xe0\x0c\x01\x81\xe0\x00\x00\x07\x03"
-                                      "\x60\x6c\x18\xc3\x18\xc1\x98\x32\x03\xc0\x78\x0e\x00\xc0\x30\x06\x0f\x81\xe0\x00"
-                                      "\x1E\xF8\x00\x27\x0e\x00\x0b\x15\x01\x00\x18\x47\x98\x9a\x31\xc0\x00\x00\x30\x1b"
-                                      "\x03\x60\xc6\x18\xe6\x0d\x80\xf0\x1c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x1E"
-                                      "\xF9\x00\x27\x0e\x00\x0b\x15\x01\xfb\x18\x47\x88\x9b\x11\xc0\x00\x00\x38\x1b\x03"
-                                      "\x60\xc6\x18\xc6\x0c\xc1\x90\x1e\x03\xc0\x70\x06\x01\x80\x30\x7c\x0f\x00\x20\x11"
-                                      "\x00\x0c\x0e\x00\x08\x02\x03\x05\xff\xff\x20\x13\x00\x0d\x0e\x00\x0a\x02\x02\x05"
-                                      "\xff\xff\xf0\x20\x14\x00\x0d\x0e\x00\x0b\x02\x01\x05\xff\xff\xfc\x20\x15\x00\x0d"
-                                      "\x0e\x00\x0b\x02\x01\x05\xff\xff\xfc\x20\x18\x00\x0e\x0e\x00\x05\x06\x04\x0a\x19"
-                                      "\xdc\xe6\x70\x20\x19\x00\x0e\x0e\x00\x05\x06\x04\x0a\x39\xce\xe6\x60\x20\x1A\x00"
-                                      "\x0e\x0e\x00\x05\x06\x04\xfd\x39\xce\xe6\x60\x20\x1C\x00\x12\x0e\x00\x0a\x06\x02"
-                                      "\x0a\x10\xcc\x66\x3b\x8c\xe7\x31\xc0\x20\x1D\x00\x12\x0e\x00\x0a\x06\x02\x0a\x31"
-                                      "\xdc\x77\x19\x8e\xc3\x21\x80\x20\x1E\x00\x12\x0e\x00\x0a\x06\x02\xfd\x31\xdc\x77"
-                                      "\x19\x8e\xc3\x21\x80\x20\x20\x00\x1e\x0e\x00\x0a\x10\x02\x00\x0c\x03\x00\xc0\x20"
-                                      "\x88\x7f\xf0\x80\x20\x08\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30\x20\x21\x00\x1e\x0e"
-                                      "\x00\x0a\x10\x02\x00\x0c\x03\x00\xc0\x20\x08\x3f\xf8\x8c\x20\x08\x22\x3f\xfc\x20"
-                                      "\x08\x03\x00\xc0\x30\x20\x22\x00\x0f\x0e\x00\x06\x06\x04\x04\x73\xef\xff\xf9\xe0"
-                                      "\x20\x25\x00\x0f\x0e\x00\x0a\x04\x02\x00\x40\xb8\x7e\x1f\x86\x20\x26\x00\x0f\x0e"
-                                      "\x00\x0c\x03\x01\x00\xc6\x7e\xe7\xc6\x60\x20\x39\x00\x14\x0e\x00\x07\x0b\x03\x00"
-                                      "\x02\x0c\x71\xc7\x18\x1c\x1c\x1c\x0c\x08\x20\x3A\x00\x13\x0e\x00\x06\x0b\x04\x00"
-                                      "\x83\x0e\x0e\x1c\x31\xce\x63\x08\x00\x20\x44\x00\x23\x0e\x00\x0d\x0f\x00\x00\x00"
-                                      "\x18\x00\x80\x0c\x00\xc0\x0c\x00\xc0\x04\x00\x60\x06\x00\x60\x02\x00\x20\x03\x00"
-                                      "\x30\x03\x00\x00\x20\x70\x00\x11\x0e\x00\x07\x08\x03\x07\x3c\xcd\x1e\x5f\x28\x59"
-                                      "\x9e\x20\x74\x00\x11\x0e\x00\x07\x08\x03\x07\x0c\x28\x91\x24\x5f\xc1\x02\x20\x75"
-                                      "\x00\x10\x0e\x00\x06\x08\x04\x07\xfa\x08\x3e\x0c\x33\xbc\x20\x76\x00\x10\x0e\x00"
-                                      "\x06\x08\x04\x07\x11\x84\x3e\x8e\x1c\xde\x20\x77\x00\x11\x0e\x00\x07\x08\x03\x07"
-                                      "\xfe\x0c\x10\x61\x82\x0c\x10\x20\x78\x00\x10\x0e\x00\x06\x08\x04\x07\x7a\x38\xde"
-                                      "\xca\x18\xde\x20\x79\x00\x11\x0e\x00\x07\x08\x03\x07\x3c\xcf\x0a\x17\xe1\x86\x18"
-                                      "\x20\x80\x00\x11\x0e\x00\x07\x08\x03\xfb\x3c\xcd\x1e\x5f\x28\x59\x9e\x20\x81\x00"
-                                      "\x10\x0e\x00\x06\x08\x04\xfb\x33\xcb\x0c\x30\xc3\x3f\x20\x82\x00\x10\x0e\x00\x06"
-                                      "\x08\x04\xfb\x7b\x30\xc2\x11\x8c\x3f\x20\x83\x00\x10\x0e\x00\x06\x08\x04\xfb\xfc"
-                                      "\x63\x1e\x0c\x11\xfc\x20\x84\x00\x11\x0e\x00\x07\x08\x03\xfb\x0c\x28\x91\x24\x5f"
-                                      "\xc1\x02\x20\x85\x00\x10\x0e\x00\x06\x08\x04\xfb\xfa\x08\x3e\x0c\x33\xbc\x20\x86"
-                                      "\x00\x10\x0e\x00\x06\x08\x04\xfb\x11\x84\x3e\x8e\x1c\xde\x20\x87\x00\x11\x0e\x00"
-                                      "\x07\x08\x03\xfb\xfe\x0c\x10\x61\x82\x0c\x10\x20\x88\x00\x10\x0e\x00\x06\x08\x04"
-                                      "\xfb\x7a\x38\xde\xca\x18\xde\x20\x89\x00\x11\x0e\x00\x07\x08\x03\xfb\x3c\xcf\x0a"
-                                      "\x17\xe1\x86\x18\x20\xA6\x00\x23\x0e\x00\x0d\x0f\x00\x00\x38\x21\xc1\x0f\x08\x68"
-                                      "\x43\x42\x1b\x13\xcf\xe6\x44\x33\x27\xf9\xcc\x48\x63\x43\x0a\x18\x50\xc3\x80\x20"
-                                      "\xA9\x00\x23\x0e\x00\x0d\x0f\x00\x00\x20\x11\x00\x88\x04\x40\x62\x33\x11\x98\x94"
-                                      "\x9f\xbf\x25\x21\x25\x0d\x28\x69\x43\x8a\x0c\x70\x63\x80\x20\xAB\x00\x25\x0e\x00"
-                                      "\x0c\x12\x01\xfd\x00\xc0\x0c\x07\xf0\x0c\x00\xc1\xec\x3b\xc6\x0c\x40\xcc\x0c\xc0"
-                                      "\xce\x0c\x60\xc7\xf4\x1e\x40\x00\x00\x07\xfc\x20\xAC\x00\x1f\x0e\x00\x0b\x0f\x01"
-                                      "\x00\x07\xc3\xfc\x60\x18\x03\x01\xff\x0c\x01\x80\xff\x86\x00\xc0\x18\x01\x80\x1f"
-                                      "\xc1\xf0\x20\xB1\x00\x23\x0e\x00\x0d\x0f\x00\x00\x3f\x81\xfe\x0c\x18\x60\xcf\xff"
-                                      "\x98\x30\xc1\x86\x1c\x3f\xc1\xf8\x0c\x00\x60\x03\x00\x18\x00\xc0\x00\x20\xB9\x00"
-                                      "\x1f\x0e\x00\x0b\x0f\x01\x00\xff\xe0\x30\x06\x00\xc0\x19\xff\xc0\x60\x0c\x03\x1f"
-                                      "\xc1\xc0\x1c\x00\xe0\x0e\x00\x70\x20\xBA\x00\x1f\x0e\x00\x0b\x0f\x01\x00\x30\x06"
-                                      "\x00\xc4\x1b\x83\xc0\x60\x3c\xc5\xb0\x3c\x0e\x07\xc1\x98\x33\x0c\x7f\x0f\xc0\x20"
-                                      "\xBD\x00\x21\x0e\x00\x0c\x0f\x01\x00\x3f\xc3\xfe\x30\x33\x03\x30\x33\x03\x30\xef"
-                                      "\xfc\x30\x03\x00\xff\x83\x00\x30\x03\x00\x30\x00\x21\x17\x00\x23\x0e\x00\x0b\x12"
-                                      "\x01\xfe\x1f\x06\x11\x81\x20\x34\xf3\x92\x62\x6c\x4d\x89\xb1\x26\x3c\xc4\x1c\x82"
-                                      "\x90\x50\x1b\x02\x30\x83\xe0\x21\x20\x00\x14\x0e\x00\x0b\x07\x01\x09\x73\x30\x6e"
-                                      "\x0d\xb9\x51\x2a\x24\x7c\x88\x21\x22\x00\x14\x0e\x00\x0b\x07\x01\x09\xfb\x24\x6c"
-                                      "\x8d\x91\x52\x2a\x44\x48\x88\x21\x53\x00\x29\x0e\x00\x0d\x13\x00\xfb\x30\x07\x80"
-                                      "\x24\x00\x20\x11\x01\x88\x18\x41\x9f\x90\x01\x00\x10\x03\x00\x33\xf3\x01\x70\x11"
-                                      "\x01\xc0\x01\x00\x08\x01\xc0\x7c\x21\x54\x00\x29\x0e\x00\x0d\x13\x00\xfb\x3c\x07"
-                                      "\x20\x01\x80\x08\x11\x81\x98\x19\x81\x9f\xd0\x01\x00\x10\x03\x00\x33\xf3\x01\x70"
-                                      "\x11\x01\xc0\x01\x00\x08\x01\xc0\x7c\x21\x55\x00\x29\x0e\x00\x0d\x13\x00\xfb\x30"
-                                      "\x07\x80\x24\x00\x20\x11\x01\x88\x18\x41\x9f\x90\x01\x00\x10\x03\x00\x33\xe3\x10"
-                                      "\x70\x81\x07\xc0\x03\x00\x08\x03\x80\x78\x21\x56\x00\x29\x0e\x00\x0d\x13\x00\xfb"
-                                      "\x3c\x07\x20\x01\x80\x08\x11\x81\x98\x19\x81\x9f\xd0\x01\x00\x10\x03\x00\x33\xe3"
-                                      "\x10\x70\x81\x07\xc0\x03\x00\x08\x03\x80\x78\x21\x57\x00\x29\x0e\x00\x0d\x13\x00"
-                                      "\xfb\xfc\x00\x60\x06\x00\x78\x10\x61\x83\x18\x39\x8f\x10\x01\x00\x10\x03\x00\x33"
-                                      "\xe3\x10\x70\x81\x07\xc0\x03\x00\x08\x03\x80\x78\x21\x58\x00\x29\x0e\x00\x0d\x13"
-                                      "\x00\xfb\x0c\x00\xe0\x0b\x00\xd8\x14\xc1\xff\x18\x31\x81\x90\x01\x00\x10\x03\x00"
-                                      "\x33\xe3\x10\x70\x81\x07\xc0\x03\x00\x08\x03\x80\x78\x21\x59\x00\x29\x0e\x00\x0d"
-                                      "\x13\x00\xfb\x30\x07\x80\x24\x00\x20\x11\x01\x88\x18\x41\x9f\x90\x01\x00\x10\x03"
-                                      "\x00\x30\xc3\x08\x70\x81\x0f\xc0\x42\x02\x10\x19\x80\x78\x21\x5A\x00\x29\x0e\x00"
-                                      "\x0d\x13\x00\xfb\x7c\x02\x00\x10\x00\xf8\x10\x61\x83\x18\x71\x8e\x10\x01\x00\x10"
-                                      "\x03\x00\x30\xc3\x08\x70\x81\x0f\xc0\x42\x02\x10\x19\x80\x78\x21\x5B\x00\x29\x0e"
-                                      "\x00\x0d\x13\x00\xfb\x30\x07\x80\x24\x00\x20\x11\x01\x88\x18\x41\x9f\x90\x01\x00"
-                                      "\x10\x03\x00\x31\xe3\x11\x70\x8d\x07\xc0\x32\x03\x18\x18\xc0\x7c\x21\x5C\x00\x29"
-                                      "\x0e\x00\x0d\x13\x00\xfb\xfc\x00\x60\x06\x00\x78\x10\x61\x83\x18\x39\x8f\x10\x01"
-                                      "\x00\x10\x03\x00\x31\xe3\x11\x70\x8d\x07\xc0\x32\x03\x18\x18\xc0\x7c\x21\x5D\x00"
-                                      "\x29\x0e\x00\x0d\x13\x00\xfb\x7c\x02\x00\x10\x00\xf8\x10\x61\x83\x18\x71\x8e\x10"
-                                      "\x01\x00\x10\x03\x00\x31\xe3\x11\x70\x8d\x07\xc0\x32\x03\x18\x18\xc0\x7c\x21\x5E"
-                                      "\x00\x29\x0e\x00\x0d\x13\x00\xfb\x7e\x00\x10\x01\x80\x08\x10\xc1\x84\x18\x61\x86"
-                                      "\x10\x01\x00\x10\x03\x00\x31\xe3\x11\x70\x8d\x07\xc0\x32\x03\x18\x18\xc0\x7c\x22"
-                                      "\x12\x00\x0d\x0e\x00\x0a\x02\x02\x06\xff\xff\xf0\x22\x48\x00\x1b\x0e\x00\x0c\x0b"
-                                      "\x01\x02\x30\x37\xc2\x46\x6c\x3c\xc1\xc0\x00\x30\x37\xc2\x4e\x6c\x3c\xc1\xc0\x22"
-                                      "\x60\x00\x19\x0e\x00\x09\x0d\x02\x01\x01\x80\x80\xc0\x7f\xf8\x20\x20\x10\xff\xff"
-                                      "\xc8\x0c\x06\x00\x22\x64\x00\x1a\x0e\x00\x09\x0e\x02\x00\x00\x81\xc3\xcf\x0e\x07"
-                                      "\x01\xe0\x1e\x03\x80\x40\x00\x0f\xff\xfc\x22\x65\x00\x1a\x0e\x00\x09\x0e\x02\x00"
-                                      "\x80\x70\x0f\x01\xe0\x18\x0c\x3c\x78\xe0\x40\x00\x00\x0f\xff\xfc\xA7\x88\x00\x0f"
-                                      "\x0e\x00\x07\x05\x03\xf9\x18\x79\xb6\x18\x20";
+static constexpr Character intel_one_mono_16_pt_characters[623] = {
+    {0x0000, 0, 9, 16, 8, 16, 0, 0},
+    {0x0020, 16, 14, 0, 0, 0, 0, 0},
+    {0x0021, 16, 14, 0, 4, 16, 5, 0},
+    {0x0022, 24, 14, 0, 8, 7, 3, 9},
+    {0x0023, 31, 14, 0, 12, 15, 1, 0},
+    {0x0024, 54, 14, 0, 10, 21, 2, -3},
+    {0x0025, 81, 14, 0, 12, 15, 1, 0},
+    {0x0026, 104, 14, 0, 12, 15, 1, 0},
+    {0x0027, 127, 14, 0, 3, 7, 5, 9},
+    {0x0028, 130, 14, 0, 8, 21, 3, -3},
+    {0x0029, 151, 14, 0, 9, 21, 2, -3},
+    {0x002A, 175, 14, 0, 11, 10, 1, 4},
+    {0x002B, 189, 14, 0, 10, 11, 2, 1},
+    {0x002C, 203, 14, 0, 6, 6, 3, -3},
+    {0x002D, 208, 14, 0, 8, 2, 3, 5},
+    {0x002E, 210, 14, 0, 4, 4, 5, 0},
+    {0x002F, 212, 14, 0, 11, 19, 1, -2},
+    {0x0030, 239, 14, 0, 11, 15, 1, 0},
+    {0x0031, 260, 14, 0, 10, 15, 2, 0},
+    {0x0032, 279, 14, 0, 10, 15, 2, 0},
+    {0x0033, 298, 14, 0, 10, 15, 2, 0},
+    {0x0034, 317, 14, 0, 12, 15, 1, 0},
+    {0x0035, 340, 14, 0, 10, 15, 2, 0},
+    {0x0036, 359, 14, 0, 10, 15, 2, 0},
+    {0x0037, 378, 14, 0, 11, 15, 1, 0},
+    {0x0038, 399, 14, 0, 10, 15, 2, 0},
+    {0x0039, 418, 14, 0, 10, 15, 2, 0},
+    {0x003A, 437, 14, 0, 4, 10, 5, 0},
+    {0x003B, 442, 14, 0, 6, 13, 3, -3},
+    {0x003C, 452, 14, 0, 11, 11, 1, 2},
+    {0x003D, 468, 14, 0, 9, 7, 2, 4},
+    {0x003E, 476, 14, 0, 10, 11, 2, 2},
+    {0x003F, 490, 14, 0, 10, 16, 2, 0},
+    {0x0040, 510, 14, 0, 11, 18, 1, -2},
+    {0x0041, 535, 14, 0, 11, 15, 1, 0},
+    {0x0042, 556, 14, 0, 10, 15, 2, 0},
+    {0x0043, 575, 14, 0, 11, 15, 1, 0},
+    {0x0044, 596, 14, 0, 10, 15, 2, 0},
+    {0x0045, 615, 14, 0, 10, 15, 2, 0},
+    {0x0046, 634, 14, 0, 10, 15, 2, 0},
+    {0x0047, 653, 14, 0, 11, 15, 1, 0},
+    {0x0048, 674, 14, 0, 9, 15, 2, 0},
+    {0x0049, 691, 14, 0, 8, 15, 3, 0},
+    {0x004A, 706, 14, 0, 10, 15, 1, 0},
+    {0x004B, 725, 14, 0, 11, 15, 2, 0},
+    {0x004C, 746, 14, 0, 10, 15, 2, 0},
+    {0x004D, 765, 14, 0, 11, 15, 1, 0},
+    {0x004E, 786, 14, 0, 10, 15, 2, 0},
+    {0x004F, 805, 14, 0, 11, 15, 1, 0},
+    {0x0050, 826, 14, 0, 11, 15, 2, 0},
+    {0x0051, 847, 14, 0, 12, 18, 1, -3},
+    {0x0052, 874, 14, 0, 10, 15, 2, 0},
+    {0x0053, 893, 14, 0, 10, 15, 2, 0},
+    {0x0054, 912, 14, 0, 11, 15, 1, 0},
+    {0x0055, 933, 14, 0, 10, 15, 2, 0},
+    {0x0056, 952, 14, 0, 11, 15, 1, 0},
+    {0x0057, 973, 14, 0, 11, 15, 1, 0},
+    {0x0058, 994, 14, 0, 11, 15, 1, 0},
+    {0x0059, 1015, 14, 0, 11, 15, 1, 0},
+    {0x005A, 1036, 14, 0, 11, 15, 1, 0},
+    {0x005B, 1057, 14, 0, 8, 20, 4, -3},
+    {0x005C, 1077, 14, 0, 11, 19, 1, -2},
+    {0x005D, 1104, 14, 0, 7, 20, 2, -3},
+    {0x005E, 1122, 14, 0, 11, 8, 1, 7},
+    {0x005F, 1133, 14, 0, 10, 2, 2, -3},
+    {0x0060, 1136, 14, 0, 4, 4, 4, 12},
+    {0x0061, 1138, 14, 0, 12, 10, 1, 0},
+    {0x0062, 1153, 14, 0, 10, 16, 2, 0},
+    {0x0063, 1173, 14, 0, 10, 10, 2, 0},
+    {0x0064, 1186, 14, 0, 10, 16, 1, 0},
+    {0x0065, 1206, 14, 0, 10, 10, 2, 0},
+    {0x0066, 1219, 14, 0, 10, 16, 2, 0},
+    {0x0067, 1239, 14, 0, 10, 15, 1, -5},
+    {0x0068, 1258, 14, 0, 9, 16, 2, 0},
+    {0x0069, 1276, 14, 0, 9, 16, 3, 0},
+    {0x006A, 1294, 14, 0, 8, 21, 2, -5},
+    {0x006B, 1315, 14, 0, 10, 16, 2, 0},
+    {0x006C, 1335, 14, 0, 11, 16, 1, 0},
+    {0x006D, 1357, 14, 0, 11, 10, 1, 0},
+    {0x006E, 1371, 14, 0, 9, 10, 2, 0},
+    {0x006F, 1383, 14, 0, 11, 10, 1, 0},
+    {0x0070, 1397, 14, 0, 10, 15, 2, -5},
+    {0x0071, 1416, 14, 0, 10, 15, 1, -5},
+    {0x0072, 1435, 14, 0, 11, 10, 1, 0},
+    {0x0073, 1449, 14, 0, 9, 10, 2, 0},
+    {0x0074, 1461, 14, 0, 11, 14, 1, 0},
+    {0x0075, 1481, 14, 0, 9, 10, 2, 0},
+    {0x0076, 1493, 14, 0, 11, 10, 1, 0},
+    {0x0077, 1507, 14, 0, 11, 10, 1, 0},
+    {0x0078, 1521, 14, 0, 10, 10, 2, 0},
+    {0x0079, 1534, 14, 0, 11, 15, 1, -5},
+    {0x007A, 1555, 14, 0, 10, 10, 2, 0},
+    {0x007B, 1568, 14, 0, 10, 21, 2, -3},
+    {0x007C, 1595, 14, 0, 2, 19, 6, -2},
+    {0x007D, 1600, 14, 0, 11, 21, 1, -3},
+    {0x007E, 1629, 14, 0, 12, 5, 1, 5},
+    {0x00A0, 1637, 14, 0, 0, 0, 0, 0},
+    {0x00A1, 1637, 14, 0, 4, 16, 5, 0},
+    {0x00A2, 1645, 14, 0, 10, 17, 2, -3},
+    {0x00A3, 1667, 14, 0, 10, 15, 2, 0},
+    {0x00A5, 1686, 14, 0, 11, 15, 1, 0},
+    {0x00A7, 1707, 14, 0, 11, 20, 1, -5},
+    {0x00A8, 1735, 14, 0, 8, 2, 3, 12},
+    {0x00A9, 1737, 14, 0, 11, 18, 1, -2},
+    {0x00AA, 1762, 14, 0, 9, 11, 2, 5},
+    {0x00AB, 1775, 14, 0, 11, 11, 1, 0},
+    {0x00AE, 1791, 14, 0, 11, 11, 1, 5},
+    {0x00AF, 1807, 14, 0, 7, 1, 3, 13},
+    {0x00B0, 1808, 14, 0, 9, 9, 2, 7},
+    {0x00B1, 1819, 14, 0, 10, 14, 2, 0},
+    {0x00B2, 1837, 14, 0, 6, 8, 4, 7},
+    {0x00B3, 1843, 14, 0, 6, 8, 4, 7},
+    {0x00B4, 1849, 14, 0, 5, 4, 5, 12},
+    {0x00B5, 1852, 14, 0, 9, 15, 2, -5},
+    {0x00B6, 1869, 14, 0, 9, 15, 2, 0},
+    {0x00B7, 1886, 14, 0, 4, 4, 5, 6},
+    {0x00B8, 1888, 14, 0, 6, 6, 4, -6},
+    {0x00B9, 1893, 14, 0, 6, 8, 4, 7},
+    {0x00BA, 1899, 14, 0, 8, 11, 3, 5},
+    {0x00BB, 1910, 14, 0, 10, 11, 2, 0},
+    {0x00BC, 1924, 14, 0, 13, 19, 0, -5},
+    {0x00BD, 1955, 14, 0, 13, 19, 0, -5},
+    {0x00BE, 1986, 14, 0, 13, 19, 0, -5},
+    {0x00BF, 2017, 14, 0, 10, 16, 2, 0},
+    {0x00C0, 2037, 14, 0, 11, 21, 1, 0},
+    {0x00C1, 2066, 14, 0, 11, 21, 1, 0},
+    {0x00C2, 2095, 14, 0, 11, 21, 1, 0},
+    {0x00C3, 2124, 14, 0, 11, 21, 1, 0},
+    {0x00C4, 2153, 14, 0, 11, 20, 1, 0},
+    {0x00C5, 2181, 14, 0, 11, 18, 1, 0},
+    {0x00C6, 2206, 14, 0, 13, 15, 0, 0},
+    {0x00C7, 2231, 14, 0, 11, 21, 1, -6},
+    {0x00C8, 2260, 14, 0, 10, 21, 2, 0},
+    {0x00C9, 2287, 14, 0, 10, 20, 2, 1},
+    {0x00CA, 2312, 14, 0, 10, 21, 2, 0},
+    {0x00CB, 2339, 14, 0, 10, 20, 2, 0},
+    {0x00CC, 2364, 14, 0, 8, 20, 3, 1},
+    {0x00CD, 2384, 14, 0, 8, 21, 3, 0},
+    {0x00CE, 2405, 14, 0, 8, 21, 3, 0},
+    {0x00CF, 2426, 14, 0, 8, 20, 3, 0},
+    {0x00D0, 2446, 14, 0, 11, 15, 1, 0},
+    {0x00D1, 2467, 14, 0, 10, 21, 2, 0},
+    {0x00D2, 2494, 14, 0, 11, 20, 1, 1},
+    {0x00D3, 2522, 14, 0, 11, 20, 1, 1},
+    {0x00D4, 2550, 14, 0, 11, 20, 1, 0},
+    {0x00D5, 2578, 14, 0, 11, 20, 1, 1},
+    {0x00D6, 2606, 14, 0, 11, 20, 1, 0},
+    {0x00D7, 2634, 14, 0, 9, 10, 2, 2},
+    {0x00D8, 2646, 14, 0, 11, 17, 1, -1},
+    {0x00D9, 2670, 14, 0, 10, 20, 2, 1},
+    {0x00DA, 2695, 14, 0, 10, 20, 2, 1},
+    {0x00DB, 2720, 14, 0, 10, 21, 2, 0},
+    {0x00DC, 2747, 14, 0, 10, 20, 2, 0},
+    {0x00DD, 2772, 14, 0, 11, 20, 1, 1},
+    {0x00DE, 2800, 14, 0, 11, 15, 2, 0},
+    {0x00DF, 2821, 14, 0, 10, 16, 2, 0},
+    {0x00E0, 2841, 14, 0, 12, 15, 1, 1},
+    {0x00E1, 2864, 14, 0, 12, 15, 1, 1},
+    {0x00E2, 2887, 14, 0, 12, 17, 1, 0},
+    {0x00E3, 2913, 14, 0, 12, 15, 1, 1},
+    {0x00E4, 2936, 14, 0, 12, 14, 1, 0},
+    {0x00E5, 2957, 14, 0, 12, 16, 1, 1},
+    {0x00E6, 2981, 14, 0, 12, 10, 1, 0},
+    {0x00E7, 2996, 14, 0, 10, 16, 2, -6},
+    {0x00E8, 3016, 14, 0, 10, 15, 2, 1},
+    {0x00E9, 3035, 14, 0, 10, 15, 2, 1},
+    {0x00EA, 3054, 14, 0, 10, 16, 2, 0},
+    {0x00EB, 3074, 14, 0, 10, 14, 2, 0},
+    {0x00EC, 3092, 14, 0, 9, 16, 3, 0},
+    {0x00ED, 3110, 14, 0, 9, 16, 3, 0},
+    {0x00EE, 3128, 14, 0, 9, 17, 3, 0},
+    {0x00EF, 3148, 14, 0, 9, 14, 3, 0},
+    {0x00F0, 3164, 14, 0, 11, 16, 1, 1},
+    {0x00F1, 3186, 14, 0, 9, 15, 2, 1},
+    {0x00F2, 3203, 14, 0, 11, 15, 1, 1},
+    {0x00F3, 3224, 14, 0, 11, 15, 1, 1},
+    {0x00F4, 3245, 14, 0, 11, 16, 1, 0},
+    {0x00F5, 3267, 14, 0, 11, 15, 1, 1},
+    {0x00F6, 3288, 14, 0, 11, 14, 1, 0},
+    {0x00F7, 3308, 14, 0, 10, 12, 2, 1},
+    {0x00F8, 3323, 14, 0, 11, 12, 1, -1},
+    {0x00F9, 3340, 14, 0, 9, 15, 2, 1},
+    {0x00FA, 3357, 14, 0, 9, 15, 2, 1},
+    {0x00FB, 3374, 14, 0, 9, 17, 2, 0},
+    {0x00FC, 3394, 14, 0, 9, 14, 2, 0},
+    {0x00FD, 3410, 14, 0, 11, 20, 1, -4},
+    {0x00FE, 3438, 14, 0, 10, 21, 2, -5},
+    {0x00FF, 3465, 14, 0, 11, 19, 1, -5},
+    {0x0100, 3492, 14, 0, 11, 18, 1, 0},
+    {0x0101, 3517, 14, 0, 12, 14, 1, 0},
+    {0x0102, 3538, 14, 0, 11, 21, 1, 0},
+    {0x0103, 3567, 14, 0, 12, 15, 1, 1},
+    {0x0104, 3590, 14, 0, 12, 20, 1, -5},
+    {0x0105, 3620, 14, 0, 12, 15, 1, -5},
+    {0x0106, 3643, 14, 0, 11, 20, 1, 1},
+    {0x0107, 3671, 14, 0, 10, 15, 2, 1},
+    {0x0108, 3690, 14, 0, 11, 20, 1, 0},
+    {0x0109, 3718, 14, 0, 10, 16, 2, 0},
+    {0x010A, 3738, 14, 0, 11, 19, 1, 0},
+    {0x010B, 3765, 14, 0, 10, 15, 2, 0},
+    {0x010C, 3784, 14, 0, 11, 20, 1, 1},
+    {0x010D, 3812, 14, 0, 10, 16, 2, 1},
+    {0x010E, 3832, 14, 0, 10, 21, 2, 0},
+    {0x010F, 3859, 14, 0, 15, 18, 1, 0},
+    {0x0110, 3893, 14, 0, 11, 15, 1, 0},
+    {0x0111, 3914, 14, 0, 12, 16, 1, 0},
+    {0x0112, 3938, 14, 0, 10, 19, 2, 0},
+    {0x0113, 3962, 14, 0, 10, 14, 2, 0},
+    {0x0114, 3980, 14, 0, 10, 21, 2, 0},
+    {0x0115, 4007, 14, 0, 10, 15, 2, 1},
+    {0x0116, 4026, 14, 0, 10, 20, 2, 0},
+    {0x0117, 4051, 14, 0, 10, 15, 2, 0},
+    {0x0118, 4070, 14, 0, 10, 20, 2, -5},
+    {0x0119, 4095, 14, 0, 10, 15, 2, -5},
+    {0x011A, 4114, 14, 0, 10, 21, 2, 0},
+    {0x011B, 4141, 14, 0, 10, 16, 2, 1},
+    {0x011C, 4161, 14, 0, 11, 21, 1, 0},
+    {0x011D, 4190, 14, 0, 10, 22, 1, -5},
+    {0x011E, 4218, 14, 0, 11, 20, 1, 1},
+    {0x011F, 4246, 14, 0, 10, 20, 1, -4},
+    {0x0120, 4271, 14, 0, 11, 20, 1, 0},
+    {0x0121, 4299, 14, 0, 10, 20, 1, -5},
+    {0x0122, 4324, 14, 0, 11, 22, 1, -7},
+    {0x0123, 4355, 14, 0, 10, 21, 1, -4},
+    {0x0124, 4382, 14, 0, 9, 21, 2, 0},
+    {0x0125, 4406, 14, 0, 12, 22, -1, 0},
+    {0x0126, 4439, 14, 0, 12, 15, 1, 0},
+    {0x0127, 4462, 14, 0, 10, 16, 1, 0},
+    {0x0128, 4482, 14, 0, 9, 21, 2, 0},
+    {0x0129, 4506, 14, 0, 9, 16, 3, 0},
+    {0x012A, 4524, 14, 0, 8, 19, 3, 0},
+    {0x012B, 4543, 14, 0, 9, 14, 3, 0},
+    {0x012C, 4559, 14, 0, 8, 21, 3, 0},
+    {0x012D, 4580, 14, 0, 9, 16, 3, 0},
+    {0x012E, 4598, 14, 0, 8, 20, 3, -5},
+    {0x012F, 4618, 14, 0, 9, 21, 3, -5},
+    {0x0130, 4642, 14, 0, 8, 20, 3, 0},
+    {0x0131, 4662, 14, 0, 9, 10, 3, 0},
+    {0x0134, 4674, 14, 0, 13, 21, 1, 0},
+    {0x0135, 4709, 14, 0, 10, 22, 2, -5},
+    {0x0136, 4737, 14, 0, 11, 22, 2, -7},
+    {0x0137, 4768, 14, 0, 10, 23, 2, -7},
+    {0x0139, 4797, 14, 0, 10, 20, 2, 1},
+    {0x013A, 4822, 14, 0, 11, 22, 1, 0},
+    {0x013B, 4853, 14, 0, 10, 22, 2, -7},
+    {0x013C, 4881, 14, 0, 11, 23, 1, -7},
+    {0x013D, 4913, 14, 0, 10, 15, 2, 0},
+    {0x013E, 4932, 14, 0, 11, 18, 1, 0},
+    {0x013F, 4957, 14, 0, 10, 15, 2, 0},
+    {0x0140, 4976, 14, 0, 14, 16, 1, 0},
+    {0x0141, 5004, 14, 0, 11, 15, 1, 0},
+    {0x0142, 5025, 14, 0, 11, 16, 1, 0},
+    {0x0143, 5047, 14, 0, 10, 20, 2, 1},
+    {0x0144, 5072, 14, 0, 9, 15, 2, 1},
+    {0x0145, 5089, 14, 0, 10, 22, 2, -7},
+    {0x0146, 5117, 14, 0, 9, 17, 2, -7},
+    {0x0147, 5137, 14, 0, 10, 20, 2, 1},
+    {0x0148, 5162, 14, 0, 9, 16, 2, 1},
+    {0x014A, 5180, 14, 0, 10, 21, 2, -6},
+    {0x014B, 5207, 14, 0, 9, 15, 2, -5},
+    {0x014C, 5224, 14, 0, 11, 19, 1, 0},
+    {0x014D, 5251, 14, 0, 11, 14, 1, 0},
+    {0x014E, 5271, 14, 0, 11, 20, 1, 1},
+    {0x014F, 5299, 14, 0, 11, 15, 1, 1},
+    {0x0150, 5320, 14, 0, 11, 20, 1, 1},
+    {0x0151, 5348, 14, 0, 11, 15, 1, 1},
+    {0x0152, 5369, 14, 0, 12, 15, 1, 0},
+    {0x0153, 5392, 14, 0, 12, 10, 1, 0},
+    {0x0154, 5407, 14, 0, 10, 20, 2, 1},
+    {0x0155, 5432, 14, 0, 11, 16, 1, 0},
+    {0x0156, 5454, 14, 0, 10, 22, 2, -7},
+    {0x0157, 5482, 14, 0, 11, 17, 1, -7},
+    {0x0158, 5506, 14, 0, 10, 21, 2, 0},
+    {0x0159, 5533, 14, 0, 11, 17, 1, 0},
+    {0x015A, 5557, 14, 0, 10, 20, 2, 1},
+    {0x015B, 5582, 14, 0, 9, 15, 2, 1},
+    {0x015C, 5599, 14, 0, 10, 20, 2, 1},
+    {0x015D, 5624, 14, 0, 9, 17, 2, 0},
+    {0x015E, 5644, 14, 0, 10, 21, 2, -6},
+    {0x015F, 5671, 14, 0, 9, 16, 2, -6},
+    {0x0160, 5689, 14, 0, 10, 20, 2, 1},
+    {0x0161, 5714, 14, 0, 9, 16, 2, 1},
+    {0x0162, 5732, 14, 0, 11, 21, 1, -6},
+    {0x0163, 5761, 14, 0, 11, 20, 1, -6},
+    {0x0164, 5789, 14, 0, 11, 21, 1, 0},
+    {0x0165, 5818, 14, 0, 11, 17, 1, 0},
+    {0x0166, 5842, 14, 0, 11, 15, 1, 0},
+    {0x0167, 5863, 14, 0, 11, 14, 1, 0},
+    {0x0168, 5883, 14, 0, 10, 21, 2, 0},
+    {0x0169, 5910, 14, 0, 9, 16, 2, 0},
+    {0x016A, 5928, 14, 0, 10, 19, 2, 0},
+    {0x016B, 5952, 14, 0, 9, 14, 2, 0},
+    {0x016C, 5968, 14, 0, 10, 20, 2, 1},
+    {0x016D, 5993, 14, 0, 9, 16, 2, 0},
+    {0x016E, 6011, 14, 0, 10, 21, 2, 1},
+    {0x016F, 6038, 14, 0, 9, 16, 2, 1},
+    {0x0170, 6056, 14, 0, 10, 20, 2, 1},
+    {0x0171, 6081, 14, 0, 9, 16, 2, 0},
+    {0x0172, 6099, 14, 0, 10, 20, 2, -5},
+    {0x0173, 6124, 14, 0, 10, 15, 2, -5},
+    {0x0174, 6143, 14, 0, 11, 21, 1, 0},
+    {0x0175, 6172, 14, 0, 11, 17, 1, 0},
+    {0x0176, 6196, 14, 0, 11, 21, 1, 0},
+    {0x0177, 6225, 14, 0, 11, 22, 1, -5},
+    {0x0178, 6256, 14, 0, 11, 20, 1, 0},
+    {0x0179, 6284, 14, 0, 11, 21, 1, 0},
+    {0x017A, 6313, 14, 0, 10, 16, 2, 0},
+    {0x017B, 6333, 14, 0, 11, 20, 1, 0},
+    {0x017C, 6361, 14, 0, 10, 15, 2, 0},
+    {0x017D, 6380, 14, 0, 11, 21, 1, 0},
+    {0x017E, 6409, 14, 0, 10, 17, 2, 0},
+    {0x018F, 6431, 14, 0, 11, 15, 1, 0},
+    {0x01A0, 6452, 14, 0, 12, 17, 1, 0},
+    {0x01A1, 6478, 14, 0, 12, 12, 1, 0},
+    {0x01AF, 6496, 14, 0, 13, 17, 2, 0},
+    {0x01B0, 6524, 14, 0, 12, 12, 2, 0},
+    {0x01CD, 6542, 14, 0, 11, 21, 1, 0},
+    {0x01CE, 6571, 14, 0, 12, 16, 1, 1},
+    {0x01CF, 6595, 14, 0, 8, 21, 3, 0},
+    {0x01D0, 6616, 14, 0, 9, 16, 3, 1},
+    {0x01D1, 6634, 14, 0, 11, 20, 1, 1},
+    {0x01D2, 6662, 14, 0, 11, 16, 1, 1},
+    {0x01D3, 6684, 14, 0, 10, 20, 2, 1},
+    {0x01D4, 6709, 14, 0, 9, 16, 2, 1},
+    {0x01D5, 6727, 14, 0, 10, 23, 2, 0},
+    {0x01D6, 6756, 14, 0, 9, 18, 2, 0},
+    {0x01D7, 6777, 14, 0, 10, 24, 2, 0},
+    {0x01D8, 6807, 14, 0, 9, 20, 2, 0},
+    {0x01D9, 6830, 14, 0, 10, 24, 2, 0},
+    {0x01DA, 6860, 14, 0, 9, 19, 2, 0},
+    {0x01DB, 6882, 14, 0, 10, 24, 2, 0},
+    {0x01DC, 6912, 14, 0, 9, 20, 2, 0},
+    {0x01E6, 6935, 14, 0, 11, 20, 1, 1},
+    {0x01E7, 6963, 14, 0, 10, 21, 1, -4},
+    {0x01EA, 6990, 14, 0, 11, 20, 1, -5},
+    {0x01EB, 7018, 14, 0, 11, 15, 1, -5},
+    {0x01F0, 7039, 14, 0, 10, 22, 2, -5},
+    {0x01F8, 7067, 14, 0, 10, 20, 2, 1},
+    {0x01F9, 7092, 14, 0, 9, 15, 2, 1},
+    {0x0218, 7109, 14, 0, 10, 22, 2, -7},
+    {0x0219, 7137, 14, 0, 9, 17, 2, -7},
+    {0x021A, 7157, 14, 0, 11, 22, 1, -7},
+    {0x021B, 7188, 14, 0, 11, 21, 1, -7},
+    {0x0226, 7217, 14, 0, 11, 20, 1, 0},
+    {0x0227, 7245, 14, 0, 12, 15, 1, 0},
+    {0x022E, 7268, 14, 0, 11, 20, 1, 0},
+    {0x022F, 7296, 14, 0, 11, 15, 1, 0},
+    {0x0232, 7317, 14, 0, 11, 19, 1, 0},
+    {0x0233, 7344, 14, 0, 11, 19, 1, -5},
+    {0x0237, 7371, 14, 0, 7, 15, 2, -5},
+    {0x0259, 7385, 14, 0, 10, 10, 2, 0},
+    {0x02B9, 7398, 14, 0, 3, 7, 5, 9},
+    {0x02BA, 7401, 14, 0, 8, 7, 3, 9},
+    {0x02BB, 7408, 14, 0, 5, 6, 4, 10},
+    {0x02BC, 7412, 14, 0, 5, 6, 4, 10},
+    {0x02BE, 7416, 14, 0, 5, 9, 4, 7},
+    {0x02BF, 7422, 14, 0, 6, 9, 3, 7},
+    {0x02C6, 7429, 14, 0, 7, 5, 3, 12},
+    {0x02C7, 7434, 14, 0, 7, 5, 3, 12},
+    {0x02C8, 7439, 14, 0, 2, 9, 6, 7},
+    {0x02CC, 7442, 14, 0, 2, 9, 6, -5},
+    {0x02CD, 7445, 14, 0, 7, 1, 3, -4},
+    {0x02D8, 7446, 14, 0, 8, 4, 3, 12},
+    {0x02D9, 7450, 14, 0, 3, 3, 5, 12},
+    {0x02DA, 7452, 14, 0, 6, 5, 4, 12},
+    {0x02DB, 7456, 14, 0, 5, 5, 4, -5},
+    {0x02DC, 7460, 14, 0, 9, 4, 2, 12},
+    {0x02DD, 7465, 14, 0, 8, 4, 3, 12},
+    {0x0300, 7469, 0, 0, 5, 4, -3, 12},
+    {0x0301, 7472, 0, 0, 5, 4, -2, 12},
+    {0x0302, 7475, 0, 0, 8, 5, -4, 12},
+    {0x0303, 7480, 0, 0, 8, 4, -4, 12},
+    {0x0304, 7484, 0, 0, 8, 1, -4, 13},
+    {0x0306, 7485, 0, 0, 8, 4, -4, 12},
+    {0x0307, 7489, 0, 0, 2, 3, -1, 12},
+    {0x0308, 7490, 0, 0, 8, 2, -4, 12},
+    {0x0309, 7492, 0, 0, 4, 5, -2, 12},
+    {0x030A, 7495, 0, 0, 6, 5, -3, 12},
+    {0x030B, 7499, 0, 0, 8, 4, -4, 12},
+    {0x030C, 7503, 0, 0, 8, 5, -4, 12},
+    {0x0312, 7508, 0, 0, 4, 5, -2, 12},
+    {0x0315, 7511, 0, 0, 2, 5, 0, 11},
+    {0x0323, 7513, 0, 0, 2, 3, -1, -5},
+    {0x0324, 7514, 0, 0, 8, 2, -4, -4},
+    {0x0326, 7516, 0, 0, 4, 5, -2, -7},
+    {0x0327, 7519, 0, 0, 5, 6, -2, -6},
+    {0x0328, 7523, 0, 0, 4, 5, -2, -5},
+    {0x032D, 7526, 0, 0, 8, 5, -4, -7},
+    {0x032E, 7531, 0, 0, 8, 4, -4, -6},
+    {0x0331, 7535, 0, 0, 8, 1, -4, -4},
+    {0x0E3F, 7536, 14, 0, 10, 21, 2, -3},
+    {0x1E06, 7563, 14, 0, 10, 19, 2, -4},
+    {0x1E07, 7587, 14, 0, 10, 20, 2, -4},
+    {0x1E0C, 7612, 14, 0, 10, 20, 2, -5},
+    {0x1E0D, 7637, 14, 0, 10, 21, 1, -5},
+    {0x1E0E, 7664, 14, 0, 10, 19, 2, -4},
+    {0x1E0F, 7688, 14, 0, 10, 20, 1, -4},
+    {0x1E12, 7713, 14, 0, 10, 22, 2, -7},
+    {0x1E13, 7741, 14, 0, 10, 23, 1, -7},
+    {0x1E20, 7770, 14, 0, 11, 19, 1, 0},
+    {0x1E21, 7797, 14, 0, 10, 19, 1, -5},
+    {0x1E24, 7821, 14, 0, 9, 20, 2, -5},
+    {0x1E25, 7844, 14, 0, 9, 21, 2, -5},
+    {0x1E28, 7868, 14, 0, 10, 21, 1, -6},
+    {0x1E29, 7895, 14, 0, 10, 22, 1, -6},
+    {0x1E2A, 7923, 14, 0, 9, 21, 2, -6},
+    {0x1E2B, 7947, 14, 0, 9, 22, 2, -6},
+    {0x1E32, 7972, 14, 0, 11, 20, 2, -5},
+    {0x1E33, 8000, 14, 0, 10, 21, 2, -5},
+    {0x1E34, 8027, 14, 0, 11, 19, 2, -4},
+    {0x1E35, 8054, 14, 0, 10, 20, 2, -4},
+    {0x1E36, 8079, 14, 0, 10, 20, 2, -5},
+    {0x1E37, 8104, 14, 0, 11, 21, 1, -5},
+    {0x1E38, 8133, 14, 0, 12, 24, 0, -5},
+    {0x1E39, 8169, 14, 0, 11, 25, 1, -5},
+    {0x1E3A, 8204, 14, 0, 10, 19, 2, -4},
+    {0x1E3B, 8228, 14, 0, 11, 20, 1, -4},
+    {0x1E3C, 8256, 14, 0, 10, 22, 2, -7},
+    {0x1E3D, 8284, 14, 0, 11, 23, 1, -7},
+    {0x1E3E, 8316, 14, 0, 11, 20, 1, 1},
+    {0x1E3F, 8344, 14, 0, 11, 15, 1, 1},
+    {0x1E40, 8365, 14, 0, 11, 20, 1, 0},
+    {0x1E41, 8393, 14, 0, 11, 15, 1, 0},
+    {0x1E42, 8414, 14, 0, 11, 20, 1, -5},
+    {0x1E43, 8442, 14, 0, 11, 15, 1, -5},
+    {0x1E44, 8463, 14, 0, 10, 20, 2, 0},
+    {0x1E45, 8488, 14, 0, 9, 15, 2, 0},
+    {0x1E46, 8505, 14, 0, 10, 20, 2, -5},
+    {0x1E47, 8530, 14, 0, 9, 15, 2, -5},
+    {0x1E48, 8547, 14, 0, 10, 19, 2, -4},
+    {0x1E49, 8571, 14, 0, 9, 14, 2, -4},
+    {0x1E4A, 8587, 14, 0, 10, 22, 2, -7},
+    {0x1E4B, 8615, 14, 0, 9, 17, 2, -7},
+    {0x1E58, 8635, 14, 0, 10, 20, 2, 0},
+    {0x1E59, 8660, 14, 0, 11, 15, 1, 0},
+    {0x1E5A, 8681, 14, 0, 10, 20, 2, -5},
+    {0x1E5B, 8706, 14, 0, 11, 15, 1, -5},
+    {0x1E5C, 8727, 14, 0, 10, 23, 2, -5},
+    {0x1E5D, 8756, 14, 0, 11, 19, 1, -5},
+    {0x1E5E, 8783, 14, 0, 10, 19, 2, -4},
+    {0x1E5F, 8807, 14, 0, 11, 14, 1, -4},
+    {0x1E62, 8827, 14, 0, 10, 20, 2, -5},
+    {0x1E63, 8852, 14, 0, 9, 15, 2, -5},
+    {0x1E6C, 8869, 14, 0, 11, 20, 1, -5},
+    {0x1E6D, 8897, 14, 0, 11, 19, 1, -5},
+    {0x1E6E, 8924, 14, 0, 11, 19, 1, -4},
+    {0x1E6F, 8951, 14, 0, 11, 18, 1, -4},
+    {0x1E70, 8976, 14, 0, 11, 22, 1, -7},
+    {0x1E71, 9007, 14, 0, 11, 21, 1, -7},
+    {0x1E7E, 9036, 14, 0, 11, 20, 1, -5},
+    {0x1E7F, 9064, 14, 0, 11, 15, 1, -5},
+    {0x1E80, 9085, 14, 0, 11, 20, 1, 1},
+    {0x1E81, 9113, 14, 0, 11, 15, 1, 1},
+    {0x1E82, 9134, 14, 0, 11, 20, 1, 1},
+    {0x1E83, 9162, 14, 0, 11, 15, 1, 1},
+    {0x1E84, 9183, 14, 0, 11, 20, 1, 0},
+    {0x1E85, 9211, 14, 0, 11, 14, 1, 0},
+    {0x1E8C, 9231, 14, 0, 11, 20, 1, 0},
+    {0x1E8D, 9259, 14, 0, 10, 14, 2, 0},
+    {0x1E8E, 9277, 14, 0, 11, 20, 1, 0},
+    {0x1E8F, 9305, 14, 0, 11, 20, 1, -5},
+    {0x1E90, 9333, 14, 0, 11, 21, 1, 0},
+    {0x1E91, 9362, 14, 0, 10, 17, 2, 0},
+    {0x1E92, 9384, 14, 0, 11, 20, 1, -5},
+    {0x1E93, 9412, 14, 0, 10, 15, 2, -5},
+    {0x1E94, 9431, 14, 0, 11, 19, 1, -4},
+    {0x1E95, 9458, 14, 0, 10, 14, 2, -4},
+    {0x1E96, 9476, 14, 0, 9, 20, 2, -4},
+    {0x1E9E, 9499, 14, 0, 11, 15, 2, 0},
+    {0x1EA0, 9520, 14, 0, 11, 20, 1, -5},
+    {0x1EA1, 9548, 14, 0, 12, 15, 1, -5},
+    {0x1EA2, 9571, 14, 0, 11, 21, 1, 0},
+    {0x1EA3, 9600, 14, 0, 12, 16, 1, 1},
+    {0x1EA4, 9624, 14, 0, 12, 23, 1, 1},
+    {0x1EA5, 9659, 14, 0, 12, 18, 1, 1},
+    {0x1EA6, 9686, 14, 0, 11, 23, 1, 1},
+    {0x1EA7, 9718, 14, 0, 12, 18, 1, 1},
+    {0x1EA8, 9745, 14, 0, 12, 24, 1, 1},
+    {0x1EA9, 9781, 14, 0, 12, 19, 1, 1},
+    {0x1EAA, 9810, 14, 0, 11, 25, 1, 0},
+    {0x1EAB, 9845, 14, 0, 12, 19, 1, 1},
+    {0x1EAC, 9874, 14, 0, 11, 26, 1, -5},
+    {0x1EAD, 9910, 14, 0, 12, 22, 1, -5},
+    {0x1EAE, 9943, 14, 0, 11, 24, 1, 1},
+    {0x1EAF, 9976, 14, 0, 12, 19, 1, 1},
+    {0x1EB0, 10005, 14, 0, 11, 25, 1, 0},
+    {0x1EB1, 10040, 14, 0, 12, 19, 1, 1},
+    {0x1EB2, 10069, 14, 0, 11, 25, 1, 0},
+    {0x1EB3, 10104, 14, 0, 12, 19, 1, 1},
+    {0x1EB4, 10133, 14, 0, 11, 25, 1, 0},
+    {0x1EB5, 10168, 14, 0, 12, 19, 1, 1},
+    {0x1EB6, 10197, 14, 0, 11, 26, 1, -5},
+    {0x1EB7, 10233, 14, 0, 12, 20, 1, -4},
+    {0x1EB8, 10263, 14, 0, 10, 20, 2, -5},
+    {0x1EB9, 10288, 14, 0, 10, 15, 2, -5},
+    {0x1EBA, 10307, 14, 0, 10, 21, 2, 0},
+    {0x1EBB, 10334, 14, 0, 10, 16, 2, 1},
+    {0x1EBC, 10354, 14, 0, 10, 21, 2, 0},
+    {0x1EBD, 10381, 14, 0, 10, 15, 2, 1},
+    {0x1EBE, 10400, 14, 0, 11, 24, 2, 0},
+    {0x1EBF, 10433, 14, 0, 11, 18, 2, 0},
+    {0x1EC0, 10458, 14, 0, 10, 23, 2, 1},
+    {0x1EC1, 10487, 14, 0, 10, 18, 2, 0},
+    {0x1EC2, 10510, 14, 0, 11, 25, 2, 0},
+    {0x1EC3, 10545, 14, 0, 11, 19, 2, 0},
+    {0x1EC4, 10572, 14, 0, 10, 25, 2, 0},
+    {0x1EC5, 10604, 14, 0, 10, 19, 2, 0},
+    {0x1EC6, 10628, 14, 0, 10, 26, 2, -5},
+    {0x1EC7, 10661, 14, 0, 10, 21, 2, -5},
+    {0x1EC8, 10688, 14, 0, 8, 21, 3, 0},
+    {0x1EC9, 10709, 14, 0, 9, 17, 3, 0},
+    {0x1ECA, 10729, 14, 0, 8, 20, 3, -5},
+    {0x1ECB, 10749, 14, 0, 9, 21, 3, -5},
+    {0x1ECC, 10773, 14, 0, 11, 20, 1, -5},
+    {0x1ECD, 10801, 14, 0, 11, 15, 1, -5},
+    {0x1ECE, 10822, 14, 0, 11, 20, 1, 1},
+    {0x1ECF, 10850, 14, 0, 11, 16, 1, 1},
+    {0x1ED0, 10872, 14, 0, 12, 23, 1, 0},
+    {0x1ED1, 10907, 14, 0, 12, 18, 1, 0},
+    {0x1ED2, 10934, 14, 0, 11, 23, 1, 0},
+    {0x1ED3, 10966, 14, 0, 11, 18, 1, 0},
+    {0x1ED4, 10991, 14, 0, 12, 24, 1, 0},
+    {0x1ED5, 11027, 14, 0, 12, 19, 1, 0},
+    {0x1ED6, 11056, 14, 0, 11, 24, 1, 0},
+    {0x1ED7, 11089, 14, 0, 11, 19, 1, 0},
+    {0x1ED8, 11116, 14, 0, 11, 25, 1, -5},
+    {0x1ED9, 11151, 14, 0, 11, 21, 1, -5},
+    {0x1EDA, 11180, 14, 0, 12, 21, 1, 0},
+    {0x1EDB, 11212, 14, 0, 12, 16, 1, 0},
+    {0x1EDC, 11236, 14, 0, 12, 20, 1, 1},
+    {0x1EDD, 11266, 14, 0, 12, 15, 1, 1},
+    {0x1EDE, 11289, 14, 0, 12, 21, 1, 0},
+    {0x1EDF, 11321, 14, 0, 12, 17, 1, 0},
+    {0x1EE0, 11347, 14, 0, 12, 21, 1, 0},
+    {0x1EE1, 11379, 14, 0, 12, 16, 1, 0},
+    {0x1EE2, 11403, 14, 0, 12, 22, 1, -5},
+    {0x1EE3, 11436, 14, 0, 12, 17, 1, -5},
+    {0x1EE4, 11462, 14, 0, 10, 20, 2, -5},
+    {0x1EE5, 11487, 14, 0, 9, 15, 2, -5},
+    {0x1EE6, 11504, 14, 0, 10, 20, 2, 1},
+    {0x1EE7, 11529, 14, 0, 9, 16, 2, 1},
+    {0x1EE8, 11547, 14, 0, 13, 20, 2, 1},
+    {0x1EE9, 11580, 14, 0, 12, 15, 2, 1},
+    {0x1EEA, 11603, 14, 0, 13, 20, 2, 1},
+    {0x1EEB, 11636, 14, 0, 12, 15, 2, 1},
+    {0x1EEC, 11659, 14, 0, 13, 20, 2, 1},
+    {0x1EED, 11692, 14, 0, 12, 16, 2, 1},
+    {0x1EEE, 11716, 14, 0, 13, 21, 2, 0},
+    {0x1EEF, 11751, 14, 0, 12, 16, 2, 0},
+    {0x1EF0, 11775, 14, 0, 13, 22, 2, -5},
+    {0x1EF1, 11811, 14, 0, 12, 17, 2, -5},
+    {0x1EF2, 11837, 14, 0, 11, 20, 1, 1},
+    {0x1EF3, 11865, 14, 0, 11, 20, 1, -4},
+    {0x1EF4, 11893, 14, 0, 11, 20, 1, -5},
+    {0x1EF5, 11921, 14, 0, 11, 15, 1, -5},
+    {0x1EF6, 11942, 14, 0, 11, 20, 1, 1},
+    {0x1EF7, 11970, 14, 0, 11, 22, 1, -5},
+    {0x1EF8, 12001, 14, 0, 11, 21, 1, 0},
+    {0x1EF9, 12030, 14, 0, 11, 21, 1, -5},
+    {0x2011, 12059, 14, 0, 8, 2, 3, 5},
+    {0x2013, 12061, 14, 0, 10, 2, 2, 5},
+    {0x2014, 12064, 14, 0, 11, 2, 1, 5},
+    {0x2015, 12067, 14, 0, 11, 2, 1, 5},
+    {0x2018, 12070, 14, 0, 5, 6, 4, 10},
+    {0x2019, 12074, 14, 0, 5, 6, 4, 10},
+    {0x201A, 12078, 14, 0, 5, 6, 4, -3},
+    {0x201C, 12082, 14, 0, 10, 6, 2, 10},
+    {0x201D, 12090, 14, 0, 10, 6, 2, 10},
+    {0x201E, 12098, 14, 0, 10, 6, 2, -3},
+    {0x2020, 12106, 14, 0, 10, 16, 2, 0},
+    {0x2021, 12126, 14, 0, 10, 16, 2, 0},
+    {0x2022, 12146, 14, 0, 6, 6, 4, 4},
+    {0x2025, 12151, 14, 0, 10, 4, 2, 0},
+    {0x2026, 12156, 14, 0, 12, 3, 1, 0},
+    {0x2039, 12161, 14, 0, 7, 11, 3, 0},
+    {0x203A, 12171, 14, 0, 6, 11, 4, 0},
+    {0x2044, 12180, 14, 0, 13, 15, 0, 0},
+    {0x2070, 12205, 14, 0, 7, 8, 3, 7},
+    {0x2074, 12212, 14, 0, 7, 8, 3, 7},
+    {0x2075, 12219, 14, 0, 6, 8, 4, 7},
+    {0x2076, 12225, 14, 0, 6, 8, 4, 7},
+    {0x2077, 12231, 14, 0, 7, 8, 3, 7},
+    {0x2078, 12238, 14, 0, 6, 8, 4, 7},
+    {0x2079, 12244, 14, 0, 7, 8, 3, 7},
+    {0x2080, 12251, 14, 0, 7, 8, 3, -5},
+    {0x2081, 12258, 14, 0, 6, 8, 4, -5},
+    {0x2082, 12264, 14, 0, 6, 8, 4, -5},
+    {0x2083, 12270, 14, 0, 6, 8, 4, -5},
+    {0x2084, 12276, 14, 0, 7, 8, 3, -5},
+    {0x2085, 12283, 14, 0, 6, 8, 4, -5},
+    {0x2086, 12289, 14, 0, 6, 8, 4, -5},
+    {0x2087, 12295, 14, 0, 7, 8, 3, -5},
+    {0x2088, 12302, 14, 0, 6, 8, 4, -5},
+    {0x2089, 12308, 14, 0, 7, 8, 3, -5},
+    {0x20A6, 12315, 14, 0, 13, 15, 0, 0},
+    {0x20A9, 12340, 14, 0, 13, 15, 0, 0},
+    {0x20AB, 12365, 14, 0, 12, 18, 1, -3},
+    {0x20AC, 12392, 14, 0, 11, 15, 1, 0},
+    {0x20B1, 12413, 14, 0, 13, 15, 0, 0},
+    {0x20B9, 12438, 14, 0, 11, 15, 1, 0},
+    {0x20BA, 12459, 14, 0, 11, 15, 1, 0},
+    {0x20BD, 12480, 14, 0, 12, 15, 1, 0},
+    {0x2117, 12503, 14, 0, 11, 18, 1, -2},
+    {0x2120, 12528, 14, 0, 11, 7, 1, 9},
+    {0x2122, 12538, 14, 0, 11, 7, 1, 9},
+    {0x2153, 12548, 14, 0, 13, 19, 0, -5},
+    {0x2154, 12579, 14, 0, 13, 19, 0, -5},
+    {0x2155, 12610, 14, 0, 13, 19, 0, -5},
+    {0x2156, 12641, 14, 0, 13, 19, 0, -5},
+    {0x2157, 12672, 14, 0, 13, 19, 0, -5},
+    {0x2158, 12703, 14, 0, 13, 19, 0, -5},
+    {0x2159, 12734, 14, 0, 13, 19, 0, -5},
+    {0x215A, 12765, 14, 0, 13, 19, 0, -5},
+    {0x215B, 12796, 14, 0, 13, 19, 0, -5},
+    {0x215C, 12827, 14, 0, 13, 19, 0, -5},
+    {0x215D, 12858, 14, 0, 13, 19, 0, -5},
+    {0x215E, 12889, 14, 0, 13, 19, 0, -5},
+    {0x2212, 12920, 14, 0, 10, 2, 2, 6},
+    {0x2248, 12923, 14, 0, 12, 11, 1, 2},
+    {0x2260, 12940, 14, 0, 9, 13, 2, 1},
+    {0x2264, 12955, 14, 0, 9, 14, 2, 0},
+    {0x2265, 12971, 14, 0, 9, 14, 2, 0},
+    {0xA788, 12987, 14, 0, 7, 5, 3, -7},
+};
+
+static constexpr uint8_t intel_one_mono_16_pt_bitmaps[12993] = "\xff\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81\x81"
+                                                               "\x81\x81\x81\xff\xfe\xee\xe6\x66\x64\x00\x0e\xee"
+                                                               "\xc7\xc7\xc7\xc3\xc3\xc3\xc3\x0c\xc0\x8c\x08\xc0"
+                                                               "\x88\x7f\xf7\xff\x18\x81\x18\x11\x01\x10\xff\xef"
+                                                               "\xfe\x33\x02\x20\x22\x00\x0c\x03\x00\xc0\xfe\x7f"
+                                                               "\xb3\x0c\xc3\x30\xec\x1f\x01\xf0\x2e\x09\xc2\x30"
+                                                               "\x8c\x27\xff\x9f\xc0\xc0\x30\x0c\x00\x78\x34\xc6"
+                                                               "\xc4\x48\x4c\x84\x8c\x50\xcc\x07\x9c\x02\x61\x62"
+                                                               "\x16\x32\x63\x66\x24\x26\xc1\xc0\x0f\x81\xf8\x30"
+                                                               "\x03\x00\x18\x01\x84\x0c\x63\xe4\x66\xcc\x38\xc1"
+                                                               "\x8c\x1c\xc3\xc7\xe6\x3c\x70\xfd\xb6\xd8\x01\x07"
+                                                               "\x0e\x18\x30\x60\x60\xc0\xc0\xc0\x80\xc0\xc0\xc0"
+                                                               "\xe0\x60\x30\x18\x0e\x07\x01\x40\x70\x0e\x03\x80"
+                                                               "\xe0\x30\x0c\x06\x01\x80\xc0\x60\x30\x18\x18\x0c"
+                                                               "\x0c\x0e\x0e\x0e\x1c\x04\x00\x06\x00\xc0\x18\x32"
+                                                               "\x7f\xfe\x08\x02\xc0\xcc\x71\xc4\x10\x0c\x03\x00"
+                                                               "\xc0\x30\xff\xff\xf0\xc0\x30\x0c\x03\x00\xc0\x1c"
+                                                               "\xe3\x8c\x73\x80\xff\xff\x4f\xfe\x00\x60\x0c\x03"
+                                                               "\x00\x60\x18\x03\x00\xc0\x18\x06\x00\xc0\x30\x06"
+                                                               "\x01\x80\x30\x0c\x01\x80\x60\x0c\x03\x00\x00\x0f"
+                                                               "\x07\xf0\xc3\x30\x26\x06\x83\xd0\xde\x33\xdc\x6e"
+                                                               "\x0d\x81\xb0\x27\x0c\x7f\x07\xc0\x04\x07\x07\xc3"
+                                                               "\xb0\x8c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c"
+                                                               "\x1f\xf7\xfc\x1f\x1f\xee\x1a\x03\x00\xc0\x60\x18"
+                                                               "\x0c\x06\x03\x01\x80\xc0\x60\x3f\xff\xfc\xff\xbf"
+                                                               "\xe0\x30\x18\x0c\x07\x01\x80\xfc\x01\x80\x30\x0c"
+                                                               "\x07\x03\xbf\xcf\x80\x03\x80\x78\x07\x80\xd8\x19"
+                                                               "\x81\x98\x31\x82\x18\x61\x8c\x1f\xff\xf0\x18\x01"
+                                                               "\x80\x18\x01\x80\x7f\x9f\xe4\x01\x00\x40\x37\xcf"
+                                                               "\xfb\x06\x00\xc0\x30\x0c\x06\x03\x9f\xcf\xc0\x07"
+                                                               "\x03\x81\x80\xc0\x60\x1f\x8f\x7b\x06\xc0\xf0\x3c"
+                                                               "\x0f\x03\xe1\x9f\xc3\xe0\xff\xff\xfc\x03\x00\x60"
+                                                               "\x18\x03\x00\xc0\x18\x07\x00\xc0\x18\x06\x00\xc0"
+                                                               "\x30\x06\x00\x3e\x1f\xec\x1b\x06\xc1\x90\x67\x70"
+                                                               "\xf8\x61\xb0\x3c\x0f\x03\xc1\xdf\xe3\xe0\x3e\x1f"
+                                                               "\xce\x1b\x03\xc0\xf0\x3c\x0f\x03\x73\x8f\xe0\x30"
+                                                               "\x18\x0e\x07\x03\x80\xef\xf0\x00\x0f\xfe\x18\xf3"
+                                                               "\xc0\x00\x00\x0e\x38\xe3\x18\xc0\x00\x20\x3c\x1e"
+                                                               "\x0f\x07\x01\x80\x1e\x00\xf0\x07\x80\x3c\x00\x80"
+                                                               "\xff\xff\xc0\x00\x00\x07\xff\xfe\x80\x38\x07\x80"
+                                                               "\x3c\x03\xc0\x30\x3c\x3c\x78\x38\x08\x00\x3f\x3f"
+                                                               "\xe8\x0c\x03\x00\xc0\xe0\xf0\x70\x10\x04\x00\x00"
+                                                               "\x00\x00\x0e\x03\x80\xe0\x0f\x86\x18\x81\xa0\x14"
+                                                               "\x02\x8f\xf3\x0c\x61\x88\x31\x06\x20\xe6\x34\x7c"
+                                                               "\x80\x10\x01\x00\x30\x01\xf8\x0e\x01\xc0\x3c\x0d"
+                                                               "\x81\xb0\x33\x04\x61\x8c\x30\xc7\xf9\xff\x30\x36"
+                                                               "\x07\x80\xf0\x18\xff\x31\xec\x1f\x03\xc0\xf0\x6c"
+                                                               "\x73\xf8\xc1\xb0\x3c\x0f\x03\xc0\xf0\xff\xf0\x0f"
+                                                               "\x83\xfc\xc1\xb0\x06\x01\x80\x30\x06\x00\xc0\x18"
+                                                               "\x01\x80\x30\x07\x06\x7f\xc3\xe0\xfc\x3f\xcc\x3b"
+                                                               "\x07\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x06\xc3"
+                                                               "\xbf\x8f\x80\xff\xff\xfc\x03\x00\xc0\x30\x0f\xfb"
+                                                               "\xfe\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\xff\xff"
+                                                               "\xfc\x03\x00\xc0\x30\x0c\x03\xfe\xff\xb0\x0c\x03"
+                                                               "\x00\xc0\x30\x0c\x00\x07\xc3\xf8\xc0\x30\x06\x01"
+                                                               "\x80\x30\x06\x1f\xc3\xf8\x0d\x81\xb0\x37\x06\x7f"
+                                                               "\xc3\xf8\xc0\xe0\x70\x38\x1c\x0e\x07\xff\xff\xc0"
+                                                               "\xe0\x70\x38\x1c\x0e\x07\x02\xff\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\x18\x18\x18\x18\x18\x18\xff\x00\xc0"
+                                                               "\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0f"
+                                                               "\x03\x70\xcf\xf0\xf0\xc0\xd8\x33\x0e\x63\x8c\xe1"
+                                                               "\x98\x36\x07\x80\xd8\x19\x83\x18\x63\x8c\x39\x83"
+                                                               "\xb0\x38\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00"
+                                                               "\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x60\xee\x1d"
+                                                               "\xc3\xb8\xf5\x96\x92\xd2\xda\x73\x46\x68\x8d\x11"
+                                                               "\xe0\x3c\x07\x80\xf0\x18\xe0\xf8\x3f\x0f\xc3\xd0"
+                                                               "\xf6\x3d\x8f\x33\xcc\xf1\xbc\x6f\x0f\xc3\xf0\x7c"
+                                                               "\x1c\x1f\x07\xf1\xc3\x30\x36\x07\x80\xf0\x1e\x03"
+                                                               "\xc0\x78\x0d\x81\xb0\x37\x0c\x7f\x07\xc0\xff\x1f"
+                                                               "\xf3\x03\x60\x6c\x07\x80\xb0\x36\x06\xff\x9f\xe3"
+                                                               "\x00\x60\x0c\x01\x80\x30\x00\x1f\x03\xf8\x70\xc6"
+                                                               "\x06\x60\x6c\x06\xc0\x6c\x06\xc0\x6c\x26\x66\x66"
+                                                               "\x36\x71\xc3\xf8\x1f\xc0\x06\x00\x30\x03\xff\x3f"
+                                                               "\xec\x1f\x03\xc0\xf0\x3c\x1b\x7c\xf8\x33\x0c\x63"
+                                                               "\x0c\xc3\xb0\x7c\x0c\x3f\x9f\xec\x03\x00\xc0\x38"
+                                                               "\x07\x80\x7c\x03\x80\x70\x0c\x03\x81\xff\xe7\xf0"
+                                                               "\xff\xff\xfc\x18\x03\x00\x60\x0c\x01\x80\x30\x06"
+                                                               "\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\xc0\xf0\x3c"
+                                                               "\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03"
+                                                               "\xe1\x9f\xe3\xe0\xc0\x38\x0d\x81\xb0\x36\x0c\x61"
+                                                               "\x8c\x31\x8c\x11\x83\x30\x64\x05\x80\xf0\x1c\x03"
+                                                               "\x80\xc0\x38\x07\x01\xe2\x34\x46\x8c\xd9\x9b\x73"
+                                                               "\x6a\x4d\x69\xa5\x1c\xe3\x1c\x63\x8c\x70\x60\x6c"
+                                                               "\x18\xc3\x18\xc1\xb0\x1e\x03\x80\x30\x0f\x03\x60"
+                                                               "\x66\x18\xc3\x0c\xc1\xf0\x18\xc0\x6c\x0d\x83\x18"
+                                                               "\x63\x98\x36\x03\xc0\x70\x06\x00\xc0\x18\x03\x00"
+                                                               "\x60\x0c\x01\x80\x7f\xef\xfc\x03\x00\xc0\x38\x06"
+                                                               "\x01\x80\x70\x0c\x03\x00\x60\x18\x06\x00\xff\xff"
+                                                               "\xf8\xff\xff\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xc0"
+                                                               "\xc0\xc0\xc0\xc0\xc0\xc0\xc0\xff\xff\xc0\x0c\x01"
+                                                               "\x80\x18\x03\x00\x30\x06\x00\x60\x0c\x00\xc0\x18"
+                                                               "\x01\x80\x30\x03\x00\x60\x06\x00\xc0\x0c\x01\x80"
+                                                               "\xff\xfc\x18\x30\x60\xc1\x83\x06\x0c\x18\x30\x60"
+                                                               "\xc1\x83\x06\x0f\xff\xf0\x0e\x01\xe0\x6c\x0c\xc3"
+                                                               "\x18\x41\x98\x1e\x03\xff\xff\xf0\x8c\x71\x7f\x03"
+                                                               "\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f\xe3"
+                                                               "\xc7\xc0\x30\x0c\x03\x00\xc0\x30\x0c\xf3\xfe\xe1"
+                                                               "\xf0\x3c\x0f\x03\xc0\xf0\x7f\xfa\xf8\x1f\x1f\xfe"
+                                                               "\x0b\x00\xc0\x30\x0c\x03\x82\x7f\xcf\xc0\x00\x40"
+                                                               "\x10\x04\x01\x00\x40\x11\xf4\xff\x60\xd8\x1c\x07"
+                                                               "\x01\xc0\x58\x37\xf4\x79\x1e\x1f\xee\x1b\x03\xc0"
+                                                               "\xff\xfc\x03\x00\x7e\x0f\xc0\x07\xc3\xe1\x80\x60"
+                                                               "\x18\x06\x0f\xfb\xfe\x18\x06\x01\x80\x60\x18\x06"
+                                                               "\x01\x80\x60\x1f\x4f\xf6\x05\x81\xc0\x70\x1c\x05"
+                                                               "\x83\x7f\x47\x90\x04\x03\x00\xcf\xe3\xf0\xc0\x60"
+                                                               "\x30\x18\x0c\x06\x03\x3d\xbf\xf1\xf0\x70\x38\x1c"
+                                                               "\x0e\x07\x03\x81\x18\x1c\x06\x00\x00\x00\x03\xe1"
+                                                               "\xf0\x18\x0c\x06\x03\x01\x80\xc3\xff\xff\x06\x0f"
+                                                               "\x06\x00\x00\x00\x7e\x7e\x06\x06\x06\x06\x06\x06"
+                                                               "\x06\x06\x06\x06\x06\xfe\xf8\xc0\x30\x0c\x03\x00"
+                                                               "\xc0\x30\x0c\x1f\x0c\xc6\x37\x0f\x83\x60\xcc\x31"
+                                                               "\x8c\x3b\x07\xfc\x1f\x80\x30\x06\x00\xc0\x18\x03"
+                                                               "\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x1c\x01\xf8"
+                                                               "\x1f\xcc\xfb\xff\x9c\xe3\x1c\x63\x8c\x71\x8e\x31"
+                                                               "\xc6\x38\xc4\xcf\x6f\xfc\x7c\x1c\x0e\x07\x03\x81"
+                                                               "\xc0\xe0\x40\x1f\x07\xf9\x83\x30\x3c\x07\x80\xd8"
+                                                               "\x1b\x06\x3f\xc3\xe0\xcf\x3f\xee\x1f\x03\xc0\xf0"
+                                                               "\x3c\x0f\x07\xff\xb7\x8c\x03\x00\xc0\x30\x0c\x00"
+                                                               "\x1f\x4f\xf6\x05\x81\xc0\x70\x1c\x05\x83\x7f\x47"
+                                                               "\x90\x04\x01\x00\x40\x10\x04\x79\xef\x7c\x78\x0e"
+                                                               "\x01\x80\x30\x06\x00\xc0\xff\x1f\xe0\x3f\xbf\xf0"
+                                                               "\x1c\x07\xe0\x7c\x06\x01\xff\xff\x80\x0c\x01\x80"
+                                                               "\x30\x06\x0f\xfd\xff\x83\x00\x60\x0c\x01\x80\x30"
+                                                               "\x06\x00\xfe\x0f\xc0\xc0\xe0\x70\x38\x1c\x0e\x07"
+                                                               "\x07\x87\xfe\xbc\x40\xe0\x6c\x0d\x83\x18\x63\x18"
+                                                               "\x33\x06\x40\x58\x0f\x01\xc0\xc0\x38\x8f\x11\xa3"
+                                                               "\x36\xe6\xd4\x9a\xd1\xce\x31\xc6\x38\xc1\x98\xe3"
+                                                               "\x30\x78\x1c\x07\x03\x61\x8c\x61\xb0\x70\xe0\x6c"
+                                                               "\x0d\x83\x18\x63\x18\x33\x06\x40\x78\x0f\x01\xc0"
+                                                               "\x18\x06\x00\xc1\xf0\x3c\x00\xff\xff\xe0\x30\x18"
+                                                               "\x0c\x06\x03\x01\x80\xff\xff\xf0\x03\xc7\xf3\x80"
+                                                               "\xe0\x18\x03\x00\x60\x18\x0e\x3e\x08\x03\xe0\x1e"
+                                                               "\x01\x80\x60\x30\x18\x0e\x03\x80\x7f\x03\xc0\xff"
+                                                               "\xff\xff\xff\xfc\x70\x1f\xe0\x0c\x01\x80\x60\x1c"
+                                                               "\x07\x00\xc0\x0e\x00\x78\x01\x81\xe0\xe0\x30\x07"
+                                                               "\x00\x70\x06\x00\x60\x0c\x7f\x87\x00\x30\x37\xc2"
+                                                               "\x4e\x6c\x3c\xc1\xc0\xef\x60\x00\x46\x66\x6e\xee"
+                                                               "\xef\x04\x01\x00\x40\x7c\x7f\xf9\x2c\x43\x10\x84"
+                                                               "\x31\x0c\x43\x92\x7f\xcf\xc0\x40\x10\x04\x00\x3e"
+                                                               "\x1f\xec\x1f\x02\xc0\x18\x03\x00\x60\xff\x86\x03"
+                                                               "\x00\xc0\x60\x3f\xff\xfc\xc0\x6c\x0d\x83\x18\x61"
+                                                               "\x18\x32\x03\xc0\x70\x7f\xe0\xc0\x18\x3f\xf0\x60"
+                                                               "\x0c\x01\x80\x1f\xc7\xf9\x80\x30\x03\x80\x3c\x03"
+                                                               "\xe1\x8e\x60\x78\x0f\x01\xf0\x37\x9c\x3e\x01\xe0"
+                                                               "\x0e\x00\xc0\x19\xff\x3f\x80\xc7\xc6\x1f\x06\x11"
+                                                               "\x81\x20\x34\x63\x92\x66\x0c\x81\x90\x32\x06\x40"
+                                                               "\xcc\x1c\x92\x9c\x50\x1b\x02\x30\x83\xe0\x7e\x21"
+                                                               "\x80\xc7\xe6\x36\x1b\x1c\xf3\x00\x00\x1f\xe0\x04"
+                                                               "\x21\x8c\x63\x18\xc6\x31\x84\x18\xc1\x8c\x18\xc1"
+                                                               "\x8c\x10\x80\x1f\x04\x19\x01\x27\x94\x93\x1c\x52"
+                                                               "\x8a\x49\x40\x44\x18\x7c\x00\xfe\x1e\x39\x90\x78"
+                                                               "\x1c\x0e\x05\x06\xe6\x1e\x00\x0c\x03\x00\xc0\x30"
+                                                               "\xff\xff\xf0\xc0\x30\x0c\x03\x00\x00\x00\xff\xff"
+                                                               "\xf0\x7b\x30\xc2\x11\x8c\x3f\xfc\x63\x1e\x0c\x11"
+                                                               "\xfc\x09\xd9\x00\xc0\xe0\x70\x38\x1c\x0e\x07\x07"
+                                                               "\x87\xfe\xfc\x70\x18\x0c\x06\x03\x00\x3f\xfc\x7e"
+                                                               "\x3f\x1f\x8f\xc5\xe2\x71\x00\x80\x40\x20\x10\x08"
+                                                               "\x04\x02\x4f\xfe\x20\x87\xc1\x1f\xc0\x33\xcb\x0c"
+                                                               "\x30\xc3\x3f\x3c\xe6\x83\x83\x83\x83\xe6\x3c\x00"
+                                                               "\x00\xff\x84\x21\x8c\x31\x8e\x39\xc6\x33\x8d\x86"
+                                                               "\xc3\x21\x88\x40\x30\x07\x80\x24\x00\x20\x11\x01"
+                                                               "\x88\x18\x41\x9f\x90\x01\x00\x10\x03\x00\x30\xc3"
+                                                               "\x0a\x70\x91\x04\x80\x44\x07\xf0\x01\x00\x08\x30"
+                                                               "\x07\x80\x24\x00\x20\x11\x01\x88\x18\x41\x9f\x90"
+                                                               "\x01\x00\x10\x03\x00\x31\xe3\x39\x70\x09\x00\xc0"
+                                                               "\x0c\x00\xc0\x0c\x00\xfe\xfc\x00\x60\x06\x00\x78"
+                                                               "\x10\x61\x83\x18\x39\x8f\x10\x01\x00\x10\x03\x00"
+                                                               "\x30\xc3\x0a\x70\x91\x04\x80\x44\x07\xf0\x01\x00"
+                                                               "\x08\x07\x03\xc0\x60\x00\x00\x00\x00\x60\x18\x0e"
+                                                               "\x0e\x0e\x03\x00\xc0\x30\x7f\xfc\xf8\x20\x07\x00"
+                                                               "\x30\x01\x00\x00\x00\x03\x80\x70\x0f\x03\x60\x6c"
+                                                               "\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81\xe0"
+                                                               "\x3c\x06\x00\x80\x38\x1c\x06\x00\x00\x00\x03\x80"
+                                                               "\x70\x0f\x03\x60\x6c\x0c\xc1\x18\x63\x0c\x31\xfe"
+                                                               "\x7f\xcc\x0d\x81\xe0\x3c\x06\x04\x01\xc0\x6e\x18"
+                                                               "\x60\x00\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1"
+                                                               "\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81\xe0\x3c\x06"
+                                                               "\x18\x47\x98\x9a\x31\xc0\x00\x00\x03\x80\x70\x0f"
+                                                               "\x03\x60\x6c\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc"
+                                                               "\x0d\x81\xe0\x3c\x06\x20\x8e\x38\xc7\x00\x00\x00"
+                                                               "\x1c\x03\x80\x78\x1b\x03\x60\x66\x08\xc3\x18\x61"
+                                                               "\x8f\xf3\xfe\x60\x6c\x0f\x01\xe0\x30\x1f\x02\x30"
+                                                               "\xc2\x08\xc1\xf0\x1e\x02\xc0\xd8\x19\x82\x30\xc6"
+                                                               "\x18\x43\xfc\xff\x98\x13\x03\xc0\x78\x0c\x07\xf8"
+                                                               "\x7f\xc3\x40\x12\x01\x90\x0c\x80\x47\xc6\x3e\x31"
+                                                               "\x01\x88\x1f\xc0\xc2\x06\x10\x60\xff\x07\xe0\x0f"
+                                                               "\x83\xfc\xc1\xb0\x06\x01\x80\x30\x06\x00\xc0\x18"
+                                                               "\x01\x80\x30\x07\x06\x7f\xc3\xe0\x30\x07\x00\x38"
+                                                               "\x03\x01\xc0\xe0\x20\x1c\x01\xc0\x18\x00\x00\x0f"
+                                                               "\xff\xff\xc0\x30\x0c\x03\x00\xff\xbf\xec\x03\x00"
+                                                               "\xc0\x30\x0c\x03\xff\xff\xc0\x03\x81\x80\x80\x00"
+                                                               "\x00\x3f\xff\xff\x00\xc0\x30\x0c\x03\xfe\xff\xb0"
+                                                               "\x0c\x03\x00\xc0\x30\x0f\xff\xff\x04\x07\x83\x31"
+                                                               "\x82\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff"
+                                                               "\xbf\xec\x03\x00\xc0\x30\x0c\x03\xff\xff\xc0\x20"
+                                                               "\x9c\x66\x18\x00\x00\x3f\xff\xff\x00\xc0\x30\x0c"
+                                                               "\x03\xfe\xff\xb0\x0c\x03\x00\xc0\x30\x0f\xff\xff"
+                                                               "\xe0\x30\x08\x00\x00\xff\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\x18\x18\x18\x18\xff\x02\x07\x1c\x30"
+                                                               "\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\x18\xff\x10\x3c\x66\x83\x00\x00\xff"
+                                                               "\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\xff\x82\xc7\xc7\x00\x00\xff\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\x18\x18\x18\x18\x18\x18\xff\x7e\x0f"
+                                                               "\xf1\x87\x30\x76\x06\xc0\xd8\x1f\xe3\x60\x6c\x0d"
+                                                               "\x81\xb0\x66\x1c\xfe\x1f\x00\x30\x9e\x24\xd1\x1c"
+                                                               "\x00\x00\x0e\x0f\x83\xf0\xfc\x3d\x0f\x63\xd8\xf3"
+                                                               "\x3c\xcf\x1b\xc6\xf0\xfc\x3f\x07\xc1\xc0\x30\x03"
+                                                               "\x80\x1c\x00\x00\x00\x3e\x0f\xe3\x86\x60\x6c\x0f"
+                                                               "\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe"
+                                                               "\x0f\x80\x01\x80\x60\x30\x00\x00\x00\x3e\x0f\xe3"
+                                                               "\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03"
+                                                               "\x60\x6e\x18\xfe\x0f\x80\x0e\x03\x60\xc6\x10\x00"
+                                                               "\x00\x3e\x0f\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07"
+                                                               "\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x3c\x44"
+                                                               "\xd8\x8e\x10\x00\x00\x3e\x0f\xe3\x86\x60\x6c\x0f"
+                                                               "\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe"
+                                                               "\x0f\x80\x20\x86\x38\xc3\x00\x00\x00\x3e\x0f\xe3"
+                                                               "\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b\x03"
+                                                               "\x60\x6e\x18\xfe\x0f\x80\x40\xf0\xdc\xc6\xc1\xc0"
+                                                               "\xe0\xd8\xc6\xc1\xc0\x40\x00\x23\xec\xff\x38\x66"
+                                                               "\x1e\xc2\xf0\xde\x13\xc4\x78\x8f\x21\xac\x37\x06"
+                                                               "\xc1\x9f\xe2\x78\xc0\x00\x60\x0e\x00\xe0\x00\x00"
+                                                               "\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c"
+                                                               "\x0f\x03\xc0\xf8\x67\xf8\xf8\x03\x01\x81\x80\x00"
+                                                               "\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0"
+                                                               "\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x08\x07\x83\x31"
+                                                               "\x06\x00\x00\x0c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0"
+                                                               "\xf0\x3c\x0f\x03\xc0\xf0\x3e\x19\xfe\x3e\x00\x41"
+                                                               "\x18\xe6\x38\x00\x00\x30\x3c\x0f\x03\xc0\xf0\x3c"
+                                                               "\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8"
+                                                               "\x01\x80\x60\x30\x00\x00\x01\x80\xd8\x1b\x06\x30"
+                                                               "\xc7\x30\x6c\x07\x80\xe0\x0c\x01\x80\x30\x06\x00"
+                                                               "\xc0\x18\x03\x00\xc0\x18\x03\x00\x7f\x8f\xfd\x81"
+                                                               "\xb0\x36\x03\xc0\xd8\x1b\xfe\x7f\x8c\x01\x80\x30"
+                                                               "\x00\x1f\x1f\xe6\x1b\x02\xc1\xb0\x6c\x33\x18\xc6"
+                                                               "\x30\xec\x1f\x03\xc0\xf0\x3c\x7f\x1e\x38\x00\xc0"
+                                                               "\x07\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc"
+                                                               "\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x01\x80\x70\x0c"
+                                                               "\x00\x80\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70"
+                                                               "\xc4\x0c\xc1\xc7\xfe\x3c\x70\x04\x00\xe0\x1f\x01"
+                                                               "\x18\x20\xc0\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3"
+                                                               "\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x3c\x42\x68"
+                                                               "\x63\x82\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc"
+                                                               "\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x31\xc3\x18\x00"
+                                                               "\x00\x00\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40"
+                                                               "\xcc\x1c\x7f\xe3\xc7\x1f\x01\x18\x11\x81\xf0\x00"
+                                                               "\x00\x00\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40"
+                                                               "\xcc\x1c\x7f\xe3\xc7\x79\xc7\xf6\x06\x30\x63\x3e"
+                                                               "\x3e\x7f\xc6\x0c\x60\xdf\x87\x1c\x1f\x1f\xfe\x0b"
+                                                               "\x00\xc0\x30\x0c\x03\x82\x7f\xcf\xc0\x80\x38\x03"
+                                                               "\x00\x40\x70\xf0\x30\x06\x00\x60\x00\x00\x07\x87"
+                                                               "\xfb\x86\xc0\xf0\x3f\xff\x00\xc0\x1f\x83\xf0\x03"
+                                                               "\x01\x81\x80\x00\x00\x07\x87\xfb\x86\xc0\xf0\x3f"
+                                                               "\xff\x00\xc0\x1f\x83\xf0\x0c\x07\x83\x31\x86\x00"
+                                                               "\x00\x01\xe1\xfe\xe1\xb0\x3c\x0f\xff\xc0\x30\x07"
+                                                               "\xe0\xfc\x73\x9c\xe0\x00\x00\x1e\x1f\xee\x1b\x03"
+                                                               "\xc0\xff\xfc\x03\x00\x7e\x0f\xc0\x40\x30\x0e\x01"
+                                                               "\x80\x00\x03\xe1\xf0\x18\x0c\x06\x03\x01\x80\xc3"
+                                                               "\xff\xff\x02\x03\x07\x06\x00\x00\x03\xe1\xf0\x18"
+                                                               "\x0c\x06\x03\x01\x80\xc3\xff\xff\x18\x1e\x0f\x0c"
+                                                               "\xc8\x10\x00\x01\xf0\xf8\x0c\x06\x03\x01\x80\xc0"
+                                                               "\x61\xff\xff\x80\xe7\x73\x80\x00\x0f\x87\xc0\x60"
+                                                               "\x30\x18\x0c\x06\x03\x0f\xff\xfc\x19\x83\xe0\x1c"
+                                                               "\x02\xc0\x8c\x01\xc0\x18\xfb\x3b\xec\x0f\x01\xe0"
+                                                               "\x36\x04\xc1\x8f\xe0\xf8\x78\xa6\xd1\xc8\x00\x06"
+                                                               "\x7b\x7f\xe3\xe0\xe0\x70\x38\x1c\x0e\x07\x02\x38"
+                                                               "\x01\x80\x1c\x00\x00\x00\x3e\x0f\xf3\x06\x60\x78"
+                                                               "\x0f\x01\xb0\x36\x0c\x7f\x87\xc0\x01\x80\xe0\x30"
+                                                               "\x00\x00\x00\x3e\x0f\xf3\x06\x60\x78\x0f\x01\xb0"
+                                                               "\x36\x0c\x7f\x87\xc0\x06\x01\xe0\x66\x18\x62\x00"
+                                                               "\x00\x07\xc1\xfe\x60\xcc\x0f\x01\xe0\x36\x06\xc1"
+                                                               "\x8f\xf0\xf8\x3c\x44\xd8\x8e\x10\x00\x00\x3e\x0f"
+                                                               "\xf3\x06\x60\x78\x0f\x01\xb0\x36\x0c\x7f\x87\xc0"
+                                                               "\x31\xc6\x30\x00\x00\x01\xf0\x7f\x98\x33\x03\xc0"
+                                                               "\x78\x0d\x81\xb0\x63\xfc\x3e\x00\x0c\x07\x01\xc0"
+                                                               "\x00\x00\x3f\xff\xfc\x00\x00\x03\x01\xc0\x30\x00"
+                                                               "\x63\xe8\xff\x30\xe6\x37\x8c\xf1\x1b\x43\x78\xc7"
+                                                               "\xf9\xfc\x60\x00\x70\x0c\x03\x80\x00\x06\x07\x03"
+                                                               "\x81\xc0\xe0\x70\x38\x3c\x3f\xf5\xe2\x03\x03\x06"
+                                                               "\x00\x00\x06\x07\x03\x81\xc0\xe0\x70\x38\x3c\x3f"
+                                                               "\xf5\xe2\x0c\x0e\x0d\x84\x64\x18\x00\x01\x81\xc0"
+                                                               "\xe0\x70\x38\x1c\x0e\x0f\x0f\xfd\x78\x80\x73\xb1"
+                                                               "\xc0\x00\x0c\x0e\x07\x03\x81\xc0\xe0\x70\x78\x7f"
+                                                               "\xeb\xc4\x01\x80\x60\x30\x00\x00\x01\xc0\xd8\x1b"
+                                                               "\x06\x30\xc6\x30\x66\x0c\x80\xf0\x1e\x03\x80\x30"
+                                                               "\x0c\x01\x83\xe0\x78\x00\xc0\x30\x0c\x03\x00\xc0"
+                                                               "\x30\x0c\xf3\xfe\xe1\xf0\x3c\x0f\x03\xc0\xf0\x7f"
+                                                               "\xfb\x78\xc0\x30\x0c\x03\x00\xc0\x00\x39\xc6\x38"
+                                                               "\x00\x00\x0e\x06\xc0\xd8\x31\x86\x31\x83\x30\x64"
+                                                               "\x07\x80\xf0\x1c\x01\x80\x60\x0c\x1f\x03\xc0\x00"
+                                                               "\x3f\x80\x00\x00\x07\x00\xe0\x1e\x06\xc0\xd8\x19"
+                                                               "\x82\x30\xc6\x18\x63\xfc\xff\x98\x1b\x03\xc0\x78"
+                                                               "\x0c\x3f\x83\xf8\x00\x00\x00\x7f\x03\xf8\x00\xc0"
+                                                               "\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f\xe3\xc7\x20\x84"
+                                                               "\x10\xc6\x0f\x80\x00\x00\x03\x80\x70\x0f\x03\x60"
+                                                               "\x6c\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81"
+                                                               "\xe0\x3c\x06\x20\xc3\x18\x1f\x00\x00\x00\x07\xf0"
+                                                               "\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe"
+                                                               "\x3c\x70\x0e\x00\xe0\x0f\x01\xb0\x1b\x01\x98\x11"
+                                                               "\x83\x18\x30\xc3\xfc\x7f\xc6\x06\x60\x6c\x06\xc0"
+                                                               "\x60\x02\x00\x40\x0c\x00\xc0\x07\x7f\x03\xf8\x00"
+                                                               "\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f\xe3\xc7\x00"
+                                                               "\x80\x08\x01\x80\x18\x00\xe0\x00\xc0\x70\x18\x00"
+                                                               "\x00\x00\x1f\x07\xf9\x83\x60\x0c\x03\x00\x60\x0c"
+                                                               "\x01\x80\x30\x03\x00\x60\x0e\x0c\xff\x87\xc0\x03"
+                                                               "\x81\x81\xc0\x00\x00\x07\xc7\xff\x82\xc0\x30\x0c"
+                                                               "\x03\x00\xe0\x9f\xf3\xf0\x07\x01\xb0\x63\x00\x00"
+                                                               "\x00\x1f\x07\xf9\x83\x60\x0c\x03\x00\x60\x0c\x01"
+                                                               "\x80\x30\x03\x00\x60\x0e\x0c\xff\x87\xc0\x0c\x07"
+                                                               "\x83\x31\x86\x00\x80\x01\xf1\xff\xe0\xb0\x0c\x03"
+                                                               "\x00\xc0\x38\x27\xfc\xfc\x07\x00\xe0\x00\x00\x00"
+                                                               "\xf8\x3f\xcc\x1b\x00\x60\x18\x03\x00\x60\x0c\x01"
+                                                               "\x80\x18\x03\x00\x70\x67\xfc\x3e\x00\x04\x03\x80"
+                                                               "\xc0\x00\x00\x07\xc7\xff\x82\xc0\x30\x0c\x03\x00"
+                                                               "\xe0\x9f\xf3\xf0\x30\x61\xb0\x1c\x01\x00\x00\x1f"
+                                                               "\x07\xf9\x83\x60\x0c\x03\x00\x60\x0c\x01\x80\x30"
+                                                               "\x03\x00\x60\x0e\x0c\xff\x87\xc0\x61\x8c\xc1\xe0"
+                                                               "\x38\x04\x00\x01\xf1\xff\xe0\xb0\x0c\x03\x00\xc0"
+                                                               "\x38\x27\xfc\xfc\x81\x30\xc3\xe0\x60\x00\x00\x0f"
+                                                               "\xc3\xfc\xc3\xb0\x7c\x0f\x03\xc0\xf0\x3c\x0f\x03"
+                                                               "\xc0\xf0\x6c\x3b\xf8\xf8\x00\x00\x06\x00\x0c\x01"
+                                                               "\x18\x02\x20\x04\x40\x08\x00\x10\x00\x20\x1f\x40"
+                                                               "\x7f\x81\x83\x03\x02\x0c\x04\x18\x08\x30\x10\x30"
+                                                               "\x60\x7f\x40\x3c\x80\x7e\x0f\xf1\x87\x30\x76\x06"
+                                                               "\xc0\xd8\x1f\xe3\x60\x6c\x0d\x81\xb0\x66\x1c\xfe"
+                                                               "\x1f\x00\x00\xc0\x0c\x00\xc0\xff\x00\xc0\x0c\x1e"
+                                                               "\xc3\xfc\x60\xc4\x0c\xc0\xcc\x0c\xc0\xc6\x1c\x7f"
+                                                               "\xc1\xec\x3f\x8f\xe0\x00\x00\xff\xff\xfc\x03\x00"
+                                                               "\xc0\x30\x0f\xfb\xfe\xc0\x30\x0c\x03\x00\xc0\x3f"
+                                                               "\xff\xfc\x7f\x9f\xe0\x00\x00\x1e\x1f\xee\x1b\x03"
+                                                               "\xc0\xff\xfc\x03\x00\x7e\x0f\xc0\x00\x98\x23\x18"
+                                                               "\x7c\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff"
+                                                               "\xbf\xec\x03\x00\xc0\x30\x0c\x03\xff\xff\xc0\x61"
+                                                               "\x88\x43\xf0\x00\x00\x07\x87\xfb\x86\xc0\xf0\x3f"
+                                                               "\xff\x00\xc0\x1f\x83\xf0\x0c\x03\x80\xc0\x00\x00"
+                                                               "\x3f\xff\xff\x00\xc0\x30\x0c\x03\xfe\xff\xb0\x0c"
+                                                               "\x03\x00\xc0\x30\x0f\xff\xff\x0c\x03\x00\xc0\x00"
+                                                               "\x00\x07\x87\xfb\x86\xc0\xf0\x3f\xff\x00\xc0\x1f"
+                                                               "\x83\xf0\xff\xff\xfc\x03\x00\xc0\x30\x0f\xfb\xfe"
+                                                               "\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x04\x03\x00"
+                                                               "\x80\x30\x0f\x1e\x1f\xee\x1b\x03\xc0\xff\xfc\x03"
+                                                               "\x00\x7e\x0f\xc0\x20\x18\x04\x01\x80\x78\x00\x8c"
+                                                               "\x61\xb0\x38\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03"
+                                                               "\x00\xff\xbf\xec\x03\x00\xc0\x30\x0c\x03\xff\xff"
+                                                               "\xc0\x61\x8c\xc1\xe0\x30\x00\x00\x01\xe1\xfe\xe1"
+                                                               "\xb0\x3c\x0f\xff\xc0\x30\x07\xe0\xfc\x02\x00\xe0"
+                                                               "\x36\x0c\x30\x00\x00\x01\xf0\xfe\x30\x0c\x01\x80"
+                                                               "\x60\x0c\x01\x87\xf0\xfe\x03\x60\x6c\x0d\xc1\x9f"
+                                                               "\xf0\xfe\x04\x03\x81\xf0\x46\x20\xc0\x00\x00\x7d"
+                                                               "\x3f\xd8\x16\x07\x01\xc0\x70\x16\x0d\xfd\x1e\x40"
+                                                               "\x10\x0c\x03\x3f\x8f\xc0\x10\x43\x18\x3e\x00\x00"
+                                                               "\x00\x0f\x87\xf1\x80\x60\x0c\x03\x00\x60\x0c\x3f"
+                                                               "\x87\xf0\x1b\x03\x60\x6e\x0c\xff\x87\xf0\x20\xcc"
+                                                               "\x61\xf0\x00\x00\x07\xd3\xfd\x81\x60\x70\x1c\x07"
+                                                               "\x01\x60\xdf\xd1\xe4\x01\x00\xc0\x33\xf8\xfc\x02"
+                                                               "\x00\xe0\x1c\x00\x00\x00\x0f\x87\xf1\x80\x60\x0c"
+                                                               "\x03\x00\x60\x0c\x3f\x87\xf0\x1b\x03\x60\x6e\x0c"
+                                                               "\xff\x87\xf0\x04\x03\x80\x60\x00\x00\x07\xd3\xfd"
+                                                               "\x81\x60\x70\x1c\x07\x01\x60\xdf\xd1\xe4\x01\x00"
+                                                               "\xc0\x33\xf8\xfc\x07\xc3\xf8\xc0\x30\x06\x01\x80"
+                                                               "\x30\x06\x1f\xc3\xf8\x0d\x81\xb0\x37\x06\x7f\xc3"
+                                                               "\xf8\x00\x00\x00\xc0\x0e\x00\x40\x18\x0c\x00\x0f"
+                                                               "\x06\x01\x80\x3c\x00\x00\x01\xf4\xff\x60\x58\x1c"
+                                                               "\x07\x01\xc0\x58\x37\xf4\x79\x00\x40\x30\x0c\xfe"
+                                                               "\x3f\x00\x08\x0f\x0c\xc8\x30\x00\x03\x03\x81\xc0"
+                                                               "\xe0\x70\x38\x1f\xff\xff\x03\x81\xc0\xe0\x70\x38"
+                                                               "\x1c\x08\x18\x03\xc0\x66\x04\x30\x81\x00\x00\x18"
+                                                               "\x01\x80\x18\x01\x80\x18\x01\x80\x19\xe1\xbf\x1e"
+                                                               "\x31\xc1\x18\x11\x81\x18\x11\x81\x18\x11\x81\x60"
+                                                               "\xc6\x0c\x60\xcf\xff\x60\xc6\x0c\x60\xc7\xfc\x7f"
+                                                               "\xc6\x0c\x60\xc6\x0c\x60\xc6\x0c\x60\xc0\x60\x18"
+                                                               "\x06\x03\xf8\x60\x18\x06\x39\xbf\x78\xdc\x16\x05"
+                                                               "\x81\x60\x58\x16\x05\x81\x30\xbc\xd3\x58\xe0\x00"
+                                                               "\x01\xfe\x18\x0c\x06\x03\x01\x80\xc0\x60\x30\x18"
+                                                               "\x0c\x06\x03\x01\x87\xf8\x61\x38\xb6\xd1\xc0\x00"
+                                                               "\x03\xe1\xf0\x18\x0c\x06\x03\x01\x80\xc3\xff\xff"
+                                                               "\xfe\xfe\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\x18\x18\x18\xff\xff\x7f\x80\x00\x0f"
+                                                               "\x87\xc0\x60\x30\x18\x0c\x06\x03\x0f\xff\xfc\x80"
+                                                               "\x83\xc6\x7c\x00\x00\xff\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\x18\x18\x18\x18\xff\x81\x61\x99\x87"
+                                                               "\x80\x00\x03\xe1\xf0\x18\x0c\x06\x03\x01\x80\xc3"
+                                                               "\xff\xff\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\x18\xff\x10\x20\x20\x60\x3c\x18\x1c"
+                                                               "\x06\x00\x00\x00\x03\xe1\xf0\x18\x0c\x06\x03\x01"
+                                                               "\x80\xc3\xff\xff\x10\x18\x08\x06\x03\xc0\x18\x38"
+                                                               "\x18\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\x18\x18\xff\xf8\x7c\x06\x03\x01\x80"
+                                                               "\xc0\x60\x30\xff\xff\xc0\x00\x40\x07\x00\x6c\x0c"
+                                                               "\x30\x00\x00\x00\x03\x00\x18\x00\xc0\x06\x00\x30"
+                                                               "\x01\x80\x0c\x00\x60\x03\x00\x18\x00\xc6\x06\x1c"
+                                                               "\x30\x7f\x80\xf0\x00\x02\x01\xc0\xd8\x63\x30\x40"
+                                                               "\x00\x01\xf8\x7e\x01\x80\x60\x18\x06\x01\x80\x60"
+                                                               "\x18\x06\x01\x80\x60\x18\xfe\x3e\x00\xc0\xd8\x33"
+                                                               "\x0e\x63\x8c\xe1\x98\x36\x07\x80\xd8\x19\x83\x18"
+                                                               "\x63\x8c\x39\x83\xb0\x38\x00\x00\x03\x80\x38\x01"
+                                                               "\x00\x60\x30\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c"
+                                                               "\x1f\x0c\xc6\x37\x0f\x83\x60\xcc\x31\x8c\x3b\x07"
+                                                               "\x00\x00\x01\x80\x38\x06\x01\x83\x80\x38\x18\x08"
+                                                               "\x00\x00\x00\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00"
+                                                               "\xc0\x30\x0c\x03\x00\xc0\x30\x0f\xff\xff\x01\x00"
+                                                               "\x70\x38\x0c\x00\x00\x00\x3f\x07\xe0\x0c\x01\x80"
+                                                               "\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x30"
+                                                               "\x07\x00\x7e\x07\xc0\xc0\x30\x0c\x03\x00\xc0\x30"
+                                                               "\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc"
+                                                               "\x00\x00\x07\x00\x60\x0c\x06\x07\x00\xfc\x1f\x80"
+                                                               "\x30\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x30"
+                                                               "\x06\x00\xc0\x1c\x01\xf8\x1f\x00\x00\x00\x30\x03"
+                                                               "\x80\x30\x06\x07\x00\xc2\x30\x8c\x23\x08\xc2\x30"
+                                                               "\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc"
+                                                               "\x00\x20\x07\xf0\xfe\x10\xc2\x18\x03\x00\x60\x0c"
+                                                               "\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x70\x07\xe0"
+                                                               "\x7c\xc0\x30\x0c\x03\x00\xc0\x30\x2c\x1f\x0f\xc1"
+                                                               "\xb0\x0c\x03\x00\xc0\x3f\xff\xfc\xfc\x03\xf0\x00"
+                                                               "\xc0\x03\x00\x0c\x00\x30\x00\xc0\x83\x07\x0c\x1c"
+                                                               "\x30\x70\xc0\x03\x00\x0c\x00\x38\x00\x7e\x00\xf8"
+                                                               "\x30\x06\x00\xc0\x18\x03\x30\x6c\x0f\x01\x80\x70"
+                                                               "\x16\x00\xc0\x18\x03\x00\x7f\xcf\xf8\xfc\x1f\x80"
+                                                               "\x30\x06\x00\xc0\x19\x83\xe0\x70\x3c\x0d\x80\x30"
+                                                               "\x06\x00\xc0\x1c\x01\xf8\x1f\x03\x81\x81\xc0\x00"
+                                                               "\x00\x38\x3e\x0f\xc3\xf0\xf4\x3d\x8f\x63\xcc\xf3"
+                                                               "\x3c\x6f\x1b\xc3\xf0\xfc\x1f\x07\x03\x07\x06\x00"
+                                                               "\x00\x06\x7b\x7f\xe3\xe0\xe0\x70\x38\x1c\x0e\x07"
+                                                               "\x02\xe0\xf8\x3f\x0f\xc3\xd0\xf6\x3d\x8f\x33\xcc"
+                                                               "\xf1\xbc\x6f\x0f\xc3\xf0\x7c\x1c\x00\x00\x06\x00"
+                                                               "\xe0\x18\x06\x06\x00\xcf\x6f\xfc\x7c\x1c\x0e\x07"
+                                                               "\x03\x81\xc0\xe0\x40\x00\x01\x80\x70\x08\x0c\x18"
+                                                               "\x00\x61\x8c\xc1\xc0\x20\x00\x38\x3e\x0f\xc3\xf0"
+                                                               "\xf4\x3d\x8f\x63\xcc\xf3\x3c\x6f\x1b\xc3\xf0\xfc"
+                                                               "\x1f\x07\x41\x99\x87\x83\x80\x80\x03\x3d\xbf\xf1"
+                                                               "\xf0\x70\x38\x1c\x0e\x07\x03\x81\xe0\xf8\x3f\x0f"
+                                                               "\xc3\xd0\xf6\x3c\x8f\x33\xcc\xf1\xbc\x6f\x0f\xc3"
+                                                               "\xf0\x7c\x1c\x03\x00\xc0\x20\x18\x7c\x1c\x00\xcf"
+                                                               "\x6f\xfc\x7c\x1c\x0e\x07\x03\x81\xc0\xe0\x40\x20"
+                                                               "\x10\x18\xfc\x78\x3f\x87\xf0\x00\x00\x01\xf0\x7f"
+                                                               "\x1c\x33\x03\x60\x78\x0f\x01\xe0\x3c\x07\x80\xd8"
+                                                               "\x1b\x03\x70\xc7\xf0\x7c\x00\x3f\x87\xf0\x00\x00"
+                                                               "\x01\xf0\x7f\x98\x33\x03\xc0\x78\x0d\x81\xb0\x63"
+                                                               "\xfc\x3e\x00\x20\xc6\x30\x7c\x00\x00\x00\x3e\x0f"
+                                                               "\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0\x1b"
+                                                               "\x03\x60\x6e\x18\xfe\x0f\x80\x20\xc6\x30\x7c\x00"
+                                                               "\x00\x00\x3e\x0f\xf3\x06\x60\x78\x0f\x01\xb0\x36"
+                                                               "\x0c\x7f\x87\xc0\x0c\x63\x18\xc2\x00\x00\x00\x3e"
+                                                               "\x0f\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0"
+                                                               "\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x08\x63\x18\xc6"
+                                                               "\x00\x00\x00\x3e\x0f\xf3\x06\x60\x78\x0f\x01\xb0"
+                                                               "\x36\x0c\x7f\x87\xc0\x1f\xf3\xff\x62\x0c\x20\xc2"
+                                                               "\x0c\x20\xc3\xe8\x3e\x82\x0c\x20\xc2\x0c\x20\x62"
+                                                               "\x07\xff\x1f\xf0\x39\xc7\xf6\xc6\x3c\x63\x86\x38"
+                                                               "\x7f\xc6\x0c\x60\xff\x87\x9c\x03\x83\x81\x80\x00"
+                                                               "\x00\x3f\xcf\xfb\x07\xc0\xf0\x3c\x0f\x06\xdf\x3e"
+                                                               "\x0c\xc3\x18\xc3\x30\xec\x1f\x03\x00\x80\x70\x18"
+                                                               "\x06\x00\x00\x00\x1e\x7b\xdf\x1e\x03\x80\x60\x0c"
+                                                               "\x01\x80\x30\x3f\xc7\xf8\xff\x3f\xec\x1f\x03\xc0"
+                                                               "\xf0\x3c\x1b\x7c\xf8\x33\x0c\x63\x0c\xc3\xb0\x7c"
+                                                               "\x0c\x00\x00\x07\x00\xe0\x08\x06\x06\x00\x79\xef"
+                                                               "\x7c\x78\x0e\x01\x80\x30\x06\x00\xc0\xff\x1f\xe0"
+                                                               "\x00\x00\x03\x80\x38\x01\x00\x60\x30\x00\x00\x98"
+                                                               "\x61\xf0\x30\x00\x00\x0f\xf3\xfe\xc1\xf0\x3c\x0f"
+                                                               "\x03\xc1\xb7\xcf\x83\x30\xc6\x30\xcc\x3b\x07\xc0"
+                                                               "\xc0\x20\x06\x10\x66\x07\x80\xe0\x00\x00\x03\xcf"
+                                                               "\x7b\xe3\xc0\x70\x0c\x01\x80\x30\x06\x07\xf8\xff"
+                                                               "\x00\x03\x81\x81\xc0\x00\x00\x0f\xe7\xfb\x00\xc0"
+                                                               "\x30\x0e\x01\xe0\x1f\x00\xe0\x1c\x03\x00\xe0\x7f"
+                                                               "\xf9\xfc\x03\x83\x07\x00\x00\x01\xfd\xff\x80\xe0"
+                                                               "\x3f\x03\xe0\x30\x0f\xff\xfc\x1e\x0c\xc6\x18\x00"
+                                                               "\x00\x0f\xe7\xfb\x00\xc0\x30\x0e\x01\xe0\x1f\x00"
+                                                               "\xe0\x1c\x03\x00\xe0\x7f\xf9\xfc\x04\x06\x07\x86"
+                                                               "\x66\x18\x00\x00\x7f\x7f\xe0\x38\x0f\xc0\xf8\x0c"
+                                                               "\x03\xff\xff\x00\x3f\x9f\xec\x03\x00\xc0\x38\x07"
+                                                               "\x80\x7c\x03\x80\x70\x0c\x03\x81\xff\xe7\xf0\x20"
+                                                               "\x0e\x00\xc0\x10\x1c\x3c\x00\x3f\xbf\xf0\x1c\x07"
+                                                               "\xe0\x7c\x06\x01\xff\xff\x82\x01\x80\x30\x18\x3c"
+                                                               "\x78\x61\x8c\xc1\xe0\x00\x00\x0f\xe7\xfb\x00\xc0"
+                                                               "\x30\x0e\x01\xe0\x1f\x00\xe0\x1c\x03\x00\xe0\x7f"
+                                                               "\xf9\xfc\x61\x99\x87\x81\x80\x40\x00\xfe\xff\xc0"
+                                                               "\x70\x1f\x81\xf0\x18\x07\xff\xfe\xff\xff\xfc\x18"
+                                                               "\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x18\x03"
+                                                               "\x00\x60\x0c\x01\x80\x20\x06\x00\x70\x02\x01\xc1"
+                                                               "\xe0\x0c\x01\x80\x30\x06\x0f\xfd\xff\x83\x00\x60"
+                                                               "\x0c\x01\x80\x30\x06\x00\xfe\x0f\xc1\x00\x38\x01"
+                                                               "\x80\x10\x0e\x07\x00\x20\x06\x30\x6c\x07\x00\x00"
+                                                               "\x00\x3f\xff\xff\x06\x00\xc0\x18\x03\x00\x60\x0c"
+                                                               "\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x00\xc0"
+                                                               "\x18\x03\x06\x60\xc8\x18\x03\x07\xfe\xff\xc1\x80"
+                                                               "\x30\x06\x00\xc0\x18\x03\x00\x7f\x07\xe0\xff\xff"
+                                                               "\xfc\x18\x03\x00\x60\x0c\x01\x81\xfe\x06\x00\xc0"
+                                                               "\x18\x03\x00\x60\x0c\x01\x80\x0c\x01\x80\x30\x06"
+                                                               "\x0f\xfd\xff\x83\x00\x60\x7f\x81\x80\x30\x06\x00"
+                                                               "\xfe\x0f\xc0\x30\x9e\x64\xd3\x1c\x00\x00\x0c\x0f"
+                                                               "\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0"
+                                                               "\xf0\x3e\x19\xfe\x3e\x00\x30\xbc\x53\x48\xe0\x00"
+                                                               "\x03\x03\x81\xc0\xe0\x70\x38\x1c\x1e\x1f\xfa\xf1"
+                                                               "\x7f\x1f\xc0\x00\x00\xc0\xf0\x3c\x0f\x03\xc0\xf0"
+                                                               "\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xe1\x9f\xe3\xe0"
+                                                               "\x7f\xbf\xc0\x00\x0c\x0e\x07\x03\x81\xc0\xe0\x70"
+                                                               "\x78\x7f\xeb\xc4\x41\x98\xc3\xe0\x00\x00\x30\x3c"
+                                                               "\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03"
+                                                               "\xc0\xf8\x67\xf8\xf8\x40\x30\xcc\xc7\xc0\x00\x03"
+                                                               "\x03\x81\xc0\xe0\x70\x38\x1c\x1e\x1f\xfa\xf1\x3f"
+                                                               "\x18\x46\x10\xfc\x00\x00\x0c\x0f\x03\xc0\xf0\x3c"
+                                                               "\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3e\x19\xfe"
+                                                               "\x3e\x00\x3e\x10\x88\x47\xc0\x00\x03\x03\x81\xc0"
+                                                               "\xe0\x70\x38\x1c\x1e\x1f\xfa\xf1\x18\xcc\x66\x10"
+                                                               "\x00\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0"
+                                                               "\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x10\x98\xcc"
+                                                               "\x6c\x60\x00\x03\x03\x81\xc0\xe0\x70\x38\x1c\x1e"
+                                                               "\x1f\xfa\xf1\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f"
+                                                               "\x03\xc0\xf0\x3c\x0f\x03\xe1\x9f\xe3\xe0\x20\x18"
+                                                               "\x04\x01\x80\x78\xc0\xb0\x2c\x0b\x02\xc0\xb0\x2c"
+                                                               "\x1b\x0e\xfe\x9e\x20\x08\x04\x03\x00\xc0\x1c\x04"
+                                                               "\x01\xe0\x66\x10\x60\x00\x00\x30\x0e\x01\xc0\x78"
+                                                               "\x8d\x11\xa3\x36\x66\xdc\xda\x93\x5a\x69\x47\x38"
+                                                               "\xc7\x18\xe3\x1c\x04\x01\xc0\x6c\x18\xc2\x0c\x00"
+                                                               "\x00\x06\x01\xc4\x78\x8d\x19\xb7\x36\xa4\xd6\x8e"
+                                                               "\x71\x8e\x31\xc0\x04\x01\xe0\x66\x10\x60\x00\x00"
+                                                               "\x30\x1b\x03\x60\xc6\x18\xe6\x0d\x80\xf0\x1c\x01"
+                                                               "\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x06\x01\xc0"
+                                                               "\x6c\x08\xc2\x0c\x00\x00\x07\x03\x60\x6c\x18\xc3"
+                                                               "\x18\xc1\x98\x32\x03\xc0\x78\x0e\x00\xc0\x30\x06"
+                                                               "\x0f\x81\xe0\x00\x20\x86\x38\xc7\x00\x00\x01\x80"
+                                                               "\xd8\x1b\x06\x30\xc7\x30\x6c\x07\x80\xe0\x0c\x01"
+                                                               "\x80\x30\x06\x00\xc0\x18\x03\x00\x00\x80\x38\x1c"
+                                                               "\x06\x00\x00\x00\x1f\xfb\xff\x00\xc0\x30\x0e\x01"
+                                                               "\x80\x60\x1c\x03\x00\xc0\x18\x06\x01\x80\x3f\xff"
+                                                               "\xfe\x01\x00\xc0\xe0\x60\x00\x00\x0f\xff\xfe\x03"
+                                                               "\x01\x80\xc0\x60\x30\x18\x0f\xff\xff\x06\x01\xc0"
+                                                               "\x18\x00\x00\x00\xff\xdf\xf8\x06\x01\x80\x70\x0c"
+                                                               "\x03\x00\xe0\x18\x06\x00\xc0\x30\x0c\x01\xff\xff"
+                                                               "\xf0\x0c\x03\x00\xc0\x00\x00\x3f\xff\xf8\x0c\x06"
+                                                               "\x03\x01\x80\xc0\x60\x3f\xff\xfc\x20\x06\x38\x6c"
+                                                               "\x07\x00\x00\x00\x1f\xfb\xff\x00\xc0\x30\x0e\x01"
+                                                               "\x80\x60\x1c\x03\x00\xc0\x18\x06\x01\x80\x3f\xff"
+                                                               "\xfe\x40\x18\x63\x30\x78\x0c\x00\x00\x03\xff\xff"
+                                                               "\x80\xc0\x60\x30\x18\x0c\x06\x03\xff\xff\xc0\x3f"
+                                                               "\x07\xf0\x03\x00\x30\x06\x00\xff\xff\xff\xc0\x78"
+                                                               "\x0d\x81\xb0\x36\x0c\x7f\x07\xc0\x00\x10\x03\x1f"
+                                                               "\xf3\xf8\x70\xc6\x06\x60\x6c\x06\xc0\x6c\x06\xc0"
+                                                               "\x6c\x06\x60\x66\x06\x70\xc3\xf8\x1f\x00\x00\x30"
+                                                               "\x03\x1f\xe3\xf8\x60\xc6\x06\xc0\x6c\x06\x60\x66"
+                                                               "\x0c\x3f\xc1\xf0\x00\x18\x00\xf0\x3d\x81\x8c\x0c"
+                                                               "\x60\x63\x03\x18\x18\xc0\xc6\x06\x30\x31\x81\x8c"
+                                                               "\x0c\x60\x63\x86\x0f\xf0\x3e\x00\x00\x30\x03\xc0"
+                                                               "\xec\x08\xc0\x8c\x08\xc0\x8c\x08\xc1\x8c\x38\xfe"
+                                                               "\x87\x88\x20\x06\x30\x6c\x07\x00\x00\x00\x03\x80"
+                                                               "\x70\x0f\x03\x60\x6c\x0c\xc1\x18\x63\x0c\x31\xfe"
+                                                               "\x7f\xcc\x0d\x81\xe0\x3c\x06\x20\xc1\x18\x1f\x00"
+                                                               "\xe0\x04\x00\x00\x7f\x03\xf8\x00\xc0\x0c\x3f\xc7"
+                                                               "\x0c\x40\xcc\x1c\x7f\xe3\xc7\x80\xc6\x6c\x38\x00"
+                                                               "\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\xff\xc3\x33\x0f\x03\x00\x00\x03\xe1"
+                                                               "\xf0\x18\x0c\x06\x03\x01\x80\xc3\xff\xff\x30\xc3"
+                                                               "\x70\x38\x02\x00\x00\x3e\x0f\xe3\x86\x60\x6c\x0f"
+                                                               "\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe"
+                                                               "\x0f\x80\x20\xc3\x30\x3c\x07\x00\x40\x00\x07\xc1"
+                                                               "\xfe\x60\xcc\x0f\x01\xe0\x36\x06\xc1\x8f\xf0\xf8"
+                                                               "\x61\x8d\xc1\xc0\x20\x00\x30\x3c\x0f\x03\xc0\xf0"
+                                                               "\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8"
+                                                               "\xf8\x61\x99\x87\x83\x80\x80\x03\x03\x81\xc0\xe0"
+                                                               "\x70\x38\x1c\x1e\x1f\xfa\xf1\x7f\x1f\xc0\x00\x00"
+                                                               "\x63\x98\x60\x00\x00\xc0\xf0\x3c\x0f\x03\xc0\xf0"
+                                                               "\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xe1\x9f\xe3\xe0"
+                                                               "\x7f\x3f\x80\x00\x06\x3b\x1c\x00\x00\xc0\xe0\x70"
+                                                               "\x38\x1c\x0e\x07\x07\x87\xfe\xbc\x40\x01\x81\xc1"
+                                                               "\xc0\x00\x00\x18\xe6\x18\x00\x00\x30\x3c\x0f\x03"
+                                                               "\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8"
+                                                               "\x67\xf8\xf8\x01\x03\x83\x03\x00\x00\x01\x8e\xc7"
+                                                               "\x00\x00\x30\x38\x1c\x0e\x07\x03\x81\xc1\xe1\xff"
+                                                               "\xaf\x10\x61\x8d\xc1\xc0\x20\x00\x18\xe6\x18\x00"
+                                                               "\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf0"
+                                                               "\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x61\x99\x87\x81"
+                                                               "\x80\x03\x1d\x8e\x00\x00\x60\x70\x38\x1c\x0e\x07"
+                                                               "\x03\x83\xc3\xff\x5e\x20\x60\x0e\x00\xc0\x00\x00"
+                                                               "\x18\xe6\x18\x00\x00\x30\x3c\x0f\x03\xc0\xf0\x3c"
+                                                               "\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8"
+                                                               "\x60\x38\x07\x00\x80\x00\x01\x8e\xc7\x00\x00\x30"
+                                                               "\x38\x1c\x0e\x07\x03\x81\xc1\xe1\xff\xaf\x10\x18"
+                                                               "\x61\xb0\x1c\x01\x00\x00\x0f\x87\xf1\x80\x60\x0c"
+                                                               "\x03\x00\x60\x0c\x3f\x87\xf0\x1b\x03\x60\x6e\x0c"
+                                                               "\xff\x87\xf0\x20\xc4\x61\xf0\x38\x04\x00\x01\xf4"
+                                                               "\xff\x60\x58\x1c\x07\x01\xc0\x58\x37\xf4\x79\x00"
+                                                               "\x40\x30\x0c\xfe\x3f\x00\x1f\x07\xf1\xc3\x30\x36"
+                                                               "\x07\x80\xf0\x1e\x03\xc0\x78\x0d\x81\xb0\x37\x0c"
+                                                               "\x7f\x07\xc0\x20\x08\x01\x00\x30\x07\x80\x1f\x07"
+                                                               "\xf9\x83\x30\x3c\x07\x80\xd8\x1b\x06\x3f\xc3\xe0"
+                                                               "\x10\x04\x00\x80\x18\x03\xc0\x00\x44\x31\x98\x3c"
+                                                               "\x06\x00\x00\x01\xf8\x7e\x01\x80\x60\x18\x06\x01"
+                                                               "\x80\x60\x18\x06\x01\x80\x60\x18\xfe\x3e\x00\x60"
+                                                               "\x0e\x00\xe0\x00\x00\x38\x3e\x0f\xc3\xf0\xf4\x3d"
+                                                               "\x8f\x63\xcc\xf3\x3c\x6f\x1b\xc3\xf0\xfc\x1f\x07"
+                                                               "\x70\x0c\x03\x80\x00\x06\x7b\x7f\xe3\xe0\xe0\x70"
+                                                               "\x38\x1c\x0e\x07\x02\x3f\x9f\xec\x03\x00\xc0\x38"
+                                                               "\x07\x80\x7c\x03\x80\x70\x0c\x03\x81\xff\xe7\xf0"
+                                                               "\x00\x00\x06\x00\xe0\x18\x06\x0e\x00\x3f\xbf\xf0"
+                                                               "\x1c\x07\xe0\x7c\x06\x01\xff\xff\x80\x00\x03\x80"
+                                                               "\x70\x18\x1c\x38\x00\xff\xff\xfc\x18\x03\x00\x60"
+                                                               "\x0c\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x60\x0c"
+                                                               "\x01\x80\x00\x00\x01\x80\x1c\x01\x80\x30\x38\x00"
+                                                               "\x0c\x01\x80\x30\x06\x0f\xfd\xff\x83\x00\x60\x0c"
+                                                               "\x01\x80\x30\x06\x00\xfe\x0f\xc0\x00\x00\x0e\x00"
+                                                               "\x60\x06\x01\x80\xe0\x06\x01\xc0\x18\x00\x00\x00"
+                                                               "\x1c\x03\x80\x78\x1b\x03\x60\x66\x08\xc3\x18\x61"
+                                                               "\x8f\xf3\xfe\x60\x6c\x0f\x01\xe0\x30\x04\x00\xe0"
+                                                               "\x06\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc"
+                                                               "\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x06\x01\xc0\x18"
+                                                               "\x00\x00\x00\x3e\x0f\xe3\x86\x60\x6c\x0f\x01\xe0"
+                                                               "\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe\x0f\x80"
+                                                               "\x04\x01\xc0\x18\x00\x00\x00\x3e\x0f\xf3\x06\x60"
+                                                               "\x78\x0f\x01\xb0\x36\x0c\x7f\x87\xc0\x3f\x87\xf0"
+                                                               "\x00\x00\x0c\x06\xc0\xd8\x31\x86\x39\x83\x60\x3c"
+                                                               "\x07\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x18\x00"
+                                                               "\x3f\xc7\xf8\x00\x00\x0e\x06\xc0\xd8\x31\x86\x31"
+                                                               "\x83\x30\x64\x07\x80\xf0\x1c\x01\x80\x60\x0c\x1f"
+                                                               "\x03\xc0\x00\x7e\xfc\x18\x30\x60\xc1\x83\x06\x0c"
+                                                               "\x18\x30\x7f\xfe\x00\x3e\x0f\xe0\x18\x03\x00\xff"
+                                                               "\xfc\x0f\x06\x7f\x0f\x80\xfd\xb6\xd8\xc7\xc7\xc7"
+                                                               "\xc3\xc3\xc3\xc3\x19\xdc\xe6\x70\x39\xce\xe6\x60"
+                                                               "\xe7\x86\x30\x8c\x7e\xe0\x1c\xf6\x30\xc3\x06\x0f"
+                                                               "\x1c\x18\x79\xb6\x18\x20\x83\x85\xb1\xe1\x80\xff"
+                                                               "\xff\xc0\xff\xff\xc0\xfe\x83\xc2\x6e\x3c\x5d\x80"
+                                                               "\x7a\x38\x63\x78\x22\x11\x87\x80\x30\xbc\xd3\xd8"
+                                                               "\xe0\x21\x63\x42\x84\x87\x0c\x30\x09\xd9\x80\x18"
+                                                               "\x3c\x66\xc3\x81\x61\xf1\x9f\x86\xff\x81\xc3\x66"
+                                                               "\x3c\xfc\xe7\xe7\xe7\x13\xc0\x7b\x38\x73\x78\x21"
+                                                               "\x63\x42\xc6\x81\xc3\x66\x3c\x18\x3c\x8e\x70\xfe"
+                                                               "\x80\xfc\xe3\xe7\xe7\x13\xc0\x62\x1e\x13\xf0\x44"
+                                                               "\x8c\xf0\x18\x3c\x66\xc3\x81\x81\xc3\x66\x3c\xff"
+                                                               "\x0c\x03\x00\xc3\xfc\xcb\xf2\x3c\x8f\x23\xc8\xf3"
+                                                               "\xcf\xe3\x26\xc8\xf2\x3c\x8f\x23\xcb\xff\xc0\xc0"
+                                                               "\x30\x0c\x00\xff\x31\xec\x1f\x03\xc0\xf0\x6c\x73"
+                                                               "\xf8\xc1\xb0\x3c\x0f\x03\xc0\xf0\xff\xf0\x00\x00"
+                                                               "\x00\x07\xf0\xc0\x30\x0c\x03\x00\xc0\x30\x0c\xf3"
+                                                               "\xfe\xe1\xf0\x3c\x0f\x03\xc0\xf0\x7f\xfa\xf8\x00"
+                                                               "\x00\x00\x01\xfc\xfc\x3f\xcc\x3b\x07\xc0\xf0\x3c"
+                                                               "\x0f\x03\xc0\xf0\x3c\x0f\x06\xc3\xbf\x8f\x80\x00"
+                                                               "\x00\x06\x01\x80\x60\x00\x40\x10\x04\x01\x00\x40"
+                                                               "\x11\xf4\xff\x60\xd8\x1c\x07\x01\xc0\x58\x37\xf4"
+                                                               "\x79\x00\x00\x00\x60\x18\x04\x00\xfc\x3f\xcc\x3b"
+                                                               "\x07\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x06\xc3"
+                                                               "\xbf\x8f\x80\x00\x00\x00\x0f\xf0\x00\x40\x10\x04"
+                                                               "\x01\x00\x40\x11\xf4\xff\x60\xd8\x1c\x07\x01\xc0"
+                                                               "\x58\x37\xf4\x79\x00\x00\x00\x00\xff\xfc\x3f\xcc"
+                                                               "\x3b\x07\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x06"
+                                                               "\xc3\xbf\x8f\x80\x00\x00\x06\x03\xc1\x98\x43\x20"
+                                                               "\x40\x00\x40\x10\x04\x01\x00\x40\x11\xf4\xff\x60"
+                                                               "\xd8\x1c\x07\x01\xc0\x58\x37\xf4\x79\x00\x00\x00"
+                                                               "\x60\x3c\x19\x8c\x22\x04\x1f\xc3\xf8\x00\x00\x00"
+                                                               "\x7c\x3f\x8c\x03\x00\x60\x18\x03\x00\x61\xfc\x3f"
+                                                               "\x80\xd8\x1b\x03\x70\x67\xfc\x3f\x80\x3f\x8f\xe0"
+                                                               "\x00\x00\x1f\x4f\xf6\x05\x81\xc0\x70\x1c\x05\x83"
+                                                               "\x7f\x47\x90\x04\x03\x00\xcf\xe3\xf0\xc0\xe0\x70"
+                                                               "\x38\x1c\x0e\x07\xff\xff\xc0\xe0\x70\x38\x1c\x0e"
+                                                               "\x07\x02\x00\x00\x06\x07\x01\x00\xc0\x60\x30\x18"
+                                                               "\x0c\x06\x03\x3d\xbf\xf1\xf0\x70\x38\x1c\x0e\x07"
+                                                               "\x03\x81\x00\x00\x03\x01\x80\x80\x60\x58\x16\x05"
+                                                               "\x81\x60\x58\x17\xfd\xff\x60\x58\x16\x05\x81\x60"
+                                                               "\x58\x16\x05\x00\x60\x0e\x00\x80\xe0\xe0\x00\x60"
+                                                               "\x18\x06\x01\x80\x60\x18\x06\x79\xbf\x78\xdc\x16"
+                                                               "\x05\x81\x60\x58\x16\x05\x81\x40\x18\x03\x80\x20"
+                                                               "\x38\x38\x00\xc0\xe0\x70\x38\x1c\x0e\x07\xff\xff"
+                                                               "\xc0\xe0\x70\x38\x1c\x0e\x07\x02\x00\x00\x20\xd8"
+                                                               "\x46\x61\xe0\xc0\x60\x30\x18\x0c\x06\x03\x3d\xbf"
+                                                               "\xf1\xf0\x70\x38\x1c\x0e\x07\x03\x81\x00\x00\x10"
+                                                               "\x2c\x33\x30\xf0\xc0\xd8\x33\x0e\x63\x8c\xe1\x98"
+                                                               "\x36\x07\x80\xd8\x19\x83\x18\x63\x8c\x39\x83\xb0"
+                                                               "\x38\x00\x00\x01\x80\x30\x06\x00\xc0\x30\x0c\x03"
+                                                               "\x00\xc0\x30\x0c\x1f\x0c\xc6\x37\x0f\x83\x60\xcc"
+                                                               "\x31\x8c\x3b\x07\x00\x00\x00\xc0\x70\x08\x00\xc0"
+                                                               "\xd8\x33\x0e\x63\x8c\xe1\x98\x36\x07\x80\xd8\x19"
+                                                               "\x83\x18\x63\x8c\x39\x83\xb0\x38\x00\x00\x00\x01"
+                                                               "\xfe\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x1f\x0c"
+                                                               "\xc6\x37\x0f\x83\x60\xcc\x31\x8c\x3b\x07\x00\x00"
+                                                               "\x00\x01\xfc\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03"
+                                                               "\x00\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x00\x00"
+                                                               "\x03\x00\xe0\x10\xfc\x1f\x80\x30\x06\x00\xc0\x18"
+                                                               "\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x1c\x01"
+                                                               "\xf8\x1f\x00\x00\x00\x18\x07\x00\x40\xfe\x0f\xe0"
+                                                               "\x00\x00\x00\x30\x03\x00\x30\x03\x00\x30\x03\x00"
+                                                               "\x30\x03\x00\x30\x03\x00\x30\x03\x00\x30\x03\xff"
+                                                               "\x3f\xf0\x00\x00\x00\x30\x03\x80\x10\x7f\x80\x00"
+                                                               "\x00\x00\x0f\xc1\xf8\x03\x00\x60\x0c\x01\x80\x30"
+                                                               "\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\xc0\x1f\x81"
+                                                               "\xf0\x00\x00\x01\x80\x70\x04\x00\xc0\x30\x0c\x03"
+                                                               "\x00\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0"
+                                                               "\x3f\xff\xfc\x00\x00\x00\x03\xf8\xfc\x1f\x80\x30"
+                                                               "\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x30\x06"
+                                                               "\x00\xc0\x1c\x01\xf8\x1f\x00\x00\x00\x00\x1f\xc0"
+                                                               "\xc0\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x30"
+                                                               "\x0c\x03\x00\xc0\x3f\xff\xfc\x00\x00\x03\x01\xe0"
+                                                               "\x6c\x31\x88\x20\xfc\x1f\x80\x30\x06\x00\xc0\x18"
+                                                               "\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x1c\x01"
+                                                               "\xf8\x1f\x00\x00\x00\x18\x07\x01\xb0\x63\x08\x20"
+                                                               "\x01\x80\x60\x30\x00\x00\x00\xc1\xdc\x3b\x87\x71"
+                                                               "\xeb\x2d\x25\xa5\xb4\xe6\x8c\xd1\x1a\x23\xc0\x78"
+                                                               "\x0f\x01\xe0\x30\x01\x80\xe0\x30\x00\x00\x01\x99"
+                                                               "\xf7\xff\x39\xc6\x38\xc7\x18\xe3\x1c\x63\x8c\x71"
+                                                               "\x88\x06\x01\xc0\x18\x00\x00\x00\xc1\xdc\x3b\x87"
+                                                               "\x71\xeb\x2d\x25\xa5\xb4\xe6\x8c\xd1\x1a\x23\xc0"
+                                                               "\x78\x0f\x01\xe0\x30\x04\x01\xc0\x18\x00\x00\x01"
+                                                               "\x99\xf7\xff\x39\xc6\x38\xc7\x18\xe3\x1c\x63\x8c"
+                                                               "\x71\x88\x60\xee\x1d\xc3\xb8\xf5\x96\x92\xd2\xda"
+                                                               "\x73\x46\x68\x8d\x11\xe0\x3c\x07\x80\xf0\x18\x00"
+                                                               "\x00\x00\xc0\x38\x02\x00\xcc\xfb\xff\x9c\xe3\x1c"
+                                                               "\x63\x8c\x71\x8e\x31\xc6\x38\xc4\x00\x00\x00\x60"
+                                                               "\x1c\x01\x00\x0c\x07\x00\xc0\x00\x00\x38\x3e\x0f"
+                                                               "\xc3\xf0\xf4\x3d\x8f\x63\xcc\xf3\x3c\x6f\x1b\xc3"
+                                                               "\xf0\xfc\x1f\x07\x08\x0e\x03\x00\x00\x06\x7b\x7f"
+                                                               "\xe3\xe0\xe0\x70\x38\x1c\x0e\x07\x02\xe0\xf8\x3f"
+                                                               "\x0f\xc3\xd0\xf6\x3d\x8f\x33\xcc\xf1\xbc\x6f\x0f"
+                                                               "\xc3\xf0\x7c\x1c\x00\x00\x03\x01\xc0\x20\xcf\x6f"
+                                                               "\xfc\x7c\x1c\x0e\x07\x03\x81\xc0\xe0\x40\x00\x00"
+                                                               "\xc0\x60\x20\xe0\xf8\x3f\x0f\xc3\xd0\xf6\x3d\x8f"
+                                                               "\x33\xcc\xf1\xbc\x6f\x0f\xc3\xf0\x7c\x1c\x00\x00"
+                                                               "\x00\x07\xf0\xcf\x6f\xfc\x7c\x1c\x0e\x07\x03\x81"
+                                                               "\xc0\xe0\x40\x00\x00\x03\xfc\xe0\xf8\x3f\x0f\xc3"
+                                                               "\xd0\xf6\x3d\x8f\x33\xcc\xf1\xbc\x6f\x0f\xc3\xf0"
+                                                               "\x7c\x1c\x00\x00\x03\x01\xe0\xc8\x61\x10\x20\xcf"
+                                                               "\x6f\xfc\x7c\x1c\x0e\x07\x03\x81\xc0\xe0\x40\x00"
+                                                               "\x00\xc0\xf0\xcc\xc2\x40\x80\x0c\x03\x80\xc0\x00"
+                                                               "\x00\x3f\xcf\xfb\x07\xc0\xf0\x3c\x0f\x06\xdf\x3e"
+                                                               "\x0c\xc3\x18\xc3\x30\xec\x1f\x03\x04\x01\xc0\x38"
+                                                               "\x00\x00\x00\xf3\xde\xf8\xf0\x1c\x03\x00\x60\x0c"
+                                                               "\x01\x81\xfe\x3f\xc0\xff\x3f\xec\x1f\x03\xc0\xf0"
+                                                               "\x3c\x1b\x7c\xf8\x33\x0c\x63\x0c\xc3\xb0\x7c\x0c"
+                                                               "\x00\x00\x03\x00\xc0\x30\x79\xef\x7c\x78\x0e\x01"
+                                                               "\x80\x30\x06\x00\xc0\xff\x1f\xe0\x00\x00\x01\x80"
+                                                               "\x30\x06\x00\x7f\x80\x00\x03\xfc\xff\xb0\x7c\x0f"
+                                                               "\x03\xc0\xf0\x6d\xf3\xe0\xcc\x31\x8c\x33\x0e\xc1"
+                                                               "\xf0\x30\x00\x00\x0c\x03\x00\xc0\x3f\x87\xf0\x00"
+                                                               "\x00\x07\x9e\xf7\xc7\x80\xe0\x18\x03\x00\x60\x0c"
+                                                               "\x0f\xf1\xfe\x00\x00\x00\x18\x03\x00\x60\x00\xff"
+                                                               "\x3f\xec\x1f\x03\xc0\xf0\x3c\x1b\x7c\xf8\x33\x0c"
+                                                               "\x63\x0c\xc3\xb0\x7c\x0c\x00\x00\x00\x07\xf8\x79"
+                                                               "\xef\x7c\x78\x0e\x01\x80\x30\x06\x00\xc0\xff\x1f"
+                                                               "\xe0\x00\x00\x00\x01\xfe\x00\x3f\x9f\xec\x03\x00"
+                                                               "\xc0\x38\x07\x80\x7c\x03\x80\x70\x0c\x03\x81\xff"
+                                                               "\xe7\xf0\x00\x00\x03\x01\xc0\x20\x3f\xbf\xf0\x1c"
+                                                               "\x07\xe0\x7c\x06\x01\xff\xff\x80\x00\x01\xc0\xe0"
+                                                               "\x20\xff\xff\xfc\x18\x03\x00\x60\x0c\x01\x80\x30"
+                                                               "\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x00\x00"
+                                                               "\x00\xc0\x38\x02\x00\x0c\x01\x80\x30\x06\x0f\xfd"
+                                                               "\xff\x83\x00\x60\x0c\x01\x80\x30\x06\x00\xfe\x0f"
+                                                               "\xc0\x00\x00\x06\x00\xe0\x08\x00\xff\xff\xfc\x18"
+                                                               "\x03\x00\x60\x0c\x01\x80\x30\x06\x00\xc0\x18\x03"
+                                                               "\x00\x60\x0c\x01\x80\x00\x00\x00\x00\xfe\x00\x0c"
+                                                               "\x01\x80\x30\x06\x0f\xfd\xff\x83\x00\x60\x0c\x01"
+                                                               "\x80\x30\x06\x00\xfe\x0f\xc0\x00\x00\x00\x03\xf8"
+                                                               "\xff\xff\xfc\x18\x03\x00\x60\x0c\x01\x80\x30\x06"
+                                                               "\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x00\x00\x00"
+                                                               "\xc0\x3c\x0d\x83\x08\x41\x00\x0c\x01\x80\x30\x06"
+                                                               "\x0f\xfd\xff\x83\x00\x60\x0c\x01\x80\x30\x06\x00"
+                                                               "\xfe\x0f\xc0\x00\x00\x06\x01\xe0\x26\x08\x62\x04"
+                                                               "\xc0\x38\x0d\x81\xb0\x36\x0c\x61\x8c\x31\x8c\x11"
+                                                               "\x83\x30\x64\x05\x80\xf0\x1c\x03\x80\x00\x00\x00"
+                                                               "\xc0\x38\x02\x00\xe0\x6c\x0d\x83\x18\x63\x18\x33"
+                                                               "\x06\x40\x58\x0f\x01\xc0\x00\x00\x00\x60\x1c\x01"
+                                                               "\x00\x30\x03\x80\x1c\x00\x00\x01\x80\x70\x0e\x03"
+                                                               "\xc4\x68\x8d\x19\xb3\x36\xe6\xd4\x9a\xd3\x4a\x39"
+                                                               "\xc6\x38\xc7\x18\xe0\x38\x01\x80\x1c\x00\x00\x01"
+                                                               "\x80\x71\x1e\x23\x46\x6d\xcd\xa9\x35\xa3\x9c\x63"
+                                                               "\x8c\x70\x01\x80\x60\x30\x00\x00\x01\x80\x70\x0e"
+                                                               "\x03\xc4\x68\x8d\x19\xb3\x36\xe6\xd4\x9a\xd3\x4a"
+                                                               "\x39\xc6\x38\xc7\x18\xe0\x01\x80\xe0\x30\x04\x00"
+                                                               "\x01\x80\x71\x1e\x23\x46\x6d\xcd\xa9\x35\xa3\x9c"
+                                                               "\x63\x8c\x70\x20\x86\x38\xc7\x00\x00\x01\x80\x70"
+                                                               "\x0e\x03\xc4\x68\x8d\x19\xb3\x36\xe6\xd4\x9a\xd3"
+                                                               "\x4a\x39\xc6\x38\xc7\x18\xe0\x31\xc6\x30\x00\x00"
+                                                               "\x0c\x03\x88\xf1\x1a\x33\x6e\x6d\x49\xad\x1c\xe3"
+                                                               "\x1c\x63\x80\x20\x86\x38\xc7\x00\x00\x00\xc0\xd8"
+                                                               "\x31\x86\x31\x83\x60\x3c\x07\x00\x60\x1e\x06\xc0"
+                                                               "\xcc\x31\x86\x19\x83\xe0\x30\x63\x98\xc0\x00\x00"
+                                                               "\xc1\x98\xe3\x30\x78\x1c\x07\x03\x61\x8c\x61\xb0"
+                                                               "\x70\x06\x01\xc0\x18\x00\x00\x01\x80\xd8\x1b\x06"
+                                                               "\x30\xc7\x30\x6c\x07\x80\xe0\x0c\x01\x80\x30\x06"
+                                                               "\x00\xc0\x18\x03\x00\x04\x00\xc0\x18\x00\x00\x01"
+                                                               "\xc0\xd8\x1b\x06\x30\xc6\x30\x66\x0c\x80\xf0\x1e"
+                                                               "\x03\x80\x30\x0c\x01\x83\xe0\x78\x00\x06\x01\xe0"
+                                                               "\x66\x10\x60\x00\x00\x1f\xfb\xff\x00\xc0\x30\x0e"
+                                                               "\x01\x80\x60\x1c\x03\x00\xc0\x18\x06\x01\x80\x3f"
+                                                               "\xff\xfe\x0c\x07\x83\x60\x8c\x41\x80\x00\x03\xff"
+                                                               "\xff\x80\xc0\x60\x30\x18\x0c\x06\x03\xff\xff\xc0"
+                                                               "\x7f\xef\xfc\x03\x00\xc0\x38\x06\x01\x80\x70\x0c"
+                                                               "\x03\x00\x60\x18\x06\x00\xff\xff\xf8\x00\x00\x00"
+                                                               "\xc0\x38\x02\x00\xff\xff\xe0\x30\x18\x0c\x06\x03"
+                                                               "\x01\x80\xff\xff\xf0\x00\x00\x0c\x03\x00\xc0\x7f"
+                                                               "\xef\xfc\x03\x00\xc0\x38\x06\x01\x80\x70\x0c\x03"
+                                                               "\x00\x60\x18\x06\x00\xff\xff\xf8\x00\x00\x00\x00"
+                                                               "\xfe\x00\xff\xff\xe0\x30\x18\x0c\x06\x03\x01\x80"
+                                                               "\xff\xff\xf0\x00\x00\x00\x1f\xe0\xc0\x60\x30\x18"
+                                                               "\x0c\x06\x03\x3d\xbf\xf1\xf0\x70\x38\x1c\x0e\x07"
+                                                               "\x03\x81\x00\x00\x00\x0f\xf0\x3e\x0f\xf1\x83\x60"
+                                                               "\xcc\x19\x86\x30\x86\x38\xc3\x98\x1b\x03\x60\x3c"
+                                                               "\x05\x8f\xb1\xe0\x0e\x01\xc0\x3c\x0d\x81\xb0\x33"
+                                                               "\x04\x61\x8c\x30\xc7\xf9\xff\x30\x36\x07\x80\xf0"
+                                                               "\x18\x00\x00\x00\xc0\x38\x02\x00\x7f\x03\xf8\x00"
+                                                               "\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f\xe3\xc7\x00"
+                                                               "\x00\x00\x0e\x00\xe0\x04\x00\x0c\x00\xf0\x06\x07"
+                                                               "\x80\x00\x00\x03\x80\x70\x0f\x03\x60\x6c\x0c\xc1"
+                                                               "\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81\xe0\x3c\x06"
+                                                               "\x1e\x00\x30\x03\x00\xe0\x00\x00\x00\x7f\x03\xf8"
+                                                               "\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f\xe3\xc7"
+                                                               "\x00\x70\x0c\x04\x00\xe0\x1b\x83\x0c\x00\x00\x00"
+                                                               "\x0e\x00\xe0\x0f\x01\xb0\x1b\x01\x98\x11\x83\x18"
+                                                               "\x30\xc3\xfc\x7f\xc6\x06\x60\x6c\x06\xc0\x60\x00"
+                                                               "\x30\x0c\x04\x00\xe0\x1b\x03\x0c\x00\x00\x00\x7f"
+                                                               "\x03\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f"
+                                                               "\xe3\xc7\x01\x80\x1c\x10\x07\x01\xb8\x61\x80\x00"
+                                                               "\x00\x0e\x01\xc0\x3c\x0d\x81\xb0\x33\x04\x61\x8c"
+                                                               "\x30\xc7\xf9\xff\x30\x36\x07\x80\xf0\x18\x01\x80"
+                                                               "\x1c\x04\x60\xe0\x1b\x03\x0c\x00\x00\x00\x7f\x03"
+                                                               "\xf8\x00\xc0\x0c\x3f\xc7\x0c\x40\xcc\x1c\x7f\xe3"
+                                                               "\xc7\x01\xe0\x03\x00\xe0\x40\x0e\x01\xb8\x30\xc0"
+                                                               "\x00\x00\x00\xe0\x0e\x00\xf0\x1b\x01\xb0\x19\x81"
+                                                               "\x18\x31\x83\x0c\x3f\xc7\xfc\x60\x66\x06\xc0\x6c"
+                                                               "\x06\x01\xf0\x01\x00\xe0\x40\x0e\x01\xb0\x30\xc0"
+                                                               "\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4"
+                                                               "\x0c\xc1\xc7\xfe\x3c\x70\x00\x43\x98\xce\x00\x00"
+                                                               "\x40\x1c\x06\xe1\x86\x00\x00\x00\x38\x07\x00\xf0"
+                                                               "\x36\x06\xc0\xcc\x11\x86\x30\xc3\x1f\xe7\xfc\xc0"
+                                                               "\xd8\x1e\x03\xc0\x60\x1c\xc3\x78\x20\x00\x40\x0e"
+                                                               "\x01\xb0\x30\xc0\x00\x00\x07\xf0\x3f\x80\x0c\x00"
+                                                               "\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x04\x01"
+                                                               "\xc0\x6e\x18\x60\x00\x00\x03\x80\x70\x0f\x03\x60"
+                                                               "\x6c\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81"
+                                                               "\xe0\x3c\x06\x00\x00\x00\x30\x0e\x00\x80\x04\x00"
+                                                               "\xe0\x1f\x01\x18\x20\xc0\x00\x00\x07\xf0\x3f\x80"
+                                                               "\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70"
+                                                               "\x00\x00\x00\xe0\x0e\x00\x40\x01\xc0\xe0\x30\x10"
+                                                               "\x42\x0c\x63\x07\xc0\x00\x00\x01\xc0\x38\x07\x81"
+                                                               "\xb0\x36\x06\x60\x8c\x31\x86\x18\xff\x3f\xe6\x06"
+                                                               "\xc0\xf0\x1e\x03\x00\xc0\x38\x0e\x00\x00\x20\xc3"
+                                                               "\x18\x1f\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3"
+                                                               "\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x20\x06\x00"
+                                                               "\x70\x03\x02\x0c\x41\x0c\x60\xf8\x00\x00\x00\x38"
+                                                               "\x07\x00\xf0\x36\x06\xc0\xcc\x11\x86\x30\xc3\x1f"
+                                                               "\xe7\xfc\xc0\xd8\x1e\x03\xc0\x60\x30\x01\xc0\x06"
+                                                               "\x00\x00\x20\xc3\x18\x1f\x00\x00\x00\x07\xf0\x3f"
+                                                               "\x80\x0c\x00\xc3\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c"
+                                                               "\x70\x0c\x01\xe0\x04\x07\x82\x08\x41\x8c\x60\xf8"
+                                                               "\x00\x00\x00\x38\x07\x00\xf0\x36\x06\xc0\xcc\x11"
+                                                               "\x86\x30\xc3\x1f\xe7\xfc\xc0\xd8\x1e\x03\xc0\x60"
+                                                               "\x0f\x00\x18\x07\x00\x00\x20\xc3\x18\x1f\x00\x00"
+                                                               "\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc\x70\xc4\x0c"
+                                                               "\xc1\xc7\xfe\x3c\x70\x18\xc7\xd0\x8e\x00\x02\x0c"
+                                                               "\x41\x0c\x60\xf8\x00\x00\x00\x38\x07\x00\xf0\x36"
+                                                               "\x06\xc0\xcc\x11\x86\x30\xc3\x1f\xe7\xfc\xc0\xd8"
+                                                               "\x1e\x03\xc0\x60\x1c\xc3\x78\x00\x00\x00\x20\xc3"
+                                                               "\x18\x1f\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3"
+                                                               "\xfc\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x20\x84\x10"
+                                                               "\xc6\x0f\x80\x00\x00\x03\x80\x70\x0f\x03\x60\x6c"
+                                                               "\x0c\xc1\x18\x63\x0c\x31\xfe\x7f\xcc\x0d\x81\xe0"
+                                                               "\x3c\x06\x00\x00\x00\x30\x0e\x00\x80\x20\xc3\x18"
+                                                               "\x1f\x00\x00\x00\x07\xf0\x3f\x80\x0c\x00\xc3\xfc"
+                                                               "\x70\xc4\x0c\xc1\xc7\xfe\x3c\x70\x00\x00\x00\xe0"
+                                                               "\x0e\x00\x40\xff\xff\xfc\x03\x00\xc0\x30\x0f\xfb"
+                                                               "\xfe\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x00\x00"
+                                                               "\x03\x00\xe0\x10\x1e\x1f\xee\x1b\x03\xc0\xff\xfc"
+                                                               "\x03\x00\x7e\x0f\xc0\x00\x00\x0c\x03\x00\xc0\x0c"
+                                                               "\x03\xc0\x10\x78\x00\x00\x0f\xff\xff\xc0\x30\x0c"
+                                                               "\x03\x00\xff\xbf\xec\x03\x00\xc0\x30\x0c\x03\xff"
+                                                               "\xff\xc0\x3e\x01\x80\x20\x70\x00\x00\x01\xe1\xfe"
+                                                               "\xe1\xb0\x3c\x0f\xff\xc0\x30\x07\xe0\xfc\x10\x8e"
+                                                               "\x26\x59\x0c\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03"
+                                                               "\x00\xff\xbf\xec\x03\x00\xc0\x30\x0c\x03\xff\xff"
+                                                               "\xc0\x38\x9b\x64\x70\x00\x00\x07\x87\xfb\x86\xc0"
+                                                               "\xf0\x3f\xff\x00\xc0\x1f\x83\xf0\x00\x20\x0c\x06"
+                                                               "\x02\x01\xe0\x66\x18\x20\x00\x00\x1f\xfb\xff\x60"
+                                                               "\x0c\x01\x80\x30\x07\xfc\xff\x98\x03\x00\x60\x0c"
+                                                               "\x01\x80\x3f\xf7\xfe\x00\x60\x18\x00\x06\x01\xe0"
+                                                               "\xc3\x10\x20\x00\x1e\x0f\xf3\x86\x60\x6c\x0d\xff"
+                                                               "\xb0\x06\x00\x7e\x07\xe0\x03\x80\x30\x40\x78\x33"
+                                                               "\x18\x20\x00\x00\xff\xff\xfc\x03\x00\xc0\x30\x0f"
+                                                               "\xfb\xfe\xc0\x30\x0c\x03\x00\xc0\x3f\xff\xfc\x03"
+                                                               "\x00\xe0\x0c\x30\x1e\x18\x64\x08\x00\x1e\x1f\xee"
+                                                               "\x1b\x03\xc0\xff\xfc\x03\x00\x7e\x0f\xc0\x01\x80"
+                                                               "\x3c\x00\x80\xf0\x40\x3c\x0c\xc3\x04\x00\x00\x03"
+                                                               "\xff\x7f\xec\x01\x80\x30\x06\x00\xff\x9f\xf3\x00"
+                                                               "\x60\x0c\x01\x80\x30\x07\xfe\xff\xc0\x01\xe0\x04"
+                                                               "\x01\x80\xc0\xc0\x3c\x18\x62\x04\x00\x03\xc1\xfe"
+                                                               "\x70\xcc\x0d\x81\xbf\xf6\x00\xc0\x0f\xc0\xfc\x00"
+                                                               "\x18\xcf\x22\x38\x00\x04\x07\x83\x31\x82\x00\x00"
+                                                               "\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff\xbf\xec\x03"
+                                                               "\x00\xc0\x30\x0c\x03\xff\xff\xc0\x38\x9b\xc4\x30"
+                                                               "\x00\x0c\x07\x86\x19\x02\x00\x07\x87\xfb\x86\xc0"
+                                                               "\xf0\x3f\xff\x00\xc0\x1f\x83\xf0\x04\x07\x83\x31"
+                                                               "\x82\x00\x00\x0f\xff\xff\xc0\x30\x0c\x03\x00\xff"
+                                                               "\xbf\xec\x03\x00\xc0\x30\x0c\x03\xff\xff\xc0\x00"
+                                                               "\x00\x30\x0e\x01\x00\x0c\x07\x83\x31\x86\x00\x00"
+                                                               "\x01\xe1\xfe\xe1\xb0\x3c\x0f\xff\xc0\x30\x07\xe0"
+                                                               "\xfc\x00\x00\x00\xc0\x30\x0c\x00\x30\x1e\x06\x3c"
+                                                               "\x00\x00\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\x18\xff\x30\x1e\x01\x01\x83\x80\x00"
+                                                               "\x01\xf0\xf8\x0c\x06\x03\x01\x80\xc0\x61\xff\xff"
+                                                               "\x80\xff\x18\x18\x18\x18\x18\x18\x18\x18\x18\x18"
+                                                               "\x18\x18\x18\xff\x00\x00\x18\x38\x10\x18\x1c\x06"
+                                                               "\x00\x00\x00\x03\xe1\xf0\x18\x0c\x06\x03\x01\x80"
+                                                               "\xc3\xff\xff\x00\x00\x06\x03\x01\x80\x1f\x07\xf1"
+                                                               "\xc3\x30\x36\x07\x80\xf0\x1e\x03\xc0\x78\x0d\x81"
+                                                               "\xb0\x37\x0c\x7f\x07\xc0\x00\x00\x00\xc0\x38\x02"
+                                                               "\x00\x1f\x07\xf9\x83\x30\x3c\x07\x80\xd8\x1b\x06"
+                                                               "\x3f\xc3\xe0\x00\x00\x00\x60\x1c\x01\x00\x0f\x00"
+                                                               "\x30\x3c\x00\x00\x00\x3e\x0f\xe3\x86\x60\x6c\x0f"
+                                                               "\x01\xe0\x3c\x07\x80\xf0\x1b\x03\x60\x6e\x18\xfe"
+                                                               "\x0f\x80\x1e\x00\x60\x0c\x07\x00\x00\x00\x07\xc1"
+                                                               "\xfe\x60\xcc\x0f\x01\xe0\x36\x06\xc1\x8f\xf0\xf8"
+                                                               "\x00\x30\x0e\x00\x80\xe0\x1f\x03\x1c\x20\x00\x00"
+                                                               "\x1f\x03\xf8\x70\xc6\x06\x60\x6c\x06\xc0\x6c\x06"
+                                                               "\xc0\x6c\x06\x60\x66\x06\x70\xc3\xf8\x1f\x00\x00"
+                                                               "\x30\x0e\x00\x80\xe0\x1b\x03\x18\x20\x00\x00\x1f"
+                                                               "\x03\xfc\x60\xc6\x06\xc0\x6c\x06\x60\x66\x0c\x3f"
+                                                               "\xc1\xf0\x01\x80\x18\x00\x07\x01\xf0\x63\x88\x00"
+                                                               "\x00\x1f\x07\xf1\xc3\x30\x36\x07\x80\xf0\x1e\x03"
+                                                               "\xc0\x78\x0d\x81\xb0\x37\x0c\x7f\x07\xc0\x01\x00"
+                                                               "\x30\x03\x07\x01\xb0\x63\x08\x00\x00\x1f\x07\xf9"
+                                                               "\x83\x30\x3c\x07\x80\xd8\x1b\x06\x3f\xc3\xe0\x01"
+                                                               "\xe0\x03\x00\x70\x0c\x0e\x01\xf0\x31\xc2\x00\x00"
+                                                               "\x01\xf0\x3f\x87\x0c\x60\x66\x06\xc0\x6c\x06\xc0"
+                                                               "\x6c\x06\xc0\x66\x06\x60\x67\x0c\x3f\x81\xf0\x01"
+                                                               "\xe0\x03\x00\x70\x0c\x0e\x01\xb0\x31\x82\x00\x00"
+                                                               "\x01\xf0\x3f\xc6\x0c\x60\x6c\x06\xc0\x66\x06\x60"
+                                                               "\xc3\xfc\x1f\x00\x1c\x46\xf8\x06\x00\x00\xe0\x3e"
+                                                               "\x0c\x71\x00\x00\x03\xe0\xfe\x38\x66\x06\xc0\xf0"
+                                                               "\x1e\x03\xc0\x78\x0f\x01\xb0\x36\x06\xe1\x8f\xe0"
+                                                               "\xf8\x1c\xc6\xf0\x84\x00\x00\xe0\x36\x0c\x61\x00"
+                                                               "\x00\x03\xe0\xff\x30\x66\x07\x80\xf0\x1b\x03\x60"
+                                                               "\xc7\xf8\x7c\x00\x0e\x03\x60\xc6\x10\x00\x00\x3e"
+                                                               "\x0f\xe3\x86\x60\x6c\x0f\x01\xe0\x3c\x07\x80\xf0"
+                                                               "\x1b\x03\x60\x6e\x18\xfe\x0f\x80\x00\x00\x01\x80"
+                                                               "\x70\x04\x00\x06\x01\xe0\x66\x18\x62\x00\x00\x07"
+                                                               "\xc1\xfe\x60\xcc\x0f\x01\xe0\x36\x06\xc1\x8f\xf0"
+                                                               "\xf8\x00\x00\x00\x18\x07\x00\x40\x00\x80\x1c\x07"
+                                                               "\x00\xc0\x00\x10\x03\x1f\xf3\xf8\x70\xc6\x06\x60"
+                                                               "\x6c\x06\xc0\x6c\x06\xc0\x6c\x06\x60\x66\x06\x70"
+                                                               "\xc3\xf8\x1f\x00\x00\x80\x18\x06\x00\xc0\x00\x30"
+                                                               "\x03\x1f\xe3\xf8\x60\xc6\x06\xc0\x6c\x06\x60\x66"
+                                                               "\x0c\x3f\xc1\xf0\x38\x00\xc0\x02\x00\x01\x00\x31"
+                                                               "\xff\x3f\x87\x0c\x60\x66\x06\xc0\x6c\x06\xc0\x6c"
+                                                               "\x06\xc0\x66\x06\x60\x67\x0c\x3f\x81\xf0\x38\x00"
+                                                               "\xc0\x03\x00\x03\x00\x31\xfe\x3f\x86\x0c\x60\x6c"
+                                                               "\x06\xc0\x66\x06\x60\xc3\xfc\x1f\x00\x0c\x00\x78"
+                                                               "\x01\x80\xf0\x00\x10\x03\x1f\xf3\xf8\x70\xc6\x06"
+                                                               "\x60\x6c\x06\xc0\x6c\x06\xc0\x6c\x06\x60\x66\x06"
+                                                               "\x70\xc3\xf8\x1f\x00\x08\x00\xf0\x03\x00\x30\x1e"
+                                                               "\x00\x03\x00\x31\xfe\x3f\x86\x0c\x60\x6c\x06\xc0"
+                                                               "\x66\x06\x60\xc3\xfc\x1f\x00\x18\x43\xcc\x26\x86"
+                                                               "\x38\x00\x10\x03\x1f\xf3\xf8\x70\xc6\x06\x60\x6c"
+                                                               "\x06\xc0\x6c\x06\xc0\x6c\x06\x60\x66\x06\x70\xc3"
+                                                               "\xf8\x1f\x00\x18\x43\xcc\x26\x86\x38\x00\x30\x03"
+                                                               "\x1f\xe3\xf8\x60\xc6\x06\xc0\x6c\x06\x60\x66\x0c"
+                                                               "\x3f\xc1\xf0\x00\x10\x03\x1f\xf3\xf8\x70\xc6\x06"
+                                                               "\x60\x6c\x06\xc0\x6c\x06\xc0\x6c\x06\x60\x66\x06"
+                                                               "\x70\xc3\xf8\x1f\x00\x00\x00\x00\x60\x0e\x00\x40"
+                                                               "\x00\x30\x03\x1f\xe3\xf8\x60\xc6\x06\xc0\x6c\x06"
+                                                               "\x60\x66\x0c\x3f\xc1\xf0\x00\x00\x00\x06\x00\xe0"
+                                                               "\x04\x00\xc0\xf0\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03"
+                                                               "\xc0\xf0\x3c\x0f\x03\xe1\x9f\xe3\xe0\x00\x00\x03"
+                                                               "\x01\xc0\x20\xc0\xe0\x70\x38\x1c\x0e\x07\x07\x87"
+                                                               "\xfe\xbc\x40\x00\x00\xc0\xe0\x20\x1e\x00\xc1\xe0"
+                                                               "\x00\x00\x30\x3c\x0f\x03\xc0\xf0\x3c\x0f\x03\xc0"
+                                                               "\xf0\x3c\x0f\x03\xc0\xf8\x67\xf8\xf8\x3c\x03\x01"
+                                                               "\x83\x80\x00\x03\x03\x81\xc0\xe0\x70\x38\x1c\x1e"
+                                                               "\x1f\xfa\xf1\x03\x00\x30\x06\x00\x00\x30\x01\xe0"
+                                                               "\x7b\x03\x18\x18\xc0\xc6\x06\x30\x31\x81\x8c\x0c"
+                                                               "\x60\x63\x03\x18\x18\xc0\xc7\x0c\x1f\xe0\x7c\x00"
+                                                               "\x03\x00\x60\x18\x00\x03\x00\x3c\x0e\xc0\x8c\x08"
+                                                               "\xc0\x8c\x08\xc0\x8c\x18\xc3\x8f\xe8\x78\x80\x60"
+                                                               "\x01\xc0\x03\x80\x00\x30\x01\xe0\x7b\x03\x18\x18"
+                                                               "\xc0\xc6\x06\x30\x31\x81\x8c\x0c\x60\x63\x03\x18"
+                                                               "\x18\xc0\xc7\x0c\x1f\xe0\x7c\x00\x70\x01\x80\x0e"
+                                                               "\x00\x03\x00\x3c\x0e\xc0\x8c\x08\xc0\x8c\x08\xc0"
+                                                               "\x8c\x18\xc3\x8f\xe8\x78\x80\x1e\x00\x18\x07\x80"
+                                                               "\x00\x30\x01\xe0\x7b\x03\x18\x18\xc0\xc6\x06\x30"
+                                                               "\x31\x81\x8c\x0c\x60\x63\x03\x18\x18\xc0\xc7\x0c"
+                                                               "\x1f\xe0\x7c\x00\x3c\x00\x60\x06\x01\xc0\x00\x30"
+                                                               "\x03\xc0\xec\x08\xc0\x8c\x08\xc0\x8c\x08\xc1\x8c"
+                                                               "\x38\xfe\x87\x88\x30\x83\xcc\x13\x41\x8e\x00\x01"
+                                                               "\x80\x0f\x03\xd8\x18\xc0\xc6\x06\x30\x31\x81\x8c"
+                                                               "\x0c\x60\x63\x03\x18\x18\xc0\xc6\x06\x38\x60\xff"
+                                                               "\x03\xe0\x00\x30\x87\x88\x4d\x04\x70\x00\x30\x03"
+                                                               "\xc0\xec\x08\xc0\x8c\x08\xc0\x8c\x08\xc1\x8c\x38"
+                                                               "\xfe\x87\x88\x00\x18\x00\xf0\x3d\x81\x8c\x0c\x60"
+                                                               "\x63\x03\x18\x18\xc0\xc6\x06\x30\x31\x81\x8c\x0c"
+                                                               "\x60\x63\x86\x0f\xf0\x3e\x00\x00\x00\x00\x18\x01"
+                                                               "\xc0\x04\x00\x00\x30\x03\xc0\xec\x08\xc0\x8c\x08"
+                                                               "\xc0\x8c\x08\xc1\x8c\x38\xfe\x87\x88\x00\x00\x00"
+                                                               "\x0c\x01\xc0\x08\x00\x30\x03\x80\x1c\x00\x00\x01"
+                                                               "\x80\xd8\x1b\x06\x30\xc7\x30\x6c\x07\x80\xe0\x0c"
+                                                               "\x01\x80\x30\x06\x00\xc0\x18\x03\x00\x38\x01\x80"
+                                                               "\x1c\x00\x00\x01\xc0\xd8\x1b\x06\x30\xc6\x30\x66"
+                                                               "\x0c\x80\xf0\x1e\x03\x80\x30\x0c\x01\x83\xe0\x78"
+                                                               "\x00\xc0\x6c\x0d\x83\x18\x63\x98\x36\x03\xc0\x70"
+                                                               "\x06\x00\xc0\x18\x03\x00\x60\x0c\x01\x80\x00\x00"
+                                                               "\x00\xc0\x38\x02\x00\xe0\x6c\x0d\x83\x18\x63\x18"
+                                                               "\x33\x06\x40\x78\x0f\x01\xc0\x18\x06\x00\xcf\xf1"
+                                                               "\xfc\x10\x0f\x00\x30\x3c\x00\x00\x01\x80\xd8\x1b"
+                                                               "\x06\x30\xc7\x30\x6c\x07\x80\xe0\x0c\x01\x80\x30"
+                                                               "\x06\x00\xc0\x18\x03\x00\x0c\x01\xe0\x0c\x01\x81"
+                                                               "\xe0\x00\x00\x07\x03\x60\x6c\x18\xc3\x18\xc1\x98"
+                                                               "\x32\x03\xc0\x78\x0e\x00\xc0\x30\x06\x0f\x81\xe0"
+                                                               "\x00\x18\x47\x98\x9a\x31\xc0\x00\x00\x30\x1b\x03"
+                                                               "\x60\xc6\x18\xe6\x0d\x80\xf0\x1c\x01\x80\x30\x06"
+                                                               "\x00\xc0\x18\x03\x00\x60\x18\x47\x88\x9b\x11\xc0"
+                                                               "\x00\x00\x38\x1b\x03\x60\xc6\x18\xc6\x0c\xc1\x90"
+                                                               "\x1e\x03\xc0\x70\x06\x01\x80\x30\x7c\x0f\x00\xff"
+                                                               "\xff\xff\xff\xf0\xff\xff\xfc\xff\xff\xfc\x19\xdc"
+                                                               "\xe6\x70\x39\xce\xe6\x60\x39\xce\xe6\x60\x10\xcc"
+                                                               "\x66\x3b\x8c\xe7\x31\xc0\x31\xdc\x77\x19\x8e\xc3"
+                                                               "\x21\x80\x31\xdc\x77\x19\x8e\xc3\x21\x80\x0c\x03"
+                                                               "\x00\xc0\x20\x88\x7f\xf0\x80\x20\x08\x03\x00\xc0"
+                                                               "\x30\x0c\x03\x00\xc0\x30\x0c\x03\x00\xc0\x20\x08"
+                                                               "\x3f\xf8\x8c\x20\x08\x22\x3f\xfc\x20\x08\x03\x00"
+                                                               "\xc0\x30\x73\xef\xff\xf9\xe0\x40\xb8\x7e\x1f\x86"
+                                                               "\xc6\x7e\xe7\xc6\x60\x02\x0c\x71\xc7\x18\x1c\x1c"
+                                                               "\x1c\x0c\x08\x83\x0e\x0e\x1c\x31\xce\x63\x08\x00"
+                                                               "\x00\x18\x00\x80\x0c\x00\xc0\x0c\x00\xc0\x04\x00"
+                                                               "\x60\x06\x00\x60\x02\x00\x20\x03\x00\x30\x03\x00"
+                                                               "\x00\x3c\xcd\x1e\x5f\x28\x59\x9e\x0c\x28\x91\x24"
+                                                               "\x5f\xc1\x02\xfa\x08\x3e\x0c\x33\xbc\x11\x84\x3e"
+                                                               "\x8e\x1c\xde\xfe\x0c\x10\x61\x82\x0c\x10\x7a\x38"
+                                                               "\xde\xca\x18\xde\x3c\xcf\x0a\x17\xe1\x86\x18\x3c"
+                                                               "\xcd\x1e\x5f\x28\x59\x9e\x33\xcb\x0c\x30\xc3\x3f"
+                                                               "\x7b\x30\xc2\x11\x8c\x3f\xfc\x63\x1e\x0c\x11\xfc"
+                                                               "\x0c\x28\x91\x24\x5f\xc1\x02\xfa\x08\x3e\x0c\x33"
+                                                               "\xbc\x11\x84\x3e\x8e\x1c\xde\xfe\x0c\x10\x61\x82"
+                                                               "\x0c\x10\x7a\x38\xde\xca\x18\xde\x3c\xcf\x0a\x17"
+                                                               "\xe1\x86\x18\x38\x21\xc1\x0f\x08\x68\x43\x42\x1b"
+                                                               "\x13\xcf\xe6\x44\x33\x27\xf9\xcc\x48\x63\x43\x0a"
+                                                               "\x18\x50\xc3\x80\x20\x11\x00\x88\x04\x40\x62\x33"
+                                                               "\x11\x98\x94\x9f\xbf\x25\x21\x25\x0d\x28\x69\x43"
+                                                               "\x8a\x0c\x70\x63\x80\x00\xc0\x0c\x07\xf0\x0c\x00"
+                                                               "\xc1\xec\x3b\xc6\x0c\x40\xcc\x0c\xc0\xce\x0c\x60"
+                                                               "\xc7\xf4\x1e\x40\x00\x00\x07\xfc\x07\xc3\xfc\x60"
+                                                               "\x18\x03\x01\xff\x0c\x01\x80\xff\x86\x00\xc0\x18"
+                                                               "\x01\x80\x1f\xc1\xf0\x3f\x81\xfe\x0c\x18\x60\xcf"
+                                                               "\xff\x98\x30\xc1\x86\x1c\x3f\xc1\xf8\x0c\x00\x60"
+                                                               "\x03\x00\x18\x00\xc0\x00\xff\xe0\x30\x06\x00\xc0"
+                                                               "\x19\xff\xc0\x60\x0c\x03\x1f\xc1\xc0\x1c\x00\xe0"
+                                                               "\x0e\x00\x70\x30\x06\x00\xc4\x1b\x83\xc0\x60\x3c"
+                                                               "\xc5\xb0\x3c\x0e\x07\xc1\x98\x33\x0c\x7f\x0f\xc0"
+                                                               "\x3f\xc3\xfe\x30\x33\x03\x30\x33\x03\x30\xef\xfc"
+                                                               "\x30\x03\x00\xff\x83\x00\x30\x03\x00\x30\x00\x1f"
+                                                               "\x06\x11\x81\x20\x34\xf3\x92\x62\x6c\x4d\x89\xb1"
+                                                               "\x26\x3c\xc4\x1c\x82\x90\x50\x1b\x02\x30\x83\xe0"
+                                                               "\x73\x30\x6e\x0d\xb9\x51\x2a\x24\x7c\x88\xfb\x24"
+                                                               "\x6c\x8d\x91\x52\x2a\x44\x48\x88\x30\x07\x80\x24"
+                                                               "\x00\x20\x11\x01\x88\x18\x41\x9f\x90\x01\x00\x10"
+                                                               "\x03\x00\x33\xf3\x01\x70\x11\x01\xc0\x01\x00\x08"
+                                                               "\x01\xc0\x7c\x3c\x07\x20\x01\x80\x08\x11\x81\x98"
+                                                               "\x19\x81\x9f\xd0\x01\x00\x10\x03\x00\x33\xf3\x01"
+                                                               "\x70\x11\x01\xc0\x01\x00\x08\x01\xc0\x7c\x30\x07"
+                                                               "\x80\x24\x00\x20\x11\x01\x88\x18\x41\x9f\x90\x01"
+                                                               "\x00\x10\x03\x00\x33\xe3\x10\x70\x81\x07\xc0\x03"
+                                                               "\x00\x08\x03\x80\x78\x3c\x07\x20\x01\x80\x08\x11"
+                                                               "\x81\x98\x19\x81\x9f\xd0\x01\x00\x10\x03\x00\x33"
+                                                               "\xe3\x10\x70\x81\x07\xc0\x03\x00\x08\x03\x80\x78"
+                                                               "\xfc\x00\x60\x06\x00\x78\x10\x61\x83\x18\x39\x8f"
+                                                               "\x10\x01\x00\x10\x03\x00\x33\xe3\x10\x70\x81\x07"
+                                                               "\xc0\x03\x00\x08\x03\x80\x78\x0c\x00\xe0\x0b\x00"
+                                                               "\xd8\x14\xc1\xff\x18\x31\x81\x90\x01\x00\x10\x03"
+                                                               "\x00\x33\xe3\x10\x70\x81\x07\xc0\x03\x00\x08\x03"
+                                                               "\x80\x78\x30\x07\x80\x24\x00\x20\x11\x01\x88\x18"
+                                                               "\x41\x9f\x90\x01\x00\x10\x03\x00\x30\xc3\x08\x70"
+                                                               "\x81\x0f\xc0\x42\x02\x10\x19\x80\x78\x7c\x02\x00"
+                                                               "\x10\x00\xf8\x10\x61\x83\x18\x71\x8e\x10\x01\x00"
+                                                               "\x10\x03\x00\x30\xc3\x08\x70\x81\x0f\xc0\x42\x02"
+                                                               "\x10\x19\x80\x78\x30\x07\x80\x24\x00\x20\x11\x01"
+                                                               "\x88\x18\x41\x9f\x90\x01\x00\x10\x03\x00\x31\xe3"
+                                                               "\x11\x70\x8d\x07\xc0\x32\x03\x18\x18\xc0\x7c\xfc"
+                                                               "\x00\x60\x06\x00\x78\x10\x61\x83\x18\x39\x8f\x10"
+                                                               "\x01\x00\x10\x03\x00\x31\xe3\x11\x70\x8d\x07\xc0"
+                                                               "\x32\x03\x18\x18\xc0\x7c\x7c\x02\x00\x10\x00\xf8"
+                                                               "\x10\x61\x83\x18\x71\x8e\x10\x01\x00\x10\x03\x00"
+                                                               "\x31\xe3\x11\x70\x8d\x07\xc0\x32\x03\x18\x18\xc0"
+                                                               "\x7c\x7e\x00\x10\x01\x80\x08\x10\xc1\x84\x18\x61"
+                                                               "\x86\x10\x01\x00\x10\x03\x00\x31\xe3\x11\x70\x8d"
+                                                               "\x07\xc0\x32\x03\x18\x18\xc0\x7c\xff\xff\xf0\x30"
+                                                               "\x37\xc2\x46\x6c\x3c\xc1\xc0\x00\x30\x37\xc2\x4e"
+                                                               "\x6c\x3c\xc1\xc0\x01\x80\x80\xc0\x7f\xf8\x20\x20"
+                                                               "\x10\xff\xff\xc8\x0c\x06\x00\x00\x81\xc3\xcf\x0e"
+                                                               "\x07\x01\xe0\x1e\x03\x80\x40\x00\x0f\xff\xfc\x80"
+                                                               "\x70\x0f\x01\xe0\x18\x0c\x3c\x78\xe0\x40\x00\x00"
+                                                               "\x0f\xff\xfc\x18\x79\xb6\x18\x20";
+
+constexpr Font intel_one_mono_16_pt = {
+    .size = 16,
+    .numCharacters = 622,
+    .boundingBoxWidth = 20,
+    .boundingBoxHeight = 32,
+    .boundingBoxXOffset = -4,
+    .boundingBoxYOffset = -7,
+    .ascent = 23,
+    .descent = 6,
+    .asciiIndex = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+                   28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+                   53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+                   78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95},
+    .characters = intel_one_mono_16_pt_characters,
+    .bitmaps = intel_one_mono_16_pt_bitmaps,
+};
 
 } // namespace Display::Font
\ No newline at end of file
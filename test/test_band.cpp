@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "unity.h"
+
+#include "BandRenderer.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+static uint8_t spriteBitmap[(11 * 9) / 2 + 1];
+
+static void drawScene(::Display::Display &display, void *sprite) {
+  static uint8_t bitmap[(20 * 20) / 8];
+  for (size_t i = 0; i < sizeof(bitmap); i++)
+    bitmap[i] = (i * 73) ^ 0x5a;
+
+  display.clear();
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 41, 3, 17, 26, 0x2);
+  display.drawLine(-30, 70, 90, -10, 0xf);
+  display.drawCircle(Origin::Object2D::CENTER, 32, 32, 30, 0xc);
+
+  display.pushClip({4, 6, 40, 50});
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 30, 40, 20, 20, Bitmap::MONOCHROME, bitmap, 0xe);
+  display.drawSprite(Origin::Object2D::TOP_LEFT, 1, 3, *(Sprite *)sprite, {.transparent = true});
+  display.popClip();
+
+  display.drawText(Origin::Text::TOP_LEFT, 2, 2, Font::bailleul_8_pt, (char *)"Band", 0xb, {.transparent = true});
+
+  Span spans[] = {{-5, 12, 80}, {27, 13, 3}, {50, 63, 20}};
+  display.drawSpans(spans, sizeof(spans) / sizeof(spans[0]), 0x4);
+}
+
+TEST_CASE("Bands add up to the frame", "[band]") {
+  for (size_t i = 0; i < sizeof(spriteBitmap); i++)
+    spriteBitmap[i] = (i * 37) ^ 0xa5;
+  Sprite sprite(spriteBitmap, 11, 9);
+
+  TestDriver expected;
+  ::Display::Display display(&expected);
+  drawScene(display, &sprite);
+
+  DisplayList list(64, 64, 8192);
+  ::Display::Display recorder(&list);
+  TEST_ASSERT_EQUAL(ESP_OK, recorder.setup());
+  drawScene(recorder, &sprite);
+  list.optimize();
+
+  // rows that do and don't divide the height
+  uint16_t rowCounts[] = {1, 10, 16, 64};
+  for (uint16_t rows : rowCounts) {
+    TestDriver panel;
+    BandRenderer bands(&panel, rows);
+    TEST_ASSERT_EQUAL(rows * 32, bands.getBufferSize());
+
+    TEST_ASSERT_EQUAL(ESP_OK, bands.render(drawScene, &sprite));
+    TEST_ASSERT_EQUAL(ESP_OK, panel.waitForTransfer());
+    TEST_ASSERT_EQUAL_MEMORY(expected.getBuffer(), panel.getBuffer(), TestDriver::BUFFER_SIZE);
+
+    panel.clearBuffer();
+    TEST_ASSERT_EQUAL(ESP_OK, bands.render(list));
+    TEST_ASSERT_EQUAL_MEMORY(expected.getBuffer(), panel.getBuffer(), TestDriver::BUFFER_SIZE);
+  }
+}
+
+TEST_CASE("Bands are only sent to panels in rows", "[band]") {
+  Sprite sprite(spriteBitmap, 11, 9);
+
+  TestDriver panel;
+  ::Display::Display display(&panel);
+  BandRenderer bands(&panel, 8);
+
+  // nothing can be drawn outside of render
+  ::Display::Display bandDisplay(&bands);
+  bandDisplay.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 64, 64, 0xf);
+  TEST_ASSERT_TRUE(bandDisplay.getClip().isEmpty());
+
+  TEST_ASSERT_EQUAL(ESP_OK, display.setRotation(Rotation::CLOCKWISE_90));
+  TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, bands.render(drawScene, &sprite));
+
+  TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, panel.sendRowsToDisplayAsync(bands.getBuffer(), 60, 8));
+}
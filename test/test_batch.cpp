@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+TEST_CASE("Batched points match single pixels and mark one damage region", "[batch]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  Point points[] = {{0, 0}, {1, 0}, {63, 63}, {-1, 5}, {5, -1}, {64, 2}, {2, 64}, {17, 9}, {18, 9}};
+  ColoredPoint coloredPoints[] = {{4, 4, 0x1}, {5, 4, 0x2}, {-3, 4, 0x3}, {6, 70, 0x4}};
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  display.clear();
+  for (const Point &point : points)
+    display.drawPixel(point.x, point.y, 0xb);
+  for (const ColoredPoint &point : coloredPoints)
+    display.drawPixel(point.x, point.y, point.color);
+  memcpy(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  display.clear();
+  display.update();
+  display.drawPixels(points, sizeof(points) / sizeof(points[0]), 0xb);
+  TEST_ASSERT_EQUAL(1, driver.getDamage().size());
+  TEST_ASSERT_EQUAL(0, driver.getDamage()[0].x);
+  TEST_ASSERT_EQUAL(64, driver.getDamage()[0].width);
+  TEST_ASSERT_EQUAL(64, driver.getDamage()[0].height);
+
+  display.drawPixels(coloredPoints, sizeof(coloredPoints) / sizeof(coloredPoints[0]));
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+}
+
+TEST_CASE("Batched spans match blocks and are clipped", "[batch]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  Span spans[] = {{0, 0, 1}, {1, 1, 1}, {1, 2, 2}, {2, 3, 5}, {-4, 4, 10}, {60, 5, 10}, {-10, 6, 200},
+                  {3, -1, 4}, {3, 64, 4}, {-8, 7, 8}, {64, 8, 3}, {10, 9, 0}};
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  display.clear();
+  for (const Span &span : spans)
+    display.fillRectangle(Origin::Object2D::TOP_LEFT, span.x, span.y, span.width, 1, 0x6);
+  memcpy(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  display.clear();
+  display.update();
+  display.drawSpans(spans, sizeof(spans) / sizeof(spans[0]), 0x6);
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  TEST_ASSERT_EQUAL(1, driver.getDamage().size());
+  TEST_ASSERT_EQUAL(0, driver.getDamage()[0].y);
+  TEST_ASSERT_EQUAL(7, driver.getDamage()[0].height);
+}
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+static void setNibble(uint8_t *buffer, int16_t x, int16_t y, uint8_t color) {
+  uint8_t &pixels = buffer[(y * TestDriver::BYTES_PER_ROW) + (x / 2)];
+  pixels = x % 2 == 0 ? (pixels & 0x0f) | (color << 4) : (pixels & 0xf0) | color;
+}
+
+// writes a monochrome bitmap one pixel at a time, rows of the bitmap aren't padded to whole bytes
+static void writeBitmapByPixel(uint8_t *buffer, uint8_t *bitmap, int16_t x, int16_t y, uint16_t width,
+                               uint16_t height, uint8_t color, Flags flags) {
+  for (int16_t j = 0; j < height; j++) {
+    for (int16_t i = 0; i < width; i++) {
+      if (x + i < 0 || x + i >= 64 || y + j < 0 || y + j >= 64)
+        continue;
+
+      uint32_t bit = (j * width) + i;
+      if ((bitmap[bit / 8] >> (7 - (bit % 8))) & 0b1) {
+        setNibble(buffer, x + i, y + j, flags.erase ? 0x0 : color);
+      } else if (!flags.transparent) {
+        setNibble(buffer, x + i, y + j, 0x0);
+      }
+    }
+  }
+}
+
+// writes a 4 bit bitmap one pixel at a time, rows of the bitmap aren't padded to whole bytes
+static void write4BitBitmapByPixel(uint8_t *buffer, uint8_t *bitmap, int16_t x, int16_t y, uint16_t width,
+                                   uint16_t height, Flags flags) {
+  for (int16_t j = 0; j < height; j++) {
+    for (int16_t i = 0; i < width; i++) {
+      if (x + i < 0 || x + i >= 64 || y + j < 0 || y + j >= 64)
+        continue;
+
+      uint32_t pixel = (j * width) + i;
+      uint8_t color = pixel % 2 == 0 ? bitmap[pixel / 2] >> 4 : bitmap[pixel / 2] & 0x0f;
+      if (color != 0 || !flags.transparent)
+        setNibble(buffer, x + i, y + j, flags.erase ? 0x0 : color);
+    }
+  }
+}
+
+TEST_CASE("Monochrome bitmaps match a pixel by pixel blit", "[bitmap]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+  static uint8_t background[TestDriver::BUFFER_SIZE];
+
+  uint8_t bitmap[64];
+  for (uint8_t i = 0; i < sizeof(bitmap); i++)
+    bitmap[i] = (i * 73) ^ 0x5a;
+
+  for (size_t i = 0; i < sizeof(background); i++)
+    background[i] = i * 7;
+
+  Flags flagCombinations[3];
+  flagCombinations[1].transparent = true;
+  flagCombinations[2].erase = true;
+  flagCombinations[2].transparent = true;
+
+  TestDriver driver;
+  driver.initializeDisplay();
+
+  // bitmaps starting on either nibble, at every bit offset and with tails on both sides of the 8 pixel groups, also
+  // clipped by every edge
+  int16_t positions[][2] = {{0, 0}, {1, 3}, {5, 7}, {-3, 2}, {2, -5}, {50, 60}, {61, 9}};
+  uint16_t widths[] = {1, 3, 7, 8, 9, 16, 17, 23};
+
+  for (Flags flags : flagCombinations) {
+    for (auto &position : positions) {
+      for (uint16_t width : widths) {
+        uint16_t height = (sizeof(bitmap) * 8) / width;
+        if (height > 20)
+          height = 20;
+
+        memcpy(driver.getBuffer(), background, sizeof(background));
+        memcpy(expected, background, sizeof(background));
+
+        driver.writeBitmapToBuffer(position[0], position[1], width, height, bitmap, Bitmap::MONOCHROME, 0x9, flags);
+        writeBitmapByPixel(expected, bitmap, position[0], position[1], width, height, 0x9, flags);
+
+        TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+      }
+    }
+  }
+}
+
+TEST_CASE("4 bit bitmaps match a pixel by pixel blit", "[bitmap]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+  static uint8_t background[TestDriver::BUFFER_SIZE];
+
+  // every other byte has a transparent nibble
+  uint8_t bitmap[1024];
+  for (size_t i = 0; i < sizeof(bitmap); i++)
+    bitmap[i] = i % 2 == 0 ? (i * 37) & 0xf0 : (i * 73) ^ 0x5a;
+
+  for (size_t i = 0; i < sizeof(background); i++)
+    background[i] = i * 7;
+
+  Flags flagCombinations[4];
+  flagCombinations[1].transparent = true;
+  flagCombinations[2].erase = true;
+  flagCombinations[3].erase = true;
+  flagCombinations[3].transparent = true;
+
+  TestDriver driver;
+  driver.initializeDisplay();
+
+  // aligned and unaligned inner spans, spans shorter and longer than the vector kernels and clipping on every edge
+  int16_t positions[][2] = {{0, 0}, {1, 3}, {4, 7}, {-3, 2}, {-4, 1}, {2, -5}, {30, 60}, {33, 9}};
+  uint16_t widths[] = {1, 2, 3, 7, 8, 31, 32, 33, 63, 64, 65, 80};
+
+  for (Flags flags : flagCombinations) {
+    for (auto &position : positions) {
+      for (uint16_t width : widths) {
+        uint16_t height = (sizeof(bitmap) * 2) / width;
+        if (height > 20)
+          height = 20;
+
+        memcpy(driver.getBuffer(), background, sizeof(background));
+        memcpy(expected, background, sizeof(background));
+
+        driver.writeBitmapToBuffer(position[0], position[1], width, height, bitmap, Bitmap::GRAYSCALE_4_BIT, 0, flags);
+        write4BitBitmapByPixel(expected, bitmap, position[0], position[1], width, height, flags);
+
+        TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+      }
+    }
+  }
+}
@@ -0,0 +1,215 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Canvas.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+static uint8_t getNibble(const uint8_t *buffer, int16_t x, int16_t y) {
+  uint8_t pixels = buffer[(y * TestDriver::BYTES_PER_ROW) + (x / 2)];
+  return x % 2 == 0 ? pixels >> 4 : pixels & 0x0f;
+}
+
+static void setNibble(uint8_t *buffer, int16_t x, int16_t y, uint8_t color) {
+  uint8_t &pixels = buffer[(y * TestDriver::BYTES_PER_ROW) + (x / 2)];
+  pixels = x % 2 == 0 ? (pixels & 0x0f) | (color << 4) : (pixels & 0xf0) | color;
+}
+
+static bool getBit(const uint8_t *bitmap, uint16_t width, int16_t x, int16_t y) {
+  uint32_t bit = ((uint32_t)y * width) + x;
+  return (bitmap[bit / 8] >> (7 - (bit % 8))) & 0b1;
+}
+
+static void drawScene(::Display::Display &display) {
+  static uint8_t monochrome[(21 * 19) / 8 + 1];
+  static uint8_t grayscale[(13 * 11) / 2 + 1];
+  for (size_t i = 0; i < sizeof(monochrome); i++)
+    monochrome[i] = (i * 73) ^ 0x5a;
+  for (size_t i = 0; i < sizeof(grayscale); i++)
+    grayscale[i] = i % 3 == 0 ? (i * 37) & 0xf0 : (i * 73) ^ 0x5a;
+
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 3, 4, 50, 30, 0x1);
+  display.drawPixel(20, 21, 0x3);
+  display.drawLine(-30, 70, 90, -10, 0xf);
+  display.drawCircle(Origin::Object2D::CENTER, 32, 32, 30, 0xc);
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 41, 3, 17, 26, 0x0);
+  display.drawText(Origin::Text::TOP_LEFT, 2, 2, Font::bailleul_8_pt, (char *)"Dial", 0xb, {.transparent = true});
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 31, 41, 21, 19, Bitmap::MONOCHROME, monochrome, 0xe);
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 5, 30, 21, 19, Bitmap::MONOCHROME, monochrome, 0x6,
+                     {.transparent = true});
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 44, 27, 13, 11, Bitmap::GRAYSCALE_4_BIT, grayscale);
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 9, 9, 13, 11, Bitmap::GRAYSCALE_4_BIT, grayscale,
+                     {.transparent = true});
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 20, 12, 21, 19, Bitmap::MONOCHROME, monochrome, 0x6,
+                     {.transparent = true, .erase = true});
+
+  Span spans[] = {{-5, 12, 80}, {27, 13, 3}, {50, 47, 20}};
+  display.drawSpans(spans, sizeof(spans) / sizeof(spans[0]), 0x4);
+}
+
+TEST_CASE("4 bit canvases draw like the screen", "[canvas]") {
+  static uint8_t reference[TestDriver::BUFFER_SIZE];
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+  display.clear();
+  drawScene(display);
+  memcpy(reference, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  // an odd width keeps its last column empty in the padding of each row
+  Canvas canvas(63, 50, Bitmap::GRAYSCALE_4_BIT);
+  ::Display::Display canvasDisplay(&canvas);
+  TEST_ASSERT_EQUAL(ESP_OK, canvasDisplay.setup());
+  TEST_ASSERT_EQUAL(63, canvas.getWidth());
+  TEST_ASSERT_EQUAL(64, canvas.getBufferStride());
+  TEST_ASSERT_EQUAL(Canvas::bufferSize(64, 50, Bitmap::GRAYSCALE_4_BIT), canvas.getBufferSize());
+  drawScene(canvasDisplay);
+  for (int16_t y = 0; y < 50; y++) {
+    for (int16_t x = 0; x < 64; x++)
+      TEST_ASSERT_EQUAL_HEX8(x < 63 ? getNibble(reference, x, y) : 0, getNibble(canvas.getBuffer(), x, y));
+  }
+
+  // blitting the canvas puts the same frame, moved and cropped, on the screen
+  memset(expected, 0x77, sizeof(expected));
+  for (int16_t y = 0; y < 50; y++) {
+    for (int16_t x = 0; x < 63; x++) {
+      if (x + 7 < 64 && y + 5 < 64 && getNibble(reference, x, y) != 0)
+        setNibble(expected, x + 7, y + 5, getNibble(reference, x, y));
+    }
+  }
+
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 64, 64, 0x7);
+  canvas.drawTo(display, Origin::Object2D::TOP_LEFT, 7, 5, 0, {.transparent = true});
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+}
+
+TEST_CASE("Odd width canvases blit only their own columns", "[canvas]") {
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  Canvas canvas(7, 5, Bitmap::GRAYSCALE_4_BIT);
+  ::Display::Display canvasDisplay(&canvas);
+  TEST_ASSERT_EQUAL(ESP_OK, canvasDisplay.setup());
+  canvasDisplay.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 7, 5, 0x3);
+  canvasDisplay.drawPixel(6, 4, 0xc);
+
+  Origin::Object2D origins[] = {Origin::Object2D::TOP_LEFT, Origin::Object2D::BOTTOM_RIGHT};
+  int16_t xs[] = {10, 16}, ys[] = {20, 24};
+
+  // at an even and an odd x, opaquely next to pixels that must stay
+  for (int16_t left = 10; left <= 11; left++) {
+    for (int i = 0; i < 2; i++) {
+      display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 64, 64, 0x9);
+      canvas.drawTo(display, origins[i], xs[i] + (left - 10), ys[i]);
+
+      for (int16_t y = 18; y < 27; y++) {
+        for (int16_t x = 8; x < 20; x++) {
+          bool inside = x >= left && x < left + 7 && y >= 20 && y < 25;
+          uint8_t color = !inside ? 0x9 : x == left + 6 && y == 24 ? 0xc : 0x3;
+          TEST_ASSERT_EQUAL_HEX8(color, getNibble(driver.getBuffer(), x, y));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Monochrome canvases set every pixel that isn't 0", "[canvas]") {
+  static uint8_t reference[TestDriver::BUFFER_SIZE];
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+  display.clear();
+  display.pushClip({0, 0, 61, 50});
+  drawScene(display);
+  display.popClip();
+  memcpy(reference, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  // rows of 61 pixels start at a different bit every time
+  Canvas canvas(61, 50, Bitmap::MONOCHROME);
+  ::Display::Display canvasDisplay(&canvas);
+  TEST_ASSERT_EQUAL(ESP_OK, canvasDisplay.setup());
+  TEST_ASSERT_EQUAL(Canvas::bufferSize(61, 50, Bitmap::MONOCHROME), canvas.getBufferSize());
+  drawScene(canvasDisplay);
+
+  for (int16_t y = 0; y < 50; y++) {
+    for (int16_t x = 0; x < 61; x++)
+      TEST_ASSERT_EQUAL(getNibble(reference, x, y) != 0, getBit(canvas.getBuffer(), 61, x, y));
+  }
+
+  // a monochrome canvas blits in a single color, to screens and other canvases
+  Canvas screenCanvas(64, 64, Bitmap::GRAYSCALE_4_BIT);
+  ::Display::Display screenCanvasDisplay(&screenCanvas);
+  screenCanvasDisplay.setup();
+
+  memset(expected, 0, sizeof(expected));
+  for (int16_t y = 0; y < 50; y++) {
+    for (int16_t x = 0; x < 61; x++) {
+      if (x - 3 >= 0 && y + 20 < 64)
+        setNibble(expected, x - 3, y + 20, getNibble(reference, x, y) != 0 ? 0x9 : 0x0);
+    }
+  }
+
+  display.clear();
+  canvas.drawTo(display, Origin::Object2D::TOP_LEFT, -3, 20, 0x9);
+  canvas.drawTo(screenCanvasDisplay, Origin::Object2D::TOP_LEFT, -3, 20, 0x9);
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+  TEST_ASSERT_EQUAL_MEMORY(expected, screenCanvas.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, canvasDisplay.setRotation(Rotation::CLOCKWISE_90));
+}
+
+// a canvas whose buffer is sent as it is, e.g. by DMA to a panel that takes its format
+class SentCanvas : public Canvas {
+public:
+  using Canvas::Canvas;
+
+  uint8_t *sent = nullptr;
+
+protected:
+  esp_err_t queueBufferTransfer(uint8_t *frame, const ::Display::Driver::DamageMap &frameDamage) {
+    sent = frame;
+    return ESP_OK;
+  };
+};
+
+TEST_CASE("Double buffered canvases copy the bytes of their format", "[canvas]") {
+  static uint8_t second[Canvas::bufferSize(61, 40, Bitmap::RGB565) + 16];
+
+  Bitmap::BitmapFormat formats[] = {Bitmap::MONOCHROME, Bitmap::GRAYSCALE_2_BIT, Bitmap::GRAYSCALE_4_BIT,
+                                    Bitmap::GRAYSCALE_8_BIT, Bitmap::RGB565};
+  for (Bitmap::BitmapFormat format : formats) {
+    SentCanvas canvas(61, 40, format);
+    ::Display::Display display(&canvas);
+    size_t size = canvas.getBufferSize();
+
+    // bytes past the second buffer must stay untouched
+    memset(second, 0xa5, sizeof(second));
+    display.clear();
+    TEST_ASSERT_EQUAL(ESP_OK, canvas.enableDoubleBuffering(second));
+
+    for (int frame = 0; frame < 3; frame++) {
+      display.fillRectangle(Origin::Object2D::TOP_LEFT, 3 + (7 * frame), 5, 11, 30, 0xffff);
+      display.drawLine(0, 39 - frame, 60, frame, 0x9);
+      display.drawPixel(60, 39, 0x5);
+
+      TEST_ASSERT_EQUAL(ESP_OK, display.updateAsync());
+      TEST_ASSERT_EQUAL(ESP_OK, display.waitForUpdate());
+
+      // drawing continues on the frame that was just sent
+      TEST_ASSERT_NOT_NULL(canvas.sent);
+      TEST_ASSERT_TRUE(canvas.sent != canvas.getBuffer());
+      TEST_ASSERT_EQUAL_MEMORY(canvas.sent, canvas.getBuffer(), size);
+    }
+
+    TEST_ASSERT_EACH_EQUAL_HEX8(0xa5, second + size, sizeof(second) - size);
+  }
+}
@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+static void setNibble(uint8_t *buffer, int16_t x, int16_t y, uint8_t color) {
+  uint8_t &pixels = buffer[(y * TestDriver::BYTES_PER_ROW) + (x / 2)];
+  pixels = x % 2 == 0 ? (pixels & 0x0f) | (color << 4) : (pixels & 0xf0) | color;
+}
+
+static uint8_t getNibble(uint8_t *buffer, int16_t x, int16_t y) {
+  uint8_t pixels = buffer[(y * TestDriver::BYTES_PER_ROW) + (x / 2)];
+  return x % 2 == 0 ? pixels >> 4 : pixels & 0x0f;
+}
+
+// the unclipped Bresenham loop of drawLine, dropping pixels outside of the clip one at a time
+static void drawLineByPixel(uint8_t *buffer, Rect clip, int16_t xStart, int16_t yStart, int16_t xEnd, int16_t yEnd,
+                            uint8_t color) {
+  int16_t dX = abs(xEnd - xStart), xStep = xStart < xEnd ? 1 : -1;
+  int16_t dY = -1 * abs(yEnd - yStart), yStep = yStart < yEnd ? 1 : -1;
+  int16_t xHead = xStart, yHead = yStart;
+  int16_t error = dX + dY;
+
+  while (true) {
+    if (xHead >= clip.x && xHead < clip.x + clip.width && yHead >= clip.y && yHead < clip.y + clip.height)
+      setNibble(buffer, xHead, yHead, color);
+
+    if (xHead == xEnd && yHead == yEnd)
+      break;
+
+    if (2 * error >= dY) {
+      if (xHead == xEnd)
+        break;
+
+      error += dY;
+      xHead += xStep;
+    }
+
+    if (2 * error <= dX) {
+      if (yHead == yEnd)
+        break;
+
+      error += dX;
+      yHead += yStep;
+    }
+  }
+}
+
+static void drawScene(::Display::Display &display) {
+  static uint8_t bitmap[(20 * 20) / 8];
+  for (size_t i = 0; i < sizeof(bitmap); i++)
+    bitmap[i] = (i * 73) ^ 0x5a;
+
+  display.drawPixel(20, 20, 0x3);
+  display.drawLine(-30, 70, 90, -10, 0xf);
+  display.drawLine(10, 5, 10, 60, 0x7);
+  display.drawCircle(Origin::Object2D::CENTER, 32, 32, 30, 0xc);
+  display.drawCircle(Origin::Object2D::TOP_LEFT, -5, 50, 21, 0x5);
+  display.drawRectangle(Origin::Object2D::TOP_LEFT, 5, 30, 40, 9, 0x9);
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 41, 3, 17, 26, 0x2);
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 30, 40, 20, 20, Bitmap::MONOCHROME, bitmap, 0xe);
+  display.drawText(Origin::Text::TOP_LEFT, 2, 2, Font::bailleul_8_pt, (char *)"Clip", 0xb, {.transparent = true});
+
+  Span spans[] = {{-5, 12, 80}, {27, 13, 3}, {50, 63, 20}};
+  display.drawSpans(spans, sizeof(spans) / sizeof(spans[0]), 0x4);
+}
+
+TEST_CASE("Clip rectangles nest and restore", "[clip]") {
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  Rect clip = display.getClip();
+  TEST_ASSERT_EQUAL(0, clip.x);
+  TEST_ASSERT_EQUAL(64, clip.width);
+  TEST_ASSERT_EQUAL(64, clip.height);
+  TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, display.popClip());
+
+  TEST_ASSERT_EQUAL(ESP_OK, display.pushClip({-10, 10, 30, 100}));
+  clip = display.getClip();
+  TEST_ASSERT_EQUAL(0, clip.x);
+  TEST_ASSERT_EQUAL(10, clip.y);
+  TEST_ASSERT_EQUAL(20, clip.width);
+  TEST_ASSERT_EQUAL(54, clip.height);
+
+  TEST_ASSERT_EQUAL(ESP_OK, display.pushClip({15, 0, 10, 20}));
+  clip = display.getClip();
+  TEST_ASSERT_EQUAL(15, clip.x);
+  TEST_ASSERT_EQUAL(10, clip.y);
+  TEST_ASSERT_EQUAL(5, clip.width);
+  TEST_ASSERT_EQUAL(10, clip.height);
+
+  // a clip that misses the current one leaves nothing to draw to
+  TEST_ASSERT_EQUAL(ESP_OK, display.pushClip({40, 40, 5, 5}));
+  TEST_ASSERT_TRUE(display.getClip().isEmpty());
+  display.clear();
+  display.update();
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 64, 64, 0xf);
+  display.drawLine(0, 0, 63, 40, 0xf);
+  TEST_ASSERT_TRUE(driver.getDamage().isEmpty());
+
+  TEST_ASSERT_EQUAL(ESP_OK, display.popClip());
+  TEST_ASSERT_EQUAL(15, display.getClip().x);
+  TEST_ASSERT_EQUAL(ESP_OK, display.popClip());
+  TEST_ASSERT_EQUAL(0, display.getClip().x);
+  TEST_ASSERT_EQUAL(ESP_OK, display.popClip());
+  TEST_ASSERT_EQUAL(64, display.getClip().width);
+
+  for (uint8_t i = 0; i < ::Display::Display::MAX_CLIP_DEPTH; i++)
+    TEST_ASSERT_EQUAL(ESP_OK, display.pushClip({0, 0, 64, 64}));
+  TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, display.pushClip({0, 0, 64, 64}));
+}
+
+TEST_CASE("Clipped primitives only draw inside of the clip", "[clip]") {
+  static uint8_t unclipped[TestDriver::BUFFER_SIZE];
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  display.clear();
+  drawScene(display);
+  memcpy(unclipped, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  Rect clips[] = {{0, 0, 64, 64}, {7, 9, 30, 21}, {33, 0, 31, 64}, {0, 50, 64, 5}, {12, 12, 1, 1}};
+  for (Rect clip : clips) {
+    memset(expected, 0, sizeof(expected));
+    for (int16_t y = clip.y; y < clip.y + clip.height; y++) {
+      for (int16_t x = clip.x; x < clip.x + clip.width; x++)
+        setNibble(expected, x, y, getNibble(unclipped, x, y));
+    }
+
+    display.clear();
+    display.pushClip(clip);
+    drawScene(display);
+    display.popClip();
+
+    TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+  }
+}
+
+TEST_CASE("Clipped lines match the pixels of the whole line", "[clip]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  Rect clips[] = {{0, 0, 64, 64}, {10, 20, 30, 7}, {31, 3, 2, 60}, {5, 5, 50, 50}};
+
+  srand(1);
+  for (Rect clip : clips) {
+    for (int i = 0; i < 500; i++) {
+      // mostly lines that cross the clip somewhere, some far longer than the screen
+      int16_t range = i % 5 == 0 ? 600 : 120;
+      int16_t xStart = (rand() % range) - (range / 2) + 32, yStart = (rand() % range) - (range / 2) + 32;
+      int16_t xEnd = (rand() % range) - (range / 2) + 32, yEnd = (rand() % range) - (range / 2) + 32;
+
+      memset(expected, 0, sizeof(expected));
+      if (xStart == xEnd || yStart == yEnd) {
+        continue; // straight lines are blocks
+      }
+      drawLineByPixel(expected, clip, xStart, yStart, xEnd, yEnd, 0xa);
+
+      display.clear();
+      display.pushClip(clip);
+      display.drawLine(xStart, yStart, xEnd, yEnd, 0xa);
+      display.popClip();
+
+      TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+    }
+  }
+}
+
+TEST_CASE("Blocks are cropped to the height of non-square screens", "[clip]") {
+  typedef Driver::SerialDriver<64, 16> WideDriver;
+  static uint8_t buffer[WideDriver::BUFFER_SIZE + 64];
+  memset(buffer, 0xaa, sizeof(buffer));
+
+  WideDriver driver(Driver::PinMap(), buffer);
+  ::Display::Display display(&driver);
+
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 64, 64, 0xf);
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 10, 10, 20, 40, 0x1);
+
+  TEST_ASSERT_EACH_EQUAL_HEX8(0xaa, buffer + WideDriver::BUFFER_SIZE, 64);
+  TEST_ASSERT_EQUAL_HEX8(0x11, buffer[(15 * WideDriver::BYTES_PER_ROW) + 5]);
+}
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+TEST_CASE("Damage map ignores empty and contained rectangles", "[damage]") {
+  Driver::DamageMap damage;
+
+  damage.add({10, 10, 0, 5});
+  TEST_ASSERT_TRUE(damage.isEmpty());
+
+  damage.add({10, 10, 20, 8});
+  damage.add({12, 11, 4, 4});
+  TEST_ASSERT_EQUAL(1, damage.size());
+  TEST_ASSERT_EQUAL(10, damage[0].x);
+  TEST_ASSERT_EQUAL(20, damage[0].width);
+}
+
+TEST_CASE("Damage map merges neighbouring pixels", "[damage]") {
+  Driver::DamageMap damage;
+
+  for (int16_t x = 0; x < 16; x++)
+    damage.add({x, 4, 1, 1});
+
+  TEST_ASSERT_EQUAL(1, damage.size());
+  TEST_ASSERT_EQUAL(0, damage[0].x);
+  TEST_ASSERT_EQUAL(4, damage[0].y);
+  TEST_ASSERT_EQUAL(16, damage[0].width);
+  TEST_ASSERT_EQUAL(1, damage[0].height);
+}
+
+TEST_CASE("Damage map keeps distant rectangles apart", "[damage]") {
+  Driver::DamageMap damage;
+
+  damage.add({0, 0, 20, 8});
+  damage.add({100, 110, 20, 8});
+  TEST_ASSERT_EQUAL(2, damage.size());
+
+  damage.clear();
+  TEST_ASSERT_TRUE(damage.isEmpty());
+}
+
+TEST_CASE("Damage map forces merges when out of slots", "[damage]") {
+  Driver::DamageMap damage;
+
+  for (int16_t i = 0; i < Driver::DamageMap::MAX_RECTS + 4; i++)
+    damage.add({(int16_t)(i * 10), (int16_t)(i * 10), 2, 2});
+
+  TEST_ASSERT_LESS_OR_EQUAL(Driver::DamageMap::MAX_RECTS, damage.size());
+
+  // every original rectangle must still be covered
+  for (int16_t i = 0; i < Driver::DamageMap::MAX_RECTS + 4; i++) {
+    bool covered = false;
+    for (uint8_t j = 0; j < damage.size(); j++) {
+      const Rect &rect = damage[j];
+      if (rect.x <= i * 10 && rect.y <= i * 10 && rect.x + rect.width >= i * 10 + 2 &&
+          rect.y + rect.height >= i * 10 + 2)
+        covered = true;
+    }
+    TEST_ASSERT_TRUE(covered);
+  }
+}
+
+TEST_CASE("Driver tracks damage from drawing", "[damage]") {
+  Driver::SERIAL_64X64_DRIVER driver;
+  ::Display::Display display(&driver);
+
+  display.clear();
+  TEST_ASSERT_EQUAL(1, driver.getDamage().size());
+  TEST_ASSERT_EQUAL(64, driver.getDamage()[0].width);
+  TEST_ASSERT_EQUAL(64, driver.getDamage()[0].height);
+
+  display.update();
+  TEST_ASSERT_TRUE(driver.getDamage().isEmpty());
+
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, -4, 60, 10, 10, 0xf);
+  TEST_ASSERT_EQUAL(1, driver.getDamage().size());
+  TEST_ASSERT_EQUAL(0, driver.getDamage()[0].x);
+  TEST_ASSERT_EQUAL(60, driver.getDamage()[0].y);
+  TEST_ASSERT_EQUAL(6, driver.getDamage()[0].width);
+  TEST_ASSERT_EQUAL(4, driver.getDamage()[0].height);
+
+  display.drawPixel(40, 2, 0xf);
+  TEST_ASSERT_EQUAL(2, driver.getDamage().size());
+}
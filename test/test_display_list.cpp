@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "DisplayList.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+static void drawScene(::Display::Display &display, const Sprite &sprite) {
+  static uint8_t bitmap[(20 * 20) / 8];
+  for (size_t i = 0; i < sizeof(bitmap); i++)
+    bitmap[i] = (i * 73) ^ 0x5a;
+
+  display.clear();
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 41, 3, 17, 26, 0x2);
+  display.drawPixel(20, 20, 0x3);
+  display.drawLine(-30, 70, 90, -10, 0xf);
+  display.drawCircle(Origin::Object2D::CENTER, 32, 32, 30, 0xc);
+
+  display.pushClip({4, 6, 40, 50});
+  display.drawCircle(Origin::Object2D::TOP_LEFT, -5, 30, 31, 0x5);
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 30, 40, 20, 20, Bitmap::MONOCHROME, bitmap, 0xe);
+  display.drawSprite(Origin::Object2D::TOP_LEFT, 1, 3, sprite, {.transparent = true});
+  display.popClip();
+
+  display.drawText(Origin::Text::TOP_LEFT, 2, 2, Font::bailleul_8_pt, (char *)"List", 0xb, {.transparent = true});
+
+  ColoredPoint points[] = {{60, 60, 0x1}, {-1, 5, 0x2}, {61, 2, 0x3}};
+  display.drawPixels(points, sizeof(points) / sizeof(points[0]));
+
+  Span spans[] = {{-5, 12, 80}, {27, 13, 3}, {50, 63, 20}};
+  display.drawSpans(spans, sizeof(spans) / sizeof(spans[0]), 0x4);
+
+  // covers the top of the circle and the rectangle, which optimize drops
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 36, 0, 28, 4, 0x8);
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 36, 4, 28, 30, 0x8);
+}
+
+TEST_CASE("Display lists replay what they recorded", "[display list]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  uint8_t spriteBitmap[(11 * 9) / 2 + 1];
+  for (size_t i = 0; i < sizeof(spriteBitmap); i++)
+    spriteBitmap[i] = (i * 37) ^ 0xa5;
+  Sprite sprite(spriteBitmap, 11, 9);
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+  drawScene(display, sprite);
+  memcpy(expected, driver.getBuffer(), sizeof(expected));
+
+  DisplayList list(64, 64, 8192);
+  ::Display::Display recorder(&list);
+  TEST_ASSERT_EQUAL(ESP_OK, recorder.setup());
+  drawScene(recorder, sprite);
+  TEST_ASSERT_FALSE(list.hasOverflowed());
+
+  memset(driver.getBuffer(), 0x77, TestDriver::BUFFER_SIZE);
+  TEST_ASSERT_EQUAL(ESP_OK, list.replay(display));
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  uint16_t count = list.getCommandCount();
+  size_t size = list.getSize();
+  list.optimize();
+  TEST_ASSERT_LESS_THAN(count, list.getCommandCount());
+  TEST_ASSERT_LESS_THAN(size, list.getSize());
+
+  memset(driver.getBuffer(), 0x77, TestDriver::BUFFER_SIZE);
+  TEST_ASSERT_EQUAL(ESP_OK, list.replay(display));
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  // replaying inside of a clip rectangle
+  display.clear();
+  display.pushClip({10, 10, 30, 30});
+  drawScene(display, sprite);
+  display.popClip();
+  memcpy(expected, driver.getBuffer(), sizeof(expected));
+
+  display.clear();
+  display.pushClip({10, 10, 30, 30});
+  TEST_ASSERT_EQUAL(ESP_OK, list.replay(display));
+  display.popClip();
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+}
+
+TEST_CASE("Display lists optimize and overflow", "[display list]") {
+  DisplayList list(64, 64, 512);
+  ::Display::Display recorder(&list);
+  TEST_ASSERT_EQUAL(ESP_OK, recorder.setup());
+
+  // the rows of a menu merge into one block, which covers the circle
+  recorder.drawCircle(Origin::Object2D::CENTER, 20, 20, 10, 0xc);
+  for (int16_t y = 0; y < 40; y += 8)
+    recorder.fillRectangle(Origin::Object2D::TOP_LEFT, 0, y, 40, 8, 0x3);
+  TEST_ASSERT_EQUAL(6, list.getCommandCount());
+
+  list.optimize();
+  TEST_ASSERT_EQUAL(1, list.getCommandCount());
+
+  // a clear drops everything before it
+  recorder.drawText(Origin::Text::TOP_LEFT, 2, 2, Font::bailleul_8_pt, (char *)"Gone", 0xb);
+  recorder.clear();
+  list.optimize();
+  TEST_ASSERT_EQUAL(1, list.getCommandCount());
+
+  // nothing is replayed once a command didn't fit
+  TestDriver driver;
+  ::Display::Display display(&driver);
+  for (int16_t i = 0; i < 64 && !list.hasOverflowed(); i++)
+    recorder.fillRectangle(Origin::Object2D::TOP_LEFT, i, i, 1, 1, i % 16);
+  TEST_ASSERT_TRUE(list.hasOverflowed());
+  TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, list.replay(display));
+
+  list.reset();
+  TEST_ASSERT_FALSE(list.hasOverflowed());
+  TEST_ASSERT_EQUAL(0, list.getCommandCount());
+  TEST_ASSERT_EQUAL(ESP_OK, list.replay(display));
+}
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Canvas.hpp"
+
+using namespace Display;
+
+// sum of the pixels of a canvas
+static uint32_t sumPixels(Canvas &canvas) {
+  uint32_t sum = 0;
+  for (uint32_t i = 0; i < (uint32_t)canvas.getWidth() * canvas.getHeight(); i++)
+    sum += Bitmap::getPixel(canvas.getBuffer(), canvas.getFormat(), i);
+  return sum;
+}
+
+static uint8_t gradient[40 * 24];
+
+static const uint8_t *gradientRow(uint16_t row, void *arg) {
+  (*(uint16_t *)arg)++;
+  return gradient + (row * 40);
+}
+
+TEST_CASE("Ordered dithering keeps the gray levels", "[dither]") {
+  static uint8_t grays[16 * 16];
+
+  Canvas canvas(16, 16, Bitmap::MONOCHROME);
+  ::Display::Display display(&canvas);
+  TEST_ASSERT_EQUAL(ESP_OK, display.setup());
+  Ditherer mono(Ditherer::Method::ORDERED, Bitmap::MONOCHROME, 16);
+
+  // black, white and half of the pixels for a gray in the middle
+  uint8_t levels[] = {0, 255, 128};
+  uint32_t expected[] = {0, 256, 128};
+  for (int i = 0; i < 3; i++) {
+    memset(grays, levels[i], sizeof(grays));
+    TEST_ASSERT_EQUAL(ESP_OK, display.drawDithered(Origin::Object2D::TOP_LEFT, 0, 0, 16, 16, grays, mono));
+    TEST_ASSERT_EQUAL(expected[i], sumPixels(canvas));
+  }
+
+  // grays that are exactly a 4 bit level come out as that level everywhere
+  Canvas gray(16, 16, Bitmap::GRAYSCALE_4_BIT);
+  ::Display::Display grayDisplay(&gray);
+  grayDisplay.setup();
+  Ditherer fourBit(Ditherer::Method::ORDERED, Bitmap::GRAYSCALE_4_BIT, 16);
+
+  for (uint8_t level = 0; level < 16; level++) {
+    memset(grays, level * 17, sizeof(grays));
+    grayDisplay.drawDithered(Origin::Object2D::TOP_LEFT, 0, 0, 16, 16, grays, fourBit);
+    for (uint32_t i = 0; i < 16 * 16; i++)
+      TEST_ASSERT_EQUAL(level, Bitmap::getPixel(gray.getBuffer(), Bitmap::GRAYSCALE_4_BIT, i));
+  }
+
+  TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE,
+                    display.drawDithered(Origin::Object2D::TOP_LEFT, 0, 0, 17, 16, grays, mono));
+}
+
+TEST_CASE("Error diffusion keeps the average brightness", "[dither]") {
+  for (uint32_t i = 0; i < sizeof(gradient); i++)
+    gradient[i] = ((i % 40) * 255) / 39;
+
+  Bitmap::BitmapFormat formats[] = {Bitmap::MONOCHROME, Bitmap::GRAYSCALE_2_BIT, Bitmap::GRAYSCALE_4_BIT};
+
+  for (Bitmap::BitmapFormat format : formats) {
+    Canvas canvas(40, 24, format);
+    ::Display::Display display(&canvas);
+    TEST_ASSERT_EQUAL(ESP_OK, display.setup());
+    Ditherer ditherer(Ditherer::Method::ERROR_DIFFUSION, format, 40);
+
+    TEST_ASSERT_EQUAL(ESP_OK, display.drawDithered(Origin::Object2D::TOP_LEFT, 0, 0, 40, 24, gradient, ditherer));
+
+    uint32_t brightest = (1 << Bitmap::bitsPerPixel(format)) - 1;
+    uint32_t expected = 0;
+    for (uint32_t i = 0; i < sizeof(gradient); i++)
+      expected += gradient[i];
+
+    // within a pixel of the brightest level per row
+    uint32_t sum = (sumPixels(canvas) * 255) / brightest;
+    TEST_ASSERT_UINT32_WITHIN(24 * 255, expected, sum);
+
+    // the left edge stays dark and the right edge bright
+    TEST_ASSERT_EQUAL(0, Bitmap::getPixel(canvas.getBuffer(), format, 0));
+    TEST_ASSERT_EQUAL(brightest, Bitmap::getPixel(canvas.getBuffer(), format, 39));
+  }
+}
+
+TEST_CASE("Dithered rows come from a callback", "[dither]") {
+  for (uint32_t i = 0; i < sizeof(gradient); i++)
+    gradient[i] = (i * 7) ^ (i >> 3);
+
+  Canvas buffered(40, 24, Bitmap::GRAYSCALE_4_BIT), streamed(40, 24, Bitmap::GRAYSCALE_4_BIT);
+  ::Display::Display bufferedDisplay(&buffered), streamedDisplay(&streamed);
+  bufferedDisplay.setup();
+  streamedDisplay.setup();
+  Ditherer ditherer(Ditherer::Method::ERROR_DIFFUSION, Bitmap::GRAYSCALE_4_BIT, 40);
+
+  uint16_t requested = 0;
+  bufferedDisplay.drawDithered(Origin::Object2D::CENTER, 20, 12, 40, 24, gradient, ditherer);
+  TEST_ASSERT_EQUAL(ESP_OK, streamedDisplay.drawDithered(Origin::Object2D::CENTER, 20, 12, 40, 24, gradientRow,
+                                                         &requested, ditherer));
+  TEST_ASSERT_EQUAL(24, requested);
+  TEST_ASSERT_EQUAL_MEMORY(buffered.getBuffer(), streamed.getBuffer(), buffered.getBufferSize());
+
+  // rows outside of the clip are not asked for
+  requested = 0;
+  streamedDisplay.pushClip({0, 5, 40, 10});
+  streamedDisplay.drawDithered(Origin::Object2D::TOP_LEFT, 0, 0, 40, 24, gradientRow, &requested, ditherer);
+  streamedDisplay.popClip();
+  TEST_ASSERT_EQUAL(10, requested);
+
+  requested = 0;
+  streamedDisplay.drawDithered(Origin::Object2D::TOP_LEFT, 0, 30, 40, 24, gradientRow, &requested, ditherer);
+  TEST_ASSERT_EQUAL(0, requested);
+}
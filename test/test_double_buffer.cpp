@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+// Stands in for an SPI panel on the linux target. Queued frames stay "in flight" until complete() is called, and a
+// snapshot of each frame is kept to catch writes to a buffer that is owned by a transfer.
+class MockSPIDriver : public Driver::Driver {
+public:
+  static constexpr size_t BUFFER_SIZE = (64 * 64 * 4) / 8;
+
+  uint8_t frontBuffer[BUFFER_SIZE] = {0};
+
+  uint8_t *inFlight = nullptr;
+  uint8_t inFlightSnapshot[BUFFER_SIZE];
+  uint8_t lastSent[BUFFER_SIZE] = {0};
+  int queuedFrames = 0;
+  int syncFrames = 0;
+  bool transferComplete = false;
+
+  MockSPIDriver() { buffer = frontBuffer; };
+
+  uint16_t getWidth() { return 64; };
+  uint16_t getHeight() { return 64; };
+
+  esp_err_t sendCommands(uint8_t *commands, uint8_t bytes) { return ESP_OK; };
+  esp_err_t initializeDisplay() { return clearBuffer(); };
+
+  esp_err_t clearBuffer() {
+    memset(buffer, 0, BUFFER_SIZE);
+    markAllDamaged();
+    return ESP_OK;
+  };
+
+  esp_err_t sendBufferToDisplay() {
+    memcpy(lastSent, buffer, BUFFER_SIZE);
+    if (backBuffer != nullptr)
+      copyDamage(buffer, backBuffer, damage);
+    damage.clear();
+    syncFrames++;
+    return ESP_OK;
+  };
+
+  esp_err_t setRotation(Rotation rotation) { return ESP_OK; };
+  void printBuffer(){};
+
+  void setBufferPixel(int16_t x, int16_t y, uint16_t color) { setBufferBlock(x, y, 1, 1, color); };
+  void setBufferBlock(int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color) {
+    write4BitColorTo4BitBuffer(color, buffer, x, y, width, height);
+  };
+  void writeBitmapToBuffer(int16_t x, int16_t y, uint16_t width, uint16_t height, const void *bitmap,
+                           Bitmap::BitmapFormat format, uint16_t color, Flags flags = Flags()) {}
+
+  void complete() {
+    transferComplete = true;
+    notifyTransferComplete();
+  };
+
+  bool inFlightUntouched() { return inFlight == nullptr || memcmp(inFlight, inFlightSnapshot, BUFFER_SIZE) == 0; };
+
+protected:
+  esp_err_t queueBufferTransfer(uint8_t *frame, const ::Display::Driver::DamageMap &frameDamage) {
+    inFlight = frame;
+    memcpy(inFlightSnapshot, frame, BUFFER_SIZE);
+    transferComplete = false;
+    queuedFrames++;
+    return ESP_OK;
+  };
+
+  esp_err_t waitForBufferTransfer(TickType_t timeout) {
+    if (!transferComplete) {
+      if (timeout == 0)
+        return ESP_ERR_TIMEOUT;
+      complete(); // a blocking wait on the mock finishes the transfer immediately
+    }
+
+    memcpy(lastSent, inFlight, BUFFER_SIZE);
+    inFlight = nullptr;
+    return ESP_OK;
+  };
+};
+
+static uint8_t secondBuffer[MockSPIDriver::BUFFER_SIZE];
+
+static void countCompletions(void *arg) { (*(int *)arg)++; }
+
+TEST_CASE("Async update without a second buffer sends synchronously", "[double buffer]") {
+  MockSPIDriver driver;
+  ::Display::Display display(&driver);
+
+  int completions = 0;
+  driver.onTransferComplete(countCompletions, &completions);
+
+  display.clear();
+  TEST_ASSERT_EQUAL(ESP_OK, display.updateAsync());
+  TEST_ASSERT_EQUAL(1, driver.syncFrames);
+  TEST_ASSERT_EQUAL(0, driver.queuedFrames);
+  TEST_ASSERT_EQUAL(1, completions);
+}
+
+TEST_CASE("Async update draws into the buffer that is not in flight", "[double buffer]") {
+  MockSPIDriver driver;
+  ::Display::Display display(&driver);
+
+  TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, driver.enableDoubleBuffering(nullptr));
+  TEST_ASSERT_EQUAL(ESP_OK, driver.enableDoubleBuffering(secondBuffer));
+
+  int completions = 0;
+  driver.onTransferComplete(countCompletions, &completions);
+
+  display.clear();
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 10, 10, 0xf);
+  TEST_ASSERT_EQUAL(ESP_OK, display.updateAsync());
+  TEST_ASSERT_EQUAL(1, driver.queuedFrames);
+  TEST_ASSERT_EQUAL_PTR(driver.frontBuffer, driver.inFlight);
+  TEST_ASSERT_EQUAL_PTR(secondBuffer, driver.getBuffer());
+
+  // the drawing buffer starts out with the frame that was just sent
+  TEST_ASSERT_EQUAL_MEMORY(driver.frontBuffer, secondBuffer, MockSPIDriver::BUFFER_SIZE);
+
+  // drawing the next frame while the transfer runs must not touch the buffer in flight
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 20, 20, 10, 10, 0x8);
+  TEST_ASSERT_TRUE(driver.inFlightUntouched());
+
+  TEST_ASSERT_EQUAL(ESP_ERR_TIMEOUT, display.waitForUpdate(0));
+  TEST_ASSERT_EQUAL(0, completions);
+
+  driver.complete();
+  TEST_ASSERT_EQUAL(1, completions);
+  TEST_ASSERT_EQUAL(ESP_OK, display.waitForUpdate(0));
+
+  // the next frame swaps back and keeps everything drawn so far
+  TEST_ASSERT_EQUAL(ESP_OK, display.updateAsync());
+  TEST_ASSERT_EQUAL(2, driver.queuedFrames);
+  TEST_ASSERT_EQUAL_PTR(secondBuffer, driver.inFlight);
+  TEST_ASSERT_EQUAL_PTR(driver.frontBuffer, driver.getBuffer());
+  TEST_ASSERT_EQUAL_MEMORY(secondBuffer, driver.frontBuffer, MockSPIDriver::BUFFER_SIZE);
+  TEST_ASSERT_EQUAL_HEX8(0xff, driver.getBuffer()[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x88, driver.getBuffer()[(20 * 32) + 10]);
+}
+
+TEST_CASE("Async update waits for the previous frame before swapping", "[double buffer]") {
+  MockSPIDriver driver;
+  ::Display::Display display(&driver);
+  driver.enableDoubleBuffering(secondBuffer);
+
+  display.clear();
+  display.updateAsync();
+  display.drawPixel(1, 1, 0xf);
+
+  // the previous transfer is still in flight so the blocking send has to finish it first
+  TEST_ASSERT_FALSE(driver.transferComplete);
+  TEST_ASSERT_EQUAL(ESP_OK, display.updateAsync());
+  TEST_ASSERT_EQUAL(2, driver.queuedFrames);
+  TEST_ASSERT_TRUE(driver.inFlightUntouched());
+
+  // an unchanged frame queues nothing
+  display.waitForUpdate();
+  TEST_ASSERT_EQUAL(ESP_OK, display.updateAsync());
+  TEST_ASSERT_EQUAL(2, driver.queuedFrames);
+}
+
+TEST_CASE("Async update of an unchanged frame still completes", "[double buffer]") {
+  MockSPIDriver driver;
+  ::Display::Display display(&driver);
+  driver.enableDoubleBuffering(secondBuffer);
+
+  int completions = 0;
+  driver.onTransferComplete(countCompletions, &completions);
+
+  display.clear();
+  TEST_ASSERT_EQUAL(ESP_OK, display.updateAsync());
+  driver.complete();
+  TEST_ASSERT_EQUAL(1, completions);
+
+  // apps that start the next frame from the callback would stall if it didn't run
+  TEST_ASSERT_EQUAL(ESP_OK, display.updateAsync());
+  TEST_ASSERT_EQUAL(1, driver.queuedFrames);
+  TEST_ASSERT_EQUAL(2, completions);
+}
@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_128X128_DRIVER TestDriver;
+
+static void setNibble(uint8_t *buffer, int16_t x, int16_t y, uint8_t color) {
+  uint8_t &pixels = buffer[(y * TestDriver::BYTES_PER_ROW) + (x / 2)];
+  pixels = x % 2 == 0 ? (pixels & 0x0f) | (color << 4) : (pixels & 0xf0) | color;
+}
+
+TEST_CASE("Block fills match a pixel by pixel fill", "[fill]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  // every combination of split edges, inner spans around the word size and full rows
+  for (int16_t x = -1; x < 12; x++) {
+    for (uint16_t width = 1; width < 40; width += 3) {
+      display.clear();
+      memset(expected, 0, sizeof(expected));
+
+      display.fillRectangle(Origin::Object2D::TOP_LEFT, x, 3, width, 5, 0xc);
+      for (int16_t j = 3; j < 8; j++) {
+        for (int16_t i = x < 0 ? 0 : x; i < x + width; i++)
+          setNibble(expected, i, j, 0xc);
+      }
+
+      TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+    }
+  }
+
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 128, 128, 0x5);
+  memset(expected, 0x55, sizeof(expected));
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+}
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+
+// The inner span loop of write4BitColorTo4BitBuffer before it stored whole words. GCC would turn this into memset
+// otherwise.
+__attribute__((optimize("no-tree-loop-distribute-patterns"))) static void
+fillByteByByte(uint8_t *buffer, int16_t x, int16_t y, uint16_t width, uint16_t height, uint8_t color) {
+  buffer += (y * TestDriver::BYTES_PER_ROW) + (x / 2);
+  for (int16_t j = 0; j < height; j++) {
+    for (int16_t i = 0; i < width / 2; i++)
+      buffer[i] = color;
+    buffer += TestDriver::BYTES_PER_ROW;
+  }
+}
+
+TEST_CASE("Benchmark block fills against a byte loop", "[fill][benchmark]") {
+  static uint8_t reference[TestDriver::BUFFER_SIZE];
+  static constexpr int ITERATIONS = 20000;
+
+  TestDriver driver;
+
+  struct {
+    const char *name;
+    int16_t x, y;
+    uint16_t width, height;
+  } cases[] = {
+      {"full screen", 0, 0, 128, 128},
+      {"100x100 rectangle", 14, 14, 100, 100},
+      {"text background", 10, 50, 60, 16},
+  };
+
+  for (auto &benchmark : cases) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+      fillByteByByte(reference, benchmark.x, benchmark.y, benchmark.width, benchmark.height, i & 0xff);
+    auto bytes = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+      driver.setBufferBlock(benchmark.x, benchmark.y, benchmark.width, benchmark.height, i & 0x0f);
+    auto words = std::chrono::steady_clock::now() - start;
+
+    printf("%s: byte loop %lld ns, word fill %lld ns per fill\n", benchmark.name,
+           (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(bytes).count() / ITERATIONS,
+           (long long)std::chrono::duration_cast<std::chrono::nanoseconds>(words).count() / ITERATIONS);
+  }
+
+  TEST_ASSERT_EQUAL_HEX8((ITERATIONS - 1) & 0xff, reference[(60 * TestDriver::BYTES_PER_ROW) + 10]);
+}
+
+#endif
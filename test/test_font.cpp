@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "unity.h"
+
+#include "Font.hpp"
+
+using namespace Display;
+
+TEST_CASE("Every character is found through the indexes", "[font]") {
+  const Font::Font *fonts[] = {&Font::bailleul_8_pt, &Font::bailleul_bold_16_pt, &Font::intel_one_mono_12_pt};
+
+  for (const Font::Font *font : fonts) {
+    // the replacement comes first, then the characters sorted by code
+    for (uint16_t i = 1; i <= font->numCharacters; i++) {
+      const Font::Character &character = font->characters[i];
+      if (i > 1)
+        TEST_ASSERT_TRUE(font->characters[i - 1].code < character.code);
+
+      TEST_ASSERT_EQUAL_PTR(&character, &font->getCharacter(character.code));
+    }
+
+    // characters the font doesn't have, inside and outside of printable ASCII
+    uint16_t missing[] = {0x0, 0x1f, 0x7f, 0xffff};
+    for (uint16_t code : missing)
+      TEST_ASSERT_EQUAL_PTR(&font->characters[0], &font->getCharacter(code));
+  }
+}
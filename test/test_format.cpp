@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Canvas.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+// draws with colors converted from 4 bit grays, so every canvas ends up with the converted 4 bit frame
+static void drawScene(::Display::Display &display, Bitmap::BitmapFormat format) {
+  static uint8_t bitmap[(21 * 13) / 2 + 1];
+  static uint8_t mask[(20 * 20) / 8];
+  for (size_t i = 0; i < sizeof(bitmap); i++)
+    bitmap[i] = (i * 37) ^ 0xa5;
+  for (size_t i = 0; i < sizeof(mask); i++)
+    mask[i] = (i * 73) ^ 0x5a;
+
+  auto color = [&](uint16_t gray) { return Bitmap::convertColor(gray, Bitmap::GRAYSCALE_4_BIT, format); };
+
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 3, 5, 31, 17, color(0x7));
+  display.drawCircle(Origin::Object2D::CENTER, 20, 20, 30, color(0xc));
+  display.drawLine(-3, 30, 40, 2, color(0x3));
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 9, 14, 20, 20, Bitmap::MONOCHROME, mask, color(0xa),
+                     {.transparent = true});
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 21, -3, 21, 13, Bitmap::GRAYSCALE_4_BIT, bitmap);
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, -5, 25, 21, 13, Bitmap::GRAYSCALE_4_BIT, bitmap,
+                     {.transparent = true});
+  display.drawText(Origin::Text::TOP_LEFT, 2, 2, Font::bailleul_8_pt, (char *)"Fmt", color(0xf),
+                   {.transparent = true});
+}
+
+TEST_CASE("Colors convert between formats", "[format]") {
+  TEST_ASSERT_EQUAL_HEX16(0xff, Bitmap::convertColor(0xf, Bitmap::GRAYSCALE_4_BIT, Bitmap::GRAYSCALE_8_BIT));
+  TEST_ASSERT_EQUAL_HEX16(0x88, Bitmap::convertColor(0x8, Bitmap::GRAYSCALE_4_BIT, Bitmap::GRAYSCALE_8_BIT));
+  TEST_ASSERT_EQUAL_HEX16(0x5, Bitmap::convertColor(0x1, Bitmap::GRAYSCALE_2_BIT, Bitmap::GRAYSCALE_4_BIT));
+  TEST_ASSERT_EQUAL_HEX16(0x2, Bitmap::convertColor(0x80, Bitmap::GRAYSCALE_8_BIT, Bitmap::GRAYSCALE_2_BIT));
+  TEST_ASSERT_EQUAL_HEX16(0x1, Bitmap::convertColor(0x1, Bitmap::GRAYSCALE_4_BIT, Bitmap::MONOCHROME));
+  TEST_ASSERT_EQUAL_HEX16(0xf, Bitmap::convertColor(0x1, Bitmap::MONOCHROME, Bitmap::GRAYSCALE_4_BIT));
+  TEST_ASSERT_EQUAL_HEX16(0xffff, Bitmap::convertColor(0xf, Bitmap::GRAYSCALE_4_BIT, Bitmap::RGB565));
+  TEST_ASSERT_EQUAL_HEX16(0xf, Bitmap::convertColor(0xffff, Bitmap::RGB565, Bitmap::GRAYSCALE_4_BIT));
+  TEST_ASSERT_EQUAL_HEX16(0x0, Bitmap::convertColor(0x0, Bitmap::GRAYSCALE_4_BIT, Bitmap::RGB565));
+
+  // every 4 bit gray survives the way through 8 bits and RGB565
+  for (uint16_t gray = 0; gray < 16; gray++) {
+    uint16_t wide = Bitmap::convertColor(gray, Bitmap::GRAYSCALE_4_BIT, Bitmap::GRAYSCALE_8_BIT);
+    TEST_ASSERT_EQUAL(gray, Bitmap::convertColor(wide, Bitmap::GRAYSCALE_8_BIT, Bitmap::GRAYSCALE_4_BIT));
+
+    uint16_t color = Bitmap::convertColor(gray, Bitmap::GRAYSCALE_4_BIT, Bitmap::RGB565);
+    TEST_ASSERT_EQUAL(gray, Bitmap::convertColor(color, Bitmap::RGB565, Bitmap::GRAYSCALE_4_BIT));
+  }
+
+  // pure red is dark, pure green is bright
+  TEST_ASSERT_EQUAL_HEX16(0x4, Bitmap::convertColor(0xf800, Bitmap::RGB565, Bitmap::GRAYSCALE_4_BIT));
+  TEST_ASSERT_EQUAL_HEX16(0x9, Bitmap::convertColor(0x07e0, Bitmap::RGB565, Bitmap::GRAYSCALE_4_BIT));
+}
+
+TEST_CASE("Canvases of every format draw the same frame", "[format]") {
+  static uint8_t converted[Canvas::bufferSize(46, 37, Bitmap::RGB565)];
+
+  Canvas reference(46, 37, Bitmap::GRAYSCALE_4_BIT);
+  ::Display::Display referenceDisplay(&reference);
+  TEST_ASSERT_EQUAL(ESP_OK, referenceDisplay.setup());
+  drawScene(referenceDisplay, Bitmap::GRAYSCALE_4_BIT);
+
+  Bitmap::BitmapFormat formats[] = {Bitmap::MONOCHROME, Bitmap::GRAYSCALE_2_BIT, Bitmap::GRAYSCALE_8_BIT,
+                                    Bitmap::RGB565};
+
+  for (Bitmap::BitmapFormat format : formats) {
+    Canvas canvas(46, 37, format);
+    ::Display::Display display(&canvas);
+    TEST_ASSERT_EQUAL(ESP_OK, display.setup());
+    TEST_ASSERT_EQUAL(Canvas::bufferSize(46, 37, format), canvas.getBufferSize());
+
+    drawScene(display, format);
+
+    Bitmap::convert(reference.getBuffer(), Bitmap::GRAYSCALE_4_BIT, converted, format, 46, 37);
+    TEST_ASSERT_EQUAL_MEMORY(converted, canvas.getBuffer(), canvas.getBufferSize());
+
+    // lossless formats convert back to the 4 bit frame
+    if (format == Bitmap::GRAYSCALE_8_BIT || format == Bitmap::RGB565) {
+      memset(converted, 0, sizeof(converted));
+      Bitmap::convert(canvas.getBuffer(), format, converted, Bitmap::GRAYSCALE_4_BIT, 46, 37);
+      TEST_ASSERT_EQUAL_MEMORY(reference.getBuffer(), converted, reference.getBufferSize());
+    }
+  }
+}
+
+TEST_CASE("Bitmaps of every format draw on 4 bit screens", "[format]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  Canvas reference(29, 19, Bitmap::GRAYSCALE_4_BIT);
+  ::Display::Display referenceDisplay(&reference);
+  referenceDisplay.setup();
+  drawScene(referenceDisplay, Bitmap::GRAYSCALE_4_BIT);
+
+  Canvas wide(29, 19, Bitmap::GRAYSCALE_8_BIT), color(29, 19, Bitmap::RGB565);
+  ::Display::Display wideDisplay(&wide), colorDisplay(&color);
+  wideDisplay.setup();
+  colorDisplay.setup();
+  drawScene(wideDisplay, Bitmap::GRAYSCALE_8_BIT);
+  drawScene(colorDisplay, Bitmap::RGB565);
+
+  Flags flagCombinations[3];
+  flagCombinations[1].transparent = true;
+  flagCombinations[2].erase = true;
+  flagCombinations[2].transparent = true;
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  Rotation rotations[] = {Rotation::DEFAULT, Rotation::CLOCKWISE_90};
+  Canvas *canvases[] = {&wide, &color};
+
+  for (Rotation rotation : rotations) {
+    display.setRotation(rotation);
+
+    for (Flags flags : flagCombinations) {
+      display.clear();
+      display.fillRectangle(Origin::Object2D::TOP_LEFT, 10, 10, 30, 30, 0x6);
+      reference.drawTo(display, Origin::Object2D::TOP_LEFT, -3, 41, 0xf, flags);
+      reference.drawTo(display, Origin::Object2D::TOP_LEFT, 20, 5, 0xf, flags);
+      memcpy(expected, driver.getBuffer(), sizeof(expected));
+
+      for (Canvas *canvas : canvases) {
+        display.clear();
+        display.fillRectangle(Origin::Object2D::TOP_LEFT, 10, 10, 30, 30, 0x6);
+        canvas->drawTo(display, Origin::Object2D::TOP_LEFT, -3, 41, 0xf, flags);
+        canvas->drawTo(display, Origin::Object2D::TOP_LEFT, 20, 5, 0xf, flags);
+        TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+      }
+    }
+  }
+}
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+TEST_CASE("Driver instances draw into their own buffers", "[frame buffer]") {
+  Driver::SERIAL_64X64_DRIVER first, second;
+  TEST_ASSERT_NOT_NULL(first.getBuffer());
+  TEST_ASSERT_NOT_NULL(second.getBuffer());
+  TEST_ASSERT_TRUE(first.getBuffer() != second.getBuffer());
+
+  ::Display::Display firstDisplay(&first), secondDisplay(&second);
+  TEST_ASSERT_EQUAL(ESP_OK, firstDisplay.setup());
+  TEST_ASSERT_EQUAL(ESP_OK, secondDisplay.setup());
+
+  firstDisplay.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 64, 64, 0xf);
+  for (size_t i = 0; i < second.getBufferSize(); i++)
+    TEST_ASSERT_EQUAL_HEX8(0x00, second.getBuffer()[i]);
+}
+
+TEST_CASE("Driver draws into a caller supplied buffer", "[frame buffer]") {
+  static uint8_t frameBuffer[Driver::SERIAL_64X64_DRIVER::BUFFER_SIZE];
+
+  Driver::SERIAL_64X64_DRIVER driver(Driver::PinMap(), frameBuffer);
+  ::Display::Display display(&driver);
+  TEST_ASSERT_EQUAL_PTR(frameBuffer, driver.getBuffer());
+
+  display.clear();
+  display.drawPixel(3, 1, 0xa);
+  TEST_ASSERT_EQUAL_HEX8(0x0a, frameBuffer[32 + 1]);
+}
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+// text at even and odd x, partly off screen and in black, which the cache leaves to the bitmaps
+static void drawLabels(::Display::Display &display) {
+  display.clear();
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 20, 64, 20, 0x5);
+  display.drawText(Origin::Text::TOP_LEFT, 2, 2, Font::bailleul_8_pt, (char *)"Score 12", 0xb, {.transparent = true});
+  display.drawText(Origin::Text::TOP_LEFT, 3, 14, Font::bailleul_8_pt, (char *)"Score 21", 0xb);
+  display.drawText(Origin::Text::CENTER, 30, 30, Font::intel_one_mono_12_pt, (char *)"Menu", 0xff,
+                   {.transparent = true});
+  display.drawText(Origin::Text::TOP_LEFT, 41, 44, Font::bailleul_bold_12_pt, (char *)"Off", 0x7);
+  display.drawText(Origin::Text::TOP_LEFT, -3, 50, Font::bailleul_8_pt, (char *)"Edge", 0x0, {.transparent = true});
+}
+
+TEST_CASE("Cached glyphs draw the same text", "[glyph cache]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+  GlyphCache cache(4096);
+
+  Rotation rotations[] = {Rotation::DEFAULT, Rotation::CLOCKWISE_90};
+  for (Rotation rotation : rotations) {
+    display.setRotation(rotation);
+
+    display.setGlyphCache(nullptr);
+    drawLabels(display);
+    memcpy(expected, driver.getBuffer(), sizeof(expected));
+
+    // the first frame expands the glyphs and the second one only hits
+    display.setGlyphCache(&cache);
+    for (int frame = 0; frame < 2; frame++) {
+      cache.resetCounters();
+      drawLabels(display);
+      TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+    }
+
+    TEST_ASSERT_EQUAL(0, cache.getMisses());
+    TEST_ASSERT_EQUAL(21, cache.getHits());
+  }
+
+  TEST_ASSERT_TRUE(cache.getUsedBytes() <= cache.getBudget());
+}
+
+TEST_CASE("Glyphs used least recently are dropped", "[glyph cache]") {
+  const Font::Font &font = Font::bailleul_8_pt;
+  const Font::Character &a = font.getCharacter('a'), &b = font.getCharacter('b'), &c = font.getCharacter('c');
+
+  // room for a and one of b or c
+  Sprite sprite(font.getBitmap(a), Bitmap::MONOCHROME, 0xf, a.bbxWidth, a.bbxHeight);
+  Sprite spriteB(font.getBitmap(b), Bitmap::MONOCHROME, 0xf, b.bbxWidth, b.bbxHeight);
+  Sprite spriteC(font.getBitmap(c), Bitmap::MONOCHROME, 0xf, c.bbxWidth, c.bbxHeight);
+  size_t larger = spriteB.getSize() > spriteC.getSize() ? spriteB.getSize() : spriteC.getSize();
+  GlyphCache cache(sprite.getSize() + larger, 8);
+
+  const Sprite *first = cache.get(font, a, 0xf);
+  TEST_ASSERT_NOT_NULL(first);
+  TEST_ASSERT_EQUAL_MEMORY(sprite.getRows(false), first->getRows(false), sprite.getSize());
+
+  // colors are cached separately
+  TEST_ASSERT_NOT_NULL(cache.get(font, a, 0x3));
+  TEST_ASSERT_EQUAL_PTR(first, cache.get(font, a, 0xf));
+  TEST_ASSERT_EQUAL(2, cache.getGlyphCount());
+
+  // a was used last, so the other color of it makes room for b and c in turn
+  cache.get(font, b, 0xf);
+  TEST_ASSERT_EQUAL_PTR(first, cache.get(font, a, 0xf));
+  cache.get(font, c, 0xf);
+  TEST_ASSERT_EQUAL_PTR(first, cache.get(font, a, 0xf));
+  TEST_ASSERT_TRUE(cache.getUsedBytes() <= cache.getBudget());
+  TEST_ASSERT_EQUAL(3, cache.getHits());
+  TEST_ASSERT_EQUAL(4, cache.getMisses());
+
+  // glyphs larger than the whole budget aren't cached
+  GlyphCache tiny(4);
+  TEST_ASSERT_NULL(tiny.get(font, a, 0xf));
+  TEST_ASSERT_EQUAL(0, tiny.getGlyphCount());
+}
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+static uint8_t getNibble(const uint8_t *buffer, int16_t x, int16_t y) {
+  uint8_t pixels = buffer[(y * TestDriver::BYTES_PER_ROW) + (x / 2)];
+  return x % 2 == 0 ? pixels >> 4 : pixels & 0x0f;
+}
+
+static void setNibble(uint8_t *buffer, int16_t x, int16_t y, uint8_t color) {
+  uint8_t &pixels = buffer[(y * TestDriver::BYTES_PER_ROW) + (x / 2)];
+  pixels = x % 2 == 0 ? (pixels & 0x0f) | (color << 4) : (pixels & 0xf0) | color;
+}
+
+// the frame of `buffer` turned a quarter clockwise
+static void turnBuffer(const uint8_t *buffer, uint8_t *turned) {
+  for (int16_t y = 0; y < 64; y++) {
+    for (int16_t x = 0; x < 64; x++)
+      setNibble(turned, 63 - y, x, getNibble(buffer, x, y));
+  }
+}
+
+// every primitive, bitmaps of both formats at both nibble offsets and with odd sizes, clipped on every edge
+static void drawScene(::Display::Display &display) {
+  static uint8_t monochrome[(21 * 19) / 8 + 1];
+  static uint8_t grayscale[(13 * 11) / 2 + 1];
+  for (size_t i = 0; i < sizeof(monochrome); i++)
+    monochrome[i] = (i * 73) ^ 0x5a;
+  for (size_t i = 0; i < sizeof(grayscale); i++)
+    grayscale[i] = i % 3 == 0 ? (i * 37) & 0xf0 : (i * 73) ^ 0x5a;
+
+  display.drawPixel(20, 21, 0x3);
+  display.drawLine(-30, 70, 90, -10, 0xf);
+  display.drawLine(10, 5, 10, 60, 0x7);
+  display.drawCircle(Origin::Object2D::CENTER, 32, 32, 30, 0xc);
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 41, 3, 17, 26, 0x2);
+  display.drawText(Origin::Text::TOP_LEFT, 2, 2, Font::bailleul_8_pt, (char *)"Turn", 0xb, {.transparent = true});
+
+  int16_t positions[][2] = {{30, 40}, {31, 41}, {-4, 50}, {55, -3}, {50, 55}};
+  for (auto &position : positions) {
+    display.drawBitmap(Origin::Object2D::TOP_LEFT, position[0], position[1], 21, 19, Bitmap::MONOCHROME, monochrome,
+                       0xe);
+    display.drawBitmap(Origin::Object2D::TOP_LEFT, position[0] - 20, position[1] - 25, 21, 19, Bitmap::MONOCHROME,
+                       monochrome, 0x6, {.transparent = true});
+    display.drawBitmap(Origin::Object2D::TOP_LEFT, position[1], position[0], 13, 11, Bitmap::GRAYSCALE_4_BIT,
+                       grayscale, 0);
+    display.drawBitmap(Origin::Object2D::TOP_LEFT, position[1] - 9, position[0] - 30, 13, 11, Bitmap::GRAYSCALE_4_BIT,
+                       grayscale, 0, {.transparent = true});
+  }
+
+  Point points[] = {{0, 0}, {63, 0}, {5, 62}, {33, 17}, {64, 3}};
+  display.drawPixels(points, sizeof(points) / sizeof(points[0]), 0x8);
+
+  Span spans[] = {{-5, 12, 80}, {27, 13, 3}, {50, 63, 20}, {0, 0, 1}};
+  display.drawSpans(spans, sizeof(spans) / sizeof(spans[0]), 0x4);
+}
+
+TEST_CASE("Quarter turns draw the turned frame", "[rotation]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  display.clear();
+  drawScene(display);
+  turnBuffer(driver.getBuffer(), expected);
+
+  Rotation rotations[] = {Rotation::CLOCKWISE_90, Rotation::CLOCKWISE_270};
+  for (Rotation rotation : rotations) {
+    // the half turn of 270 degrees is added while printing, the buffer is the same
+    TEST_ASSERT_EQUAL(ESP_OK, display.setRotation(rotation));
+    display.clear();
+    drawScene(display);
+    TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+  }
+
+  // the clip stays in screen coordinates
+  display.clear();
+  display.update();
+  display.pushClip({10, 0, 5, 64});
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 0, 64, 64, 0xf);
+  display.popClip();
+  TEST_ASSERT_EQUAL(1, driver.getDamage().size());
+  Rect damage = driver.getDamage()[0];
+  TEST_ASSERT_EQUAL(0, damage.x);
+  TEST_ASSERT_EQUAL(10, damage.y);
+  TEST_ASSERT_EQUAL(64, damage.width);
+  TEST_ASSERT_EQUAL(5, damage.height);
+}
+
+TEST_CASE("Changing the rotation turns the buffer", "[rotation]") {
+  static uint8_t unturned[TestDriver::BUFFER_SIZE];
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  display.clear();
+  drawScene(display);
+  memcpy(unturned, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+  turnBuffer(unturned, expected);
+
+  TEST_ASSERT_EQUAL(ESP_OK, display.setRotation(Rotation::CLOCKWISE_90));
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  // half turns are left to the driver
+  TEST_ASSERT_EQUAL(ESP_OK, display.setRotation(Rotation::CLOCKWISE_270));
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  TEST_ASSERT_EQUAL(ESP_OK, display.setRotation(Rotation::CLOCKWISE_180));
+  TEST_ASSERT_EQUAL_MEMORY(unturned, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  Driver::SerialDriver<64, 16> wideDriver;
+  TEST_ASSERT_EQUAL(ESP_ERR_NOT_SUPPORTED, wideDriver.setRotation(Rotation::CLOCKWISE_90));
+  TEST_ASSERT_EQUAL(ESP_OK, wideDriver.setRotation(Rotation::CLOCKWISE_180));
+}
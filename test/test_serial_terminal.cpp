@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "sdkconfig.h"
+
+#ifdef CONFIG_IDF_TARGET_LINUX
+
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+// the terminal writes straight to stdout, so it is pointed at a temporary file while drawing
+static char captured[1 << 19];
+static size_t capturedLength;
+static int savedStdout;
+static FILE *captureFile;
+
+static void startCapture() {
+  fflush(stdout);
+  captureFile = tmpfile();
+  TEST_ASSERT_NOT_NULL(captureFile);
+
+  savedStdout = dup(STDOUT_FILENO);
+  dup2(fileno(captureFile), STDOUT_FILENO);
+}
+
+static void stopCapture() {
+  fflush(stdout);
+  dup2(savedStdout, STDOUT_FILENO);
+  close(savedStdout);
+
+  rewind(captureFile);
+  capturedLength = fread(captured, 1, sizeof(captured) - 1, captureFile);
+  captured[capturedLength] = '\0';
+  fclose(captureFile);
+}
+
+static void drawCaptured(Driver::SerialTerminal &terminal, uint8_t *buffer, Rotation rotation = Rotation::DEFAULT) {
+  startCapture();
+  esp_err_t err = terminal.drawFrame(buffer, rotation);
+  stopCapture();
+  TEST_ASSERT_EQUAL(ESP_OK, err);
+}
+
+// a full redraw clears the screen and then prints what printFrame prints
+static void expectFullRedraw(Driver::SerialTerminal &terminal, uint8_t *buffer, Rotation rotation = Rotation::DEFAULT) {
+  static char frame[sizeof(captured)];
+
+  startCapture();
+  esp_err_t err = terminal.printFrame(buffer, rotation);
+  stopCapture();
+  TEST_ASSERT_EQUAL(ESP_OK, err);
+  memcpy(frame, captured, capturedLength + 1);
+
+  drawCaptured(terminal, buffer, rotation);
+  TEST_ASSERT_EQUAL_STRING_LEN("\033[2J\033[H\r", captured, 8);
+  TEST_ASSERT_EQUAL_STRING(frame, captured + 8);
+}
+
+static void setPixel(uint8_t *buffer, uint16_t width, uint16_t x, uint16_t y, uint8_t value) {
+  uint8_t &byte = buffer[(y * (width / 2)) + (x / 2)];
+  byte = x % 2 == 0 ? (byte & 0x0f) | (value << 4) : (byte & 0xf0) | value;
+}
+
+TEST_CASE("Serial terminals rewrite only changed cells", "[serial]") {
+  static uint8_t buffer[32 * 64];
+  memset(buffer, 0, sizeof(buffer));
+
+  Driver::SerialTerminal terminal(64, 64);
+  terminal.setDeltaUpdates(true);
+  expectFullRedraw(terminal, buffer);
+
+  // an unchanged frame only moves the cursor below the frame
+  drawCaptured(terminal, buffer);
+  TEST_ASSERT_EQUAL_STRING("\033[67;1H", captured);
+
+  // the border takes up the first row and column
+  setPixel(buffer, 64, 10, 5, 0xf);
+  drawCaptured(terminal, buffer);
+  TEST_ASSERT_EQUAL_STRING("\033[7;12H█\033[67;1H", captured);
+
+  // two unchanged cells between changed ones are rewritten rather than jumped over, three are not
+  setPixel(buffer, 64, 10, 5, 0x0);
+  drawCaptured(terminal, buffer);
+
+  setPixel(buffer, 64, 10, 5, 0xf);
+  setPixel(buffer, 64, 13, 5, 0xf);
+  drawCaptured(terminal, buffer);
+  TEST_ASSERT_EQUAL_STRING("\033[7;12H█  █\033[67;1H", captured);
+
+  memset(buffer, 0, sizeof(buffer));
+  drawCaptured(terminal, buffer);
+
+  setPixel(buffer, 64, 10, 5, 0xf);
+  setPixel(buffer, 64, 14, 5, 0xf);
+  drawCaptured(terminal, buffer);
+  TEST_ASSERT_EQUAL_STRING("\033[7;12H█\033[7;16H█\033[67;1H", captured);
+}
+
+TEST_CASE("Serial terminals fall back to full redraws", "[serial]") {
+  Driver::SERIAL_64X64_DRIVER driver;
+  ::Display::Display display(&driver);
+  driver.setDeltaOutput(true);
+
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 4, 4, 20, 10, 0x9);
+  startCapture();
+  display.update();
+  stopCapture();
+  TEST_ASSERT_EQUAL_STRING_LEN("\033[2J\033[H\r", captured, 8);
+
+  // cells move around with a half turn, so the delta to the last frame is meaningless
+  display.setRotation(Rotation::CLOCKWISE_180);
+  startCapture();
+  driver.printBuffer();
+  stopCapture();
+  static char frame[sizeof(captured)];
+  memcpy(frame, captured, capturedLength + 1);
+
+  startCapture();
+  display.update();
+  stopCapture();
+  TEST_ASSERT_EQUAL_STRING_LEN("\033[2J\033[H\r", captured, 8);
+  TEST_ASSERT_EQUAL_STRING(frame, captured + 8);
+
+  // after invalidate() even an unchanged frame is printed in full
+  static uint8_t buffer[32 * 64];
+  memset(buffer, 0x33, sizeof(buffer));
+  Driver::SerialTerminal terminal(64, 64);
+  terminal.setDeltaUpdates(true);
+  drawCaptured(terminal, buffer);
+  terminal.invalidate();
+  expectFullRedraw(terminal, buffer);
+
+  // Isolated changed cells each cost a cursor move, with three digit rows and columns that is more than the output
+  // buffer holds. Smaller terminals can't overflow it this way.
+  static uint8_t large[150 * 300];
+  memset(large, 0, sizeof(large));
+  Driver::SerialTerminal largeTerminal(300, 300);
+  largeTerminal.setDeltaUpdates(true);
+  drawCaptured(largeTerminal, large);
+
+  for (uint16_t y = 0; y < 300; y++) {
+    for (uint16_t x = 0; x < 300; x += 4)
+      setPixel(large, 300, x, y, 0xf);
+  }
+  expectFullRedraw(largeTerminal, large);
+}
+
+TEST_CASE("Serial terminals print half turned frames mirrored", "[serial]") {
+  // a full pixel at the top left and a medium one at the bottom right
+  uint8_t buffer[] = {0xf0, 0x00, 0x00, 0x05};
+  Driver::SerialTerminal terminal(4, 2);
+
+  startCapture();
+  terminal.printFrame(buffer, Rotation::DEFAULT);
+  stopCapture();
+  TEST_ASSERT_EQUAL_STRING("┏━━━━┓\n┃█   ┃\n┃   ▒┃\n┗━━━━┛\n", captured);
+
+  // quarter turns are already in the buffer, the terminal mirrors both half turns
+  Rotation rotations[] = {Rotation::CLOCKWISE_180, Rotation::CLOCKWISE_270};
+  for (Rotation rotation : rotations) {
+    startCapture();
+    terminal.printFrame(buffer, rotation);
+    stopCapture();
+    TEST_ASSERT_EQUAL_STRING("┏━━━━┓\n┃▒   ┃\n┃   █┃\n┗━━━━┛\n", captured);
+
+    terminal.invalidate();
+    drawCaptured(terminal, buffer, rotation);
+    TEST_ASSERT_EQUAL_STRING("\033[2J\033[H\r┏━━━━┓\n┃▒   ┃\n┃   █┃\n┗━━━━┛\n", captured);
+  }
+}
+
+TEST_CASE("Serial terminals fit frames of the widest glyphs", "[serial]") {
+  // every cell and border is a 3 byte glyph
+  static uint8_t buffer[32 * 64];
+  memset(buffer, 0xff, sizeof(buffer));
+
+  static char expected[Driver::SerialTerminal::outputSize(64, 64)];
+  char *end = expected;
+  end += sprintf(end, "\033[2J\033[H\r");
+  for (uint16_t y = 0; y < 66; y++) {
+    end += sprintf(end, y == 0 ? "┏" : y == 65 ? "┗" : "┃");
+    for (uint16_t x = 0; x < 64; x++)
+      end += sprintf(end, y == 0 || y == 65 ? "━" : "█");
+    end += sprintf(end, y == 0 ? "┓\n" : y == 65 ? "┛\n" : "┃\n");
+  }
+
+  Driver::SerialTerminal terminal(64, 64);
+  drawCaptured(terminal, buffer);
+  TEST_ASSERT_EQUAL(end - expected, capturedLength);
+  TEST_ASSERT_EQUAL_STRING(expected, captured);
+  TEST_ASSERT_TRUE(capturedLength <= Driver::SerialTerminal::outputSize(64, 64));
+}
+
+TEST_CASE("Half blocks pick a glyph from both pixels of a cell", "[serial]") {
+  // upper and lower pixels of each column: ▀ ▄ █ blank, then shaded combinations
+  uint8_t buffer[] = {
+      0xf0, 0xf0, 0x05, 0xf1, 0x91, // f 0 f 0 0 5 f 1 9 1
+      0x0f, 0xf0, 0x55, 0x5f, 0x00, // 0 f f 0 5 5 5 f 0 0
+  };
+  Driver::SerialTerminal terminal(10, 2);
+  terminal.setHalfBlocks(true);
+
+  startCapture();
+  terminal.printFrame(buffer, Rotation::DEFAULT);
+  stopCapture();
+  TEST_ASSERT_EQUAL_STRING("┏━━━━━━━━━━┓\n┃▀▄█ ░▒▓▓▀░┃\n┗━━━━━━━━━━┛\n", captured);
+}
+
+TEST_CASE("Half blocks cover odd heights and half turns", "[serial]") {
+  uint8_t buffer[] = {0xf0, 0x0f, 0xff};
+  Driver::SerialTerminal terminal(2, 3);
+  terminal.setHalfBlocks(true);
+  terminal.setDeltaUpdates(true);
+
+  // the last row has no lower half
+  drawCaptured(terminal, buffer);
+  TEST_ASSERT_EQUAL_STRING("\033[2J\033[H\r┏━━┓\n┃▀▄┃\n┃▀▀┃\n┗━━┛\n", captured);
+
+  drawCaptured(terminal, buffer);
+  TEST_ASSERT_EQUAL_STRING("\033[5;1H", captured);
+
+  buffer[2] = 0x0f;
+  drawCaptured(terminal, buffer);
+  TEST_ASSERT_EQUAL_STRING("\033[3;2H \033[5;1H", captured);
+
+  // both halves are mirrored, the missing lower half is still at the bottom
+  buffer[2] = 0xff;
+  startCapture();
+  terminal.printFrame(buffer, Rotation::CLOCKWISE_180);
+  stopCapture();
+  TEST_ASSERT_EQUAL_STRING("┏━━┓\n┃█▀┃\n┃ ▀┃\n┗━━┛\n", captured);
+}
+
+TEST_CASE("Toggling half blocks redraws the whole frame", "[serial]") {
+  static uint8_t buffer[32 * 64];
+  memset(buffer, 0x0f, sizeof(buffer));
+
+  Driver::SerialTerminal terminal(64, 64);
+  terminal.setDeltaUpdates(true);
+  drawCaptured(terminal, buffer);
+
+  terminal.setHalfBlocks(true);
+  expectFullRedraw(terminal, buffer);
+
+  // setting the same mode again keeps the delta
+  terminal.setHalfBlocks(true);
+  drawCaptured(terminal, buffer);
+  TEST_ASSERT_EQUAL_STRING("\033[35;1H", captured);
+
+  terminal.setHalfBlocks(false);
+  expectFullRedraw(terminal, buffer);
+}
+
+#endif
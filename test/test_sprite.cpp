@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Canvas.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+TEST_CASE("Sprites match their bitmaps", "[sprite]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+  static uint8_t background[TestDriver::BUFFER_SIZE];
+
+  // every other byte has a transparent nibble
+  uint8_t bitmap[1024];
+  for (size_t i = 0; i < sizeof(bitmap); i++)
+    bitmap[i] = i % 2 == 0 ? (i * 37) & 0xf0 : (i * 73) ^ 0x5a;
+
+  for (size_t i = 0; i < sizeof(background); i++)
+    background[i] = i * 7;
+
+  Flags flagCombinations[4];
+  flagCombinations[1].transparent = true;
+  flagCombinations[2].erase = true;
+  flagCombinations[3].erase = true;
+  flagCombinations[3].transparent = true;
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  // both parities of x, with and without clipping on every edge
+  int16_t positions[][2] = {{0, 0}, {1, 3}, {4, 7}, {-3, 2}, {-4, 1}, {2, -5}, {30, 60}, {33, 9}, {61, 9}};
+  uint16_t widths[] = {1, 2, 3, 8, 33, 64, 65};
+
+  for (uint16_t width : widths) {
+    uint16_t height = (sizeof(bitmap) * 2) / width;
+    if (height > 20)
+      height = 20;
+
+    Sprite sprite(bitmap, width, height);
+    TEST_ASSERT_NOT_NULL(sprite.getRows(false));
+
+    for (Flags flags : flagCombinations) {
+      for (auto &position : positions) {
+        memcpy(driver.getBuffer(), background, sizeof(background));
+        display.drawBitmap(Origin::Object2D::TOP_LEFT, position[0], position[1], width, height,
+                           Bitmap::GRAYSCALE_4_BIT, bitmap, flags);
+        memcpy(expected, driver.getBuffer(), sizeof(expected));
+
+        memcpy(driver.getBuffer(), background, sizeof(background));
+        display.drawSprite(Origin::Object2D::TOP_LEFT, position[0], position[1], sprite, flags);
+
+        TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+      }
+    }
+  }
+}
+
+TEST_CASE("Sprites fall back to bitmaps", "[sprite]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  uint8_t bitmap[(13 * 11) / 2 + 1];
+  for (size_t i = 0; i < sizeof(bitmap); i++)
+    bitmap[i] = (i * 73) ^ 0x5a;
+
+  Sprite sprite(bitmap, 13, 11);
+
+  // quarter turned buffers
+  TestDriver driver;
+  ::Display::Display display(&driver);
+  display.setRotation(Rotation::CLOCKWISE_90);
+
+  display.clear();
+  display.drawBitmap(Origin::Object2D::TOP_LEFT, 21, -4, 13, 11, Bitmap::GRAYSCALE_4_BIT, bitmap);
+  memcpy(expected, driver.getBuffer(), sizeof(expected));
+
+  display.clear();
+  display.drawSprite(Origin::Object2D::TOP_LEFT, 21, -4, sprite);
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  // monochrome canvases
+  Canvas bitmapCanvas(40, 30, Bitmap::MONOCHROME), spriteCanvas(40, 30, Bitmap::MONOCHROME);
+  ::Display::Display bitmapDisplay(&bitmapCanvas), spriteDisplay(&spriteCanvas);
+  bitmapDisplay.setup();
+  spriteDisplay.setup();
+
+  bitmapDisplay.drawBitmap(Origin::Object2D::CENTER, 20, 15, 13, 11, Bitmap::GRAYSCALE_4_BIT, bitmap);
+  spriteDisplay.drawSprite(Origin::Object2D::CENTER, 20, 15, sprite);
+  TEST_ASSERT_EQUAL_MEMORY(bitmapCanvas.getBuffer(), spriteCanvas.getBuffer(), bitmapCanvas.getBufferSize());
+}
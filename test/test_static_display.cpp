@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cmath>
+#include <cstring>
+
+#include "unity.h"
+
+#include "StaticDisplay.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+template <typename DisplayType> static void drawScene(DisplayType &display) {
+  display.clear();
+  display.drawPixel(63, 63, 0x3);
+  display.drawLine(2, 60, 61, 3, 0xf);
+  display.drawLine(10, 5, 10, 40, 0x7);
+  display.drawLine(Origin::Object1D::MIDPOINT, 32, 32, 40, M_PI / 3, 0xa);
+  display.drawCircle(Origin::Object2D::CENTER, 32, 32, 30, 0xc);
+  display.drawCircle(Origin::Object2D::TOP_LEFT, -5, 50, 21, 0x5);
+  display.drawRectangle(Origin::Object2D::BOTTOM_RIGHT, 60, 60, 17, 9, 0x9);
+  display.fillRectangle(Origin::Object2D::TOP_LEFT, 41, 3, 7, 6, 0x2);
+}
+
+TEST_CASE("Frame buffer driver geometry is known at compile time", "[static display]") {
+  static_assert(TestDriver::BYTES_PER_ROW == 32, "");
+  static_assert(TestDriver::BUFFER_SIZE == (64 * 64 * 4) / 8, "");
+
+  TestDriver driver;
+  TEST_ASSERT_EQUAL(64, driver.getWidth());
+  TEST_ASSERT_EQUAL(TestDriver::BUFFER_SIZE, driver.getBufferSize());
+}
+
+TEST_CASE("Static display draws the same as the virtual one", "[static display]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+  drawScene(display);
+  memcpy(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+
+  StaticDisplay<TestDriver> staticDisplay(&driver);
+  drawScene(staticDisplay);
+  TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+}
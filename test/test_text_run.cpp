@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2023 KOINSLOT, Inc.
+//
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <cstring>
+
+#include "unity.h"
+
+#include "Display.hpp"
+
+using namespace Display;
+
+typedef Driver::SERIAL_64X64_DRIVER TestDriver;
+
+TEST_CASE("Text runs draw the same as text", "[text run]") {
+  static uint8_t expected[TestDriver::BUFFER_SIZE];
+
+  TestDriver driver;
+  ::Display::Display display(&driver);
+  GlyphCache cache(4096);
+
+  // a negative first offset, a descender and a character the font doesn't have
+  char text[] = "jog \xc3\xa9\xe2\x82\xac";
+  const Font::Font &font = Font::bailleul_bold_12_pt;
+
+  TextRun run(16);
+  TEST_ASSERT_EQUAL(ESP_OK, display.layoutText(font, text, run));
+  TEST_ASSERT_EQUAL_PTR(&font, run.getFont());
+  TEST_ASSERT_EQUAL(6, run.getLength());
+  TEST_ASSERT_EQUAL_PTR(&font.getCharacter('j'), run[0].character);
+  TEST_ASSERT_EQUAL(0, run[0].x);
+  TEST_ASSERT_EQUAL(font.getCharacter('j').deviceWidthX, run[1].x);
+
+  uint16_t width, height;
+  display.getTextSize(font, text, width, height);
+  TEST_ASSERT_EQUAL(width, run.getWidth());
+  TEST_ASSERT_EQUAL(height, run.getHeight());
+
+  Origin::Text origins[] = {
+      Origin::Text::TOP_LEFT,
+      Origin::Text::TOP_RIGHT,
+      Origin::Text::BOTTOM_LEFT,
+      Origin::Text::BOTTOM_RIGHT,
+      Origin::Text::CENTER,
+      Origin::Text::BASELINE_LEFT,
+      Origin::Text::BASELINE_CENTER,
+      Origin::Text::BASELINE_RIGHT,
+  };
+  GlyphCache *caches[] = {nullptr, &cache};
+
+  for (GlyphCache *glyphCache : caches) {
+    display.setGlyphCache(glyphCache);
+
+    for (Origin::Text origin : origins) {
+      display.clear();
+      display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 20, 64, 20, 0x5);
+      display.drawText(origin, 30, 30, font, text, 0xb);
+      display.drawText(origin, -5, 50, font, text, 0x7, {.transparent = true});
+      memcpy(expected, driver.getBuffer(), sizeof(expected));
+
+      display.clear();
+      display.fillRectangle(Origin::Object2D::TOP_LEFT, 0, 20, 64, 20, 0x5);
+      display.drawTextRun(origin, 30, 30, run, 0xb);
+      display.drawTextRun(origin, -5, 50, run, 0x7, {.transparent = true});
+      TEST_ASSERT_EQUAL_MEMORY(expected, driver.getBuffer(), TestDriver::BUFFER_SIZE);
+    }
+  }
+}
+
+TEST_CASE("Text that doesn't fit leaves the run empty", "[text run]") {
+  TestDriver driver;
+  ::Display::Display display(&driver);
+
+  TextRun run(4);
+  TEST_ASSERT_EQUAL(4, run.getMaxGlyphs());
+  TEST_ASSERT_EQUAL(ESP_OK, display.layoutText(Font::bailleul_8_pt, (char *)"Four", run));
+  TEST_ASSERT_EQUAL(4, run.getLength());
+
+  TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, display.layoutText(Font::bailleul_8_pt, (char *)"Fifth", run));
+  TEST_ASSERT_NULL(run.getFont());
+  TEST_ASSERT_EQUAL(0, run.getLength());
+  TEST_ASSERT_EQUAL(0, run.getWidth());
+
+  // an empty run draws nothing
+  display.clear();
+  display.drawTextRun(Origin::Text::TOP_LEFT, 0, 0, run, 0xf);
+  for (size_t i = 0; i < TestDriver::BUFFER_SIZE; i++)
+    TEST_ASSERT_EQUAL_HEX8(0, driver.getBuffer()[i]);
+}
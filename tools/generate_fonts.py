@@ -4,35 +4,12 @@
 
 from __future__ import annotations
 
-from collections import OrderedDict
-
 import os
 import sys
 import yaml
 
-# This file is used to convert TTF fonts to compressed and encoded byte strings
-# that can be used by the Display component.
-
-
-# Hex encodes an unsigned integer, filling num_bytes bytes. E.g.
-#   - unsigned(1, 1) == "01"
-#   - unsigned(1, 2) == "0001"
-#   - unsigned(178, 1) == "B2"
-#   - unsigned(1788, 2) == "06FC"
-def unsigned(data: int, num_bytes) -> int:
-    return f"{data:0{num_bytes * 2}x}"
-
-
-# Hex encodes a signed integer, filling num_bytes. E.g.
-#   - X > 0 => signed(X, N) == unsigned(X, N)
-#   - signed(-1, 1) == "FF"
-#   - signed(-1, 2) == "FFFF"
-#   - signed(-16, 2) == "FFF0"
-#   - signed(-1788, 2) == "F904"
-def signed(data: int, num_bytes) -> int:
-    if data < 0:
-        return f"{(2 ** (8 * num_bytes)) + data:0{num_bytes * 2}x}"
-    return unsigned(data, num_bytes)
+# This file is used to convert TTF fonts to tables of character metrics and
+# packed bitmaps that can be used by the Display component.
 
 
 # iterate through a string of hex digits two at a time, i.e. 1 byte at a time
@@ -45,17 +22,19 @@ def iter_bytes(hex_data: str) -> str:
             return ""
 
 
-# Holds encoding information
-class Encoding:
-    offsets: OrderedDict = OrderedDict()
+# printable ASCII characters, which are looked up without a search
+ASCII_FIRST_CODE = 0x20
+ASCII_LAST_CODE = 0x7E
+
+
+# bytes of bitmaps in a line of the generated source
+BITMAP_LINE_LENGTH = 12
 
 
 # Represents a character in a BDF font file
 class Char:
-    def __init__(self, encoding):
-        self.encoding = encoding
-
-        self.code: str  # char identifier
+    def __init__(self):
+        self.code: str  # char identifier, the code in hex
 
         self.device_width: tuple[
             int,  # pixel width
@@ -71,57 +50,13 @@ class Char:
 
         self.bitmap: list[list[int]]  # list of rows in binary
 
-    # compresses and encodes the character into a hex string
-    def encode(self) -> str:
+    def code_point(self) -> int:
+        return int(self.code, 16)
+
+    # packs the bitmap into a hex string, 8 pixels per byte without padding
+    # between rows and the last byte right padded with zeros
+    def encode_bitmap(self) -> str:
         output = ""
-        total_offset = 0
-
-        # character code
-        self.encoding.offsets["CHARACTER_CODE"] = total_offset
-        self.encoding.offsets["CHARACTER_CODE_TYPE"] = "uint16_t"
-        total_offset += 2
-        output += self.code
-
-        # bytes in encoded character
-        self.encoding.offsets["CHARACTER_BYTES"] = total_offset
-        self.encoding.offsets["CHARACTER_BYTES_TYPE"] = "uint16_t"
-        total_offset += 2
-        output += "0000"  # placeholder to be overwritten later
-
-        # device width
-        self.encoding.offsets["CHARACTER_DEVICE_WIDTH_X"] = total_offset
-        self.encoding.offsets["CHARACTER_DEVICE_WIDTH_X_TYPE"] = "uint8_t"
-        total_offset += 1
-        output += unsigned(self.device_width[0], 1)
-
-        self.encoding.offsets["CHARACTER_DEVICE_WIDTH_Y"] = total_offset
-        self.encoding.offsets["CHARACTER_DEVICE_WIDTH_Y_TYPE"] = "uint8_t"
-        total_offset += 1
-        output += unsigned(self.device_width[1], 1)
-
-        # bbx
-        self.encoding.offsets["CHARACTER_BBX_WIDTH"] = total_offset
-        self.encoding.offsets["CHARACTER_BBX_WIDTH_TYPE"] = "uint8_t"
-        total_offset += 1
-        output += unsigned(self.bbx[0], 1)
-
-        self.encoding.offsets["CHARACTER_BBX_HEIGHT"] = total_offset
-        self.encoding.offsets["CHARACTER_BBX_HEIGHT_TYPE"] = "uint8_t"
-        total_offset += 1
-        output += unsigned(self.bbx[1], 1)
-
-        self.encoding.offsets["CHARACTER_BBX_X_OFFSET"] = total_offset
-        self.encoding.offsets["CHARACTER_BBX_X_OFFSET_TYPE"] = "int8_t"
-        total_offset += 1
-        output += signed(self.bbx[2], 1)
-
-        self.encoding.offsets["CHARACTER_BBX_Y_OFFSET"] = total_offset
-        self.encoding.offsets["CHARACTER_BBX_Y_OFFSET_TYPE"] = "int8_t"
-        total_offset += 1
-        output += signed(self.bbx[3], 1)
-
-        # bitmap
-        self.encoding.offsets["CHARACTER_BITMAP"] = total_offset
 
         binary_bitmap = [pixel for row in self.bitmap for pixel in row]
 
@@ -138,17 +73,28 @@ class Char:
             head += 8
             bits = binary_bitmap[head : head + 8]
 
-        # overwrite character bytes now that we have the full size
-        output = output[0:4] + unsigned(int(len(output) / 2), 2) + output[8:]
-
         return output
 
+    # initializer of the Display::Font::Character holding the metrics of this
+    # character, its bitmap starts at `bitmap` in the bitmaps of the font
+    def encode_metrics(self, bitmap: int) -> str:
+        fields = [
+            f"0x{self.code_point():04X}",
+            bitmap,
+            self.device_width[0],
+            self.device_width[1],
+            self.bbx[0],
+            self.bbx[1],
+            self.bbx[2],
+            self.bbx[3],
+        ]
+        return "{" + ", ".join(map(str, fields)) + "}"
+
 
 # Represents a BDF font file
 class Font:
-    def __init__(self, encoding, file, name):
+    def __init__(self, file, name):
         self.name = name
-        self.encoding = encoding
 
         self.size: int  # font size in pixels
 
@@ -171,8 +117,11 @@ class Font:
 
         self.parse_bdf_file(file)
 
+        # characters are looked up with a binary search by code
+        self.chars.sort(key=Char.code_point)
+
         # create a custom character to use when a character isn't available in the font
-        missing_char_replacement = Char(encoding)
+        missing_char_replacement = Char()
         missing_char_replacement.code = "0000"
 
         width = int(self.size / 2)
@@ -198,66 +147,9 @@ class Font:
 
         self.chars.insert(0, missing_char_replacement)
 
-    # compresses and encodes the font into a hex string
-    def encode(self) -> str:
-        output = ""
-        total_offset = 0
-
-        # size
-        self.encoding.offsets["FONT_SIZE"] = total_offset
-        self.encoding.offsets["FONT_SIZE_TYPE"] = "uint8_t"
-        total_offset += 1
-        output += unsigned(self.size, 1)
-
-        # characters
-        self.encoding.offsets["FONT_CHARACTERS"] = total_offset
-        self.encoding.offsets["FONT_CHARACTERS_TYPE"] = "uint16_t"
-        total_offset += 2
-        output += unsigned(self.num_chars, 2)
-
-        # bounding box
-        self.encoding.offsets["FONT_BOUNDING_BOX_WIDTH"] = total_offset
-        self.encoding.offsets["FONT_BOUNDING_BOX_WIDTH_TYPE"] = "uint8_t"
-        total_offset += 1
-        output += unsigned(self.bounding_box[0], 1)
-
-        self.encoding.offsets["FONT_BOUNDING_BOX_HEIGHT"] = total_offset
-        self.encoding.offsets["FONT_BOUNDING_BOX_HEIGHT_TYPE"] = "uint8_t"
-        total_offset += 1
-        output += unsigned(self.bounding_box[1], 1)
-
-        self.encoding.offsets["FONT_BOUNDING_BOX_X_OFFSET"] = total_offset
-        self.encoding.offsets["FONT_BOUNDING_BOX_X_OFFSET_TYPE"] = "int8_t"
-        total_offset += 1
-        output += signed(self.bounding_box[2], 1)
-
-        self.encoding.offsets["FONT_BOUNDING_BOX_Y_OFFSET"] = total_offset
-        self.encoding.offsets["FONT_BOUNDING_BOX_Y_OFFSET_TYPE"] = "int8_t"
-        total_offset += 1
-        output += signed(self.bounding_box[3], 1)
-
-        # ascent
-        self.encoding.offsets["FONT_ASCENT"] = total_offset
-        self.encoding.offsets["FONT_ASCENT_TYPE"] = "uint8_t"
-        total_offset += 1
-        output += unsigned(self.ascent, 1)
-
-        # descent
-        self.encoding.offsets["FONT_DESCENT"] = total_offset
-        self.encoding.offsets["FONT_DESCENT_TYPE"] = "uint8_t"
-        total_offset += 1
-        output += unsigned(self.descent, 1)
-
-        # characters
-        self.encoding.offsets["FONT_FIRST_CHARACTER"] = total_offset
-        for char in self.chars:
-            output += char.encode()
-
-        return output
-
     # parses a BDF font file to populate the fields in this class
     def parse_bdf_file(self, file: str):
-        current_char = Char(self.encoding)
+        current_char = Char()
         current_bitmap = []
         reading_bitmap = False
 
@@ -293,7 +185,7 @@ class Font:
                 elif line.upper().startswith("CHARS "):
                     self.num_chars = int(line.split()[1])
                 elif line.upper().startswith("STARTCHAR "):
-                    current_char = Char(self.encoding)
+                    current_char = Char()
                     current_char.code = line.split()[1]
                 elif line.upper().startswith("DWIDTH "):
                     current_char.device_width = tuple(map(int, line.split()[1:]))
@@ -305,11 +197,8 @@ class Font:
 
 
 # creates the header and source file code for a font
-def generate_encoded_font_code(font: Font) -> (str, str):
-    hex_data = font.encode()
-
+def generate_font_code(font: Font) -> (str, str):
     font_variable_name = f"{font.name}_{font.size}_pt"
-    font_array_size = int(len(hex_data) / 2) + 1
 
     docstring = (
         f"// {font.name}\n"
@@ -318,27 +207,60 @@ def generate_encoded_font_code(font: Font) -> (str, str):
         f"//   - Characters: {font.num_chars}\n"
     )
 
-    header = docstring + f"extern uint8_t {font_variable_name}[{font_array_size}];\n"
+    header = docstring + f"extern const Font {font_variable_name};\n"
 
-    source = docstring + f"uint8_t {font_variable_name}[{font_array_size}] ="
+    # metrics of every character, the missing character replacement first
+    bitmaps = ""
+    metrics = []
+    for char in font.chars:
+        metrics.append(char.encode_metrics(int(len(bitmaps) / 2)))
+        bitmaps += char.encode_bitmap()
 
-    # add `\x` prefix to all hex nibble pairs
-    formatted_bytes = ""
-    for byte in iter_bytes(font.encode()):
-        formatted_bytes += "\\x" + byte
+    if len(bitmaps) / 2 > 0xFFFF:
+        raise ValueError(f"the bitmaps of {font_variable_name} don't fit 16 bit offsets")
 
-    # split hex data into lines
-    line_length = 20
+    source = docstring
+    source += f"static constexpr Character {font_variable_name}_characters[{len(metrics)}] = {{\n"
+    for character in metrics:
+        source += f"    {character},\n"
+    source += "};\n"
+
+    # add `\x` prefix to all hex nibble pairs and split them into lines
+    formatted_bytes = ["\\x" + byte for byte in iter_bytes(bitmaps)]
     lines = [
-        formatted_bytes[i : i + (line_length * 4)]
-        for i in range(0, len(formatted_bytes), line_length * 4)
+        "".join(formatted_bytes[i : i + BITMAP_LINE_LENGTH])
+        for i in range(0, len(formatted_bytes), BITMAP_LINE_LENGTH)
     ]
 
+    bitmaps_size = int(len(bitmaps) / 2) + 1
+    source += f"\nstatic constexpr uint8_t {font_variable_name}_bitmaps[{bitmaps_size}] ="
     for line in lines:
         source += f'\n  "{line}"'
-
     source += ";\n"
 
+    # index of the printable ASCII characters in the metrics, 0 for the ones the
+    # font doesn't have since the missing character replacement comes first
+    indexes = {char.code_point(): i for i, char in enumerate(font.chars) if i > 0}
+    ascii_index = [
+        str(indexes.get(code, 0)) for code in range(ASCII_FIRST_CODE, ASCII_LAST_CODE + 1)
+    ]
+
+    source += (
+        f"\nconstexpr Font {font_variable_name} = {{\n"
+        f"    .size = {font.size},\n"
+        f"    .numCharacters = {font.num_chars},\n"
+        f"    .boundingBoxWidth = {font.bounding_box[0]},\n"
+        f"    .boundingBoxHeight = {font.bounding_box[1]},\n"
+        f"    .boundingBoxXOffset = {font.bounding_box[2]},\n"
+        f"    .boundingBoxYOffset = {font.bounding_box[3]},\n"
+        f"    .ascent = {font.ascent},\n"
+        f"    .descent = {font.descent},\n"
+        f"    .asciiIndex = {{{', '.join(ascii_index)}}},\n"
+        f"    .characters = {font_variable_name}_characters,\n"
+        f"    .bitmaps = {font_variable_name}_bitmaps,\n"
+        "};\n"
+    )
+
     return header, source
 
 
@@ -346,18 +268,17 @@ if __name__ == "__main__":
     with open("fonts.yaml") as f:
         font_configs = yaml.safe_load(f)["fonts"]
 
-    encoding = Encoding()
     fonts = []
 
     for font_config in font_configs:
         for size in font_config["size"]:
             bdf_file = f".make-cache/bdf-fonts/{font_config['name']}/{font_config['name']}.{size}.bdf"
-            fonts.append(Font(encoding, bdf_file, font_config["name"]))
+            fonts.append(Font(bdf_file, font_config["name"]))
 
     header_blocks = []
     source_blocks = []
     for font in fonts:
-        font_header, font_source = generate_encoded_font_code(font)
+        font_header, font_source = generate_font_code(font)
         header_blocks += ["\n" + font_header]
         source_blocks += ["\n" + font_source]
 
@@ -368,14 +289,11 @@ if __name__ == "__main__":
         "\n"
         "#pragma once\n"
         "\n"
-        '#include "esp_types.h"\n'
-        "\n"
         "namespace Display::Font {\n"
+        "\n"
+        "// defined in Font.hpp, which includes this\n"
+        "struct Font;\n"
     )
-
-    for offset, value in encoding.offsets.items():
-        header += f"\n#define {offset} {value}"
-    header += "\n"
     header += "".join(header_blocks)
 
     source = (
@@ -383,7 +301,7 @@ if __name__ == "__main__":
         "//\n"
         "// SPDX-License-Identifier: GPL-3.0-or-later\n"
         "\n"
-        '#include "Fonts.hpp"\n'
+        '#include "Font.hpp"\n'
         "\n"
         "namespace Display::Font {\n"
     )